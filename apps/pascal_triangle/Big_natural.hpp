@@ -0,0 +1,134 @@
+#pragma once
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint32_t, uint64_t
+#include <string.h>         // memcpy
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace app {
+    using   cppm::in_;
+    using   std::max,                       // <algorithm>
+            std::string,                    // <string>
+            std::vector;                    // <vector>
+
+    // A non-negative integer of any size, as a vector of base 10⁹ limbs with the least significant
+    // first. The decimal base makes formatting a matter of formatting each limb, which for output of
+    // big numbers is the main cost, while addition, and multiplication and division by a small
+    // number, are as simple as with a binary base.
+    class Big_natural
+    {
+        vector<uint32_t>    m_limbs;        // Never empty, and no zero limbs at the end except for 0.
+
+    public:
+        static constexpr uint32_t   base            = 1'000'000'000;
+        static constexpr int        digits_per_limb = 9;
+
+        Big_natural( const uint32_t value = 0 ):
+            m_limbs()
+        {
+            m_limbs.push_back( value % base );
+            if( value >= base ) { m_limbs.push_back( value/base ); }
+        }
+
+        auto n_limbs() const noexcept -> size_t { return m_limbs.size(); }
+        auto is_odd() const noexcept -> bool { return m_limbs.front() % 2 == 1; }   // The base is even.
+
+        auto n_digits() const noexcept
+            -> int
+        {
+            int n_top_digits = 1;
+            for( uint32_t v = m_limbs.back(); v >= 10; v /= 10 ) { ++n_top_digits; }
+            return digits_per_limb*int( m_limbs.size() - 1 ) + n_top_digits;
+        }
+
+        // Sets this to `a + b` reusing the limb buffer, so that e.g. a row of Pascal's triangle is
+        // computed from the previous one without allocations once the buffers have grown.
+        void assign_sum( in_<Big_natural> a, in_<Big_natural> b )
+        {
+            const size_t n_a = a.m_limbs.size();
+            const size_t n_b = b.m_limbs.size();
+            const size_t n = max( n_a, n_b );
+            m_limbs.resize( n );
+            uint32_t carry = 0;
+            for( size_t i = 0; i < n; ++i ) {
+                const uint32_t sum = (i < n_a? a.m_limbs[i] : 0) + (i < n_b? b.m_limbs[i] : 0) + carry;
+                carry = (sum >= base);
+                m_limbs[i] = sum - carry*base;
+            }
+            if( carry ) { m_limbs.push_back( carry ); }
+        }
+
+        void multiply_by( const uint32_t factor )
+        {
+            uint64_t carry = 0;
+            for( uint32_t& limb: m_limbs ) {
+                const uint64_t product = uint64_t( limb )*factor + carry;
+                limb = uint32_t( product % base );
+                carry = product/base;
+            }
+            for( ; carry > 0; carry /= base ) { m_limbs.push_back( uint32_t( carry % base ) ); }
+            if( factor == 0 ) { m_limbs.assign( 1, 0 ); }
+        }
+
+        // Returns the remainder.
+        auto divide_by( const uint32_t divisor )
+            -> uint32_t
+        {
+            uint64_t remainder = 0;
+            for( size_t i = m_limbs.size(); i-- > 0; ) {
+                const uint64_t part = remainder*base + m_limbs[i];
+                m_limbs[i] = uint32_t( part/divisor );
+                remainder = part % divisor;
+            }
+            while( m_limbs.size() > 1 and m_limbs.back() == 0 ) { m_limbs.pop_back(); }
+            return uint32_t( remainder );
+        }
+
+        void append_digits_to( string& s ) const
+        {
+            static constexpr char digit_pairs[] =
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+
+            const size_t n_limbs = m_limbs.size();
+            const size_t n_top_digits = size_t( n_digits() ) - digits_per_limb*(n_limbs - 1);
+            const size_t i_start = s.size();
+            s.resize( i_start + n_top_digits + digits_per_limb*(n_limbs - 1) );
+            char* p_beyond = s.data() + s.size();
+            for( size_t i = 0; i < n_limbs; ++i ) {         // Backwards through the digits.
+                uint32_t v = m_limbs[i];
+                const bool is_top = (i + 1 == n_limbs);
+                char* const p_first = p_beyond - (is_top? n_top_digits : digits_per_limb);
+                char* p = p_beyond;
+                for( ; p - p_first >= 2; v /= 100 ) {
+                    p -= 2;
+                    memcpy( p, digit_pairs + 2*(v % 100), 2 );
+                }
+                if( p > p_first ) { *--p = char( '0' + v ); }
+                p_beyond = p_first;
+            }
+        }
+
+        friend auto operator==( in_<Big_natural> a, in_<Big_natural> b ) noexcept
+            -> bool
+        { return a.m_limbs == b.m_limbs; }
+    };
+
+    // C(n, r), computed as the product of (n - k)/(k + 1) for k = 0 through r - 1, where each
+    // partial product is itself a binomial coefficient and so the division is exact.
+    inline auto binomial( const uint32_t n, const uint32_t r )
+        -> Big_natural
+    {
+        Big_natural result = 1;
+        for( uint32_t k = 0; k < r; ++k ) {
+            result.multiply_by( n - k );
+            result.divide_by( k + 1 );
+        }
+        return result;
+    }
+}  // namespace app
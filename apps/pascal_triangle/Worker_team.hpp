@@ -0,0 +1,106 @@
+#pragma once
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace app {
+    using   cppm::in_, cppm::No_copy_or_move;
+    using   std::condition_variable,        // <condition_variable>
+            std::exception_ptr, std::current_exception, std::rethrow_exception,     // <exception>
+            std::function,                  // <functional>
+            std::mutex, std::unique_lock,   // <mutex>
+            std::thread,                    // <thread>
+            std::exchange,                  // <utility>
+            std::vector;                    // <vector>
+
+    // Threads that are kept for running one function on all of them, many times, e.g. once per row
+    // of a table. The calling thread is worker 0, so a team of 1 has no extra threads. Starting a
+    // run and waiting for it costs a wakeup per thread instead of a thread creation.
+    class Worker_team:
+        public No_copy_or_move
+    {
+        using Work = function<void( int i_worker )>;
+
+        mutex               m_mutex;
+        condition_variable  m_work_available;
+        condition_variable  m_work_done;
+        const Work*         m_work          = nullptr;
+        int                 m_i_run         = 0;
+        int                 m_n_running     = 0;
+        bool                m_is_stopping   = false;
+        exception_ptr       m_exception;
+        vector<thread>      m_threads;
+
+        void do_work( in_<Work> work, const int i_worker ) noexcept
+        {
+            try {
+                work( i_worker );
+            } catch( ... ) {
+                const unique_lock<mutex> lock( m_mutex );
+                if( not m_exception ) { m_exception = current_exception(); }
+            }
+        }
+
+        void serve( const int i_worker )
+        {
+            int i_last_run = 0;
+            for( ;; ) {
+                unique_lock<mutex> lock( m_mutex );
+                m_work_available.wait( lock, [&]{ return m_is_stopping or m_i_run != i_last_run; } );
+                if( m_is_stopping ) { return; }
+                i_last_run = m_i_run;
+                const Work& work = *m_work;
+                lock.unlock();
+
+                do_work( work, i_worker );
+
+                lock.lock();
+                if( --m_n_running == 0 ) { m_work_done.notify_one(); }
+            }
+        }
+
+    public:
+        ~Worker_team()
+        {
+            {
+                const unique_lock<mutex> lock( m_mutex );
+                m_is_stopping = true;
+            }
+            m_work_available.notify_all();
+            for( thread& t: m_threads ) { t.join(); }
+        }
+
+        explicit Worker_team( const int n_workers )
+        {
+            for( int i = 1; i < n_workers; ++i ) { m_threads.emplace_back( [this, i]{ serve( i ); } ); }
+        }
+
+        auto size() const noexcept -> int { return int( m_threads.size() ) + 1; }
+
+        // Calls `work( i )` for each worker number `i` and returns when all calls have returned.
+        // The first exception, if any, is rethrown.
+        void run( in_<Work> work )
+        {
+            {
+                const unique_lock<mutex> lock( m_mutex );
+                m_work = &work;
+                m_n_running = int( m_threads.size() );
+                ++m_i_run;
+            }
+            m_work_available.notify_all();
+            do_work( work, 0 );
+
+            unique_lock<mutex> lock( m_mutex );
+            m_work_done.wait( lock, [&]{ return m_n_running == 0; } );
+            m_work = nullptr;
+            if( m_exception ) { rethrow_exception( exchange( m_exception, nullptr ) ); }
+        }
+    };
+}  // namespace app
@@ -0,0 +1 @@
+#include <cppm.cpp-include>
@@ -0,0 +1,262 @@
+// Displays Pascal's triangle with odd numbers in yellow and even numbers in blue, as
+// "code/pascal-triangle.colored.cpp" but for any number of rows, as a load test of rendering:
+//
+//     pascal_triangle [ROWS] [--compact] [--plain] [--threads N]
+//
+// `--compact` separates the numbers by a space instead of centering them in fields as wide as
+// the widest number, and `--plain` omits the colors. The rows/s and bytes/s are reported to
+// `stderr` at the end, so redirect the triangle to e.g. "/dev/null" to measure without a console.
+//
+// The numbers are `Big_natural`s. Only the left half of each row is computed, since the row is
+// symmetric, and for big rows it's split in chunks that the threads compute and format in
+// parallel into their own `Styled_writer`s. Only the previous and the current row are kept: each
+// row is written to `Console_usage::out()` as soon as it's formatted, directly from the chunks.
+#include "Big_natural.hpp"
+#include "Worker_team.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint32_t
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace app {
+    namespace chrono = std::chrono;
+    using namespace cppm::now_and_fail;
+    using   cppm::Ansi_color, cppm::Console_sink, cppm::Console_usage, cppm::Styled_writer,
+            cppm::Text_style, cppm::fg;
+    using   fmt::print;                         // <fmt/core.h>
+    using   std::max, std::min,                 // <algorithm>
+            std::atomic,                        // <atomic>
+            std::errc, std::from_chars,         // <charconv>
+            std::string,                        // <string>
+            std::string_view,                   // <string_view>
+            std::thread,                        // <thread>
+            std::swap,                          // <utility>
+            std::vector;                        // <vector>
+
+    struct Options
+    {
+        int     n_rows;
+        bool    is_compact;
+        bool    is_colored;
+        int     n_threads;
+    };
+
+    constexpr auto usage = string_view( "Usage: pascal_triangle [ROWS] [--compact] [--plain] [--threads N]" );
+
+    auto int_from( in_<string> arg )
+        -> int
+    {
+        int result = 0;
+        const char* const end = arg.data() + arg.size();
+        const auto parsing = from_chars( arg.data(), end, result );
+        now( parsing.ec == errc() and parsing.ptr == end )
+            or fail( "“{}” is not a number that fits in an `int`.\n{}", arg, usage );
+        return result;
+    }
+
+    auto options_from( in_<vector<string>> args )
+        -> Options
+    {
+        Options result = {16, false, true, int( max( 1u, thread::hardware_concurrency() ) )};
+        vector<string> positional;
+        for( size_t i = 0; i < args.size(); ++i ) {
+            const string& arg = args[i];
+            if( arg == "--compact" ) {
+                result.is_compact = true;
+            } else if( arg == "--plain" ) {
+                result.is_colored = false;
+            } else if( arg == "--threads" ) {
+                now( i + 1 < args.size() ) or fail( "Missing number after “--threads”." );
+                result.n_threads = int_from( args[++i] );
+                now( result.n_threads >= 1 ) or fail( "The number of threads must be at least 1." );
+            } else {
+                positional.push_back( arg );
+            }
+        }
+        now( positional.size() <= 1 ) or fail( "{}", usage );
+        if( positional.size() == 1 ) {
+            result.n_rows = int_from( positional[0] );
+            now( result.n_rows >= 1 ) or fail( "The number of rows must be at least 1." );
+        }
+        return result;
+    }
+
+    // Rows with less work than this, in limbs, are computed and formatted by the calling thread
+    // alone, since then waking the other threads costs more than it saves.
+    const size_t min_limbs_for_parallel_row = 4*1024;
+
+    // A part of the left half of a row. Its numbers are formatted into `left`, and their mirror
+    // images in the right half, which are in reverse order, into `right`.
+    struct Chunk
+    {
+        int             i_first;
+        int             i_beyond;
+        Styled_writer   left;
+        Styled_writer   right;
+        string          digits;
+    };
+
+    class Triangle_writer
+    {
+        const Options       m_options;
+        int                 m_field_size;           // 0 for compact.
+        string              m_spaces;
+        vector<Big_natural> m_previous;             // Left halves of rows.
+        vector<Big_natural> m_current;
+        vector<Chunk>       m_chunks;
+        Worker_team         m_team;
+        Console_sink&       m_out;
+        size_t              m_n_bytes_written   = 0;
+
+        auto style_for( in_<Big_natural> v ) const
+            -> Text_style
+        {
+            if( not m_options.is_colored ) { return Text_style(); }
+            return fg( v.is_odd()? Ansi_color::yellow : Ansi_color::blue );
+        }
+
+        void write_field( Styled_writer& out, in_<Big_natural> v, string& digits ) const
+        {
+            digits.clear();
+            v.append_digits_to( digits );
+            const int n_padding = max( 1, m_field_size - int( digits.size() ) );
+            const int n_before = (m_field_size == 0? 0 : n_padding/2);     // As fmt `^` centering.
+            out.set_style( style_for( v ) );
+            out.write( string_view( m_spaces ).substr( 0, size_t( n_before ) ) );
+            out.write( digits );
+            out.write( string_view( m_spaces ).substr( 0, size_t( n_padding - n_before ) ) );
+        }
+
+        void write_spaces( size_t n )
+        {
+            while( n > 0 ) {
+                const size_t n_part = min( n, m_spaces.size() );
+                m_out.write( string_view( m_spaces ).substr( 0, n_part ) );
+                n -= n_part;
+            }
+        }
+
+        // Computes the numbers of the chunk in row `y` from the previous row, and formats them.
+        void compute_and_format( Chunk& chunk, const int y )
+        {
+            const int i_last_of_previous = y - 1;
+            const auto previous_at = [&]( const int i ) -> const Big_natural& {
+                return m_previous[size_t( min( i, i_last_of_previous - i ) )];      // Mirrored.
+                };
+            for( int x = max( 1, chunk.i_first ); x < chunk.i_beyond; ++x ) {
+                m_current[size_t( x )].assign_sum( previous_at( x - 1 ), previous_at( x ) );
+            }
+
+            chunk.left.clear();  chunk.right.clear();
+            for( int x = chunk.i_first; x < chunk.i_beyond; ++x ) {
+                write_field( chunk.left, m_current[size_t( x )], chunk.digits );
+            }
+            chunk.left.reset_style();
+            const int n_right = (y + 1)/2;      // The middle number of an even row isn't repeated.
+            for( int x = min( chunk.i_beyond, n_right ) - 1; x >= chunk.i_first; --x ) {
+                write_field( chunk.right, m_current[size_t( x )], chunk.digits );
+            }
+            chunk.right.reset_style();
+        }
+
+        void write( in_<Styled_writer> text )
+        {
+            m_out.write( text.text() );
+            m_n_bytes_written += text.text().size();
+        }
+
+    public:
+        Triangle_writer( in_<Options> options, Console_sink& out ):
+            m_options( options ),
+            m_field_size( 0 ),
+            m_spaces(),
+            m_previous(),
+            m_current(),
+            m_chunks( size_t( 4*options.n_threads ) ),
+            m_team( options.n_threads ),
+            m_out( out )
+        {
+            const uint32_t n = uint32_t( options.n_rows );
+            if( not options.is_compact ) {
+                m_field_size = binomial( n - 1, (n - 1)/2 ).n_digits() + 1;
+            }
+            m_spaces.assign( size_t( max( m_field_size, 64 ) ), ' ' );
+            m_previous.reserve( n/2 + 1 );
+            m_current.reserve( n/2 + 1 );
+        }
+
+        auto n_bytes_written() const noexcept -> size_t { return m_n_bytes_written; }
+
+        void write_row( const int y )
+        {
+            const size_t n_half = size_t( y/2 + 1 );
+            if( m_current.size() < n_half ) { m_current.resize( n_half, 1 ); }
+
+            const size_t n_limbs = (y == 0? 1 : n_half*m_previous[size_t( (y - 1)/2 )].n_limbs());
+            const bool is_parallel = (m_team.size() > 1 and n_limbs >= min_limbs_for_parallel_row);
+            const int n_chunks = (is_parallel? int( min( n_half, m_chunks.size() ) ) : 1);
+            for( int i = 0; i < n_chunks; ++i ) {
+                m_chunks[size_t( i )].i_first = int( i*n_half/size_t( n_chunks ) );
+                m_chunks[size_t( i )].i_beyond = int( (i + 1)*n_half/size_t( n_chunks ) );
+            }
+
+            if( is_parallel ) {
+                atomic<int> i_next_chunk = 0;       // The middle chunks have bigger numbers.
+                m_team.run( [&]( int ) {
+                    for( int i; (i = i_next_chunk++) < n_chunks; ) { compute_and_format( m_chunks[size_t( i )], y ); }
+                    } );
+            } else {
+                compute_and_format( m_chunks[0], y );
+            }
+
+            // In `size_t` since the product exceeds `INT_MAX` already for 100 000 rows, of 30 000 digit numbers.
+            const size_t indent = (m_options.is_compact? 0
+                : size_t( m_options.n_rows - y - 1 )*size_t( m_field_size )/2
+                );
+            write_spaces( indent );
+            for( int i = 0; i < n_chunks; ++i ) { write( m_chunks[size_t( i )].left ); }
+            for( int i = n_chunks - 1; i >= 0; --i ) { write( m_chunks[size_t( i )].right ); }
+            m_out.write( "\n" );
+            m_n_bytes_written += indent + 1;
+
+            swap( m_current, m_previous );
+        }
+
+        void flush() { m_out.flush(); }
+    };
+
+    void run( in_<vector<string>> args )
+    {
+        const Options options = options_from( args );
+        Console_usage console_usage;
+        const auto start_time = chrono::steady_clock::now();
+
+        Triangle_writer triangle( options, console_usage.out() );
+        for( int y = 0; y < options.n_rows; ++y ) { triangle.write_row( y ); }
+        triangle.flush();
+
+        const double seconds = max( 1e-9, chrono::duration<double>( chrono::steady_clock::now() - start_time ).count() );
+        const size_t n_bytes = triangle.n_bytes_written();
+        print( stderr, "{} rows, {:.1f} MB, in {:.2f} seconds: {:.0f} rows/s, {:.1f} MB/s, {} thread(s).\n",
+            options.n_rows, n_bytes/1e6, seconds, options.n_rows/seconds, n_bytes/1e6/seconds, options.n_threads
+            );
+    }
+}  // namespace app
+
+auto main( int n_args, char** args ) -> int
+{
+    const auto arguments = std::vector<std::string>( args + 1, args + n_args );
+    return cppm::with_exceptions_displayed( [&]{ app::run( arguments ); } );
+}
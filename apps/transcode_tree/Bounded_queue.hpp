@@ -0,0 +1,66 @@
+#pragma once
+#include <stddef.h>         // size_t
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace app {
+    using   std::condition_variable,        // <condition_variable>
+            std::deque,                     // <deque>
+            std::mutex, std::unique_lock,   // <mutex>
+            std::optional, std::nullopt,    // <optional>
+            std::move;                      // <utility>
+
+    // A queue between pipeline stages. `push` blocks while the queue is full, which limits the
+    // work in flight, and `pop` blocks while it's empty and not closed.
+    template< class Item >
+    class Bounded_queue
+    {
+        mutex               m_mutex;
+        condition_variable  m_not_full;
+        condition_variable  m_not_empty;
+        deque<Item>         m_items;
+        size_t              m_capacity;
+        bool                m_is_closed;
+
+    public:
+        explicit Bounded_queue( const size_t capacity ):
+            m_capacity( capacity ), m_is_closed( false )
+        {}
+
+        void push( Item item )
+        {
+            unique_lock<mutex> lock( m_mutex );
+            m_not_full.wait( lock, [&]{ return m_items.size() < m_capacity; } );
+            m_items.push_back( move( item ) );
+            lock.unlock();
+            m_not_empty.notify_one();
+        }
+
+        // Returns `nullopt` when the queue is closed and empty.
+        auto pop()
+            -> optional<Item>
+        {
+            unique_lock<mutex> lock( m_mutex );
+            m_not_empty.wait( lock, [&]{ return not m_items.empty() or m_is_closed; } );
+            if( m_items.empty() ) { return nullopt; }
+            optional<Item> result( move( m_items.front() ) );
+            m_items.pop_front();
+            lock.unlock();
+            m_not_full.notify_one();
+            return result;
+        }
+
+        // Ends the waiting of consumers when the queue is empty.
+        void close()
+        {
+            unique_lock<mutex> lock( m_mutex );
+            m_is_closed = true;
+            lock.unlock();
+            m_not_empty.notify_all();
+        }
+    };
+}  // namespace app
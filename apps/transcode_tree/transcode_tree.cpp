@@ -0,0 +1,300 @@
+// Converts a directory tree of text files to UTF-8, e.g. an archive of legacy encoded files:
+//
+//     transcode_tree SOURCE-DIR TARGET-DIR [--from CODEPAGE] [--threads N]
+//
+// The encoding of each file is detected. Legacy files are decoded as the codepage, by default
+// windows-1252; UTF-16 and UTF-32 files are decoded per their BOM or zero bytes; files that are
+// already ASCII or UTF-8, as checked for every byte, are copied by the OS without passing through
+// this process; and binary files are skipped. Output is written to preallocated memory
+// mappings, without buffers.
+//
+// The work is a pipeline: this thread walks the tree, reader threads map and detect each file,
+// and writer threads transcode and write it, with bounded queues between the stages.
+#include "Bounded_queue.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint32_t
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace app {
+    namespace chrono = std::chrono;
+    namespace cp = cppm::codepages;
+    namespace fs = std::filesystem;
+    namespace u8 = cppm::utf8;
+    using namespace cppm::now_and_fail;
+    using   cppm::Byte, cppm::in_, cppm::Mapped_file, cppm::Mapped_output_file, cppm::Path,
+            cppm::Scope_guard, cppm::Span, cppm::to_u8_string;
+    using   u8::Encoding_detection, u8::Text_encoding, u8::Transcoding_result, u8::Transcoding_status;
+    using   fmt::print;                         // <fmt/core.h>
+    using   std::max,                           // <algorithm>
+            std::atomic,                        // <atomic>
+            std::map,                           // <map>
+            std::lock_guard, std::mutex,        // <mutex>
+            std::optional,                      // <optional>
+            std::string,                        // <string>
+            std::string_view, std::u16string_view, std::u32string_view,     // <string_view>
+            std::thread,                        // <thread>
+            std::vector;                        // <vector>
+
+    struct Options
+    {
+        fs::path            source;
+        fs::path            target;
+        const cp::Codepage* codepage;
+        int                 n_threads;
+    };
+
+    auto options_from( in_<vector<string>> args )
+        -> Options
+    {
+        Options result = {{}, {}, &cp::codepage_named( "windows-1252" ), int( max( 2u, thread::hardware_concurrency() ) )};
+        vector<string> positional;
+        for( size_t i = 0; i < args.size(); ++i ) {
+            const string& arg = args[i];
+            const bool has_value = (i + 1 < args.size());
+            if( arg == "--from" ) {
+                now( has_value ) or fail( "Missing codepage name after “--from”." );
+                result.codepage = &cp::codepage_named( args[++i] );
+            } else if( arg == "--threads" ) {
+                now( has_value ) or fail( "Missing number after “--threads”." );
+                result.n_threads = std::stoi( args[++i] );
+                now( result.n_threads >= 1 ) or fail( "The number of threads must be at least 1." );
+            } else {
+                positional.push_back( arg );
+            }
+        }
+        now( positional.size() == 2 )
+            or fail( "Usage: transcode_tree SOURCE-DIR TARGET-DIR [--from CODEPAGE] [--threads N]" );
+        result.source = Path( positional[0] ).fs_path();
+        result.target = Path( positional[1] ).fs_path();
+        now( fs::is_directory( result.source ) )
+            or fail( "“{}” is not a directory.", positional[0] );
+        return result;
+    }
+
+    struct Job
+    {
+        fs::path                source;
+        fs::path                target;
+        optional<Mapped_file>   file;
+        Encoding_detection      detection;
+    };
+
+    class Statistics
+    {
+        mutable mutex                   m_mutex;
+        map<Text_encoding::Enum, int>   m_n_files;
+        size_t                          m_n_bytes_read      = 0;
+        size_t                          m_n_bytes_written   = 0;
+        vector<string>                  m_errors;
+
+    public:
+        void add( const Text_encoding::Enum encoding, const size_t n_read, const size_t n_written )
+        {
+            const lock_guard<mutex> lock( m_mutex );
+            ++m_n_files[encoding];
+            m_n_bytes_read += n_read;  m_n_bytes_written += n_written;
+        }
+
+        void add_error( in_<fs::path> source, in_<string_view> message )
+        {
+            const lock_guard<mutex> lock( m_mutex );
+            m_errors.push_back( fmt::format( "“{}”: {}", to_u8_string( source ), message ) );
+        }
+
+        auto n_errors() const -> size_t { const lock_guard<mutex> lock( m_mutex ); return m_errors.size(); }
+
+        void display( const double seconds ) const
+        {
+            const lock_guard<mutex> lock( m_mutex );
+            for( const auto& [encoding, n]: m_n_files ) {
+                print( "{:>8} {} file(s){}\n", n, u8::name_of( encoding ),
+                    (encoding == Text_encoding::binary? ", skipped" : "")
+                    );
+            }
+            for( const string& error: m_errors ) { print( stderr, "!{}\n", error ); }
+            print( "{:>8} error(s).\n", m_errors.size() );
+            print( "{:.1f} MB read and {:.1f} MB written in {:.2f} seconds, {:.0f} MB/s.\n",
+                m_n_bytes_read/1e6, m_n_bytes_written/1e6, seconds, m_n_bytes_read/1e6/max( seconds, 1e-9 )
+                );
+        }
+    };
+
+    auto text_of( in_<Span<const Byte>> bytes ) -> string_view { return {reinterpret_cast<const char*>( bytes.data() ), bytes.size()}; }
+
+    // `transcode( buffer )` converts into a `Span<char>` of `capacity` bytes. Returns the output size.
+    template< class Transcode_func >
+    auto write_transcoded( in_<fs::path> target, const size_t capacity, const size_t unit_size, const Transcode_func& transcode )
+        -> size_t
+    {
+        auto output = Mapped_output_file( Path::from_fs_path( target ), capacity );
+        const Span<Byte> bytes = output.bytes();
+        const Transcoding_result result = transcode( Span<char>( reinterpret_cast<char*>( bytes.data() ), bytes.size() ) );
+        now( result.status == Transcoding_status::ok )
+            or fail( "Invalid input at byte offset {}.", unit_size*result.n_read );
+        output.close( result.n_written );
+        return result.n_written;
+    }
+
+    // The units must be in the byte order of this machine, which is assumed to be little-endian.
+    template< class Unit >
+    auto units_from( in_<Span<const Byte>> bytes, const bool is_byte_swapped, vector<Unit>& buffer )
+        -> std::basic_string_view<Unit>
+    {
+        now( bytes.size() % sizeof( Unit ) == 0 )
+            or fail( "The size isn't a multiple of the {}-byte code unit size.", sizeof( Unit ) );
+        const size_t n_units = bytes.size()/sizeof( Unit );
+        if( not is_byte_swapped ) {     // A mapping is page aligned, and a BOM keeps the alignment.
+            return {reinterpret_cast<const Unit*>( bytes.data() ), n_units};
+        }
+        buffer.resize( n_units );
+        for( size_t i = 0; i < n_units; ++i ) {
+            uint32_t value = 0;
+            for( size_t j = 0; j < sizeof( Unit ); ++j ) { value = (value << 8) | bytes[sizeof( Unit )*i + j]; }
+            buffer[i] = Unit( value );
+        }
+        return {buffer.data(), n_units};
+    }
+
+    // Returns the number of bytes written.
+    auto converted( in_<Job> job, in_<cp::Codepage> codepage )
+        -> size_t
+    {
+        using E = Text_encoding;
+        const auto encoding = job.detection.encoding;
+        const Span<const Byte> all_bytes = job.file->bytes();
+        const Span<const Byte> bytes = all_bytes.subspan( size_t( job.detection.bom_length ) );
+
+        if( encoding == E::ascii or encoding == E::utf8 ) {
+            if( job.detection.bom_length == 0 ) {       // Copied by the OS, e.g. with `copy_file_range`.
+                fs::copy_file( job.source, job.target, fs::copy_options::overwrite_existing );
+                return all_bytes.size();
+            }
+            return write_transcoded( job.target, bytes.size(), 1, [&]( in_<Span<char>> buffer ) -> Transcoding_result {
+                std::copy( bytes.begin(), bytes.end(), buffer.data() );
+                return {Transcoding_status::ok, bytes.size(), bytes.size()};
+                } );
+        } else if( encoding == E::utf16le or encoding == E::utf16be ) {
+            vector<char16_t> buffer;
+            const u16string_view units = units_from( bytes, encoding == E::utf16be, buffer );
+            return write_transcoded( job.target, u8::max_utf8_length_for_utf16( units.size() ), 2,
+                [&]( in_<Span<char>> out ) { return u8::to_utf8( units, out ); }
+                );
+        } else if( encoding == E::utf32le or encoding == E::utf32be ) {
+            vector<char32_t> buffer;
+            const u32string_view units = units_from( bytes, encoding == E::utf32be, buffer );
+            return write_transcoded( job.target, u8::max_utf8_length_for_utf32( units.size() ), 4,
+                [&]( in_<Span<char>> out ) { return u8::from_utf32( units, out ); }
+                );
+        } else if( encoding == E::legacy ) {
+            const string_view text = text_of( bytes );
+            return write_transcoded( job.target, cp::max_utf8_length_for_codepage_text( text.size() ), 1,
+                [&]( in_<Span<char>> out ) { return cp::to_utf8( codepage, text, out ); }
+                );
+        }
+        return 0;       // Binary data is skipped.
+    }
+
+    // The copy of ASCII and UTF-8 files trusts the encoding, so it's checked for all the bytes.
+    // Without a BOM the full detection has already done that.
+    auto is_valid_as_detected( in_<Job> job )
+        -> bool
+    {
+        using E = Text_encoding;
+        const Encoding_detection& detection = job.detection;
+        if( detection.encoding != E::ascii and detection.encoding != E::utf8 ) { return true; }
+        if( detection.bom_length == 0 and not detection.is_sampled ) { return true; }
+        const Span<const Byte> bytes = job.file->bytes().subspan( size_t( detection.bom_length ) );
+        return u8::is_valid( text_of( bytes ) );
+    }
+
+    void read_and_detect( Bounded_queue<Job>& to_read, Bounded_queue<Job>& to_write, Statistics& statistics )
+    {
+        while( optional<Job> job = to_read.pop() ) {
+            try {
+                job->file.emplace( Path::from_fs_path( job->source ) );
+                job->detection = u8::detect_encoding( job->file->bytes() );
+                if( not is_valid_as_detected( *job ) ) {    // Then it's decoded, without any BOM.
+                    job->detection = {Text_encoding::legacy, job->detection.bom_length, false};
+                }
+                to_write.push( move( *job ) );
+            } catch( in_<std::exception> x ) {
+                statistics.add_error( job->source, x.what() );
+            }
+        }
+    }
+
+    void transcode_and_write( Bounded_queue<Job>& to_write, in_<cp::Codepage> codepage, Statistics& statistics )
+    {
+        while( optional<Job> job = to_write.pop() ) {
+            try {
+                const size_t n_written = converted( *job, codepage );
+                statistics.add( job->detection.encoding, job->file->size(), n_written );
+            } catch( in_<std::exception> x ) {
+                statistics.add_error( job->source, x.what() );
+            }
+        }
+    }
+
+    void run( in_<vector<string>> args )
+    {
+        const Options options = options_from( args );
+        const auto start_time = chrono::steady_clock::now();
+
+        // The queues hold open mappings, but a mapping costs only address space until it's read.
+        const size_t n_workers = size_t( options.n_threads );
+        Bounded_queue<Job> to_read( 4*n_workers );
+        Bounded_queue<Job> to_write( 4*n_workers );
+        Statistics statistics;
+
+        atomic<size_t> n_active_readers = n_workers;
+        vector<thread> threads;
+        {
+            const Scope_guard joining( [&]{
+                to_read.close();
+                for( thread& t: threads ) { t.join(); }
+                } );
+            for( size_t i = 0; i < n_workers; ++i ) {
+                threads.emplace_back( [&]{
+                    read_and_detect( to_read, to_write, statistics );
+                    if( --n_active_readers == 0 ) { to_write.close(); }
+                    } );
+                threads.emplace_back( [&]{ transcode_and_write( to_write, *options.codepage, statistics ); } );
+            }
+
+            for( const fs::directory_entry& entry: fs::recursive_directory_iterator( options.source ) ) {
+                const fs::path target = options.target / entry.path().lexically_relative( options.source );
+                if( entry.is_directory() ) {
+                    fs::create_directories( target );
+                } else if( entry.is_regular_file() ) {
+                    fs::create_directories( target.parent_path() );
+                    to_read.push( Job{entry.path(), target, {}, {}} );
+                }
+            }
+        }
+
+        const double seconds = chrono::duration<double>( chrono::steady_clock::now() - start_time ).count();
+        statistics.display( seconds );
+        now( statistics.n_errors() == 0 ) or fail( "Some files were not converted." );
+    }
+}  // namespace app
+
+auto main( int n_args, char** args ) -> int
+{
+    const auto arguments = std::vector<std::string>( args + 1, args + n_args );
+    return cppm::with_exceptions_displayed( [&]{ app::run( arguments ); } );
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include <cppm/basics/type_makers.hpp>      // in_
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint64_t
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace bench {
+    using   cppm::in_;
+    using   std::max, std::min,                 // <algorithm>
+            std::string,                        // <string>
+            std::string_view;                   // <string_view>
+    namespace chrono = std::chrono;
+
+    // Results are stored here so that the compiler can't optimize away the measured work.
+    inline volatile size_t sink;
+
+    // Best time of `n_runs` calls of `f`, in seconds.
+    template< class Func >
+    auto best_seconds( const int n_runs, in_<Func> f )
+        -> double
+    {
+        double best = 1e99;
+        for( int i = 0; i < n_runs; ++i ) {
+            const auto start = chrono::steady_clock::now();
+            f();
+            const auto stop = chrono::steady_clock::now();
+            best = min( best, chrono::duration<double>( stop - start ).count() );
+        }
+        return best;
+    }
+
+    inline auto mb_per_second( const size_t n_bytes, const double seconds )
+        -> double
+    { return n_bytes/seconds/1e6; }
+
+    struct Corpus{ string_view name; string_view sample; };
+
+    constexpr Corpus corpora[] =
+    {
+        { "ASCII",      "The quick brown fox jumps over the lazy dog, again and again. " },
+        { "Latin",      "Blåbærsyltetøy på skiva, sa den ærlige gutten på Ørsta. " },
+        { "Cyrillic",   "Кошка сидит на окне и смотрит на улицу, где идёт дождь. " },
+        { "CJK",        "日本国の猫は窓辺に座って、雨の降る通りを眺めています。" },
+    };
+
+    inline auto repeated_to_size( in_<string_view> sample, const size_t n_bytes )
+        -> string
+    {
+        string result;
+        result.reserve( n_bytes + sample.size() );
+        while( result.size() < n_bytes ) { result += sample; }
+        return result;
+    }
+
+    // SplitMix64, so that generated data is the same for a given seed on every platform, which
+    // isn't guaranteed by the `<random>` distributions.
+    class Random_bits
+    {
+        uint64_t    m_state;
+
+    public:
+        explicit Random_bits( const uint64_t seed ): m_state( seed ) {}
+
+        auto operator()()
+            -> uint64_t
+        {
+            uint64_t z = (m_state += 0x9E37'79B9'7F4A'7C15);
+            z = (z ^ (z >> 30))*0xBF58'476D'1CE4'E5B9;
+            z = (z ^ (z >> 27))*0x94D0'49BB'1331'11EB;
+            return z ^ (z >> 31);
+        }
+
+        auto below( const size_t n ) -> size_t { return size_t( (*this)() % n ); }
+    };
+
+    struct Language{ enum Enum{ ascii, norwegian, cyrillic, cjk, emoji, _ }; };
+
+    struct Vocabulary{ string_view name; string_view words[16]; string_view separator; };
+
+    // Norwegian is mostly ASCII with Latin-1 letters in 2-byte sequences, Cyrillic is mostly
+    // 2-byte sequences, CJK mostly 3-byte ones without spaces, and the emoji include 4-byte
+    // sequences with skin tone modifiers, ZWJ sequences and flags.
+    constexpr Vocabulary vocabularies[] =
+    {
+        { "ASCII", {
+            "the", "quick", "brown", "fox", "jumps", "over", "a", "lazy", "dog", "and", "reads",
+            "2024", "reports", "with", "numbers", "again"
+            }, " " },
+        { "Norwegian", {
+            "blåbærsyltetøy", "på", "skiva", "sa", "den", "ærlige", "gutten", "fra", "Ørsta",
+            "og", "søsteren", "i", "Tromsø", "spiste", "grøt", "med smør"
+            }, " " },
+        { "Cyrillic", {
+            "кошка", "сидит", "на", "окне", "и", "смотрит", "улицу", "где", "идёт", "дождь",
+            "съешь", "ещё", "этих", "мягких", "французских", "булок"
+            }, " " },
+        { "CJK", {
+            "日本国", "の", "猫", "は", "窓辺", "に", "座って", "雨", "降る", "通り", "を",
+            "眺めています", "東京", "中文", "한국어", "、"
+            }, "" },
+        { "Emoji", {
+            "😀", "👍🏽", "👩‍👩‍👧", "🇳🇴", "❤️", "🎉", "🐱", "🍣", "🚀", "☕", "great", "job",
+            "team", "🧑🏿‍💻", "ok", "🙂"
+            }, " " },
+    };
+    static_assert( std::size( vocabularies ) == Language::_ );
+
+    // Valid UTF-8 text of at most `n_bytes` bytes, as lines of random words from the vocabulary.
+    inline auto generated_text( const Language::Enum language, const size_t n_bytes, const uint64_t seed = 42 )
+        -> string
+    {
+        const Vocabulary& vocabulary = vocabularies[language];
+        Random_bits bits( seed );
+        string result;
+        result.reserve( n_bytes );
+        for( int i_word = 0; ; ++i_word ) {
+            const bool is_line_end = (i_word % 12 == 11);
+            const string_view word = vocabulary.words[bits.below( std::size( vocabulary.words ) )];
+            const string_view separator = (is_line_end? "\n" : vocabulary.separator);
+            if( result.size() + word.size() + separator.size() > n_bytes ) { break; }
+            result += word;
+            result += separator;
+        }
+        return result;
+    }
+}  // namespace bench
@@ -0,0 +1,150 @@
+// `cppm::utf8::equal_ci` with each SIMD level, of text versus a copy with the ASCII letters in
+// uppercase; versus case folding both to strings and comparing them. Then `hash_ci`, and lookups
+// of file names with different case in an `unordered_set` with `Hash_ci` and `Equal_ci`. First
+// some full foldings per CaseFolding.txt are checked, and the comparisons with each SIMD level.
+// Build e.g. with `../build-scripts/unix/bash/build case-insensitive.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Simd_level, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string,                // <string>
+            std::string_view,           // <string_view>
+            std::unordered_set,         // <unordered_set>
+            std::vector;                // <vector>
+    namespace u8 = cppm::utf8;
+
+    auto with_ascii_uppercase( string s )
+        -> string
+    {
+        for( char& ch: s ) { if( 'a' <= ch and ch <= 'z' ) { ch -= 'a' - 'A'; } }
+        return s;
+    }
+
+    auto equal_ci_mb_per_second( const Simd_level::Enum level, in_<string> a, in_<string> b )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{ sink = u8::equal_ci_using( level, a, b ); } );
+        return mb_per_second( a.size(), seconds );
+    }
+
+    auto folding_mb_per_second( in_<string> a, in_<string> b )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{
+            sink = (u8::to_case_folded( a ) == u8::to_case_folded( b ));
+            } );
+        return mb_per_second( a.size(), seconds );
+    }
+
+    auto hash_mb_per_second( in_<string> s )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{ sink = u8::hash_ci( s ); } );
+        return mb_per_second( s.size(), seconds );
+    }
+
+    void run_lookups()
+    {
+        const int n_names = 20'000;
+        const string_view stems[] = { "Rapport", "blåbærsyltetøy", "Straße", "Документ", "文書", "README" };
+        vector<string> names;
+        for( int i = 0; i < n_names; ++i ) {
+            names.push_back( fmt::format( "C:/Users/Æsir/{}-{}.TXT", stems[i % size( stems )], i ) );
+        }
+        vector<string> keys;
+        for( const string& name: names ) { keys.push_back( u8::to_case_folded( name ) ); }
+
+        const unordered_set<string, u8::Hash_ci, u8::Equal_ci> set( names.begin(), names.end() );
+        const double seconds = best_seconds( 10, [&]{
+            size_t n_found = 0;
+            for( const string& key: keys ) { n_found += set.count( key ); }
+            sink = n_found;
+            } );
+        print( "{:.0f} ns per lookup of a name with different case, {} names.\n",
+            1e9*seconds/n_names, n_names
+            );
+    }
+
+    struct Folding_case{ string_view text; string_view folded; };
+
+    // Simple (C) and full (F) foldings, among them expansions, from CaseFolding.txt.
+    constexpr Folding_case folding_cases[] =
+    {
+        { "Straße",                 "strasse" },
+        { "\u1E9E",                 "ss" },                     // Capital sharp s.
+        { "\uFB01",                 "fi" },                     // Ligatures.
+        { "\uFB03",                 "ffi" },
+        { "\u0149",                 "\u02BCn" },
+        { "\u01F0",                 "j\u030C" },
+        { "\u0390",                 "\u03B9\u0308\u0301" },
+        { "\u0130",                 "i\u0307" },                // Not the Turkic folding.
+        { "\u1FBC",                 "\u03B1\u03B9" },           // Prosgegrammeni.
+        { "ΣΑΣ ς",                  "σασ σ" },
+        { "\u00B5",                 "\u03BC" },                 // Micro sign to Greek mu.
+        { "\u212A",                 "k" },                      // Kelvin sign.
+        { "\u2126",                 "\u03C9" },                 // Ohm sign.
+        { "\u017F",                 "s" },                      // Long s.
+        { "\u01C5",                 "\u01C6" },                 // Titlecase dz with caron.
+        { "\uAB70",                 "\u13A0" },                 // Cherokee folds to uppercase.
+        { "\U00010400",             "\U00010428" },             // Deseret, 4-byte sequences.
+        { "Æblegrød",               "æblegrød" },
+    };
+
+    void check_folding()
+    {
+        const string prefix = "File name with SIMD sized ASCII prefix/";
+        const string upper_prefix = with_ascii_uppercase( prefix );
+        for( const Folding_case& c: folding_cases ) {
+            const string folded = u8::to_case_folded( c.text );
+            now( folded == c.folded ) or fail( "“{}” folded to “{}” instead of “{}”.", c.text, folded, c.folded );
+            now( u8::compare_ci( c.text, c.folded ) == 0 and u8::hash_ci( c.text ) == u8::hash_ci( c.folded ) )
+                or fail( "compare_ci or hash_ci differ for “{}” and “{}”.", c.text, c.folded );
+            for( const auto level: {Simd_level::avx2, Simd_level::sse4_2, Simd_level::none} ) {
+                const string a = upper_prefix + string( c.text );
+                const string b = prefix + string( c.folded );
+                now( u8::equal_ci_using( level, a, b ) and u8::equal_ci_using( level, b + "x", a + "X" ) )
+                    or fail( "equal_ci_using level {} is false for “{}” and “{}”.", +level, a, b );
+                now( not u8::equal_ci_using( level, a + "a", b + "b" ) and not u8::equal_ci_using( level, a, b + "s" ) )
+                    or fail( "equal_ci_using level {} is true for different texts after “{}”.", +level, a );
+            }
+        }
+        now( not u8::equal_ci( "ß", "s" ) and not u8::equal_ci( "I", "ı" ) )
+            or fail( "equal_ci of a partial or Turkic folding." );
+        now( u8::compare_ci( "a", "B" ) < 0 and u8::compare_ci( "Straße", "STRASSF" ) < 0 )
+            or fail( "compare_ci gave the wrong order." );
+    }
+
+    void run()
+    {
+        check_folding();
+        const size_t n_bytes = 4'000'000;
+
+        print( "MB/s of caseless comparison and hashing:\n" );
+        print( "{:<10} {:>10}{:>10}{:>10}{:>10}{:>10}\n", "", "avx2", "sse4.2", "scalar", "folding", "hash" );
+        for( const auto& corpus: bench::corpora ) {
+            const string text = repeated_to_size( corpus.sample, n_bytes );
+            const string uppercase = with_ascii_uppercase( text );
+            print( "{:<10} {:>10.0f}{:>10.0f}{:>10.0f}{:>10.0f}{:>10.0f}\n", corpus.name,
+                equal_ci_mb_per_second( Simd_level::avx2, text, uppercase ),
+                equal_ci_mb_per_second( Simd_level::sse4_2, text, uppercase ),
+                equal_ci_mb_per_second( Simd_level::none, text, uppercase ),
+                folding_mb_per_second( text, uppercase ),
+                hash_mb_per_second( uppercase )
+                );
+        }
+        run_lookups();
+        print( "The SIMD level is at most {}.\n", int( cppm::simd_level() ) );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
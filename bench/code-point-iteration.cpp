@@ -0,0 +1,94 @@
+// `cppm::utf8::code_points` versus the byte by byte `not is_u8_tailbyte` loop with a branch
+// ladder for the sequence length, as in `code/fixed-width-fields.cpp`.
+// Build e.g. with `../build-scripts/unix/bash/build code-point-iteration.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+
+namespace ad_hoc {
+    using   cppm::in_;
+    using   std::string_view;           // <string_view>
+    using Byte = unsigned char;
+
+    constexpr auto is_u8_tailbyte( const Byte v ) -> bool { return (128 <= v and v < 192); }
+
+    auto u8_seq_length( const Byte first_byte )
+        -> int
+    {
+        return (0?0
+            : first_byte < 128?     1
+            : first_byte < 192?     -1
+            : first_byte < 224?     2
+            : first_byte < 240?     3
+            : first_byte < 248?     4
+            :                       -2
+            );
+    }
+
+    auto sum_of_code_points( in_<string_view> s )
+        -> size_t
+    {
+        size_t sum = 0;
+        for( size_t i = 0; i < s.size(); ++i ) {
+            const Byte b = s[i];
+            if( not is_u8_tailbyte( b ) ) {
+                const int n = u8_seq_length( b );
+                char32_t code = (n == 1? b : b & (0x7F >> n));
+                for( int k = 1; k < n; ++k ) { code = (code << 6) | (Byte( s[i + k] ) & 0x3F); }
+                sum += code;
+            }
+        }
+        return sum;
+    }
+}  // namespace ad_hoc
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   fmt::print;
+    using   std::string;                // <string>
+    namespace u8 = cppm::utf8;
+
+    auto sum_of_code_points( const u8::Code_points& range )
+        -> size_t
+    {
+        size_t sum = 0;
+        for( const char32_t code: range ) { sum += code; }
+        return sum;
+    }
+
+    auto reverse_sum_of_code_points( const u8::Code_points& range )
+        -> size_t
+    {
+        size_t sum = 0;
+        for( auto it = range.rbegin(); it != range.rend(); ++it ) { sum += *it; }
+        return sum;
+    }
+
+    void run()
+    {
+        const size_t    n_bytes     = 16'000'000;
+        const int       n_runs      = 10;
+
+        print( "{:<10} {:>12}{:>12}{:>12}\n", "MB/s", "ad hoc", "forward", "backward" );
+        for( const auto& corpus: bench::corpora ) {
+            const string text = repeated_to_size( corpus.sample, n_bytes );
+            const auto range = u8::code_points( text );
+
+            const double t_ad_hoc   = best_seconds( n_runs, [&]{ sink = ad_hoc::sum_of_code_points( text ); } );
+            const double t_forward  = best_seconds( n_runs, [&]{ sink = sum_of_code_points( range ); } );
+            const double t_backward = best_seconds( n_runs, [&]{ sink = reverse_sum_of_code_points( range ); } );
+            print( "{:<10} {:>12.0f}{:>12.0f}{:>12.0f}\n",
+                corpus.name,
+                mb_per_second( text.size(), t_ad_hoc ),
+                mb_per_second( text.size(), t_forward ),
+                mb_per_second( text.size(), t_backward )
+                );
+        }
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,130 @@
+// `cppm::codepages::to_utf8` and `from_utf8` with each SIMD level, for the corpora that a
+// single-byte codepage can represent: ASCII and Latin in windows-1252, Cyrillic in ISO-8859-5,
+// and Cyrillic HTML table rows, which are mostly ASCII, in ISO-8859-5. First the conversions with each SIMD level are checked, also for invalid input. The default
+// is the choice of `to_utf8` and `from_utf8`.
+// Build e.g. with `../build-scripts/unix/bash/build codepage-transcoding.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Simd_level, cppm::Span, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string,                // <string>
+            std::string_view,           // <string_view>
+            std::vector;                // <vector>
+    namespace cp = cppm::codepages;
+
+    // `Simd_level::_` means the default choice of `to_utf8`.
+    auto decoding_mb_per_second( const Simd_level::Enum level, in_<cp::Codepage> codepage, in_<string> text )
+        -> double
+    {
+        vector<char> buffer( cp::max_utf8_length_for_codepage_text( text.size() ) );
+        const double seconds = best_seconds( 10, [&]{
+            const auto out = Span<char>( buffer );
+            sink = (level == Simd_level::_
+                ? cp::to_utf8( codepage, text, out ) : cp::to_utf8_using( level, codepage, text, out )
+                ).n_written;
+            } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    auto encoding_mb_per_second( const Simd_level::Enum level, in_<cp::Codepage> codepage, in_<string> s )
+        -> double
+    {
+        vector<char> buffer( cp::max_codepage_length_for_utf8( s.size() ) );
+        const double seconds = best_seconds( 10, [&]{
+            const auto out = Span<char>( buffer );
+            sink = (level == Simd_level::_
+                ? cp::from_utf8( codepage, s, out ) : cp::from_utf8_using( level, codepage, s, out )
+                ).n_written;
+            } );
+        return mb_per_second( s.size(), seconds );
+    }
+
+    const auto cyrillic_row = string_view( "<tr><td class=\"name\">Кошка</td><td>2024-01-15</td><td>сидит на окне</td></tr>\n" );
+
+    template< class Func >
+    auto fails( const Func& f ) -> bool { try { f(); return false; } catch( ... ) { return true; } }
+
+    void check_conversions( const Simd_level::Enum level )
+    {
+        using S = cp::Transcoding_status;
+        const cp::Codepage& cp1252 = cp::codepage_named( "windows-1252" );
+        const auto check_utf8 = [&]( in_<string_view> s, const S::Enum expected, const size_t expected_n_read ) {
+            vector<char> buffer( cp::max_codepage_length_for_utf8( s.size() ) );
+            const cp::Transcoding_result r = cp::from_utf8_using( level, cp1252, s, Span<char>( buffer ) );
+            now( r.status == expected and r.n_read == expected_n_read )
+                or fail( "from_utf8_using level {}: status {} at {}, expected {} at {}.",
+                    +level, +r.status, r.n_read, +expected, expected_n_read
+                    );
+            if( r.status != S::ok ) { return; }
+
+            const auto text = string_view( buffer.data(), r.n_written );
+            vector<char> bytes( cp::max_utf8_length_for_codepage_text( text.size() ) );
+            const cp::Transcoding_result back = cp::to_utf8_using( level, cp1252, text, Span<char>( bytes ) );
+            now( back.status == S::ok and string_view( bytes.data(), back.n_written ) == s )
+                or fail( "to_utf8_using level {}: no round trip.", +level );
+            };
+
+        const string latin = repeated_to_size( "Blåbærsyltetøy på skiva, € 12. ", 100'000 );
+        check_utf8( latin, S::ok, latin.size() );
+        const auto runs = string( 20'000, '\x80' );    // Continuation bytes only.
+        check_utf8( runs, S::invalid_input, 0 );
+        check_utf8( "abc \xE2\x82", S::invalid_input, 4 );
+        check_utf8( string( 40'000, 'a' ) + runs, S::invalid_input, 40'000 );
+        now( fails( [&]{ cp::codepage_text_from( cp1252, runs ); } ) and fails( [&]{ cp::codepage_text_from( cp1252, "x" + runs ); } ) )
+            or fail( "codepage_text_from accepted a run of continuation bytes." );
+
+        const cp::Codepage& iso_8859_5 = cp::codepage_named( "ISO-8859-5" );
+        const string markup = repeated_to_size( cyrillic_row, 100'000 );
+        const string text = cp::codepage_text_from( iso_8859_5, markup );
+        vector<char> bytes( cp::max_utf8_length_for_codepage_text( text.size() ) );
+        const cp::Transcoding_result r = cp::to_utf8_using( level, iso_8859_5, text, Span<char>( bytes ) );
+        now( r.status == S::ok and string_view( bytes.data(), r.n_written ) == markup )
+            or fail( "to_utf8_using level {}: no round trip of Cyrillic markup.", +level );
+    }
+
+    void run()
+    {
+        for( const auto level: {Simd_level::avx2, Simd_level::sse4_2, Simd_level::none} ) { check_conversions( level ); }
+
+        const size_t n_bytes = 4'000'000;
+        const Simd_level::Enum levels[] = { Simd_level::avx2, Simd_level::sse4_2, Simd_level::none, Simd_level::_ };
+
+        print( "MB/s of codepage text to UTF-8, and of UTF-8 to codepage text:\n" );
+        print( "{:<10} {:<14}{:>8}{:>8}{:>8}{:>8} {:>8}{:>8}{:>8}{:>8}\n", "", "",
+            "avx2", "sse4.2", "scalar", "default", "avx2", "sse4.2", "scalar", "default"
+            );
+        const auto report = [&]( in_<string_view> name, in_<string_view> codepage_name, in_<string_view> sample ) {
+            const cp::Codepage& codepage = cp::codepage_named( codepage_name );
+            const string s = repeated_to_size( sample, n_bytes );
+            const string text = cp::codepage_text_from( codepage, s );
+
+            print( "{:<10} {:<14}", name, codepage_name );
+            for( const auto level: levels ) { print( "{:>8.0f}", decoding_mb_per_second( level, codepage, text ) ); }
+            print( " " );
+            for( const auto level: levels ) { print( "{:>8.0f}", encoding_mb_per_second( level, codepage, s ) ); }
+            print( "\n" );
+            };
+        for( const auto& corpus: bench::corpora ) {
+            const string_view codepage_name = (0?""
+                : corpus.name == "Cyrillic"?    "ISO-8859-5"
+                : corpus.name == "CJK"?         ""
+                :                               "windows-1252"
+                );
+            if( codepage_name.empty() ) { continue; }
+            report( corpus.name, codepage_name, corpus.sample );
+        }
+        report( "Markup", "ISO-8859-5", cyrillic_row );
+        print( "The SIMD level is at most {}.\n", int( cppm::simd_level() ) );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
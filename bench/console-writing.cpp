@@ -0,0 +1,99 @@
+// Writing 200 000 short UTF-8 lines to a pseudo terminal with `fmt::print` to a `FILE*`, which is
+// line buffered for a terminal, versus `cppm::Console_sink` flushing on newline and when full.
+// The number of write system calls is from Linux' `/proc/self/io`, and a thread reads and
+// discards the terminal's output. Unix only.
+// Build e.g. with `../build-scripts/unix/bash/build console-writing.cpp -O2 -pthread`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <pty.h>            // openpty
+#include <termios.h>        // cfmakeraw, tcsetattr
+#include <unistd.h>         // read, close
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::sink;
+    using   cppm::in_, cppm::Console_sink, cppm::Flush_policy;
+    using   fmt::print;
+    using   std::atomic,                    // <atomic>
+            std::FILE,                      // <cstdio>
+            std::ifstream,                  // <fstream>
+            std::string,                    // <string>
+            std::thread;                    // <thread>
+
+    const int n_lines = 200'000;
+    constexpr char line_format[] = "Line {:>3}: Blåbærsyltetøy, 日本国, кошка.\n";
+
+    auto n_write_calls_so_far()
+        -> long
+    {
+        ifstream f( "/proc/self/io" );
+        for( string key; f >> key; ) {
+            long value;  f >> value;
+            if( key == "syscw:" ) { return value; }
+        }
+        return -1;
+    }
+
+    struct Measurement{ double seconds; long n_write_calls; };
+
+    template< class Func >
+    auto measured( in_<Func> f )
+        -> Measurement
+    {
+        const long n_before = n_write_calls_so_far();
+        const double seconds = best_seconds( 1, f );
+        return {seconds, n_write_calls_so_far() - n_before};
+    }
+
+    void run()
+    {
+        int master_fd;  int slave_fd;
+        cppm::now( openpty( &master_fd, &slave_fd, nullptr, nullptr, nullptr ) == 0 )
+            or cppm::fail( "Failed to open a pseudo terminal." );
+        termios settings;
+        tcgetattr( slave_fd, &settings );  cfmakeraw( &settings );  tcsetattr( slave_fd, TCSANOW, &settings );
+
+        atomic<size_t> n_bytes_drained = 0;
+        thread drainer( [&]{
+            char buffer[64*1024];
+            for( ssize_t n; (n = read( master_fd, buffer, sizeof( buffer ) )) > 0; ) { n_bytes_drained += size_t( n ); }
+            } );
+
+        FILE* const tty = fdopen( slave_fd, "w" );
+        const auto line_args = []( const int i ) { return i % 1000; };
+        const size_t n_bytes = n_lines*fmt::formatted_size( line_format, 0 );
+
+        print( "Writing {} lines, {:.1f} MB, to a pseudo terminal:\n", n_lines, n_bytes/1e6 );
+        print( "{:<34}{:>10}{:>14}\n", "", "MB/s", "write calls" );
+        const auto report = [&]( in_<string> name, in_<Measurement> m ) {
+            print( "{:<34}{:>10.1f}{:>14}\n", name, mb_per_second( n_bytes, m.seconds ), m.n_write_calls );
+            };
+
+        report( "fmt::print to the FILE*", measured( [&]{
+            for( int i = 0; i < n_lines; ++i ) { fmt::print( tty, line_format, line_args( i ) ); }
+            fflush( tty );
+            } ) );
+        for( const auto policy: {Flush_policy::on_newline, Flush_policy::when_full} ) {
+            const bool on_newline = (policy == Flush_policy::on_newline);
+            report( on_newline? "Console_sink, on newline" : "Console_sink, when full", measured( [&]{
+                Console_sink out( tty, Console_sink::default_capacity, policy );
+                for( int i = 0; i < n_lines; ++i ) { out.print( line_format, line_args( i ) ); }
+                } ) );
+        }
+
+        fclose( tty );
+        drainer.join();     // Ends when the terminal is closed.
+        close( master_fd );
+        sink = n_bytes_drained;
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
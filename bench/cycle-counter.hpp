@@ -0,0 +1,75 @@
+#pragma once
+// CPU cycles of the calling thread, from the Linux perf events when the kernel allows that, and
+// otherwise from the x86 time stamp counter, which counts at a fixed rate close to the nominal
+// clock frequency. Elsewhere there's no count and `source()` is "none".
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/environment/cpu.hpp>          // CPPM_CPU_IS_X86
+
+#include <stdint.h>         // uint64_t
+
+#include <string_view>
+
+#ifdef __linux__
+#   include <linux/perf_event.h>    // perf_event_attr
+#   include <sys/syscall.h>         // SYS_perf_event_open
+#   include <unistd.h>              // syscall, read, close
+#endif
+
+namespace bench {
+    using   std::string_view;       // <string_view>
+
+    class Cycle_counter:
+        public cppm::No_copy_or_move
+    {
+        int         m_perf_fd   = -1;
+
+        static auto time_stamp() noexcept
+            -> uint64_t
+        {
+        #if CPPM_CPU_IS_X86
+            return __rdtsc();
+        #else
+            return 0;
+        #endif
+        }
+
+    public:
+        ~Cycle_counter()
+        {
+        #ifdef __linux__
+            if( m_perf_fd >= 0 ) { close( m_perf_fd ); }
+        #endif
+        }
+
+        Cycle_counter()
+        {
+        #ifdef __linux__
+            perf_event_attr attr = {};
+            attr.size           = sizeof( attr );
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.config         = PERF_COUNT_HW_CPU_CYCLES;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            m_perf_fd = int( syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) );
+        #endif
+        }
+
+        auto source() const noexcept
+            -> string_view
+        { return (0?"" : m_perf_fd >= 0? "perf_event" : CPPM_CPU_IS_X86? "tsc" : "none"); }
+
+        auto has_cycles() const noexcept -> bool { return source() != "none"; }
+
+        auto now() const noexcept
+            -> uint64_t
+        {
+        #ifdef __linux__
+            if( m_perf_fd >= 0 ) {
+                uint64_t count = 0;
+                if( read( m_perf_fd, &count, sizeof( count ) ) == sizeof( count ) ) { return count; }
+            }
+        #endif
+            return time_stamp();
+        }
+    };
+}  // namespace bench
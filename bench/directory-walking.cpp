@@ -0,0 +1,128 @@
+// Walking a synthetic tree of 1 million empty files, 1000 per directory, with
+// `fs::recursive_directory_iterator` versus `cppm::walk` with 1 thread and with one per hardware
+// thread. The tree is created in the temporary directory by the first run and kept, since creating
+// it takes much longer than walking it; the walks are then of the OS's cached directories. First
+// the entry counts are checked, also for a chain of directories with a path longer than PATH_MAX.
+// Build e.g. with `../build-scripts/unix/bash/build directory-walking.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace app {
+    namespace fs = std::filesystem;
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::Path, cppm::Scope_guard, cppm::Walk_entry, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::atomic,                    // <atomic>
+            std::ofstream,                  // <fstream>
+            std::string, std::to_string,    // <string>
+            std::thread;                    // <thread>
+
+    const int n_top_dirs        = 10;
+    const int n_dirs_per_top    = 100;
+    const int n_files_per_dir   = 1000;
+
+    void ensure_tree_at( in_<fs::path> root )
+    {
+        const fs::path completed_marker = root / "completed";
+        if( fs::exists( completed_marker ) ) { return; }
+        print( "Creating the tree in “{}”, which takes a while…\n", cppm::to_u8_string( root ) );
+        fs::remove_all( root );
+        for( int i = 0; i < n_top_dirs; ++i ) {
+            for( int j = 0; j < n_dirs_per_top; ++j ) {
+                const fs::path dir = root / ("top-" + to_string( i )) / ("dir-" + to_string( j ));
+                fs::create_directories( dir );
+                for( int k = 0; k < n_files_per_dir; ++k ) {
+                    ofstream{ dir / ("file-" + to_string( k ) + ".txt") };
+                }
+            }
+        }
+        ofstream{ completed_marker };
+    }
+
+    auto std_seconds( in_<fs::path> root )
+        -> double
+    {
+        return best_seconds( 3, [&]{
+            size_t n = 0;
+            for( const fs::directory_entry& entry: fs::recursive_directory_iterator( root ) ) {
+                n += entry.path().filename().native().size();
+            }
+            sink = n;
+            } );
+    }
+
+    auto walk_seconds( in_<Path> root, const int n_threads )
+        -> double
+    {
+        return best_seconds( 3, [&]{
+            atomic<size_t> n = 0;
+            cppm::walk( root, [&]( in_<Walk_entry> entry ) { n += entry.name.size(); }, n_threads );
+            sink = n;
+            } );
+    }
+
+    auto n_walked_entries( in_<Path> root, const int n_threads )
+        -> size_t
+    {
+        atomic<size_t> n = 0;
+        cppm::walk( root, [&]( in_<Walk_entry> ) { ++n; }, n_threads );
+        return n;
+    }
+
+    // The chain is created and removed via relative paths, since its full paths are too long.
+    void check_deep_chain_at( in_<fs::path> root )
+    {
+        const int n_levels = 500;
+        const string name = "a-directory-name-of-32-characters";
+        fs::remove_all( root );
+        fs::create_directory( root );
+        const fs::path original_directory = fs::current_path();
+        const Scope_guard restoring( [&]{ fs::current_path( original_directory ); } );
+
+        fs::current_path( root );
+        for( int i = 0; i < n_levels; ++i ) { fs::create_directory( name );  fs::current_path( name ); }
+        const Scope_guard removing( [&]{
+            for( int i = 0; i < n_levels; ++i ) { fs::current_path( ".." );  fs::remove( name ); }
+            } );
+
+        for( const int n_threads: {1, 4} ) {
+            const size_t n = n_walked_entries( Path::from_fs_path( root ), n_threads );
+            now( n == size_t( n_levels ) )
+                or fail( "Walked {} of the {} deeply nested directories with {} thread(s).", n, n_levels, n_threads );
+        }
+    }
+
+    void run()
+    {
+        check_deep_chain_at( fs::temp_directory_path() / "cppm-directory-walking-deep-chain" );
+
+        const fs::path fs_root = fs::temp_directory_path() / "cppm-directory-walking-bench";
+        ensure_tree_at( fs_root );
+        const auto root = Path::from_fs_path( fs_root );
+        const size_t n_entries = size_t( n_top_dirs )*n_dirs_per_top*(1 + n_files_per_dir) + n_top_dirs + 1;
+        const int n_threads = int( std::max( 1u, thread::hardware_concurrency() ) );
+
+        for( const int n: {1, 3, n_threads} ) {
+            const size_t n_walked = n_walked_entries( root, n );
+            now( n_walked == n_entries ) or fail( "Walked {} of {} entries with {} thread(s).", n_walked, n_entries, n );
+        }
+
+        print( "Million entries per second when walking {} entries:\n", n_entries );
+        const auto report = [&]( in_<string> name, const double seconds ) {
+            print( "{:<36}{:>8.2f}\n", name, n_entries/seconds/1e6 );
+            };
+        report( "recursive_directory_iterator", std_seconds( fs_root ) );
+        report( "cppm::walk, 1 thread", walk_seconds( root, 1 ) );
+        report( fmt::format( "cppm::walk, {} hardware thread(s)", n_threads ), walk_seconds( root, n_threads ) );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
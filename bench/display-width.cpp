@@ -0,0 +1,142 @@
+// `cppm::utf8::display_width` of short table cells versus the common implementation technique
+// of a binary search in a sorted table of code point intervals, as in Markus Kuhn's `wcwidth`.
+// First the widths of some emoji sequences, which are single glyphs, are checked.
+// Build e.g. with `../build-scripts/unix/bash/build display-width.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bisearch {
+    using   cppm::in_;
+    using   std::string_view,           // <string_view>
+            std::vector;                // <vector>
+    namespace u8 = cppm::utf8;
+
+    struct Interval{ char32_t first; char32_t last; int width; };
+
+    // The intervals of widths other than 1, derived from the `cppm` tables for equal results.
+    auto make_intervals()
+        -> vector<Interval>
+    {
+        vector<Interval> result;
+        for( char32_t code = 0; code < 0x110000; ++code ) {
+            const int w = u8::code_point_width( code );
+            if( w == 1 ) { continue; }
+            if( not result.empty() and result.back().last + 1 == code and result.back().width == w ) {
+                result.back().last = code;
+            } else {
+                result.push_back( {code, code, w} );
+            }
+        }
+        return result;
+    }
+
+    const vector<Interval> intervals = make_intervals();
+
+    auto width_of( const char32_t code )
+        -> int
+    {
+        if( (0x20 <= code and code < 0x7F) or code > intervals.back().last ) { return 1; }
+        size_t lo = 0;  size_t hi = intervals.size() - 1;
+        while( lo <= hi ) {
+            const size_t mid = (lo + hi)/2;
+            if( code > intervals[mid].last ) {
+                lo = mid + 1;
+            } else if( code < intervals[mid].first ) {
+                if( mid == 0 ) { break; }
+                hi = mid - 1;
+            } else {
+                return intervals[mid].width;
+            }
+        }
+        return 1;
+    }
+
+    auto display_width( in_<string_view> s )
+        -> int
+    {
+        int width = 0;
+        for( const char32_t code: u8::code_points( s ) ) { width += width_of( code ); }
+        return width;
+    }
+}  // namespace bisearch
+
+namespace app {
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string,                // <string>
+            std::string_view,           // <string_view>
+            std::vector;                // <vector>
+    namespace u8 = cppm::utf8;
+
+    // Cells of 1 through 24 code points from the sample, as table cells typically are short.
+    auto cells_from( in_<string_view> sample, const int n_cells )
+        -> vector<string_view>
+    {
+        vector<string_view> result;
+        const auto range = u8::code_points( sample );
+        auto it = range.begin();
+        for( int i = 0; i < n_cells; ++i ) {
+            const int n_code_points = 1 + i % 24;
+            if( it == range.end() ) { it = range.begin(); }
+            const char* const start = it.position();
+            for( int k = 0; k < n_code_points and it != range.end(); ++k ) { ++it; }
+            result.push_back( string_view( start, size_t( it.position() - start ) ) );
+        }
+        return result;
+    }
+
+    template< class Func >
+    auto ns_per_cell( in_<vector<string_view>> cells, in_<Func> width_func )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{
+            int sum = 0;
+            for( const string_view& cell: cells ) { sum += width_func( cell ); }
+            sink = sum;
+            } );
+        return 1e9*seconds/double( cells.size() );
+    }
+
+    struct Width_case{ string_view text; int expected; };
+
+    void check_emoji_sequences()
+    {
+        static const Width_case cases[] =
+        {
+            { "👨‍👩‍👧",          2 },     // Zero width joiner sequence.
+            { "❤️‍🔥",          2 },     // Narrow base, variation selector, wide part.
+            { "👍🏽",          2 },     // Skin tone modifier.
+            { "a👨‍👩‍👧b",        4 },
+            { "👍 🏽",         5 },     // A lone modifier is an emoji of its own.
+            { "‍x",             1 },     // A leading joiner joins nothing.
+        };
+        for( const Width_case& c: cases ) {
+            const int w = u8::display_width( c.text );
+            now( w == c.expected ) or fail( "Width {} instead of {} for “{}”.", w, c.expected, c.text );
+        }
+    }
+
+    void run()
+    {
+        check_emoji_sequences();
+        const int n_cells = 1'000'000;
+
+        print( "{:<10} {:>12}{:>12}\n", "ns/cell", "cppm", "bisearch" );
+        for( const auto& corpus: bench::corpora ) {
+            const vector<string_view> cells = cells_from( corpus.sample, n_cells );
+            const double t_cppm = ns_per_cell( cells, []( in_<string_view> s ){ return u8::display_width( s ); } );
+            const double t_bisearch = ns_per_cell( cells, []( in_<string_view> s ){ return bisearch::display_width( s ); } );
+            print( "{:<10} {:>12.1f}{:>12.1f}\n", corpus.name, t_cppm, t_bisearch );
+        }
+        print( "Cells are 1 through 24 code points, {} intervals in the binary search.\n", bisearch::intervals.size() );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
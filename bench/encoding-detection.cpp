@@ -0,0 +1,99 @@
+// `cppm::utf8::detect_encoding` with each SIMD level, for the corpora as UTF-8 and as UTF-16LE,
+// and `detect_encoding_sampled` of 1 GB of UTF-8. First the detection of some edge cases, e.g. a
+// legacy or truncated final sequence, is checked for each SIMD level.
+// Build e.g. with `../build-scripts/unix/bash/build encoding-detection.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::Byte, cppm::in_, cppm::Simd_level, cppm::Span, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string,                // <string>
+            std::string_view;           // <string_view>
+    namespace u8 = cppm::utf8;
+
+    auto bytes_of( in_<string_view> s ) -> Span<const Byte> { return {reinterpret_cast<const Byte*>( s.data() ), s.size()}; }
+
+    auto utf16le_bytes_from( in_<string_view> s )
+        -> string
+    {
+        string result;
+        for( const char16_t unit: u8::utf16_from( s ) ) {
+            result += char( unit & 0xFF );  result += char( unit >> 8 );
+        }
+        return result;
+    }
+
+    auto detection_mb_per_second( const Simd_level::Enum level, in_<string> data )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{
+            sink = u8::detect_encoding_using( level, bytes_of( data ) ).encoding;
+            } );
+        return mb_per_second( data.size(), seconds );
+    }
+
+    struct Detection_case{ string_view data; u8::Text_encoding::Enum expected; };
+
+    void check_edge_cases( const Simd_level::Enum level )
+    {
+        using E = u8::Text_encoding;
+        using namespace std::string_view_literals;
+        static const Detection_case cases[] =
+        {
+            { "caf\xE9"sv,                       E::legacy },     // Latin-1 high byte last.
+            { "Jos\xE9"sv,                       E::legacy },
+            { "Hello wor\xF0"sv,                 E::legacy },
+            { "abc \xE2\x82"sv,                  E::legacy },     // Truncated UTF-8.
+            { "abc \xE2\x82\xAC"sv,              E::utf8 },
+            { "caf\xC3\xA9"sv,                   E::utf8 },
+            { "cafe"sv,                          E::ascii },
+        };
+        for( const Detection_case& c: cases ) {
+            const auto detected = u8::detect_encoding_using( level, bytes_of( c.data ) ).encoding;
+            now( detected == c.expected )
+                or fail( "Detected {} instead of {} for a {}-byte case.", u8::name_of( detected ), u8::name_of( c.expected ), c.data.size() );
+        }
+
+        // The same with the high byte at the end of a sampled multi-window text.
+        string big = repeated_to_size( "Hello world. ", 10'000'000 );
+        big += '\xE9';
+        const auto detected = u8::detect_encoding_sampled( bytes_of( big ) ).encoding;
+        now( detected == E::legacy ) or fail( "Sampled detection gave {} for a final legacy byte.", u8::name_of( detected ) );
+    }
+
+    void run()
+    {
+        for( const auto level: {Simd_level::avx2, Simd_level::sse4_2, Simd_level::none} ) { check_edge_cases( level ); }
+
+        const size_t n_bytes = 4'000'000;
+        const Simd_level::Enum levels[] = { Simd_level::avx2, Simd_level::sse4_2, Simd_level::none };
+
+        print( "MB/s of encoding detection:\n" );
+        print( "{:<10} {:<10}{:>8}{:>8}{:>8}\n", "", "", "avx2", "sse4.2", "scalar" );
+        for( const auto& corpus: bench::corpora ) {
+            const string s = repeated_to_size( corpus.sample, n_bytes );
+            for( const string& data: {s, utf16le_bytes_from( s )} ) {
+                const auto detected = u8::detect_encoding( bytes_of( data ) ).encoding;
+                print( "{:<10} {:<10}", corpus.name, u8::name_of( detected ) );
+                for( const auto level: levels ) { print( "{:>8.0f}", detection_mb_per_second( level, data ) ); }
+                print( "\n" );
+            }
+        }
+
+        const string big = repeated_to_size( bench::corpora[1].sample, 1'000'000'000 );
+        const double seconds = best_seconds( 10, [&]{
+            sink = u8::detect_encoding_sampled( bytes_of( big ) ).encoding;
+            } );
+        print( "Sampled detection of 1 GB: {:.3f} ms.\n", 1000*seconds );
+        print( "The SIMD level is at most {}.\n", int( cppm::simd_level() ) );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,211 @@
+// `cppm::utf8::graphemes` and `cppm::utf8::Grapheme_segmenter` versus a naive segmentation that
+// looks up the break property of every code point by binary search in a sorted table of
+// intervals, and applies the rules to every code point. First some cases of the Unicode
+// GraphemeBreakTest.txt are checked, also with the segmenter getting them in two chunks.
+// Build e.g. with `../build-scripts/unix/bash/build grapheme-segmentation.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <stdlib.h>         // strtoul
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace naive {
+    using   cppm::in_;
+    using   std::string_view,           // <string_view>
+            std::vector;                // <vector>
+    namespace u8 = cppm::utf8;
+    using B = u8::Grapheme_break;
+
+    struct Interval{ char32_t first; char32_t last; B::Enum property; };
+
+    // The intervals of properties other than `Other`, derived from the `cppm` tables for equal results.
+    auto make_intervals()
+        -> vector<Interval>
+    {
+        vector<Interval> result;
+        for( char32_t code = 0; code < 0x110000; ++code ) {
+            const B::Enum p = u8::grapheme_break_property( code );
+            if( p == B::other ) { continue; }
+            if( not result.empty() and result.back().last + 1 == code and result.back().property == p ) {
+                result.back().last = code;
+            } else {
+                result.push_back( {code, code, p} );
+            }
+        }
+        return result;
+    }
+
+    const vector<Interval> intervals = make_intervals();
+
+    auto property_of( const char32_t code )
+        -> B::Enum
+    {
+        size_t lo = 0;  size_t hi = intervals.size();
+        while( lo < hi ) {
+            const size_t mid = (lo + hi)/2;
+            if( code > intervals[mid].last ) {
+                lo = mid + 1;
+            } else if( code < intervals[mid].first ) {
+                hi = mid;
+            } else {
+                return intervals[mid].property;
+            }
+        }
+        return B::other;
+    }
+
+    auto n_clusters_in( in_<string_view> s )
+        -> size_t
+    {
+        u8::Grapheme_break_state state;
+        size_t n = 0;
+        for( const char32_t code: u8::code_points( s ) ) { n += state.is_break_before( property_of( code ) ); }
+        return n;
+    }
+}  // namespace naive
+
+namespace app {
+    using   bench::best_seconds, bench::Corpus, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::min,                       // <algorithm>
+            std::begin, std::end,           // <iterator>
+            std::string, std::u32string,    // <string>
+            std::string_view,               // <string_view>
+            std::vector;                    // <vector>
+    namespace u8 = cppm::utf8;
+
+    auto n_clusters_by_iterator( in_<string_view> s )
+        -> size_t
+    {
+        size_t n = 0;
+        for( const string_view cluster: u8::graphemes( s ) ) { n += not cluster.empty(); }
+        return n;
+    }
+
+    // In chunks of 4 KB, adjusted to code point boundaries.
+    auto n_clusters_by_segmenter( in_<string_view> s )
+        -> size_t
+    {
+        u8::Grapheme_segmenter segmenter;
+        size_t n = 0;
+        for( size_t i = 0; i < s.size(); ) {
+            size_t stop = min( s.size(), i + 4096 );
+            while( stop < s.size() and u8::is_continuation_byte( s[stop] ) ) { ++stop; }
+            segmenter.for_each_boundary( s.substr( i, stop - i ), [&]( size_t ){ ++n; } );
+            i = stop;
+        }
+        return n;
+    }
+
+    template< class Func >
+    auto mb_per_second_for( in_<string> text, in_<Func> n_clusters_in )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{ sink = n_clusters_in( text ); } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    // Lines of GraphemeBreakTest.txt, with “÷” for a boundary and “×” for none.
+    constexpr string_view test_lines[] =
+    {
+        "÷ 0020 ÷ 0020 ÷",
+        "÷ 000D × 000A ÷",
+        "÷ 000A ÷ 000D ÷",
+        "÷ 000D ÷ 0308 ÷",
+        "÷ 0001 ÷ 0308 ÷",
+        "÷ 0020 × 0308 ÷ 0020 ÷",
+        "÷ 0061 × 0308 ÷ 0062 ÷",
+        "÷ 0061 × 0903 ÷ 0062 ÷",
+        "÷ 0600 × 0062 ÷",
+        "÷ 1100 × 1161 × 11A8 ÷ 1100 ÷",
+        "÷ 1100 × AC00 ÷",
+        "÷ AC00 × 11A8 ÷ 1100 ÷",
+        "÷ AC01 × 11A8 ÷",
+        "÷ 1F1E6 × 1F1E7 ÷ 1F1E8 ÷",
+        "÷ 0061 ÷ 1F1E6 × 1F1E7 ÷ 1F1E8 × 1F1E9 ÷ 0062 ÷",
+        "÷ 1F476 × 1F3FF ÷ 1F476 ÷",
+        "÷ 1F6D1 × 200D × 1F6D1 ÷",
+        "÷ 2701 × 200D × 2701 ÷",
+        "÷ 0061 × 200D ÷ 1F6D1 ÷",
+        "÷ 0020 × 200D ÷ 0646 ÷",
+        "÷ 0646 × 200D ÷ 0020 ÷",
+    };
+
+    struct Break_test{ string text; vector<size_t> starts; };
+
+    auto break_test_from( in_<string_view> line )
+        -> Break_test
+    {
+        Break_test result;
+        const auto boundary = string_view( "÷" );
+        for( size_t i = 0; i < line.size(); ) {
+            const size_t i_end = min( line.find( ' ', i ), line.size() );
+            const string_view token = line.substr( i, i_end - i );
+            if( token == boundary ) {
+                if( i_end < line.size() ) { result.starts.push_back( result.text.size() ); }
+            } else if( token != "×" ) {
+                const auto code = char32_t( strtoul( string( token ).c_str(), nullptr, 16 ) );
+                result.text += u8::utf8_from( u32string( 1, code ) );
+            }
+            i = i_end + 1;
+        }
+        return result;
+    }
+
+    void check_break_tests()
+    {
+        for( const string_view& line: test_lines ) {
+            const Break_test test = break_test_from( line );
+            const string_view text = test.text;
+
+            vector<size_t> starts;
+            for( const string_view cluster: u8::graphemes( text ) ) { starts.push_back( size_t( cluster.data() - text.data() ) ); }
+            now( starts == test.starts ) or fail( "graphemes gave wrong clusters for “{}”.", line );
+            now( naive::n_clusters_in( text ) == test.starts.size() ) or fail( "The naive count is wrong for “{}”.", line );
+
+            // Split at each code point boundary, including none.
+            for( size_t split = 0; split <= text.size(); ++split ) {
+                if( split < text.size() and u8::is_continuation_byte( text[split] ) ) { continue; }
+                u8::Grapheme_segmenter segmenter;
+                starts.clear();
+                segmenter.for_each_boundary( text.substr( 0, split ), [&]( const size_t i ){ starts.push_back( i ); } );
+                segmenter.for_each_boundary( text.substr( split ), [&]( const size_t i ){ starts.push_back( split + i ); } );
+                now( starts == test.starts )
+                    or fail( "Grapheme_segmenter gave wrong clusters for “{}” split at byte {}.", line, split );
+            }
+        }
+    }
+
+    void run()
+    {
+        check_break_tests();
+        const size_t n_bytes = 4'000'000;
+        vector<Corpus> corpora( begin( bench::corpora ), end( bench::corpora ) );
+        corpora.push_back( {"Combining", "Cà va? Tiệ́ng Việt có dấu. "} );
+        corpora.push_back( {"Emoji", "Hi \U0001F44B\U0001F3FD \U0001F468\u200D\U0001F469\u200D\U0001F467 \U0001F1F3\U0001F1F4! "} );
+
+        print( "{:<10} {:>12}{:>12}{:>12}\n", "MB/s", "iterator", "segmenter", "naive" );
+        for( const auto& corpus: corpora ) {
+            const string text = repeated_to_size( corpus.sample, n_bytes );
+            const size_t n = naive::n_clusters_in( text );
+            if( n_clusters_by_iterator( text ) != n or n_clusters_by_segmenter( text ) != n ) {
+                print( "!Cluster counts differ for {}.\n", corpus.name );
+            }
+            const double r_iterator     = mb_per_second_for( text, n_clusters_by_iterator );
+            const double r_segmenter    = mb_per_second_for( text, n_clusters_by_segmenter );
+            const double r_naive        = mb_per_second_for( text, naive::n_clusters_in );
+            print( "{:<10} {:>12.0f}{:>12.0f}{:>12.0f}\n", corpus.name, r_iterator, r_segmenter, r_naive );
+        }
+        print( "{} intervals in the binary search.\n", naive::intervals.size() );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,70 @@
+// Reading the lines of a text file with `ifstream` and `getline`, which copies each line into a
+// `string`, versus `cppm::Line_reader` on a `cppm::Mapped_file`, without and with validation.
+// The file is written to the temporary directory, and it's cached by the OS after the first run.
+// Build e.g. with `../build-scripts/unix/bash/build line-reading.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace app {
+    namespace fs = std::filesystem;
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Line_reader, cppm::Line_validation, cppm::Mapped_file, cppm::Path;
+    using   fmt::print;
+    using   std::ifstream, std::ofstream,   // <fstream>
+            std::getline, std::string,      // <string>
+            std::string_view;               // <string_view>
+
+    auto getline_mb_per_second( in_<Path> path, const size_t n_bytes )
+        -> double
+    {
+        const double seconds = best_seconds( 5, [&]{
+            ifstream f( path.fs_path() );
+            size_t n = 0;
+            for( string line; getline( f, line ); ) { n += line.size(); }
+            sink = n;
+            } );
+        return mb_per_second( n_bytes, seconds );
+    }
+
+    auto line_reader_mb_per_second( in_<Path> path, const Line_validation::Enum validation, const size_t n_bytes )
+        -> double
+    {
+        const double seconds = best_seconds( 5, [&]{
+            const auto file = Mapped_file( path );
+            auto lines = Line_reader( file.text(), validation );
+            size_t n = 0;
+            for( string_view line; lines.next( line ); ) { n += line.size(); }
+            sink = n;
+            } );
+        return mb_per_second( n_bytes, seconds );
+    }
+
+    void run()
+    {
+        const size_t n_bytes = 100'000'000;
+        const fs::path fs_path = fs::temp_directory_path() / "cppm-line-reading-bench.txt";
+        const auto path = Path::from_fs_path( fs_path );
+
+        print( "MB/s of reading lines of 2 corpus samples from a {} MB file:\n", n_bytes/1'000'000 );
+        print( "{:<10}{:>10}{:>10}{:>10}\n", "", "getline", "mapped", "+utf8" );
+        for( const auto& corpus: bench::corpora ) {
+            const string line = string( corpus.sample ) + string( corpus.sample ) + "\n";
+            ofstream( fs_path, std::ios::binary ) << repeated_to_size( line, n_bytes );
+            print( "{:<10}{:>10.0f}{:>10.0f}{:>10.0f}\n", corpus.name,
+                getline_mb_per_second( path, n_bytes ),
+                line_reader_mb_per_second( path, Line_validation::none, n_bytes ),
+                line_reader_mb_per_second( path, Line_validation::utf8, n_bytes )
+                );
+        }
+        fs::remove( fs_path );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
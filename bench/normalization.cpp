@@ -0,0 +1,141 @@
+// `cppm::utf8::normalized` to NFC of text that's already NFC, the common case, which is decided
+// by the quick check with each SIMD level; versus of the same text in NFD, where each decomposed
+// character is a segment that goes through the decomposition and composition path. First some
+// lines of the Unicode NormalizationTest.txt are checked, also after ASCII for the SIMD scan.
+// Build e.g. with `../build-scripts/unix/bash/build normalization.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <stdlib.h>         // strtoul
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Simd_level, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string, std::u32string,                // <string>
+            std::string_view,                           // <string_view>
+            std::vector;                                // <vector>
+    namespace u8 = cppm::utf8;
+    using Form = u8::Normalization_form;
+
+    auto quick_check_mb_per_second( const Simd_level::Enum level, in_<string> text )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{
+            sink = u8::quick_check_using( level, text, Form::nfc );
+            } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    auto normalization_mb_per_second( in_<string> text )
+        -> double
+    {
+        string buffer;
+        const double seconds = best_seconds( 10, [&]{
+            sink = u8::normalized( text, Form::nfc, buffer ).size();
+            } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    // Lines of NormalizationTest.txt: source; NFC; NFD; NFKC; NFKD, as hex code points.
+    constexpr string_view test_lines[] =
+    {
+        "1E0A;1E0A;0044 0307;1E0A;0044 0307",
+        "1E0C;1E0C;0044 0323;1E0C;0044 0323",
+        "1E0A 0323;1E0C 0307;0044 0323 0307;1E0C 0307;0044 0323 0307",
+        "0044 0307 0323;1E0C 0307;0044 0323 0307;1E0C 0307;0044 0323 0307",
+        "1E0A 031B 0323;1E0C 031B 0307;0044 031B 0323 0307;1E0C 031B 0307;0044 031B 0323 0307",
+        "0041 0301;00C1;0041 0301;00C1;0041 0301",
+        "0065 0302 0323;1EC7;0065 0323 0302;1EC7;0065 0323 0302",
+        "00C5;00C5;0041 030A;00C5;0041 030A",
+        "212B;00C5;0041 030A;00C5;0041 030A",
+        "2126;03A9;03A9;03A9;03A9",
+        "0344;0308 0301;0308 0301;0308 0301;0308 0301",
+        "0958;0915 093C;0915 093C;0915 093C;0915 093C",
+        "1E69;1E69;0073 0323 0307;1E69;0073 0323 0307",
+        "1E9B 0323;1E9B 0323;017F 0323 0307;1E69;0073 0323 0307",
+        "FB01;FB01;FB01;0066 0069;0066 0069",
+        "00BD;00BD;00BD;0031 2044 0032;0031 2044 0032",
+        "2460;2460;2460;0031;0031",
+        "AC00;AC00;1100 1161;AC00;1100 1161",
+        "AC01;AC01;1100 1161 11A8;AC01;1100 1161 11A8",
+    };
+
+    // The 5 columns of a test line as UTF-8, each after `prefix`.
+    auto test_columns( in_<string_view> line, in_<string> prefix )
+        -> vector<string>
+    {
+        vector<string> result;
+        u32string codes;
+        const char* p = line.data();
+        const char* const end = p + line.size();
+        for( ;; ) {
+            char* code_end;
+            codes += char32_t( strtoul( p, &code_end, 16 ) );
+            p = code_end;
+            if( p == end or *p == ';' ) {
+                result.push_back( prefix + u8::utf8_from( codes ) );
+                codes.clear();
+                if( p == end ) { break; }
+            }
+            ++p;
+        }
+        return result;
+    }
+
+    // The conformance invariants stated in NormalizationTest.txt, and a quick check that doesn't
+    // say yes for text that isn't NFC.
+    void check_test_line( in_<string_view> line, in_<string> prefix )
+    {
+        const vector<string> c = test_columns( line, prefix );
+        const auto check = [&]( const Form::Enum form, const int i_source, const int i_expected ) {
+            const string result = u8::to_normalized( c[i_source], form );
+            now( result == c[i_expected] )
+                or fail( "Normalization form {} of column {} of “{}” is wrong.", +form, i_source + 1, line );
+            };
+        for( const int i: {0, 1, 2} ) { check( Form::nfc, i, 1 );  check( Form::nfd, i, 2 ); }
+        for( const int i: {3, 4} ) { check( Form::nfc, i, 3 );  check( Form::nfd, i, 4 ); }
+        for( const int i: {0, 1, 2, 3, 4} ) { check( Form::nfkc, i, 3 );  check( Form::nfkd, i, 4 ); }
+
+        for( const auto level: {Simd_level::avx2, Simd_level::sse4_2, Simd_level::none} ) {
+            for( const string& column: c ) {
+                const bool is_nfc = (column == c[1] or column == c[3]);
+                const auto qc = u8::quick_check_using( level, column, Form::nfc );
+                now( is_nfc? qc != u8::Quick_check_result::no : qc != u8::Quick_check_result::yes )
+                    or fail( "Wrong NFC quick check at SIMD level {} for “{}”.", +level, line );
+            }
+        }
+    }
+
+    void run()
+    {
+        for( const string_view& line: test_lines ) {
+            check_test_line( line, "" );
+            check_test_line( line, string( 40, '.' ) );     // Not composable with a mark.
+        }
+
+        const size_t n_bytes = 4'000'000;
+
+        print( "MB/s to NFC, by the quick check of NFC text, and from NFD:\n" );
+        print( "{:<10} {:>10}{:>10}{:>10}{:>10}\n", "", "avx2", "sse4.2", "scalar", "from NFD" );
+        for( const auto& corpus: bench::corpora ) {
+            const string text = u8::to_nfc( repeated_to_size( corpus.sample, n_bytes ) );
+            const string decomposed = u8::to_nfd( text );
+            print( "{:<10} {:>10.0f}{:>10.0f}{:>10.0f}{:>10.0f}\n", corpus.name,
+                quick_check_mb_per_second( Simd_level::avx2, text ),
+                quick_check_mb_per_second( Simd_level::sse4_2, text ),
+                quick_check_mb_per_second( Simd_level::none, text ),
+                normalization_mb_per_second( decomposed )
+                );
+        }
+        print( "The SIMD level is at most {}.\n", int( cppm::simd_level() ) );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
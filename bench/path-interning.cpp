@@ -0,0 +1,133 @@
+// Adding 1 million paths of a synthetic tree, 1000 directories with 1000 recurring file names each,
+// to a `cppm::Path_store` from 1 thread and from one per hardware thread, versus a vector of full
+// path strings. First the ids and texts from concurrent adding are checked.
+// Build e.g. with `../build-scripts/unix/bash/build path-interning.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::Path_id, cppm::Path_store, cppm::now, cppm::fail, cppm::no_path_id;
+    using   fmt::print;
+    using   std::sort,                      // <algorithm>
+            std::string,                    // <string>
+            std::string_view,               // <string_view>
+            std::thread,                    // <thread>
+            std::vector;                    // <vector>
+
+    const int n_dirs        = 1000;
+    const int n_names       = 1000;
+    const auto root_name    = string_view( "/data/archive" );
+
+    struct Tree
+    {
+        vector<string>          dir_names;
+        vector<string>          names;
+        vector<string_view>     name_views;
+    };
+
+    auto generated_tree()
+        -> Tree
+    {
+        Tree result;
+        for( int i = 0; i < n_dirs; ++i ) { result.dir_names.push_back( fmt::format( "dir-{:04}", i ) ); }
+        for( int i = 0; i < n_names; ++i ) { result.names.push_back( fmt::format( "file-{:04}.txt", i ) ); }
+        result.name_views.assign( result.names.begin(), result.names.end() );
+        return result;
+    }
+
+    // Directory `i` goes to thread `i % n_threads`. Returns the first entry id of each directory.
+    auto added_tree( Path_store& store, in_<Tree> tree, const int n_threads )
+        -> vector<Path_id>
+    {
+        const Path_id root = store.add( no_path_id, root_name );
+        vector<Path_id> first_ids( n_dirs );
+        const auto add_share = [&]( const int i_thread ) {
+            for( int i = i_thread; i < n_dirs; i += n_threads ) {
+                const Path_id dir = store.add( root, tree.dir_names[i] );
+                first_ids[i] = store.add_all( dir, tree.name_views );
+            }
+            };
+        vector<thread> threads;
+        for( int i = 1; i < n_threads; ++i ) { threads.emplace_back( add_share, i ); }
+        add_share( 0 );
+        for( thread& t: threads ) { t.join(); }
+        return first_ids;
+    }
+
+    void check_concurrent_adding( in_<Tree> tree, const int n_threads )
+    {
+        Path_store store;
+        vector<Path_id> first_ids = added_tree( store, tree, n_threads );
+        const size_t n_expected = 1 + size_t( n_dirs )*(1 + n_names);
+        now( store.size() == n_expected )
+            or fail( "{} paths in the store instead of {}, with {} threads.", store.size(), n_expected, n_threads );
+
+        string buffer;
+        for( int i = 0; i < n_dirs; i += 7 ) {
+            for( int j = 0; j < n_names; j += 13 ) {
+                const string expected = fmt::format( "{}/{}/{}", root_name, tree.dir_names[i], tree.names[j] );
+                const string_view text = store.text_of( Path_id( first_ids[i] + j ), buffer );
+                now( text == expected ) or fail( "Path “{}” instead of “{}”.", text, expected );
+            }
+        }
+
+        sort( first_ids.begin(), first_ids.end() );
+        for( size_t i = 1; i < first_ids.size(); ++i ) {
+            now( first_ids[i] - first_ids[i - 1] >= Path_id( n_names ) )
+                or fail( "Overlapping id ranges from add_all with {} threads.", n_threads );
+        }
+    }
+
+    void run()
+    {
+        const Tree tree = generated_tree();
+        const int n_threads = int( std::max( 1u, thread::hardware_concurrency() ) );
+        for( const int n: {1, 4, n_threads} ) { check_concurrent_adding( tree, n ); }
+
+        const size_t n_paths = 1 + size_t( n_dirs )*(1 + n_names);
+        size_t n_string_bytes = 0;
+        const double strings_seconds = best_seconds( 3, [&]{
+            vector<string> paths;
+            paths.emplace_back( root_name );
+            for( const string& dir_name: tree.dir_names ) {
+                const string dir = fmt::format( "{}/{}", root_name, dir_name );
+                paths.push_back( dir );
+                for( const string& name: tree.names ) { paths.push_back( dir + '/' + name ); }
+            }
+            n_string_bytes = paths.capacity()*sizeof( string );
+            for( const string& path: paths ) { n_string_bytes += (path.capacity() > 15? path.capacity() + 1 : 0); }
+            sink = paths.size();
+            } );
+
+        size_t n_store_bytes = 0;
+        const auto store_seconds = [&]( const int n ) {
+            return best_seconds( 3, [&]{
+                Path_store store;
+                added_tree( store, tree, n );
+                n_store_bytes = store.n_bytes_allocated();
+                sink = store.size();
+                } );
+            };
+        const double one_thread_seconds = store_seconds( 1 );
+        const double all_threads_seconds = store_seconds( n_threads );
+
+        print( "Adding {} paths, nanoseconds per path and total MB allocated:\n", n_paths );
+        const auto report = [&]( in_<string> name, const double seconds, const size_t n_bytes ) {
+            print( "{:<40}{:>8.1f}{:>10.1f}\n", name, 1e9*seconds/n_paths, n_bytes/1e6 );
+            };
+        report( "vector<string> of full paths", strings_seconds, n_string_bytes );
+        report( "Path_store, 1 thread", one_thread_seconds, n_store_bytes );
+        report( fmt::format( "Path_store, {} hardware thread(s)", n_threads ), all_threads_seconds, n_store_bytes );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
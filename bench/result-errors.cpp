@@ -0,0 +1,125 @@
+// Checking 1 million untrusted file names, of which 1%, 10% or 50% are bad, with a checker that
+// reports failure by `now( ... ) or fail( ... )`, i.e. a formatted message in a thrown exception,
+// versus one that returns a `cppm::Result` with a compact `Failure`, without and with reading
+// the message of each failure. First the failure kinds of some names are checked.
+// Build e.g. with `../build-scripts/unix/bash/build result-errors.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <stddef.h>         // size_t
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::Failure_kind, cppm::Result, cppm::failure, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::mt19937,                   // <random>
+            std::exception,                 // <stdexcept>
+            std::string,                    // <string>
+            std::string_view,               // <string_view>
+            std::vector;                    // <vector>
+    namespace u8 = cppm::utf8;
+
+    inline constexpr Failure_kind invalid_utf8     = { "invalid_utf8", "Invalid UTF-8 at byte offset {}." };
+    inline constexpr Failure_kind has_separator    = { "has_separator", "A “/” at byte offset {}." };
+    inline constexpr Failure_kind too_long         = { "too_long", "More than 255 bytes." };
+
+    auto throwing_checked( in_<string_view> name )
+        -> string_view
+    {
+        now( name.size() <= 255 ) or fail( "More than 255 bytes." );
+        const u8::Validation_result validation = u8::validate( name );
+        now( validation.is_valid ) or fail( "Invalid UTF-8 at byte offset {}.", validation.n_valid_bytes );
+        const size_t i_slash = name.find( '/' );
+        now( i_slash == string_view::npos ) or fail( "A “/” at byte offset {}.", i_slash );
+        return name;
+    }
+
+    auto checked( in_<string_view> name )
+        -> Result<string_view>
+    {
+        if( not now( name.size() <= 255 ) ) { return failure( too_long ); }
+        const u8::Validation_result validation = u8::validate( name );
+        if( not now( validation.is_valid ) ) { return failure( invalid_utf8, validation.n_valid_bytes ); }
+        const size_t i_slash = name.find( '/' );
+        if( not now( i_slash == string_view::npos ) ) { return failure( has_separator, i_slash ); }
+        return name;
+    }
+
+    auto names_with_bad_percentage( const int percentage )
+        -> vector<string>
+    {
+        mt19937 bits( 42 );
+        vector<string> result;
+        for( int i = 0; i < 1'000'000; ++i ) {
+            string name = fmt::format( "blåbærsyltetøy-{}.txt", i );
+            if( int( bits() % 100 ) < percentage ) {
+                name[bits() % name.size()] = (bits() % 2? '/' : '\xFF');
+            }
+            result.push_back( name );
+        }
+        return result;
+    }
+
+    void check_failure_kinds()
+    {
+        now( checked( "ok.txt" ).is_ok() ) or fail( "A valid name was rejected." );
+        now( checked( "a/b" ).failure().is( has_separator ) ) or fail( "Wrong failure kind for a “/”." );
+        now( checked( "a\xFF" ).failure().is( invalid_utf8 ) ) or fail( "Wrong failure kind for invalid UTF-8." );
+        now( checked( string( 256, 'a' ) ).failure().is( too_long ) ) or fail( "Wrong failure kind for a long name." );
+        const Failure_kind copy = has_separator;    // Another object, same name.
+        now( checked( "a/b" ).failure().is( copy ) ) or fail( "Failure kinds are not compared by name." );
+    }
+
+    void run()
+    {
+        check_failure_kinds();
+        print( "Nanoseconds per name when checking 1 million names:\n" );
+        print( "{:<8}{:>12}{:>12}{:>18}\n", "bad", "throwing", "Result", "Result+message" );
+        for( const int percentage: {1, 10, 50} ) {
+            const vector<string> names = names_with_bad_percentage( percentage );
+            const auto ns_per_name = [&]( const double seconds ) { return 1e9*seconds/double( names.size() ); };
+
+            const double throwing_seconds = best_seconds( 3, [&]{
+                size_t n = 0;
+                for( const string& name: names ) {
+                    try {
+                        n += throwing_checked( name ).size();
+                    } catch( in_<exception> x ) {
+                        n += 1;
+                    }
+                }
+                sink = n;
+                } );
+            const double result_seconds = best_seconds( 3, [&]{
+                size_t n = 0;
+                for( const string& name: names ) {
+                    const Result<string_view> r = checked( name );
+                    n += (r? r->size() : 1);
+                }
+                sink = n;
+                } );
+            const double result_with_message_seconds = best_seconds( 3, [&]{
+                size_t n = 0;
+                for( const string& name: names ) {
+                    const Result<string_view> r = checked( name );
+                    n += (r? r->size() : r.failure().message().size());
+                }
+                sink = n;
+                } );
+            print( "{:<8}{:>12.1f}{:>12.1f}{:>18.1f}\n", fmt::format( "{}%", percentage ),
+                ns_per_name( throwing_seconds ), ns_per_name( result_seconds ),
+                ns_per_name( result_with_message_seconds )
+                );
+        }
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
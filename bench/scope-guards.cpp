@@ -0,0 +1,117 @@
+// Guard-heavy loops with a scope guard that stores its cleanup in a `std::function`, as
+// `cppm::Scope_guard` did before, versus the class template `cppm::Scope_guard` and
+// `cppm::Dismissable_scope_guard`, and `cppm::with_exceptions_displayed` with a lambda. Heap
+// allocations are counted by replacing the global `operator new`. The cleanups capture 3
+// references, which is more than `std::function` stores without allocating in libstdc++. The
+// run fails if a `cppm` row has any allocation.
+// Build e.g. with `../build-scripts/unix/bash/build scope-guards.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <stddef.h>         // size_t
+#include <stdlib.h>         // malloc, free
+
+#include <functional>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace bench {
+    inline size_t n_allocations = 0;
+}  // namespace bench
+
+auto operator new( const size_t size )
+    -> void*
+{
+    ++bench::n_allocations;
+    if( void* const p = malloc( size ) ) { return p; }
+    throw std::bad_alloc();
+}
+
+void operator delete( void* const p ) noexcept { free( p ); }
+void operator delete( void* const p, size_t ) noexcept { free( p ); }
+
+namespace app {
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::No_copy_or_move, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::function,                  // <functional>
+            std::string,                    // <string>
+            std::move;                      // <utility>
+
+    // The former `cppm::Scope_guard`.
+    class Function_scope_guard:
+        public No_copy_or_move
+    {
+        function<void()>    m_cleanup;
+
+    public:
+        ~Function_scope_guard() { m_cleanup(); }
+        Function_scope_guard( function<void()> cleanup ): m_cleanup( move( cleanup ) ) {}
+        void dismiss() { m_cleanup = []{}; }
+    };
+
+    const int n_iterations = 10'000'000;
+
+    struct Measurement{ double ns_per_iteration; double allocations_per_iteration; };
+
+    template< class Func >
+    auto measured( in_<Func> f )
+        -> Measurement
+    {
+        const size_t n_before = bench::n_allocations;
+        const double seconds = best_seconds( 1, f );
+        const double n_allocations = double( bench::n_allocations - n_before );
+        return {1e9*seconds/n_iterations, n_allocations/n_iterations};
+    }
+
+    void run()
+    {
+        print( "Nanoseconds and heap allocations per iteration of {} iterations:\n", n_iterations );
+        print( "{:<40}{:>8}{:>14}\n", "", "ns", "allocations" );
+        const auto report = [&]( in_<string> name, in_<Measurement> m ) {
+            print( "{:<40}{:>8.2f}{:>14.2f}\n", name, m.ns_per_iteration, m.allocations_per_iteration );
+            };
+        const auto report_allocation_free = [&]( in_<string> name, in_<Measurement> m ) {
+            report( name, m );
+            now( m.allocations_per_iteration == 0 )
+                or fail( "{} allocations per iteration with {}.", m.allocations_per_iteration, name );
+            };
+
+        size_t a = 0;  size_t b = 0;  size_t c = 0;
+        report( "function<void()> guard", measured( [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                const Function_scope_guard guard( [&]{ a += 1; b += 2; c += 3; } );
+                a ^= size_t( i );
+            }
+            } ) );
+        report( "function<void()> guard, dismissed", measured( [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                Function_scope_guard guard( [&]{ a += 1; b += 2; c += 3; } );
+                if( i % 2 ) { guard.dismiss(); }
+            }
+            } ) );
+        report_allocation_free( "cppm::Scope_guard", measured( [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                const cppm::Scope_guard guard( [&]{ a += 1; b += 2; c += 3; } );
+                a ^= size_t( i );
+            }
+            } ) );
+        report_allocation_free( "cppm::Dismissable_scope_guard, dismissed", measured( [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                cppm::Dismissable_scope_guard guard( [&]{ a += 1; b += 2; c += 3; } );
+                if( i % 2 ) { guard.dismiss(); }
+            }
+            } ) );
+        report_allocation_free( "cppm::with_exceptions_displayed", measured( [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                c += size_t( cppm::with_exceptions_displayed( [&]{ a += 1; b += 2; c += 3; } ) );
+            }
+            } ) );
+        sink = a + b + c;
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
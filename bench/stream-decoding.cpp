@@ -0,0 +1,99 @@
+// `cppm::utf8::Stream_decoder` validation and UTF-16 transcoding of text in 4 KiB chunks, as read
+// from a file or socket, versus `validate` and `to_utf16` of the whole text at once.
+// Build e.g. with `../build-scripts/unix/bash/build stream-decoding.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Span;
+    using   fmt::print;
+    using   std::min,                   // <algorithm>
+            std::string,                // <string>
+            std::string_view,           // <string_view>
+            std::vector;                // <vector>
+    namespace u8 = cppm::utf8;
+
+    const size_t chunk_size = 4096;
+
+    template< class Func >
+    void for_each_chunk_of( in_<string_view> text, const Func& f )
+    {
+        for( size_t i = 0; i < text.size(); i += chunk_size ) {
+            f( text.substr( i, min( chunk_size, text.size() - i ) ) );
+        }
+    }
+
+    auto whole_validation_mb_per_second( in_<string> text )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{ sink = u8::validate( text ).n_valid_bytes; } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    auto stream_validation_mb_per_second( in_<string> text )
+        -> double
+    {
+        const double seconds = best_seconds( 10, [&]{
+            u8::Stream_decoder decoder;
+            size_t n_bytes = 0;
+            for_each_chunk_of( text, [&]( in_<string_view> chunk ) {
+                const u8::Stream_utf8_result result = decoder.validated( chunk );
+                n_bytes += result.head.size() + result.body.size();
+                } );
+            sink = n_bytes;
+            } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    auto whole_utf16_mb_per_second( in_<string> text )
+        -> double
+    {
+        vector<char16_t> buffer( u8::max_utf16_length_for_utf8( text.size() ) );
+        const double seconds = best_seconds( 10, [&]{
+            sink = u8::to_utf16( text, Span<char16_t>( buffer ) ).n_written;
+            } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    auto stream_utf16_mb_per_second( in_<string> text )
+        -> double
+    {
+        vector<char16_t> buffer( u8::max_utf16_length_for_utf8( chunk_size + 3 ) );
+        const double seconds = best_seconds( 10, [&]{
+            u8::Stream_decoder decoder;
+            size_t n_units = 0;
+            for_each_chunk_of( text, [&]( in_<string_view> chunk ) {
+                n_units += decoder.to_utf16( chunk, Span<char16_t>( buffer ) ).n_written;
+                } );
+            sink = n_units;
+            } );
+        return mb_per_second( text.size(), seconds );
+    }
+
+    void run()
+    {
+        const size_t n_bytes = 4'000'000;
+
+        print( "MB/s of validation and of transcoding to UTF-16, whole and in {} byte chunks:\n", chunk_size );
+        print( "{:<10} {:>10}{:>10}{:>10}{:>10}\n", "", "validate", "chunked", "to_utf16", "chunked" );
+        for( const auto& corpus: bench::corpora ) {
+            const string text = repeated_to_size( corpus.sample, n_bytes );
+            print( "{:<10} {:>10.0f}{:>10.0f}{:>10.0f}{:>10.0f}\n", corpus.name,
+                whole_validation_mb_per_second( text ),
+                stream_validation_mb_per_second( text ),
+                whole_utf16_mb_per_second( text ),
+                stream_utf16_mb_per_second( text )
+                );
+        }
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
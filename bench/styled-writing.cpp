@@ -0,0 +1,95 @@
+// Coloring a table of 1 million numbers, odd ones yellow and even ones blue, by formatting each
+// line and then parsing it back into tokens with `stoi` and `fmt::format( fg( ... ), token )`, as
+// in "code/pascal-triangle.colored.cpp", versus a `cppm::Styled_writer` that formats each number
+// into one buffer and only emits an escape sequence when the color changes.
+// Build e.g. with `../build-scripts/unix/bash/build styled-writing.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::Ansi_color, cppm::Styled_writer;
+    using   fmt::print;
+    using   std::mt19937,                   // <random>
+            std::string, std::stoi,         // <string>
+            std::exchange,                  // <utility>
+            std::vector;                    // <vector>
+
+    const int n_columns     = 10;
+    const int field_size    = 8;
+
+    constexpr auto is_digit( const char ch ) -> bool { return ('0' <= ch and ch <= '9'); }
+    constexpr auto is_odd( const int v ) -> bool { return (v % 2 == 1); }
+
+    // As `colored_pascal_triangle_line` in "code/pascal-triangle.colored.cpp".
+    auto colored_line( in_<string> line )
+        -> string
+    {
+        string result;
+        string part;
+        char prev_ch = 0;
+        for( const char ch: line ) {
+            if( (ch == ' ') != (prev_ch == ' ') ) {
+                if( not part.empty() ) {
+                    if( is_digit( part.front() ) ) {
+                        const auto color = (is_odd( stoi( part ) )? fmt::color::yellow : fmt::color::blue);
+                        part = fmt::format( fg( color ), part );
+                    }
+                    result += exchange( part, "" );
+                }
+            }
+            part += ch;
+            prev_ch = ch;
+        }
+        if( not part.empty() ) { result += part; }
+        return result;
+    }
+
+    void run()
+    {
+        mt19937 bits( 42 );
+        vector<int> numbers( 1'000'000 );
+        for( int& v: numbers ) { v = int( bits() % 100'000 ); }
+
+        size_t n_bytes = 0;
+        const double parsing_seconds = best_seconds( 3, [&]{
+            string text;
+            for( size_t i = 0; i < numbers.size(); i += n_columns ) {
+                string line;
+                for( int j = 0; j < n_columns; ++j ) { line += fmt::format( "{:>{}}", numbers[i + j], field_size ); }
+                line += ' ';
+                text += colored_line( line );
+                text += '\n';
+            }
+            sink = text.size();
+            } );
+        const double writer_seconds = best_seconds( 3, [&]{
+            Styled_writer out( 32*numbers.size() );
+            for( size_t i = 0; i < numbers.size(); i += n_columns ) {
+                for( int j = 0; j < n_columns; ++j ) {
+                    const int v = numbers[i + j];
+                    out.print( fg( is_odd( v )? Ansi_color::yellow : Ansi_color::blue ), "{:>{}}", v, field_size );
+                }
+                out.reset_style();
+                out.write( "\n" );
+            }
+            n_bytes = out.text().size();
+            sink = n_bytes;
+            } );
+
+        print( "Nanoseconds per number when coloring {} numbers:\n", numbers.size() );
+        print( "{:<36}{:>8.1f}\n", "Format, parse back and fmt::format", 1e9*parsing_seconds/double( numbers.size() ) );
+        print( "{:<36}{:>8.1f}\n", "Styled_writer", 1e9*writer_seconds/double( numbers.size() ) );
+        print( "The Styled_writer output is {:.1f} MB.\n", n_bytes/1e6 );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
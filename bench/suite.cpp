@@ -0,0 +1,368 @@
+// The benchmark suite: UTF-8 validation and transcoding, `Path` construction, `str()` and
+// formatting, `Console_sink` output and `Scope_guard`, over generated multilingual corpora. The
+// results are written to `stdout` as JSON with CPU cycles per byte, or per operation, so that
+// versions can be compared, and a table is written to `stderr`:
+//
+//     suite [--label TEXT] [--mb N] [--runs N] [--baseline FILE.json] [--tolerance PERCENT]
+//
+// With `--baseline` each result is compared to the one with the same name and corpus in an
+// earlier output, by cycles when both have them from the same counter, else by time, and the
+// suite fails if any is slower by more than the tolerance, by default 10%. The corpora are the
+// same for every run since the generator is seeded, so only the code and the machine vary.
+//
+// Build and run e.g. with `bash run-suite`, or build with
+// `../build-scripts/unix/bash/build suite.cpp -O2`. Linux, or at least Unix, only.
+#include "bench-support.hpp"
+#include "cycle-counter.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+#include <fmt/format.h>         // fmt::memory_buffer
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint64_t
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   bench::Cycle_counter, bench::Language, bench::Random_bits, bench::generated_text,
+            bench::sink, bench::vocabularies;
+    using   cppm::in_, cppm::now, cppm::fail, cppm::Console_sink, cppm::Flush_policy, cppm::Path,
+            cppm::Span;
+    using   fmt::print;
+    using   std::FILE,                          // <cstdio>
+            std::ifstream,                      // <fstream>
+            std::back_inserter,                 // <iterator>
+            std::map,                           // <map>
+            std::string, std::u16string, std::u32string, std::getline,     // <string>
+            std::string_view,                   // <string_view>
+            std::vector;                        // <vector>
+    namespace chrono = std::chrono;
+    namespace u8 = cppm::utf8;
+
+    struct Options
+    {
+        string  label;
+        size_t  n_corpus_bytes;
+        int     n_runs;
+        string  baseline_path;
+        double  tolerance;
+    };
+
+    auto options_from( in_<vector<string>> args )
+        -> Options
+    {
+        Options result = {"", 16*1024*1024, 5, "", 0.10};
+        for( size_t i = 0; i < args.size(); ++i ) {
+            const string& arg = args[i];
+            now( i + 1 < args.size() )
+                or fail( "Usage: suite [--label TEXT] [--mb N] [--runs N] [--baseline FILE.json] [--tolerance PERCENT]" );
+            const string& value = args[++i];
+            if( arg == "--label" )              { result.label = value; }
+            else if( arg == "--mb" )            { result.n_corpus_bytes = size_t( std::stoi( value ) )*1024*1024; }
+            else if( arg == "--runs" )          { result.n_runs = std::stoi( value ); }
+            else if( arg == "--baseline" )      { result.baseline_path = value; }
+            else if( arg == "--tolerance" )     { result.tolerance = std::stod( value )/100; }
+            else                                { fail( "Unknown option “{}”.", arg ); }
+        }
+        now( result.n_runs >= 1 ) or fail( "The number of runs must be at least 1." );
+        return result;
+    }
+
+    struct Result
+    {
+        string          name;
+        string_view     corpus;
+        string_view     unit;           // "byte" or "op".
+        size_t          n_units;
+        double          seconds;        // Best of the runs.
+        double          cycles;         // Of the best run, or -1 with no cycle counter.
+
+        auto ns_per_unit() const -> double { return 1e9*seconds/double( n_units ); }
+        auto cycles_per_unit() const -> double { return cycles/double( n_units ); }
+    };
+
+    class Suite
+    {
+        const Options&      m_options;
+        Cycle_counter       m_cycles;
+        vector<Result>      m_results;
+
+    public:
+        Suite( in_<Options> options ): m_options( options ), m_cycles(), m_results() {}
+
+        auto results() const -> const vector<Result>& { return m_results; }
+        auto cycle_source() const -> string_view { return m_cycles.source(); }
+
+        template< class Func >
+        void measure( in_<string> name, in_<string_view> corpus, in_<string_view> unit, const size_t n_units, in_<Func> f )
+        {
+            Result result = {name, corpus, unit, n_units, 1e99, -1};
+            for( int i = 0; i < m_options.n_runs; ++i ) {
+                const uint64_t start_cycles = m_cycles.now();
+                const auto start = chrono::steady_clock::now();
+                f();
+                const auto stop = chrono::steady_clock::now();
+                const uint64_t stop_cycles = m_cycles.now();
+                const double seconds = chrono::duration<double>( stop - start ).count();
+                if( seconds < result.seconds ) {
+                    result.seconds = seconds;
+                    if( m_cycles.has_cycles() ) { result.cycles = double( stop_cycles - start_cycles ); }
+                }
+            }
+            print( stderr, "{:<28}{:<12}{:>10.3f}{:>12}\n", name, corpus,
+                (result.cycles < 0? result.ns_per_unit() : result.cycles_per_unit()),
+                fmt::format( "{}/{}", (result.cycles < 0? "ns" : "cycles"), unit )
+                );
+            m_results.push_back( result );
+        }
+    };
+
+    // Relative paths of 2 to 4 components of 1 or 2 words from the vocabulary, e.g. "på/gutten.txt".
+    auto generated_paths( const Language::Enum language, const int n_paths )
+        -> vector<string>
+    {
+        const auto& words = vocabularies[language].words;
+        Random_bits bits( 42 + language );
+        vector<string> result;
+        for( int i = 0; i < n_paths; ++i ) {
+            string path;
+            const size_t n_components = 2 + bits.below( 3 );
+            for( size_t j = 0; j < n_components; ++j ) {
+                if( j > 0 ) { path += '/'; }
+                path += words[bits.below( std::size( words ) )];
+                if( bits.below( 2 ) ) { path += '_';  path += words[bits.below( std::size( words ) )]; }
+            }
+            path += ".txt";
+            result.push_back( path );
+        }
+        return result;
+    }
+
+    void add_text_benchmarks( Suite& suite, const Language::Enum language, const size_t n_bytes )
+    {
+        const string_view corpus = vocabularies[language].name;
+        const string text = generated_text( language, n_bytes );
+        const size_t n = text.size();
+
+        suite.measure( "utf8.validate", corpus, "byte", n, [&]{ sink = u8::validate( text ).n_valid_bytes; } );
+
+        u16string utf16( u8::max_utf16_length_for_utf8( n ), u'\0' );
+        string utf8( u8::max_utf8_length_for_utf16( utf16.size() ), '\0' );
+        suite.measure( "utf8.to_utf16", corpus, "byte", n, [&]{
+            sink = u8::to_utf16( text, Span<char16_t>( utf16 ) ).n_written;
+            } );
+        utf16.resize( u8::to_utf16( text, Span<char16_t>( utf16 ) ).n_written );
+        suite.measure( "utf8.from_utf16", corpus, "byte", n, [&]{
+            sink = u8::to_utf8( utf16, Span<char>( utf8 ) ).n_written;
+            } );
+
+        u32string utf32( u8::max_utf32_length_for_utf8( n ), U'\0' );
+        suite.measure( "utf8.to_utf32", corpus, "byte", n, [&]{
+            sink = u8::to_utf32( text, Span<char32_t>( utf32 ) ).n_written;
+            } );
+        utf32.resize( u8::to_utf32( text, Span<char32_t>( utf32 ) ).n_written );
+        utf8.resize( u8::max_utf8_length_for_utf32( utf32.size() ) );
+        suite.measure( "utf8.from_utf32", corpus, "byte", n, [&]{
+            sink = u8::from_utf32( utf32, Span<char>( utf8 ) ).n_written;
+            } );
+
+        // Line by line to "/dev/null", so that the cost is the sink's and not the terminal's.
+        FILE* const null_device = std::fopen( "/dev/null", "w" );
+        now( null_device != nullptr ) or fail( "Failed to open “/dev/null”." );
+        const cppm::Scope_guard closing( [&]{ std::fclose( null_device ); } );
+        suite.measure( "console.write_lines", corpus, "byte", n, [&]{
+            Console_sink out( null_device, Console_sink::default_capacity, Flush_policy::when_full );
+            const string_view all = text;
+            for( size_t start = 0; start < all.size(); ) {
+                const size_t i_newline = all.find( '\n', start );
+                const size_t end = (i_newline == string_view::npos? all.size() : i_newline + 1);
+                out.write( all.substr( start, end - start ) );
+                start = end;
+            }
+            } );
+    }
+
+    void add_path_benchmarks( Suite& suite, const Language::Enum language )
+    {
+        const string_view corpus = vocabularies[language].name;
+        const vector<string> specs = generated_paths( language, 200'000 );
+        size_t n = 0;
+        for( const string& spec: specs ) { n += spec.size(); }
+
+        vector<Path> paths;
+        paths.reserve( specs.size() );
+        suite.measure( "path.construct", corpus, "byte", n, [&]{
+            paths.clear();
+            for( const string& spec: specs ) { paths.emplace_back( spec ); }
+            } );
+        suite.measure( "path.str", corpus, "byte", n, [&]{
+            size_t n_bytes = 0;
+            for( const Path& path: paths ) { n_bytes += path.str().size(); }
+            sink = n_bytes;
+            } );
+        fmt::memory_buffer buffer;
+        suite.measure( "path.format", corpus, "byte", n, [&]{
+            buffer.clear();
+            for( const Path& path: paths ) { fmt::format_to( back_inserter( buffer ), "{}\n", path ); }
+            sink = buffer.size();
+            } );
+    }
+
+    void add_scope_guard_benchmarks( Suite& suite )
+    {
+        const int n_iterations = 10'000'000;
+        size_t a = 0;  size_t b = 0;
+        suite.measure( "scope_guard", "-", "op", n_iterations, [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                const cppm::Scope_guard guard( [&]{ a += 1; b += a; } );
+                a ^= size_t( i );
+            }
+            } );
+        suite.measure( "scope_guard.dismissable", "-", "op", n_iterations, [&]{
+            for( int i = 0; i < n_iterations; ++i ) {
+                cppm::Dismissable_scope_guard guard( [&]{ a += 1; b += a; } );
+                if( i % 2 ) { guard.dismiss(); }
+            }
+            } );
+        sink = a + b;
+    }
+
+    auto json_escaped( in_<string_view> s )
+        -> string
+    {
+        string result;
+        for( const char ch: s ) {
+            if( ch == '"' or ch == '\\' ) { result += '\\'; }
+            if( 0 <= ch and ch < 0x20 ) { result += fmt::format( "\\u{:04x}", int( ch ) ); continue; }
+            result += ch;
+        }
+        return result;
+    }
+
+    // One result per line, which `baseline_results` relies on.
+    auto json_for( in_<Suite> suite, in_<Options> options )
+        -> string
+    {
+        string result = "{\n";
+        result += fmt::format( "  \"suite\": \"cppm\",\n  \"label\": \"{}\",\n", json_escaped( options.label ) );
+        result += fmt::format( "  \"compiler\": \"{}\",\n", json_escaped( __VERSION__ ) );
+        constexpr string_view simd_level_names[] = { "none", "sse4_2", "avx2", "avx512" };
+        result += fmt::format( "  \"simd_level\": \"{}\",\n", simd_level_names[cppm::simd_level()] );
+        result += fmt::format( "  \"cycle_counter\": \"{}\",\n", suite.cycle_source() );
+        result += "  \"results\": [\n";
+        const vector<Result>& results = suite.results();
+        for( size_t i = 0; i < results.size(); ++i ) {
+            const Result& r = results[i];
+            result += fmt::format(
+                "    {{\"name\": \"{}\", \"corpus\": \"{}\", \"unit\": \"{}\", \"n_units\": {}, "
+                "\"seconds\": {:.6f}, \"ns_per_unit\": {:.4f}, \"cycles_per_unit\": {}}}{}\n",
+                r.name, r.corpus, r.unit, r.n_units, r.seconds, r.ns_per_unit(),
+                (r.cycles < 0? string( "null" ) : fmt::format( "{:.4f}", r.cycles_per_unit() )),
+                (i + 1 < results.size()? "," : "")
+                );
+        }
+        result += "  ]\n}\n";
+        return result;
+    }
+
+    // The text after `"key": ` up to the next `,` or `}`, without quotes.
+    auto json_value_in( in_<string_view> line, in_<string_view> key )
+        -> string_view
+    {
+        const string quoted_key = fmt::format( "\"{}\": ", key );
+        const size_t i_key = line.find( quoted_key );
+        if( i_key == string_view::npos ) { return ""; }
+        const size_t i_start = i_key + quoted_key.size();
+        const size_t i_end = line.find_first_of( ",}", i_start );
+        string_view value = line.substr( i_start, i_end - i_start );
+        if( value.size() >= 2 and value.front() == '"' ) { value = value.substr( 1, value.size() - 2 ); }
+        return value;
+    }
+
+    struct Baseline_result{ double ns_per_unit; double cycles_per_unit; };     // -1 for no cycles.
+
+    auto baseline_results( in_<string> path, string& cycle_source )
+        -> map<string, Baseline_result>
+    {
+        ifstream f( path );
+        now( f.is_open() ) or fail( "Failed to open “{}”.", path );
+        map<string, Baseline_result> result;
+        for( string line; getline( f, line ); ) {
+            const string_view counter = json_value_in( line, "cycle_counter" );
+            if( not counter.empty() ) { cycle_source = string( counter ); }
+            const string_view name = json_value_in( line, "name" );
+            if( name.empty() ) { continue; }
+            const string_view cycles = json_value_in( line, "cycles_per_unit" );
+            result[fmt::format( "{} {}", name, json_value_in( line, "corpus" ) )] = Baseline_result{
+                std::stod( string( json_value_in( line, "ns_per_unit" ) ) ),
+                (cycles == "null"? -1 : std::stod( string( cycles ) ))
+                };
+        }
+        return result;
+    }
+
+    // Returns the number of regressions.
+    auto n_regressions_compared_to_baseline( in_<Suite> suite, in_<Options> options )
+        -> int
+    {
+        string baseline_cycle_source;
+        const map<string, Baseline_result> baseline = baseline_results( options.baseline_path, baseline_cycle_source );
+        const bool uses_cycles = (baseline_cycle_source == suite.cycle_source() and suite.cycle_source() != "none");
+
+        print( stderr, "\nCompared to “{}”, by {}:\n", options.baseline_path, (uses_cycles? "cycles" : "time") );
+        int n_regressions = 0;
+        for( const Result& r: suite.results() ) {
+            const auto it = baseline.find( fmt::format( "{} {}", r.name, r.corpus ) );
+            if( it == baseline.end() ) { continue; }
+            const Baseline_result& old = it->second;
+            const bool by_cycles = (uses_cycles and old.cycles_per_unit >= 0 and r.cycles >= 0);
+            const double ratio = (by_cycles
+                ? r.cycles_per_unit()/old.cycles_per_unit
+                : r.ns_per_unit()/old.ns_per_unit
+                );
+            const bool is_regression = (ratio > 1 + options.tolerance);
+            n_regressions += is_regression;
+            print( stderr, "{:<28}{:<12}{:>+9.1f}%{}\n", r.name, r.corpus, 100*(ratio - 1),
+                (is_regression? "  REGRESSION" : "")
+                );
+        }
+        return n_regressions;
+    }
+
+    void run( in_<vector<string>> args )
+    {
+        const Options options = options_from( args );
+        Suite suite( options );
+        print( stderr, "{:.0f} MB corpora, best of {} runs, cycles from {}:\n",
+            options.n_corpus_bytes/1e6, options.n_runs, suite.cycle_source()
+            );
+        for( int i = 0; i < Language::_; ++i ) {
+            add_text_benchmarks( suite, Language::Enum( i ), options.n_corpus_bytes );
+        }
+        for( int i = 0; i < Language::_; ++i ) {
+            add_path_benchmarks( suite, Language::Enum( i ) );
+        }
+        add_scope_guard_benchmarks( suite );
+
+        print( "{}", json_for( suite, options ) );
+        std::fflush( stdout );
+        if( not options.baseline_path.empty() ) {
+            const int n_regressions = n_regressions_compared_to_baseline( suite, options );
+            now( n_regressions == 0 )
+                or fail( "{} result(s) are more than {:.0f}% slower than the baseline.", n_regressions, 100*options.tolerance );
+        }
+    }
+}  // namespace app
+
+auto main( int n_args, char** args ) -> int
+{
+    const auto arguments = std::vector<std::string>( args + 1, args + n_args );
+    return cppm::with_exceptions_displayed( [&]{ app::run( arguments ); } );
+}
@@ -0,0 +1,90 @@
+// Laying out 1 million report rows of a name, a city and an amount, where the names and cities
+// recur, by padding each cell with `fmt::format` and `cppm::utf8::width_padded` into a new line
+// string, versus a `cppm::Table_formatter` with fixed and with auto-sized column widths.
+// Build e.g. with `../build-scripts/unix/bash/build table-formatting.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   bench::best_seconds, bench::sink;
+    using   cppm::in_, cppm::Column_alignment, cppm::Table_column, cppm::Table_formatter;
+    using   fmt::print;
+    using   std::mt19937,                   // <random>
+            std::string,                    // <string>
+            std::string_view,               // <string_view>
+            std::vector;                    // <vector>
+    namespace u8 = cppm::utf8;
+
+    const int n_rows = 1'000'000;
+
+    struct Row{ string_view name; string_view city; string amount; };
+
+    auto generated_rows()
+        -> vector<Row>
+    {
+        static const string_view first_names[] = { "Åse", "Bjørn", "Сергей", "Zoë", "健太", "Ólafur", "Anna", "Jürgen" };
+        static const string_view last_names[] = { "Ødegård", "Иванов", "山田", "Müller", "Nilsen", "Łukasiewicz", "Smith" };
+        static const string_view cities[] = { "Tromsø", "Москва", "東京", "Kraków", "Zürich", "Oslo", "São Paulo" };
+        static vector<string> names;
+        for( const string_view first: first_names ) {
+            for( const string_view last: last_names ) { names.push_back( fmt::format( "{} {}", first, last ) ); }
+        }
+
+        mt19937 bits( 42 );
+        vector<Row> result;
+        for( int i = 0; i < n_rows; ++i ) {
+            result.push_back( Row{
+                names[bits() % names.size()], cities[bits() % std::size( cities )],
+                fmt::format( "{}.{:02}", bits() % 100'000, bits() % 100 )
+                } );
+        }
+        return result;
+    }
+
+    void run()
+    {
+        const vector<Row> rows = generated_rows();
+        const auto ns_per_row = []( const double seconds ) { return 1e9*seconds/n_rows; };
+        const auto count_bytes = [&]( in_<string_view> s ) { sink = sink + s.size(); };
+
+        const double fmt_seconds = best_seconds( 3, [&]{
+            size_t n = 0;
+            for( const Row& row: rows ) {
+                string line = fmt::format( "{:<20}", u8::width_padded( row.name ) );
+                line += ' ';
+                line += fmt::format( "{:<10}", u8::width_padded( row.city ) );
+                line += ' ';
+                line += fmt::format( "{:>9}", row.amount );
+                line += '\n';
+                n += line.size();
+            }
+            sink = n;
+            } );
+
+        const auto formatter_seconds = [&]( const int name_width, const int city_width ) {
+            return best_seconds( 3, [&]{
+                Table_formatter table(
+                    { {name_width}, {city_width}, {9, Column_alignment::right} },
+                    count_bytes
+                    );
+                for( const Row& row: rows ) { table.add_row( {row.name, row.city, row.amount} ); }
+                } );
+            };
+        const double fixed_seconds = formatter_seconds( 20, 10 );
+        const double auto_seconds = formatter_seconds( 0, 0 );
+
+        print( "Nanoseconds per row when laying out {} rows:\n", n_rows );
+        print( "{:<40}{:>8.1f}\n", "fmt::format with width_padded", ns_per_row( fmt_seconds ) );
+        print( "{:<40}{:>8.1f}\n", "Table_formatter, fixed widths", ns_per_row( fixed_seconds ) );
+        print( "{:<40}{:>8.1f}\n", "Table_formatter, auto-sized widths", ns_per_row( auto_seconds ) );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,175 @@
+// Single pass `cppm::utf8` transcoding versus the two-pass pattern of calling
+// `WideCharToMultiByte` / `MultiByteToWideChar` first for the size and then for the conversion.
+// The two-pass code here is a portable stand-in for those Windows functions. First the
+// conversions with each SIMD level are checked against the scalar code, also for invalid input.
+// Build e.g. with `../build-scripts/unix/bash/build utf16-transcoding.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+
+namespace two_pass {
+    using   cppm::in_, cppm::now, cppm::fail;
+    using   std::string, std::u16string,                // <string>
+            std::string_view, std::u16string_view;      // <string_view>
+    using Byte = unsigned char;
+
+    // Returns the number of UTF-8 bytes, or -1 for invalid input, like the sizing call.
+    auto utf8_length_of( in_<u16string_view> s )
+        -> long
+    {
+        long n = 0;
+        for( size_t i = 0; i < s.size(); ++i ) {
+            const char32_t u = s[i];
+            if( u < 0x80 ) { n += 1; }
+            else if( u < 0x800 ) { n += 2; }
+            else if( u < 0xD800 or u >= 0xE000 ) { n += 3; }
+            else if( u < 0xDC00 and i + 1 < s.size() and (s[i + 1] & 0xFC00) == 0xDC00 ) { n += 4; ++i; }
+            else { return -1; }
+        }
+        return n;
+    }
+
+    auto utf8_from( in_<u16string_view> s )
+        -> string
+    {
+        const long n = utf8_length_of( s );
+        now( n >= 0 ) or fail( "Invalid UTF-16." );
+        auto result = string( n, '\0' );
+        auto out = reinterpret_cast<Byte*>( result.data() );
+        for( size_t i = 0; i < s.size(); ++i ) {
+            char32_t u = s[i];
+            if( u < 0x80 ) {
+                *out++ = Byte( u );
+            } else if( u < 0x800 ) {
+                *out++ = Byte( 0xC0 | (u >> 6) );  *out++ = Byte( 0x80 | (u & 0x3F) );
+            } else if( u < 0xD800 or u >= 0xE000 ) {
+                *out++ = Byte( 0xE0 | (u >> 12) );  *out++ = Byte( 0x80 | ((u >> 6) & 0x3F) );
+                *out++ = Byte( 0x80 | (u & 0x3F) );
+            } else {
+                u = 0x10000 + ((u - 0xD800) << 10) + (s[++i] - 0xDC00);
+                *out++ = Byte( 0xF0 | (u >> 18) );  *out++ = Byte( 0x80 | ((u >> 12) & 0x3F) );
+                *out++ = Byte( 0x80 | ((u >> 6) & 0x3F) );  *out++ = Byte( 0x80 | (u & 0x3F) );
+            }
+        }
+        return result;
+    }
+
+    // Returns the number of UTF-16 units, or -1 for invalid input. Not fully validating, which
+    // only favors this two-pass code.
+    auto utf16_length_of( in_<string_view> s )
+        -> long
+    {
+        long n = 0;
+        for( size_t i = 0; i < s.size(); ) {
+            const Byte b = s[i];
+            const int length = (b < 0x80? 1 : b < 0xC2? 0 : b < 0xE0? 2 : b < 0xF0? 3 : b < 0xF5? 4 : 0);
+            if( length == 0 or i + length > s.size() ) { return -1; }
+            for( int k = 1; k < length; ++k ) { if( (Byte( s[i + k] ) & 0xC0) != 0x80 ) { return -1; } }
+            n += (length == 4? 2 : 1);
+            i += length;
+        }
+        return n;
+    }
+
+    auto utf16_from( in_<string_view> s )
+        -> u16string
+    {
+        const long n = utf16_length_of( s );
+        now( n >= 0 ) or fail( "Invalid UTF-8." );
+        auto result = u16string( n, u'\0' );
+        char16_t* out = result.data();
+        for( size_t i = 0; i < s.size(); ) {
+            const Byte b = s[i];
+            const int length = (b < 0x80? 1 : b < 0xE0? 2 : b < 0xF0? 3 : 4);
+            char32_t code = (length == 1? b : b & (0x7F >> length));
+            for( int k = 1; k < length; ++k ) { code = (code << 6) | (Byte( s[i + k] ) & 0x3F); }
+            if( code < 0x10000 ) {
+                *out++ = char16_t( code );
+            } else {
+                *out++ = char16_t( 0xD800 + ((code - 0x10000) >> 10) );
+                *out++ = char16_t( 0xDC00 + ((code - 0x10000) & 0x3FF) );
+            }
+            i += length;
+        }
+        return result;
+    }
+}  // namespace two_pass
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Simd_level, cppm::Span, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string, std::u16string,            // <string>
+            std::string_view, std::u16string_view;  // <string_view>
+    namespace u8 = cppm::utf8;
+
+    template< class Func >
+    auto fails( const Func& f ) -> bool { try { f(); return false; } catch( ... ) { return true; } }
+
+    void check_conversions( const Simd_level::Enum level )
+    {
+        using S = u8::Transcoding_status;
+        const auto check_utf8 = [&]( in_<string_view> s, const S::Enum expected, const size_t expected_n_read ) {
+            auto buffer = u16string( u8::max_utf16_length_for_utf8( s.size() ), u'\0' );
+            const u8::Transcoding_result r = u8::to_utf16_using( level, s, Span<char16_t>( buffer ) );
+            now( r.status == expected and r.n_read == expected_n_read )
+                or fail( "to_utf16_using level {}: status {} at {}, expected {} at {}.",
+                    +level, +r.status, r.n_read, +expected, expected_n_read
+                    );
+            if( r.status != S::ok ) { return; }
+
+            const auto wide = u16string_view( buffer.data(), r.n_written );
+            auto bytes = string( u8::max_utf8_length_for_utf16( wide.size() ), '\0' );
+            const u8::Transcoding_result back = u8::to_utf8_using( level, wide, Span<char>( bytes ) );
+            now( back.status == S::ok and string_view( bytes.data(), back.n_written ) == s )
+                or fail( "to_utf8_using level {}: no round trip.", +level );
+            };
+
+        for( const auto& corpus: bench::corpora ) {
+            const string text = repeated_to_size( corpus.sample, 100'000 );
+            check_utf8( text, S::ok, text.size() );
+            now( u8::utf16_from( text ) == two_pass::utf16_from( text ) )
+                or fail( "utf16_from differs from the two-pass code for {}.", corpus.name );
+        }
+        const auto runs = string( 20'000, '\x80' );    // Continuation bytes only.
+        check_utf8( runs, S::invalid_input, 0 );
+        check_utf8( "abc \xE2\x82", S::invalid_input, 4 );
+        check_utf8( "caf\xE9", S::invalid_input, 3 );
+        check_utf8( string( 40'000, 'a' ) + runs, S::invalid_input, 40'000 );
+        now( fails( [&]{ u8::utf16_from( runs ); } ) and fails( [&]{ u8::utf16_from( "x" + runs ); } ) )
+            or fail( "utf16_from accepted a run of continuation bytes." );
+    }
+
+    void run()
+    {
+        for( const auto level: {Simd_level::avx2, Simd_level::sse4_2, Simd_level::none} ) { check_conversions( level ); }
+
+        const size_t    n_bytes     = 16'000'000;
+        const int       n_runs      = 10;
+
+        print( "{:<10} {:>22} {:>22}\n", "", "UTF-16 → UTF-8 MB/s", "UTF-8 → UTF-16 MB/s" );
+        print( "{:<10} {:>11}{:>11} {:>11}{:>11}\n", "Corpus", "1 pass", "2 pass", "1 pass", "2 pass" );
+        for( const auto& corpus: bench::corpora ) {
+            const string    text        = repeated_to_size( corpus.sample, n_bytes );
+            const u16string wide_text   = u8::utf16_from( text );
+            const size_t    n_in_16     = 2*wide_text.size();
+
+            const double t_u8_1 = best_seconds( n_runs, [&]{ sink = u8::utf8_from( wide_text ).size(); } );
+            const double t_u8_2 = best_seconds( n_runs, [&]{ sink = two_pass::utf8_from( wide_text ).size(); } );
+            const double t_16_1 = best_seconds( n_runs, [&]{ sink = u8::utf16_from( text ).size(); } );
+            const double t_16_2 = best_seconds( n_runs, [&]{ sink = two_pass::utf16_from( text ).size(); } );
+            print( "{:<10} {:>11.0f}{:>11.0f} {:>11.0f}{:>11.0f}\n",
+                corpus.name,
+                mb_per_second( n_in_16, t_u8_1 ), mb_per_second( n_in_16, t_u8_2 ),
+                mb_per_second( text.size(), t_16_1 ), mb_per_second( text.size(), t_16_2 )
+                );
+        }
+        print( "MB/s is for the input size, with SIMD level {}.\n", +cppm::simd_level() );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
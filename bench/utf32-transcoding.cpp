@@ -0,0 +1,159 @@
+// Bulk `cppm::utf8::to_utf32` and `from_utf32` into preallocated buffers, versus a simple
+// one code point at a time loop of the kind that one would otherwise write. First the conversions
+// with each SIMD level are checked against the simple loop, also for invalid input.
+// Build e.g. with `../build-scripts/unix/bash/build utf32-transcoding.cpp -O2`.
+#include "bench-support.hpp"
+
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+
+namespace simple {
+    using   cppm::in_;
+    using   std::string_view, std::u32string_view;      // <string_view>
+    using Byte = unsigned char;
+
+    // Returns the number of code points, or 0 for invalid input. Not fully validating.
+    auto to_utf32( in_<string_view> s, char32_t* const out )
+        -> size_t
+    {
+        char32_t* p = out;
+        for( size_t i = 0; i < s.size(); ) {
+            const Byte b = s[i];
+            const int length = (b < 0x80? 1 : b < 0xC2? 0 : b < 0xE0? 2 : b < 0xF0? 3 : b < 0xF5? 4 : 0);
+            if( length == 0 or i + length > s.size() ) { return 0; }
+            char32_t code = (length == 1? b : b & (0x7F >> length));
+            for( int k = 1; k < length; ++k ) {
+                const Byte c = s[i + k];
+                if( (c & 0xC0) != 0x80 ) { return 0; }
+                code = (code << 6) | (c & 0x3F);
+            }
+            *p++ = code;
+            i += length;
+        }
+        return size_t( p - out );
+    }
+
+    // Returns the number of bytes, or 0 for invalid input.
+    auto from_utf32( in_<u32string_view> s, char* const out )
+        -> size_t
+    {
+        auto p = reinterpret_cast<Byte*>( out );
+        for( const char32_t u: s ) {
+            if( u < 0x80 ) {
+                *p++ = Byte( u );
+            } else if( u < 0x800 ) {
+                *p++ = Byte( 0xC0 | (u >> 6) );  *p++ = Byte( 0x80 | (u & 0x3F) );
+            } else if( u < 0x10000 ) {
+                if( 0xD800 <= u and u < 0xE000 ) { return 0; }
+                *p++ = Byte( 0xE0 | (u >> 12) );  *p++ = Byte( 0x80 | ((u >> 6) & 0x3F) );
+                *p++ = Byte( 0x80 | (u & 0x3F) );
+            } else if( u < 0x110000 ) {
+                *p++ = Byte( 0xF0 | (u >> 18) );  *p++ = Byte( 0x80 | ((u >> 12) & 0x3F) );
+                *p++ = Byte( 0x80 | ((u >> 6) & 0x3F) );  *p++ = Byte( 0x80 | (u & 0x3F) );
+            } else {
+                return 0;
+            }
+        }
+        return size_t( p - reinterpret_cast<Byte*>( out ) );
+    }
+}  // namespace simple
+
+namespace app {
+    using   bench::best_seconds, bench::mb_per_second, bench::repeated_to_size, bench::sink;
+    using   cppm::in_, cppm::Simd_level, cppm::Span, cppm::now, cppm::fail;
+    using   fmt::print;
+    using   std::string, std::u32string,            // <string>
+            std::string_view, std::u32string_view;  // <string_view>
+    namespace u8 = cppm::utf8;
+
+    template< class Func >
+    auto fails( const Func& f ) -> bool { try { f(); return false; } catch( ... ) { return true; } }
+
+    void check_conversions( const Simd_level::Enum level )
+    {
+        using S = u8::Transcoding_status;
+        const auto check_utf8 = [&]( in_<string_view> s, const S::Enum expected, const size_t expected_n_read ) {
+            auto buffer = u32string( u8::max_utf32_length_for_utf8( s.size() ), U'\0' );
+            const u8::Transcoding_result r = u8::to_utf32_using( level, s, Span<char32_t>( buffer ) );
+            now( r.status == expected and r.n_read == expected_n_read )
+                or fail( "to_utf32_using level {}: status {} at {}, expected {} at {}.",
+                    +level, +r.status, r.n_read, +expected, expected_n_read
+                    );
+            if( r.status != S::ok ) { return; }
+
+            auto simple_buffer = u32string( s.size(), U'\0' );
+            const size_t n = simple::to_utf32( s, simple_buffer.data() );
+            now( u32string_view( buffer.data(), r.n_written ) == u32string_view( simple_buffer.data(), n ) )
+                or fail( "to_utf32_using level {}: differs from the simple loop.", +level );
+
+            const auto codes = u32string_view( buffer.data(), r.n_written );
+            auto bytes = string( u8::max_utf8_length_for_utf32( codes.size() ), '\0' );
+            const u8::Transcoding_result back = u8::from_utf32_using( level, codes, Span<char>( bytes ) );
+            now( back.status == S::ok and string_view( bytes.data(), back.n_written ) == s )
+                or fail( "from_utf32_using level {}: no round trip.", +level );
+            };
+        const auto check_utf32 = [&]( in_<u32string> s, const size_t expected_n_read ) {
+            auto bytes = string( u8::max_utf8_length_for_utf32( s.size() ), '\0' );
+            const u8::Transcoding_result r = u8::from_utf32_using( level, s, Span<char>( bytes ) );
+            now( r.status == S::invalid_input and r.n_read == expected_n_read )
+                or fail( "from_utf32_using level {}: status {} at {} for invalid input.", +level, +r.status, r.n_read );
+            };
+
+        for( const auto& corpus: bench::corpora ) {
+            const string text = repeated_to_size( corpus.sample, 100'000 );
+            check_utf8( text, S::ok, text.size() );
+        }
+        const auto runs = string( 20'000, '\x80' );    // Continuation bytes only.
+        check_utf8( runs, S::invalid_input, 0 );
+        check_utf8( "abc \xE2\x82", S::invalid_input, 4 );
+        check_utf8( "caf\xE9", S::invalid_input, 3 );
+        check_utf8( string( 40'000, 'a' ) + runs, S::invalid_input, 40'000 );
+        check_utf32( u32string( 1000, U'a' ) + char32_t( 0xD800 ), 1000 );
+        check_utf32( u32string( 1000, U'я' ) + char32_t( 0x110000 ), 1000 );
+        now( fails( [&]{ u8::utf32_from( runs ); } ) and fails( [&]{ u8::utf32_from( "x" + runs ); } ) )
+            or fail( "utf32_from accepted a run of continuation bytes." );
+        now( fails( [&]{ u8::utf8_from( u32string( 20'000, char32_t( 0xDC00 ) ) ); } ) )
+            or fail( "utf8_from accepted surrogates in UTF-32." );
+    }
+
+    void run()
+    {
+        for( const auto level: {Simd_level::avx2, Simd_level::sse4_2, Simd_level::none} ) { check_conversions( level ); }
+
+        const size_t    n_bytes     = 16'000'000;
+        const int       n_runs      = 10;
+
+        print( "{:<10} {:>22} {:>22}\n", "", "UTF-8 → UTF-32 MB/s", "UTF-32 → UTF-8 MB/s" );
+        print( "{:<10} {:>11}{:>11} {:>11}{:>11}\n", "Corpus", "cppm", "simple", "cppm", "simple" );
+        for( const auto& corpus: bench::corpora ) {
+            const string    text        = repeated_to_size( corpus.sample, n_bytes );
+            const u32string code_points = u8::utf32_from( text );
+            auto            buffer_32   = u32string( u8::max_utf32_length_for_utf8( text.size() ), U'\0' );
+            auto            buffer_8    = string( u8::max_utf8_length_for_utf32( code_points.size() ), '\0' );
+
+            const double t_32_cppm = best_seconds( n_runs, [&]{
+                sink = u8::to_utf32( text, Span<char32_t>( buffer_32 ) ).n_written;
+                } );
+            const double t_32_simple = best_seconds( n_runs, [&]{
+                sink = simple::to_utf32( text, buffer_32.data() );
+                } );
+            const double t_8_cppm = best_seconds( n_runs, [&]{
+                sink = u8::from_utf32( code_points, Span<char>( buffer_8 ) ).n_written;
+                } );
+            const double t_8_simple = best_seconds( n_runs, [&]{
+                sink = simple::from_utf32( code_points, buffer_8.data() );
+                } );
+            print( "{:<10} {:>11.0f}{:>11.0f} {:>11.0f}{:>11.0f}\n",
+                corpus.name,
+                mb_per_second( text.size(), t_32_cppm ), mb_per_second( text.size(), t_32_simple ),
+                mb_per_second( text.size(), t_8_cppm ), mb_per_second( text.size(), t_8_simple )
+                );
+        }
+        print( "MB/s is for the UTF-8 size, with SIMD level {}.\n", +cppm::simd_level() );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,39 @@
+// C++17 code. As "fixed-width-fields.cpp", but with the fields laid out by a `cppm::Table_formatter`,
+// which pads by display width, instead of by hand. The wide 日本国 characters then get the same
+// field width as the others, and the codes below them stay aligned.
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace app {
+    using   cppm::Column_alignment, cppm::Table_column, cppm::Table_formatter, cppm::utf8::code_points;
+    using   std::string,            // <string>
+            std::string_view,       // <string_view>
+            std::vector;            // <vector>
+
+    void run()
+    {
+        const auto s = string_view( "日本国 кошка’s FTW!" );
+
+        vector<string_view> characters;
+        vector<string> codes;
+        for( auto it = code_points( s ).begin(); it != code_points( s ).end(); ++it ) {
+            characters.push_back( it.sequence() );
+            codes.push_back( fmt::format( "{:X}", unsigned( *it ) ) );
+        }
+        const vector<string_view> code_cells( codes.begin(), codes.end() );
+
+        Table_formatter table(
+            vector<Table_column>( characters.size(), Table_column{5, Column_alignment::right} ),
+            []( const string_view text ) { fmt::print( "{}", text ); },
+            ""
+            );
+        table.add_row( characters );
+        table.add_row( code_cells );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,55 @@
+// C++17 code. As "pascal-triangle.colored.cpp", but with the colors added as each number is
+// formatted, by a `cppm::Styled_writer`, instead of by parsing a formatted line back to numbers.
+// Field widths then apply to the numbers only, and there's one buffer for the whole triangle.
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace app {
+    using   cppm::Ansi_color, cppm::Styled_writer, cppm::fg;
+    using   std::string,            // <string>
+            std::swap,              // <utility>
+            std::vector;            // <vector>
+
+    constexpr auto is_odd( const int v ) -> bool { return (v % 2 == 1); }
+
+    auto binomial( const int n, const int r )
+        -> int
+    {
+        int result = 1;
+        for( int k = 0; k < r; ++k ) { result = result*(n - k)/(k + 1); }
+        return result;
+    }
+
+    void run()
+    {
+        const int n             = 16;
+        const int max_digits    = int( fmt::formatted_size( "{}", binomial( n - 1, n/2 ) ) );
+        const int field_size    = max_digits + 1;
+
+        Styled_writer out( 8*1024 );
+        vector<int> current;
+        vector<int> previous;
+        for( int y = 0; y < n; ++y ) {
+            current.clear();
+            current.push_back( 1 );
+            for( int x = 1; x < y; ++x ) { current.push_back( previous[x - 1] + previous[x] ); }
+            if( y > 0 ) { current.push_back( 1 ); }
+
+            const int indent = (n - y - 1)*field_size/2;       // Centering.
+            out.write( string( size_t( indent ), ' ' ) );
+            for( const int v: current ) {
+                out.print( fg( is_odd( v )? Ansi_color::yellow : Ansi_color::blue ), "{:^{}}", v, field_size );
+            }
+            out.reset_style();
+            out.write( "\n" );
+            swap( current, previous );
+        }
+        fmt::print( "{}", out.text() );
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -0,0 +1,26 @@
+// Using a `cppm::Mapped_file` with a `cppm::Line_reader`: lines are views of the mapped file.
+#include <cppm.hpp>
+#include <fmt/core.h>
+
+#include <assert.h>
+#include <string_view>
+
+namespace app {
+    using   cppm::os_api_is_utf8,
+            cppm::Line_reader, cppm::Line_validation, cppm::Mapped_file, cppm::Path;
+    using   fmt::print;                     // <fmt/core.h>
+    using   std::string_view;               // <string_view>
+
+    void run()
+    {
+        assert( os_api_is_utf8() or !"In Windows use a manifest for UTF-8 as ANSI codepage." );
+
+        const auto poem = Mapped_file( Path( "data/æøå-poem.txt" ) );      // Fails if it can't.
+        auto lines = Line_reader( poem.text(), Line_validation::utf8 );
+        for( string_view line; lines.next( line ); ) {
+            print( "{}\n", line );
+        }
+    }
+}  // namespace app
+
+auto main() -> int { return cppm::with_exceptions_displayed( app::run ); }
@@ -1,5 +1,7 @@
 #pragma once
 #include <cppm/basics.hpp>
+#include <cppm/codepages.hpp>
 #include <cppm/filesystem.hpp>
 #include <cppm/stdlib_workarounds.hpp>
+#include <cppm/text_styling.hpp>
 #include <cppm/utf8.hpp>
@@ -1,4 +1,5 @@
 #pragma once
+#include <cppm/basics/bits.hpp>
 #include <cppm/basics/Byte.hpp>
 #include <cppm/basics/class_kinds.hpp>
 #include <cppm/basics/collection-support.hpp>
@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>         // uint64_t
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#   include <intrin.h>      // _BitScanForward64
+#endif
+
+namespace cppm {
+    inline namespace bits {
+        // Index of the least significant 1-bit. `bits` must be non-zero.
+        inline auto n_trailing_zeros( const uint64_t bits ) noexcept
+            -> int
+        {
+            #if defined( _MSC_VER ) && !defined( __clang__ )
+                unsigned long index;
+                _BitScanForward64( &index, bits );
+                return static_cast<int>( index );
+            #else
+                return __builtin_ctzll( bits );
+            #endif
+        }
+    }  // inline namespace bits
+}  // namespace cppm
@@ -1,3 +1,4 @@
 #pragma once
 #include <cppm/basics/collection-support/CPPM_ITS_ALL.hpp>
 #include <cppm/basics/collection-support/size_functions.hpp>
+#include <cppm/basics/collection-support/Span.hpp>
@@ -0,0 +1,53 @@
+#pragma once
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace cppm {
+    using   std::enable_if_t, std::is_convertible_v, std::remove_pointer_t,     // <type_traits>
+            std::declval;                       // <utility>
+
+    inline namespace spans {
+        // A minimal C++17 substitute for C++20 `std::span` with dynamic extent.
+        template< class Item >
+        class Span
+        {
+            Item*       m_data;
+            size_t      m_size;
+
+            template< class Collection >
+            using Item_pointer_of_ = decltype( std::data( declval<Collection&>() ) );
+
+        public:
+            constexpr Span() noexcept: m_data(), m_size() {}
+            constexpr Span( Item* const p, const size_t n ) noexcept: m_data( p ), m_size( n ) {}
+            constexpr Span( Item* const first, Item* const beyond ) noexcept: Span( first, size_t( beyond - first ) ) {}
+
+            template< class Collection,
+                class = enable_if_t< is_convertible_v<
+                    remove_pointer_t<Item_pointer_of_<Collection>>(*)[], Item(*)[]
+                    > >
+                >
+            constexpr Span( Collection& c ) noexcept: Span( std::data( c ), std::size( c ) ) {}
+
+            constexpr auto data() const noexcept -> Item* { return m_data; }
+            constexpr auto size() const noexcept -> size_t { return m_size; }
+            constexpr auto is_empty() const noexcept -> bool { return m_size == 0; }
+
+            constexpr auto begin() const noexcept -> Item* { return m_data; }
+            constexpr auto end() const noexcept -> Item* { return m_data + m_size; }
+            constexpr auto operator[]( const size_t i ) const noexcept -> Item& { return m_data[i]; }
+
+            constexpr auto first( const size_t n ) const noexcept -> Span { return {m_data, n}; }
+            constexpr auto subspan( const size_t offset ) const noexcept -> Span { return {m_data + offset, m_size - offset}; }
+            constexpr auto subspan( const size_t offset, const size_t n ) const noexcept -> Span { return {m_data + offset, n}; }
+        };
+
+        template< class Collection >
+        Span( Collection& ) -> Span<remove_pointer_t<decltype( std::data( declval<Collection&>() ) )>>;
+    }  // inline namespace spans
+}  // namespace cppm
@@ -1,3 +1,6 @@
 #pragma once
+#include <cppm/basics/environment/Console_sink.hpp>
 #include <cppm/basics/environment/console.hpp>
+#include <cppm/basics/environment/cpu.hpp>
 #include <cppm/basics/environment/os.hpp>
+#include <cppm/basics/environment/startup_trace.hpp>
@@ -0,0 +1,85 @@
+// Implementation include.
+// The buffer and the caller's text are seen as one sequence of bytes, which is split where the
+// write ends: the part before is written with one gathering call, and the part after, which is at
+// most a buffer full, is moved to the start of the buffer.
+#include <cppm/basics/environment/Console_sink.hpp>
+#include <cppm/basics/environment/console.hpp>      // is_a_console
+#include <cppm/basics/Byte.hpp>
+#include <cppm/utf8/code_points.hpp>                // incomplete_tail_length
+
+#include <string.h>         // memcpy, memmove
+
+#include <algorithm>
+
+namespace cppm::impl {
+    using   std::max, std::min;     // <algorithm>
+
+    // The length of an incomplete UTF-8 sequence at the end of `a` followed by `b`.
+    inline auto incomplete_tail_length_of( in_<string_view> a, in_<string_view> b ) noexcept
+        -> size_t
+    {
+        Byte last[3];
+        const size_t n_from_b = min<size_t>( 3, b.size() );
+        const size_t n_from_a = min<size_t>( 3 - n_from_b, a.size() );
+        memcpy( last, a.data() + a.size() - n_from_a, n_from_a );
+        memcpy( last + n_from_a, b.data() + b.size() - n_from_b, n_from_b );
+        return size_t( utf8::impl::incomplete_tail_length( last, last + n_from_a + n_from_b ) );
+    }
+}  // namespace cppm::impl
+
+cppm::Console_sink::~Console_sink()
+{
+    try {
+        send( m_size, "" );
+    } catch( ... ) {
+        // Nothing to do about it.
+    }
+}
+
+cppm::Console_sink::Console_sink( FILE* const stream, const size_t capacity, const Flush_policy::Enum policy ):
+    m_handle( impl::console_handle_of( stream ) ),
+    m_flushes_on_newline( policy == Flush_policy::on_newline
+        or (policy == Flush_policy::automatic and is_a_console( stream ))
+        ),
+    m_buffer(),
+    m_capacity( impl::max<size_t>( capacity, 16 ) ),    // Room for an incomplete sequence + more.
+    m_size( 0 ),
+    m_n_system_calls( 0 ),
+    m_formatted()
+{
+    m_buffer.reset( new char[m_capacity] );
+    fflush( stream );       // Earlier output via the C stream comes first.
+}
+
+// Writes the first `n_bytes` of the buffered bytes followed by `s`, and buffers the rest.
+void cppm::Console_sink::send( const size_t n_bytes, in_<string_view> s )
+{
+    const size_t n_from_buffer = impl::min( n_bytes, m_size );
+    const size_t n_from_s = n_bytes - n_from_buffer;
+    if( n_bytes > 0 ) {
+        m_n_system_calls += size_t( impl::write_to_console_handle(
+            m_handle, string_view( m_buffer.get(), n_from_buffer ), s.substr( 0, n_from_s )
+            ) );
+    }
+    const size_t n_kept_from_buffer = m_size - n_from_buffer;
+    memmove( m_buffer.get(), m_buffer.get() + n_from_buffer, n_kept_from_buffer );
+    memcpy( m_buffer.get() + n_kept_from_buffer, s.data() + n_from_s, s.size() - n_from_s );
+    m_size = n_kept_from_buffer + s.size() - n_from_s;
+}
+
+// Called when `s` doesn't fit, or when it has a newline and the policy is to flush on newline.
+void cppm::Console_sink::write_through( in_<string_view> s )
+{
+    const auto buffered = string_view( m_buffer.get(), m_size );
+    const size_t n_total = m_size + s.size();
+    const size_t n_bytes = (0?0
+        : n_total > m_capacity?     n_total - impl::incomplete_tail_length_of( buffered, s )
+        :                           m_size + s.rfind( '\n' ) + 1
+        );
+    send( n_bytes, s );
+}
+
+void cppm::Console_sink::flush()
+{
+    send( m_size - impl::incomplete_tail_length_of( string_view( m_buffer.get(), m_size ), "" ), "" );
+}
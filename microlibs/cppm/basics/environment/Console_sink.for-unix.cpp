@@ -0,0 +1,43 @@
+// Implementation include.
+#include <cppm/basics/environment/Console_sink.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+
+#include <errno.h>
+#include <stdio.h>          // fileno
+#include <string.h>         // strerror
+#include <sys/uio.h>        // writev, iovec
+
+auto cppm::impl::console_handle_of( FILE* const f )
+    -> intptr_t
+{ return fileno( f ); }
+
+// `writev` can write less than asked, e.g. to a pipe, so the rest is written by further calls.
+auto cppm::impl::write_to_console_handle( const intptr_t handle, in_<string_view> a, in_<string_view> b )
+    -> int
+{
+    iovec parts[2] = {
+        { const_cast<char*>( a.data() ), a.size() },
+        { const_cast<char*>( b.data() ), b.size() }
+    };
+    iovec* first = parts;
+    int n_parts = 2;
+    int n_calls = 0;
+    for( ;; ) {
+        while( n_parts > 0 and first->iov_len == 0 ) { ++first;  --n_parts; }
+        if( n_parts == 0 ) { return n_calls; }
+
+        ++n_calls;
+        const ssize_t n_written = writev( int( handle ), first, n_parts );
+        if( n_written < 0 ) {
+            if( errno == EINTR ) { continue; }
+            fail( "Failed to write to the console: {}.", strerror( errno ) );
+        }
+        for( size_t n_left = size_t( n_written ); n_left > 0; ) {
+            const size_t n = (n_left < first->iov_len? n_left : first->iov_len);
+            first->iov_base = static_cast<char*>( first->iov_base ) + n;
+            first->iov_len -= n;
+            n_left -= n;
+            if( first->iov_len == 0 and n_parts > 1 ) { ++first;  --n_parts; }
+        }
+    }
+}
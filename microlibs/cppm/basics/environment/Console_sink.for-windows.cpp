@@ -0,0 +1,40 @@
+// Implementation include.
+// There's no gathering write for console and pipe handles, so the parts are written in turn.
+#include <cppm/basics/environment/Console_sink.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+
+#include <winapi/wrapped/windows-h.wide.hpp>
+
+#include <io.h>             // _get_osfhandle, _fileno
+
+#include <algorithm>
+
+namespace cppm::impl {
+    using   std::min;           // <algorithm>
+
+    inline auto write_all_to_console_handle( const HANDLE handle, in_<string_view> s )
+        -> int
+    {
+        int n_calls = 0;
+        for( size_t i = 0; i < s.size(); ) {
+            const DWORD n_to_write = DWORD( min<size_t>( s.size() - i, 1 << 30 ) );
+            DWORD n_written = 0;
+            ++n_calls;
+            now( !!WriteFile( handle, s.data() + i, n_to_write, &n_written, nullptr ) )
+                or fail( "Failed to write to the console: error {}.", GetLastError() );
+            i += n_written;
+        }
+        return n_calls;
+    }
+}  // namespace cppm::impl
+
+auto cppm::impl::console_handle_of( FILE* const f )
+    -> intptr_t
+{ return _get_osfhandle( _fileno( f ) ); }
+
+auto cppm::impl::write_to_console_handle( const intptr_t handle, in_<string_view> a, in_<string_view> b )
+    -> int
+{
+    const auto h = reinterpret_cast<HANDLE>( handle );
+    return write_all_to_console_handle( h, a ) + write_all_to_console_handle( h, b );
+}
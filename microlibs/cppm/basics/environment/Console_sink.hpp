@@ -0,0 +1,96 @@
+#pragma once
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <fmt/core.h>
+#include <fmt/format.h>         // fmt::memory_buffer
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // intptr_t
+#include <string.h>         // memchr, memcpy
+
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+namespace cppm {
+    using   std::FILE,                      // <cstdio>
+            std::unique_ptr,                // <memory>
+            std::string_view,               // <string_view>
+            std::forward;                   // <utility>
+
+    namespace impl {
+        extern auto console_handle_of( FILE* f ) -> intptr_t;
+
+        // Writes `a` then `b`, with e.g. `writev` in Unix, and `fail`s on errors. Returns the number
+        // of system calls.
+        extern auto write_to_console_handle( intptr_t handle, in_<string_view> a, in_<string_view> b ) -> int;
+    }  // namespace impl
+
+    inline namespace environment {
+        struct Flush_policy{ enum Enum{ automatic, on_newline, when_full }; };
+
+        // Buffered UTF-8 output to e.g. `stdout`, with far fewer system calls than `fmt::print` or
+        // `cout` for many small writes. `automatic` flushes on newline when the stream is a console,
+        // so that lines appear as they're written, and otherwise only when the buffer is full. Text
+        // that doesn't fit is written directly from the caller's memory, without copying. A flush
+        // never splits a UTF-8 sequence: an incomplete sequence at the end is kept for the next.
+        //
+        // Use it while a `Console_usage` is alive, which in Windows sets the console to UTF-8, e.g.
+        // as its `out()`, and don't mix it with other output to the same stream unless that's after
+        // a `flush`.
+        class Console_sink:
+            public No_copy_or_move
+        {
+            intptr_t            m_handle;
+            bool                m_flushes_on_newline;
+            unique_ptr<char[]>  m_buffer;
+            size_t              m_capacity;
+            size_t              m_size;
+            size_t              m_n_system_calls;
+            fmt::memory_buffer  m_formatted;
+
+            void send( size_t n_bytes, in_<string_view> s );
+            void write_through( in_<string_view> s );
+
+        public:
+            static constexpr size_t default_capacity = 64*1024;
+
+            ~Console_sink();        // Writes all buffered bytes, ignoring errors.
+
+            explicit Console_sink(
+                FILE*               stream      = stdout,
+                size_t              capacity    = default_capacity,
+                Flush_policy::Enum  policy      = Flush_policy::automatic
+                );
+
+            void write( in_<string_view> s )
+            {
+                const bool fits = (m_size + s.size() <= m_capacity);
+                if( fits and not (m_flushes_on_newline and memchr( s.data(), '\n', s.size() )) ) {
+                    memcpy( m_buffer.get() + m_size, s.data(), s.size() );
+                    m_size += s.size();
+                } else {
+                    write_through( s );
+                }
+            }
+
+            template< class... Args >
+            void print( fmt::format_string<Args...> format, Args&&... args )
+            {
+                m_formatted.clear();
+                fmt::format_to( std::back_inserter( m_formatted ), format, forward<Args>( args )... );
+                write( string_view( m_formatted.data(), m_formatted.size() ) );
+            }
+
+            void flush();           // Except an incomplete UTF-8 sequence at the end.
+
+            auto flushes_on_newline() const noexcept -> bool { return m_flushes_on_newline; }
+            auto capacity() const noexcept -> size_t { return m_capacity; }
+            auto n_buffered() const noexcept -> size_t { return m_size; }
+            auto n_system_calls() const noexcept -> size_t { return m_n_system_calls; }
+        };
+    }  // inline namespace environment
+}  // namespace cppm
@@ -13,11 +13,14 @@ static_assert( sizeof( cppm::Console_config ), "OS details header should define
 
 #include <cppm/basics/class_kinds/No_copy_or_move.hpp>
 #include <cppm/basics/environment/Console_kind-Enum.hpp>
+#include <cppm/basics/environment/Console_sink.hpp>
+#include <cppm/basics/environment/startup_trace.hpp>
 #include <cppm/basics/exception_handling/now_and_fail.hpp>
 #include <cppm/utf8/encoding_assumption_checking.hpp>
 
 #include <cstdio>
 #include <optional>
+#include <type_traits>
 
 namespace cppm {
     using   std::FILE,          // <cstdio>
@@ -35,7 +38,7 @@ namespace cppm {
             -> Console_kind::Enum
         {
             // Cached console kind info, assuming the process doesn't create or remove a console.
-            static const Console_kind::Enum     the_console_kind = get_console_kind();
+            static const Console_kind::Enum     the_console_kind = impl::traced_probe( "console_kind", get_console_kind );
             return the_console_kind;
         }
 
@@ -60,16 +63,29 @@ namespace cppm {
                 or fail( "This program requires a console." );
         }
 
+        // `out()` is a buffered `stdout` sink, created on first use. It's destroyed before the
+        // console config, so buffered text is written while the console is still set to UTF-8.
         class Console_usage:
             public No_copy_or_move
         {
             optional<Console_config>    m_config;
+            optional<Console_sink>      m_out;
 
         public:
             Console_usage()
             {
                 assert_utf8_literals();
-                if( this_process_has_a_console() ) { m_config.emplace(); }
+                // In Unix there's nothing to configure, so the console isn't probed until asked about.
+                if constexpr( not std::is_empty_v<Console_config> ) {
+                    if( this_process_has_a_console() ) { m_config.emplace(); }
+                }
+            }
+
+            auto out()
+                -> Console_sink&
+            {
+                if( not m_out ) { m_out.emplace(); }
+                return *m_out;
             }
         };
     }  // inline namespace environment
@@ -0,0 +1,84 @@
+#pragma once
+#include <cppm/basics/environment/startup_trace.hpp>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#   define CPPM_CPU_IS_X86 true
+#else
+#   define CPPM_CPU_IS_X86 false
+#endif
+
+// `CPPM_TARGET` lets a function use instructions beyond the compiler's baseline, e.g. AVX2,
+// so that the SIMD kernels can be selected at run time. MSVC needs no such annotation.
+#if CPPM_CPU_IS_X86 && (defined( __GNUC__ ) || defined( __clang__ ))
+#   define CPPM_TARGET( isa_spec )  __attribute__(( target( isa_spec ) ))
+#else
+#   define CPPM_TARGET( isa_spec )
+#endif
+
+#define CPPM_TARGET_SSE4_2  CPPM_TARGET( "sse4.2" )
+#define CPPM_TARGET_AVX2    CPPM_TARGET( "avx2,bmi,bmi2" )
+#define CPPM_TARGET_AVX512  CPPM_TARGET( "avx512f,avx512bw,avx2,bmi,bmi2" )
+
+#if CPPM_CPU_IS_X86
+#   if defined( _MSC_VER ) && !defined( __clang__ )
+#       include <intrin.h>      // __cpuid, __cpuidex, _xgetbv
+#   endif
+#   include <immintrin.h>       // Intrinsics for the kernels, and `_xgetbv`.
+#endif
+
+namespace cppm {
+    inline namespace environment {
+        // `sse4_2` also implies SSSE3 and SSE4.1, and `avx512` here means AVX-512F + AVX-512BW.
+        struct Simd_level{ enum Enum{ none, sse4_2, avx2, avx512, _ }; };
+    }  // inline namespace environment
+
+    namespace impl {
+        inline auto detect_simd_level()
+            -> Simd_level::Enum
+        {
+            #if !CPPM_CPU_IS_X86
+                return Simd_level::none;
+            #elif defined( __GNUC__ ) || defined( __clang__ )
+                __builtin_cpu_init();   // Checks also that the OS saves the AVX register state.
+                return (0?Simd_level::none
+                    : __builtin_cpu_supports( "avx512bw" ) and __builtin_cpu_supports( "avx512f" )
+                                                            ? Simd_level::avx512
+                    : __builtin_cpu_supports( "avx2" )      ? Simd_level::avx2
+                    : __builtin_cpu_supports( "sse4.2" )    ? Simd_level::sse4_2
+                    :                                         Simd_level::none
+                    );
+            #else
+                int regs[4] = {};       // eax, ebx, ecx, edx
+                __cpuid( regs, 0 );
+                const int max_leaf = regs[0];
+                __cpuid( regs, 1 );
+                const bool has_sse4_2   = (regs[2] & (1 << 20));
+                const bool has_osxsave  = (regs[2] & (1 << 27));
+                if( not has_sse4_2 ) { return Simd_level::none; }
+                if( not has_osxsave or max_leaf < 7 ) { return Simd_level::sse4_2; }
+
+                const auto xcr0 = _xgetbv( 0 );
+                const bool os_has_avx       = ((xcr0 & 0x06) == 0x06);
+                const bool os_has_avx512    = ((xcr0 & 0xE6) == 0xE6);
+                __cpuidex( regs, 7, 0 );
+                const bool has_avx2         = (regs[1] & (1 << 5));
+                const bool has_avx512       = (regs[1] & (1 << 16)) and (regs[1] & (1 << 30));
+                return (0?Simd_level::none
+                    : os_has_avx512 and has_avx512  ? Simd_level::avx512
+                    : os_has_avx and has_avx2       ? Simd_level::avx2
+                    :                                 Simd_level::sse4_2
+                    );
+            #endif
+        }
+    }  // namespace impl
+
+    inline namespace environment {
+        inline auto simd_level()
+            -> Simd_level::Enum
+        {
+            // Cached, the CPU doesn't change during the process' lifetime.
+            static const Simd_level::Enum   the_level = impl::traced_probe( "simd_level", impl::detect_simd_level );
+            return the_level;
+        }
+    }  // inline namespace environment
+}  // namespace cppm
@@ -0,0 +1,44 @@
+#pragma once
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <fmt/core.h>
+
+#include <stdio.h>          // stderr
+#include <stdlib.h>         // getenv
+#include <string.h>         // strcmp
+
+#include <chrono>
+
+namespace cppm {
+    inline namespace environment {
+        // With the environment variable `CPPM_STARTUP_TRACE` set to other than "" or "0", the time
+        // of each environment probe, e.g. for the console kind, is written to `stderr` when it's
+        // first done. The probes are done at most once, and only when their result is first used.
+        inline auto startup_trace_is_enabled()
+            -> bool
+        {
+            static const bool the_value = []() -> bool {
+                const char* const value = getenv( "CPPM_STARTUP_TRACE" );
+                return value and strcmp( value, "" ) != 0 and strcmp( value, "0" ) != 0;
+                }();
+            return the_value;
+        }
+    }  // inline namespace environment
+
+    namespace impl {
+        template< class Probe >
+        auto traced_probe( const char* const name, in_<Probe> probe )
+            -> decltype( probe() )
+        {
+            if( not startup_trace_is_enabled() ) { return probe(); }
+
+            namespace chrono = std::chrono;
+            const auto start = chrono::steady_clock::now();
+            const auto result = probe();
+            const auto stop = chrono::steady_clock::now();
+            const auto ns = chrono::duration_cast<chrono::nanoseconds>( stop - start ).count();
+            fmt::print( stderr, "cppm startup trace: {:<20} {:>10} ns\n", name, ns );
+            return result;
+        }
+    }  // namespace impl
+}  // namespace cppm
@@ -1,3 +1,4 @@
 #pragma once
 #include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/basics/exception_handling/Result.hpp>
 #include <cppm/basics/exception_handling/Scope_guard.hpp>
@@ -0,0 +1,129 @@
+#pragma once
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <fmt/core.h>
+
+#include <stddef.h>         // size_t
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace cppm {
+    using   std::string,                            // <string>
+            std::string_view,                       // <string_view>
+            std::move,                              // <utility>
+            std::variant, std::get_if;              // <variant>
+
+    inline namespace exception_handling {
+        // A static description of a kind of failure, e.g.
+        //
+        //     inline constexpr Failure_kind invalid_utf8 = { "invalid_utf8", "Invalid UTF-8 at byte offset {}." };
+        //
+        // The message format has at most one `{}`, for the byte offset. Declare it `inline` in a header
+        // so that all translation units share one object. Kinds are identified by name anyway.
+        struct Failure_kind
+        {
+            string_view     name;
+            string_view     message_format;
+        };
+
+        // A failure is just a kind and an offset, so that creating and passing it on is cheap. The
+        // message is only formatted when asked for.
+        struct Failure
+        {
+            const Failure_kind*     kind;
+            size_t                  offset;
+
+            auto is( in_<Failure_kind> a_kind ) const noexcept
+                -> bool
+            { return kind == &a_kind or kind->name == a_kind.name; }
+
+            auto message() const -> string { return fmt::format( fmt::runtime( kind->message_format ), offset ); }
+        };
+
+        // The `Failure` refers to `kind`, which therefore must be static.
+        constexpr auto failure( in_<Failure_kind> kind, const size_t offset = 0 ) noexcept
+            -> Failure
+        { return {&kind, offset}; }
+
+        auto failure( const Failure_kind&&, size_t = 0 ) -> Failure = delete;
+
+        // Either a value or a `Failure`. A function that returns a `Result` reports failure as e.g.
+        //
+        //     if( not now( is_valid ) ) { return failure( invalid_utf8, i ); }
+        //
+        // and a caller that wants an exception instead uses `value()`, or `now( r ) or fail( r.failure() )`.
+        template< class Value >
+        class Result
+        {
+            variant<Value, Failure>     m_state;
+
+        public:
+            Result( Value value ): m_state( move( value ) ) {}
+            Result( in_<Failure> a_failure ): m_state( a_failure ) {}
+
+            auto is_ok() const noexcept -> bool { return m_state.index() == 0; }
+            explicit operator bool() const noexcept { return is_ok(); }
+
+            auto failure() const noexcept -> const Failure& { return *get_if<Failure>( &m_state ); }
+
+            auto operator*() const& noexcept -> const Value& { return *get_if<Value>( &m_state ); }
+            auto operator->() const noexcept -> const Value* { return get_if<Value>( &m_state ); }
+
+            // These `fail` with the formatted message when there's no value.
+            auto value() const& -> const Value&;
+            auto value() && -> Value;
+
+            auto value_or( Value other ) const& -> Value { return (is_ok()? **this : move( other )); }
+        };
+
+        template<>
+        class Result<void>
+        {
+            Failure     m_failure;      // `kind` is `nullptr` for success.
+
+        public:
+            Result() noexcept: m_failure{nullptr, 0} {}
+            Result( in_<Failure> a_failure ) noexcept: m_failure( a_failure ) {}
+
+            auto is_ok() const noexcept -> bool { return m_failure.kind == nullptr; }
+            explicit operator bool() const noexcept { return is_ok(); }
+
+            auto failure() const noexcept -> const Failure& { return m_failure; }
+        };
+    }  // inline namespace exception_handling
+
+    inline namespace now_and_fail {
+        template< class Value >
+        constexpr auto now( in_<Result<Value>> r ) noexcept
+            -> bool
+        { return r.is_ok(); }
+
+        [[noreturn]]
+        inline auto fail( in_<Failure> a_failure )
+            -> bool
+        {
+            throw runtime_error( a_failure.message() );
+            for( ;; ) {}        // Should never get here. Also, avoid g++ silly-warning.
+        }
+    }  // inline namespace now_and_fail
+
+    template< class Value >
+    auto Result<Value>::value() const&
+        -> const Value&
+    {
+        if( not is_ok() ) { fail( failure() ); }
+        return **this;
+    }
+
+    template< class Value >
+    auto Result<Value>::value() &&
+        -> Value
+    {
+        if( not is_ok() ) { fail( failure() ); }
+        return move( *get_if<Value>( &m_state ) );
+    }
+}  // namespace cppm
@@ -1,35 +1,39 @@
 #pragma once
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
 
-#include <functional>
+#include <utility>
 
 namespace cppm {
-    using   std::function;          // <functional>
-
-    namespace impl {
-        struct Scope_guard_base:
-            public No_copy_or_move
-        {
-            function<void()> m_cleanup;
-            void dismiss() { m_cleanup = []{}; }
-            ~Scope_guard_base() { m_cleanup(); }
-            Scope_guard_base( function<void()> cleanup ): m_cleanup( move( cleanup ) ) {}
-        };
-    }  // namespace impl
+    using   std::move;              // <utility>
 
     inline namespace exception_handling {
+        // The cleanup, typically a lambda, is stored inline and called directly, so that a guard
+        // doesn't allocate and usually compiles to just the cleanup code. The type is deduced:
+        //
+        //     const Scope_guard closing( [&]{ close( fd ); } );
+        template< class Cleanup >
         class Scope_guard:
-            private impl::Scope_guard_base
+            public No_copy_or_move
         {
+            Cleanup     m_cleanup;
+
         public:
-            using impl::Scope_guard_base::Scope_guard_base;     // Inherit the constructor.
+            ~Scope_guard() { m_cleanup(); }
+            Scope_guard( Cleanup cleanup ): m_cleanup( move( cleanup ) ) {}
         };
 
+        template< class Cleanup >
         class Dismissable_scope_guard:
-            private impl::Scope_guard_base
+            public No_copy_or_move
         {
+            Cleanup     m_cleanup;
+            bool        m_is_dismissed;
+
         public:
-            using impl::Scope_guard_base::Scope_guard_base;     // Inherit the constructor.
-            using impl::Scope_guard_base::dismiss;
+            ~Dismissable_scope_guard() { if( not m_is_dismissed ) { m_cleanup(); } }
+            Dismissable_scope_guard( Cleanup cleanup ): m_cleanup( move( cleanup ) ), m_is_dismissed( false ) {}
+
+            void dismiss() noexcept { m_is_dismissed = true; }
         };
     }  // inline namespace exception_handling
 }  // namespace cppm
@@ -20,8 +20,8 @@ namespace cppm {
         inline auto fail( in_<string_view> s, in_<Args>... args )
             -> bool
         {
-            const fmt::format_args vargs = fmt::make_format_args( args... );
-            throw runtime_error( fmt::vformat( s, vargs ) );   // Note: avoid ADL.
+            const auto arg_store = fmt::make_format_args( args... );     // Must outlive the `format_args`.
+            throw runtime_error( fmt::vformat( s, arg_store ) );   // Note: avoid ADL.
             for( ;; ) {}        // Should never get here. Also, avoid g++ silly-warning.
         }
     }  // inline namespace now_and_fail
@@ -15,7 +15,10 @@ namespace cppm {
     inline namespace main_function {
         using Simple_main = function<void()>;
 
-        inline auto with_exceptions_displayed( in_<Simple_main> f ) noexcept
+        // `f` is called directly, e.g. a function or a lambda, without wrapping it in a `function`.
+        // It's called as an lvalue, so that a `mutable` lambda works as with a `function`.
+        template< class Func >
+        auto with_exceptions_displayed( Func&& f ) noexcept
             -> int
         {
             try {
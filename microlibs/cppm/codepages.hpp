@@ -0,0 +1,3 @@
+#pragma once
+#include <cppm/codepages/registry.hpp>
+#include <cppm/codepages/transcoding.hpp>
@@ -0,0 +1,122 @@
+// Implementation include.
+#include <cppm/codepages/registry.hpp>
+#include <cppm/codepages/registry.tables.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+
+#include <array>
+#include <iterator>
+#include <utility>
+
+namespace cppm::codepages::impl {
+    using   std::array,                                     // <array>
+            std::size,                                      // <iterator>
+            std::index_sequence, std::make_index_sequence;  // <utility>
+
+    template< size_t... indices >
+    constexpr auto codepages_for( index_sequence<indices...> ) noexcept
+        -> array<Codepage, sizeof...( indices )>
+    { return {Codepage( codepage_tables::tables[indices] )...}; }
+
+    inline constexpr auto the_codepages = codepages_for( make_index_sequence<size( codepage_tables::tables )>() );
+
+    constexpr auto is_alphanumeric( const char ch ) noexcept
+        -> bool
+    { return ('0' <= ch and ch <= '9') or ('a' <= ch and ch <= 'z') or ('A' <= ch and ch <= 'Z'); }
+
+    constexpr auto ascii_lowercase( const char ch ) noexcept
+        -> char
+    { return ('A' <= ch and ch <= 'Z'? char( ch - 'A' + 'a' ) : ch); }
+
+    // Compares only the alphanumeric characters, case-insensitively, e.g. "ISO-8859-1" = "iso8859_1".
+    constexpr auto is_same_name( in_<string_view> a, in_<string_view> b ) noexcept
+        -> bool
+    {
+        size_t i = 0;  size_t j = 0;
+        for( ;; ) {
+            while( i < a.size() and not is_alphanumeric( a[i] ) ) { ++i; }
+            while( j < b.size() and not is_alphanumeric( b[j] ) ) { ++j; }
+            if( i == a.size() or j == b.size() ) { return (i == a.size() and j == b.size()); }
+            if( ascii_lowercase( a[i] ) != ascii_lowercase( b[j] ) ) { return false; }
+            ++i;  ++j;
+        }
+    }
+
+    inline auto is_name_of( in_<Codepage> codepage, in_<string_view> name ) noexcept
+        -> bool
+    {
+        if( is_same_name( codepage.name(), name ) ) { return true; }
+        string_view aliases = codepage.table().aliases;
+        while( not aliases.empty() ) {
+            const size_t space = aliases.find( ' ' );
+            if( is_same_name( aliases.substr( 0, space ), name ) ) { return true; }
+            aliases.remove_prefix( space == string_view::npos? aliases.size() : space + 1 );
+        }
+        return false;
+    }
+}  // namespace cppm::codepages::impl
+
+namespace cppm::codepages {
+    auto registry::Codepage::number() const noexcept -> int { return m_table->number; }
+    auto registry::Codepage::name() const noexcept -> string_view { return m_table->name; }
+
+    auto registry::Codepage::code_for( const Byte b ) const noexcept
+        -> char32_t
+    {
+        if( b < 0x80 ) { return b; }
+        const uint32_t sequence = m_table->utf8_sequences[b - 0x80];
+        const int length = int( sequence >> 24 );
+        return char32_t( 0?0
+            : length == 0?  -1
+            : length == 2?  ((sequence & 0x1F) << 6) | ((sequence >> 8) & 0x3F)
+            :               ((sequence & 0x0F) << 12) | (((sequence >> 8) & 0x3F) << 6) | ((sequence >> 16) & 0x3F)
+            );
+    }
+
+    auto registry::Codepage::byte_for( const char32_t code ) const noexcept
+        -> int
+    {
+        if( code < 0x80 ) { return int( code ); }
+        if( code >= 0x10000 ) { return -1; }
+        const Byte b = impl::codepage_tables::reverse_pages[m_table->reverse_page_index[code >> 8]][code & 0xFF];
+        return (b == 0? -1 : b);
+    }
+
+    auto registry::all_codepages() noexcept
+        -> Span<const Codepage>
+    { return {impl::the_codepages.data(), impl::the_codepages.size()}; }
+
+    auto registry::find_codepage( const int number ) noexcept
+        -> const Codepage*
+    {
+        if( number == 0 ) { return nullptr; }
+        for( const Codepage& codepage: impl::the_codepages ) {
+            if( codepage.number() == number ) { return &codepage; }
+        }
+        return nullptr;
+    }
+
+    auto registry::find_codepage( in_<string_view> name ) noexcept
+        -> const Codepage*
+    {
+        for( const Codepage& codepage: impl::the_codepages ) {
+            if( impl::is_name_of( codepage, name ) ) { return &codepage; }
+        }
+        return nullptr;
+    }
+
+    auto registry::codepage_numbered( const int number )
+        -> const Codepage&
+    {
+        const Codepage* const p_codepage = find_codepage( number );
+        now( p_codepage != nullptr ) or fail( "codepage_numbered: no codepage {} in the registry.", number );
+        return *p_codepage;
+    }
+
+    auto registry::codepage_named( in_<string_view> name )
+        -> const Codepage&
+    {
+        const Codepage* const p_codepage = find_codepage( name );
+        now( p_codepage != nullptr ) or fail( "codepage_named: no codepage “{}” in the registry.", name );
+        return *p_codepage;
+    }
+}  // namespace cppm::codepages
@@ -0,0 +1,53 @@
+#pragma once
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <string_view>
+
+namespace cppm::codepages::impl::codepage_tables { struct Codepage_table; }    // registry.tables.hpp
+
+namespace cppm::codepages {
+    using   std::string_view;           // <string_view>
+
+    inline namespace registry {
+        // A single-byte codepage with ASCII as bytes 0x00 through 0x7F, from the built-in tables:
+        // IBM437, IBM850, windows-1252 and ISO-8859-1 through ISO-8859-16 except 12. Conversion
+        // is by the functions of `<cppm/codepages/transcoding.hpp>`.
+        class Codepage
+        {
+            const impl::codepage_tables::Codepage_table*    m_table;
+
+        public:
+            constexpr explicit Codepage( const impl::codepage_tables::Codepage_table& table ) noexcept:
+                m_table( &table )
+            {}
+
+            auto table() const noexcept -> const impl::codepage_tables::Codepage_table& { return *m_table; }
+
+            // The Windows codepage identifier, e.g. 1252, or 0 if Windows has none.
+            auto number() const noexcept -> int;
+            auto name() const noexcept -> string_view;
+
+            // The code point of byte `b`, or -1 if `b` isn't mapped.
+            auto code_for( Byte b ) const noexcept -> char32_t;
+
+            // The byte of code point `code`, or -1 if it's not in the codepage.
+            auto byte_for( char32_t code ) const noexcept -> int;
+
+            friend auto operator==( in_<Codepage> a, in_<Codepage> b ) noexcept -> bool { return a.m_table == b.m_table; }
+            friend auto operator!=( in_<Codepage> a, in_<Codepage> b ) noexcept -> bool { return a.m_table != b.m_table; }
+        };
+
+        extern auto all_codepages() noexcept -> Span<const Codepage>;
+
+        // Returns `nullptr` if there's no such codepage. A name is compared case-insensitively and
+        // ignoring non-alphanumeric characters with the name and aliases, e.g. "cp1252", "latin1".
+        extern auto find_codepage( int number ) noexcept -> const Codepage*;
+        extern auto find_codepage( in_<string_view> name ) noexcept -> const Codepage*;
+
+        // These `fail` if there's no such codepage.
+        extern auto codepage_numbered( int number ) -> const Codepage&;
+        extern auto codepage_named( in_<string_view> name ) -> const Codepage&;
+    }  // inline namespace registry
+}  // namespace cppm::codepages
@@ -0,0 +1,429 @@
+// Implementation include.
+// As with the UTF transcoding, a kernel converts a prefix of the input whose output is guaranteed
+// to fit, and checked scalar code converts the rest. In each iteration a kernel stores a vector
+// of bytes as if they were ASCII but advances only past the ASCII ones, and then converts the
+// following non-ASCII run, if any, by table lookup.
+#include <cppm/codepages/transcoding.hpp>
+#include <cppm/codepages/registry.tables.hpp>
+#include <cppm/utf8/code_points.hpp>            // valid_sequence_at, piece_end
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/bits.hpp>                 // n_trailing_zeros
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+
+#include <stdint.h>         // uint32_t
+#include <string.h>         // memcpy
+
+#include <algorithm>
+
+namespace cppm::codepages::impl {
+    using   std::min;       // <algorithm>
+    using   codepage_tables::Codepage_table;
+
+    // Stores the UTF-8 of byte `*in`, which is at least 0x80, as 4 bytes of which 1 can be
+    // beyond the sequence. Returns `false` if the byte is unmapped.
+    inline auto decode_one( in_<Codepage_table> table, const Byte*& in, Byte*& out ) noexcept
+        -> bool
+    {
+        const uint32_t sequence = table.utf8_sequences[*in - 0x80];
+        if( sequence == 0 ) { return false; }
+        memcpy( out, &sequence, 4 );        // Little-endian assumed.
+        out += sequence >> 24;
+        ++in;
+        return true;
+    }
+
+    // Converts the UTF-8 sequence at `in` to 1 byte. Returns `false` if it's invalid or the code
+    // point isn't in the codepage.
+    inline auto encode_one( in_<Codepage_table> table, const Byte*& in, const Byte* const end, Byte*& out ) noexcept
+        -> bool
+    {
+        char32_t code;
+        const int length = utf8::impl::valid_sequence_at( in, end, code );
+        if( length == 0 or code >= 0x10000 ) { return false; }
+        const Byte b = (code < 0x80? Byte( code )
+            : codepage_tables::reverse_pages[table.reverse_page_index[code >> 8]][code & 0xFF]
+            );
+        if( b == 0 and code != 0 ) { return false; }
+        *out++ = b;
+        in += length;
+        return true;
+    }
+
+    // Kernels convert the input that starts before `limit`, reading at most up to `end`, and
+    // return `false` on invalid input at `in`. The caller guarantees room for the output.
+    using Kernel = auto( in_<Codepage_table>, const Byte*& in, const Byte* limit, const Byte* end, Byte*& out ) noexcept
+        -> bool;
+
+    inline auto scalar_decode(
+        in_<Codepage_table>     table,
+        const Byte*&            in_position,
+        const Byte* const       limit,
+        const Byte*,
+        Byte*&                  out_position
+        ) noexcept -> bool
+    {
+        const Byte* in = in_position;  Byte* out = out_position;     // Locals, not aliased by output.
+        bool is_valid = true;
+        while( in < limit ) {
+            if( *in < 0x80 ) {
+                *out++ = *in++;
+            } else if( not decode_one( table, in, out ) ) {
+                is_valid = false;
+                break;
+            }
+        }
+        in_position = in;  out_position = out;
+        return is_valid;
+    }
+
+    inline auto scalar_encode(
+        in_<Codepage_table>     table,
+        const Byte*&            in_position,
+        const Byte* const       limit,
+        const Byte* const       end,
+        Byte*&                  out_position
+        ) noexcept -> bool
+    {
+        const Byte* in = in_position;  Byte* out = out_position;
+        bool is_valid = true;
+        while( in < limit ) {
+            if( *in < 0x80 ) {
+                *out++ = *in++;
+            } else if( not encode_one( table, in, end, out ) ) {
+                is_valid = false;
+                break;
+            }
+        }
+        in_position = in;  out_position = out;
+        return is_valid;
+    }
+
+    // True if the 4 bytes at `p` are ASCII, which likely starts a run that's worth a vector loop.
+    inline auto is_at_ascii_run( const Byte* const p, const Byte* const limit ) noexcept
+        -> bool
+    {
+        if( limit - p < 4 ) { return false; }
+        uint32_t word;  memcpy( &word, p, 4 );
+        return (word & 0x8080'8080) == 0;
+    }
+
+    // Bytes converted without looking for an ASCII run after looking in vain.
+    constexpr int n_bytes_between_probes = 8;
+
+    // Converts at least one non-ASCII byte or sequence, and then on up to an ASCII run, so that
+    // e.g. the single spaces between the words of Cyrillic text don't end the run. A run is only
+    // looked for after an ASCII byte, and after a failed look not for the next few bytes, so that
+    // mostly non-ASCII text costs no more than scalar code.
+    inline auto decode_non_ascii_run( in_<Codepage_table> table, const Byte*& in, const Byte* const limit, Byte*& out ) noexcept
+        -> bool
+    {
+        const Byte* next_probe = in;
+        do {
+            if( *in < 0x80 ) {
+                *out++ = *in++;
+                if( in >= next_probe ) {
+                    if( is_at_ascii_run( in, limit ) ) { break; }
+                    next_probe = in + n_bytes_between_probes;
+                }
+            } else if( not decode_one( table, in, out ) ) {
+                return false;
+            }
+        } while( in < limit );
+        return true;
+    }
+
+    inline auto encode_non_ascii_run(
+        in_<Codepage_table>     table,
+        const Byte*&            in,
+        const Byte* const       limit,
+        const Byte* const       end,
+        Byte*&                  out
+        ) noexcept -> bool
+    {
+        const Byte* next_probe = in;
+        do {
+            if( *in < 0x80 ) {
+                *out++ = *in++;
+                if( in >= next_probe ) {
+                    if( is_at_ascii_run( in, limit ) ) { break; }
+                    next_probe = in + n_bytes_between_probes;
+                }
+            } else if( not encode_one( table, in, end, out ) ) {
+                return false;
+            }
+        } while( in < limit );
+        return true;
+    }
+}  // namespace cppm::codepages::impl
+
+#if CPPM_CPU_IS_X86
+namespace cppm::codepages::impl::codepage_kernels {
+    namespace sse4_2 {
+        using V = __m128i;
+
+        // Copies the ASCII prefix of a vector at `in`, of up to 16 bytes, and returns its length.
+        CPPM_TARGET_SSE4_2
+        inline auto copy_ascii_prefix( const Byte*& in, Byte*& out ) noexcept
+            -> int
+        {
+            const V bytes = _mm_loadu_si128( reinterpret_cast<const V*>( in ) );
+            _mm_storeu_si128( reinterpret_cast<V*>( out ), bytes );
+            const unsigned non_ascii = unsigned( _mm_movemask_epi8( bytes ) );
+            const int n_ascii = (non_ascii == 0? 16 : n_trailing_zeros( non_ascii ));
+            in += n_ascii;  out += n_ascii;
+            return n_ascii;
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto decode(
+            in_<Codepage_table>     table,
+            const Byte*&            in_position,
+            const Byte* const       limit,
+            const Byte* const       end,
+            Byte*&                  out_position
+            ) noexcept -> bool
+        {
+            const Byte* in = in_position;  Byte* out = out_position;
+            bool is_valid = true;
+            while( limit - in >= 16 ) {
+                if( copy_ascii_prefix( in, out ) == 16 ) { continue; }
+                if( not decode_non_ascii_run( table, in, limit, out ) ) { is_valid = false;  break; }
+            }
+            in_position = in;  out_position = out;
+            return is_valid and scalar_decode( table, in_position, limit, end, out_position );
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto encode(
+            in_<Codepage_table>     table,
+            const Byte*&            in_position,
+            const Byte* const       limit,
+            const Byte* const       end,
+            Byte*&                  out_position
+            ) noexcept -> bool
+        {
+            const Byte* in = in_position;  Byte* out = out_position;
+            bool is_valid = true;
+            while( limit - in >= 16 ) {
+                if( copy_ascii_prefix( in, out ) == 16 ) { continue; }
+                if( not encode_non_ascii_run( table, in, limit, end, out ) ) { is_valid = false;  break; }
+            }
+            in_position = in;  out_position = out;
+            return is_valid and scalar_encode( table, in_position, limit, end, out_position );
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        using V = __m256i;
+
+        CPPM_TARGET_AVX2
+        inline auto copy_ascii_prefix( const Byte*& in, Byte*& out ) noexcept
+            -> int
+        {
+            const V bytes = _mm256_loadu_si256( reinterpret_cast<const V*>( in ) );
+            _mm256_storeu_si256( reinterpret_cast<V*>( out ), bytes );
+            const unsigned non_ascii = unsigned( _mm256_movemask_epi8( bytes ) );
+            const int n_ascii = (non_ascii == 0? 32 : n_trailing_zeros( non_ascii ));
+            in += n_ascii;  out += n_ascii;
+            return n_ascii;
+        }
+
+        CPPM_TARGET_AVX2
+        auto decode(
+            in_<Codepage_table>     table,
+            const Byte*&            in_position,
+            const Byte* const       limit,
+            const Byte* const       end,
+            Byte*&                  out_position
+            ) noexcept -> bool
+        {
+            const Byte* in = in_position;  Byte* out = out_position;
+            bool is_valid = true;
+            while( limit - in >= 32 ) {
+                if( copy_ascii_prefix( in, out ) == 32 ) { continue; }
+                if( not decode_non_ascii_run( table, in, limit, out ) ) { is_valid = false;  break; }
+            }
+            in_position = in;  out_position = out;
+            return is_valid and sse4_2::decode( table, in_position, limit, end, out_position );
+        }
+
+        CPPM_TARGET_AVX2
+        auto encode(
+            in_<Codepage_table>     table,
+            const Byte*&            in_position,
+            const Byte* const       limit,
+            const Byte* const       end,
+            Byte*&                  out_position
+            ) noexcept -> bool
+        {
+            const Byte* in = in_position;  Byte* out = out_position;
+            bool is_valid = true;
+            while( limit - in >= 32 ) {
+                if( copy_ascii_prefix( in, out ) == 32 ) { continue; }
+                if( not encode_non_ascii_run( table, in, limit, end, out ) ) { is_valid = false;  break; }
+            }
+            in_position = in;  out_position = out;
+            return is_valid and sse4_2::encode( table, in_position, limit, end, out_position );
+        }
+    }  // namespace avx2
+}  // namespace cppm::codepages::impl::codepage_kernels
+#endif
+
+namespace cppm::codepages::impl {
+    constexpr size_t transcoding_buffer_size = 16*1024;
+
+    struct Kernels{ Kernel* decode; Kernel* encode; };
+
+    inline auto kernels_for( const Simd_level::Enum level ) noexcept
+        -> Kernels
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = codepage_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    [[fallthrough]];
+                case Simd_level::avx2:      return {k::avx2::decode, k::avx2::encode};
+                case Simd_level::sse4_2:    return {k::sse4_2::decode, k::sse4_2::encode};
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return {scalar_decode, scalar_encode};
+    }
+
+    inline auto the_kernels() noexcept
+        -> const Kernels&
+    {
+        static const Kernels the_chosen_kernels = kernels_for( Simd_level::_ );
+        return the_chosen_kernels;
+    }
+
+    // A decoded byte is at most 3 bytes of UTF-8, but the kernels store 4.
+    inline auto decode( Kernel& kernel, in_<Codepage_table> table, in_<string_view> text, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        using S = Transcoding_status;
+        const auto begin    = reinterpret_cast<const Byte*>( text.data() );
+        const auto end      = begin + text.size();
+        const auto out_begin = reinterpret_cast<Byte*>( buffer.data() );
+        const auto out_end  = out_begin + buffer.size();
+
+        const size_t n_out = buffer.size();
+        const size_t n_unchecked = (n_out > 3*text.size()? text.size() : n_out > 0? (n_out - 1)/3 : 0);
+        const Byte* in  = begin;
+        Byte*       out = out_begin;
+        if( not kernel( table, in, begin + n_unchecked, end, out ) ) {
+            return {S::invalid_input, size_t( in - begin ), size_t( out - out_begin )};
+        }
+
+        while( in < end ) {     // Checked scalar code for the part that might not fit.
+            if( *in < 0x80 ) {
+                if( out == out_end ) { return {S::buffer_too_small, size_t( in - begin ), size_t( out - out_begin )}; }
+                *out++ = *in++;
+                continue;
+            }
+            const uint32_t sequence = table.utf8_sequences[*in - 0x80];
+            const int length = int( sequence >> 24 );
+            if( length == 0 ) { return {S::invalid_input, size_t( in - begin ), size_t( out - out_begin )}; }
+            if( out_end - out < length ) {
+                return {S::buffer_too_small, size_t( in - begin ), size_t( out - out_begin )};
+            }
+            for( int i = 0; i < length; ++i ) { *out++ = Byte( sequence >> (8*i) ); }
+            ++in;
+        }
+        return {S::ok, text.size(), size_t( out - out_begin )};
+    }
+
+    inline auto encode( Kernel& kernel, in_<Codepage_table> table, in_<string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        using S = Transcoding_status;
+        const auto begin    = reinterpret_cast<const Byte*>( s.data() );
+        const auto end      = begin + s.size();
+        const auto out_begin = reinterpret_cast<Byte*>( buffer.data() );
+        const auto out_end  = out_begin + buffer.size();
+
+        const Byte* in  = begin;
+        Byte*       out = out_begin;
+        if( not kernel( table, in, begin + min( s.size(), buffer.size() ), end, out ) ) {
+            return {S::invalid_input, size_t( in - begin ), size_t( out - out_begin )};
+        }
+
+        while( in < end ) {     // A sequence that starts in the unchecked part can end beyond it.
+            if( out == out_end ) { return {S::buffer_too_small, size_t( in - begin ), size_t( out - out_begin )}; }
+            if( not encode_one( table, in, end, out ) ) {
+                return {S::invalid_input, size_t( in - begin ), size_t( out - out_begin )};
+            }
+        }
+        return {S::ok, s.size(), size_t( out - out_begin )};
+    }
+
+    // Converts via a small buffer, in pieces that don't split a UTF-8 sequence of the input.
+    template< class Converter >
+    auto converted(
+        in_<string_view>        s,
+        Converter&              convert,
+        const size_t            max_expansion,
+        const bool              is_utf8_input,
+        const char* const       error_format
+        ) -> string
+    {
+        string result;
+        result.reserve( s.size() );
+        char buffer[transcoding_buffer_size];
+        for( size_t offset = 0; offset < s.size(); ) {
+            const size_t n_max = min( s.size() - offset, transcoding_buffer_size/max_expansion );
+            const size_t n = (is_utf8_input? utf8::impl::piece_end( s.substr( offset ), n_max ) : n_max);
+            const Transcoding_result r = convert( s.substr( offset, n ), Span<char>( buffer ) );
+            now( !!r ) or fail( error_format, offset + r.n_read );
+            result.append( buffer, r.n_written );
+            offset += n;
+        }
+        return result;
+    }
+}  // namespace cppm::codepages::impl
+
+namespace cppm::codepages {
+    auto transcoding::to_utf8( in_<Codepage> codepage, in_<string_view> text, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    { return impl::decode( *impl::the_kernels().decode, codepage.table(), text, buffer ); }
+
+    auto transcoding::from_utf8( in_<Codepage> codepage, in_<string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    { return impl::encode( *impl::the_kernels().encode, codepage.table(), s, buffer ); }
+
+    auto transcoding::to_utf8_using(
+        const Simd_level::Enum  level,
+        in_<Codepage>           codepage,
+        in_<string_view>        text,
+        in_<Span<char>>         buffer
+        ) noexcept -> Transcoding_result
+    { return impl::decode( *impl::kernels_for( level ).decode, codepage.table(), text, buffer ); }
+
+    auto transcoding::from_utf8_using(
+        const Simd_level::Enum  level,
+        in_<Codepage>           codepage,
+        in_<string_view>        s,
+        in_<Span<char>>         buffer
+        ) noexcept -> Transcoding_result
+    { return impl::encode( *impl::kernels_for( level ).encode, codepage.table(), s, buffer ); }
+
+    auto transcoding::utf8_from( in_<Codepage> codepage, in_<string_view> text )
+        -> string
+    {
+        const auto convert = [&]( in_<string_view> piece, in_<Span<char>> buffer ) noexcept {
+            return to_utf8( codepage, piece, buffer );
+        };
+        const bool is_utf8_input = false;
+        return impl::converted( text, convert, 3, is_utf8_input, "utf8_from: unmapped byte at offset {}." );
+    }
+
+    auto transcoding::codepage_text_from( in_<Codepage> codepage, in_<string_view> s )
+        -> string
+    {
+        const auto convert = [&]( in_<string_view> piece, in_<Span<char>> buffer ) noexcept {
+            return from_utf8( codepage, piece, buffer );
+        };
+        const bool is_utf8_input = true;
+        return impl::converted( s, convert, 1, is_utf8_input, "codepage_text_from: invalid or unmappable UTF-8 at byte offset {}." );
+    }
+}  // namespace cppm::codepages
@@ -0,0 +1,42 @@
+#pragma once
+#include <cppm/codepages/registry.hpp>          // Codepage
+#include <cppm/utf8/transcoding.hpp>            // Transcoding_status, Transcoding_result
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/environment/cpu.hpp>      // Simd_level
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string>
+#include <string_view>
+
+namespace cppm::codepages {
+    using   cppm::utf8::Transcoding_status, cppm::utf8::Transcoding_result;
+    using   std::string,                // <string>
+            std::string_view;           // <string_view>
+
+    inline namespace transcoding {
+        // Buffer sizes sufficient for any valid input, for single pass conversion.
+        constexpr auto max_utf8_length_for_codepage_text( const size_t n_bytes ) -> size_t { return 3*n_bytes; }
+        constexpr auto max_codepage_length_for_utf8( const size_t n_bytes ) -> size_t { return n_bytes; }
+
+        // Runs of ASCII are copied a SIMD vector at a time, and other bytes are converted by table
+        // lookup. An unmapped byte, or in the other direction invalid UTF-8 or a code point that's
+        // not in the codepage, is `invalid_input`: there's no substitution.
+        extern auto to_utf8( in_<Codepage> codepage, in_<string_view> text, in_<Span<char>> buffer ) noexcept
+            -> Transcoding_result;
+        extern auto from_utf8( in_<Codepage> codepage, in_<string_view> s, in_<Span<char>> buffer ) noexcept
+            -> Transcoding_result;
+
+        // Mainly for testing and benchmarking. A `level` above `simd_level()` is reduced to that.
+        extern auto to_utf8_using(
+            Simd_level::Enum level, in_<Codepage> codepage, in_<string_view> text, in_<Span<char>> buffer
+            ) noexcept -> Transcoding_result;
+        extern auto from_utf8_using(
+            Simd_level::Enum level, in_<Codepage> codepage, in_<string_view> s, in_<Span<char>> buffer
+            ) noexcept -> Transcoding_result;
+
+        // Convenience wrappers that `fail` on invalid input.
+        extern auto utf8_from( in_<Codepage> codepage, in_<string_view> text ) -> string;
+        extern auto codepage_text_from( in_<Codepage> codepage, in_<string_view> s ) -> string;
+    }  // inline namespace transcoding
+}  // namespace cppm::codepages
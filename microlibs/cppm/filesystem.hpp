@@ -1,3 +1,8 @@
 #pragma once
+#include <cppm/filesystem/Line_reader.hpp>
+#include <cppm/filesystem/Mapped_file.hpp>
+#include <cppm/filesystem/Mapped_output_file.hpp>
 #include <cppm/filesystem/Path.hpp>
 #include <cppm/filesystem/Path.fmt.hpp>
+#include <cppm/filesystem/Path_store.hpp>
+#include <cppm/filesystem/walk.hpp>
@@ -0,0 +1,151 @@
+// Implementation include.
+// A line is found with a SIMD scan for "\n", and with validation the UTF-8 is checked in blocks
+// that each end at a sequence boundary, so that a block can end within a line and vice versa.
+#include <cppm/filesystem/Line_reader.hpp>
+#include <cppm/utf8/code_points.hpp>            // incomplete_tail_length
+#include <cppm/utf8/validation.hpp>             // validate
+#include <cppm/basics/environment/cpu.hpp>      // simd_level
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/bits.hpp>                 // n_trailing_zeros
+
+#include <stdint.h>         // uint32_t, uint64_t
+
+#include <algorithm>
+
+namespace cppm::impl {
+    using   std::min;       // <algorithm>
+
+    // Returns `end` if there's no "\n".
+    inline auto scalar_find_newline( const char* p, const char* const end ) noexcept
+        -> const char*
+    {
+        while( p < end and *p != '\n' ) { ++p; }
+        return p;
+    }
+}  // namespace cppm::impl
+
+#if CPPM_CPU_IS_X86
+namespace cppm::impl::line_reader_kernels {
+    namespace sse4_2 {
+        using V = __m128i;
+
+        CPPM_TARGET_SSE4_2
+        auto find_newline( const char* p, const char* const end ) noexcept
+            -> const char*
+        {
+            const V newlines = _mm_set1_epi8( '\n' );
+            for( ; end - p >= 16; p += 16 ) {
+                const V bytes = _mm_loadu_si128( reinterpret_cast<const V*>( p ) );
+                if( const unsigned matches = unsigned( _mm_movemask_epi8( _mm_cmpeq_epi8( bytes, newlines ) ) ) ) {
+                    return p + n_trailing_zeros( matches );
+                }
+            }
+            return scalar_find_newline( p, end );
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        using V = __m256i;
+
+        // Two vectors per iteration, since lines are often longer than 32 bytes.
+        CPPM_TARGET_AVX2
+        auto find_newline( const char* p, const char* const end ) noexcept
+            -> const char*
+        {
+            const V newlines = _mm256_set1_epi8( '\n' );
+            for( ; end - p >= 64; p += 64 ) {
+                const V low     = _mm256_loadu_si256( reinterpret_cast<const V*>( p ) );
+                const V high    = _mm256_loadu_si256( reinterpret_cast<const V*>( p + 32 ) );
+                const uint64_t matches = 0
+                    | uint64_t( uint32_t( _mm256_movemask_epi8( _mm256_cmpeq_epi8( low, newlines ) ) ) )
+                    | uint64_t( uint32_t( _mm256_movemask_epi8( _mm256_cmpeq_epi8( high, newlines ) ) ) ) << 32;
+                if( matches ) { return p + n_trailing_zeros( matches ); }
+            }
+            return sse4_2::find_newline( p, end );
+        }
+    }  // namespace avx2
+}  // namespace cppm::impl::line_reader_kernels
+#endif
+
+namespace cppm::impl {
+    using Newline_finder = auto( const char*, const char* ) noexcept -> const char*;
+
+    inline auto newline_finder_for( const Simd_level::Enum level ) noexcept
+        -> Newline_finder*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = line_reader_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    [[fallthrough]];
+                case Simd_level::avx2:      return k::avx2::find_newline;
+                case Simd_level::sse4_2:    return k::sse4_2::find_newline;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return scalar_find_newline;
+    }
+
+    inline auto the_newline_finder() noexcept
+        -> Newline_finder&
+    {
+        static Newline_finder* const the_finder = newline_finder_for( Simd_level::_ );
+        return *the_finder;
+    }
+
+    constexpr size_t line_validation_block_size = 64*1024;
+
+    inline auto without_bom( in_<string_view> text ) noexcept
+        -> string_view
+    { return (text.substr( 0, 3 ) == "\xEF\xBB\xBF"? text.substr( 3 ) : text); }
+}  // namespace cppm::impl
+
+cppm::filesystem::Line_reader::Line_reader( in_<string_view> text, const Line_validation::Enum validation ) noexcept:
+    m_position( impl::without_bom( text ).data() ),
+    m_end( text.data() + text.size() ),
+    m_validated_end( m_position ),
+    m_text_start( text.data() ),
+    m_validation( validation ),
+    m_n_lines( 0 )
+{}
+
+// Validates blocks from `m_validated_end` until it's at or beyond `p`, which must be at a
+// sequence boundary. A block's incomplete last sequence is left for the next block.
+void cppm::filesystem::Line_reader::validate_through( const char* const p )
+{
+    using   std::min;                               // <algorithm>
+    using   utf8::impl::incomplete_tail_length;
+    while( m_validated_end < p ) {
+        const size_t n_left = size_t( m_end - m_validated_end );
+        const char* block_end = m_validated_end + min( n_left, impl::line_validation_block_size );
+        if( block_end < p ) { block_end = p; }
+        if( block_end < m_end ) {
+            const auto bytes = reinterpret_cast<const Byte*>( m_validated_end );
+            block_end -= incomplete_tail_length( bytes, bytes + (block_end - m_validated_end) );
+        }
+
+        const auto block = string_view( m_validated_end, size_t( block_end - m_validated_end ) );
+        const utf8::Validation_result result = utf8::validate( block );
+        const size_t offset = size_t( m_validated_end - m_text_start ) + result.n_valid_bytes;
+        now( result.is_valid ) or fail( "Invalid UTF-8 at byte offset {}.", offset );
+        m_validated_end = block_end;
+    }
+}
+
+auto cppm::filesystem::Line_reader::next( string_view& line )
+    -> bool
+{
+    if( m_position == m_end ) { return false; }
+
+    const char* const newline = impl::the_newline_finder()( m_position, m_end );
+    const char* const beyond = (newline == m_end? m_end : newline + 1);
+    if( m_validation == Line_validation::utf8 ) { validate_through( beyond ); }
+
+    const char* line_end = newline;
+    if( newline != m_end and line_end > m_position and line_end[-1] == '\r' ) { --line_end; }
+    line = string_view( m_position, size_t( line_end - m_position ) );
+    m_position = beyond;
+    ++m_n_lines;
+    return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string_view>
+
+namespace cppm {
+    using   std::string_view;       // <string_view>
+
+    inline namespace filesystem {
+        struct Line_validation{ enum Enum{ none, utf8 }; };
+
+        // Splits text, typically the `text()` of a `Mapped_file`, into lines as views of the text,
+        // without copying. Newlines are found with a SIMD scan. A leading UTF-8 BOM is skipped, a
+        // "\r" before a "\n" is removed, and a final line without "\n" is also a line.
+        //
+        // With `Line_validation::utf8` the text is validated in blocks of about 64 KiB as they're
+        // reached, and `next` `fail`s at invalid UTF-8, including a truncated final sequence.
+        class Line_reader
+        {
+            const char*             m_position;
+            const char*             m_end;
+            const char*             m_validated_end;
+            const char*             m_text_start;
+            Line_validation::Enum   m_validation;
+            size_t                  m_n_lines;
+
+            void validate_through( const char* p );
+
+        public:
+            explicit Line_reader( in_<string_view> text, Line_validation::Enum validation = Line_validation::none ) noexcept;
+
+            auto n_lines_read() const noexcept -> size_t { return m_n_lines; }
+            auto n_bytes_left() const noexcept -> size_t { return size_t( m_end - m_position ); }
+
+            // Returns `false` at the end of the text. `line` excludes the "\n" or "\r\n".
+            auto next( string_view& line ) -> bool;
+        };
+    }  // inline namespace filesystem
+}  // namespace cppm
@@ -0,0 +1,39 @@
+// Implementation include.
+#include <cppm/filesystem/Mapped_file.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/stdlib_workarounds/fs_path.hpp>          // to_u8_string
+
+#include <errno.h>
+#include <fcntl.h>          // open
+#include <string.h>         // strerror
+#include <sys/mman.h>       // mmap, madvise, munmap
+#include <sys/stat.h>       // fstat
+#include <unistd.h>         // close
+
+auto cppm::impl::map_file( in_<fs::path> path, size_t& size )
+    -> const Byte*
+{
+    const int fd = open( path.c_str(), O_RDONLY | O_CLOEXEC );
+    now( fd >= 0 ) or fail( "Failed to open “{}”: {}.", to_u8_string( path ), strerror( errno ) );
+
+    struct stat info;
+    const bool got_info = (fstat( fd, &info ) == 0);
+    const int stat_errno = errno;
+    if( not got_info ) { close( fd ); }
+    now( got_info ) or fail( "Failed to get the size of “{}”: {}.", to_u8_string( path ), strerror( stat_errno ) );
+
+    size = size_t( info.st_size );
+    if( size == 0 ) { close( fd );  return nullptr; }
+    void* const p = mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    const int mmap_errno = errno;
+    close( fd );        // The mapping keeps the file open.
+    now( p != MAP_FAILED ) or fail( "Failed to map “{}”: {}.", to_u8_string( path ), strerror( mmap_errno ) );
+
+    madvise( p, size, MADV_SEQUENTIAL );
+    return static_cast<const Byte*>( p );
+}
+
+void cppm::impl::unmap_file( const Byte* const data, const size_t size ) noexcept
+{
+    munmap( const_cast<Byte*>( data ), size );
+}
@@ -0,0 +1,41 @@
+// Implementation include.
+#include <cppm/filesystem/Mapped_file.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/stdlib_workarounds/fs_path.hpp>          // to_u8_string
+
+#include <winapi/wrapped/windows-h.wide.hpp>
+
+auto cppm::impl::map_file( in_<fs::path> path, size_t& size )
+    -> const Byte*
+{
+    const HANDLE file = CreateFileW(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+        );
+    now( file != INVALID_HANDLE_VALUE )
+        or fail( "Failed to open “{}”: error {}.", to_u8_string( path ), GetLastError() );
+
+    LARGE_INTEGER file_size;
+    if( not GetFileSizeEx( file, &file_size ) ) {
+        const DWORD error = GetLastError();
+        CloseHandle( file );
+        fail( "Failed to get the size of “{}”: error {}.", to_u8_string( path ), error );
+    }
+    size = size_t( file_size.QuadPart );
+    if( size == 0 ) { CloseHandle( file );  return nullptr; }
+
+    const HANDLE mapping = CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    const DWORD mapping_error = GetLastError();
+    CloseHandle( file );        // The mapping keeps the file open.
+    now( mapping != nullptr ) or fail( "Failed to map “{}”: error {}.", to_u8_string( path ), mapping_error );
+
+    const void* const p = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+    const DWORD view_error = GetLastError();
+    CloseHandle( mapping );     // The view keeps the mapping.
+    now( p != nullptr ) or fail( "Failed to map “{}”: error {}.", to_u8_string( path ), view_error );
+    return static_cast<const Byte*>( p );
+}
+
+void cppm::impl::unmap_file( const Byte* const data, const size_t ) noexcept
+{
+    UnmapViewOfFile( data );
+}
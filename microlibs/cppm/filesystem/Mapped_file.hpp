@@ -0,0 +1,56 @@
+#pragma once
+#include <cppm/filesystem/Path.hpp>
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string_view>
+#include <utility>
+
+namespace cppm {
+    using   std::string_view,               // <string_view>
+            std::exchange, std::move;       // <utility>
+
+    namespace impl {
+        // These `fail` on errors. An empty file is mapped as `nullptr`, since it can't be mapped.
+        extern auto map_file( in_<fs::path> path, size_t& size ) -> const Byte*;
+        extern void unmap_file( const Byte* data, size_t size ) noexcept;
+    }  // namespace impl
+
+    inline namespace filesystem {
+        // A read-only memory mapping of a whole file, for reading without copying into buffers.
+        // In Unix the kernel is advised of sequential access. The file must not be truncated by
+        // others while it's mapped.
+        class Mapped_file
+        {
+            const Byte*     m_data;
+            size_t          m_size;
+
+        public:
+            explicit Mapped_file( in_<Path> path ):
+                m_data(), m_size()
+            { m_data = impl::map_file( path.fs_path(), m_size ); }
+
+            Mapped_file( Mapped_file&& other ) noexcept:
+                m_data( exchange( other.m_data, nullptr ) ),
+                m_size( exchange( other.m_size, 0 ) )
+            {}
+
+            auto operator=( Mapped_file&& other ) noexcept
+                -> Mapped_file&
+            {
+                Mapped_file discarded( move( *this ) );
+                m_data = exchange( other.m_data, nullptr );
+                m_size = exchange( other.m_size, 0 );
+                return *this;
+            }
+
+            ~Mapped_file() { if( m_data ) { impl::unmap_file( m_data, m_size ); } }
+
+            auto size() const noexcept -> size_t { return m_size; }
+            auto bytes() const noexcept -> Span<const Byte> { return {m_data, m_size}; }
+            auto text() const noexcept -> string_view { return {reinterpret_cast<const char*>( m_data ), m_size}; }
+        };
+    }  // inline namespace filesystem
+}  // namespace cppm
@@ -0,0 +1,45 @@
+// Implementation include.
+#include <cppm/filesystem/Mapped_output_file.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/stdlib_workarounds/fs_path.hpp>          // to_u8_string
+
+#include <errno.h>
+#include <fcntl.h>          // open, posix_fallocate
+#include <string.h>         // strerror
+#include <sys/mman.h>       // mmap, munmap
+#include <unistd.h>         // close, ftruncate
+
+// The file's blocks are allocated up front with `posix_fallocate`, so that a full disk is
+// reported here instead of as a SIGBUS when a page is written. A file system that doesn't support
+// that gets a sparse file extended with `ftruncate`.
+auto cppm::impl::map_output_file( in_<fs::path> path, const size_t capacity, intptr_t& handle )
+    -> Byte*
+{
+    const int fd = open( path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666 );
+    now( fd >= 0 ) or fail( "Failed to create “{}”: {}.", to_u8_string( path ), strerror( errno ) );
+    handle = fd;
+    if( capacity == 0 ) { return nullptr; }
+
+    const auto fail_with = [&]( const int error, const char* const action ) {
+        (void) ftruncate( fd, 0 );  close( fd );
+        fail( "Failed to {} “{}” with {} bytes: {}.", action, to_u8_string( path ), capacity, strerror( error ) );
+        };
+
+    int error = posix_fallocate( fd, 0, off_t( capacity ) );    // Returns the error, not via `errno`.
+    if( error == EOPNOTSUPP ) { error = (ftruncate( fd, off_t( capacity ) ) == 0? 0 : errno); }
+    if( error != 0 ) { fail_with( error, "allocate" ); }
+
+    void* const p = mmap( nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    if( p == MAP_FAILED ) { fail_with( errno, "map" ); }
+    return static_cast<Byte*>( p );
+}
+
+auto cppm::impl::unmap_output_file( Byte* const data, const size_t capacity, const intptr_t handle, const size_t size ) noexcept
+    -> bool
+{
+    const int fd = int( handle );
+    const bool is_unmapped = (not data or munmap( data, capacity ) == 0);
+    const bool is_truncated = (ftruncate( fd, off_t( size ) ) == 0);
+    const bool is_closed = (close( fd ) == 0);
+    return is_unmapped and is_truncated and is_closed;
+}
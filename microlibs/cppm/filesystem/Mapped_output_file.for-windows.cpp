@@ -0,0 +1,41 @@
+// Implementation include.
+#include <cppm/filesystem/Mapped_output_file.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/stdlib_workarounds/fs_path.hpp>          // to_u8_string
+
+#include <winapi/wrapped/windows-h.wide.hpp>
+
+// Creating the mapping with a size extends the file to that size.
+auto cppm::impl::map_output_file( in_<fs::path> path, const size_t capacity, intptr_t& handle )
+    -> Byte*
+{
+    const HANDLE file = CreateFileW(
+        path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+    now( file != INVALID_HANDLE_VALUE )
+        or fail( "Failed to create “{}”: error {}.", to_u8_string( path ), GetLastError() );
+    handle = reinterpret_cast<intptr_t>( file );
+    if( capacity == 0 ) { return nullptr; }
+
+    ULARGE_INTEGER size;  size.QuadPart = ULONGLONG( capacity );
+    const HANDLE mapping = CreateFileMappingW( file, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr );
+    void* const p = (mapping? MapViewOfFile( mapping, FILE_MAP_WRITE, 0, 0, 0 ) : nullptr);
+    const DWORD error = GetLastError();
+    if( mapping ) { CloseHandle( mapping ); }      // The view keeps the mapping.
+    if( not p ) {
+        CloseHandle( file );
+        fail( "Failed to map “{}” with {} bytes: error {}.", to_u8_string( path ), capacity, error );
+    }
+    return static_cast<Byte*>( p );
+}
+
+auto cppm::impl::unmap_output_file( Byte* const data, const size_t, const intptr_t handle, const size_t size ) noexcept
+    -> bool
+{
+    const HANDLE file = reinterpret_cast<HANDLE>( handle );
+    LARGE_INTEGER position;  position.QuadPart = LONGLONG( size );
+    const bool is_unmapped = (not data or UnmapViewOfFile( data ));
+    const bool is_truncated = (SetFilePointerEx( file, position, nullptr, FILE_BEGIN ) and SetEndOfFile( file ));
+    const bool is_closed = !!CloseHandle( file );
+    return is_unmapped and is_truncated and is_closed;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cppm/filesystem/Path.hpp>
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // intptr_t
+
+namespace cppm {
+    namespace impl {
+        // `map_output_file` `fail`s on errors. `handle` is a file descriptor or a `HANDLE`.
+        extern auto map_output_file( in_<fs::path> path, size_t capacity, intptr_t& handle ) -> Byte*;
+        extern auto unmap_output_file( Byte* data, size_t capacity, intptr_t handle, size_t size ) noexcept -> bool;
+    }  // namespace impl
+
+    inline namespace filesystem {
+        // A writable memory mapping of a new file of `capacity` bytes, for output of unknown size
+        // but known maximum size, e.g. of transcoding, directly into the page cache. `close` sets
+        // the final size. Without `close`, e.g. due to an exception, the file is left empty.
+        class Mapped_output_file:
+            public No_copy_or_move
+        {
+            Byte*           m_data;
+            size_t          m_capacity;
+            intptr_t        m_handle;
+            bool            m_is_open;
+
+        public:
+            // Creates or truncates the file.
+            Mapped_output_file( in_<Path> path, const size_t capacity ):
+                m_data(), m_capacity( capacity ), m_handle(), m_is_open( true )
+            { m_data = impl::map_output_file( path.fs_path(), capacity, m_handle ); }
+
+            ~Mapped_output_file() { if( m_is_open ) { impl::unmap_output_file( m_data, m_capacity, m_handle, 0 ); } }
+
+            auto capacity() const noexcept -> size_t { return m_capacity; }
+            auto bytes() const noexcept -> Span<Byte> { return {m_data, m_capacity}; }
+
+            // Unmaps and truncates the file to its first `size` bytes. `fail`s on errors.
+            void close( const size_t size )
+            {
+                m_is_open = false;
+                now( impl::unmap_output_file( m_data, m_capacity, m_handle, size ) )
+                    or fail( "Failed to finish writing a mapped file of {} bytes.", size );
+            }
+        };
+    }  // inline namespace filesystem
+}  // namespace cppm
@@ -4,13 +4,19 @@
 #include <fmt/core.h>
 #include <fmt/format.h>         // fmt::formatter<T>::format
 
+#include <string_view>
+
+// The UTF-8 bytes are written directly to the output, without a temporary `string`, and the
+// width, fill, alignment and precision specs work as for a `string_view`.
 template<>
 struct fmt::formatter<cppm::filesystem::Path>:
-    formatter<std::string>
+    formatter<std::string_view>
 {
-    // parse is inherited from `formatter<string>`.
+    // parse is inherited from `formatter<string_view>`.
 
-    auto format( const cppm::filesystem::Path& p, format_context& ctx )
-        -> auto
-    { return formatter<std::string>::format( p.str(), ctx ); }
+    // `const` because fmt 10 and later require that, and a template for any output context.
+    template< class Format_context >
+    auto format( const cppm::filesystem::Path& p, Format_context& ctx ) const
+        -> decltype( ctx.out() )
+    { return formatter<std::string_view>::format( p.str_view(), ctx ); }
 };
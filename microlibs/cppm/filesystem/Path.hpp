@@ -1,6 +1,7 @@
 #pragma once
 #include <cppm/stdlib_workarounds/fs_path.hpp>
-#include <cppm/basics/type_makers.hpp>                      // in_
+#include <cppm/basics/environment/os.hpp>           // CPPM_OS_IS_WINDOWS
+#include <cppm/basics/type_makers.hpp>              // in_
 
 #include <assert.h>
 #include <filesystem>
@@ -15,36 +16,59 @@ namespace cppm {
             std::move;              // <utility>
 
     inline namespace filesystem {
+        // The UTF-8 text is the primary representation, so that `str_view` never allocates. In
+        // Unix it's also the native representation, in an `fs::path`. In Windows an `fs::path`
+        // is built from it by `fs_path`, only for OS calls.
         class Path
         {
-            fs::path    m_path;
+        #if CPPM_OS_IS_WINDOWS
+            string      m_text;
+        #else
+            fs::path    m_path;         // `native()` is the UTF-8 text.
+        #endif
 
         public:
             Path() noexcept {}
 
-            Path( in_<string_view> spec ):
-                m_path( stdlib_workarounds::path_from_u8( spec ) )
-            {}
+        #if CPPM_OS_IS_WINDOWS
+            Path( in_<string_view> spec ): m_text( spec ) {}
+
+            Path( in_<Path> other ): m_text( other.m_text ) {}
+            Path( Path&& other ) noexcept : m_text( move( other.m_text ) ) {}
+
+            friend void swap( Path& a, Path& b ) noexcept { a.m_text.swap( b.m_text ); }
+
+            auto operator=( in_<Path> other ) -> Path& { m_text = other.m_text; return *this; }
+            auto operator=( Path&& other ) noexcept -> Path& { m_text = move( other.m_text ); return *this; }
+
+            auto str_view() const noexcept -> string_view { return m_text; }
+            auto fs_path() const -> fs::path { return stdlib_workarounds::path_from_u8( m_text ); }
+
+            static auto from_fs_path( in_<fs::path> p ) -> Path { return Path( stdlib_workarounds::to_u8_string( p ) ); }
+        #else
+            Path( in_<string_view> spec ): m_path( string( spec ) ) {}     // No conversion.
 
             Path( in_<Path> other ): m_path( other.m_path ) {}
             Path( Path&& other ) noexcept : m_path( move( other.m_path ) ) {}
 
-            friend
-            void swap( Path& a, Path& b ) noexcept
-            {
-                a.m_path.swap( b.m_path );
-            }
+            friend void swap( Path& a, Path& b ) noexcept { a.m_path.swap( b.m_path ); }
 
             auto operator=( in_<Path> other ) -> Path& { m_path = other.m_path; return *this; }
             auto operator=( Path&& other ) noexcept -> Path& { m_path = move( other.m_path ); return *this; }
 
-            auto is_empty() const noexcept -> bool { return m_path.empty(); }
+            auto str_view() const noexcept -> string_view { return m_path.native(); }
+            auto fs_path() const noexcept -> const fs::path& { return m_path; }     // For OS calls.
+
+            static auto from_fs_path( in_<fs::path> p ) -> Path { Path result;  result.m_path = p;  return result; }
+        #endif
+
+            auto is_empty() const noexcept -> bool { return str_view().empty(); }
 
-            auto str() const -> string { return stdlib_workarounds::to_u8_string( m_path ); }
+            auto str() const -> string { return string( str_view() ); }
             operator string () const { return str(); }      // File open & formatting support.
             auto operator-() const -> string { return str(); }          // Reduction to string.
         };
 
-        // inline auto format_as( in_<Path> p ) -> string { return p.str(); }   // Doesn't work. :(
+        // Formatting with fmt is supported by "Path.fmt.hpp", without allocation.
     }  // pseudo-inline namespace filesystem
 }  // namespace cppm
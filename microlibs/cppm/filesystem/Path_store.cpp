@@ -0,0 +1,212 @@
+// Implementation include.
+// Records are in blocks of 64Ki that are allocated as ids reach them, so that a record never
+// moves, and ids are reserved with a compare-exchange of an atomic counter, which is never
+// advanced beyond the last valid id. Names are interned in shards selected by
+// hash, each with a lock, an open addressing table and an arena of 64 KiB chunks, so that threads
+// that add different names rarely wait for each other.
+#include <cppm/filesystem/Path_store.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+
+#include <stdint.h>         // uint16_t
+#include <string.h>         // memcpy
+
+#include <algorithm>
+#include <functional>
+
+namespace cppm::impl {
+    using   std::max,               // <algorithm>
+            std::hash;              // <functional>
+
+    constexpr size_t name_chunk_size    = 64*1024;
+    constexpr size_t max_name_length    = 0xFFFF;
+
+    inline auto stored_name( const char* const p ) noexcept
+        -> string_view
+    {
+        uint16_t length;  memcpy( &length, p - 2, 2 );
+        return {p, length};
+    }
+
+    inline auto hash_of( in_<string_view> name ) noexcept -> size_t { return hash<string_view>()( name ); }
+}  // namespace cppm::impl
+
+struct cppm::filesystem::Path_store::Name_shard
+{
+    mutex                       access_mutex;
+    vector<const char*>         table;          // Power of 2 size, at most half full, `nullptr` is empty.
+    size_t                      n_names     = 0;
+    vector<unique_ptr<char[]>>  chunks;
+    size_t                      n_chunk_bytes   = 0;
+    char*                       free        = nullptr;
+    size_t                      n_free      = 0;
+
+    auto stored( in_<string_view> name )
+        -> const char*
+    {
+        const size_t n_needed = 2 + name.size();
+        if( n_free < n_needed ) {
+            const size_t size = impl::max( impl::name_chunk_size, n_needed );
+            chunks.push_back( unique_ptr<char[]>( new char[size] ) );
+            n_chunk_bytes += size;
+            free = chunks.back().get();  n_free = size;
+        }
+        const auto length = uint16_t( name.size() );
+        memcpy( free, &length, 2 );
+        memcpy( free + 2, name.data(), name.size() );
+        const char* const result = free + 2;
+        free += n_needed;  n_free -= n_needed;
+        return result;
+    }
+
+    void grow_table()
+    {
+        vector<const char*> new_table( impl::max<size_t>( 1024, 2*table.size() ) );
+        const size_t mask = new_table.size() - 1;
+        for( const char* const p: table ) {
+            if( not p ) { continue; }
+            size_t i = (impl::hash_of( impl::stored_name( p ) )/n_name_shards) & mask;
+            while( new_table[i] ) { i = (i + 1) & mask; }
+            new_table[i] = p;
+        }
+        table.swap( new_table );
+    }
+
+    auto interned( in_<string_view> name, const size_t hash )
+        -> const char*
+    {
+        const std::lock_guard<mutex> lock( access_mutex );
+        if( 2*(n_names + 1) > table.size() ) { grow_table(); }
+        const size_t mask = table.size() - 1;
+        size_t i = (hash/n_name_shards) & mask;
+        for( ;; ) {
+            if( not table[i] ) { break; }
+            if( impl::stored_name( table[i] ) == name ) { return table[i]; }
+            i = (i + 1) & mask;
+        }
+        ++n_names;
+        return table[i] = stored( name );
+    }
+};
+
+cppm::filesystem::Path_store::Path_store():
+    m_n_paths( 0 ),
+    m_blocks( new atomic<Record*>[max_blocks]() ),
+    m_blocks_mutex(),
+    m_block_storage(),
+    m_name_shards( new Name_shard[n_name_shards] )
+{}
+
+cppm::filesystem::Path_store::~Path_store() {}
+
+auto cppm::filesystem::Path_store::interned( in_<string_view> name )
+    -> const char*
+{
+    now( name.size() <= impl::max_name_length )
+        or fail( "A path store name can be at most {} bytes, but this has {}.", impl::max_name_length, name.size() );
+    const size_t hash = impl::hash_of( name );
+    return m_name_shards[hash % n_name_shards].interned( name, hash );
+}
+
+void cppm::filesystem::Path_store::ensure_blocks_for( const Path_id first, const size_t n )
+{
+    const size_t last_block = (size_t( first ) + n - 1) >> block_bits;
+    for( size_t i = first >> block_bits; i <= last_block; ++i ) {
+        if( m_blocks[i].load( std::memory_order_acquire ) ) { continue; }
+        const std::lock_guard<mutex> lock( m_blocks_mutex );
+        if( m_blocks[i].load( std::memory_order_relaxed ) ) { continue; }
+        m_block_storage.push_back( unique_ptr<Record[]>( new Record[block_size] ) );
+        m_blocks[i].store( m_block_storage.back().get(), std::memory_order_release );
+    }
+}
+
+auto cppm::filesystem::Path_store::reserved_ids( const size_t n )
+    -> Path_id
+{
+    Path_id first = m_n_paths.load( std::memory_order_relaxed );
+    do {
+        now( n <= size_t( no_path_id ) - first )
+            or fail( "A path store can hold at most {} paths.", no_path_id );
+    } while( not m_n_paths.compare_exchange_weak( first, Path_id( first + n ) ) );
+    return first;
+}
+
+auto cppm::filesystem::Path_store::add( const Path_id parent, in_<string_view> name )
+    -> Path_id
+{
+    const char* const stored = interned( name );
+    const Path_id id = reserved_ids( 1 );
+    ensure_blocks_for( id, 1 );
+    m_blocks[id >> block_bits].load( std::memory_order_relaxed )[id & (block_size - 1)] = {stored, parent};
+    return id;
+}
+
+auto cppm::filesystem::Path_store::add_all( const Path_id parent, in_<Span<const string_view>> names )
+    -> Path_id
+{
+    if( names.is_empty() ) { return no_path_id; }
+    vector<const char*> stored;
+    stored.reserve( names.size() );
+    for( const string_view& name: names ) { stored.push_back( interned( name ) ); }
+
+    const Path_id first = reserved_ids( names.size() );
+    ensure_blocks_for( first, names.size() );
+    for( size_t i = 0; i < names.size(); ++i ) {
+        const Path_id id = Path_id( first + i );
+        m_blocks[id >> block_bits].load( std::memory_order_relaxed )[id & (block_size - 1)] = {stored[i], parent};
+    }
+    return first;
+}
+
+auto cppm::filesystem::Path_store::name_of( const Path_id id ) const noexcept
+    -> string_view
+{ return impl::stored_name( record_of( id ).name ); }
+
+// The text is built from the end, with a first pass for the length, so there's no stack of ids.
+auto cppm::filesystem::Path_store::text_of( const Path_id id, string& buffer ) const
+    -> string_view
+{
+    const auto separator_after = []( in_<string_view> parent_name ) -> size_t {
+        return (parent_name.empty() or parent_name.back() == '/'? 0 : 1);
+        };
+
+    size_t length = 0;
+    for( Path_id i = id; i != no_path_id; ) {
+        length += name_of( i ).size();
+        i = parent_of( i );
+        if( i != no_path_id ) { length += separator_after( name_of( i ) ); }
+    }
+
+    buffer.resize( length );
+    size_t end = length;
+    for( Path_id i = id; i != no_path_id; ) {
+        const string_view name = name_of( i );
+        end -= name.size();
+        memcpy( &buffer[end], name.data(), name.size() );
+        i = parent_of( i );
+        if( i != no_path_id and separator_after( name_of( i ) ) ) { buffer[--end] = '/'; }
+    }
+    return buffer;
+}
+
+auto cppm::filesystem::Path_store::path_of( const Path_id id ) const
+    -> Path
+{
+    string buffer;
+    return Path( text_of( id, buffer ) );
+}
+
+auto cppm::filesystem::Path_store::n_bytes_allocated() const
+    -> size_t
+{
+    size_t result = max_blocks*sizeof( atomic<Record*> );
+    {
+        const std::lock_guard<mutex> lock( m_blocks_mutex );
+        result += m_block_storage.size()*block_size*sizeof( Record );
+    }
+    for( int i = 0; i < n_name_shards; ++i ) {
+        Name_shard& shard = m_name_shards[i];
+        const std::lock_guard<mutex> lock( shard.access_mutex );
+        result += shard.table.size()*sizeof( const char* ) + shard.n_chunk_bytes;
+    }
+    return result;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <cppm/filesystem/Path.hpp>
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint32_t
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cppm {
+    using   std::atomic,                // <atomic>
+            std::unique_ptr,            // <memory>
+            std::mutex,                 // <mutex>
+            std::string,                // <string>
+            std::string_view,           // <string_view>
+            std::vector;                // <vector>
+
+    inline namespace filesystem {
+        using Path_id = uint32_t;
+        constexpr Path_id no_path_id = Path_id( -1 );
+
+        // Interned paths for e.g. an index of a directory tree with tens of millions of entries. A
+        // path is a record of its parent's id and its name, where equal names are stored once, so
+        // the memory use is about 16 bytes per path plus the unique name bytes.
+        //
+        // `add` and `add_all` can be called from several threads. A thread can look up an id
+        // that it got from `add`, or that it got from another thread with synchronization, e.g.
+        // through a queue. Adding doesn't look up existing paths: a walk adds each entry once.
+        class Path_store:
+            public No_copy_or_move
+        {
+            struct Record
+            {
+                const char*     name;           // Preceded by its 16-bit length.
+                Path_id         parent;
+            };
+
+            static constexpr int        block_bits  = 16;
+            static constexpr size_t     block_size  = size_t( 1 ) << block_bits;
+            static constexpr size_t     max_blocks  = size_t( 1 ) << (32 - block_bits);
+
+            struct Name_shard;
+            static constexpr int        n_name_shards = 64;
+
+            atomic<Path_id>                     m_n_paths;
+            unique_ptr<atomic<Record*>[]>       m_blocks;
+            mutable mutex                       m_blocks_mutex;
+            vector<unique_ptr<Record[]>>        m_block_storage;
+            unique_ptr<Name_shard[]>            m_name_shards;
+
+            auto interned( in_<string_view> name ) -> const char*;
+            auto reserved_ids( size_t n ) -> Path_id;     // `fail`s if there's no room.
+            void ensure_blocks_for( Path_id first, size_t n );
+            auto record_of( const Path_id id ) const noexcept -> const Record&
+            { return m_blocks[id >> block_bits].load( std::memory_order_acquire )[id & (block_size - 1)]; }
+
+        public:
+            Path_store();
+            ~Path_store();
+
+            auto size() const noexcept -> size_t { return m_n_paths.load(); }
+
+            // A root, e.g. "/home" or "C:/data", is added with `no_path_id` as parent. A name is at
+            // most 65 535 bytes.
+            auto add( Path_id parent, in_<string_view> name ) -> Path_id;
+
+            // Adds e.g. the entries of a directory with consecutive ids. Returns the first id.
+            auto add_all( Path_id parent, in_<Span<const string_view>> names ) -> Path_id;
+
+            auto parent_of( Path_id id ) const noexcept -> Path_id { return record_of( id ).parent; }
+            auto name_of( Path_id id ) const noexcept -> string_view;
+
+            // The names from the root separated by "/". The view is of `buffer`, which is reused,
+            // so that there are no allocations once it's large enough.
+            auto text_of( Path_id id, string& buffer ) const -> string_view;
+            auto path_of( Path_id id ) const -> Path;
+
+            // Bytes allocated for records, names and the name lookup.
+            auto n_bytes_allocated() const -> size_t;
+        };
+    }  // inline namespace filesystem
+}  // namespace cppm
@@ -0,0 +1,206 @@
+// Implementation include.
+// Each thread has a deque of directories to read. It takes the most recently added directory from
+// its own deque, which is depth first and keeps the deques short, and when that's empty it steals
+// the oldest one from another thread's deque, which is likely the root of a large subtree. A
+// thread that finds no work waits on a condition variable until more is added or no directories
+// are left. A queued directory shares ownership of its open parent directory, which it's opened
+// relative to, so a parent stays open only until its last subdirectory has been opened.
+#include <cppm/filesystem/walk.hpp>
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/exception_handling/Scope_guard.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace cppm::impl {
+    using   std::max,                                       // <algorithm>
+            std::atomic,                                    // <atomic>
+            std::condition_variable,                        // <condition_variable>
+            std::deque,                                     // <deque>
+            std::exception_ptr,                             // <exception>
+            std::make_shared, std::shared_ptr,              // <memory>
+            std::unique_ptr,                                // <memory>
+            std::lock_guard, std::mutex, std::unique_lock,  // <mutex>
+            std::optional, std::nullopt,                    // <optional>
+            std::thread,                                    // <thread>
+            std::move;                                      // <utility>
+
+    struct Open_directory:
+        public No_copy_or_move
+    {
+        const intptr_t      handle;
+
+        ~Open_directory() { close_directory( handle ); }
+
+        explicit Open_directory( in_<string> root_path ): handle( open_walk_root( root_path ) ) {}
+
+        Open_directory( in_<Open_directory> parent, in_<string> path, const size_t name_start ):
+            handle( open_directory( parent.handle, path, name_start ) )
+        {}
+    };
+
+    struct Directory_job
+    {
+        string                              path;
+        size_t                              name_start;     // At the end for the root itself.
+        int                                 depth;
+        shared_ptr<const Open_directory>    parent;
+    };
+
+    struct alignas( 64 ) Walk_queue     // Aligned to not share a cache line with another queue.
+    {
+        mutex                   access_mutex;
+        deque<Directory_job>    jobs;
+    };
+
+    struct Walk_state:
+        public No_copy_or_move
+    {
+        const Walk_callback&        on_entry;
+        const int                   n_queues;
+        unique_ptr<Walk_queue[]>    queues;
+
+        atomic<size_t>              n_pending       = 0;    // Queued or being read.
+        atomic<size_t>              n_queued        = 0;
+        atomic<bool>                is_stopped      = false;
+        atomic<int>                 n_idle          = 0;
+        mutex                       idle_mutex;
+        condition_variable          work_changed;
+        exception_ptr               first_error;            // Guarded by `idle_mutex`.
+
+        Walk_state( in_<Walk_callback> a_on_entry, const int n ):
+            on_entry( a_on_entry ), n_queues( n ), queues( new Walk_queue[n] )
+        {}
+    };
+
+    inline auto path_joined( in_<string_view> directory, in_<string_view> name )
+        -> string
+    {
+        string result;
+        result.reserve( directory.size() + 1 + name.size() );
+        result += directory;
+        if( not directory.empty() and directory.back() != '/' ) { result += '/'; }
+        result += name;
+        return result;
+    }
+
+    // `n_queued` is incremented before `n_idle` is checked, and a waiting thread increments
+    // `n_idle` before it checks `n_queued`, so at least one of them sees the other's change. The
+    // notification is under `idle_mutex`, so it can't come between that check and the wait.
+    inline void push( Walk_state& state, const int i_queue, Directory_job job )
+    {
+        ++state.n_pending;
+        {
+            Walk_queue& queue = state.queues[i_queue];
+            const lock_guard<mutex> lock( queue.access_mutex );
+            queue.jobs.push_back( move( job ) );
+        }
+        ++state.n_queued;
+        if( state.n_idle.load() > 0 ) {
+            const lock_guard<mutex> lock( state.idle_mutex );
+            state.work_changed.notify_one();
+        }
+    }
+
+    inline auto popped( Walk_state& state, const int i_self )
+        -> optional<Directory_job>
+    {
+        for( int offset = 0; offset < state.n_queues; ++offset ) {
+            Walk_queue& queue = state.queues[(i_self + offset) % state.n_queues];
+            const lock_guard<mutex> lock( queue.access_mutex );
+            if( queue.jobs.empty() ) { continue; }
+            const bool is_own = (offset == 0);
+            optional<Directory_job> result( move( is_own? queue.jobs.back() : queue.jobs.front() ) );
+            if( is_own ) { queue.jobs.pop_back(); } else { queue.jobs.pop_front(); }
+            --state.n_queued;
+            return result;
+        }
+        return nullopt;
+    }
+
+    inline void read( Walk_state& state, const int i_self, Directory_job job, Directory_listing& listing )
+    {
+        const auto directory = make_shared<const Open_directory>( *job.parent, job.path, job.name_start );
+        job.parent.reset();         // Closed unless a sibling still needs it.
+        read_directory( directory->handle, job.path, listing );
+        for( const Listed_entry& entry: listing.entries ) {
+            const auto name = string_view( listing.names ).substr( entry.name_start, entry.name_size );
+            state.on_entry( Walk_entry{job.path, name, entry.kind, job.depth} );
+            if( entry.kind == Entry_kind::directory ) {
+                string path = path_joined( job.path, name );
+                const size_t name_start = path.size() - name.size();
+                push( state, i_self, Directory_job{move( path ), name_start, job.depth + 1, directory} );
+            }
+        }
+    }
+
+    inline void stop_with( Walk_state& state, const exception_ptr x )
+    {
+        const lock_guard<mutex> lock( state.idle_mutex );
+        if( not state.first_error ) { state.first_error = x; }
+        state.is_stopped = true;
+        state.work_changed.notify_all();
+    }
+
+    inline void work( Walk_state& state, const int i_self )
+    {
+        Directory_listing listing;      // Reused, so that reading doesn't allocate once it's large enough.
+        while( not state.is_stopped ) {
+            if( optional<Directory_job> job = popped( state, i_self ) ) {
+                try {
+                    read( state, i_self, move( *job ), listing );
+                } catch( ... ) {
+                    stop_with( state, std::current_exception() );
+                }
+                if( --state.n_pending == 0 ) {
+                    const lock_guard<mutex> lock( state.idle_mutex );
+                    state.work_changed.notify_all();
+                }
+                continue;
+            }
+
+            unique_lock<mutex> lock( state.idle_mutex );
+            ++state.n_idle;
+            state.work_changed.wait( lock, [&]{
+                return state.n_queued > 0 or state.n_pending == 0 or state.is_stopped;
+                } );
+            --state.n_idle;
+            if( state.n_pending == 0 or state.is_stopped ) { break; }
+        }
+    }
+}  // namespace cppm::impl
+
+void cppm::filesystem::walk( in_<Path> root, in_<Walk_callback> on_entry, const int n_threads )
+{
+    const auto root_path = string( root.str_view() );
+    const int n = (n_threads > 0? n_threads : int( impl::max( 1u, impl::thread::hardware_concurrency() ) ));
+
+    impl::Walk_state state( on_entry, n );
+    impl::push( state, 0, impl::Directory_job{
+        root_path, root_path.size(), 0, impl::make_shared<const impl::Open_directory>( root_path )
+        } );
+    {
+        vector<impl::thread> threads;
+        const Scope_guard joining( [&]{
+            for( impl::thread& t: threads ) { t.join(); }
+            } );
+        for( int i = 1; i < n; ++i ) {
+            try {
+                threads.emplace_back( [&state, i]{ impl::work( state, i ); } );
+            } catch( ... ) {        // Wakes the started threads, which then stop, and is rethrown.
+                impl::stop_with( state, std::current_exception() );
+                break;
+            }
+        }
+        impl::work( state, 0 );
+    }
+    if( state.first_error ) { std::rethrow_exception( state.first_error ); }
+}
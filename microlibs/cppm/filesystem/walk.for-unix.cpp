@@ -0,0 +1,120 @@
+// Implementation include.
+// A directory is opened with `openat` relative to its open parent directory, and in Linux it's
+// read with the `getdents64` system call into a buffer, which is fewer calls than `readdir`. An
+// entry kind that the file system doesn't report is found with `fstatat`.
+#include <cppm/filesystem/walk.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/basics/exception_handling/Scope_guard.hpp>
+
+#include <dirent.h>         // fdopendir, readdir, closedir, DT_...
+#include <errno.h>
+#include <fcntl.h>          // open, openat
+#include <string.h>         // memcpy, strerror, strlen
+#include <sys/stat.h>       // fstatat
+#include <unistd.h>         // close, dup
+#ifdef __linux__
+#   include <sys/syscall.h> // SYS_getdents64
+#endif
+
+namespace cppm::impl {
+    inline auto entry_kind_of_type( const unsigned char type ) noexcept
+        -> Entry_kind::Enum
+    {
+        using K = Entry_kind;
+        return (0? K::unknown
+            : type == DT_REG?       K::file
+            : type == DT_DIR?       K::directory
+            : type == DT_LNK?       K::symlink
+            : type == DT_UNKNOWN?   K::unknown
+            :                       K::other
+            );
+    }
+
+    inline auto entry_kind_of_mode( const mode_t mode ) noexcept
+        -> Entry_kind::Enum
+    {
+        using K = Entry_kind;
+        return (0? K::unknown
+            : S_ISREG( mode )?      K::file
+            : S_ISDIR( mode )?      K::directory
+            : S_ISLNK( mode )?      K::symlink
+            :                       K::other
+            );
+    }
+
+    inline void add_listed_entry(
+        const int dir_fd, const char* const name, const unsigned char type, Directory_listing& listing
+        )
+    {
+        if( name[0] == '.' and (name[1] == '\0' or (name[1] == '.' and name[2] == '\0')) ) { return; }
+        Entry_kind::Enum kind = entry_kind_of_type( type );
+        if( kind == Entry_kind::unknown ) {
+            struct stat info;
+            if( fstatat( dir_fd, name, &info, AT_SYMLINK_NOFOLLOW ) == 0 ) { kind = entry_kind_of_mode( info.st_mode ); }
+        }
+        const size_t name_size = strlen( name );
+        listing.entries.push_back( Listed_entry{listing.names.size(), name_size, kind} );
+        listing.names.append( name, name_size );
+    }
+}  // namespace cppm::impl
+
+auto cppm::impl::open_walk_root( in_<string> root_path )
+    -> intptr_t
+{
+    const int fd = open( root_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+    now( fd >= 0 ) or fail( "Failed to open the directory “{}”: {}.", root_path, strerror( errno ) );
+    return fd;
+}
+
+auto cppm::impl::open_directory( const intptr_t parent_handle, in_<string> path, const size_t name_start )
+    -> intptr_t
+{
+    const char* const name = (path.size() > name_start? path.c_str() + name_start : ".");
+    const int fd = openat( int( parent_handle ), name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC );
+    now( fd >= 0 ) or fail( "Failed to open the directory “{}”: {}.", path, strerror( errno ) );
+    return fd;
+}
+
+void cppm::impl::close_directory( const intptr_t handle ) noexcept
+{
+    close( int( handle ) );
+}
+
+void cppm::impl::read_directory( const intptr_t handle, in_<string> path, Directory_listing& listing )
+{
+    listing.names.clear();  listing.entries.clear();
+    const int fd = int( handle );
+
+    #ifdef SYS_getdents64
+        // A record is a 64-bit inode number, a 64-bit offset, a 16-bit record length, an 8-bit
+        // type and a zero-terminated name.
+        alignas( 8 ) char buffer[32*1024];
+        for( ;; ) {
+            const long n_bytes = syscall( SYS_getdents64, fd, buffer, sizeof( buffer ) );
+            if( n_bytes <= 0 ) {
+                now( n_bytes == 0 ) or fail( "Failed to read the directory “{}”: {}.", path, strerror( errno ) );
+                return;
+            }
+            for( long i = 0; i < n_bytes; ) {
+                unsigned short record_length;  memcpy( &record_length, buffer + i + 16, 2 );
+                add_listed_entry( fd, buffer + i + 19, static_cast<unsigned char>( buffer[i + 18] ), listing );
+                i += record_length;
+            }
+        }
+    #else
+        // `closedir` closes the descriptor, so the `DIR` gets a duplicate.
+        const int dir_fd = dup( fd );
+        DIR* const dir = (dir_fd >= 0? fdopendir( dir_fd ) : nullptr);
+        const int open_errno = errno;
+        if( dir_fd >= 0 and not dir ) { close( dir_fd ); }
+        now( dir != nullptr ) or fail( "Failed to read the directory “{}”: {}.", path, strerror( open_errno ) );
+        const Scope_guard closing( [&]{ closedir( dir ); } );
+
+        errno = 0;
+        while( const dirent* const p = readdir( dir ) ) {
+            add_listed_entry( fd, p->d_name, p->d_type, listing );
+            errno = 0;
+        }
+        now( errno == 0 ) or fail( "Failed to read the directory “{}”: {}.", path, strerror( errno ) );
+    #endif
+}
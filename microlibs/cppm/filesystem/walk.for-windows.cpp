@@ -0,0 +1,78 @@
+// Implementation include.
+// Directories are read with `FindFirstFileExW` without short names and with large fetches, and the
+// UTF-16 names are converted to UTF-8 directly into the listing.
+#include <cppm/filesystem/walk.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/stdlib_workarounds/fs_path.hpp>          // path_from_u8
+#include <cppm/utf8/transcoding.hpp>                    // to_utf8
+
+#include <winapi/wrapped/windows-h.wide.hpp>
+
+#include <wchar.h>          // wcslen
+
+#include <string_view>
+
+namespace cppm::impl {
+    using   std::u16string_view;        // <string_view>
+
+    inline auto entry_kind_of_attributes( const DWORD attributes ) noexcept
+        -> Entry_kind::Enum
+    {
+        using K = Entry_kind;
+        return (0? K::unknown
+            : attributes & FILE_ATTRIBUTE_REPARSE_POINT?    K::symlink
+            : attributes & FILE_ATTRIBUTE_DIRECTORY?        K::directory
+            : attributes & FILE_ATTRIBUTE_DEVICE?           K::other
+            :                                               K::file
+            );
+    }
+
+    inline void add_listed_entry( in_<WIN32_FIND_DATAW> data, Directory_listing& listing )
+    {
+        const wchar_t* const name = data.cFileName;
+        if( name[0] == L'.' and (name[1] == L'\0' or (name[1] == L'.' and name[2] == L'\0')) ) { return; }
+        const auto units = u16string_view( reinterpret_cast<const char16_t*>( name ), wcslen( name ) );
+        const size_t start = listing.names.size();
+        listing.names.resize( start + utf8::max_utf8_length_for_utf16( units.size() ) );
+        const utf8::Transcoding_result result = utf8::to_utf8( units, Span<char>( &listing.names[start], listing.names.size() - start ) );
+        now( bool( result ) ) or fail( "Invalid UTF-16 in a file name at unit offset {}.", result.n_read );
+        listing.names.resize( start + result.n_written );
+        listing.entries.push_back( Listed_entry{start, result.n_written, entry_kind_of_attributes( data.dwFileAttributes )} );
+    }
+}  // namespace cppm::impl
+
+auto cppm::impl::open_walk_root( in_<string> root_path )
+    -> intptr_t
+{
+    const DWORD attributes = GetFileAttributesW( path_from_u8( root_path ).c_str() );
+    now( attributes != INVALID_FILE_ATTRIBUTES and (attributes & FILE_ATTRIBUTE_DIRECTORY) )
+        or fail( "“{}” is not a directory.", root_path );
+    return 0;
+}
+
+auto cppm::impl::open_directory( const intptr_t, in_<string>, const size_t )
+    -> intptr_t
+{ return 0; }
+
+void cppm::impl::close_directory( const intptr_t ) noexcept {}
+
+void cppm::impl::read_directory( const intptr_t, in_<string> path, Directory_listing& listing )
+{
+    listing.names.clear();  listing.entries.clear();
+    const fs::path pattern = path_from_u8( path ) / L"*";
+    WIN32_FIND_DATAW data;
+    const HANDLE find = FindFirstFileExW(
+        pattern.c_str(), FindExInfoBasic, &data, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH
+        );
+    now( find != INVALID_HANDLE_VALUE )
+        or fail( "Failed to open the directory “{}”: error {}.", path, GetLastError() );
+    try {
+        do { add_listed_entry( data, listing ); } while( FindNextFileW( find, &data ) );
+    } catch( ... ) {
+        FindClose( find );
+        throw;
+    }
+    const DWORD error = GetLastError();
+    FindClose( find );
+    now( error == ERROR_NO_MORE_FILES ) or fail( "Failed to read the directory “{}”: error {}.", path, error );
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cppm/filesystem/Path.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // intptr_t
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cppm {
+    using   std::function,                  // <functional>
+            std::string,                    // <string>
+            std::string_view,               // <string_view>
+            std::vector;                    // <vector>
+
+    inline namespace filesystem {
+        // Symbolic links, including Windows junctions, are reported as `symlink` and not followed.
+        struct Entry_kind{ enum Enum{ unknown, file, directory, symlink, other }; };
+
+        struct Walk_entry
+        {
+            string_view         directory;      // The root as given, or that joined with "/" and names.
+            string_view         name;
+            Entry_kind::Enum    kind;
+            int                 depth;          // 0 for the entries of the root.
+        };
+
+        using Walk_callback = function<void( in_<Walk_entry> )>;
+
+        // Calls `on_entry` for every entry below `root`, except "." and "..", with UTF-8 texts.
+        // The calls are concurrent from `n_threads` threads, by default one per hardware thread,
+        // and in no particular order. The first exception, e.g. from a directory that can't be
+        // read, stops the walk and is rethrown.
+        extern void walk( in_<Path> root, in_<Walk_callback> on_entry, int n_threads = 0 );
+    }  // inline namespace filesystem
+
+    namespace impl {
+        struct Listed_entry{ size_t name_start; size_t name_size; Entry_kind::Enum kind; };
+
+        struct Directory_listing
+        {
+            string                  names;
+            vector<Listed_entry>    entries;
+        };
+
+        // A directory handle is an open directory in Unix, for `openat` of a subdirectory by its
+        // name, so that there's no limit on the path length, and unused in Windows. `path` is the
+        // directory's full path, with the name starting at `name_start`, or with `name_start` at
+        // the end for the directory itself. These `fail` on errors.
+        extern auto open_walk_root( in_<string> root_path ) -> intptr_t;
+        extern auto open_directory( intptr_t parent_handle, in_<string> path, size_t name_start ) -> intptr_t;
+        extern void close_directory( intptr_t handle ) noexcept;
+        extern void read_directory( intptr_t handle, in_<string> path, Directory_listing& listing );
+    }  // namespace impl
+}  // namespace cppm
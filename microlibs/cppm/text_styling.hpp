@@ -0,0 +1,3 @@
+#pragma once
+#include <cppm/text_styling/Styled_writer.hpp>
+#include <cppm/text_styling/Table_formatter.hpp>
@@ -0,0 +1,139 @@
+#pragma once
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <fmt/core.h>
+#include <fmt/format.h>         // fmt::memory_buffer
+
+#include <stddef.h>         // size_t
+
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace cppm {
+    using   std::string_view,               // <string_view>
+            std::forward;                   // <utility>
+
+    inline namespace text_styling {
+        // The 16 colors of the ANSI escape sequences, which a terminal may map to its own palette.
+        struct Ansi_color{ enum Enum{
+            black, red, green, yellow, blue, magenta, cyan, white,
+            bright_black, bright_red, bright_green, bright_yellow,
+            bright_blue, bright_magenta, bright_cyan, bright_white,
+            default_color,
+            _
+        }; };
+
+        struct Text_attributes{ enum Enum: unsigned{
+            none = 0, bold = 1, dim = 2, italic = 4, underline = 8, inverse = 16
+        }; };
+
+        struct Text_style
+        {
+            Ansi_color::Enum    fg          = Ansi_color::default_color;
+            Ansi_color::Enum    bg          = Ansi_color::default_color;
+            unsigned            attributes  = Text_attributes::none;
+
+            friend auto operator==( in_<Text_style> a, in_<Text_style> b ) noexcept
+                -> bool
+            { return a.fg == b.fg and a.bg == b.bg and a.attributes == b.attributes; }
+
+            friend auto operator!=( in_<Text_style> a, in_<Text_style> b ) noexcept
+                -> bool
+            { return not (a == b); }
+        };
+
+        constexpr auto fg( const Ansi_color::Enum color ) noexcept
+            -> Text_style
+        { return {color, Ansi_color::default_color, Text_attributes::none}; }
+    }  // inline namespace text_styling
+
+    namespace impl {
+        // SGR parameters, indexed by `Ansi_color::Enum`.
+        constexpr string_view sgr_fg_params[] =
+        {
+            "30", "31", "32", "33", "34", "35", "36", "37",
+            "90", "91", "92", "93", "94", "95", "96", "97",
+            "39"
+        };
+        constexpr string_view sgr_bg_params[] =
+        {
+            "40", "41", "42", "43", "44", "45", "46", "47",
+            "100", "101", "102", "103", "104", "105", "106", "107",
+            "49"
+        };
+        static_assert( std::size( sgr_fg_params ) == Ansi_color::_ );
+        static_assert( std::size( sgr_bg_params ) == Ansi_color::_ );
+
+        // Parameters to set and to reset each attribute, in the bit order of `Text_attributes`.
+        // Bold and dim share the reset 22, so turning off one of them may require restoring the other.
+        constexpr string_view sgr_attribute_on_params[]     = { "1", "2", "3", "4", "7" };
+        constexpr string_view sgr_attribute_off_params[]    = { "22", "22", "23", "24", "27" };
+        constexpr int n_text_attributes = 5;
+    }  // namespace impl
+
+    inline namespace text_styling {
+        // Text with ANSI SGR escape sequences, collected in one buffer that's reused after `clear`.
+        // The buffer is an `fmt::memory_buffer`, which fmt formats into faster than into a `string`.
+        // The style of the text written so far is tracked, so that an escape sequence is only
+        // produced when the style changes, and then only with the parameters that change.
+        class Styled_writer
+        {
+            fmt::memory_buffer  m_text;
+            Text_style          m_style;
+
+            void append( in_<string_view> s ) { m_text.append( s.data(), s.data() + s.size() ); }
+
+            void add_param( in_<string_view> param, bool& is_first )
+            {
+                append( is_first? "\x1B[" : ";" );
+                append( param );
+                is_first = false;
+            }
+
+        public:
+            explicit Styled_writer( const size_t capacity = 0 ): m_text(), m_style() { m_text.reserve( capacity ); }
+
+            auto text() const noexcept -> string_view { return {m_text.data(), m_text.size()}; }
+            auto style() const noexcept -> const Text_style& { return m_style; }
+
+            // Keeps the capacity and the tracked style, since that's the state of e.g. the terminal
+            // after the text has been output.
+            void clear() noexcept { m_text.clear(); }
+
+            void set_style( in_<Text_style> style )
+            {
+                if( style == m_style ) { return; }
+                bool is_first = true;
+                const unsigned turned_off = m_style.attributes & ~style.attributes;
+                unsigned turned_on = style.attributes & ~m_style.attributes;
+                for( int i = 0; i < impl::n_text_attributes; ++i ) {
+                    if( turned_off & (1u << i) ) { add_param( impl::sgr_attribute_off_params[i], is_first ); }
+                }
+                if( turned_off & (Text_attributes::bold | Text_attributes::dim) ) {
+                    turned_on |= style.attributes & (Text_attributes::bold | Text_attributes::dim);
+                }
+                for( int i = 0; i < impl::n_text_attributes; ++i ) {
+                    if( turned_on & (1u << i) ) { add_param( impl::sgr_attribute_on_params[i], is_first ); }
+                }
+                if( style.fg != m_style.fg ) { add_param( impl::sgr_fg_params[style.fg], is_first ); }
+                if( style.bg != m_style.bg ) { add_param( impl::sgr_bg_params[style.bg], is_first ); }
+                m_text.push_back( 'm' );
+                m_style = style;
+            }
+
+            void reset_style() { set_style( Text_style() ); }
+
+            void write( in_<string_view> s ) { append( s ); }
+            void write( in_<Text_style> style, in_<string_view> s ) { set_style( style );  append( s ); }
+
+            // Formats directly into the buffer, so that e.g. field widths apply to the text only.
+            template< class... Args >
+            void print( in_<Text_style> style, fmt::format_string<Args...> format, Args&&... args )
+            {
+                set_style( style );
+                fmt::format_to( std::back_inserter( m_text ), format, forward<Args>( args )... );
+            }
+        };
+    }  // inline namespace text_styling
+}  // namespace cppm
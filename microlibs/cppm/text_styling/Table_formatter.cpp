@@ -0,0 +1,175 @@
+// Implementation include.
+// The cells of a window are copied into one string, with their end offsets and measured widths in
+// a vector, so that buffering a row costs no allocations once the buffers have grown. The widths
+// are measured when a row is added, and the window's cells are just laid out when it's formatted.
+#include <cppm/text_styling/Table_formatter.hpp>
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+#include <cppm/utf8/display_width.hpp>
+#include <cppm/utf8/grapheme_segmentation.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace cppm {
+    using   std::move;              // <utility>
+}  // namespace cppm
+
+namespace cppm::impl {
+    using   std::max, std::min;     // <algorithm>
+}  // namespace cppm::impl
+
+cppm::Table_formatter::~Table_formatter()
+{
+    try {
+        flush();
+    } catch( ... ) {
+        // Nothing to do about it.
+    }
+}
+
+cppm::Table_formatter::Table_formatter(
+    vector<Table_column>    columns,
+    Output                  output,
+    string                  separator,
+    const size_t            window_size
+    ):
+    m_columns( move( columns ) ),
+    m_widths(),
+    m_window_widths( m_columns.size(), 0 ),
+    m_separator( move( separator ) ),
+    m_output( move( output ) ),
+    m_window_size( 0 ),
+    m_width_cache(),
+    m_window_text(),
+    m_window_cells(),
+    m_n_window_rows( 0 ),
+    m_row(),
+    m_text()
+{
+    now( not m_columns.empty() ) or fail( "A table needs at least one column." );
+    for( const Table_column& column: m_columns ) {
+        now( column.width >= 0 and column.max_width >= 0 ) or fail( "A column width can't be negative." );
+        m_widths.push_back( impl::max( column.width, 1 ) );
+        if( column.width == 0 ) { m_window_size = impl::max<size_t>( window_size, 1 ); }
+    }
+    m_text.reserve( output_block_size + output_block_size/4 );
+}
+
+void cppm::Table_formatter::add_padding( int n )
+{
+    static constexpr char spaces[] = "                                                                ";
+    constexpr int n_spaces = int( sizeof( spaces ) - 1 );
+    for( ; n > 0; n -= n_spaces ) { m_text.append( spaces, size_t( impl::min( n, n_spaces ) ) ); }
+}
+
+void cppm::Table_formatter::add_cell( in_<Cell> cell, const int i_column )
+{
+    const Column_alignment::Enum alignment = m_columns[size_t( i_column )].alignment;
+    const int column_width = m_widths[size_t( i_column )];
+    const bool is_last = (i_column + 1 == int( m_columns.size() ));
+    if( is_last and cell.text.empty() ) { return; }
+
+    string_view text = cell.text;
+    int width = cell.width;
+    const bool is_truncated = (width > column_width);
+    if( is_truncated ) {                // Whole clusters that leave room for the “…”.
+        width = 1;
+        const char* end = text.data();
+        for( const string_view cluster: utf8::graphemes( text ) ) {
+            const int cluster_width = utf8::display_width( cluster );
+            if( width + cluster_width > column_width ) { break; }
+            width += cluster_width;
+            end = cluster.data() + cluster.size();
+        }
+        text = string_view( text.data(), size_t( end - text.data() ) );
+    }
+
+    const int n_padding = column_width - width;
+    const int n_left = (0?0
+        : alignment == Column_alignment::right?     n_padding
+        : alignment == Column_alignment::center?    n_padding/2
+        :                                           0
+        );
+    add_padding( n_left );
+    m_text.append( text.data(), text.size() );
+    if( is_truncated ) { m_text += "…"; }
+    if( not is_last ) { add_padding( n_padding - n_left ); }
+}
+
+void cppm::Table_formatter::add_formatted_row( in_<Span<const Cell>> cells )
+{
+    const int n_columns = int( m_columns.size() );
+    for( int i = 0; i < n_columns; ++i ) {
+        if( i > 0 ) { m_text += m_separator; }
+        add_cell( (size_t( i ) < cells.size()? cells[size_t( i )] : Cell{"", 0}), i );
+    }
+    m_text += '\n';
+    if( m_text.size() >= output_block_size ) { output_text(); }
+}
+
+void cppm::Table_formatter::format_window()
+{
+    const size_t n_columns = m_columns.size();
+    for( size_t i = 0; i < n_columns; ++i ) {
+        const Table_column& column = m_columns[i];
+        if( column.width != 0 ) { continue; }
+        int width = impl::max( m_widths[i], m_window_widths[i] );
+        if( column.max_width > 0 ) { width = impl::min( width, column.max_width ); }
+        m_widths[i] = impl::max( width, 1 );
+        m_window_widths[i] = 0;
+    }
+
+    const auto all_text = string_view( m_window_text );
+    size_t start = 0;
+    for( size_t i_row = 0; i_row < m_n_window_rows; ++i_row ) {
+        m_row.clear();
+        for( size_t i = 0; i < n_columns; ++i ) {
+            const Buffered_cell& cell = m_window_cells[i_row*n_columns + i];
+            m_row.push_back( Cell{all_text.substr( start, cell.end - start ), cell.width} );
+            start = cell.end;
+        }
+        add_formatted_row( m_row );
+    }
+    m_window_text.clear();
+    m_window_cells.clear();
+    m_n_window_rows = 0;
+}
+
+void cppm::Table_formatter::output_text()
+{
+    if( m_text.empty() ) { return; }
+    m_output( m_text );
+    m_text.clear();
+}
+
+void cppm::Table_formatter::add_row( in_<Span<const string_view>> cells )
+{
+    const size_t n_columns = m_columns.size();
+    now( cells.size() <= n_columns )
+        or fail( "A row with {} cells for a table with {} columns.", cells.size(), n_columns );
+
+    if( m_window_size == 0 ) {
+        m_row.clear();
+        for( const string_view& text: cells ) { m_row.push_back( Cell{text, m_width_cache.width_of( text )} ); }
+        add_formatted_row( m_row );
+        return;
+    }
+
+    for( size_t i = 0; i < n_columns; ++i ) {
+        int width = 0;
+        if( i < cells.size() ) {
+            m_window_text += cells[i];
+            width = m_width_cache.width_of( cells[i] );
+        }
+        m_window_cells.push_back( Buffered_cell{m_window_text.size(), width} );
+        m_window_widths[i] = impl::max( m_window_widths[i], width );
+    }
+    ++m_n_window_rows;
+    if( m_n_window_rows == m_window_size ) { format_window(); }
+}
+
+void cppm::Table_formatter::flush()
+{
+    if( m_n_window_rows > 0 ) { format_window(); }
+    output_text();
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <cppm/basics/class_kinds/No_copy_or_move.hpp>
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+#include <cppm/utf8/Display_width_cache.hpp>
+
+#include <stddef.h>         // size_t
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cppm {
+    using   std::function,                  // <functional>
+            std::initializer_list,          // <initializer_list>
+            std::string,                    // <string>
+            std::string_view,               // <string_view>
+            std::vector;                    // <vector>
+
+    inline namespace text_styling {
+        struct Column_alignment{ enum Enum{ left, right, center }; };
+
+        struct Table_column
+        {
+            int                     width       = 0;        // 0 for auto-sized, see `Table_formatter`.
+            Column_alignment::Enum  alignment   = Column_alignment::left;
+            int                     max_width   = 0;        // For auto-sized, 0 for no limit.
+        };
+
+        // Lays out rows of UTF-8 cells in columns by display width, e.g. for a report. A cell that's
+        // wider than its column is truncated at a grapheme cluster boundary and ends with “…”. The
+        // last column isn't padded at the right, so lines don't end with spaces.
+        //
+        // With only fixed widths each row is formatted when it's added. An auto-sized column is as
+        // wide as the widest cell so far, so then rows are kept in a window of `window_size` rows,
+        // which is formatted when it's full: memory is bounded by the window, not the table. Column
+        // widths only grow, so a later window can be wider but never misaligns narrower.
+        //
+        // The text is passed to `output` in blocks of about `output_block_size` bytes, and at
+        // `flush` and destruction. Widths of short non-ASCII cells are cached, and the buffers are
+        // reused, so that millions of rows don't mean millions of measurements or allocations.
+        class Table_formatter:
+            public No_copy_or_move
+        {
+        public:
+            using Output = function<void( in_<string_view> )>;
+
+            static constexpr size_t default_window_size     = 1000;
+            static constexpr size_t output_block_size       = 64*1024;
+
+        private:
+            struct Cell{ string_view text; int width; };
+            struct Buffered_cell{ size_t end; int width; };
+
+            vector<Table_column>        m_columns;
+            vector<int>                 m_widths;
+            vector<int>                 m_window_widths;
+            string                      m_separator;
+            Output                      m_output;
+            size_t                      m_window_size;          // 0 when all widths are fixed.
+            utf8::Display_width_cache   m_width_cache;
+            string                      m_window_text;
+            vector<Buffered_cell>       m_window_cells;
+            size_t                      m_n_window_rows;
+            vector<Cell>                m_row;
+            string                      m_text;
+
+            void add_padding( int n );
+            void add_cell( in_<Cell> cell, int i_column );
+            void add_formatted_row( in_<Span<const Cell>> cells );
+            void format_window();
+            void output_text();
+
+        public:
+            ~Table_formatter();         // Outputs all remaining text, ignoring errors.
+
+            Table_formatter(
+                vector<Table_column>    columns,
+                Output                  output,
+                string                  separator       = " ",
+                size_t                  window_size     = default_window_size
+                );
+
+            // Missing cells at the end are empty.
+            void add_row( in_<Span<const string_view>> cells );
+            void add_row( const initializer_list<string_view> cells ) { add_row( Span<const string_view>( cells.begin(), cells.size() ) ); }
+
+            void flush();
+
+            auto column_widths() const noexcept -> const vector<int>& { return m_widths; }
+            auto width_cache() const noexcept -> const utf8::Display_width_cache& { return m_width_cache; }
+        };
+    }  // inline namespace text_styling
+}  // namespace cppm
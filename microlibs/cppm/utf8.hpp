@@ -1,2 +1,12 @@
 #pragma once
+#include <cppm/utf8/Display_width_cache.hpp>
+#include <cppm/utf8/case_folding.hpp>
+#include <cppm/utf8/code_points.hpp>
+#include <cppm/utf8/display_width.hpp>
 #include <cppm/utf8/encoding_assumption_checking.hpp>
+#include <cppm/utf8/encoding_detection.hpp>
+#include <cppm/utf8/grapheme_segmentation.hpp>
+#include <cppm/utf8/normalization.hpp>
+#include <cppm/utf8/stream_decoding.hpp>
+#include <cppm/utf8/transcoding.hpp>
+#include <cppm/utf8/validation.hpp>
@@ -0,0 +1,93 @@
+#pragma once
+#include <cppm/utf8/display_width.hpp>
+#include <cppm/basics/type_makers.hpp>              // in_
+
+#include <stddef.h>         // size_t
+#include <stdint.h>         // uint64_t
+#include <string.h>         // memcpy, memcmp
+
+#include <string_view>
+#include <vector>
+
+namespace cppm::utf8 {
+    using   std::string_view,           // <string_view>
+            std::vector;                // <vector>
+
+    inline namespace width_measuring {
+        // Display widths of recently measured short non-ASCII texts, e.g. the cells of a report
+        // where the same names and labels recur. It's a direct mapped hash table: each text has one
+        // slot, and a new text just replaces the one there, so the memory is fixed. Printable ASCII
+        // isn't cached since measuring it is as fast as hashing it.
+        class Display_width_cache
+        {
+        public:
+            static constexpr size_t max_text_size       = 48;
+            static constexpr size_t default_n_slots     = 1024;
+
+        private:
+            struct Slot
+            {
+                uint64_t    hash;
+                int         size;           // -1 for an unused slot.
+                int         width;
+                char        text[max_text_size];
+            };
+
+            vector<Slot>    m_slots;
+            size_t          m_n_hits;
+            size_t          m_n_misses;
+
+            // A hash of 8 bytes at a time, which also tells whether any byte is non-ASCII.
+            static auto hash_of( in_<string_view> s, bool& has_non_ascii ) noexcept
+                -> uint64_t
+            {
+                constexpr uint64_t high_bits = 0x8080'8080'8080'8080;
+                uint64_t h = s.size();
+                uint64_t all_bits = 0;
+                const char* p = s.data();
+                for( size_t n_left = s.size(); n_left > 0; ) {
+                    const size_t n = (n_left < 8? n_left : 8);
+                    uint64_t word = 0;  memcpy( &word, p, n );
+                    all_bits |= word;
+                    h = (h ^ word)*0x9E37'79B9'7F4A'7C15;
+                    h ^= h >> 29;
+                    p += n;  n_left -= n;
+                }
+                has_non_ascii = ((all_bits & high_bits) != 0);
+                return h;
+            }
+
+        public:
+            // `n_slots` is rounded up to a power of 2.
+            explicit Display_width_cache( const size_t n_slots = default_n_slots ):
+                m_slots(), m_n_hits( 0 ), m_n_misses( 0 )
+            {
+                size_t n = 1;
+                while( n < n_slots ) { n *= 2; }
+                m_slots.assign( n, Slot{0, -1, 0, {}} );
+            }
+
+            auto n_hits() const noexcept -> size_t { return m_n_hits; }
+            auto n_misses() const noexcept -> size_t { return m_n_misses; }
+
+            auto width_of( in_<string_view> s ) noexcept
+                -> int
+            {
+                if( s.size() > max_text_size ) { return display_width( s ); }
+                bool has_non_ascii;
+                const uint64_t hash = hash_of( s, has_non_ascii );
+                if( not has_non_ascii ) { return display_width( s ); }
+
+                Slot& slot = m_slots[hash & (m_slots.size() - 1)];
+                if( slot.hash == hash and slot.size == int( s.size() ) and memcmp( slot.text, s.data(), s.size() ) == 0 ) {
+                    ++m_n_hits;
+                    return slot.width;
+                }
+                ++m_n_misses;
+                slot.hash = hash;  slot.size = int( s.size() );  slot.width = display_width( s );
+                memcpy( slot.text, s.data(), s.size() );
+                return slot.width;
+            }
+        };
+    }  // inline namespace width_measuring
+}  // namespace cppm::utf8
@@ -0,0 +1,414 @@
+// Implementation include.
+// Full case folding, and caseless comparison and hashing that fold on the fly. Each side is read
+// as a sequence of folded code points, where a code point that folds to 2 or 3 leaves the rest
+// pending. When neither side has pending code points, a SIMD kernel skips the common prefix of
+// bytes that are equal with ASCII letters folded, which is most of the work for e.g. file names.
+#include <cppm/utf8/case_folding.hpp>
+#include <cppm/utf8/case_folding.tables.hpp>
+#include <cppm/utf8/code_points.hpp>            // valid_sequence_at, encode_utf8, append_utf8_encoding_of
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/bits.hpp>                 // n_trailing_zeros
+
+#include <stdint.h>         // uint64_t
+#include <string.h>         // memcpy
+
+#include <algorithm>
+
+namespace cppm::utf8::impl {
+    using   std::min;       // <algorithm>
+
+    constexpr auto folding_index_of( const char32_t code ) noexcept
+        -> int
+    {
+        namespace t = case_folding_tables;
+        constexpr char32_t offset_mask = (1 << t::block_bits) - 1;
+        return t::blocks[t::block_index[code >> t::block_bits]][code & offset_mask];
+    }
+
+    constexpr auto ascii_folded( const Byte b ) noexcept
+        -> Byte
+    { return Byte( 'A' <= b and b <= 'Z'? b | 0x20 : b ); }
+
+    namespace swar {
+        constexpr uint64_t ones         = 0x0101'0101'0101'0101;
+        constexpr uint64_t high_bits    = 0x8080'8080'8080'8080;
+
+        // Each ASCII byte of `word` case folded, i.e. A through Z to lowercase. Other bytes are
+        // unchanged. The sums are of the low 7 bits only so that they don't carry between bytes.
+        constexpr auto ascii_folded( const uint64_t word ) noexcept
+            -> uint64_t
+        {
+            const uint64_t low_bits = word & ~high_bits;
+            const uint64_t is_at_or_above_a = low_bits + (0x80 - 'A')*ones;
+            const uint64_t is_above_z       = low_bits + (0x80 - 'Z' - 1)*ones;
+            const uint64_t is_upper = is_at_or_above_a & ~is_above_z & ~word & high_bits;
+            return word | (is_upper >> 2);
+        }
+
+        // High bit set in each byte that's non-zero.
+        constexpr auto nonzero_bytes_in( const uint64_t word ) noexcept
+            -> uint64_t
+        { return (((word & ~high_bits) + ~high_bits) | word) & high_bits; }
+    }  // namespace swar
+
+    // Length of the longest common prefix of `a` and `b`, of at most `n` bytes, with the ASCII
+    // letters case folded. It can end within a UTF-8 sequence.
+    inline auto scalar_common_prefix_length( const Byte* const a, const Byte* const b, const size_t n ) noexcept
+        -> size_t
+    {
+        size_t i = 0;
+        for( ; n - i >= 8; i += 8 ) {
+            uint64_t word_a;  memcpy( &word_a, a + i, 8 );
+            uint64_t word_b;  memcpy( &word_b, b + i, 8 );
+            const uint64_t differences = swar::ascii_folded( word_a ) ^ swar::ascii_folded( word_b );
+            if( differences ) { return i + n_trailing_zeros( swar::nonzero_bytes_in( differences ) )/8; }
+        }
+        while( i < n and ascii_folded( a[i] ) == ascii_folded( b[i] ) ) { ++i; }
+        return i;
+    }
+}  // namespace cppm::utf8::impl
+
+#if CPPM_CPU_IS_X86
+namespace cppm::utf8::impl::case_folding_kernels {
+    // A through Z are found with signed comparisons, where non-ASCII bytes are negative.
+    namespace sse4_2 {
+        using V = __m128i;
+
+        CPPM_TARGET_SSE4_2
+        inline auto ascii_folded( const V v ) noexcept
+            -> V
+        {
+            const V is_upper = _mm_and_si128(
+                _mm_cmpgt_epi8( v, _mm_set1_epi8( 'A' - 1 ) ), _mm_cmpgt_epi8( _mm_set1_epi8( 'Z' + 1 ), v )
+                );
+            return _mm_or_si128( v, _mm_and_si128( is_upper, _mm_set1_epi8( 0x20 ) ) );
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto common_prefix_length( const Byte* const a, const Byte* const b, const size_t n ) noexcept
+            -> size_t
+        {
+            size_t i = 0;
+            for( ; n - i >= 16; i += 16 ) {
+                const V va = _mm_loadu_si128( reinterpret_cast<const V*>( a + i ) );
+                const V vb = _mm_loadu_si128( reinterpret_cast<const V*>( b + i ) );
+                const int is_equal = _mm_movemask_epi8( _mm_cmpeq_epi8( ascii_folded( va ), ascii_folded( vb ) ) );
+                if( const int differences = ~is_equal & 0xFFFF ) {
+                    return i + n_trailing_zeros( differences );
+                }
+            }
+            return i + scalar_common_prefix_length( a + i, b + i, n - i );
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        using V = __m256i;
+
+        CPPM_TARGET_AVX2
+        inline auto ascii_folded( const V v ) noexcept
+            -> V
+        {
+            const V is_upper = _mm256_and_si256(
+                _mm256_cmpgt_epi8( v, _mm256_set1_epi8( 'A' - 1 ) ), _mm256_cmpgt_epi8( _mm256_set1_epi8( 'Z' + 1 ), v )
+                );
+            return _mm256_or_si256( v, _mm256_and_si256( is_upper, _mm256_set1_epi8( 0x20 ) ) );
+        }
+
+        CPPM_TARGET_AVX2
+        auto common_prefix_length( const Byte* const a, const Byte* const b, const size_t n ) noexcept
+            -> size_t
+        {
+            size_t i = 0;
+            for( ; n - i >= 32; i += 32 ) {
+                const V va = _mm256_loadu_si256( reinterpret_cast<const V*>( a + i ) );
+                const V vb = _mm256_loadu_si256( reinterpret_cast<const V*>( b + i ) );
+                const V is_equal = _mm256_cmpeq_epi8( ascii_folded( va ), ascii_folded( vb ) );
+                if( const unsigned differences = ~unsigned( _mm256_movemask_epi8( is_equal ) ) ) {
+                    return i + n_trailing_zeros( differences );
+                }
+            }
+            return i + sse4_2::common_prefix_length( a + i, b + i, n - i );
+        }
+    }  // namespace avx2
+}  // namespace cppm::utf8::impl::case_folding_kernels
+#endif
+
+namespace cppm::utf8::impl {
+    using Prefix_matcher = auto( const Byte*, const Byte*, size_t ) noexcept -> size_t;
+
+    inline auto prefix_matcher_for( const Simd_level::Enum level ) noexcept
+        -> Prefix_matcher*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = case_folding_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    [[fallthrough]];
+                case Simd_level::avx2:      return k::avx2::common_prefix_length;
+                case Simd_level::sse4_2:    return k::sse4_2::common_prefix_length;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return scalar_common_prefix_length;
+    }
+
+    inline auto the_prefix_matcher() noexcept
+        -> Prefix_matcher&
+    {
+        static Prefix_matcher* const the_matcher = prefix_matcher_for( Simd_level::_ );
+        return *the_matcher;
+    }
+
+    // An invalid byte `b` is represented as `invalid_byte_base + b`, above all code points.
+    constexpr char32_t invalid_byte_base    = 0x110000;
+    constexpr char32_t end_of_text          = char32_t( -1 );
+
+    class Folded_code_points
+    {
+        const Byte*     m_position;
+        const Byte*     m_end;
+        char32_t        m_pending[2];       // In reverse order.
+        int             m_n_pending;
+
+    public:
+        Folded_code_points( in_<string_view> s ) noexcept:
+            m_position( reinterpret_cast<const Byte*>( s.data() ) ),
+            m_end( m_position + s.size() ),
+            m_pending(),
+            m_n_pending( 0 )
+        {}
+
+        auto position() const noexcept -> const Byte* { return m_position; }
+        auto n_remaining_bytes() const noexcept -> size_t { return size_t( m_end - m_position ); }
+        void skip( const size_t n ) noexcept { m_position += n; }
+
+        auto end() const noexcept -> const Byte* { return m_end; }
+        auto has_pending() const noexcept -> bool { return m_n_pending > 0; }
+
+        // The next folded code point, or an invalid byte's value, or `end_of_text`.
+        auto next() noexcept
+            -> char32_t
+        {
+            if( m_n_pending > 0 ) { return m_pending[--m_n_pending]; }
+            if( m_position == m_end ) { return end_of_text; }
+
+            const Byte lead = *m_position;
+            if( lead < 0x80 ) { ++m_position;  return ascii_folded( lead ); }
+            char32_t code;
+            const int length = valid_sequence_at( m_position, m_end, code );
+            if( length == 0 ) { ++m_position;  return invalid_byte_base + lead; }
+            m_position += length;
+
+            const int i = folding_index_of( code );
+            if( i == 0 ) { return code; }
+            const char32_t* const folding = case_folding_tables::foldings[i];
+            if( folding[2] != 0 ) {
+                m_pending[0] = folding[2];  m_pending[1] = folding[1];  m_n_pending = 2;
+            } else if( folding[1] != 0 ) {
+                m_pending[0] = folding[1];  m_n_pending = 1;
+            }
+            return folding[0];
+        }
+    };
+
+    // True if a valid sequence at `p[i]` extends to or beyond `p[n]`.
+    inline auto is_sequence_across( const Byte* const p, const Byte* const end, const size_t i, const size_t n ) noexcept
+        -> bool
+    {
+        char32_t code;
+        const int length = valid_sequence_at( p + i, end, code );
+        return i + length > n;
+    }
+
+    // Skips the common prefix that's equal with ASCII letters folded, and so has equal foldings,
+    // up to the start of the sequence that it ends within, if any. Any non-continuation byte is
+    // the start of a sequence, valid or not, so only the last 3 bytes need to be checked.
+    inline void skip_common_prefix( Prefix_matcher& match, Folded_code_points& a, Folded_code_points& b ) noexcept
+    {
+        if( a.has_pending() or b.has_pending() ) { return; }
+        const Byte* const pa = a.position();
+        const Byte* const pb = b.position();
+        if( pa == a.end() or pb == b.end() or ascii_folded( *pa ) != ascii_folded( *pb ) ) { return; }
+
+        size_t n = match( pa, pb, min( a.n_remaining_bytes(), b.n_remaining_bytes() ) );
+        for( size_t i = n; i > 0 and n - i < 3; ) {
+            --i;
+            if( is_continuation_byte( pa[i] ) ) { continue; }
+            if( is_sequence_across( pa, a.end(), i, n ) or is_sequence_across( pb, b.end(), i, n ) ) { n = i; }
+            break;
+        }
+        a.skip( n );  b.skip( n );
+    }
+
+    inline auto equal_ci_using( Prefix_matcher& match, in_<string_view> s_a, in_<string_view> s_b ) noexcept
+        -> bool
+    {
+        Folded_code_points a( s_a );
+        Folded_code_points b( s_b );
+        for( ;; ) {
+            skip_common_prefix( match, a, b );
+            const char32_t code_a = a.next();
+            if( code_a != b.next() ) { return false; }
+            if( code_a == end_of_text ) { return true; }
+        }
+    }
+
+    // Accumulates bytes into 64-bit words that are mixed into the hash.
+    class Hasher
+    {
+        uint64_t    m_hash          = 0;
+        uint64_t    m_word          = 0;
+        int         m_n_word_bytes  = 0;
+        uint64_t    m_n_bytes       = 0;
+
+        void mix( const uint64_t word ) noexcept
+        {
+            m_hash = (m_hash ^ word)*0x9E37'79B9'7F4A'7C15;
+            m_hash ^= m_hash >> 29;
+        }
+
+    public:
+        void add_byte( const Byte b ) noexcept
+        {
+            m_word |= uint64_t( b ) << (8*m_n_word_bytes);
+            ++m_n_bytes;
+            if( ++m_n_word_bytes == 8 ) {
+                mix( m_word );
+                m_word = 0;  m_n_word_bytes = 0;
+            }
+        }
+
+        // The 8 bytes of `word` in little-endian order.
+        void add_word( const uint64_t word ) noexcept
+        {
+            m_n_bytes += 8;
+            if( m_n_word_bytes == 0 ) {
+                mix( word );
+            } else {
+                const int shift = 8*m_n_word_bytes;
+                mix( m_word | (word << shift) );
+                m_word = word >> (64 - shift);
+            }
+        }
+
+        auto result() const noexcept
+            -> uint64_t
+        {
+            Hasher final_state = *this;
+            final_state.mix( m_word );
+            final_state.mix( m_n_bytes );
+            return final_state.m_hash;
+        }
+    };
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    auto case_folding::to_case_folded( in_<string_view> s )
+        -> string
+    {
+        string result;
+        result.reserve( s.size() );
+        const auto end = reinterpret_cast<const Byte*>( s.data() + s.size() );
+        auto p = reinterpret_cast<const Byte*>( s.data() );
+        while( p != end ) {
+            if( end - p >= 8 ) {
+                uint64_t word;  memcpy( &word, p, 8 );
+                if( (word & impl::swar::high_bits) == 0 ) {
+                    word = impl::swar::ascii_folded( word );
+                    result.append( reinterpret_cast<const char*>( &word ), 8 );    // Little-endian assumed.
+                    p += 8;
+                    continue;
+                }
+            }
+            char32_t code;
+            const int length = impl::valid_sequence_at( p, end, code );
+            if( length == 0 ) {
+                result += char( *p );
+                ++p;
+                continue;
+            }
+            p += length;
+            if( const int i = impl::folding_index_of( code ) ) {
+                for( const char32_t folded_code: impl::case_folding_tables::foldings[i] ) {
+                    if( folded_code == 0 ) { break; }
+                    impl::append_utf8_encoding_of( folded_code, result );
+                }
+            } else {
+                impl::append_utf8_encoding_of( code, result );
+            }
+        }
+        return result;
+    }
+
+    auto case_folding::equal_ci( in_<string_view> a, in_<string_view> b ) noexcept
+        -> bool
+    { return impl::equal_ci_using( impl::the_prefix_matcher(), a, b ); }
+
+    auto case_folding::equal_ci_using( const Simd_level::Enum level, in_<string_view> a, in_<string_view> b ) noexcept
+        -> bool
+    { return impl::equal_ci_using( *impl::prefix_matcher_for( level ), a, b ); }
+
+    auto case_folding::compare_ci( in_<string_view> s_a, in_<string_view> s_b ) noexcept
+        -> int
+    {
+        impl::Prefix_matcher& match = impl::the_prefix_matcher();
+        impl::Folded_code_points a( s_a );
+        impl::Folded_code_points b( s_b );
+        for( ;; ) {
+            impl::skip_common_prefix( match, a, b );
+            const char32_t code_a = a.next();
+            const char32_t code_b = b.next();
+            if( code_a != code_b ) {
+                return (0?0
+                    : code_a == impl::end_of_text?  -1
+                    : code_b == impl::end_of_text?  +1
+                    : code_a < code_b?              -1
+                    :                               +1
+                    );
+            }
+            if( code_a == impl::end_of_text ) { return 0; }
+        }
+    }
+
+    auto case_folding::hash_ci( in_<string_view> s ) noexcept
+        -> size_t
+    {
+        impl::Hasher hasher;
+        const auto end = reinterpret_cast<const Byte*>( s.data() + s.size() );
+        auto p = reinterpret_cast<const Byte*>( s.data() );
+        while( p != end ) {
+            if( end - p >= 8 ) {
+                uint64_t word;  memcpy( &word, p, 8 );
+                if( (word & impl::swar::high_bits) == 0 ) {
+                    hasher.add_word( impl::swar::ascii_folded( word ) );
+                    p += 8;
+                    continue;
+                }
+            }
+            if( *p < 0x80 ) {
+                hasher.add_byte( impl::ascii_folded( *p ) );
+                ++p;
+                continue;
+            }
+            char32_t code;
+            const int length = impl::valid_sequence_at( p, end, code );
+            if( length == 0 ) {
+                hasher.add_byte( *p );
+                ++p;
+                continue;
+            }
+            p += length;
+
+            // The UTF-8 of the folding, as in `to_case_folded`.
+            const int i = impl::folding_index_of( code );
+            const char32_t* const folding = impl::case_folding_tables::foldings[i];
+            const int n_codes = (i == 0? 1 : folding[2] != 0? 3 : folding[1] != 0? 2 : 1);
+            for( int j = 0; j < n_codes; ++j ) {
+                Byte bytes[4];
+                const int n_bytes = impl::encode_utf8( (i == 0? code : folding[j]), bytes );
+                for( int k = 0; k < n_bytes; ++k ) { hasher.add_byte( bytes[k] ); }
+            }
+        }
+        return size_t( hasher.result() );
+    }
+}  // namespace cppm::utf8
@@ -0,0 +1,69 @@
+#pragma once
+#include <cppm/basics/environment/cpu.hpp>      // Simd_level
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+
+#include <string>
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string,                // <string>
+            std::string_view;           // <string_view>
+
+    inline namespace case_folding {
+        // Full case folding per CaseFolding.txt, statuses C and F, here per Unicode 14, e.g. “Straße”
+        // and “STRASSE” both fold to “strasse”, and “Æblegrød” to “æblegrød”. The folding doesn't
+        // depend on locale, so the Turkic special cases for I and İ aren't applied. Invalid UTF-8
+        // bytes are kept as is.
+        extern auto to_case_folded( in_<string_view> s ) -> string;
+
+        // Caseless matching per D144 of the Unicode standard, i.e. equality of the full case
+        // foldings, without normalization. The foldings are produced on the fly without allocating,
+        // and common runs of bytes that are equal with ASCII letters folded are skipped with SIMD.
+        // Invalid UTF-8 bytes are regarded as distinct values that only are equal to themselves.
+        extern auto equal_ci( in_<string_view> a, in_<string_view> b ) noexcept -> bool;
+
+        // Mainly for testing and benchmarking. A `level` above `simd_level()` is reduced to that.
+        extern auto equal_ci_using( Simd_level::Enum level, in_<string_view> a, in_<string_view> b ) noexcept
+            -> bool;
+
+        // Negative, 0 or positive as `a` is less than, equal to or greater than `b` in the
+        // lexicographic order of the code points of the case foldings. Invalid UTF-8 bytes order
+        // after all code points. Consistent with `equal_ci`.
+        extern auto compare_ci( in_<string_view> a, in_<string_view> b ) noexcept -> int;
+
+        // A hash of the UTF-8 of the case folding, so that `equal_ci( a, b )` implies
+        // `hash_ci( a ) == hash_ci( b )`. Not for use where hash flooding is an issue.
+        extern auto hash_ci( in_<string_view> s ) noexcept -> size_t;
+
+        // Function objects for e.g. `std::unordered_set<string, Hash_ci, Equal_ci>` and
+        // `std::set<string, Less_ci>`, transparent so that a `string_view` can be looked up.
+        struct Equal_ci
+        {
+            using is_transparent = void;
+
+            auto operator()( in_<string_view> a, in_<string_view> b ) const noexcept
+                -> bool
+            { return equal_ci( a, b ); }
+        };
+
+        struct Less_ci
+        {
+            using is_transparent = void;
+
+            auto operator()( in_<string_view> a, in_<string_view> b ) const noexcept
+                -> bool
+            { return compare_ci( a, b ) < 0; }
+        };
+
+        struct Hash_ci
+        {
+            using is_transparent = void;
+
+            auto operator()( in_<string_view> s ) const noexcept
+                -> size_t
+            { return hash_ci( s ); }
+        };
+    }  // inline namespace case_folding
+}  // namespace cppm::utf8
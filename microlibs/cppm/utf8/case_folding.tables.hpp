@@ -0,0 +1,2500 @@
+#pragma once
+// Generated by `tools/generate-case-folding-tables.pl` from Unicode 14.0.0 data. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+#include <stdint.h>         // uint16_t
+
+namespace cppm::utf8::impl::case_folding_tables {
+    constexpr char  unicode_version[]   = "14.0.0";
+    constexpr int   block_bits          = 7;
+
+    // Index of the block of folding indices for each 128 code points.
+    inline constexpr Byte block_index[8704] =
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x0C, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0D, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0E, 0x05, 0x05, 0x0F, 0x10, 0x11, 0x12,
+        0x05, 0x05, 0x13, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x16, 0x17, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x18, 0x19, 0x1A, 0x1B,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x1C, 0x1D, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x1E, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x1F, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x20, 0x21, 0x22, 0x23, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x24, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x25, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x26, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x27, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+        0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    };
+
+    // Indices in `foldings`, where 0 means that the code point folds to itself.
+    inline constexpr uint16_t blocks[40][128] =
+    {
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+            0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+            0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0000, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x003B, 0x0000, 0x003C, 0x0000, 0x003D, 0x0000, 0x003E, 0x0000, 0x003F, 0x0000, 0x0040, 0x0000, 0x0041, 0x0000, 0x0042, 0x0000,
+            0x0043, 0x0000, 0x0044, 0x0000, 0x0045, 0x0000, 0x0046, 0x0000, 0x0047, 0x0000, 0x0048, 0x0000, 0x0049, 0x0000, 0x004A, 0x0000,
+            0x004B, 0x0000, 0x004C, 0x0000, 0x004D, 0x0000, 0x004E, 0x0000, 0x004F, 0x0000, 0x0050, 0x0000, 0x0051, 0x0000, 0x0052, 0x0000,
+            0x0053, 0x0000, 0x0054, 0x0000, 0x0055, 0x0000, 0x0056, 0x0000, 0x0000, 0x0057, 0x0000, 0x0058, 0x0000, 0x0059, 0x0000, 0x005A,
+            0x0000, 0x005B, 0x0000, 0x005C, 0x0000, 0x005D, 0x0000, 0x005E, 0x0000, 0x005F, 0x0060, 0x0000, 0x0061, 0x0000, 0x0062, 0x0000,
+            0x0063, 0x0000, 0x0064, 0x0000, 0x0065, 0x0000, 0x0066, 0x0000, 0x0067, 0x0000, 0x0068, 0x0000, 0x0069, 0x0000, 0x006A, 0x0000,
+            0x006B, 0x0000, 0x006C, 0x0000, 0x006D, 0x0000, 0x006E, 0x0000, 0x006F, 0x0000, 0x0070, 0x0000, 0x0071, 0x0000, 0x0072, 0x0000,
+            0x0073, 0x0000, 0x0074, 0x0000, 0x0075, 0x0000, 0x0076, 0x0000, 0x0077, 0x0078, 0x0000, 0x0079, 0x0000, 0x007A, 0x0000, 0x007B,
+        },
+        {
+            0x0000, 0x007C, 0x007D, 0x0000, 0x007E, 0x0000, 0x007F, 0x0080, 0x0000, 0x0081, 0x0082, 0x0083, 0x0000, 0x0000, 0x0084, 0x0085,
+            0x0086, 0x0087, 0x0000, 0x0088, 0x0089, 0x0000, 0x008A, 0x008B, 0x008C, 0x0000, 0x0000, 0x0000, 0x008D, 0x008E, 0x0000, 0x008F,
+            0x0090, 0x0000, 0x0091, 0x0000, 0x0092, 0x0000, 0x0093, 0x0094, 0x0000, 0x0095, 0x0000, 0x0000, 0x0096, 0x0000, 0x0097, 0x0098,
+            0x0000, 0x0099, 0x009A, 0x009B, 0x0000, 0x009C, 0x0000, 0x009D, 0x009E, 0x0000, 0x0000, 0x0000, 0x009F, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x00A0, 0x00A1, 0x0000, 0x00A2, 0x00A3, 0x0000, 0x00A4, 0x00A5, 0x0000, 0x00A6, 0x0000, 0x00A7,
+            0x0000, 0x00A8, 0x0000, 0x00A9, 0x0000, 0x00AA, 0x0000, 0x00AB, 0x0000, 0x00AC, 0x0000, 0x00AD, 0x0000, 0x0000, 0x00AE, 0x0000,
+            0x00AF, 0x0000, 0x00B0, 0x0000, 0x00B1, 0x0000, 0x00B2, 0x0000, 0x00B3, 0x0000, 0x00B4, 0x0000, 0x00B5, 0x0000, 0x00B6, 0x0000,
+            0x00B7, 0x00B8, 0x00B9, 0x0000, 0x00BA, 0x0000, 0x00BB, 0x00BC, 0x00BD, 0x0000, 0x00BE, 0x0000, 0x00BF, 0x0000, 0x00C0, 0x0000,
+        },
+        {
+            0x00C1, 0x0000, 0x00C2, 0x0000, 0x00C3, 0x0000, 0x00C4, 0x0000, 0x00C5, 0x0000, 0x00C6, 0x0000, 0x00C7, 0x0000, 0x00C8, 0x0000,
+            0x00C9, 0x0000, 0x00CA, 0x0000, 0x00CB, 0x0000, 0x00CC, 0x0000, 0x00CD, 0x0000, 0x00CE, 0x0000, 0x00CF, 0x0000, 0x00D0, 0x0000,
+            0x00D1, 0x0000, 0x00D2, 0x0000, 0x00D3, 0x0000, 0x00D4, 0x0000, 0x00D5, 0x0000, 0x00D6, 0x0000, 0x00D7, 0x0000, 0x00D8, 0x0000,
+            0x00D9, 0x0000, 0x00DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DB, 0x00DC, 0x0000, 0x00DD, 0x00DE, 0x0000,
+            0x0000, 0x00DF, 0x0000, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x0000, 0x00E4, 0x0000, 0x00E5, 0x0000, 0x00E6, 0x0000, 0x00E7, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E9, 0x0000, 0x00EA, 0x0000, 0x0000, 0x0000, 0x00EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00EC,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ED, 0x0000, 0x00EE, 0x00EF, 0x00F0, 0x0000, 0x00F1, 0x0000, 0x00F2, 0x00F3,
+            0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103,
+            0x0104, 0x0105, 0x0000, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x010F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0111,
+            0x0112, 0x0113, 0x0000, 0x0000, 0x0000, 0x0114, 0x0115, 0x0000, 0x0116, 0x0000, 0x0117, 0x0000, 0x0118, 0x0000, 0x0119, 0x0000,
+            0x011A, 0x0000, 0x011B, 0x0000, 0x011C, 0x0000, 0x011D, 0x0000, 0x011E, 0x0000, 0x011F, 0x0000, 0x0120, 0x0000, 0x0121, 0x0000,
+            0x0122, 0x0123, 0x0000, 0x0000, 0x0124, 0x0125, 0x0000, 0x0126, 0x0000, 0x0127, 0x0128, 0x0000, 0x0000, 0x0129, 0x012A, 0x012B,
+        },
+        {
+            0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B,
+            0x013C, 0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x014A, 0x014B,
+            0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x015C, 0x0000, 0x015D, 0x0000, 0x015E, 0x0000, 0x015F, 0x0000, 0x0160, 0x0000, 0x0161, 0x0000, 0x0162, 0x0000, 0x0163, 0x0000,
+            0x0164, 0x0000, 0x0165, 0x0000, 0x0166, 0x0000, 0x0167, 0x0000, 0x0168, 0x0000, 0x0169, 0x0000, 0x016A, 0x0000, 0x016B, 0x0000,
+        },
+        {
+            0x016C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x016D, 0x0000, 0x016E, 0x0000, 0x016F, 0x0000,
+            0x0170, 0x0000, 0x0171, 0x0000, 0x0172, 0x0000, 0x0173, 0x0000, 0x0174, 0x0000, 0x0175, 0x0000, 0x0176, 0x0000, 0x0177, 0x0000,
+            0x0178, 0x0000, 0x0179, 0x0000, 0x017A, 0x0000, 0x017B, 0x0000, 0x017C, 0x0000, 0x017D, 0x0000, 0x017E, 0x0000, 0x017F, 0x0000,
+            0x0180, 0x0000, 0x0181, 0x0000, 0x0182, 0x0000, 0x0183, 0x0000, 0x0184, 0x0000, 0x0185, 0x0000, 0x0186, 0x0000, 0x0187, 0x0000,
+            0x0188, 0x0189, 0x0000, 0x018A, 0x0000, 0x018B, 0x0000, 0x018C, 0x0000, 0x018D, 0x0000, 0x018E, 0x0000, 0x018F, 0x0000, 0x0000,
+            0x0190, 0x0000, 0x0191, 0x0000, 0x0192, 0x0000, 0x0193, 0x0000, 0x0194, 0x0000, 0x0195, 0x0000, 0x0196, 0x0000, 0x0197, 0x0000,
+            0x0198, 0x0000, 0x0199, 0x0000, 0x019A, 0x0000, 0x019B, 0x0000, 0x019C, 0x0000, 0x019D, 0x0000, 0x019E, 0x0000, 0x019F, 0x0000,
+            0x01A0, 0x0000, 0x01A1, 0x0000, 0x01A2, 0x0000, 0x01A3, 0x0000, 0x01A4, 0x0000, 0x01A5, 0x0000, 0x01A6, 0x0000, 0x01A7, 0x0000,
+        },
+        {
+            0x01A8, 0x0000, 0x01A9, 0x0000, 0x01AA, 0x0000, 0x01AB, 0x0000, 0x01AC, 0x0000, 0x01AD, 0x0000, 0x01AE, 0x0000, 0x01AF, 0x0000,
+            0x01B0, 0x0000, 0x01B1, 0x0000, 0x01B2, 0x0000, 0x01B3, 0x0000, 0x01B4, 0x0000, 0x01B5, 0x0000, 0x01B6, 0x0000, 0x01B7, 0x0000,
+            0x01B8, 0x0000, 0x01B9, 0x0000, 0x01BA, 0x0000, 0x01BB, 0x0000, 0x01BC, 0x0000, 0x01BD, 0x0000, 0x01BE, 0x0000, 0x01BF, 0x0000,
+            0x0000, 0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C4, 0x01C5, 0x01C6, 0x01C7, 0x01C8, 0x01C9, 0x01CA, 0x01CB, 0x01CC, 0x01CD, 0x01CE,
+            0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 0x01D5, 0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DD, 0x01DE,
+            0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E3, 0x01E4, 0x01E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x01E7, 0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EE, 0x01EF, 0x01F0, 0x01F1, 0x01F2, 0x01F3, 0x01F4, 0x01F5, 0x01F6,
+            0x01F7, 0x01F8, 0x01F9, 0x01FA, 0x01FB, 0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206,
+            0x0207, 0x0208, 0x0209, 0x020A, 0x020B, 0x020C, 0x0000, 0x020D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020E, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020F, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0000, 0x0000,
+        },
+        {
+            0x0215, 0x0216, 0x0217, 0x0218, 0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x021E, 0x021F, 0x0220, 0x0221, 0x0222, 0x0223, 0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x022A, 0x022B, 0x022C, 0x022D,
+            0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D,
+            0x023E, 0x023F, 0x0240, 0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0000, 0x0000, 0x0249, 0x024A, 0x024B,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x024C, 0x0000, 0x024D, 0x0000, 0x024E, 0x0000, 0x024F, 0x0000, 0x0250, 0x0000, 0x0251, 0x0000, 0x0252, 0x0000, 0x0253, 0x0000,
+            0x0254, 0x0000, 0x0255, 0x0000, 0x0256, 0x0000, 0x0257, 0x0000, 0x0258, 0x0000, 0x0259, 0x0000, 0x025A, 0x0000, 0x025B, 0x0000,
+            0x025C, 0x0000, 0x025D, 0x0000, 0x025E, 0x0000, 0x025F, 0x0000, 0x0260, 0x0000, 0x0261, 0x0000, 0x0262, 0x0000, 0x0263, 0x0000,
+            0x0264, 0x0000, 0x0265, 0x0000, 0x0266, 0x0000, 0x0267, 0x0000, 0x0268, 0x0000, 0x0269, 0x0000, 0x026A, 0x0000, 0x026B, 0x0000,
+            0x026C, 0x0000, 0x026D, 0x0000, 0x026E, 0x0000, 0x026F, 0x0000, 0x0270, 0x0000, 0x0271, 0x0000, 0x0272, 0x0000, 0x0273, 0x0000,
+            0x0274, 0x0000, 0x0275, 0x0000, 0x0276, 0x0000, 0x0277, 0x0000, 0x0278, 0x0000, 0x0279, 0x0000, 0x027A, 0x0000, 0x027B, 0x0000,
+            0x027C, 0x0000, 0x027D, 0x0000, 0x027E, 0x0000, 0x027F, 0x0000, 0x0280, 0x0000, 0x0281, 0x0000, 0x0282, 0x0000, 0x0283, 0x0000,
+            0x0284, 0x0000, 0x0285, 0x0000, 0x0286, 0x0000, 0x0287, 0x0000, 0x0288, 0x0000, 0x0289, 0x0000, 0x028A, 0x0000, 0x028B, 0x0000,
+        },
+        {
+            0x028C, 0x0000, 0x028D, 0x0000, 0x028E, 0x0000, 0x028F, 0x0000, 0x0290, 0x0000, 0x0291, 0x0000, 0x0292, 0x0000, 0x0293, 0x0000,
+            0x0294, 0x0000, 0x0295, 0x0000, 0x0296, 0x0000, 0x0297, 0x0298, 0x0299, 0x029A, 0x029B, 0x029C, 0x0000, 0x0000, 0x029D, 0x0000,
+            0x029E, 0x0000, 0x029F, 0x0000, 0x02A0, 0x0000, 0x02A1, 0x0000, 0x02A2, 0x0000, 0x02A3, 0x0000, 0x02A4, 0x0000, 0x02A5, 0x0000,
+            0x02A6, 0x0000, 0x02A7, 0x0000, 0x02A8, 0x0000, 0x02A9, 0x0000, 0x02AA, 0x0000, 0x02AB, 0x0000, 0x02AC, 0x0000, 0x02AD, 0x0000,
+            0x02AE, 0x0000, 0x02AF, 0x0000, 0x02B0, 0x0000, 0x02B1, 0x0000, 0x02B2, 0x0000, 0x02B3, 0x0000, 0x02B4, 0x0000, 0x02B5, 0x0000,
+            0x02B6, 0x0000, 0x02B7, 0x0000, 0x02B8, 0x0000, 0x02B9, 0x0000, 0x02BA, 0x0000, 0x02BB, 0x0000, 0x02BC, 0x0000, 0x02BD, 0x0000,
+            0x02BE, 0x0000, 0x02BF, 0x0000, 0x02C0, 0x0000, 0x02C1, 0x0000, 0x02C2, 0x0000, 0x02C3, 0x0000, 0x02C4, 0x0000, 0x02C5, 0x0000,
+            0x02C6, 0x0000, 0x02C7, 0x0000, 0x02C8, 0x0000, 0x02C9, 0x0000, 0x02CA, 0x0000, 0x02CB, 0x0000, 0x02CC, 0x0000, 0x02CD, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02CE, 0x02CF, 0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0, 0x02E1, 0x02E2, 0x02E3,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0, 0x02F1, 0x0000, 0x0000,
+            0x02F2, 0x0000, 0x02F3, 0x0000, 0x02F4, 0x0000, 0x02F5, 0x0000, 0x0000, 0x02F6, 0x0000, 0x02F7, 0x0000, 0x02F8, 0x0000, 0x02F9,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300, 0x0301,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310, 0x0311,
+            0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F, 0x0320, 0x0321,
+            0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328, 0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331,
+            0x0000, 0x0000, 0x0332, 0x0333, 0x0334, 0x0000, 0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B, 0x0000, 0x033C, 0x0000,
+            0x0000, 0x0000, 0x033D, 0x033E, 0x033F, 0x0000, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0347, 0x0348, 0x0000, 0x0000, 0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x034F, 0x0350, 0x0351, 0x0000, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0359, 0x035A, 0x035B, 0x0000, 0x035C, 0x035D, 0x035E, 0x035F, 0x0360, 0x0361, 0x0362, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0363, 0x0000, 0x0000, 0x0000, 0x0364, 0x0365, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0366, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0367, 0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0370, 0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0377, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x037F, 0x0380, 0x0381,
+            0x0382, 0x0383, 0x0384, 0x0385, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038B, 0x038C, 0x038D, 0x038E, 0x038F, 0x0390, 0x0391,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1,
+            0x03A2, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03B0, 0x03B1,
+            0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x03C2, 0x0000, 0x03C3, 0x03C4, 0x03C5, 0x0000, 0x0000, 0x03C6, 0x0000, 0x03C7, 0x0000, 0x03C8, 0x0000, 0x03C9, 0x03CA, 0x03CB,
+            0x03CC, 0x0000, 0x03CD, 0x0000, 0x0000, 0x03CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03CF, 0x03D0,
+        },
+        {
+            0x03D1, 0x0000, 0x03D2, 0x0000, 0x03D3, 0x0000, 0x03D4, 0x0000, 0x03D5, 0x0000, 0x03D6, 0x0000, 0x03D7, 0x0000, 0x03D8, 0x0000,
+            0x03D9, 0x0000, 0x03DA, 0x0000, 0x03DB, 0x0000, 0x03DC, 0x0000, 0x03DD, 0x0000, 0x03DE, 0x0000, 0x03DF, 0x0000, 0x03E0, 0x0000,
+            0x03E1, 0x0000, 0x03E2, 0x0000, 0x03E3, 0x0000, 0x03E4, 0x0000, 0x03E5, 0x0000, 0x03E6, 0x0000, 0x03E7, 0x0000, 0x03E8, 0x0000,
+            0x03E9, 0x0000, 0x03EA, 0x0000, 0x03EB, 0x0000, 0x03EC, 0x0000, 0x03ED, 0x0000, 0x03EE, 0x0000, 0x03EF, 0x0000, 0x03F0, 0x0000,
+            0x03F1, 0x0000, 0x03F2, 0x0000, 0x03F3, 0x0000, 0x03F4, 0x0000, 0x03F5, 0x0000, 0x03F6, 0x0000, 0x03F7, 0x0000, 0x03F8, 0x0000,
+            0x03F9, 0x0000, 0x03FA, 0x0000, 0x03FB, 0x0000, 0x03FC, 0x0000, 0x03FD, 0x0000, 0x03FE, 0x0000, 0x03FF, 0x0000, 0x0400, 0x0000,
+            0x0401, 0x0000, 0x0402, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0403, 0x0000, 0x0404, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0405, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0406, 0x0000, 0x0407, 0x0000, 0x0408, 0x0000, 0x0409, 0x0000, 0x040A, 0x0000, 0x040B, 0x0000, 0x040C, 0x0000, 0x040D, 0x0000,
+            0x040E, 0x0000, 0x040F, 0x0000, 0x0410, 0x0000, 0x0411, 0x0000, 0x0412, 0x0000, 0x0413, 0x0000, 0x0414, 0x0000, 0x0415, 0x0000,
+            0x0416, 0x0000, 0x0417, 0x0000, 0x0418, 0x0000, 0x0419, 0x0000, 0x041A, 0x0000, 0x041B, 0x0000, 0x041C, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x041D, 0x0000, 0x041E, 0x0000, 0x041F, 0x0000, 0x0420, 0x0000, 0x0421, 0x0000, 0x0422, 0x0000, 0x0423, 0x0000, 0x0424, 0x0000,
+            0x0425, 0x0000, 0x0426, 0x0000, 0x0427, 0x0000, 0x0428, 0x0000, 0x0429, 0x0000, 0x042A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x042B, 0x0000, 0x042C, 0x0000, 0x042D, 0x0000, 0x042E, 0x0000, 0x042F, 0x0000, 0x0430, 0x0000, 0x0431, 0x0000,
+            0x0000, 0x0000, 0x0432, 0x0000, 0x0433, 0x0000, 0x0434, 0x0000, 0x0435, 0x0000, 0x0436, 0x0000, 0x0437, 0x0000, 0x0438, 0x0000,
+            0x0439, 0x0000, 0x043A, 0x0000, 0x043B, 0x0000, 0x043C, 0x0000, 0x043D, 0x0000, 0x043E, 0x0000, 0x043F, 0x0000, 0x0440, 0x0000,
+            0x0441, 0x0000, 0x0442, 0x0000, 0x0443, 0x0000, 0x0444, 0x0000, 0x0445, 0x0000, 0x0446, 0x0000, 0x0447, 0x0000, 0x0448, 0x0000,
+            0x0449, 0x0000, 0x044A, 0x0000, 0x044B, 0x0000, 0x044C, 0x0000, 0x044D, 0x0000, 0x044E, 0x0000, 0x044F, 0x0000, 0x0450, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0451, 0x0000, 0x0452, 0x0000, 0x0453, 0x0454, 0x0000,
+        },
+        {
+            0x0455, 0x0000, 0x0456, 0x0000, 0x0457, 0x0000, 0x0458, 0x0000, 0x0000, 0x0000, 0x0000, 0x0459, 0x0000, 0x045A, 0x0000, 0x0000,
+            0x045B, 0x0000, 0x045C, 0x0000, 0x0000, 0x0000, 0x045D, 0x0000, 0x045E, 0x0000, 0x045F, 0x0000, 0x0460, 0x0000, 0x0461, 0x0000,
+            0x0462, 0x0000, 0x0463, 0x0000, 0x0464, 0x0000, 0x0465, 0x0000, 0x0466, 0x0000, 0x0467, 0x0468, 0x0469, 0x046A, 0x046B, 0x0000,
+            0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0000, 0x0471, 0x0000, 0x0472, 0x0000, 0x0473, 0x0000, 0x0474, 0x0000, 0x0475, 0x0000,
+            0x0476, 0x0000, 0x0477, 0x0000, 0x0478, 0x0479, 0x047A, 0x047B, 0x0000, 0x047C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x047D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x047E, 0x0000, 0x047F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0480, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0481, 0x0482, 0x0483, 0x0484, 0x0485, 0x0486, 0x0487, 0x0488, 0x0489, 0x048A, 0x048B, 0x048C, 0x048D, 0x048E, 0x048F, 0x0490,
+        },
+        {
+            0x0491, 0x0492, 0x0493, 0x0494, 0x0495, 0x0496, 0x0497, 0x0498, 0x0499, 0x049A, 0x049B, 0x049C, 0x049D, 0x049E, 0x049F, 0x04A0,
+            0x04A1, 0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9, 0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF, 0x04B0,
+            0x04B1, 0x04B2, 0x04B3, 0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x04BB, 0x04BC, 0x04BD, 0x04BE, 0x04BF, 0x04C0,
+            0x04C1, 0x04C2, 0x04C3, 0x04C4, 0x04C5, 0x04C6, 0x04C7, 0x04C8, 0x04C9, 0x04CA, 0x04CB, 0x04CC, 0x04CD, 0x04CE, 0x04CF, 0x04D0,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x04D1, 0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04D6, 0x04D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x04D8, 0x04D9, 0x04DA, 0x04DB, 0x04DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x04DD, 0x04DE, 0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5, 0x04E6, 0x04E7, 0x04E8, 0x04E9, 0x04EA, 0x04EB,
+            0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1, 0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE, 0x04FF, 0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506,
+            0x0507, 0x0508, 0x0509, 0x050A, 0x050B, 0x050C, 0x050D, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515, 0x0516,
+            0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x051F, 0x0520, 0x0521, 0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E,
+            0x052F, 0x0530, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537, 0x0538, 0x0539, 0x053A, 0x053B, 0x053C, 0x053D, 0x053E,
+            0x053F, 0x0540, 0x0541, 0x0542, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x0000, 0x054E, 0x054F, 0x0550, 0x0551,
+        },
+        {
+            0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x0000, 0x055D, 0x055E, 0x055F, 0x0560,
+            0x0561, 0x0562, 0x0563, 0x0000, 0x0564, 0x0565, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575,
+            0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585,
+            0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058E, 0x058F, 0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0595,
+            0x0596, 0x0597, 0x0598, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0599, 0x059A, 0x059B, 0x059C, 0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5, 0x05A6, 0x05A7, 0x05A8,
+            0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0x05C7, 0x05C8,
+            0x05C9, 0x05CA, 0x05CB, 0x05CC, 0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8,
+            0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5, 0x05F6, 0x05F7, 0x05F8,
+            0x05F9, 0x05FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+    };
+
+    // The full case foldings, padded with zeroes.
+    inline constexpr char32_t foldings[1531][3] =
+    {
+        { 0x0000, 0x0000, 0x0000 },
+        { 0x0061, 0x0000, 0x0000 },
+        { 0x0062, 0x0000, 0x0000 },
+        { 0x0063, 0x0000, 0x0000 },
+        { 0x0064, 0x0000, 0x0000 },
+        { 0x0065, 0x0000, 0x0000 },
+        { 0x0066, 0x0000, 0x0000 },
+        { 0x0067, 0x0000, 0x0000 },
+        { 0x0068, 0x0000, 0x0000 },
+        { 0x0069, 0x0000, 0x0000 },
+        { 0x006A, 0x0000, 0x0000 },
+        { 0x006B, 0x0000, 0x0000 },
+        { 0x006C, 0x0000, 0x0000 },
+        { 0x006D, 0x0000, 0x0000 },
+        { 0x006E, 0x0000, 0x0000 },
+        { 0x006F, 0x0000, 0x0000 },
+        { 0x0070, 0x0000, 0x0000 },
+        { 0x0071, 0x0000, 0x0000 },
+        { 0x0072, 0x0000, 0x0000 },
+        { 0x0073, 0x0000, 0x0000 },
+        { 0x0074, 0x0000, 0x0000 },
+        { 0x0075, 0x0000, 0x0000 },
+        { 0x0076, 0x0000, 0x0000 },
+        { 0x0077, 0x0000, 0x0000 },
+        { 0x0078, 0x0000, 0x0000 },
+        { 0x0079, 0x0000, 0x0000 },
+        { 0x007A, 0x0000, 0x0000 },
+        { 0x03BC, 0x0000, 0x0000 },
+        { 0x00E0, 0x0000, 0x0000 },
+        { 0x00E1, 0x0000, 0x0000 },
+        { 0x00E2, 0x0000, 0x0000 },
+        { 0x00E3, 0x0000, 0x0000 },
+        { 0x00E4, 0x0000, 0x0000 },
+        { 0x00E5, 0x0000, 0x0000 },
+        { 0x00E6, 0x0000, 0x0000 },
+        { 0x00E7, 0x0000, 0x0000 },
+        { 0x00E8, 0x0000, 0x0000 },
+        { 0x00E9, 0x0000, 0x0000 },
+        { 0x00EA, 0x0000, 0x0000 },
+        { 0x00EB, 0x0000, 0x0000 },
+        { 0x00EC, 0x0000, 0x0000 },
+        { 0x00ED, 0x0000, 0x0000 },
+        { 0x00EE, 0x0000, 0x0000 },
+        { 0x00EF, 0x0000, 0x0000 },
+        { 0x00F0, 0x0000, 0x0000 },
+        { 0x00F1, 0x0000, 0x0000 },
+        { 0x00F2, 0x0000, 0x0000 },
+        { 0x00F3, 0x0000, 0x0000 },
+        { 0x00F4, 0x0000, 0x0000 },
+        { 0x00F5, 0x0000, 0x0000 },
+        { 0x00F6, 0x0000, 0x0000 },
+        { 0x00F8, 0x0000, 0x0000 },
+        { 0x00F9, 0x0000, 0x0000 },
+        { 0x00FA, 0x0000, 0x0000 },
+        { 0x00FB, 0x0000, 0x0000 },
+        { 0x00FC, 0x0000, 0x0000 },
+        { 0x00FD, 0x0000, 0x0000 },
+        { 0x00FE, 0x0000, 0x0000 },
+        { 0x0073, 0x0073, 0x0000 },
+        { 0x0101, 0x0000, 0x0000 },
+        { 0x0103, 0x0000, 0x0000 },
+        { 0x0105, 0x0000, 0x0000 },
+        { 0x0107, 0x0000, 0x0000 },
+        { 0x0109, 0x0000, 0x0000 },
+        { 0x010B, 0x0000, 0x0000 },
+        { 0x010D, 0x0000, 0x0000 },
+        { 0x010F, 0x0000, 0x0000 },
+        { 0x0111, 0x0000, 0x0000 },
+        { 0x0113, 0x0000, 0x0000 },
+        { 0x0115, 0x0000, 0x0000 },
+        { 0x0117, 0x0000, 0x0000 },
+        { 0x0119, 0x0000, 0x0000 },
+        { 0x011B, 0x0000, 0x0000 },
+        { 0x011D, 0x0000, 0x0000 },
+        { 0x011F, 0x0000, 0x0000 },
+        { 0x0121, 0x0000, 0x0000 },
+        { 0x0123, 0x0000, 0x0000 },
+        { 0x0125, 0x0000, 0x0000 },
+        { 0x0127, 0x0000, 0x0000 },
+        { 0x0129, 0x0000, 0x0000 },
+        { 0x012B, 0x0000, 0x0000 },
+        { 0x012D, 0x0000, 0x0000 },
+        { 0x012F, 0x0000, 0x0000 },
+        { 0x0069, 0x0307, 0x0000 },
+        { 0x0133, 0x0000, 0x0000 },
+        { 0x0135, 0x0000, 0x0000 },
+        { 0x0137, 0x0000, 0x0000 },
+        { 0x013A, 0x0000, 0x0000 },
+        { 0x013C, 0x0000, 0x0000 },
+        { 0x013E, 0x0000, 0x0000 },
+        { 0x0140, 0x0000, 0x0000 },
+        { 0x0142, 0x0000, 0x0000 },
+        { 0x0144, 0x0000, 0x0000 },
+        { 0x0146, 0x0000, 0x0000 },
+        { 0x0148, 0x0000, 0x0000 },
+        { 0x02BC, 0x006E, 0x0000 },
+        { 0x014B, 0x0000, 0x0000 },
+        { 0x014D, 0x0000, 0x0000 },
+        { 0x014F, 0x0000, 0x0000 },
+        { 0x0151, 0x0000, 0x0000 },
+        { 0x0153, 0x0000, 0x0000 },
+        { 0x0155, 0x0000, 0x0000 },
+        { 0x0157, 0x0000, 0x0000 },
+        { 0x0159, 0x0000, 0x0000 },
+        { 0x015B, 0x0000, 0x0000 },
+        { 0x015D, 0x0000, 0x0000 },
+        { 0x015F, 0x0000, 0x0000 },
+        { 0x0161, 0x0000, 0x0000 },
+        { 0x0163, 0x0000, 0x0000 },
+        { 0x0165, 0x0000, 0x0000 },
+        { 0x0167, 0x0000, 0x0000 },
+        { 0x0169, 0x0000, 0x0000 },
+        { 0x016B, 0x0000, 0x0000 },
+        { 0x016D, 0x0000, 0x0000 },
+        { 0x016F, 0x0000, 0x0000 },
+        { 0x0171, 0x0000, 0x0000 },
+        { 0x0173, 0x0000, 0x0000 },
+        { 0x0175, 0x0000, 0x0000 },
+        { 0x0177, 0x0000, 0x0000 },
+        { 0x00FF, 0x0000, 0x0000 },
+        { 0x017A, 0x0000, 0x0000 },
+        { 0x017C, 0x0000, 0x0000 },
+        { 0x017E, 0x0000, 0x0000 },
+        { 0x0073, 0x0000, 0x0000 },
+        { 0x0253, 0x0000, 0x0000 },
+        { 0x0183, 0x0000, 0x0000 },
+        { 0x0185, 0x0000, 0x0000 },
+        { 0x0254, 0x0000, 0x0000 },
+        { 0x0188, 0x0000, 0x0000 },
+        { 0x0256, 0x0000, 0x0000 },
+        { 0x0257, 0x0000, 0x0000 },
+        { 0x018C, 0x0000, 0x0000 },
+        { 0x01DD, 0x0000, 0x0000 },
+        { 0x0259, 0x0000, 0x0000 },
+        { 0x025B, 0x0000, 0x0000 },
+        { 0x0192, 0x0000, 0x0000 },
+        { 0x0260, 0x0000, 0x0000 },
+        { 0x0263, 0x0000, 0x0000 },
+        { 0x0269, 0x0000, 0x0000 },
+        { 0x0268, 0x0000, 0x0000 },
+        { 0x0199, 0x0000, 0x0000 },
+        { 0x026F, 0x0000, 0x0000 },
+        { 0x0272, 0x0000, 0x0000 },
+        { 0x0275, 0x0000, 0x0000 },
+        { 0x01A1, 0x0000, 0x0000 },
+        { 0x01A3, 0x0000, 0x0000 },
+        { 0x01A5, 0x0000, 0x0000 },
+        { 0x0280, 0x0000, 0x0000 },
+        { 0x01A8, 0x0000, 0x0000 },
+        { 0x0283, 0x0000, 0x0000 },
+        { 0x01AD, 0x0000, 0x0000 },
+        { 0x0288, 0x0000, 0x0000 },
+        { 0x01B0, 0x0000, 0x0000 },
+        { 0x028A, 0x0000, 0x0000 },
+        { 0x028B, 0x0000, 0x0000 },
+        { 0x01B4, 0x0000, 0x0000 },
+        { 0x01B6, 0x0000, 0x0000 },
+        { 0x0292, 0x0000, 0x0000 },
+        { 0x01B9, 0x0000, 0x0000 },
+        { 0x01BD, 0x0000, 0x0000 },
+        { 0x01C6, 0x0000, 0x0000 },
+        { 0x01C6, 0x0000, 0x0000 },
+        { 0x01C9, 0x0000, 0x0000 },
+        { 0x01C9, 0x0000, 0x0000 },
+        { 0x01CC, 0x0000, 0x0000 },
+        { 0x01CC, 0x0000, 0x0000 },
+        { 0x01CE, 0x0000, 0x0000 },
+        { 0x01D0, 0x0000, 0x0000 },
+        { 0x01D2, 0x0000, 0x0000 },
+        { 0x01D4, 0x0000, 0x0000 },
+        { 0x01D6, 0x0000, 0x0000 },
+        { 0x01D8, 0x0000, 0x0000 },
+        { 0x01DA, 0x0000, 0x0000 },
+        { 0x01DC, 0x0000, 0x0000 },
+        { 0x01DF, 0x0000, 0x0000 },
+        { 0x01E1, 0x0000, 0x0000 },
+        { 0x01E3, 0x0000, 0x0000 },
+        { 0x01E5, 0x0000, 0x0000 },
+        { 0x01E7, 0x0000, 0x0000 },
+        { 0x01E9, 0x0000, 0x0000 },
+        { 0x01EB, 0x0000, 0x0000 },
+        { 0x01ED, 0x0000, 0x0000 },
+        { 0x01EF, 0x0000, 0x0000 },
+        { 0x006A, 0x030C, 0x0000 },
+        { 0x01F3, 0x0000, 0x0000 },
+        { 0x01F3, 0x0000, 0x0000 },
+        { 0x01F5, 0x0000, 0x0000 },
+        { 0x0195, 0x0000, 0x0000 },
+        { 0x01BF, 0x0000, 0x0000 },
+        { 0x01F9, 0x0000, 0x0000 },
+        { 0x01FB, 0x0000, 0x0000 },
+        { 0x01FD, 0x0000, 0x0000 },
+        { 0x01FF, 0x0000, 0x0000 },
+        { 0x0201, 0x0000, 0x0000 },
+        { 0x0203, 0x0000, 0x0000 },
+        { 0x0205, 0x0000, 0x0000 },
+        { 0x0207, 0x0000, 0x0000 },
+        { 0x0209, 0x0000, 0x0000 },
+        { 0x020B, 0x0000, 0x0000 },
+        { 0x020D, 0x0000, 0x0000 },
+        { 0x020F, 0x0000, 0x0000 },
+        { 0x0211, 0x0000, 0x0000 },
+        { 0x0213, 0x0000, 0x0000 },
+        { 0x0215, 0x0000, 0x0000 },
+        { 0x0217, 0x0000, 0x0000 },
+        { 0x0219, 0x0000, 0x0000 },
+        { 0x021B, 0x0000, 0x0000 },
+        { 0x021D, 0x0000, 0x0000 },
+        { 0x021F, 0x0000, 0x0000 },
+        { 0x019E, 0x0000, 0x0000 },
+        { 0x0223, 0x0000, 0x0000 },
+        { 0x0225, 0x0000, 0x0000 },
+        { 0x0227, 0x0000, 0x0000 },
+        { 0x0229, 0x0000, 0x0000 },
+        { 0x022B, 0x0000, 0x0000 },
+        { 0x022D, 0x0000, 0x0000 },
+        { 0x022F, 0x0000, 0x0000 },
+        { 0x0231, 0x0000, 0x0000 },
+        { 0x0233, 0x0000, 0x0000 },
+        { 0x2C65, 0x0000, 0x0000 },
+        { 0x023C, 0x0000, 0x0000 },
+        { 0x019A, 0x0000, 0x0000 },
+        { 0x2C66, 0x0000, 0x0000 },
+        { 0x0242, 0x0000, 0x0000 },
+        { 0x0180, 0x0000, 0x0000 },
+        { 0x0289, 0x0000, 0x0000 },
+        { 0x028C, 0x0000, 0x0000 },
+        { 0x0247, 0x0000, 0x0000 },
+        { 0x0249, 0x0000, 0x0000 },
+        { 0x024B, 0x0000, 0x0000 },
+        { 0x024D, 0x0000, 0x0000 },
+        { 0x024F, 0x0000, 0x0000 },
+        { 0x03B9, 0x0000, 0x0000 },
+        { 0x0371, 0x0000, 0x0000 },
+        { 0x0373, 0x0000, 0x0000 },
+        { 0x0377, 0x0000, 0x0000 },
+        { 0x03F3, 0x0000, 0x0000 },
+        { 0x03AC, 0x0000, 0x0000 },
+        { 0x03AD, 0x0000, 0x0000 },
+        { 0x03AE, 0x0000, 0x0000 },
+        { 0x03AF, 0x0000, 0x0000 },
+        { 0x03CC, 0x0000, 0x0000 },
+        { 0x03CD, 0x0000, 0x0000 },
+        { 0x03CE, 0x0000, 0x0000 },
+        { 0x03B9, 0x0308, 0x0301 },
+        { 0x03B1, 0x0000, 0x0000 },
+        { 0x03B2, 0x0000, 0x0000 },
+        { 0x03B3, 0x0000, 0x0000 },
+        { 0x03B4, 0x0000, 0x0000 },
+        { 0x03B5, 0x0000, 0x0000 },
+        { 0x03B6, 0x0000, 0x0000 },
+        { 0x03B7, 0x0000, 0x0000 },
+        { 0x03B8, 0x0000, 0x0000 },
+        { 0x03B9, 0x0000, 0x0000 },
+        { 0x03BA, 0x0000, 0x0000 },
+        { 0x03BB, 0x0000, 0x0000 },
+        { 0x03BC, 0x0000, 0x0000 },
+        { 0x03BD, 0x0000, 0x0000 },
+        { 0x03BE, 0x0000, 0x0000 },
+        { 0x03BF, 0x0000, 0x0000 },
+        { 0x03C0, 0x0000, 0x0000 },
+        { 0x03C1, 0x0000, 0x0000 },
+        { 0x03C3, 0x0000, 0x0000 },
+        { 0x03C4, 0x0000, 0x0000 },
+        { 0x03C5, 0x0000, 0x0000 },
+        { 0x03C6, 0x0000, 0x0000 },
+        { 0x03C7, 0x0000, 0x0000 },
+        { 0x03C8, 0x0000, 0x0000 },
+        { 0x03C9, 0x0000, 0x0000 },
+        { 0x03CA, 0x0000, 0x0000 },
+        { 0x03CB, 0x0000, 0x0000 },
+        { 0x03C5, 0x0308, 0x0301 },
+        { 0x03C3, 0x0000, 0x0000 },
+        { 0x03D7, 0x0000, 0x0000 },
+        { 0x03B2, 0x0000, 0x0000 },
+        { 0x03B8, 0x0000, 0x0000 },
+        { 0x03C6, 0x0000, 0x0000 },
+        { 0x03C0, 0x0000, 0x0000 },
+        { 0x03D9, 0x0000, 0x0000 },
+        { 0x03DB, 0x0000, 0x0000 },
+        { 0x03DD, 0x0000, 0x0000 },
+        { 0x03DF, 0x0000, 0x0000 },
+        { 0x03E1, 0x0000, 0x0000 },
+        { 0x03E3, 0x0000, 0x0000 },
+        { 0x03E5, 0x0000, 0x0000 },
+        { 0x03E7, 0x0000, 0x0000 },
+        { 0x03E9, 0x0000, 0x0000 },
+        { 0x03EB, 0x0000, 0x0000 },
+        { 0x03ED, 0x0000, 0x0000 },
+        { 0x03EF, 0x0000, 0x0000 },
+        { 0x03BA, 0x0000, 0x0000 },
+        { 0x03C1, 0x0000, 0x0000 },
+        { 0x03B8, 0x0000, 0x0000 },
+        { 0x03B5, 0x0000, 0x0000 },
+        { 0x03F8, 0x0000, 0x0000 },
+        { 0x03F2, 0x0000, 0x0000 },
+        { 0x03FB, 0x0000, 0x0000 },
+        { 0x037B, 0x0000, 0x0000 },
+        { 0x037C, 0x0000, 0x0000 },
+        { 0x037D, 0x0000, 0x0000 },
+        { 0x0450, 0x0000, 0x0000 },
+        { 0x0451, 0x0000, 0x0000 },
+        { 0x0452, 0x0000, 0x0000 },
+        { 0x0453, 0x0000, 0x0000 },
+        { 0x0454, 0x0000, 0x0000 },
+        { 0x0455, 0x0000, 0x0000 },
+        { 0x0456, 0x0000, 0x0000 },
+        { 0x0457, 0x0000, 0x0000 },
+        { 0x0458, 0x0000, 0x0000 },
+        { 0x0459, 0x0000, 0x0000 },
+        { 0x045A, 0x0000, 0x0000 },
+        { 0x045B, 0x0000, 0x0000 },
+        { 0x045C, 0x0000, 0x0000 },
+        { 0x045D, 0x0000, 0x0000 },
+        { 0x045E, 0x0000, 0x0000 },
+        { 0x045F, 0x0000, 0x0000 },
+        { 0x0430, 0x0000, 0x0000 },
+        { 0x0431, 0x0000, 0x0000 },
+        { 0x0432, 0x0000, 0x0000 },
+        { 0x0433, 0x0000, 0x0000 },
+        { 0x0434, 0x0000, 0x0000 },
+        { 0x0435, 0x0000, 0x0000 },
+        { 0x0436, 0x0000, 0x0000 },
+        { 0x0437, 0x0000, 0x0000 },
+        { 0x0438, 0x0000, 0x0000 },
+        { 0x0439, 0x0000, 0x0000 },
+        { 0x043A, 0x0000, 0x0000 },
+        { 0x043B, 0x0000, 0x0000 },
+        { 0x043C, 0x0000, 0x0000 },
+        { 0x043D, 0x0000, 0x0000 },
+        { 0x043E, 0x0000, 0x0000 },
+        { 0x043F, 0x0000, 0x0000 },
+        { 0x0440, 0x0000, 0x0000 },
+        { 0x0441, 0x0000, 0x0000 },
+        { 0x0442, 0x0000, 0x0000 },
+        { 0x0443, 0x0000, 0x0000 },
+        { 0x0444, 0x0000, 0x0000 },
+        { 0x0445, 0x0000, 0x0000 },
+        { 0x0446, 0x0000, 0x0000 },
+        { 0x0447, 0x0000, 0x0000 },
+        { 0x0448, 0x0000, 0x0000 },
+        { 0x0449, 0x0000, 0x0000 },
+        { 0x044A, 0x0000, 0x0000 },
+        { 0x044B, 0x0000, 0x0000 },
+        { 0x044C, 0x0000, 0x0000 },
+        { 0x044D, 0x0000, 0x0000 },
+        { 0x044E, 0x0000, 0x0000 },
+        { 0x044F, 0x0000, 0x0000 },
+        { 0x0461, 0x0000, 0x0000 },
+        { 0x0463, 0x0000, 0x0000 },
+        { 0x0465, 0x0000, 0x0000 },
+        { 0x0467, 0x0000, 0x0000 },
+        { 0x0469, 0x0000, 0x0000 },
+        { 0x046B, 0x0000, 0x0000 },
+        { 0x046D, 0x0000, 0x0000 },
+        { 0x046F, 0x0000, 0x0000 },
+        { 0x0471, 0x0000, 0x0000 },
+        { 0x0473, 0x0000, 0x0000 },
+        { 0x0475, 0x0000, 0x0000 },
+        { 0x0477, 0x0000, 0x0000 },
+        { 0x0479, 0x0000, 0x0000 },
+        { 0x047B, 0x0000, 0x0000 },
+        { 0x047D, 0x0000, 0x0000 },
+        { 0x047F, 0x0000, 0x0000 },
+        { 0x0481, 0x0000, 0x0000 },
+        { 0x048B, 0x0000, 0x0000 },
+        { 0x048D, 0x0000, 0x0000 },
+        { 0x048F, 0x0000, 0x0000 },
+        { 0x0491, 0x0000, 0x0000 },
+        { 0x0493, 0x0000, 0x0000 },
+        { 0x0495, 0x0000, 0x0000 },
+        { 0x0497, 0x0000, 0x0000 },
+        { 0x0499, 0x0000, 0x0000 },
+        { 0x049B, 0x0000, 0x0000 },
+        { 0x049D, 0x0000, 0x0000 },
+        { 0x049F, 0x0000, 0x0000 },
+        { 0x04A1, 0x0000, 0x0000 },
+        { 0x04A3, 0x0000, 0x0000 },
+        { 0x04A5, 0x0000, 0x0000 },
+        { 0x04A7, 0x0000, 0x0000 },
+        { 0x04A9, 0x0000, 0x0000 },
+        { 0x04AB, 0x0000, 0x0000 },
+        { 0x04AD, 0x0000, 0x0000 },
+        { 0x04AF, 0x0000, 0x0000 },
+        { 0x04B1, 0x0000, 0x0000 },
+        { 0x04B3, 0x0000, 0x0000 },
+        { 0x04B5, 0x0000, 0x0000 },
+        { 0x04B7, 0x0000, 0x0000 },
+        { 0x04B9, 0x0000, 0x0000 },
+        { 0x04BB, 0x0000, 0x0000 },
+        { 0x04BD, 0x0000, 0x0000 },
+        { 0x04BF, 0x0000, 0x0000 },
+        { 0x04CF, 0x0000, 0x0000 },
+        { 0x04C2, 0x0000, 0x0000 },
+        { 0x04C4, 0x0000, 0x0000 },
+        { 0x04C6, 0x0000, 0x0000 },
+        { 0x04C8, 0x0000, 0x0000 },
+        { 0x04CA, 0x0000, 0x0000 },
+        { 0x04CC, 0x0000, 0x0000 },
+        { 0x04CE, 0x0000, 0x0000 },
+        { 0x04D1, 0x0000, 0x0000 },
+        { 0x04D3, 0x0000, 0x0000 },
+        { 0x04D5, 0x0000, 0x0000 },
+        { 0x04D7, 0x0000, 0x0000 },
+        { 0x04D9, 0x0000, 0x0000 },
+        { 0x04DB, 0x0000, 0x0000 },
+        { 0x04DD, 0x0000, 0x0000 },
+        { 0x04DF, 0x0000, 0x0000 },
+        { 0x04E1, 0x0000, 0x0000 },
+        { 0x04E3, 0x0000, 0x0000 },
+        { 0x04E5, 0x0000, 0x0000 },
+        { 0x04E7, 0x0000, 0x0000 },
+        { 0x04E9, 0x0000, 0x0000 },
+        { 0x04EB, 0x0000, 0x0000 },
+        { 0x04ED, 0x0000, 0x0000 },
+        { 0x04EF, 0x0000, 0x0000 },
+        { 0x04F1, 0x0000, 0x0000 },
+        { 0x04F3, 0x0000, 0x0000 },
+        { 0x04F5, 0x0000, 0x0000 },
+        { 0x04F7, 0x0000, 0x0000 },
+        { 0x04F9, 0x0000, 0x0000 },
+        { 0x04FB, 0x0000, 0x0000 },
+        { 0x04FD, 0x0000, 0x0000 },
+        { 0x04FF, 0x0000, 0x0000 },
+        { 0x0501, 0x0000, 0x0000 },
+        { 0x0503, 0x0000, 0x0000 },
+        { 0x0505, 0x0000, 0x0000 },
+        { 0x0507, 0x0000, 0x0000 },
+        { 0x0509, 0x0000, 0x0000 },
+        { 0x050B, 0x0000, 0x0000 },
+        { 0x050D, 0x0000, 0x0000 },
+        { 0x050F, 0x0000, 0x0000 },
+        { 0x0511, 0x0000, 0x0000 },
+        { 0x0513, 0x0000, 0x0000 },
+        { 0x0515, 0x0000, 0x0000 },
+        { 0x0517, 0x0000, 0x0000 },
+        { 0x0519, 0x0000, 0x0000 },
+        { 0x051B, 0x0000, 0x0000 },
+        { 0x051D, 0x0000, 0x0000 },
+        { 0x051F, 0x0000, 0x0000 },
+        { 0x0521, 0x0000, 0x0000 },
+        { 0x0523, 0x0000, 0x0000 },
+        { 0x0525, 0x0000, 0x0000 },
+        { 0x0527, 0x0000, 0x0000 },
+        { 0x0529, 0x0000, 0x0000 },
+        { 0x052B, 0x0000, 0x0000 },
+        { 0x052D, 0x0000, 0x0000 },
+        { 0x052F, 0x0000, 0x0000 },
+        { 0x0561, 0x0000, 0x0000 },
+        { 0x0562, 0x0000, 0x0000 },
+        { 0x0563, 0x0000, 0x0000 },
+        { 0x0564, 0x0000, 0x0000 },
+        { 0x0565, 0x0000, 0x0000 },
+        { 0x0566, 0x0000, 0x0000 },
+        { 0x0567, 0x0000, 0x0000 },
+        { 0x0568, 0x0000, 0x0000 },
+        { 0x0569, 0x0000, 0x0000 },
+        { 0x056A, 0x0000, 0x0000 },
+        { 0x056B, 0x0000, 0x0000 },
+        { 0x056C, 0x0000, 0x0000 },
+        { 0x056D, 0x0000, 0x0000 },
+        { 0x056E, 0x0000, 0x0000 },
+        { 0x056F, 0x0000, 0x0000 },
+        { 0x0570, 0x0000, 0x0000 },
+        { 0x0571, 0x0000, 0x0000 },
+        { 0x0572, 0x0000, 0x0000 },
+        { 0x0573, 0x0000, 0x0000 },
+        { 0x0574, 0x0000, 0x0000 },
+        { 0x0575, 0x0000, 0x0000 },
+        { 0x0576, 0x0000, 0x0000 },
+        { 0x0577, 0x0000, 0x0000 },
+        { 0x0578, 0x0000, 0x0000 },
+        { 0x0579, 0x0000, 0x0000 },
+        { 0x057A, 0x0000, 0x0000 },
+        { 0x057B, 0x0000, 0x0000 },
+        { 0x057C, 0x0000, 0x0000 },
+        { 0x057D, 0x0000, 0x0000 },
+        { 0x057E, 0x0000, 0x0000 },
+        { 0x057F, 0x0000, 0x0000 },
+        { 0x0580, 0x0000, 0x0000 },
+        { 0x0581, 0x0000, 0x0000 },
+        { 0x0582, 0x0000, 0x0000 },
+        { 0x0583, 0x0000, 0x0000 },
+        { 0x0584, 0x0000, 0x0000 },
+        { 0x0585, 0x0000, 0x0000 },
+        { 0x0586, 0x0000, 0x0000 },
+        { 0x0565, 0x0582, 0x0000 },
+        { 0x2D00, 0x0000, 0x0000 },
+        { 0x2D01, 0x0000, 0x0000 },
+        { 0x2D02, 0x0000, 0x0000 },
+        { 0x2D03, 0x0000, 0x0000 },
+        { 0x2D04, 0x0000, 0x0000 },
+        { 0x2D05, 0x0000, 0x0000 },
+        { 0x2D06, 0x0000, 0x0000 },
+        { 0x2D07, 0x0000, 0x0000 },
+        { 0x2D08, 0x0000, 0x0000 },
+        { 0x2D09, 0x0000, 0x0000 },
+        { 0x2D0A, 0x0000, 0x0000 },
+        { 0x2D0B, 0x0000, 0x0000 },
+        { 0x2D0C, 0x0000, 0x0000 },
+        { 0x2D0D, 0x0000, 0x0000 },
+        { 0x2D0E, 0x0000, 0x0000 },
+        { 0x2D0F, 0x0000, 0x0000 },
+        { 0x2D10, 0x0000, 0x0000 },
+        { 0x2D11, 0x0000, 0x0000 },
+        { 0x2D12, 0x0000, 0x0000 },
+        { 0x2D13, 0x0000, 0x0000 },
+        { 0x2D14, 0x0000, 0x0000 },
+        { 0x2D15, 0x0000, 0x0000 },
+        { 0x2D16, 0x0000, 0x0000 },
+        { 0x2D17, 0x0000, 0x0000 },
+        { 0x2D18, 0x0000, 0x0000 },
+        { 0x2D19, 0x0000, 0x0000 },
+        { 0x2D1A, 0x0000, 0x0000 },
+        { 0x2D1B, 0x0000, 0x0000 },
+        { 0x2D1C, 0x0000, 0x0000 },
+        { 0x2D1D, 0x0000, 0x0000 },
+        { 0x2D1E, 0x0000, 0x0000 },
+        { 0x2D1F, 0x0000, 0x0000 },
+        { 0x2D20, 0x0000, 0x0000 },
+        { 0x2D21, 0x0000, 0x0000 },
+        { 0x2D22, 0x0000, 0x0000 },
+        { 0x2D23, 0x0000, 0x0000 },
+        { 0x2D24, 0x0000, 0x0000 },
+        { 0x2D25, 0x0000, 0x0000 },
+        { 0x2D27, 0x0000, 0x0000 },
+        { 0x2D2D, 0x0000, 0x0000 },
+        { 0x13F0, 0x0000, 0x0000 },
+        { 0x13F1, 0x0000, 0x0000 },
+        { 0x13F2, 0x0000, 0x0000 },
+        { 0x13F3, 0x0000, 0x0000 },
+        { 0x13F4, 0x0000, 0x0000 },
+        { 0x13F5, 0x0000, 0x0000 },
+        { 0x0432, 0x0000, 0x0000 },
+        { 0x0434, 0x0000, 0x0000 },
+        { 0x043E, 0x0000, 0x0000 },
+        { 0x0441, 0x0000, 0x0000 },
+        { 0x0442, 0x0000, 0x0000 },
+        { 0x0442, 0x0000, 0x0000 },
+        { 0x044A, 0x0000, 0x0000 },
+        { 0x0463, 0x0000, 0x0000 },
+        { 0xA64B, 0x0000, 0x0000 },
+        { 0x10D0, 0x0000, 0x0000 },
+        { 0x10D1, 0x0000, 0x0000 },
+        { 0x10D2, 0x0000, 0x0000 },
+        { 0x10D3, 0x0000, 0x0000 },
+        { 0x10D4, 0x0000, 0x0000 },
+        { 0x10D5, 0x0000, 0x0000 },
+        { 0x10D6, 0x0000, 0x0000 },
+        { 0x10D7, 0x0000, 0x0000 },
+        { 0x10D8, 0x0000, 0x0000 },
+        { 0x10D9, 0x0000, 0x0000 },
+        { 0x10DA, 0x0000, 0x0000 },
+        { 0x10DB, 0x0000, 0x0000 },
+        { 0x10DC, 0x0000, 0x0000 },
+        { 0x10DD, 0x0000, 0x0000 },
+        { 0x10DE, 0x0000, 0x0000 },
+        { 0x10DF, 0x0000, 0x0000 },
+        { 0x10E0, 0x0000, 0x0000 },
+        { 0x10E1, 0x0000, 0x0000 },
+        { 0x10E2, 0x0000, 0x0000 },
+        { 0x10E3, 0x0000, 0x0000 },
+        { 0x10E4, 0x0000, 0x0000 },
+        { 0x10E5, 0x0000, 0x0000 },
+        { 0x10E6, 0x0000, 0x0000 },
+        { 0x10E7, 0x0000, 0x0000 },
+        { 0x10E8, 0x0000, 0x0000 },
+        { 0x10E9, 0x0000, 0x0000 },
+        { 0x10EA, 0x0000, 0x0000 },
+        { 0x10EB, 0x0000, 0x0000 },
+        { 0x10EC, 0x0000, 0x0000 },
+        { 0x10ED, 0x0000, 0x0000 },
+        { 0x10EE, 0x0000, 0x0000 },
+        { 0x10EF, 0x0000, 0x0000 },
+        { 0x10F0, 0x0000, 0x0000 },
+        { 0x10F1, 0x0000, 0x0000 },
+        { 0x10F2, 0x0000, 0x0000 },
+        { 0x10F3, 0x0000, 0x0000 },
+        { 0x10F4, 0x0000, 0x0000 },
+        { 0x10F5, 0x0000, 0x0000 },
+        { 0x10F6, 0x0000, 0x0000 },
+        { 0x10F7, 0x0000, 0x0000 },
+        { 0x10F8, 0x0000, 0x0000 },
+        { 0x10F9, 0x0000, 0x0000 },
+        { 0x10FA, 0x0000, 0x0000 },
+        { 0x10FD, 0x0000, 0x0000 },
+        { 0x10FE, 0x0000, 0x0000 },
+        { 0x10FF, 0x0000, 0x0000 },
+        { 0x1E01, 0x0000, 0x0000 },
+        { 0x1E03, 0x0000, 0x0000 },
+        { 0x1E05, 0x0000, 0x0000 },
+        { 0x1E07, 0x0000, 0x0000 },
+        { 0x1E09, 0x0000, 0x0000 },
+        { 0x1E0B, 0x0000, 0x0000 },
+        { 0x1E0D, 0x0000, 0x0000 },
+        { 0x1E0F, 0x0000, 0x0000 },
+        { 0x1E11, 0x0000, 0x0000 },
+        { 0x1E13, 0x0000, 0x0000 },
+        { 0x1E15, 0x0000, 0x0000 },
+        { 0x1E17, 0x0000, 0x0000 },
+        { 0x1E19, 0x0000, 0x0000 },
+        { 0x1E1B, 0x0000, 0x0000 },
+        { 0x1E1D, 0x0000, 0x0000 },
+        { 0x1E1F, 0x0000, 0x0000 },
+        { 0x1E21, 0x0000, 0x0000 },
+        { 0x1E23, 0x0000, 0x0000 },
+        { 0x1E25, 0x0000, 0x0000 },
+        { 0x1E27, 0x0000, 0x0000 },
+        { 0x1E29, 0x0000, 0x0000 },
+        { 0x1E2B, 0x0000, 0x0000 },
+        { 0x1E2D, 0x0000, 0x0000 },
+        { 0x1E2F, 0x0000, 0x0000 },
+        { 0x1E31, 0x0000, 0x0000 },
+        { 0x1E33, 0x0000, 0x0000 },
+        { 0x1E35, 0x0000, 0x0000 },
+        { 0x1E37, 0x0000, 0x0000 },
+        { 0x1E39, 0x0000, 0x0000 },
+        { 0x1E3B, 0x0000, 0x0000 },
+        { 0x1E3D, 0x0000, 0x0000 },
+        { 0x1E3F, 0x0000, 0x0000 },
+        { 0x1E41, 0x0000, 0x0000 },
+        { 0x1E43, 0x0000, 0x0000 },
+        { 0x1E45, 0x0000, 0x0000 },
+        { 0x1E47, 0x0000, 0x0000 },
+        { 0x1E49, 0x0000, 0x0000 },
+        { 0x1E4B, 0x0000, 0x0000 },
+        { 0x1E4D, 0x0000, 0x0000 },
+        { 0x1E4F, 0x0000, 0x0000 },
+        { 0x1E51, 0x0000, 0x0000 },
+        { 0x1E53, 0x0000, 0x0000 },
+        { 0x1E55, 0x0000, 0x0000 },
+        { 0x1E57, 0x0000, 0x0000 },
+        { 0x1E59, 0x0000, 0x0000 },
+        { 0x1E5B, 0x0000, 0x0000 },
+        { 0x1E5D, 0x0000, 0x0000 },
+        { 0x1E5F, 0x0000, 0x0000 },
+        { 0x1E61, 0x0000, 0x0000 },
+        { 0x1E63, 0x0000, 0x0000 },
+        { 0x1E65, 0x0000, 0x0000 },
+        { 0x1E67, 0x0000, 0x0000 },
+        { 0x1E69, 0x0000, 0x0000 },
+        { 0x1E6B, 0x0000, 0x0000 },
+        { 0x1E6D, 0x0000, 0x0000 },
+        { 0x1E6F, 0x0000, 0x0000 },
+        { 0x1E71, 0x0000, 0x0000 },
+        { 0x1E73, 0x0000, 0x0000 },
+        { 0x1E75, 0x0000, 0x0000 },
+        { 0x1E77, 0x0000, 0x0000 },
+        { 0x1E79, 0x0000, 0x0000 },
+        { 0x1E7B, 0x0000, 0x0000 },
+        { 0x1E7D, 0x0000, 0x0000 },
+        { 0x1E7F, 0x0000, 0x0000 },
+        { 0x1E81, 0x0000, 0x0000 },
+        { 0x1E83, 0x0000, 0x0000 },
+        { 0x1E85, 0x0000, 0x0000 },
+        { 0x1E87, 0x0000, 0x0000 },
+        { 0x1E89, 0x0000, 0x0000 },
+        { 0x1E8B, 0x0000, 0x0000 },
+        { 0x1E8D, 0x0000, 0x0000 },
+        { 0x1E8F, 0x0000, 0x0000 },
+        { 0x1E91, 0x0000, 0x0000 },
+        { 0x1E93, 0x0000, 0x0000 },
+        { 0x1E95, 0x0000, 0x0000 },
+        { 0x0068, 0x0331, 0x0000 },
+        { 0x0074, 0x0308, 0x0000 },
+        { 0x0077, 0x030A, 0x0000 },
+        { 0x0079, 0x030A, 0x0000 },
+        { 0x0061, 0x02BE, 0x0000 },
+        { 0x1E61, 0x0000, 0x0000 },
+        { 0x0073, 0x0073, 0x0000 },
+        { 0x1EA1, 0x0000, 0x0000 },
+        { 0x1EA3, 0x0000, 0x0000 },
+        { 0x1EA5, 0x0000, 0x0000 },
+        { 0x1EA7, 0x0000, 0x0000 },
+        { 0x1EA9, 0x0000, 0x0000 },
+        { 0x1EAB, 0x0000, 0x0000 },
+        { 0x1EAD, 0x0000, 0x0000 },
+        { 0x1EAF, 0x0000, 0x0000 },
+        { 0x1EB1, 0x0000, 0x0000 },
+        { 0x1EB3, 0x0000, 0x0000 },
+        { 0x1EB5, 0x0000, 0x0000 },
+        { 0x1EB7, 0x0000, 0x0000 },
+        { 0x1EB9, 0x0000, 0x0000 },
+        { 0x1EBB, 0x0000, 0x0000 },
+        { 0x1EBD, 0x0000, 0x0000 },
+        { 0x1EBF, 0x0000, 0x0000 },
+        { 0x1EC1, 0x0000, 0x0000 },
+        { 0x1EC3, 0x0000, 0x0000 },
+        { 0x1EC5, 0x0000, 0x0000 },
+        { 0x1EC7, 0x0000, 0x0000 },
+        { 0x1EC9, 0x0000, 0x0000 },
+        { 0x1ECB, 0x0000, 0x0000 },
+        { 0x1ECD, 0x0000, 0x0000 },
+        { 0x1ECF, 0x0000, 0x0000 },
+        { 0x1ED1, 0x0000, 0x0000 },
+        { 0x1ED3, 0x0000, 0x0000 },
+        { 0x1ED5, 0x0000, 0x0000 },
+        { 0x1ED7, 0x0000, 0x0000 },
+        { 0x1ED9, 0x0000, 0x0000 },
+        { 0x1EDB, 0x0000, 0x0000 },
+        { 0x1EDD, 0x0000, 0x0000 },
+        { 0x1EDF, 0x0000, 0x0000 },
+        { 0x1EE1, 0x0000, 0x0000 },
+        { 0x1EE3, 0x0000, 0x0000 },
+        { 0x1EE5, 0x0000, 0x0000 },
+        { 0x1EE7, 0x0000, 0x0000 },
+        { 0x1EE9, 0x0000, 0x0000 },
+        { 0x1EEB, 0x0000, 0x0000 },
+        { 0x1EED, 0x0000, 0x0000 },
+        { 0x1EEF, 0x0000, 0x0000 },
+        { 0x1EF1, 0x0000, 0x0000 },
+        { 0x1EF3, 0x0000, 0x0000 },
+        { 0x1EF5, 0x0000, 0x0000 },
+        { 0x1EF7, 0x0000, 0x0000 },
+        { 0x1EF9, 0x0000, 0x0000 },
+        { 0x1EFB, 0x0000, 0x0000 },
+        { 0x1EFD, 0x0000, 0x0000 },
+        { 0x1EFF, 0x0000, 0x0000 },
+        { 0x1F00, 0x0000, 0x0000 },
+        { 0x1F01, 0x0000, 0x0000 },
+        { 0x1F02, 0x0000, 0x0000 },
+        { 0x1F03, 0x0000, 0x0000 },
+        { 0x1F04, 0x0000, 0x0000 },
+        { 0x1F05, 0x0000, 0x0000 },
+        { 0x1F06, 0x0000, 0x0000 },
+        { 0x1F07, 0x0000, 0x0000 },
+        { 0x1F10, 0x0000, 0x0000 },
+        { 0x1F11, 0x0000, 0x0000 },
+        { 0x1F12, 0x0000, 0x0000 },
+        { 0x1F13, 0x0000, 0x0000 },
+        { 0x1F14, 0x0000, 0x0000 },
+        { 0x1F15, 0x0000, 0x0000 },
+        { 0x1F20, 0x0000, 0x0000 },
+        { 0x1F21, 0x0000, 0x0000 },
+        { 0x1F22, 0x0000, 0x0000 },
+        { 0x1F23, 0x0000, 0x0000 },
+        { 0x1F24, 0x0000, 0x0000 },
+        { 0x1F25, 0x0000, 0x0000 },
+        { 0x1F26, 0x0000, 0x0000 },
+        { 0x1F27, 0x0000, 0x0000 },
+        { 0x1F30, 0x0000, 0x0000 },
+        { 0x1F31, 0x0000, 0x0000 },
+        { 0x1F32, 0x0000, 0x0000 },
+        { 0x1F33, 0x0000, 0x0000 },
+        { 0x1F34, 0x0000, 0x0000 },
+        { 0x1F35, 0x0000, 0x0000 },
+        { 0x1F36, 0x0000, 0x0000 },
+        { 0x1F37, 0x0000, 0x0000 },
+        { 0x1F40, 0x0000, 0x0000 },
+        { 0x1F41, 0x0000, 0x0000 },
+        { 0x1F42, 0x0000, 0x0000 },
+        { 0x1F43, 0x0000, 0x0000 },
+        { 0x1F44, 0x0000, 0x0000 },
+        { 0x1F45, 0x0000, 0x0000 },
+        { 0x03C5, 0x0313, 0x0000 },
+        { 0x03C5, 0x0313, 0x0300 },
+        { 0x03C5, 0x0313, 0x0301 },
+        { 0x03C5, 0x0313, 0x0342 },
+        { 0x1F51, 0x0000, 0x0000 },
+        { 0x1F53, 0x0000, 0x0000 },
+        { 0x1F55, 0x0000, 0x0000 },
+        { 0x1F57, 0x0000, 0x0000 },
+        { 0x1F60, 0x0000, 0x0000 },
+        { 0x1F61, 0x0000, 0x0000 },
+        { 0x1F62, 0x0000, 0x0000 },
+        { 0x1F63, 0x0000, 0x0000 },
+        { 0x1F64, 0x0000, 0x0000 },
+        { 0x1F65, 0x0000, 0x0000 },
+        { 0x1F66, 0x0000, 0x0000 },
+        { 0x1F67, 0x0000, 0x0000 },
+        { 0x1F00, 0x03B9, 0x0000 },
+        { 0x1F01, 0x03B9, 0x0000 },
+        { 0x1F02, 0x03B9, 0x0000 },
+        { 0x1F03, 0x03B9, 0x0000 },
+        { 0x1F04, 0x03B9, 0x0000 },
+        { 0x1F05, 0x03B9, 0x0000 },
+        { 0x1F06, 0x03B9, 0x0000 },
+        { 0x1F07, 0x03B9, 0x0000 },
+        { 0x1F00, 0x03B9, 0x0000 },
+        { 0x1F01, 0x03B9, 0x0000 },
+        { 0x1F02, 0x03B9, 0x0000 },
+        { 0x1F03, 0x03B9, 0x0000 },
+        { 0x1F04, 0x03B9, 0x0000 },
+        { 0x1F05, 0x03B9, 0x0000 },
+        { 0x1F06, 0x03B9, 0x0000 },
+        { 0x1F07, 0x03B9, 0x0000 },
+        { 0x1F20, 0x03B9, 0x0000 },
+        { 0x1F21, 0x03B9, 0x0000 },
+        { 0x1F22, 0x03B9, 0x0000 },
+        { 0x1F23, 0x03B9, 0x0000 },
+        { 0x1F24, 0x03B9, 0x0000 },
+        { 0x1F25, 0x03B9, 0x0000 },
+        { 0x1F26, 0x03B9, 0x0000 },
+        { 0x1F27, 0x03B9, 0x0000 },
+        { 0x1F20, 0x03B9, 0x0000 },
+        { 0x1F21, 0x03B9, 0x0000 },
+        { 0x1F22, 0x03B9, 0x0000 },
+        { 0x1F23, 0x03B9, 0x0000 },
+        { 0x1F24, 0x03B9, 0x0000 },
+        { 0x1F25, 0x03B9, 0x0000 },
+        { 0x1F26, 0x03B9, 0x0000 },
+        { 0x1F27, 0x03B9, 0x0000 },
+        { 0x1F60, 0x03B9, 0x0000 },
+        { 0x1F61, 0x03B9, 0x0000 },
+        { 0x1F62, 0x03B9, 0x0000 },
+        { 0x1F63, 0x03B9, 0x0000 },
+        { 0x1F64, 0x03B9, 0x0000 },
+        { 0x1F65, 0x03B9, 0x0000 },
+        { 0x1F66, 0x03B9, 0x0000 },
+        { 0x1F67, 0x03B9, 0x0000 },
+        { 0x1F60, 0x03B9, 0x0000 },
+        { 0x1F61, 0x03B9, 0x0000 },
+        { 0x1F62, 0x03B9, 0x0000 },
+        { 0x1F63, 0x03B9, 0x0000 },
+        { 0x1F64, 0x03B9, 0x0000 },
+        { 0x1F65, 0x03B9, 0x0000 },
+        { 0x1F66, 0x03B9, 0x0000 },
+        { 0x1F67, 0x03B9, 0x0000 },
+        { 0x1F70, 0x03B9, 0x0000 },
+        { 0x03B1, 0x03B9, 0x0000 },
+        { 0x03AC, 0x03B9, 0x0000 },
+        { 0x03B1, 0x0342, 0x0000 },
+        { 0x03B1, 0x0342, 0x03B9 },
+        { 0x1FB0, 0x0000, 0x0000 },
+        { 0x1FB1, 0x0000, 0x0000 },
+        { 0x1F70, 0x0000, 0x0000 },
+        { 0x1F71, 0x0000, 0x0000 },
+        { 0x03B1, 0x03B9, 0x0000 },
+        { 0x03B9, 0x0000, 0x0000 },
+        { 0x1F74, 0x03B9, 0x0000 },
+        { 0x03B7, 0x03B9, 0x0000 },
+        { 0x03AE, 0x03B9, 0x0000 },
+        { 0x03B7, 0x0342, 0x0000 },
+        { 0x03B7, 0x0342, 0x03B9 },
+        { 0x1F72, 0x0000, 0x0000 },
+        { 0x1F73, 0x0000, 0x0000 },
+        { 0x1F74, 0x0000, 0x0000 },
+        { 0x1F75, 0x0000, 0x0000 },
+        { 0x03B7, 0x03B9, 0x0000 },
+        { 0x03B9, 0x0308, 0x0300 },
+        { 0x03B9, 0x0308, 0x0301 },
+        { 0x03B9, 0x0342, 0x0000 },
+        { 0x03B9, 0x0308, 0x0342 },
+        { 0x1FD0, 0x0000, 0x0000 },
+        { 0x1FD1, 0x0000, 0x0000 },
+        { 0x1F76, 0x0000, 0x0000 },
+        { 0x1F77, 0x0000, 0x0000 },
+        { 0x03C5, 0x0308, 0x0300 },
+        { 0x03C5, 0x0308, 0x0301 },
+        { 0x03C1, 0x0313, 0x0000 },
+        { 0x03C5, 0x0342, 0x0000 },
+        { 0x03C5, 0x0308, 0x0342 },
+        { 0x1FE0, 0x0000, 0x0000 },
+        { 0x1FE1, 0x0000, 0x0000 },
+        { 0x1F7A, 0x0000, 0x0000 },
+        { 0x1F7B, 0x0000, 0x0000 },
+        { 0x1FE5, 0x0000, 0x0000 },
+        { 0x1F7C, 0x03B9, 0x0000 },
+        { 0x03C9, 0x03B9, 0x0000 },
+        { 0x03CE, 0x03B9, 0x0000 },
+        { 0x03C9, 0x0342, 0x0000 },
+        { 0x03C9, 0x0342, 0x03B9 },
+        { 0x1F78, 0x0000, 0x0000 },
+        { 0x1F79, 0x0000, 0x0000 },
+        { 0x1F7C, 0x0000, 0x0000 },
+        { 0x1F7D, 0x0000, 0x0000 },
+        { 0x03C9, 0x03B9, 0x0000 },
+        { 0x03C9, 0x0000, 0x0000 },
+        { 0x006B, 0x0000, 0x0000 },
+        { 0x00E5, 0x0000, 0x0000 },
+        { 0x214E, 0x0000, 0x0000 },
+        { 0x2170, 0x0000, 0x0000 },
+        { 0x2171, 0x0000, 0x0000 },
+        { 0x2172, 0x0000, 0x0000 },
+        { 0x2173, 0x0000, 0x0000 },
+        { 0x2174, 0x0000, 0x0000 },
+        { 0x2175, 0x0000, 0x0000 },
+        { 0x2176, 0x0000, 0x0000 },
+        { 0x2177, 0x0000, 0x0000 },
+        { 0x2178, 0x0000, 0x0000 },
+        { 0x2179, 0x0000, 0x0000 },
+        { 0x217A, 0x0000, 0x0000 },
+        { 0x217B, 0x0000, 0x0000 },
+        { 0x217C, 0x0000, 0x0000 },
+        { 0x217D, 0x0000, 0x0000 },
+        { 0x217E, 0x0000, 0x0000 },
+        { 0x217F, 0x0000, 0x0000 },
+        { 0x2184, 0x0000, 0x0000 },
+        { 0x24D0, 0x0000, 0x0000 },
+        { 0x24D1, 0x0000, 0x0000 },
+        { 0x24D2, 0x0000, 0x0000 },
+        { 0x24D3, 0x0000, 0x0000 },
+        { 0x24D4, 0x0000, 0x0000 },
+        { 0x24D5, 0x0000, 0x0000 },
+        { 0x24D6, 0x0000, 0x0000 },
+        { 0x24D7, 0x0000, 0x0000 },
+        { 0x24D8, 0x0000, 0x0000 },
+        { 0x24D9, 0x0000, 0x0000 },
+        { 0x24DA, 0x0000, 0x0000 },
+        { 0x24DB, 0x0000, 0x0000 },
+        { 0x24DC, 0x0000, 0x0000 },
+        { 0x24DD, 0x0000, 0x0000 },
+        { 0x24DE, 0x0000, 0x0000 },
+        { 0x24DF, 0x0000, 0x0000 },
+        { 0x24E0, 0x0000, 0x0000 },
+        { 0x24E1, 0x0000, 0x0000 },
+        { 0x24E2, 0x0000, 0x0000 },
+        { 0x24E3, 0x0000, 0x0000 },
+        { 0x24E4, 0x0000, 0x0000 },
+        { 0x24E5, 0x0000, 0x0000 },
+        { 0x24E6, 0x0000, 0x0000 },
+        { 0x24E7, 0x0000, 0x0000 },
+        { 0x24E8, 0x0000, 0x0000 },
+        { 0x24E9, 0x0000, 0x0000 },
+        { 0x2C30, 0x0000, 0x0000 },
+        { 0x2C31, 0x0000, 0x0000 },
+        { 0x2C32, 0x0000, 0x0000 },
+        { 0x2C33, 0x0000, 0x0000 },
+        { 0x2C34, 0x0000, 0x0000 },
+        { 0x2C35, 0x0000, 0x0000 },
+        { 0x2C36, 0x0000, 0x0000 },
+        { 0x2C37, 0x0000, 0x0000 },
+        { 0x2C38, 0x0000, 0x0000 },
+        { 0x2C39, 0x0000, 0x0000 },
+        { 0x2C3A, 0x0000, 0x0000 },
+        { 0x2C3B, 0x0000, 0x0000 },
+        { 0x2C3C, 0x0000, 0x0000 },
+        { 0x2C3D, 0x0000, 0x0000 },
+        { 0x2C3E, 0x0000, 0x0000 },
+        { 0x2C3F, 0x0000, 0x0000 },
+        { 0x2C40, 0x0000, 0x0000 },
+        { 0x2C41, 0x0000, 0x0000 },
+        { 0x2C42, 0x0000, 0x0000 },
+        { 0x2C43, 0x0000, 0x0000 },
+        { 0x2C44, 0x0000, 0x0000 },
+        { 0x2C45, 0x0000, 0x0000 },
+        { 0x2C46, 0x0000, 0x0000 },
+        { 0x2C47, 0x0000, 0x0000 },
+        { 0x2C48, 0x0000, 0x0000 },
+        { 0x2C49, 0x0000, 0x0000 },
+        { 0x2C4A, 0x0000, 0x0000 },
+        { 0x2C4B, 0x0000, 0x0000 },
+        { 0x2C4C, 0x0000, 0x0000 },
+        { 0x2C4D, 0x0000, 0x0000 },
+        { 0x2C4E, 0x0000, 0x0000 },
+        { 0x2C4F, 0x0000, 0x0000 },
+        { 0x2C50, 0x0000, 0x0000 },
+        { 0x2C51, 0x0000, 0x0000 },
+        { 0x2C52, 0x0000, 0x0000 },
+        { 0x2C53, 0x0000, 0x0000 },
+        { 0x2C54, 0x0000, 0x0000 },
+        { 0x2C55, 0x0000, 0x0000 },
+        { 0x2C56, 0x0000, 0x0000 },
+        { 0x2C57, 0x0000, 0x0000 },
+        { 0x2C58, 0x0000, 0x0000 },
+        { 0x2C59, 0x0000, 0x0000 },
+        { 0x2C5A, 0x0000, 0x0000 },
+        { 0x2C5B, 0x0000, 0x0000 },
+        { 0x2C5C, 0x0000, 0x0000 },
+        { 0x2C5D, 0x0000, 0x0000 },
+        { 0x2C5E, 0x0000, 0x0000 },
+        { 0x2C5F, 0x0000, 0x0000 },
+        { 0x2C61, 0x0000, 0x0000 },
+        { 0x026B, 0x0000, 0x0000 },
+        { 0x1D7D, 0x0000, 0x0000 },
+        { 0x027D, 0x0000, 0x0000 },
+        { 0x2C68, 0x0000, 0x0000 },
+        { 0x2C6A, 0x0000, 0x0000 },
+        { 0x2C6C, 0x0000, 0x0000 },
+        { 0x0251, 0x0000, 0x0000 },
+        { 0x0271, 0x0000, 0x0000 },
+        { 0x0250, 0x0000, 0x0000 },
+        { 0x0252, 0x0000, 0x0000 },
+        { 0x2C73, 0x0000, 0x0000 },
+        { 0x2C76, 0x0000, 0x0000 },
+        { 0x023F, 0x0000, 0x0000 },
+        { 0x0240, 0x0000, 0x0000 },
+        { 0x2C81, 0x0000, 0x0000 },
+        { 0x2C83, 0x0000, 0x0000 },
+        { 0x2C85, 0x0000, 0x0000 },
+        { 0x2C87, 0x0000, 0x0000 },
+        { 0x2C89, 0x0000, 0x0000 },
+        { 0x2C8B, 0x0000, 0x0000 },
+        { 0x2C8D, 0x0000, 0x0000 },
+        { 0x2C8F, 0x0000, 0x0000 },
+        { 0x2C91, 0x0000, 0x0000 },
+        { 0x2C93, 0x0000, 0x0000 },
+        { 0x2C95, 0x0000, 0x0000 },
+        { 0x2C97, 0x0000, 0x0000 },
+        { 0x2C99, 0x0000, 0x0000 },
+        { 0x2C9B, 0x0000, 0x0000 },
+        { 0x2C9D, 0x0000, 0x0000 },
+        { 0x2C9F, 0x0000, 0x0000 },
+        { 0x2CA1, 0x0000, 0x0000 },
+        { 0x2CA3, 0x0000, 0x0000 },
+        { 0x2CA5, 0x0000, 0x0000 },
+        { 0x2CA7, 0x0000, 0x0000 },
+        { 0x2CA9, 0x0000, 0x0000 },
+        { 0x2CAB, 0x0000, 0x0000 },
+        { 0x2CAD, 0x0000, 0x0000 },
+        { 0x2CAF, 0x0000, 0x0000 },
+        { 0x2CB1, 0x0000, 0x0000 },
+        { 0x2CB3, 0x0000, 0x0000 },
+        { 0x2CB5, 0x0000, 0x0000 },
+        { 0x2CB7, 0x0000, 0x0000 },
+        { 0x2CB9, 0x0000, 0x0000 },
+        { 0x2CBB, 0x0000, 0x0000 },
+        { 0x2CBD, 0x0000, 0x0000 },
+        { 0x2CBF, 0x0000, 0x0000 },
+        { 0x2CC1, 0x0000, 0x0000 },
+        { 0x2CC3, 0x0000, 0x0000 },
+        { 0x2CC5, 0x0000, 0x0000 },
+        { 0x2CC7, 0x0000, 0x0000 },
+        { 0x2CC9, 0x0000, 0x0000 },
+        { 0x2CCB, 0x0000, 0x0000 },
+        { 0x2CCD, 0x0000, 0x0000 },
+        { 0x2CCF, 0x0000, 0x0000 },
+        { 0x2CD1, 0x0000, 0x0000 },
+        { 0x2CD3, 0x0000, 0x0000 },
+        { 0x2CD5, 0x0000, 0x0000 },
+        { 0x2CD7, 0x0000, 0x0000 },
+        { 0x2CD9, 0x0000, 0x0000 },
+        { 0x2CDB, 0x0000, 0x0000 },
+        { 0x2CDD, 0x0000, 0x0000 },
+        { 0x2CDF, 0x0000, 0x0000 },
+        { 0x2CE1, 0x0000, 0x0000 },
+        { 0x2CE3, 0x0000, 0x0000 },
+        { 0x2CEC, 0x0000, 0x0000 },
+        { 0x2CEE, 0x0000, 0x0000 },
+        { 0x2CF3, 0x0000, 0x0000 },
+        { 0xA641, 0x0000, 0x0000 },
+        { 0xA643, 0x0000, 0x0000 },
+        { 0xA645, 0x0000, 0x0000 },
+        { 0xA647, 0x0000, 0x0000 },
+        { 0xA649, 0x0000, 0x0000 },
+        { 0xA64B, 0x0000, 0x0000 },
+        { 0xA64D, 0x0000, 0x0000 },
+        { 0xA64F, 0x0000, 0x0000 },
+        { 0xA651, 0x0000, 0x0000 },
+        { 0xA653, 0x0000, 0x0000 },
+        { 0xA655, 0x0000, 0x0000 },
+        { 0xA657, 0x0000, 0x0000 },
+        { 0xA659, 0x0000, 0x0000 },
+        { 0xA65B, 0x0000, 0x0000 },
+        { 0xA65D, 0x0000, 0x0000 },
+        { 0xA65F, 0x0000, 0x0000 },
+        { 0xA661, 0x0000, 0x0000 },
+        { 0xA663, 0x0000, 0x0000 },
+        { 0xA665, 0x0000, 0x0000 },
+        { 0xA667, 0x0000, 0x0000 },
+        { 0xA669, 0x0000, 0x0000 },
+        { 0xA66B, 0x0000, 0x0000 },
+        { 0xA66D, 0x0000, 0x0000 },
+        { 0xA681, 0x0000, 0x0000 },
+        { 0xA683, 0x0000, 0x0000 },
+        { 0xA685, 0x0000, 0x0000 },
+        { 0xA687, 0x0000, 0x0000 },
+        { 0xA689, 0x0000, 0x0000 },
+        { 0xA68B, 0x0000, 0x0000 },
+        { 0xA68D, 0x0000, 0x0000 },
+        { 0xA68F, 0x0000, 0x0000 },
+        { 0xA691, 0x0000, 0x0000 },
+        { 0xA693, 0x0000, 0x0000 },
+        { 0xA695, 0x0000, 0x0000 },
+        { 0xA697, 0x0000, 0x0000 },
+        { 0xA699, 0x0000, 0x0000 },
+        { 0xA69B, 0x0000, 0x0000 },
+        { 0xA723, 0x0000, 0x0000 },
+        { 0xA725, 0x0000, 0x0000 },
+        { 0xA727, 0x0000, 0x0000 },
+        { 0xA729, 0x0000, 0x0000 },
+        { 0xA72B, 0x0000, 0x0000 },
+        { 0xA72D, 0x0000, 0x0000 },
+        { 0xA72F, 0x0000, 0x0000 },
+        { 0xA733, 0x0000, 0x0000 },
+        { 0xA735, 0x0000, 0x0000 },
+        { 0xA737, 0x0000, 0x0000 },
+        { 0xA739, 0x0000, 0x0000 },
+        { 0xA73B, 0x0000, 0x0000 },
+        { 0xA73D, 0x0000, 0x0000 },
+        { 0xA73F, 0x0000, 0x0000 },
+        { 0xA741, 0x0000, 0x0000 },
+        { 0xA743, 0x0000, 0x0000 },
+        { 0xA745, 0x0000, 0x0000 },
+        { 0xA747, 0x0000, 0x0000 },
+        { 0xA749, 0x0000, 0x0000 },
+        { 0xA74B, 0x0000, 0x0000 },
+        { 0xA74D, 0x0000, 0x0000 },
+        { 0xA74F, 0x0000, 0x0000 },
+        { 0xA751, 0x0000, 0x0000 },
+        { 0xA753, 0x0000, 0x0000 },
+        { 0xA755, 0x0000, 0x0000 },
+        { 0xA757, 0x0000, 0x0000 },
+        { 0xA759, 0x0000, 0x0000 },
+        { 0xA75B, 0x0000, 0x0000 },
+        { 0xA75D, 0x0000, 0x0000 },
+        { 0xA75F, 0x0000, 0x0000 },
+        { 0xA761, 0x0000, 0x0000 },
+        { 0xA763, 0x0000, 0x0000 },
+        { 0xA765, 0x0000, 0x0000 },
+        { 0xA767, 0x0000, 0x0000 },
+        { 0xA769, 0x0000, 0x0000 },
+        { 0xA76B, 0x0000, 0x0000 },
+        { 0xA76D, 0x0000, 0x0000 },
+        { 0xA76F, 0x0000, 0x0000 },
+        { 0xA77A, 0x0000, 0x0000 },
+        { 0xA77C, 0x0000, 0x0000 },
+        { 0x1D79, 0x0000, 0x0000 },
+        { 0xA77F, 0x0000, 0x0000 },
+        { 0xA781, 0x0000, 0x0000 },
+        { 0xA783, 0x0000, 0x0000 },
+        { 0xA785, 0x0000, 0x0000 },
+        { 0xA787, 0x0000, 0x0000 },
+        { 0xA78C, 0x0000, 0x0000 },
+        { 0x0265, 0x0000, 0x0000 },
+        { 0xA791, 0x0000, 0x0000 },
+        { 0xA793, 0x0000, 0x0000 },
+        { 0xA797, 0x0000, 0x0000 },
+        { 0xA799, 0x0000, 0x0000 },
+        { 0xA79B, 0x0000, 0x0000 },
+        { 0xA79D, 0x0000, 0x0000 },
+        { 0xA79F, 0x0000, 0x0000 },
+        { 0xA7A1, 0x0000, 0x0000 },
+        { 0xA7A3, 0x0000, 0x0000 },
+        { 0xA7A5, 0x0000, 0x0000 },
+        { 0xA7A7, 0x0000, 0x0000 },
+        { 0xA7A9, 0x0000, 0x0000 },
+        { 0x0266, 0x0000, 0x0000 },
+        { 0x025C, 0x0000, 0x0000 },
+        { 0x0261, 0x0000, 0x0000 },
+        { 0x026C, 0x0000, 0x0000 },
+        { 0x026A, 0x0000, 0x0000 },
+        { 0x029E, 0x0000, 0x0000 },
+        { 0x0287, 0x0000, 0x0000 },
+        { 0x029D, 0x0000, 0x0000 },
+        { 0xAB53, 0x0000, 0x0000 },
+        { 0xA7B5, 0x0000, 0x0000 },
+        { 0xA7B7, 0x0000, 0x0000 },
+        { 0xA7B9, 0x0000, 0x0000 },
+        { 0xA7BB, 0x0000, 0x0000 },
+        { 0xA7BD, 0x0000, 0x0000 },
+        { 0xA7BF, 0x0000, 0x0000 },
+        { 0xA7C1, 0x0000, 0x0000 },
+        { 0xA7C3, 0x0000, 0x0000 },
+        { 0xA794, 0x0000, 0x0000 },
+        { 0x0282, 0x0000, 0x0000 },
+        { 0x1D8E, 0x0000, 0x0000 },
+        { 0xA7C8, 0x0000, 0x0000 },
+        { 0xA7CA, 0x0000, 0x0000 },
+        { 0xA7D1, 0x0000, 0x0000 },
+        { 0xA7D7, 0x0000, 0x0000 },
+        { 0xA7D9, 0x0000, 0x0000 },
+        { 0xA7F6, 0x0000, 0x0000 },
+        { 0x13A0, 0x0000, 0x0000 },
+        { 0x13A1, 0x0000, 0x0000 },
+        { 0x13A2, 0x0000, 0x0000 },
+        { 0x13A3, 0x0000, 0x0000 },
+        { 0x13A4, 0x0000, 0x0000 },
+        { 0x13A5, 0x0000, 0x0000 },
+        { 0x13A6, 0x0000, 0x0000 },
+        { 0x13A7, 0x0000, 0x0000 },
+        { 0x13A8, 0x0000, 0x0000 },
+        { 0x13A9, 0x0000, 0x0000 },
+        { 0x13AA, 0x0000, 0x0000 },
+        { 0x13AB, 0x0000, 0x0000 },
+        { 0x13AC, 0x0000, 0x0000 },
+        { 0x13AD, 0x0000, 0x0000 },
+        { 0x13AE, 0x0000, 0x0000 },
+        { 0x13AF, 0x0000, 0x0000 },
+        { 0x13B0, 0x0000, 0x0000 },
+        { 0x13B1, 0x0000, 0x0000 },
+        { 0x13B2, 0x0000, 0x0000 },
+        { 0x13B3, 0x0000, 0x0000 },
+        { 0x13B4, 0x0000, 0x0000 },
+        { 0x13B5, 0x0000, 0x0000 },
+        { 0x13B6, 0x0000, 0x0000 },
+        { 0x13B7, 0x0000, 0x0000 },
+        { 0x13B8, 0x0000, 0x0000 },
+        { 0x13B9, 0x0000, 0x0000 },
+        { 0x13BA, 0x0000, 0x0000 },
+        { 0x13BB, 0x0000, 0x0000 },
+        { 0x13BC, 0x0000, 0x0000 },
+        { 0x13BD, 0x0000, 0x0000 },
+        { 0x13BE, 0x0000, 0x0000 },
+        { 0x13BF, 0x0000, 0x0000 },
+        { 0x13C0, 0x0000, 0x0000 },
+        { 0x13C1, 0x0000, 0x0000 },
+        { 0x13C2, 0x0000, 0x0000 },
+        { 0x13C3, 0x0000, 0x0000 },
+        { 0x13C4, 0x0000, 0x0000 },
+        { 0x13C5, 0x0000, 0x0000 },
+        { 0x13C6, 0x0000, 0x0000 },
+        { 0x13C7, 0x0000, 0x0000 },
+        { 0x13C8, 0x0000, 0x0000 },
+        { 0x13C9, 0x0000, 0x0000 },
+        { 0x13CA, 0x0000, 0x0000 },
+        { 0x13CB, 0x0000, 0x0000 },
+        { 0x13CC, 0x0000, 0x0000 },
+        { 0x13CD, 0x0000, 0x0000 },
+        { 0x13CE, 0x0000, 0x0000 },
+        { 0x13CF, 0x0000, 0x0000 },
+        { 0x13D0, 0x0000, 0x0000 },
+        { 0x13D1, 0x0000, 0x0000 },
+        { 0x13D2, 0x0000, 0x0000 },
+        { 0x13D3, 0x0000, 0x0000 },
+        { 0x13D4, 0x0000, 0x0000 },
+        { 0x13D5, 0x0000, 0x0000 },
+        { 0x13D6, 0x0000, 0x0000 },
+        { 0x13D7, 0x0000, 0x0000 },
+        { 0x13D8, 0x0000, 0x0000 },
+        { 0x13D9, 0x0000, 0x0000 },
+        { 0x13DA, 0x0000, 0x0000 },
+        { 0x13DB, 0x0000, 0x0000 },
+        { 0x13DC, 0x0000, 0x0000 },
+        { 0x13DD, 0x0000, 0x0000 },
+        { 0x13DE, 0x0000, 0x0000 },
+        { 0x13DF, 0x0000, 0x0000 },
+        { 0x13E0, 0x0000, 0x0000 },
+        { 0x13E1, 0x0000, 0x0000 },
+        { 0x13E2, 0x0000, 0x0000 },
+        { 0x13E3, 0x0000, 0x0000 },
+        { 0x13E4, 0x0000, 0x0000 },
+        { 0x13E5, 0x0000, 0x0000 },
+        { 0x13E6, 0x0000, 0x0000 },
+        { 0x13E7, 0x0000, 0x0000 },
+        { 0x13E8, 0x0000, 0x0000 },
+        { 0x13E9, 0x0000, 0x0000 },
+        { 0x13EA, 0x0000, 0x0000 },
+        { 0x13EB, 0x0000, 0x0000 },
+        { 0x13EC, 0x0000, 0x0000 },
+        { 0x13ED, 0x0000, 0x0000 },
+        { 0x13EE, 0x0000, 0x0000 },
+        { 0x13EF, 0x0000, 0x0000 },
+        { 0x0066, 0x0066, 0x0000 },
+        { 0x0066, 0x0069, 0x0000 },
+        { 0x0066, 0x006C, 0x0000 },
+        { 0x0066, 0x0066, 0x0069 },
+        { 0x0066, 0x0066, 0x006C },
+        { 0x0073, 0x0074, 0x0000 },
+        { 0x0073, 0x0074, 0x0000 },
+        { 0x0574, 0x0576, 0x0000 },
+        { 0x0574, 0x0565, 0x0000 },
+        { 0x0574, 0x056B, 0x0000 },
+        { 0x057E, 0x0576, 0x0000 },
+        { 0x0574, 0x056D, 0x0000 },
+        { 0xFF41, 0x0000, 0x0000 },
+        { 0xFF42, 0x0000, 0x0000 },
+        { 0xFF43, 0x0000, 0x0000 },
+        { 0xFF44, 0x0000, 0x0000 },
+        { 0xFF45, 0x0000, 0x0000 },
+        { 0xFF46, 0x0000, 0x0000 },
+        { 0xFF47, 0x0000, 0x0000 },
+        { 0xFF48, 0x0000, 0x0000 },
+        { 0xFF49, 0x0000, 0x0000 },
+        { 0xFF4A, 0x0000, 0x0000 },
+        { 0xFF4B, 0x0000, 0x0000 },
+        { 0xFF4C, 0x0000, 0x0000 },
+        { 0xFF4D, 0x0000, 0x0000 },
+        { 0xFF4E, 0x0000, 0x0000 },
+        { 0xFF4F, 0x0000, 0x0000 },
+        { 0xFF50, 0x0000, 0x0000 },
+        { 0xFF51, 0x0000, 0x0000 },
+        { 0xFF52, 0x0000, 0x0000 },
+        { 0xFF53, 0x0000, 0x0000 },
+        { 0xFF54, 0x0000, 0x0000 },
+        { 0xFF55, 0x0000, 0x0000 },
+        { 0xFF56, 0x0000, 0x0000 },
+        { 0xFF57, 0x0000, 0x0000 },
+        { 0xFF58, 0x0000, 0x0000 },
+        { 0xFF59, 0x0000, 0x0000 },
+        { 0xFF5A, 0x0000, 0x0000 },
+        { 0x10428, 0x0000, 0x0000 },
+        { 0x10429, 0x0000, 0x0000 },
+        { 0x1042A, 0x0000, 0x0000 },
+        { 0x1042B, 0x0000, 0x0000 },
+        { 0x1042C, 0x0000, 0x0000 },
+        { 0x1042D, 0x0000, 0x0000 },
+        { 0x1042E, 0x0000, 0x0000 },
+        { 0x1042F, 0x0000, 0x0000 },
+        { 0x10430, 0x0000, 0x0000 },
+        { 0x10431, 0x0000, 0x0000 },
+        { 0x10432, 0x0000, 0x0000 },
+        { 0x10433, 0x0000, 0x0000 },
+        { 0x10434, 0x0000, 0x0000 },
+        { 0x10435, 0x0000, 0x0000 },
+        { 0x10436, 0x0000, 0x0000 },
+        { 0x10437, 0x0000, 0x0000 },
+        { 0x10438, 0x0000, 0x0000 },
+        { 0x10439, 0x0000, 0x0000 },
+        { 0x1043A, 0x0000, 0x0000 },
+        { 0x1043B, 0x0000, 0x0000 },
+        { 0x1043C, 0x0000, 0x0000 },
+        { 0x1043D, 0x0000, 0x0000 },
+        { 0x1043E, 0x0000, 0x0000 },
+        { 0x1043F, 0x0000, 0x0000 },
+        { 0x10440, 0x0000, 0x0000 },
+        { 0x10441, 0x0000, 0x0000 },
+        { 0x10442, 0x0000, 0x0000 },
+        { 0x10443, 0x0000, 0x0000 },
+        { 0x10444, 0x0000, 0x0000 },
+        { 0x10445, 0x0000, 0x0000 },
+        { 0x10446, 0x0000, 0x0000 },
+        { 0x10447, 0x0000, 0x0000 },
+        { 0x10448, 0x0000, 0x0000 },
+        { 0x10449, 0x0000, 0x0000 },
+        { 0x1044A, 0x0000, 0x0000 },
+        { 0x1044B, 0x0000, 0x0000 },
+        { 0x1044C, 0x0000, 0x0000 },
+        { 0x1044D, 0x0000, 0x0000 },
+        { 0x1044E, 0x0000, 0x0000 },
+        { 0x1044F, 0x0000, 0x0000 },
+        { 0x104D8, 0x0000, 0x0000 },
+        { 0x104D9, 0x0000, 0x0000 },
+        { 0x104DA, 0x0000, 0x0000 },
+        { 0x104DB, 0x0000, 0x0000 },
+        { 0x104DC, 0x0000, 0x0000 },
+        { 0x104DD, 0x0000, 0x0000 },
+        { 0x104DE, 0x0000, 0x0000 },
+        { 0x104DF, 0x0000, 0x0000 },
+        { 0x104E0, 0x0000, 0x0000 },
+        { 0x104E1, 0x0000, 0x0000 },
+        { 0x104E2, 0x0000, 0x0000 },
+        { 0x104E3, 0x0000, 0x0000 },
+        { 0x104E4, 0x0000, 0x0000 },
+        { 0x104E5, 0x0000, 0x0000 },
+        { 0x104E6, 0x0000, 0x0000 },
+        { 0x104E7, 0x0000, 0x0000 },
+        { 0x104E8, 0x0000, 0x0000 },
+        { 0x104E9, 0x0000, 0x0000 },
+        { 0x104EA, 0x0000, 0x0000 },
+        { 0x104EB, 0x0000, 0x0000 },
+        { 0x104EC, 0x0000, 0x0000 },
+        { 0x104ED, 0x0000, 0x0000 },
+        { 0x104EE, 0x0000, 0x0000 },
+        { 0x104EF, 0x0000, 0x0000 },
+        { 0x104F0, 0x0000, 0x0000 },
+        { 0x104F1, 0x0000, 0x0000 },
+        { 0x104F2, 0x0000, 0x0000 },
+        { 0x104F3, 0x0000, 0x0000 },
+        { 0x104F4, 0x0000, 0x0000 },
+        { 0x104F5, 0x0000, 0x0000 },
+        { 0x104F6, 0x0000, 0x0000 },
+        { 0x104F7, 0x0000, 0x0000 },
+        { 0x104F8, 0x0000, 0x0000 },
+        { 0x104F9, 0x0000, 0x0000 },
+        { 0x104FA, 0x0000, 0x0000 },
+        { 0x104FB, 0x0000, 0x0000 },
+        { 0x10597, 0x0000, 0x0000 },
+        { 0x10598, 0x0000, 0x0000 },
+        { 0x10599, 0x0000, 0x0000 },
+        { 0x1059A, 0x0000, 0x0000 },
+        { 0x1059B, 0x0000, 0x0000 },
+        { 0x1059C, 0x0000, 0x0000 },
+        { 0x1059D, 0x0000, 0x0000 },
+        { 0x1059E, 0x0000, 0x0000 },
+        { 0x1059F, 0x0000, 0x0000 },
+        { 0x105A0, 0x0000, 0x0000 },
+        { 0x105A1, 0x0000, 0x0000 },
+        { 0x105A3, 0x0000, 0x0000 },
+        { 0x105A4, 0x0000, 0x0000 },
+        { 0x105A5, 0x0000, 0x0000 },
+        { 0x105A6, 0x0000, 0x0000 },
+        { 0x105A7, 0x0000, 0x0000 },
+        { 0x105A8, 0x0000, 0x0000 },
+        { 0x105A9, 0x0000, 0x0000 },
+        { 0x105AA, 0x0000, 0x0000 },
+        { 0x105AB, 0x0000, 0x0000 },
+        { 0x105AC, 0x0000, 0x0000 },
+        { 0x105AD, 0x0000, 0x0000 },
+        { 0x105AE, 0x0000, 0x0000 },
+        { 0x105AF, 0x0000, 0x0000 },
+        { 0x105B0, 0x0000, 0x0000 },
+        { 0x105B1, 0x0000, 0x0000 },
+        { 0x105B3, 0x0000, 0x0000 },
+        { 0x105B4, 0x0000, 0x0000 },
+        { 0x105B5, 0x0000, 0x0000 },
+        { 0x105B6, 0x0000, 0x0000 },
+        { 0x105B7, 0x0000, 0x0000 },
+        { 0x105B8, 0x0000, 0x0000 },
+        { 0x105B9, 0x0000, 0x0000 },
+        { 0x105BB, 0x0000, 0x0000 },
+        { 0x105BC, 0x0000, 0x0000 },
+        { 0x10CC0, 0x0000, 0x0000 },
+        { 0x10CC1, 0x0000, 0x0000 },
+        { 0x10CC2, 0x0000, 0x0000 },
+        { 0x10CC3, 0x0000, 0x0000 },
+        { 0x10CC4, 0x0000, 0x0000 },
+        { 0x10CC5, 0x0000, 0x0000 },
+        { 0x10CC6, 0x0000, 0x0000 },
+        { 0x10CC7, 0x0000, 0x0000 },
+        { 0x10CC8, 0x0000, 0x0000 },
+        { 0x10CC9, 0x0000, 0x0000 },
+        { 0x10CCA, 0x0000, 0x0000 },
+        { 0x10CCB, 0x0000, 0x0000 },
+        { 0x10CCC, 0x0000, 0x0000 },
+        { 0x10CCD, 0x0000, 0x0000 },
+        { 0x10CCE, 0x0000, 0x0000 },
+        { 0x10CCF, 0x0000, 0x0000 },
+        { 0x10CD0, 0x0000, 0x0000 },
+        { 0x10CD1, 0x0000, 0x0000 },
+        { 0x10CD2, 0x0000, 0x0000 },
+        { 0x10CD3, 0x0000, 0x0000 },
+        { 0x10CD4, 0x0000, 0x0000 },
+        { 0x10CD5, 0x0000, 0x0000 },
+        { 0x10CD6, 0x0000, 0x0000 },
+        { 0x10CD7, 0x0000, 0x0000 },
+        { 0x10CD8, 0x0000, 0x0000 },
+        { 0x10CD9, 0x0000, 0x0000 },
+        { 0x10CDA, 0x0000, 0x0000 },
+        { 0x10CDB, 0x0000, 0x0000 },
+        { 0x10CDC, 0x0000, 0x0000 },
+        { 0x10CDD, 0x0000, 0x0000 },
+        { 0x10CDE, 0x0000, 0x0000 },
+        { 0x10CDF, 0x0000, 0x0000 },
+        { 0x10CE0, 0x0000, 0x0000 },
+        { 0x10CE1, 0x0000, 0x0000 },
+        { 0x10CE2, 0x0000, 0x0000 },
+        { 0x10CE3, 0x0000, 0x0000 },
+        { 0x10CE4, 0x0000, 0x0000 },
+        { 0x10CE5, 0x0000, 0x0000 },
+        { 0x10CE6, 0x0000, 0x0000 },
+        { 0x10CE7, 0x0000, 0x0000 },
+        { 0x10CE8, 0x0000, 0x0000 },
+        { 0x10CE9, 0x0000, 0x0000 },
+        { 0x10CEA, 0x0000, 0x0000 },
+        { 0x10CEB, 0x0000, 0x0000 },
+        { 0x10CEC, 0x0000, 0x0000 },
+        { 0x10CED, 0x0000, 0x0000 },
+        { 0x10CEE, 0x0000, 0x0000 },
+        { 0x10CEF, 0x0000, 0x0000 },
+        { 0x10CF0, 0x0000, 0x0000 },
+        { 0x10CF1, 0x0000, 0x0000 },
+        { 0x10CF2, 0x0000, 0x0000 },
+        { 0x118C0, 0x0000, 0x0000 },
+        { 0x118C1, 0x0000, 0x0000 },
+        { 0x118C2, 0x0000, 0x0000 },
+        { 0x118C3, 0x0000, 0x0000 },
+        { 0x118C4, 0x0000, 0x0000 },
+        { 0x118C5, 0x0000, 0x0000 },
+        { 0x118C6, 0x0000, 0x0000 },
+        { 0x118C7, 0x0000, 0x0000 },
+        { 0x118C8, 0x0000, 0x0000 },
+        { 0x118C9, 0x0000, 0x0000 },
+        { 0x118CA, 0x0000, 0x0000 },
+        { 0x118CB, 0x0000, 0x0000 },
+        { 0x118CC, 0x0000, 0x0000 },
+        { 0x118CD, 0x0000, 0x0000 },
+        { 0x118CE, 0x0000, 0x0000 },
+        { 0x118CF, 0x0000, 0x0000 },
+        { 0x118D0, 0x0000, 0x0000 },
+        { 0x118D1, 0x0000, 0x0000 },
+        { 0x118D2, 0x0000, 0x0000 },
+        { 0x118D3, 0x0000, 0x0000 },
+        { 0x118D4, 0x0000, 0x0000 },
+        { 0x118D5, 0x0000, 0x0000 },
+        { 0x118D6, 0x0000, 0x0000 },
+        { 0x118D7, 0x0000, 0x0000 },
+        { 0x118D8, 0x0000, 0x0000 },
+        { 0x118D9, 0x0000, 0x0000 },
+        { 0x118DA, 0x0000, 0x0000 },
+        { 0x118DB, 0x0000, 0x0000 },
+        { 0x118DC, 0x0000, 0x0000 },
+        { 0x118DD, 0x0000, 0x0000 },
+        { 0x118DE, 0x0000, 0x0000 },
+        { 0x118DF, 0x0000, 0x0000 },
+        { 0x16E60, 0x0000, 0x0000 },
+        { 0x16E61, 0x0000, 0x0000 },
+        { 0x16E62, 0x0000, 0x0000 },
+        { 0x16E63, 0x0000, 0x0000 },
+        { 0x16E64, 0x0000, 0x0000 },
+        { 0x16E65, 0x0000, 0x0000 },
+        { 0x16E66, 0x0000, 0x0000 },
+        { 0x16E67, 0x0000, 0x0000 },
+        { 0x16E68, 0x0000, 0x0000 },
+        { 0x16E69, 0x0000, 0x0000 },
+        { 0x16E6A, 0x0000, 0x0000 },
+        { 0x16E6B, 0x0000, 0x0000 },
+        { 0x16E6C, 0x0000, 0x0000 },
+        { 0x16E6D, 0x0000, 0x0000 },
+        { 0x16E6E, 0x0000, 0x0000 },
+        { 0x16E6F, 0x0000, 0x0000 },
+        { 0x16E70, 0x0000, 0x0000 },
+        { 0x16E71, 0x0000, 0x0000 },
+        { 0x16E72, 0x0000, 0x0000 },
+        { 0x16E73, 0x0000, 0x0000 },
+        { 0x16E74, 0x0000, 0x0000 },
+        { 0x16E75, 0x0000, 0x0000 },
+        { 0x16E76, 0x0000, 0x0000 },
+        { 0x16E77, 0x0000, 0x0000 },
+        { 0x16E78, 0x0000, 0x0000 },
+        { 0x16E79, 0x0000, 0x0000 },
+        { 0x16E7A, 0x0000, 0x0000 },
+        { 0x16E7B, 0x0000, 0x0000 },
+        { 0x16E7C, 0x0000, 0x0000 },
+        { 0x16E7D, 0x0000, 0x0000 },
+        { 0x16E7E, 0x0000, 0x0000 },
+        { 0x16E7F, 0x0000, 0x0000 },
+        { 0x1E922, 0x0000, 0x0000 },
+        { 0x1E923, 0x0000, 0x0000 },
+        { 0x1E924, 0x0000, 0x0000 },
+        { 0x1E925, 0x0000, 0x0000 },
+        { 0x1E926, 0x0000, 0x0000 },
+        { 0x1E927, 0x0000, 0x0000 },
+        { 0x1E928, 0x0000, 0x0000 },
+        { 0x1E929, 0x0000, 0x0000 },
+        { 0x1E92A, 0x0000, 0x0000 },
+        { 0x1E92B, 0x0000, 0x0000 },
+        { 0x1E92C, 0x0000, 0x0000 },
+        { 0x1E92D, 0x0000, 0x0000 },
+        { 0x1E92E, 0x0000, 0x0000 },
+        { 0x1E92F, 0x0000, 0x0000 },
+        { 0x1E930, 0x0000, 0x0000 },
+        { 0x1E931, 0x0000, 0x0000 },
+        { 0x1E932, 0x0000, 0x0000 },
+        { 0x1E933, 0x0000, 0x0000 },
+        { 0x1E934, 0x0000, 0x0000 },
+        { 0x1E935, 0x0000, 0x0000 },
+        { 0x1E936, 0x0000, 0x0000 },
+        { 0x1E937, 0x0000, 0x0000 },
+        { 0x1E938, 0x0000, 0x0000 },
+        { 0x1E939, 0x0000, 0x0000 },
+        { 0x1E93A, 0x0000, 0x0000 },
+        { 0x1E93B, 0x0000, 0x0000 },
+        { 0x1E93C, 0x0000, 0x0000 },
+        { 0x1E93D, 0x0000, 0x0000 },
+        { 0x1E93E, 0x0000, 0x0000 },
+        { 0x1E93F, 0x0000, 0x0000 },
+        { 0x1E940, 0x0000, 0x0000 },
+        { 0x1E941, 0x0000, 0x0000 },
+        { 0x1E942, 0x0000, 0x0000 },
+        { 0x1E943, 0x0000, 0x0000 },
+    };
+}  // namespace cppm::utf8::impl::case_folding_tables
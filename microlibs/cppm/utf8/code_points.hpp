@@ -0,0 +1,249 @@
+#pragma once
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // ptrdiff_t
+
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::bidirectional_iterator_tag,    // <iterator>
+            std::string,                        // <string>
+            std::string_view;                   // <string_view>
+
+    inline namespace code_point_iteration {
+        constexpr auto is_continuation_byte( const Byte b ) noexcept -> bool { return (b & 0xC0) == 0x80; }
+
+        // Branch free: a lookup in a 64-bit constant with 4 bits per value of the high nibble.
+        // A continuation byte is regarded as a 1 byte sequence.
+        constexpr auto sequence_length_for_lead( const Byte b ) noexcept
+            -> int
+        { return int( (0x4322'1111'1111'1111uLL >> (4*(b >> 4))) & 0xF ); }
+
+        // Iterates over the sequences of valid UTF-8 in both directions. Decoding is done in each
+        // step, with a branch per sequence length: those branches are well predicted for text in
+        // one script, and they keep the load of a lead byte off the critical path of the loop.
+        // With invalid UTF-8 the iteration stays within the view, but the values are unspecified.
+        class Code_point_iterator
+        {
+            const char*     m_begin;
+            const char*     m_position;
+            const char*     m_end;
+            char32_t        m_code;
+            int             m_length;
+
+            constexpr auto part( const int i, const int shift ) const noexcept
+                -> char32_t
+            { return char32_t( Byte( m_position[i] ) & 0x3F ) << shift; }
+
+            constexpr void decode() noexcept
+            {
+                const ptrdiff_t n_available = m_end - m_position;
+                if( n_available == 0 ) {
+                    m_code = 0;  m_length = 0;
+                    return;
+                }
+                const Byte lead = *m_position;
+                if( lead < 0x80 ) {
+                    m_code = lead;  m_length = 1;
+                } else if( lead < 0xC0 ) {
+                    m_code = lead;  m_length = 1;       // Invalid: a continuation byte.
+                } else if( lead < 0xE0 and n_available >= 2 ) {
+                    m_code = (char32_t( lead & 0x1F ) << 6) | part( 1, 0 );
+                    m_length = 2;
+                } else if( lead < 0xF0 and n_available >= 3 ) {
+                    m_code = (char32_t( lead & 0x0F ) << 12) | part( 1, 6 ) | part( 2, 0 );
+                    m_length = 3;
+                } else if( n_available >= 4 ) {
+                    m_code = (char32_t( lead & 0x07 ) << 18) | part( 1, 12 ) | part( 2, 6 ) | part( 3, 0 );
+                    m_length = 4;
+                } else {
+                    m_code = lead;  m_length = 1;       // Invalid: truncated sequence.
+                }
+            }
+
+        public:
+            using iterator_category     = bidirectional_iterator_tag;
+            using value_type            = char32_t;
+            using difference_type       = ptrdiff_t;
+            using pointer               = void;
+            using reference             = char32_t;
+
+            constexpr Code_point_iterator() noexcept:
+                m_begin(), m_position(), m_end(), m_code(), m_length()
+            {}
+
+            constexpr Code_point_iterator( in_<string_view> s, const char* const position ) noexcept:
+                m_begin( s.data() ), m_position( position ), m_end( s.data() + s.size() ), m_code(), m_length()
+            { decode(); }
+
+            constexpr auto position() const noexcept -> const char* { return m_position; }
+            constexpr auto sequence() const noexcept -> string_view { return {m_position, size_t( m_length )}; }
+            constexpr auto operator*() const noexcept -> char32_t { return m_code; }
+
+            constexpr auto operator++() noexcept
+                -> Code_point_iterator&
+            {
+                m_position += m_length;
+                decode();
+                return *this;
+            }
+
+            constexpr auto operator--() noexcept
+                -> Code_point_iterator&
+            {
+                --m_position;
+                for( int i = 0; i < 3 and m_position > m_begin and is_continuation_byte( *m_position ); ++i ) {
+                    --m_position;
+                }
+                decode();
+                return *this;
+            }
+
+            constexpr auto operator++( int ) noexcept -> Code_point_iterator { auto result = *this; ++*this; return result; }
+            constexpr auto operator--( int ) noexcept -> Code_point_iterator { auto result = *this; --*this; return result; }
+
+            friend constexpr auto operator==( in_<Code_point_iterator> a, in_<Code_point_iterator> b ) noexcept
+                -> bool
+            { return a.m_position == b.m_position; }
+
+            friend constexpr auto operator!=( in_<Code_point_iterator> a, in_<Code_point_iterator> b ) noexcept
+                -> bool
+            { return a.m_position != b.m_position; }
+        };
+
+        // A view, it doesn't own the text.
+        class Code_points
+        {
+            string_view     m_text;
+
+        public:
+            using iterator          = Code_point_iterator;
+            using reverse_iterator  = std::reverse_iterator<Code_point_iterator>;
+
+            constexpr Code_points( in_<string_view> s ) noexcept: m_text( s ) {}
+
+            constexpr auto text() const noexcept -> string_view { return m_text; }
+            constexpr auto is_empty() const noexcept -> bool { return m_text.empty(); }
+
+            constexpr auto begin() const noexcept -> iterator { return {m_text, m_text.data()}; }
+            constexpr auto end() const noexcept -> iterator { return {m_text, m_text.data() + m_text.size()}; }
+            constexpr auto rbegin() const noexcept -> reverse_iterator { return reverse_iterator( end() ); }
+            constexpr auto rend() const noexcept -> reverse_iterator { return reverse_iterator( begin() ); }
+        };
+
+        constexpr auto code_points( in_<string_view> s ) noexcept -> Code_points { return Code_points( s ); }
+    }  // inline namespace code_point_iteration
+}  // namespace cppm::utf8
+
+namespace cppm::utf8::impl {
+    // Length of the valid sequence at `p`, with its value in `code`, or 0 if it's invalid. This is
+    // the one scalar UTF-8 decoder of the library, used also by validation and transcoding.
+    inline auto valid_sequence_at( const Byte* const p, const Byte* const end, char32_t& code ) noexcept
+        -> int
+    {
+        const Byte lead = *p;
+        if( lead < 0x80 ) { code = lead;  return 1; }
+
+        // Byte ranges per Unicode 15 table 3-7, “Well-Formed UTF-8 Byte Sequences”.
+        int length;  Byte min_second = 0x80;  Byte max_second = 0xBF;
+        if( lead < 0xC2 ) {         return 0;
+        } else if( lead < 0xE0 ) {  length = 2;  code = lead & 0x1F;
+        } else if( lead < 0xF0 ) {  length = 3;  code = lead & 0x0F;
+            if( lead == 0xE0 ) { min_second = 0xA0; } else if( lead == 0xED ) { max_second = 0x9F; }
+        } else if( lead < 0xF5 ) {  length = 4;  code = lead & 0x07;
+            if( lead == 0xF0 ) { min_second = 0x90; } else if( lead == 0xF4 ) { max_second = 0x8F; }
+        } else {                    return 0;
+        }
+
+        if( end - p < length ) { return 0; }
+        if( p[1] < min_second or p[1] > max_second ) { return 0; }
+        code = (code << 6) | (p[1] & 0x3F);
+        for( int i = 2; i < length; ++i ) {
+            if( not is_continuation_byte( p[i] ) ) { return 0; }
+            code = (code << 6) | (p[i] & 0x3F);
+        }
+        return length;
+    }
+
+    // True if the `n` bytes at `p` are the start of a valid sequence but not all of it. It's
+    // checked by completing the sequence with the lowest continuation bytes that the lead allows.
+    inline auto is_incomplete_sequence( const Byte* const p, const int n ) noexcept
+        -> bool
+    {
+        const int length = sequence_length_for_lead( p[0] );
+        if( n >= length ) { return false; }
+
+        Byte bytes[4];
+        for( int i = 0; i < n; ++i ) { bytes[i] = p[i]; }
+        for( int i = n; i < length; ++i ) {
+            bytes[i] = Byte( 0?0
+                : i > 1?            0x80
+                : p[0] == 0xE0?     0xA0
+                : p[0] == 0xF0?     0x90
+                :                   0x80
+                );
+        }
+        char32_t code;
+        return valid_sequence_at( bytes, bytes + length, code ) == length;
+    }
+
+    // Number of bytes at the end of [`begin`, `end`) that are an incomplete sequence, or 0.
+    inline auto incomplete_tail_length( const Byte* const begin, const Byte* const end ) noexcept
+        -> int
+    {
+        for( int n = 1; n <= 3 and n <= end - begin; ++n ) {
+            if( not is_continuation_byte( end[-n] ) ) {
+                return (is_incomplete_sequence( end - n, n )? n : 0);
+            }
+        }
+        return 0;
+    }
+
+    // A split point at `n` or at most 3 bytes before it that doesn't split a sequence, for
+    // processing `s` in pieces. A longer run of continuation bytes is invalid anyway, and is then
+    // split, so that the piece is never empty and the processing reports the invalid bytes.
+    inline auto piece_end( in_<string_view> s, size_t n ) noexcept
+        -> size_t
+    {
+        if( n < s.size() ) {
+            for( int i = 0; i < 3 and n > 0 and is_continuation_byte( s[n] ); ++i ) { --n; }
+        }
+        return n;
+    }
+
+    // Stores the UTF-8 encoding of `code`, which must be at most 0x10FFFF, and returns its length.
+    // This is the one scalar UTF-8 encoder of the library.
+    constexpr auto encode_utf8( const char32_t code, Byte* const bytes ) noexcept
+        -> int
+    {
+        if( code < 0x80 ) {
+            bytes[0] = Byte( code );
+            return 1;
+        } else if( code < 0x800 ) {
+            bytes[0] = Byte( 0xC0 | (code >> 6) );
+            bytes[1] = Byte( 0x80 | (code & 0x3F) );
+            return 2;
+        } else if( code < 0x10000 ) {
+            bytes[0] = Byte( 0xE0 | (code >> 12) );
+            bytes[1] = Byte( 0x80 | ((code >> 6) & 0x3F) );
+            bytes[2] = Byte( 0x80 | (code & 0x3F) );
+            return 3;
+        } else {
+            bytes[0] = Byte( 0xF0 | (code >> 18) );
+            bytes[1] = Byte( 0x80 | ((code >> 12) & 0x3F) );
+            bytes[2] = Byte( 0x80 | ((code >> 6) & 0x3F) );
+            bytes[3] = Byte( 0x80 | (code & 0x3F) );
+            return 4;
+        }
+    }
+
+    inline void append_utf8_encoding_of( const char32_t code, string& s )
+    {
+        Byte bytes[4];
+        const int length = encode_utf8( code, bytes );
+        s.append( reinterpret_cast<const char*>( bytes ), size_t( length ) );
+    }
+}  // namespace cppm::utf8::impl
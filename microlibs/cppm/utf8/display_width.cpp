@@ -0,0 +1,68 @@
+// Implementation include.
+#include <cppm/utf8/display_width.hpp>
+#include <cppm/utf8/code_points.hpp>
+#include <cppm/basics/Byte.hpp>
+
+#include <stdint.h>         // uint64_t
+#include <string.h>         // memcpy
+
+namespace cppm::utf8::impl {
+    constexpr char32_t zero_width_joiner = 0x200D;
+
+    // The skin tone modifiers U+1F3FB through U+1F3FF, drawn as part of the preceding emoji.
+    constexpr auto is_emoji_modifier( const char32_t code ) noexcept
+        -> bool
+    { return 0x1F3FB <= code and code <= 0x1F3FF; }
+
+    // True if all 8 bytes are in the range 0x20 through 0x7E. With no high bits set in `word`
+    // adding 1 sets a high bit only for 0x7F, and subtracting 0x20 does so for a byte below.
+    constexpr auto is_printable_ascii( const uint64_t word ) noexcept
+        -> bool
+    {
+        constexpr uint64_t ones         = 0x0101'0101'0101'0101;
+        constexpr uint64_t high_bits    = 0x8080'8080'8080'8080;
+        return ((word | (word + ones) | (word - 0x20*ones)) & high_bits) == 0;
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    auto width_measuring::display_width( in_<string_view> s ) noexcept
+        -> int
+    {
+        const char* p = s.data();
+        const char* const end = p + s.size();
+        int width = 0;
+        while( p < end ) {
+            if( end - p >= 8 ) {
+                uint64_t word;  memcpy( &word, p, 8 );
+                if( impl::is_printable_ascii( word ) ) { width += 8;  p += 8;  continue; }
+            }
+            const Byte b = *p;
+            if( b < 0x80 ) {
+                width += (0x20 <= b and b < 0x7F);
+                ++p;
+                continue;
+            }
+            // A code point after a zero width joiner is drawn joined with the preceding ones, as
+            // in the emoji sequence "👨‍👩‍👧", and so is a skin tone modifier, so they only add any
+            // width beyond the glyph's so far.
+            const auto run = code_points( string_view( p, size_t( end - p ) ) );
+            auto it = run.begin();
+            int glyph_width = 0;
+            bool is_joined = false;
+            do {
+                const char32_t code = *it;
+                const int w = code_point_width( code );
+                if( is_joined or impl::is_emoji_modifier( code ) ) {
+                    if( w > glyph_width ) { width += w - glyph_width;  glyph_width = w; }
+                } else if( w > 0 ) {
+                    width += w;  glyph_width = w;
+                }
+                is_joined = (code == impl::zero_width_joiner);
+                ++it;
+            } while( it != run.end() and Byte( *it.position() ) >= 0x80 );
+            p = it.position();
+        }
+        return width;
+    }
+}  // namespace cppm::utf8
@@ -0,0 +1,80 @@
+#pragma once
+#include <cppm/utf8/code_points.hpp>                // sequence_length_for_lead
+#include <cppm/utf8/display_width.tables.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>              // in_
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string_view;           // <string_view>
+
+    inline namespace width_measuring {
+        // Width in terminal columns, 0, 1 or 2; see `tools/generate-display-width-tables.pl`.
+        constexpr auto code_point_width( const char32_t code ) noexcept
+            -> int
+        {
+            namespace t = impl::display_width_tables;
+            if( code >= 0x110000 ) { return 1; }
+            constexpr char32_t offset_mask = (1 << t::block_bits) - 1;
+            const Byte packed = t::blocks[t::block_index[code >> t::block_bits]][(code & offset_mask) >> 2];
+            return (packed >> (2*(code & 3))) & 3;
+        }
+
+        // The sum of the code point widths, except that a zero width joiner sequence such as the
+        // emoji "👨‍👩‍👧", or an emoji with a skin tone modifier, counts as one glyph as wide as its
+        // widest part. Other grapheme clusters are not recognized. Printable ASCII is handled 8
+        // bytes at a time.
+        extern auto display_width( in_<string_view> s ) noexcept -> int;
+
+        // For `fmt` padding by display width, e.g. `fmt::print( "{:>5}", width_padded( s ) )`.
+        // The format spec is `[[fill]align][width]`, where the fill can be any character.
+        struct Width_padded{ string_view text; };
+
+        constexpr auto width_padded( in_<string_view> s ) noexcept -> Width_padded { return {s}; }
+    }  // inline namespace width_measuring
+}  // namespace cppm::utf8
+
+template<>
+struct fmt::formatter<cppm::utf8::Width_padded>
+{
+    std::string_view    m_fill      = " ";
+    char                m_align     = '<';
+    int                 m_width     = 0;
+
+    static constexpr auto is_align( const char ch ) -> bool { return ch == '<' or ch == '>' or ch == '^'; }
+
+    constexpr auto parse( format_parse_context& ctx )
+        -> decltype( ctx.begin() )
+    {
+        auto it = ctx.begin();
+        const auto end = ctx.end();
+        if( it != end and *it != '}' ) {
+            const int n = cppm::utf8::sequence_length_for_lead( *it );
+            if( end - it > n and is_align( it[n] ) ) {
+                m_fill = std::string_view( &*it, n );  m_align = it[n];  it += n + 1;
+            } else if( is_align( *it ) ) {
+                m_align = *it;  ++it;
+            }
+        }
+        while( it != end and '0' <= *it and *it <= '9' ) { m_width = 10*m_width + (*it - '0');  ++it; }
+        if( it != end and *it != '}' ) { ctx.on_error( "invalid format spec for Width_padded" ); }
+        return it;
+    }
+
+    template< class Context >
+    auto format( const cppm::utf8::Width_padded& s, Context& ctx ) const
+        -> decltype( ctx.out() )
+    {
+        const int n_padding = std::max( 0, m_width - cppm::utf8::display_width( s.text ) );
+        const int n_left    = (0?0 : m_align == '>'? n_padding : m_align == '^'? n_padding/2 : 0);
+        auto out = ctx.out();
+        for( int i = 0; i < n_left; ++i ) { out = std::copy( m_fill.begin(), m_fill.end(), out ); }
+        out = std::copy( s.text.begin(), s.text.end(), out );
+        for( int i = n_left; i < n_padding; ++i ) { out = std::copy( m_fill.begin(), m_fill.end(), out ); }
+        return out;
+    }
+};
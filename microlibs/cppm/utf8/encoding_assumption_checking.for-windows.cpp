@@ -1,8 +1,14 @@
 #pragma once
 #include <cppm/utf8/encoding_assumption_checking.hpp>
 
+#include <cppm/basics/environment/startup_trace.hpp>
+
 #include <winapi/utf8-checking.hpp>
 
 auto cppm::utf8::encoding_assumption_checking::os_api_is_utf8()
     -> bool
-{ return winapi::is_utf8_codepage(); }
+{
+    // Cached, since the process' ANSI codepage is fixed at startup.
+    static const bool the_value = impl::traced_probe( "os_api_is_utf8", winapi::is_utf8_codepage );
+    return the_value;
+}
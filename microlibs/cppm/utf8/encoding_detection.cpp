@@ -0,0 +1,272 @@
+// Implementation include.
+// Detection is a zero byte count per offset parity, which decides UTF-16 and binary data, and
+// then only for data without zero bytes a UTF-8 validation. Text files rarely contain zero bytes,
+// so the SIMD count is a cheap first pass that for UTF-16 saves the validation.
+#include <cppm/utf8/encoding_detection.hpp>
+#include <cppm/utf8/code_points.hpp>            // is_continuation_byte, incomplete_tail_length
+#include <cppm/utf8/validation.hpp>             // validate_using, ascii_prefix_length
+#include <cppm/basics/Byte.hpp>
+
+#include <algorithm>
+
+namespace cppm::utf8::impl {
+    using   std::max, std::min;     // <algorithm>
+
+    struct Zero_counts
+    {
+        size_t      at_even;
+        size_t      at_odd;
+    };
+
+    // Adds the number of zero bytes at even and at odd offsets from `begin`.
+    inline void scalar_count_zeros( const Byte* const begin, const Byte* const end, Zero_counts& counts ) noexcept
+    {
+        for( const Byte* p = begin; p < end; ++p ) {
+            if( *p == 0 ) { ++((p - begin) % 2 == 0? counts.at_even : counts.at_odd); }
+        }
+    }
+}  // namespace cppm::utf8::impl
+
+#if CPPM_CPU_IS_X86
+namespace cppm::utf8::impl::encoding_detection_kernels {
+    // Per vector a compare with zero is subtracted from byte counters, which are summed per
+    // parity before they can overflow, i.e. after at most 255 vectors.
+    namespace sse4_2 {
+        using V = __m128i;
+
+        CPPM_TARGET_SSE4_2
+        void count_zeros( const Byte* const begin, const Byte* const end, Zero_counts& counts ) noexcept
+        {
+            const V zero = _mm_setzero_si128();
+            const V even_bytes = _mm_set1_epi16( 0x00FF );
+            const Byte* p = begin;
+            while( end - p >= 16 ) {
+                const size_t n_vectors = min<size_t>( size_t( end - p )/16, 255 );
+                V n_zeros = zero;
+                for( size_t i = 0; i < n_vectors; ++i, p += 16 ) {
+                    const V bytes = _mm_loadu_si128( reinterpret_cast<const V*>( p ) );
+                    n_zeros = _mm_sub_epi8( n_zeros, _mm_cmpeq_epi8( bytes, zero ) );
+                }
+                const V at_even = _mm_sad_epu8( _mm_and_si128( n_zeros, even_bytes ), zero );
+                const V at_odd  = _mm_sad_epu8( _mm_srli_epi16( n_zeros, 8 ), zero );
+                counts.at_even  += size_t( _mm_cvtsi128_si32( at_even ) + _mm_extract_epi32( at_even, 2 ) );
+                counts.at_odd   += size_t( _mm_cvtsi128_si32( at_odd ) + _mm_extract_epi32( at_odd, 2 ) );
+            }
+            scalar_count_zeros( p, end, counts );      // `p - begin` is even.
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        using V = __m256i;
+
+        // The sum of the 4 64-bit lanes of a `_mm256_sad_epu8` result, each less than 2^32.
+        CPPM_TARGET_AVX2
+        inline auto sum_of_sad_lanes( const V v ) noexcept
+            -> size_t
+        {
+            const __m128i halves = _mm_add_epi32( _mm256_castsi256_si128( v ), _mm256_extracti128_si256( v, 1 ) );
+            return size_t( _mm_cvtsi128_si32( halves ) + _mm_extract_epi32( halves, 2 ) );
+        }
+
+        CPPM_TARGET_AVX2
+        void count_zeros( const Byte* const begin, const Byte* const end, Zero_counts& counts ) noexcept
+        {
+            const V zero = _mm256_setzero_si256();
+            const V even_bytes = _mm256_set1_epi16( 0x00FF );
+            const Byte* p = begin;
+            while( end - p >= 32 ) {
+                const size_t n_vectors = min<size_t>( size_t( end - p )/32, 255 );
+                V n_zeros = zero;
+                for( size_t i = 0; i < n_vectors; ++i, p += 32 ) {
+                    const V bytes = _mm256_loadu_si256( reinterpret_cast<const V*>( p ) );
+                    n_zeros = _mm256_sub_epi8( n_zeros, _mm256_cmpeq_epi8( bytes, zero ) );
+                }
+                const V at_even = _mm256_sad_epu8( _mm256_and_si256( n_zeros, even_bytes ), zero );
+                const V at_odd  = _mm256_sad_epu8( _mm256_srli_epi16( n_zeros, 8 ), zero );
+                counts.at_even  += sum_of_sad_lanes( at_even );
+                counts.at_odd   += sum_of_sad_lanes( at_odd );
+            }
+            sse4_2::count_zeros( p, end, counts );
+        }
+    }  // namespace avx2
+}  // namespace cppm::utf8::impl::encoding_detection_kernels
+#endif
+
+namespace cppm::utf8::impl {
+    using Zero_counter = void( const Byte*, const Byte*, Zero_counts& ) noexcept;
+
+    inline auto zero_counter_for( const Simd_level::Enum level ) noexcept
+        -> Zero_counter*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = encoding_detection_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    [[fallthrough]];
+                case Simd_level::avx2:      return k::avx2::count_zeros;
+                case Simd_level::sse4_2:    return k::sse4_2::count_zeros;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return scalar_count_zeros;
+    }
+
+    inline auto starts_with( in_<Span<const Byte>> data, in_<string_view> bytes ) noexcept
+        -> bool
+    {
+        if( data.size() < bytes.size() ) { return false; }
+        for( size_t i = 0; i < bytes.size(); ++i ) {
+            if( data[i] != Byte( bytes[i] ) ) { return false; }
+        }
+        return true;
+    }
+
+    // `encoding` is `Text_encoding::_` if there's no BOM. UTF-32LE is checked before UTF-16LE,
+    // whose BOM it starts with.
+    inline auto bom_detection( in_<Span<const Byte>> data ) noexcept
+        -> Encoding_detection
+    {
+        using namespace std::string_view_literals;
+        using E = Text_encoding;
+        return (0? Encoding_detection()
+            : starts_with( data, "\xFF\xFE\0\0"sv )?    Encoding_detection{E::utf32le, 4, false}
+            : starts_with( data, "\0\0\xFE\xFF"sv )?    Encoding_detection{E::utf32be, 4, false}
+            : starts_with( data, "\xEF\xBB\xBF"sv )?    Encoding_detection{E::utf8, 3, false}
+            : starts_with( data, "\xFF\xFE"sv )?        Encoding_detection{E::utf16le, 2, false}
+            : starts_with( data, "\xFE\xFF"sv )?        Encoding_detection{E::utf16be, 2, false}
+            :                                           Encoding_detection{E::_, 0, false}
+            );
+    }
+
+    // Zero bytes in at least 1/32 of the code units, nearly all in the same byte of the units,
+    // indicate UTF-16. ASCII in UTF-16 has a zero byte in every unit, and e.g. Cyrillic text
+    // has zero bytes in the units of spaces and punctuation.
+    inline auto zero_byte_encoding( in_<Zero_counts> zeros, const size_t n_bytes ) noexcept
+        -> Text_encoding::Enum
+    {
+        using E = Text_encoding;
+        const size_t n_dominant = max( zeros.at_even, zeros.at_odd );
+        const size_t n_other    = min( zeros.at_even, zeros.at_odd );
+        const bool is_utf16 = (8*n_other <= n_dominant and 64*n_dominant >= n_bytes);
+        return (0? E::_
+            : not is_utf16?                     E::binary
+            : zeros.at_odd > zeros.at_even?     E::utf16le
+            :                                   E::utf16be
+            );
+    }
+
+    // A window not at the start can start inside a sequence, and one not at the end can end inside
+    // one, so there leading continuation bytes and an incomplete trailing sequence are not checked.
+    // At the end of the data an incomplete sequence is checked, and is invalid.
+    inline auto utf8_checked_part_of( in_<Span<const Byte>> window, const bool is_at_start, const bool is_at_end ) noexcept
+        -> string_view
+    {
+        const Byte* begin = window.begin();
+        const Byte* const end = (is_at_end
+            ? window.end()
+            : window.end() - incomplete_tail_length( window.begin(), window.end() )
+            );
+        if( not is_at_start ) {
+            for( int i = 0; i < 3 and begin < end and is_continuation_byte( *begin ); ++i ) { ++begin; }
+        }
+        return {reinterpret_cast<const char*>( begin ), size_t( end - begin )};
+    }
+
+    struct Window
+    {
+        Span<const Byte>    bytes;
+        bool                is_at_start;
+        bool                is_at_end;
+    };
+
+    // The windows are given by `window_at( i )` for `i` in [0, `n_windows`), each a `Window`.
+    template< class Window_func >
+    inline auto detected_in_windows(
+        const Simd_level::Enum      level,
+        const size_t                n_windows,
+        const Window_func&          window_at
+        ) noexcept -> Text_encoding::Enum
+    {
+        using E = Text_encoding;
+        Zero_counter& count_zeros = *zero_counter_for( level );
+        Zero_counts zeros = {};
+        size_t n_bytes = 0;
+        for( size_t i = 0; i < n_windows; ++i ) {
+            const auto [window, is_at_start, is_at_end] = window_at( i );
+            count_zeros( window.begin(), window.end(), zeros );
+            n_bytes += window.size();
+        }
+        if( zeros.at_even + zeros.at_odd > 0 ) { return zero_byte_encoding( zeros, n_bytes ); }
+
+        bool is_ascii = true;
+        for( size_t i = 0; i < n_windows; ++i ) {
+            const auto [window, is_at_start, is_at_end] = window_at( i );
+            const string_view part = utf8_checked_part_of( window, is_at_start, is_at_end );
+            if( is_ascii and ascii_prefix_length( part ) == part.size() ) { continue; }
+            is_ascii = false;
+            if( not validate_using( level, part ) ) { return E::legacy; }
+        }
+        return (is_ascii? E::ascii : E::utf8);
+    }
+
+    inline auto detected( const Simd_level::Enum level, in_<Span<const Byte>> data ) noexcept
+        -> Encoding_detection
+    {
+        const Encoding_detection bom = bom_detection( data );
+        if( bom.encoding != Text_encoding::_ ) { return bom; }
+        const auto whole = [&]( size_t ) -> Window { return {data, true, true}; };
+        return {detected_in_windows( level, 1, whole ), 0, false};
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    auto encoding_detection::name_of( const Text_encoding::Enum encoding ) noexcept
+        -> string_view
+    {
+        using E = Text_encoding;
+        switch( encoding ) {
+            case E::ascii:      return "ASCII";
+            case E::utf8:       return "UTF-8";
+            case E::utf16le:    return "UTF-16LE";
+            case E::utf16be:    return "UTF-16BE";
+            case E::utf32le:    return "UTF-32LE";
+            case E::utf32be:    return "UTF-32BE";
+            case E::legacy:     return "legacy";
+            case E::binary:     return "binary";
+            default:            return "";
+        }
+    }
+
+    auto encoding_detection::detect_encoding( in_<Span<const Byte>> data ) noexcept
+        -> Encoding_detection
+    { return impl::detected( Simd_level::_, data ); }
+
+    auto encoding_detection::detect_encoding_using( const Simd_level::Enum level, in_<Span<const Byte>> data ) noexcept
+        -> Encoding_detection
+    { return impl::detected( level, data ); }
+
+    auto encoding_detection::detect_encoding_sampled(
+        in_<Span<const Byte>>   data,
+        const int               n_windows,
+        const size_t            window_size
+        ) noexcept -> Encoding_detection
+    {
+        const size_t n = data.size();
+        if( n_windows < 2 or window_size < 2 or n/size_t( n_windows ) <= window_size ) {
+            return impl::detected( Simd_level::_, data );
+        }
+        const Encoding_detection bom = impl::bom_detection( data );
+        if( bom.encoding != Text_encoding::_ ) { return bom; }
+
+        // The windows are at even offsets so that UTF-16 code units keep their parity. The last
+        // window extends to the end of the data, so that a final incomplete sequence is seen.
+        const size_t stride = (n - window_size)/size_t( n_windows - 1 );
+        const size_t i_last = size_t( n_windows - 1 );
+        const auto window_at = [&]( const size_t i ) -> impl::Window {
+            const size_t offset = (i*stride) & ~size_t( 1 );
+            const size_t size = (i == i_last? n - offset : window_size);
+            return {data.subspan( offset, size ), offset == 0, i == i_last};
+            };
+        return {impl::detected_in_windows( Simd_level::_, size_t( n_windows ), window_at ), 0, true};
+    }
+}  // namespace cppm::utf8
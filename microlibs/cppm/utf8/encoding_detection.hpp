@@ -0,0 +1,51 @@
+#pragma once
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/environment/cpu.hpp>      // Simd_level
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string_view;           // <string_view>
+
+    inline namespace encoding_detection {
+        struct Text_encoding{ enum Enum{
+            ascii, utf8, utf16le, utf16be, utf32le, utf32be, legacy, binary, _
+            }; };
+
+        // E.g. "UTF-16LE". `legacy` is "legacy", some single-byte or multibyte codepage.
+        extern auto name_of( Text_encoding::Enum encoding ) noexcept -> string_view;
+
+        struct Encoding_detection
+        {
+            Text_encoding::Enum     encoding;
+            int                     bom_length;     // Bytes to skip, or 0 if there's no BOM.
+            bool                    is_sampled;     // Classified from windows, not from all the data.
+        };
+
+        // A BOM decides the encoding. Otherwise zero bytes concentrated at odd or even offsets
+        // indicate UTF-16LE or UTF-16BE, other zero bytes indicate binary data, and then the text
+        // is ASCII, UTF-8 or, if it's not valid UTF-8, `legacy`. UTF-16 without zero bytes, e.g.
+        // pure CJK, isn't recognized, and UTF-32 is recognized only by the BOM.
+        //
+        // Uses the best SIMD kernels for the CPU for the zero byte count and the UTF-8 validation.
+        extern auto detect_encoding( in_<Span<const Byte>> data ) noexcept -> Encoding_detection;
+
+        // Mainly for testing and benchmarking. A `level` above `simd_level()` is reduced to that.
+        extern auto detect_encoding_using( Simd_level::Enum level, in_<Span<const Byte>> data ) noexcept
+            -> Encoding_detection;
+
+        // For e.g. a memory mapped multi-GB file: classifies from `n_windows` windows of about
+        // `window_size` bytes spread evenly over the data, including its start and end, so that
+        // only those pages are read. A window is adjusted to start at an even offset, and except
+        // for the last one, which extends to the end of the data, to hold only complete UTF-8
+        // sequences. With data no larger than the windows this is a full scan.
+        extern auto detect_encoding_sampled(
+            in_<Span<const Byte>>   data,
+            int                     n_windows   = 16,
+            size_t                  window_size = 64*1024
+            ) noexcept -> Encoding_detection;
+    }  // inline namespace encoding_detection
+}  // namespace cppm::utf8
@@ -0,0 +1,30 @@
+// Implementation include.
+#include <cppm/utf8/grapheme_segmentation.hpp>
+#include <cppm/utf8/code_points.hpp>
+
+namespace cppm::utf8 {
+    auto impl::grapheme_cluster_end( const char* const p, const char* const end ) noexcept
+        -> const char*
+    {
+        using B = Grapheme_break;
+        const auto range = code_points( string_view( p, size_t( end - p ) ) );
+        auto it = range.begin();
+        const B::Enum first = grapheme_break_property( *it );
+        ++it;
+        if( it == range.end() ) { return end; }
+        const B::Enum second = grapheme_break_property( *it );
+
+        // Most code points are `Other`, and then only the second one's property matters.
+        if( first == B::other and not (second == B::extend or second == B::zwj or second == B::spacing_mark) ) {
+            return it.position();
+        }
+
+        Grapheme_break_state state;
+        state.is_break_before( first );
+        if( state.is_break_before( second ) ) { return it.position(); }
+        for( ++it; it != range.end(); ++it ) {
+            if( state.is_break_before_code_point( *it ) ) { break; }
+        }
+        return it.position();
+    }
+}  // namespace cppm::utf8
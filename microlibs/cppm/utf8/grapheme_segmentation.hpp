@@ -0,0 +1,256 @@
+#pragma once
+#include <cppm/utf8/code_points.hpp>
+#include <cppm/utf8/grapheme_segmentation.tables.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // ptrdiff_t, size_t
+#include <stdint.h>         // uint64_t
+
+#include <iterator>
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::forward_iterator_tag,      // <iterator>
+            std::string_view;               // <string_view>
+
+    namespace impl {
+        // Lead bytes of ASCII and of the 2 and 3 byte sequence ranges, e.g. Latin, Greek, Cyrillic
+        // and the main CJK ideographs, where no code point is Extend, ZWJ, SpacingMark, Prepend,
+        // Regional_Indicator or Hangul. Such a code point neither joins with the previous one nor
+        // keeps the next one, except for CR LF. Bit `b - 0xC0` is set for a lead byte `b`.
+        constexpr uint64_t simple_non_ascii_leads = 0
+            | 0x0000'0FFC       // C2 - CB: U+0080 - U+02FF.
+            | 0x0003'C000       // CE - D1: U+0380 - U+047F.
+            | 0x0038'0000       // D3 - D5: U+04C0 - U+057F.
+            | 0x0400'0000       // DA:      U+0680 - U+06BF.
+            | 0x03F0'0000'0000  // E4 - E9: U+4000 - U+9FFF.
+            | 0x4000'0000'0000; // EE:      U+E000 - U+EFFF.
+
+        constexpr auto is_simple_lead( const Byte b ) noexcept
+            -> bool
+        { return b < 0x80 or (b >= 0xC0 and ((simple_non_ascii_leads >> (b - 0xC0)) & 1)); }
+
+        // The end of a cluster starting at `p` if it's decided by simple lead bytes, else `nullptr`.
+        constexpr auto simple_cluster_end( const char* const p, const char* const end ) noexcept
+            -> const char*
+        {
+            const Byte b = *p;
+            const char* next = p + 1;
+            if( b >= 0x80 ) {
+                if( not is_simple_lead( b ) ) { return nullptr; }
+                const int n = sequence_length_for_lead( b );
+                if( end - p < n ) { return nullptr; }
+                for( int i = 1; i < n; ++i ) { if( not is_continuation_byte( p[i] ) ) { return nullptr; } }
+                next = p + n;
+            }
+            if( next == end ) { return next; }
+            const Byte next_b = *next;
+            if( next_b < 0x80 ) { return (b == '\r' and next_b == '\n'? next + 1 : next); }
+            return (is_simple_lead( next_b )? next : nullptr);
+        }
+
+        // The general case, using the rules. Requires `p < end`.
+        extern auto grapheme_cluster_end( const char* p, const char* end ) noexcept -> const char*;
+    }  // namespace impl
+
+    inline namespace grapheme_segmentation {
+        // The Grapheme_Cluster_Break property values of UAX #29, plus Extended_Pictographic.
+        struct Grapheme_break{ enum Enum{
+            other, cr, lf, control, extend, zwj, regional_indicator, prepend, spacing_mark,
+            l, v, t, lv, lvt, extended_pictographic, _
+            }; };
+
+        constexpr auto grapheme_break_property( const char32_t code ) noexcept
+            -> Grapheme_break::Enum
+        {
+            namespace t = impl::grapheme_break_tables;
+            if( code >= 0x110000 ) { return Grapheme_break::other; }
+            constexpr char32_t offset_mask = (1 << t::block_bits) - 1;
+            const Byte packed = t::blocks[t::block_index[code >> t::block_bits]][(code & offset_mask) >> 1];
+            return Grapheme_break::Enum( (packed >> (4*(code & 1))) & 0xF );
+        }
+
+        // The state of the extended grapheme cluster rules of UAX #29 (Unicode 14) after the code
+        // points so far. It's small and can be copied, e.g. to resume at a chunk boundary.
+        class Grapheme_break_state
+        {
+            using B = Grapheme_break;
+
+            B::Enum     m_previous          = B::_;         // `_` at the start of the text.
+            bool        m_is_in_emoji       = false;        // After Extended_Pictographic Extend*.
+            bool        m_is_after_emoji_zwj = false;       // After Extended_Pictographic Extend* ZWJ.
+            bool        m_is_odd_ri_count   = false;        // After an odd number of regional indicators.
+
+            static constexpr auto bit( const B::Enum e ) noexcept -> unsigned { return 1u << e; }
+
+            // Rules GB6 through GB8: the Hangul syllable sequence properties that join with `previous`.
+            static constexpr auto hangul_joiners_after( const B::Enum previous ) noexcept
+                -> unsigned
+            {
+                return (0?0
+                    : previous == B::l?                         bit( B::l ) | bit( B::v ) | bit( B::lv ) | bit( B::lvt )
+                    : previous == B::lv or previous == B::v?    bit( B::v ) | bit( B::t )
+                    : previous == B::lvt or previous == B::t?   bit( B::t )
+                    :                                           0u
+                    );
+            }
+
+            constexpr auto is_break_between( const B::Enum previous, const B::Enum p ) const noexcept
+                -> bool
+            {
+                constexpr unsigned controls = bit( B::cr ) | bit( B::lf ) | bit( B::control );
+
+                if( previous == B::_ ) { return true; }                                 // GB1
+                if( previous == B::cr and p == B::lf ) { return false; }                // GB3
+                if( (bit( previous ) | bit( p )) & controls ) { return true; }          // GB4, GB5
+                if( hangul_joiners_after( previous ) & bit( p ) ) { return false; }     // GB6 - GB8
+                if( bit( p ) & (bit( B::extend ) | bit( B::zwj ) | bit( B::spacing_mark )) ) {
+                    return false;                                                       // GB9, GB9a
+                }
+                if( previous == B::prepend ) { return false; }                          // GB9b
+                if( p == B::extended_pictographic and m_is_after_emoji_zwj ) { return false; }    // GB11
+                if( p == B::regional_indicator and m_is_odd_ri_count ) { return false; }          // GB12, GB13
+                return true;                                                            // GB999
+            }
+
+        public:
+            // Returns whether there's a boundary before a code point with property `p`, and
+            // includes that code point in the state.
+            constexpr auto is_break_before( const B::Enum p ) noexcept
+                -> bool
+            {
+                const bool result = is_break_between( m_previous, p );
+                m_is_after_emoji_zwj    = (p == B::zwj and m_is_in_emoji);
+                m_is_in_emoji           = (p == B::extended_pictographic or (p == B::extend and m_is_in_emoji));
+                m_is_odd_ri_count       = (p == B::regional_indicator and not m_is_odd_ri_count);
+                m_previous = p;
+                return result;
+            }
+
+            constexpr auto is_break_before_code_point( const char32_t code ) noexcept
+                -> bool
+            { return is_break_before( grapheme_break_property( code ) ); }
+
+            // Fast path that skips the table and most rules: ASCII is never Extend, ZWJ,
+            // SpacingMark, Prepend or Extended_Pictographic.
+            constexpr auto is_break_before_ascii( const Byte b ) noexcept
+                -> bool
+            {
+                const B::Enum p = (0?B::_
+                    : b == '\r'?                    B::cr
+                    : b == '\n'?                    B::lf
+                    : b < 0x20 or b == 0x7F?        B::control
+                    :                               B::other
+                    );
+                const bool result = (0?false
+                    : m_previous == B::_?           true
+                    : m_previous == B::cr?          p != B::lf
+                    : p != B::other?                true
+                    :                               m_previous != B::prepend
+                    );
+                m_is_after_emoji_zwj = false;  m_is_in_emoji = false;  m_is_odd_ri_count = false;
+                m_previous = p;
+                return result;
+            }
+        };
+
+        // For text that arrives in chunks, e.g. from a file or a pipe. A chunk can end within a
+        // cluster, but not within a UTF-8 sequence.
+        class Grapheme_segmenter
+        {
+            Grapheme_break_state    m_state;
+
+        public:
+            // Calls `f( offset )` for each cluster start in `chunk`. Offset 0 is reported for the
+            // first chunk, and for a later chunk if the previous one ended with a complete cluster.
+            template< class Func >
+            void for_each_boundary( in_<string_view> chunk, Func&& f )
+            {
+                const char* const begin = chunk.data();
+                const char* const end = begin + chunk.size();
+                const char* p = begin;
+                while( p < end ) {
+                    const Byte b = *p;
+                    if( b < 0x80 ) {
+                        if( m_state.is_break_before_ascii( b ) ) { f( size_t( p - begin ) ); }
+                        ++p;
+                    } else {
+                        const auto it = Code_point_iterator( string_view( p, size_t( end - p ) ), p );
+                        if( m_state.is_break_before_code_point( *it ) ) { f( size_t( p - begin ) ); }
+                        p += it.sequence().size();
+                    }
+                }
+            }
+
+            auto state() const noexcept -> const Grapheme_break_state& { return m_state; }
+        };
+
+        // Iterates over the extended grapheme clusters, with a fast path for ASCII and Latin text.
+        // With invalid UTF-8 the iteration stays within the view.
+        class Grapheme_iterator
+        {
+            const char*     m_position;
+            const char*     m_cluster_end;
+            const char*     m_end;
+
+            void find_cluster_end() noexcept
+            {
+                if( m_position == m_end ) { m_cluster_end = m_end;  return; }
+                m_cluster_end = impl::simple_cluster_end( m_position, m_end );
+                if( not m_cluster_end ) { m_cluster_end = impl::grapheme_cluster_end( m_position, m_end ); }
+            }
+
+        public:
+            using iterator_category     = forward_iterator_tag;
+            using value_type            = string_view;
+            using difference_type       = ptrdiff_t;
+            using pointer               = void;
+            using reference             = string_view;
+
+            Grapheme_iterator() noexcept: m_position(), m_cluster_end(), m_end() {}
+
+            Grapheme_iterator( in_<string_view> s, const char* const position ) noexcept:
+                m_position( position ), m_cluster_end(), m_end( s.data() + s.size() )
+            { find_cluster_end(); }
+
+            auto position() const noexcept -> const char* { return m_position; }
+            auto operator*() const noexcept -> string_view { return {m_position, size_t( m_cluster_end - m_position )}; }
+
+            auto operator++() noexcept
+                -> Grapheme_iterator&
+            {
+                m_position = m_cluster_end;
+                find_cluster_end();
+                return *this;
+            }
+
+            auto operator++( int ) noexcept -> Grapheme_iterator { auto result = *this; ++*this; return result; }
+
+            friend auto operator==( in_<Grapheme_iterator> a, in_<Grapheme_iterator> b ) noexcept
+                -> bool
+            { return a.m_position == b.m_position; }
+
+            friend auto operator!=( in_<Grapheme_iterator> a, in_<Grapheme_iterator> b ) noexcept
+                -> bool
+            { return a.m_position != b.m_position; }
+        };
+
+        // A view, it doesn't own the text.
+        class Graphemes
+        {
+            string_view     m_text;
+
+        public:
+            using iterator = Grapheme_iterator;
+
+            Graphemes( in_<string_view> s ) noexcept: m_text( s ) {}
+
+            auto text() const noexcept -> string_view { return m_text; }
+            auto begin() const noexcept -> iterator { return {m_text, m_text.data()}; }
+            auto end() const noexcept -> iterator { return {m_text, m_text.data() + m_text.size()}; }
+        };
+
+        inline auto graphemes( in_<string_view> s ) noexcept -> Graphemes { return Graphemes( s ); }
+    }  // inline namespace grapheme_segmentation
+}  // namespace cppm::utf8
@@ -0,0 +1,436 @@
+// Implementation include.
+// Normalization per UAX #15, “Unicode Normalization Forms”. The quick check is done first. When
+// it fails, only the segment from the last boundary before the failure to the next starter with
+// quick check value Yes is decomposed, reordered and possibly composed, and the quick check then
+// resumes after the segment.
+#include <cppm/utf8/normalization.hpp>
+#include <cppm/utf8/normalization.tables.hpp>
+#include <cppm/utf8/code_points.hpp>            // is_continuation_byte
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/bits.hpp>                 // n_trailing_zeros
+
+#include <stdint.h>         // uint16_t, uint64_t
+#include <string.h>         // memcpy
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace cppm::utf8::impl {
+    using   std::max, std::min, std::lower_bound,   // <algorithm>
+            std::vector;                            // <vector>
+
+    constexpr auto normalization_properties_of( const char32_t code ) noexcept
+        -> uint16_t
+    {
+        namespace t = normalization_tables;
+        if( code >= 0x110000 ) { return 0; }
+        constexpr char32_t offset_mask = (1 << t::block_bits) - 1;
+        return t::property_blocks[t::property_block_index[code >> t::block_bits]][code & offset_mask];
+    }
+
+    constexpr auto combining_class_of( const char32_t code ) noexcept
+        -> int
+    { return normalization_properties_of( code ) & 0xFF; }
+
+    // True for many common BMP code points, with a lookup that's cheaper than of the properties.
+    constexpr auto is_in_yes_block( const char32_t code, const Normalization_form::Enum form ) noexcept
+        -> bool
+    { return code < 0x10000 and ((normalization_tables::yes_blocks[form][code >> 12] >> ((code >> 6) & 63)) & 1); }
+
+    constexpr auto quick_check_value_in( const uint16_t properties, const Normalization_form::Enum form ) noexcept
+        -> Quick_check_result::Enum
+    { return Quick_check_result::Enum( (properties >> (8 + 2*form)) & 3 ); }
+
+    // The lead byte of the first code point that isn't normalized by itself. All below it are
+    // starters with quick check value Yes, so there's a normalization boundary before each.
+    constexpr auto quick_check_lead_byte_limit( const Normalization_form::Enum form ) noexcept
+        -> Byte
+    {
+        const char32_t code = normalization_tables::quick_check_limits[form];
+        return Byte( 0?0
+            : code < 0x800?     0xC0 | (code >> 6)
+            : code < 0x10000?   0xE0 | (code >> 12)
+            :                   0xF0 | (code >> 18)
+            );
+    }
+
+    constexpr auto is_hangul_syllable( const char32_t code ) noexcept
+        -> bool
+    { return 0xAC00 <= code and code <= 0xD7A3; }
+
+    // Start of the last sequence in [`begin`, `p`), which must be non-empty.
+    inline auto start_of_last_sequence( const Byte* const begin, const Byte* const p ) noexcept
+        -> const Byte*
+    {
+        const Byte* s = p - 1;
+        for( int i = 0; i < 3 and s > begin and is_continuation_byte( *s ); ++i ) { --s; }
+        return s;
+    }
+
+    // Returns a pointer to the first byte at or above `limit`, which is at least 0x80, or `end`.
+    inline auto scalar_first_at_or_above( const Byte limit, const Byte* p, const Byte* const end ) noexcept
+        -> const Byte*
+    {
+        constexpr uint64_t ones         = 0x0101'0101'0101'0101;
+        constexpr uint64_t high_bits    = 0x8080'8080'8080'8080;
+        const uint64_t addend = (0x100 - limit)*ones;
+        for( ; end - p >= 8; p += 8 ) {
+            uint64_t word;  memcpy( &word, p, 8 );
+            // The sum per byte has the high bit set iff the low 7 bits are at least `limit - 0x80`.
+            if( const uint64_t found = ((word & ~high_bits) + addend) & word & high_bits ) {
+                return p + n_trailing_zeros( found )/8;     // Little-endian assumed.
+            }
+        }
+        while( p < end and *p < limit ) { ++p; }
+        return p;
+    }
+}  // namespace cppm::utf8::impl
+
+#if CPPM_CPU_IS_X86
+namespace cppm::utf8::impl::normalization_kernels {
+    // An unsigned byte is at or above the limit iff the maximum of the two is the byte itself.
+    namespace sse4_2 {
+        using V = __m128i;
+
+        CPPM_TARGET_SSE4_2
+        auto first_at_or_above( const Byte limit, const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            const V limits = _mm_set1_epi8( char( limit ) );
+            for( ; end - p >= 16; p += 16 ) {
+                const V input = _mm_loadu_si128( reinterpret_cast<const V*>( p ) );
+                if( const int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_max_epu8( input, limits ), input ) ) ) {
+                    return p + n_trailing_zeros( mask );
+                }
+            }
+            return scalar_first_at_or_above( limit, p, end );
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        using V = __m256i;
+
+        CPPM_TARGET_AVX2
+        auto first_at_or_above( const Byte limit, const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            const V limits = _mm256_set1_epi8( char( limit ) );
+            for( ; end - p >= 32; p += 32 ) {
+                const V input = _mm256_loadu_si256( reinterpret_cast<const V*>( p ) );
+                const V is_at_or_above = _mm256_cmpeq_epi8( _mm256_max_epu8( input, limits ), input );
+                if( const unsigned mask = _mm256_movemask_epi8( is_at_or_above ) ) {
+                    return p + n_trailing_zeros( mask );
+                }
+            }
+            return sse4_2::first_at_or_above( limit, p, end );
+        }
+    }  // namespace avx2
+}  // namespace cppm::utf8::impl::normalization_kernels
+#endif
+
+namespace cppm::utf8::impl {
+    using Limit_scanner = auto( Byte, const Byte*, const Byte* ) noexcept -> const Byte*;
+
+    inline auto limit_scanner_for( const Simd_level::Enum level ) noexcept
+        -> Limit_scanner*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = normalization_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    [[fallthrough]];
+                case Simd_level::avx2:      return k::avx2::first_at_or_above;
+                case Simd_level::sse4_2:    return k::sse4_2::first_at_or_above;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return scalar_first_at_or_above;
+    }
+
+    inline auto the_limit_scanner() noexcept
+        -> Limit_scanner&
+    {
+        static Limit_scanner* const the_scanner = limit_scanner_for( Simd_level::_ );
+        return *the_scanner;
+    }
+
+    struct Quick_check_outcome
+    {
+        Quick_check_result::Enum    result;
+        const Byte*                 boundary;   // Before the first code point that failed the check.
+    };
+
+    inline auto quick_check_with(
+        Limit_scanner&                  scan,
+        const Byte* const               begin,
+        const Byte* const               end,
+        const Normalization_form::Enum  form,
+        const bool                      is_stopping_at_maybe = false
+        ) noexcept -> Quick_check_outcome
+    {
+        using R = Quick_check_result;
+        const Byte limit = quick_check_lead_byte_limit( form );
+        R::Enum result = R::yes;
+        const Byte* boundary = begin;
+        int last_class = 0;
+        const Byte* p = begin;
+        while( p < end ) {
+            const Byte b = *p;
+            if( b < limit ) {
+                // A long run is skipped by the SIMD scan, a short one byte by byte, e.g. a space.
+                if( end - p >= 8 and scalar_first_at_or_above( limit, p, p + 8 ) == p + 8 ) {
+                    const Byte* const q = scan( limit, p + 8, end );
+                    if( result == R::yes ) { boundary = start_of_last_sequence( p, q ); }
+                    p = q;
+                } else {
+                    if( result == R::yes and not is_continuation_byte( b ) ) { boundary = p; }
+                    ++p;
+                }
+                last_class = 0;
+                continue;
+            }
+
+            char32_t code;
+            const int length = valid_sequence_at( p, end, code );
+            if( length == 0 ) {         // Invalid, passed through as a starter.
+                if( result == R::yes ) { boundary = p; }
+                last_class = 0;  ++p;
+                continue;
+            }
+            if( is_in_yes_block( code, form ) ) {
+                if( result == R::yes ) { boundary = p; }
+                last_class = 0;  p += length;
+                continue;
+            }
+            const uint16_t properties = normalization_properties_of( code );
+            const int cc = properties & 0xFF;
+            if( cc != 0 and last_class > cc ) { return {R::no, boundary}; }
+            switch( quick_check_value_in( properties, form ) ) {
+                case R::no:     { return {R::no, boundary}; }
+                case R::maybe:  {
+                    if( is_stopping_at_maybe ) { return {R::maybe, boundary}; }
+                    result = R::maybe;  break;
+                }
+                default:        { if( cc == 0 and result == R::yes ) { boundary = p; } }
+            }
+            last_class = cc;
+            p += length;
+        }
+        return {result, boundary};
+    }
+
+    namespace hangul {
+        constexpr char32_t  s_base = 0xAC00;        // Syllables.
+        constexpr char32_t  l_base = 0x1100;        // Leading consonants.
+        constexpr char32_t  v_base = 0x1161;        // Vowels.
+        constexpr char32_t  t_base = 0x11A7;        // Trailing consonants, the base itself is none.
+        constexpr int       n_l = 19;
+        constexpr int       n_v = 21;
+        constexpr int       n_t = 28;
+    }  // namespace hangul
+
+    inline void append_decomposition_of( const char32_t code, const bool is_compatibility, vector<char32_t>& codes )
+    {
+        namespace t = normalization_tables;
+        if( is_hangul_syllable( code ) ) {
+            using namespace hangul;
+            const int s = int( code - s_base );
+            codes.push_back( l_base + s/(n_v*n_t) );
+            codes.push_back( v_base + (s % (n_v*n_t))/n_t );
+            if( s % n_t != 0 ) { codes.push_back( t_base + s % n_t ); }
+            return;
+        }
+
+        constexpr char32_t offset_mask = (1 << t::block_bits) - 1;
+        const int index = t::decomposition_blocks[t::decomposition_block_index[code >> t::block_bits]][code & offset_mask];
+        const t::Decomposition& d = t::decompositions[index];
+        const int n_bytes = (is_compatibility? d.n_compatibility_bytes : d.n_canonical_bytes);
+        if( n_bytes == 0 ) { codes.push_back( code );  return; }
+
+        const Byte* p = t::decomposition_bytes + d.offset + (is_compatibility? d.n_canonical_bytes : 0);
+        const Byte* const end = p + n_bytes;
+        while( p < end ) {
+            char32_t part = 0;
+            p += valid_sequence_at( p, end, part );
+            codes.push_back( part );
+        }
+    }
+
+    // The canonical ordering algorithm: a stable sort of each run of non-starters on their class.
+    inline void sort_canonically( vector<char32_t>& codes )
+    {
+        const int n = int( codes.size() );
+        for( int i = 1; i < n; ++i ) {
+            const char32_t code = codes[i];
+            const int cc = combining_class_of( code );
+            if( cc == 0 ) { continue; }
+            int j = i;
+            for( ; j > 0 and combining_class_of( codes[j - 1] ) > cc; --j ) { codes[j] = codes[j - 1]; }
+            codes[j] = code;
+        }
+    }
+
+    // The primary composite of `a` and `b`, or 0 if there's none.
+    inline auto composite_of( const char32_t a, const char32_t b ) noexcept
+        -> char32_t
+    {
+        namespace t = normalization_tables;
+        {
+            using namespace hangul;
+            if( l_base <= a and a < l_base + n_l and v_base <= b and b < v_base + n_v ) {
+                return s_base + ((a - l_base)*n_v + (b - v_base))*n_t;
+            }
+            if( is_hangul_syllable( a ) and (a - s_base) % n_t == 0 and t_base < b and b < t_base + n_t ) {
+                return a + (b - t_base);
+            }
+        }
+
+        const auto it = lower_bound( std::begin( t::compositions ), std::end( t::compositions ), b,
+            [a]( const t::Composition& c, const char32_t second ) -> bool
+            { return c.first < a or (c.first == a and c.second < second); }
+            );
+        return (it != std::end( t::compositions ) and it->first == a and it->second == b? it->composite : 0);
+    }
+
+    // The canonical composition algorithm, in place.
+    inline void compose( vector<char32_t>& codes )
+    {
+        const size_t n = codes.size();
+        size_t n_out = 0;
+        size_t i_starter = size_t( -1 );
+        int last_class = 0;     // Of the last code point in the output.
+        for( size_t i = 0; i < n; ++i ) {
+            const char32_t code = codes[i];
+            const uint16_t properties = normalization_properties_of( code );
+            const int cc = properties & 0xFF;
+            // Exactly the code points that can be second in a composition have NFC_QC=Maybe.
+            const bool can_be_second = (quick_check_value_in( properties, Normalization_form::nfc ) == Quick_check_result::maybe);
+            if( can_be_second and i_starter != size_t( -1 ) ) {
+                const bool is_adjacent = (i_starter == n_out - 1);
+                if( is_adjacent or (last_class != 0 and last_class < cc) ) {
+                    if( const char32_t composite = composite_of( codes[i_starter], code ) ) {
+                        codes[i_starter] = composite;
+                        continue;
+                    }
+                }
+            }
+            if( cc == 0 ) { i_starter = n_out; }
+            last_class = cc;
+            codes[n_out++] = code;
+        }
+        codes.resize( n_out );
+    }
+
+    inline void append_normalized_codes( vector<char32_t>& codes, const bool is_composing, string& buffer )
+    {
+        sort_canonically( codes );
+        if( is_composing ) { compose( codes ); }
+        for( const char32_t code: codes ) { append_utf8_encoding_of( code, buffer ); }
+        codes.clear();
+    }
+
+    // The end of the segment that starts with the code point at `p`, i.e. the start of the next
+    // starter with quick check value Yes, or of an invalid sequence.
+    inline auto end_of_segment( const Byte* p, const Byte* const end, const Normalization_form::Enum form ) noexcept
+        -> const Byte*
+    {
+        const Byte limit = quick_check_lead_byte_limit( form );
+        char32_t code;
+        p += max( 1, valid_sequence_at( p, end, code ) );
+        while( p < end and *p >= limit ) {
+            const int length = valid_sequence_at( p, end, code );
+            if( length == 0 or is_in_yes_block( code, form ) ) { break; }
+            const uint16_t properties = normalization_properties_of( code );
+            if( (properties & 0xFF) == 0 and quick_check_value_in( properties, form ) == Quick_check_result::yes ) {
+                break;
+            }
+            p += length;
+        }
+        return p;
+    }
+
+    inline void append_normalized(
+        const Byte*                     p,
+        const Byte* const               end,
+        const Normalization_form::Enum  form,
+        vector<char32_t>&               codes,
+        string&                         buffer
+        )
+    {
+        const bool is_compatibility = (form == Normalization_form::nfkd or form == Normalization_form::nfkc);
+        const bool is_composing     = (form == Normalization_form::nfc or form == Normalization_form::nfkc);
+        while( p < end ) {
+            char32_t code;
+            if( const int length = valid_sequence_at( p, end, code ) ) {
+                append_decomposition_of( code, is_compatibility, codes );
+                p += length;
+            } else {
+                append_normalized_codes( codes, is_composing, buffer );
+                buffer += char( *p );
+                ++p;
+            }
+        }
+        append_normalized_codes( codes, is_composing, buffer );
+    }
+
+    inline auto quick_check_using( Limit_scanner& scan, in_<string_view> s, const Normalization_form::Enum form ) noexcept
+        -> Quick_check_result::Enum
+    {
+        const auto begin = reinterpret_cast<const Byte*>( s.data() );
+        return quick_check_with( scan, begin, begin + s.size(), form ).result;
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    using   std::vector;            // <vector>
+
+    auto normalization::quick_check( in_<string_view> s, const Normalization_form::Enum form ) noexcept
+        -> Quick_check_result::Enum
+    { return impl::quick_check_using( impl::the_limit_scanner(), s, form ); }
+
+    auto normalization::quick_check_using(
+        const Simd_level::Enum              level,
+        in_<string_view>                    s,
+        const Normalization_form::Enum      form
+        ) noexcept -> Quick_check_result::Enum
+    { return impl::quick_check_using( *impl::limit_scanner_for( level ), s, form ); }
+
+    auto normalization::normalized( in_<string_view> s, const Normalization_form::Enum form, string& buffer )
+        -> string_view
+    {
+        impl::Limit_scanner& scan = impl::the_limit_scanner();
+        const auto begin    = reinterpret_cast<const Byte*>( s.data() );
+        const auto end      = begin + s.size();
+
+        const bool is_stopping_at_maybe = true;
+        impl::Quick_check_outcome check = impl::quick_check_with( scan, begin, end, form, is_stopping_at_maybe );
+        if( check.result == Quick_check_result::yes ) { return s; }
+
+        // Each segment around a quick check failure is normalized, and the text between is copied.
+        buffer.assign( s.data(), size_t( check.boundary - begin ) );
+        vector<char32_t> codes;
+        for( ;; ) {
+            const Byte* const segment_end = impl::end_of_segment( check.boundary, end, form );
+            impl::append_normalized( check.boundary, segment_end, form, codes, buffer );
+            check = impl::quick_check_with( scan, segment_end, end, form, is_stopping_at_maybe );
+            const Byte* const copy_end = (check.result == Quick_check_result::yes? end : check.boundary);
+            buffer.append( reinterpret_cast<const char*>( segment_end ), size_t( copy_end - segment_end ) );
+            if( copy_end == end ) { break; }
+        }
+        return (buffer == s? s : string_view( buffer ));
+    }
+
+    auto normalization::is_normalized( in_<string_view> s, const Normalization_form::Enum form )
+        -> bool
+    {
+        switch( quick_check( s, form ) ) {
+            case Quick_check_result::yes:   return true;
+            case Quick_check_result::no:    return false;
+            default: {
+                string buffer;
+                return normalized( s, form, buffer ).data() == s.data();
+            }
+        }
+    }
+}  // namespace cppm::utf8
@@ -0,0 +1,50 @@
+#pragma once
+#include <cppm/basics/environment/cpu.hpp>      // Simd_level
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <string>
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string,                // <string>
+            std::string_view;           // <string_view>
+
+    inline namespace normalization {
+        // The Unicode normalization forms of UAX #15, here per Unicode 14.
+        struct Normalization_form{ enum Enum{ nfd, nfc, nfkd, nfkc, _ }; };
+
+        struct Quick_check_result{ enum Enum{ yes, maybe, no }; };
+
+        // The quick check of UAX #15. A SIMD scan skips bytes below the first lead byte of a code
+        // point that can be affected by normalization, e.g. all of ASCII and Latin-1 for NFC.
+        // Invalid UTF-8 sequences are regarded as starters that normalization leaves as is.
+        extern auto quick_check( in_<string_view> s, Normalization_form::Enum form ) noexcept
+            -> Quick_check_result::Enum;
+
+        // Mainly for testing and benchmarking. A `level` above `simd_level()` is reduced to that.
+        extern auto quick_check_using( Simd_level::Enum level, in_<string_view> s, Normalization_form::Enum form ) noexcept
+            -> Quick_check_result::Enum;
+
+        // Returns `s` itself if it's already normalized, which is decided without allocating
+        // when the quick check says yes, else a view of `buffer` with the normalized text.
+        // Only the segments around quick check failures are decomposed and composed.
+        extern auto normalized( in_<string_view> s, Normalization_form::Enum form, string& buffer )
+            -> string_view;
+
+        extern auto is_normalized( in_<string_view> s, Normalization_form::Enum form ) -> bool;
+
+        inline auto to_normalized( in_<string_view> s, const Normalization_form::Enum form )
+            -> string
+        {
+            string buffer;
+            const string_view result = normalized( s, form, buffer );
+            if( result.data() == s.data() ) { return string( s ); }
+            return buffer;
+        }
+
+        inline auto to_nfd( in_<string_view> s ) -> string { return to_normalized( s, Normalization_form::nfd ); }
+        inline auto to_nfc( in_<string_view> s ) -> string { return to_normalized( s, Normalization_form::nfc ); }
+        inline auto to_nfkd( in_<string_view> s ) -> string { return to_normalized( s, Normalization_form::nfkd ); }
+        inline auto to_nfkc( in_<string_view> s ) -> string { return to_normalized( s, Normalization_form::nfkc ); }
+    }  // inline namespace normalization
+}  // namespace cppm::utf8
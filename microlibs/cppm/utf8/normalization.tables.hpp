@@ -0,0 +1,12102 @@
+#pragma once
+// Generated by `tools/generate-normalization-tables.pl` from Unicode 14.0.0 data. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+#include <stdint.h>         // uint16_t, uint64_t
+
+namespace cppm::utf8::impl::normalization_tables {
+    constexpr char  unicode_version[]   = "14.0.0";
+    constexpr int   block_bits          = 7;
+
+    // Per form NFD, NFC, NFKD and NFKC, the first code point that isn't normalized by itself.
+    constexpr char32_t quick_check_limits[4] = { 0x00C0, 0x0300, 0x00A0, 0x00A0 };
+
+    // Per form, bit `code >> 6` is set when the 64 code points from `code & ~63` in the BMP all are
+    // starters with quick check value Yes, e.g. for NFC Cyrillic and the CJK ideographs.
+    inline constexpr uint64_t yes_blocks[4][16] =
+    {
+        {
+            0x0040000044300E07, 0x007600EB6FFFDFFA, 0xFF57F7FFFFFFE026, 0xFFFFFFFFFFFFFFF0,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x00007306F1FFFFFF, 0x0000000000000000,
+            0x0000000000000000, 0xFFFFFFFF80000000, 0xFFFFFFFFFFFFFFFF, 0xFEFFC00FFFFFFFFF,
+        },
+        {
+            0x00400000443B8FFF, 0x1F7600EB6FFFDF1A, 0xFF57F7FFFFFFEFE6, 0xFFFFFFFFFFFFFFFA,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFF7306F1FFFFFF, 0xFFFFFFFFFFFFFFFF,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFEFFC00FFFFFFFFF,
+        },
+        {
+            0x0040000044300203, 0x000600EB6FFFDFF2, 0x0355F4FFFFF1E000, 0xFFFFFFFFFFFF0080,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000530651FFFFFF, 0x0000000000000000,
+            0x0000000000000000, 0xFFFFFFFF80000000, 0xFFFFFFFFFFFFFFFF, 0x0000000FFFFFFFFF,
+        },
+        {
+            0x00400000443B034B, 0x1B0600EB6FFFDF12, 0x0355F4FFFFF1EE80, 0xFFFFFFFFFFFF0082,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFF530651FFFFFF, 0xFFFFFFFFFFFFFFFF,
+            0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0000000FFFFFFFFF,
+        },
+    };
+
+    // Index of the block of property values for each 128 code points.
+    inline constexpr Byte property_block_index[8704] =
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+        0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+        0x1F, 0x20, 0x21, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25,
+        0x00, 0x26, 0x27, 0x00, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x00, 0x3B, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x41, 0x42, 0x00, 0x43, 0x44, 0x45,
+        0x46, 0x47, 0x48, 0x49, 0x4A, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x4C, 0x4D, 0x4E,
+        0x4F, 0x50, 0x51, 0x52, 0x00, 0x53, 0x54, 0x55, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x56,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x57, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x44, 0x44, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61,
+        0x00, 0x00, 0x00, 0x62, 0x00, 0x63, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+        0x00, 0x00, 0x00, 0x00, 0x66, 0x67, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x69, 0x6A, 0x6B,
+        0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x00, 0x73, 0x74, 0x00, 0x75, 0x76, 0x77, 0x78, 0x00,
+        0x79, 0x00, 0x7A, 0x7B, 0x7C, 0x7D, 0x00, 0x00, 0x76, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x84, 0x85, 0x86, 0x00, 0x00, 0x00, 0x87, 0x88, 0x89, 0x44, 0x44, 0x8A, 0x44, 0x8B,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x8C, 0x00, 0x81, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8E, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x91, 0x00, 0x00,
+        0x00, 0x00, 0x92, 0x93, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x57, 0x57, 0x57, 0x57, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    // Canonical combining class in bits 0-7, quick check values 0 = Yes, 1 = Maybe, 2 = No
+    // for NFD, NFC, NFKD and NFKC in bits 8-9, 10-11, 12-13 and 14-15.
+    inline constexpr uint16_t property_blocks[151][128] =
+    {
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000,
+            0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x0000, 0xA000, 0xA000, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xA000,
+            0xA000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xA000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xA000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200,
+            0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0xA000, 0xA000, 0xA000, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x44E6, 0x44E6, 0x44E6, 0x44E6, 0x44E6, 0x00E6, 0x44E6, 0x44E6, 0x44E6, 0x44E6, 0x44E6, 0x44E6, 0x44E6, 0x00E6, 0x00E6, 0x44E6,
+            0x00E6, 0x44E6, 0x00E6, 0x44E6, 0x44E6, 0x00E8, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E8, 0x44D8, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+            0x00DC, 0x00CA, 0x00CA, 0x44DC, 0x44DC, 0x44DC, 0x44DC, 0x44CA, 0x44CA, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x44DC, 0x44DC, 0x00DC,
+            0x44DC, 0x44DC, 0x00DC, 0x00DC, 0x0001, 0x0001, 0x0001, 0x0001, 0x4401, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6,
+            0xAAE6, 0xAAE6, 0x44E6, 0xAAE6, 0xAAE6, 0x44F0, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E8, 0x00DC, 0x00DC, 0x00E6, 0x00E9, 0x00EA, 0x00EA, 0x00E9,
+            0x00EA, 0x00EA, 0x00E9, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA200, 0x2200, 0xAA00, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x2200,
+            0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA200, 0xA200, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x2200, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00DE, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DE, 0x00E4, 0x00E6,
+            0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0000, 0x0017,
+            0x0000, 0x0018, 0x0019, 0x0000, 0x00E6, 0x00DC, 0x0000, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x001E, 0x001F, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+            0x0020, 0x0021, 0x0022, 0x44E6, 0x44E6, 0x44DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0023, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x0000, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00DC, 0x00DC, 0x00E6, 0x00DC, 0x00E6,
+            0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC,
+            0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x0000, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC,
+            0x001B, 0x001C, 0x001D, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4407, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x4400, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0x0000, 0xAA00,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0x0000, 0xAA00, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x4400, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x445B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x0000, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x4400, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4409, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0x4400,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x0067, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006B, 0x006B, 0x006B, 0x006B, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0076, 0x0076, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007A, 0x007A, 0x007A, 0x007A, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x00DC, 0x0000, 0x00D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000,
+            0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0081, 0x0082, 0xAA00, 0x0084, 0xAA00, 0xAA00, 0xA000, 0xAA00, 0xA000, 0x0082, 0x0082, 0x0082, 0x0082, 0x0000, 0x0000,
+        },
+        {
+            0x0082, 0xAA00, 0x00E6, 0x00E6, 0x0009, 0x0000, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000,
+            0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+            0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+            0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+            0x4400, 0x4400, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DE, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x00DC,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x0000, 0x00DC,
+            0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000,
+            0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x0000, 0x2200, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0001, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+            0x00E6, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00E6, 0x00EA, 0x00D6, 0x00DC,
+            0x00CA, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E8, 0x00E4, 0x00E4, 0x00DC, 0x00DA, 0x00E6, 0x00E9, 0x00DC, 0x00E6, 0x00DC,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xA000, 0xA200, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x0000, 0x0000,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xAA00, 0x2200, 0xA000, 0xAA00, 0xA000,
+            0xA000, 0xA200, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xA200, 0xA200, 0xA200,
+            0x2200, 0x2200, 0x2200, 0xAA00, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xAA00, 0x0000, 0xA200, 0xA200, 0xA200,
+            0x2200, 0x2200, 0x2200, 0xAA00, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0xAA00, 0x2200, 0xA200, 0xAA00, 0xAA00,
+            0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x2200, 0xAA00, 0x2200, 0xAA00, 0x2200, 0xAA00, 0xA000, 0x0000,
+        },
+        {
+            0xAA00, 0xAA00, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x0001, 0x0001, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0001, 0x0001, 0x0001, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x00E6, 0x00DC, 0x00E6, 0x0001, 0x0001, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+            0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0xAA00, 0x0000, 0xA000, 0x0000, 0xAA00, 0xAA00, 0xA000, 0xA000, 0x0000, 0xA000,
+            0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0x0000, 0xA000,
+            0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6,
+            0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DA, 0x00E4, 0x00E8, 0x00DE, 0x00E0, 0x00E0,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000,
+            0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000,
+            0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x4408, 0x4408, 0xA000, 0xA000, 0x0000, 0x2200, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000,
+            0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000,
+            0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x2200, 0xA000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0x00E6, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6,
+            0x0000, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+            0x2200, 0x2200, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+        },
+        {
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0x0000,
+            0xAA00, 0x0000, 0xAA00, 0x0000, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000,
+            0xAA00, 0x0000, 0xAA00, 0x0000, 0x0000, 0xAA00, 0xAA00, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0x0000,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+        },
+        {
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0x001A, 0xAA00,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0xAA00, 0x0000,
+            0xAA00, 0xAA00, 0x0000, 0xAA00, 0xAA00, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00E6, 0x00E6,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x0000, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0001, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x00DC, 0x00DC,
+            0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x00E6, 0x00DC, 0x00E6, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x4407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200,
+            0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0007, 0x0000, 0x4400, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x0009, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400, 0x2200, 0x2200, 0x4400, 0x2200, 0x0000,
+            0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4400,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x2200, 0x0000, 0x0000, 0x0000, 0x0009,
+            0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0007, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x00D8, 0x00D8, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x00E2, 0x00D8, 0x00D8,
+            0x00D8, 0x00D8, 0x00D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
+        },
+        {
+            0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000,
+            0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+        },
+        {
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x00E6, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0x0000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000, 0x0000, 0xA000,
+            0x0000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0xA000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+            0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+    };
+
+    // Index of the block of decomposition indices for each 128 code points.
+    inline constexpr Byte decomposition_block_index[8704] =
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x00, 0x00,
+        0x00, 0x00, 0x0D, 0x0E, 0x0F, 0x00, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x00, 0x2A, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2C, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x00, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3C, 0x3D,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x4E, 0x4F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x51, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x00, 0x00, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x5F, 0x00, 0x00,
+        0x00, 0x00, 0x60, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x64, 0x65, 0x66, 0x67, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    // Indices in `decompositions`, where 0 means none.
+    inline constexpr uint16_t decomposition_blocks[105][128] =
+    {
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+            0x0000, 0x0000, 0x0005, 0x0006, 0x0007, 0x0008, 0x0000, 0x0000, 0x0009, 0x000A, 0x000B, 0x0000, 0x000C, 0x000D, 0x000E, 0x0000,
+            0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0000, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D,
+            0x0000, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0000, 0x0000, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0000, 0x0000,
+            0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x0000, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+            0x0000, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x0000, 0x0000, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0000, 0x0043,
+        },
+        {
+            0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+            0x0000, 0x0000, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061,
+            0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0000, 0x0000, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+            0x0070, 0x0000, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0000, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D,
+            0x007E, 0x0000, 0x0000, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0000, 0x0000, 0x0086, 0x0087, 0x0088, 0x0089,
+            0x008A, 0x008B, 0x0000, 0x0000, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x0000, 0x0000, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5,
+            0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x00B6, 0x00B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00B8,
+            0x00B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5,
+            0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x0000, 0x00D3, 0x00D4,
+            0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x0000, 0x0000, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2,
+            0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x0000, 0x0000, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0,
+        },
+        {
+            0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100,
+            0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x0000, 0x0000, 0x010D, 0x010E,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118,
+            0x0119, 0x011A, 0x011B, 0x011C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B, 0x0000, 0x0000,
+            0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0131, 0x0132, 0x0000, 0x0133, 0x0134, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0135, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0136, 0x0000, 0x0000, 0x0000, 0x0137, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x0000, 0x013F, 0x0000, 0x0140, 0x0141,
+            0x0142, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148,
+            0x0149, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x0000,
+            0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0156, 0x0157, 0x0158, 0x0000, 0x0159, 0x015A, 0x0000, 0x0000, 0x0000, 0x015B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x015C, 0x015D, 0x0000, 0x015E, 0x0000, 0x0000, 0x0000, 0x015F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0160, 0x0161, 0x0162, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0164, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0165, 0x0166, 0x0000, 0x0167, 0x0000, 0x0000, 0x0000, 0x0168, 0x0000, 0x0000, 0x0000, 0x0000, 0x0169, 0x016A, 0x016B, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x016C, 0x016D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x016E, 0x016F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0170, 0x0171, 0x0172, 0x0173, 0x0000, 0x0000, 0x0174, 0x0175, 0x0000, 0x0000, 0x0176, 0x0177, 0x0178, 0x0179, 0x017A, 0x017B,
+            0x0000, 0x0000, 0x017C, 0x017D, 0x017E, 0x017F, 0x0180, 0x0181, 0x0000, 0x0000, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x0187,
+            0x0188, 0x0189, 0x018A, 0x018B, 0x018C, 0x018D, 0x0000, 0x0000, 0x018E, 0x018F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0196, 0x0197, 0x0198, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x019A, 0x0000, 0x019B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x019C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x019D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x019E, 0x0000, 0x0000, 0x019F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x01A5, 0x01A6, 0x01A7,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A8, 0x01A9, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AA, 0x01AB, 0x0000, 0x01AC,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x01AD, 0x0000, 0x0000, 0x01AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AF, 0x01B0, 0x01B1, 0x0000, 0x0000, 0x01B2, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01B3, 0x0000, 0x0000, 0x01B4, 0x01B5, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01B6, 0x01B7, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x01B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01B9, 0x01BA, 0x01BB, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x01BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01BE, 0x01BF, 0x0000, 0x01C0, 0x01C1, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C2, 0x01C3, 0x01C4, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C5, 0x0000, 0x01C6, 0x01C7, 0x01C8, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x01C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x01CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CB, 0x01CC, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CD, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x01CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CF, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x01D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x01D4, 0x0000, 0x01D5, 0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x01DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x01DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DC, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x01DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DF, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E2, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E3, 0x0000, 0x01E4, 0x0000, 0x01E5, 0x0000, 0x01E6, 0x0000, 0x01E7, 0x0000,
+            0x0000, 0x0000, 0x01E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E9, 0x0000, 0x01EA, 0x0000, 0x0000,
+            0x01EB, 0x01EC, 0x0000, 0x01ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01EE, 0x01EF, 0x01F0, 0x0000,
+            0x01F1, 0x01F2, 0x01F3, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x01F9, 0x01FA, 0x01FB, 0x0000, 0x01FC, 0x01FD, 0x01FE, 0x01FF,
+            0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B, 0x020C, 0x020D, 0x0000, 0x020E,
+            0x020F, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218, 0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 0x021E,
+            0x021F, 0x0220, 0x0221, 0x0222, 0x0223, 0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F,
+            0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D, 0x023E, 0x023F,
+            0x0240, 0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F,
+            0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F,
+            0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F,
+            0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F,
+            0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298, 0x0299, 0x029A, 0x029B, 0x029C, 0x029D, 0x029E, 0x029F,
+            0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7, 0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF,
+            0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF,
+            0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF,
+        },
+        {
+            0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF,
+            0x02E0, 0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB,
+            0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300, 0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B,
+            0x030C, 0x030D, 0x030E, 0x030F, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B,
+            0x031C, 0x031D, 0x031E, 0x031F, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328, 0x0329, 0x032A, 0x032B,
+            0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B,
+            0x033C, 0x033D, 0x033E, 0x033F, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0346, 0x0347, 0x0348, 0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355,
+            0x0356, 0x0357, 0x0358, 0x0359, 0x035A, 0x035B, 0x0000, 0x0000, 0x035C, 0x035D, 0x035E, 0x035F, 0x0360, 0x0361, 0x0000, 0x0000,
+            0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0370, 0x0371,
+            0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x037F, 0x0380, 0x0381,
+            0x0382, 0x0383, 0x0384, 0x0385, 0x0386, 0x0387, 0x0000, 0x0000, 0x0388, 0x0389, 0x038A, 0x038B, 0x038C, 0x038D, 0x0000, 0x0000,
+            0x038E, 0x038F, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0000, 0x0396, 0x0000, 0x0397, 0x0000, 0x0398, 0x0000, 0x0399,
+            0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A2, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9,
+            0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x0000, 0x0000,
+        },
+        {
+            0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+            0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03CF, 0x03D0, 0x03D1, 0x03D2, 0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D7,
+            0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6, 0x03E7,
+            0x03E8, 0x03E9, 0x03EA, 0x03EB, 0x03EC, 0x0000, 0x03ED, 0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5, 0x03F6,
+            0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x0000, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405,
+            0x0406, 0x0407, 0x0408, 0x0409, 0x0000, 0x0000, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F, 0x0000, 0x0410, 0x0411, 0x0412,
+            0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422,
+            0x0000, 0x0000, 0x0423, 0x0424, 0x0425, 0x0000, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x0000,
+        },
+        {
+            0x042F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x043A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x043B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x043C, 0x043D, 0x043E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x043F,
+            0x0000, 0x0000, 0x0000, 0x0440, 0x0441, 0x0000, 0x0442, 0x0443, 0x0000, 0x0000, 0x0000, 0x0000, 0x0444, 0x0000, 0x0445, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0446, 0x0447, 0x0448, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0449, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x044A,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x044B, 0x044C, 0x0000, 0x0000, 0x044D, 0x044E, 0x044F, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458,
+        },
+        {
+            0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F, 0x0460, 0x0461, 0x0462, 0x0463, 0x0464, 0x0465, 0x0466, 0x0467, 0x0000,
+            0x0468, 0x0469, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0475, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0476, 0x0477, 0x0478, 0x0479, 0x0000, 0x047A, 0x047B, 0x047C, 0x0000, 0x047D, 0x047E, 0x047F, 0x0480, 0x0481, 0x0482, 0x0483,
+            0x0484, 0x0485, 0x0486, 0x0487, 0x0000, 0x0488, 0x0489, 0x0000, 0x0000, 0x048A, 0x048B, 0x048C, 0x048D, 0x048E, 0x0000, 0x0000,
+            0x048F, 0x0490, 0x0491, 0x0000, 0x0492, 0x0000, 0x0493, 0x0000, 0x0494, 0x0000, 0x0495, 0x0496, 0x0497, 0x0498, 0x0000, 0x0499,
+            0x049A, 0x049B, 0x0000, 0x049C, 0x049D, 0x049E, 0x049F, 0x04A0, 0x04A1, 0x04A2, 0x0000, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7,
+            0x04A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x04A9, 0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x04AE, 0x04AF, 0x04B0, 0x04B1, 0x04B2, 0x04B3, 0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x04BB, 0x04BC, 0x04BD,
+            0x04BE, 0x04BF, 0x04C0, 0x04C1, 0x04C2, 0x04C3, 0x04C4, 0x04C5, 0x04C6, 0x04C7, 0x04C8, 0x04C9, 0x04CA, 0x04CB, 0x04CC, 0x04CD,
+            0x04CE, 0x04CF, 0x04D0, 0x04D1, 0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04D6, 0x04D7, 0x04D8, 0x04D9, 0x04DA, 0x04DB, 0x04DC, 0x04DD,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04DF, 0x04E0, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04E1, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04E2, 0x04E3, 0x04E4,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x04E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x04E6, 0x0000, 0x0000, 0x04E7, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x04E8, 0x0000, 0x04E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04EA, 0x04EB, 0x0000, 0x04EC,
+            0x04ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x04EE, 0x0000, 0x0000, 0x04EF, 0x0000, 0x0000, 0x04F0, 0x0000, 0x04F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x04F2, 0x0000, 0x04F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F4, 0x04F5, 0x04F6,
+            0x04F7, 0x04F8, 0x0000, 0x0000, 0x04F9, 0x04FA, 0x0000, 0x0000, 0x04FB, 0x04FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x04FD, 0x04FE, 0x0000, 0x0000, 0x04FF, 0x0500, 0x0000, 0x0000, 0x0501, 0x0502, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0503, 0x0504, 0x0505, 0x0506,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0507, 0x0508, 0x0509, 0x050A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x050B, 0x050C, 0x050D, 0x050E, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x050F, 0x0510, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0511, 0x0512, 0x0513, 0x0514, 0x0515, 0x0516, 0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520,
+            0x0521, 0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0530,
+        },
+        {
+            0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537, 0x0538, 0x0539, 0x053A, 0x053B, 0x053C, 0x053D, 0x053E, 0x053F, 0x0540,
+            0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F, 0x0550,
+            0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E, 0x055F, 0x0560,
+            0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F, 0x0570,
+            0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580,
+            0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058E, 0x058F, 0x0590,
+            0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599, 0x059A, 0x059B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x059C, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x059D, 0x059E, 0x059F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05A0, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05A1, 0x05A2, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05A3,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05A4,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x05A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x05A6, 0x05A7, 0x05A8, 0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5,
+            0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5,
+            0x05C6, 0x05C7, 0x05C8, 0x05C9, 0x05CA, 0x05CB, 0x05CC, 0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5,
+            0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5,
+            0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5,
+            0x05F6, 0x05F7, 0x05F8, 0x05F9, 0x05FA, 0x05FB, 0x05FC, 0x05FD, 0x05FE, 0x05FF, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605,
+            0x0606, 0x0607, 0x0608, 0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614, 0x0615,
+            0x0616, 0x0617, 0x0618, 0x0619, 0x061A, 0x061B, 0x061C, 0x061D, 0x061E, 0x061F, 0x0620, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625,
+        },
+        {
+            0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F, 0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635,
+            0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x063B, 0x063C, 0x063D, 0x063E, 0x063F, 0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645,
+            0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F, 0x0650, 0x0651, 0x0652, 0x0653, 0x0654, 0x0655,
+            0x0656, 0x0657, 0x0658, 0x0659, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665,
+            0x0666, 0x0667, 0x0668, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F, 0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675,
+            0x0676, 0x0677, 0x0678, 0x0679, 0x067A, 0x067B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x067C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x067D, 0x0000, 0x067E, 0x067F, 0x0680, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0681, 0x0000, 0x0682, 0x0000,
+            0x0683, 0x0000, 0x0684, 0x0000, 0x0685, 0x0000, 0x0686, 0x0000, 0x0687, 0x0000, 0x0688, 0x0000, 0x0689, 0x0000, 0x068A, 0x0000,
+            0x068B, 0x0000, 0x068C, 0x0000, 0x0000, 0x068D, 0x0000, 0x068E, 0x0000, 0x068F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0690, 0x0691, 0x0000, 0x0692, 0x0693, 0x0000, 0x0694, 0x0695, 0x0000, 0x0696, 0x0697, 0x0000, 0x0698, 0x0699, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x069A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x069B, 0x069C, 0x0000, 0x069D, 0x069E,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x069F, 0x0000, 0x06A0, 0x0000,
+            0x06A1, 0x0000, 0x06A2, 0x0000, 0x06A3, 0x0000, 0x06A4, 0x0000, 0x06A5, 0x0000, 0x06A6, 0x0000, 0x06A7, 0x0000, 0x06A8, 0x0000,
+            0x06A9, 0x0000, 0x06AA, 0x0000, 0x0000, 0x06AB, 0x0000, 0x06AC, 0x0000, 0x06AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x06AE, 0x06AF, 0x0000, 0x06B0, 0x06B1, 0x0000, 0x06B2, 0x06B3, 0x0000, 0x06B4, 0x06B5, 0x0000, 0x06B6, 0x06B7, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x06B8, 0x0000, 0x0000, 0x06B9, 0x06BA, 0x06BB, 0x06BC, 0x0000, 0x0000, 0x0000, 0x06BD, 0x06BE,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x06BF, 0x06C0, 0x06C1, 0x06C2, 0x06C3, 0x06C4, 0x06C5, 0x06C6, 0x06C7, 0x06C8, 0x06C9, 0x06CA, 0x06CB, 0x06CC, 0x06CD,
+            0x06CE, 0x06CF, 0x06D0, 0x06D1, 0x06D2, 0x06D3, 0x06D4, 0x06D5, 0x06D6, 0x06D7, 0x06D8, 0x06D9, 0x06DA, 0x06DB, 0x06DC, 0x06DD,
+            0x06DE, 0x06DF, 0x06E0, 0x06E1, 0x06E2, 0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7, 0x06E8, 0x06E9, 0x06EA, 0x06EB, 0x06EC, 0x06ED,
+            0x06EE, 0x06EF, 0x06F0, 0x06F1, 0x06F2, 0x06F3, 0x06F4, 0x06F5, 0x06F6, 0x06F7, 0x06F8, 0x06F9, 0x06FA, 0x06FB, 0x06FC, 0x06FD,
+            0x06FE, 0x06FF, 0x0700, 0x0701, 0x0702, 0x0703, 0x0704, 0x0705, 0x0706, 0x0707, 0x0708, 0x0709, 0x070A, 0x070B, 0x070C, 0x070D,
+        },
+        {
+            0x070E, 0x070F, 0x0710, 0x0711, 0x0712, 0x0713, 0x0714, 0x0715, 0x0716, 0x0717, 0x0718, 0x0719, 0x071A, 0x071B, 0x071C, 0x0000,
+            0x0000, 0x0000, 0x071D, 0x071E, 0x071F, 0x0720, 0x0721, 0x0722, 0x0723, 0x0724, 0x0725, 0x0726, 0x0727, 0x0728, 0x0729, 0x072A,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x072B, 0x072C, 0x072D, 0x072E, 0x072F, 0x0730, 0x0731, 0x0732, 0x0733, 0x0734, 0x0735, 0x0736, 0x0737, 0x0738, 0x0739, 0x073A,
+            0x073B, 0x073C, 0x073D, 0x073E, 0x073F, 0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746, 0x0747, 0x0748, 0x0749, 0x0000,
+            0x074A, 0x074B, 0x074C, 0x074D, 0x074E, 0x074F, 0x0750, 0x0751, 0x0752, 0x0753, 0x0754, 0x0755, 0x0756, 0x0757, 0x0758, 0x0759,
+            0x075A, 0x075B, 0x075C, 0x075D, 0x075E, 0x075F, 0x0760, 0x0761, 0x0762, 0x0763, 0x0764, 0x0765, 0x0766, 0x0767, 0x0768, 0x0769,
+            0x076A, 0x076B, 0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0772, 0x0773, 0x0774, 0x0775, 0x0776, 0x0777, 0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F, 0x0780, 0x0781,
+            0x0782, 0x0783, 0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D, 0x078E, 0x078F, 0x0790, 0x0791,
+            0x0792, 0x0793, 0x0794, 0x0795, 0x0796, 0x0797, 0x0798, 0x0799, 0x079A, 0x079B, 0x079C, 0x079D, 0x079E, 0x079F, 0x07A0, 0x0000,
+        },
+        {
+            0x07A1, 0x07A2, 0x07A3, 0x07A4, 0x07A5, 0x07A6, 0x07A7, 0x07A8, 0x07A9, 0x07AA, 0x07AB, 0x07AC, 0x07AD, 0x07AE, 0x07AF, 0x07B0,
+            0x07B1, 0x07B2, 0x07B3, 0x07B4, 0x07B5, 0x07B6, 0x07B7, 0x07B8, 0x07B9, 0x07BA, 0x07BB, 0x07BC, 0x07BD, 0x07BE, 0x07BF, 0x07C0,
+            0x07C1, 0x07C2, 0x07C3, 0x07C4, 0x07C5, 0x07C6, 0x07C7, 0x07C8, 0x07C9, 0x07CA, 0x07CB, 0x07CC, 0x07CD, 0x07CE, 0x07CF, 0x07D0,
+            0x07D1, 0x07D2, 0x07D3, 0x07D4, 0x07D5, 0x07D6, 0x07D7, 0x07D8, 0x07D9, 0x07DA, 0x07DB, 0x07DC, 0x07DD, 0x07DE, 0x07DF, 0x07E0,
+            0x07E1, 0x07E2, 0x07E3, 0x07E4, 0x07E5, 0x07E6, 0x07E7, 0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED, 0x07EE, 0x07EF, 0x07F0,
+            0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F5, 0x07F6, 0x07F7, 0x07F8, 0x07F9, 0x07FA, 0x07FB, 0x07FC, 0x07FD, 0x07FE, 0x07FF, 0x0800,
+            0x0801, 0x0802, 0x0803, 0x0804, 0x0805, 0x0806, 0x0807, 0x0808, 0x0809, 0x080A, 0x080B, 0x080C, 0x080D, 0x080E, 0x080F, 0x0810,
+            0x0811, 0x0812, 0x0813, 0x0814, 0x0815, 0x0816, 0x0817, 0x0818, 0x0819, 0x081A, 0x081B, 0x081C, 0x081D, 0x081E, 0x081F, 0x0820,
+        },
+        {
+            0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0826, 0x0827, 0x0828, 0x0829, 0x082A, 0x082B, 0x082C, 0x082D, 0x082E, 0x082F, 0x0830,
+            0x0831, 0x0832, 0x0833, 0x0834, 0x0835, 0x0836, 0x0837, 0x0838, 0x0839, 0x083A, 0x083B, 0x083C, 0x083D, 0x083E, 0x083F, 0x0840,
+            0x0841, 0x0842, 0x0843, 0x0844, 0x0845, 0x0846, 0x0847, 0x0848, 0x0849, 0x084A, 0x084B, 0x084C, 0x084D, 0x084E, 0x084F, 0x0850,
+            0x0851, 0x0852, 0x0853, 0x0854, 0x0855, 0x0856, 0x0857, 0x0858, 0x0859, 0x085A, 0x085B, 0x085C, 0x085D, 0x085E, 0x085F, 0x0860,
+            0x0861, 0x0862, 0x0863, 0x0864, 0x0865, 0x0866, 0x0867, 0x0868, 0x0869, 0x086A, 0x086B, 0x086C, 0x086D, 0x086E, 0x086F, 0x0870,
+            0x0871, 0x0872, 0x0873, 0x0874, 0x0875, 0x0876, 0x0877, 0x0878, 0x0879, 0x087A, 0x087B, 0x087C, 0x087D, 0x087E, 0x087F, 0x0880,
+            0x0881, 0x0882, 0x0883, 0x0884, 0x0885, 0x0886, 0x0887, 0x0888, 0x0889, 0x088A, 0x088B, 0x088C, 0x088D, 0x088E, 0x088F, 0x0890,
+            0x0891, 0x0892, 0x0893, 0x0894, 0x0895, 0x0896, 0x0897, 0x0898, 0x0899, 0x089A, 0x089B, 0x089C, 0x089D, 0x089E, 0x089F, 0x08A0,
+        },
+        {
+            0x08A1, 0x08A2, 0x08A3, 0x08A4, 0x08A5, 0x08A6, 0x08A7, 0x08A8, 0x08A9, 0x08AA, 0x08AB, 0x08AC, 0x08AD, 0x08AE, 0x08AF, 0x08B0,
+            0x08B1, 0x08B2, 0x08B3, 0x08B4, 0x08B5, 0x08B6, 0x08B7, 0x08B8, 0x08B9, 0x08BA, 0x08BB, 0x08BC, 0x08BD, 0x08BE, 0x08BF, 0x08C0,
+            0x08C1, 0x08C2, 0x08C3, 0x08C4, 0x08C5, 0x08C6, 0x08C7, 0x08C8, 0x08C9, 0x08CA, 0x08CB, 0x08CC, 0x08CD, 0x08CE, 0x08CF, 0x08D0,
+            0x08D1, 0x08D2, 0x08D3, 0x08D4, 0x08D5, 0x08D6, 0x08D7, 0x08D8, 0x08D9, 0x08DA, 0x08DB, 0x08DC, 0x08DD, 0x08DE, 0x08DF, 0x08E0,
+            0x08E1, 0x08E2, 0x08E3, 0x08E4, 0x08E5, 0x08E6, 0x08E7, 0x08E8, 0x08E9, 0x08EA, 0x08EB, 0x08EC, 0x08ED, 0x08EE, 0x08EF, 0x08F0,
+            0x08F1, 0x08F2, 0x08F3, 0x08F4, 0x08F5, 0x08F6, 0x08F7, 0x08F8, 0x08F9, 0x08FA, 0x08FB, 0x08FC, 0x08FD, 0x08FE, 0x08FF, 0x0900,
+            0x0901, 0x0902, 0x0903, 0x0904, 0x0905, 0x0906, 0x0907, 0x0908, 0x0909, 0x090A, 0x090B, 0x090C, 0x090D, 0x090E, 0x090F, 0x0910,
+            0x0911, 0x0912, 0x0913, 0x0914, 0x0915, 0x0916, 0x0917, 0x0918, 0x0919, 0x091A, 0x091B, 0x091C, 0x091D, 0x091E, 0x091F, 0x0920,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0921, 0x0922, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0924, 0x0925, 0x0926, 0x0000, 0x0000, 0x0000, 0x0927, 0x0928, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0929, 0x092A, 0x092B, 0x092C,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x092D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x092E, 0x092F, 0x0930, 0x0931, 0x0932, 0x0933, 0x0934, 0x0935, 0x0936, 0x0937, 0x0938, 0x0939, 0x093A, 0x093B, 0x093C, 0x093D,
+            0x093E, 0x093F, 0x0940, 0x0941, 0x0942, 0x0943, 0x0944, 0x0945, 0x0946, 0x0947, 0x0948, 0x0949, 0x094A, 0x094B, 0x094C, 0x094D,
+            0x094E, 0x094F, 0x0950, 0x0951, 0x0952, 0x0953, 0x0954, 0x0955, 0x0956, 0x0957, 0x0958, 0x0959, 0x095A, 0x095B, 0x095C, 0x095D,
+            0x095E, 0x095F, 0x0960, 0x0961, 0x0962, 0x0963, 0x0964, 0x0965, 0x0966, 0x0967, 0x0968, 0x0969, 0x096A, 0x096B, 0x096C, 0x096D,
+            0x096E, 0x096F, 0x0970, 0x0971, 0x0972, 0x0973, 0x0974, 0x0975, 0x0976, 0x0977, 0x0978, 0x0979, 0x097A, 0x097B, 0x097C, 0x097D,
+            0x097E, 0x097F, 0x0980, 0x0981, 0x0982, 0x0983, 0x0984, 0x0985, 0x0986, 0x0987, 0x0988, 0x0989, 0x098A, 0x098B, 0x098C, 0x098D,
+            0x098E, 0x098F, 0x0990, 0x0991, 0x0992, 0x0993, 0x0994, 0x0995, 0x0996, 0x0997, 0x0998, 0x0999, 0x099A, 0x099B, 0x099C, 0x099D,
+            0x099E, 0x099F, 0x09A0, 0x09A1, 0x09A2, 0x09A3, 0x09A4, 0x09A5, 0x09A6, 0x09A7, 0x09A8, 0x09A9, 0x09AA, 0x09AB, 0x09AC, 0x09AD,
+        },
+        {
+            0x09AE, 0x09AF, 0x09B0, 0x09B1, 0x09B2, 0x09B3, 0x09B4, 0x09B5, 0x09B6, 0x09B7, 0x09B8, 0x09B9, 0x09BA, 0x09BB, 0x09BC, 0x09BD,
+            0x09BE, 0x09BF, 0x09C0, 0x09C1, 0x09C2, 0x09C3, 0x09C4, 0x09C5, 0x09C6, 0x09C7, 0x09C8, 0x09C9, 0x09CA, 0x09CB, 0x09CC, 0x09CD,
+            0x09CE, 0x09CF, 0x09D0, 0x09D1, 0x09D2, 0x09D3, 0x09D4, 0x09D5, 0x09D6, 0x09D7, 0x09D8, 0x09D9, 0x09DA, 0x09DB, 0x09DC, 0x09DD,
+            0x09DE, 0x09DF, 0x09E0, 0x09E1, 0x09E2, 0x09E3, 0x09E4, 0x09E5, 0x09E6, 0x09E7, 0x09E8, 0x09E9, 0x09EA, 0x09EB, 0x09EC, 0x09ED,
+            0x09EE, 0x09EF, 0x09F0, 0x09F1, 0x09F2, 0x09F3, 0x09F4, 0x09F5, 0x09F6, 0x09F7, 0x09F8, 0x09F9, 0x09FA, 0x09FB, 0x09FC, 0x09FD,
+            0x09FE, 0x09FF, 0x0A00, 0x0A01, 0x0A02, 0x0A03, 0x0A04, 0x0A05, 0x0A06, 0x0A07, 0x0A08, 0x0A09, 0x0A0A, 0x0A0B, 0x0A0C, 0x0A0D,
+            0x0A0E, 0x0A0F, 0x0A10, 0x0A11, 0x0A12, 0x0A13, 0x0A14, 0x0A15, 0x0A16, 0x0A17, 0x0A18, 0x0A19, 0x0A1A, 0x0A1B, 0x0A1C, 0x0A1D,
+            0x0A1E, 0x0A1F, 0x0A20, 0x0A21, 0x0A22, 0x0A23, 0x0A24, 0x0A25, 0x0A26, 0x0A27, 0x0A28, 0x0A29, 0x0A2A, 0x0A2B, 0x0A2C, 0x0A2D,
+        },
+        {
+            0x0A2E, 0x0A2F, 0x0A30, 0x0A31, 0x0A32, 0x0A33, 0x0A34, 0x0A35, 0x0A36, 0x0A37, 0x0A38, 0x0A39, 0x0A3A, 0x0A3B, 0x0000, 0x0000,
+            0x0A3C, 0x0000, 0x0A3D, 0x0000, 0x0000, 0x0A3E, 0x0A3F, 0x0A40, 0x0A41, 0x0A42, 0x0A43, 0x0A44, 0x0A45, 0x0A46, 0x0A47, 0x0000,
+            0x0A48, 0x0000, 0x0A49, 0x0000, 0x0000, 0x0A4A, 0x0A4B, 0x0000, 0x0000, 0x0000, 0x0A4C, 0x0A4D, 0x0A4E, 0x0A4F, 0x0A50, 0x0A51,
+            0x0A52, 0x0A53, 0x0A54, 0x0A55, 0x0A56, 0x0A57, 0x0A58, 0x0A59, 0x0A5A, 0x0A5B, 0x0A5C, 0x0A5D, 0x0A5E, 0x0A5F, 0x0A60, 0x0A61,
+            0x0A62, 0x0A63, 0x0A64, 0x0A65, 0x0A66, 0x0A67, 0x0A68, 0x0A69, 0x0A6A, 0x0A6B, 0x0A6C, 0x0A6D, 0x0A6E, 0x0A6F, 0x0A70, 0x0A71,
+            0x0A72, 0x0A73, 0x0A74, 0x0A75, 0x0A76, 0x0A77, 0x0A78, 0x0A79, 0x0A7A, 0x0A7B, 0x0A7C, 0x0A7D, 0x0A7E, 0x0A7F, 0x0A80, 0x0A81,
+            0x0A82, 0x0A83, 0x0A84, 0x0A85, 0x0A86, 0x0A87, 0x0A88, 0x0A89, 0x0A8A, 0x0A8B, 0x0A8C, 0x0A8D, 0x0A8E, 0x0A8F, 0x0000, 0x0000,
+            0x0A90, 0x0A91, 0x0A92, 0x0A93, 0x0A94, 0x0A95, 0x0A96, 0x0A97, 0x0A98, 0x0A99, 0x0A9A, 0x0A9B, 0x0A9C, 0x0A9D, 0x0A9E, 0x0A9F,
+        },
+        {
+            0x0AA0, 0x0AA1, 0x0AA2, 0x0AA3, 0x0AA4, 0x0AA5, 0x0AA6, 0x0AA7, 0x0AA8, 0x0AA9, 0x0AAA, 0x0AAB, 0x0AAC, 0x0AAD, 0x0AAE, 0x0AAF,
+            0x0AB0, 0x0AB1, 0x0AB2, 0x0AB3, 0x0AB4, 0x0AB5, 0x0AB6, 0x0AB7, 0x0AB8, 0x0AB9, 0x0ABA, 0x0ABB, 0x0ABC, 0x0ABD, 0x0ABE, 0x0ABF,
+            0x0AC0, 0x0AC1, 0x0AC2, 0x0AC3, 0x0AC4, 0x0AC5, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACA, 0x0ACB, 0x0ACC, 0x0ACD, 0x0ACE, 0x0ACF,
+            0x0AD0, 0x0AD1, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6, 0x0AD7, 0x0AD8, 0x0AD9, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF,
+            0x0AE0, 0x0AE1, 0x0AE2, 0x0AE3, 0x0AE4, 0x0AE5, 0x0AE6, 0x0AE7, 0x0AE8, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AED, 0x0AEE, 0x0AEF,
+            0x0AF0, 0x0AF1, 0x0AF2, 0x0AF3, 0x0AF4, 0x0AF5, 0x0AF6, 0x0AF7, 0x0AF8, 0x0AF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0AFA, 0x0AFB, 0x0AFC, 0x0AFD, 0x0AFE, 0x0AFF, 0x0B00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0B01, 0x0B02, 0x0B03, 0x0B04, 0x0B05, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B06, 0x0000, 0x0B07,
+            0x0B08, 0x0B09, 0x0B0A, 0x0B0B, 0x0B0C, 0x0B0D, 0x0B0E, 0x0B0F, 0x0B10, 0x0B11, 0x0B12, 0x0B13, 0x0B14, 0x0B15, 0x0B16, 0x0B17,
+            0x0B18, 0x0B19, 0x0B1A, 0x0B1B, 0x0B1C, 0x0B1D, 0x0B1E, 0x0000, 0x0B1F, 0x0B20, 0x0B21, 0x0B22, 0x0B23, 0x0000, 0x0B24, 0x0000,
+            0x0B25, 0x0B26, 0x0000, 0x0B27, 0x0B28, 0x0000, 0x0B29, 0x0B2A, 0x0B2B, 0x0B2C, 0x0B2D, 0x0B2E, 0x0B2F, 0x0B30, 0x0B31, 0x0B32,
+            0x0B33, 0x0B34, 0x0B35, 0x0B36, 0x0B37, 0x0B38, 0x0B39, 0x0B3A, 0x0B3B, 0x0B3C, 0x0B3D, 0x0B3E, 0x0B3F, 0x0B40, 0x0B41, 0x0B42,
+            0x0B43, 0x0B44, 0x0B45, 0x0B46, 0x0B47, 0x0B48, 0x0B49, 0x0B4A, 0x0B4B, 0x0B4C, 0x0B4D, 0x0B4E, 0x0B4F, 0x0B50, 0x0B51, 0x0B52,
+            0x0B53, 0x0B54, 0x0B55, 0x0B56, 0x0B57, 0x0B58, 0x0B59, 0x0B5A, 0x0B5B, 0x0B5C, 0x0B5D, 0x0B5E, 0x0B5F, 0x0B60, 0x0B61, 0x0B62,
+        },
+        {
+            0x0B63, 0x0B64, 0x0B65, 0x0B66, 0x0B67, 0x0B68, 0x0B69, 0x0B6A, 0x0B6B, 0x0B6C, 0x0B6D, 0x0B6E, 0x0B6F, 0x0B70, 0x0B71, 0x0B72,
+            0x0B73, 0x0B74, 0x0B75, 0x0B76, 0x0B77, 0x0B78, 0x0B79, 0x0B7A, 0x0B7B, 0x0B7C, 0x0B7D, 0x0B7E, 0x0B7F, 0x0B80, 0x0B81, 0x0B82,
+            0x0B83, 0x0B84, 0x0B85, 0x0B86, 0x0B87, 0x0B88, 0x0B89, 0x0B8A, 0x0B8B, 0x0B8C, 0x0B8D, 0x0B8E, 0x0B8F, 0x0B90, 0x0B91, 0x0B92,
+            0x0B93, 0x0B94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0B95, 0x0B96, 0x0B97, 0x0B98, 0x0B99, 0x0B9A, 0x0B9B, 0x0B9C, 0x0B9D, 0x0B9E, 0x0B9F, 0x0BA0, 0x0BA1,
+            0x0BA2, 0x0BA3, 0x0BA4, 0x0BA5, 0x0BA6, 0x0BA7, 0x0BA8, 0x0BA9, 0x0BAA, 0x0BAB, 0x0BAC, 0x0BAD, 0x0BAE, 0x0BAF, 0x0BB0, 0x0BB1,
+            0x0BB2, 0x0BB3, 0x0BB4, 0x0BB5, 0x0BB6, 0x0BB7, 0x0BB8, 0x0BB9, 0x0BBA, 0x0BBB, 0x0BBC, 0x0BBD, 0x0BBE, 0x0BBF, 0x0BC0, 0x0BC1,
+        },
+        {
+            0x0BC2, 0x0BC3, 0x0BC4, 0x0BC5, 0x0BC6, 0x0BC7, 0x0BC8, 0x0BC9, 0x0BCA, 0x0BCB, 0x0BCC, 0x0BCD, 0x0BCE, 0x0BCF, 0x0BD0, 0x0BD1,
+            0x0BD2, 0x0BD3, 0x0BD4, 0x0BD5, 0x0BD6, 0x0BD7, 0x0BD8, 0x0BD9, 0x0BDA, 0x0BDB, 0x0BDC, 0x0BDD, 0x0BDE, 0x0BDF, 0x0BE0, 0x0BE1,
+            0x0BE2, 0x0BE3, 0x0BE4, 0x0BE5, 0x0BE6, 0x0BE7, 0x0BE8, 0x0BE9, 0x0BEA, 0x0BEB, 0x0BEC, 0x0BED, 0x0BEE, 0x0BEF, 0x0BF0, 0x0BF1,
+            0x0BF2, 0x0BF3, 0x0BF4, 0x0BF5, 0x0BF6, 0x0BF7, 0x0BF8, 0x0BF9, 0x0BFA, 0x0BFB, 0x0BFC, 0x0BFD, 0x0BFE, 0x0BFF, 0x0C00, 0x0C01,
+            0x0C02, 0x0C03, 0x0C04, 0x0C05, 0x0C06, 0x0C07, 0x0C08, 0x0C09, 0x0C0A, 0x0C0B, 0x0C0C, 0x0C0D, 0x0C0E, 0x0C0F, 0x0C10, 0x0C11,
+            0x0C12, 0x0C13, 0x0C14, 0x0C15, 0x0C16, 0x0C17, 0x0C18, 0x0C19, 0x0C1A, 0x0C1B, 0x0C1C, 0x0C1D, 0x0C1E, 0x0C1F, 0x0C20, 0x0C21,
+            0x0C22, 0x0C23, 0x0C24, 0x0C25, 0x0C26, 0x0C27, 0x0C28, 0x0C29, 0x0C2A, 0x0C2B, 0x0C2C, 0x0C2D, 0x0C2E, 0x0C2F, 0x0C30, 0x0C31,
+            0x0C32, 0x0C33, 0x0C34, 0x0C35, 0x0C36, 0x0C37, 0x0C38, 0x0C39, 0x0C3A, 0x0C3B, 0x0C3C, 0x0C3D, 0x0C3E, 0x0C3F, 0x0C40, 0x0C41,
+        },
+        {
+            0x0C42, 0x0C43, 0x0C44, 0x0C45, 0x0C46, 0x0C47, 0x0C48, 0x0C49, 0x0C4A, 0x0C4B, 0x0C4C, 0x0C4D, 0x0C4E, 0x0C4F, 0x0C50, 0x0C51,
+            0x0C52, 0x0C53, 0x0C54, 0x0C55, 0x0C56, 0x0C57, 0x0C58, 0x0C59, 0x0C5A, 0x0C5B, 0x0C5C, 0x0C5D, 0x0C5E, 0x0C5F, 0x0C60, 0x0C61,
+            0x0C62, 0x0C63, 0x0C64, 0x0C65, 0x0C66, 0x0C67, 0x0C68, 0x0C69, 0x0C6A, 0x0C6B, 0x0C6C, 0x0C6D, 0x0C6E, 0x0C6F, 0x0C70, 0x0C71,
+            0x0C72, 0x0C73, 0x0C74, 0x0C75, 0x0C76, 0x0C77, 0x0C78, 0x0C79, 0x0C7A, 0x0C7B, 0x0C7C, 0x0C7D, 0x0C7E, 0x0C7F, 0x0C80, 0x0C81,
+            0x0C82, 0x0C83, 0x0C84, 0x0C85, 0x0C86, 0x0C87, 0x0C88, 0x0C89, 0x0C8A, 0x0C8B, 0x0C8C, 0x0C8D, 0x0C8E, 0x0C8F, 0x0C90, 0x0C91,
+            0x0C92, 0x0C93, 0x0C94, 0x0C95, 0x0C96, 0x0C97, 0x0C98, 0x0C99, 0x0C9A, 0x0C9B, 0x0C9C, 0x0C9D, 0x0C9E, 0x0C9F, 0x0CA0, 0x0CA1,
+            0x0CA2, 0x0CA3, 0x0CA4, 0x0CA5, 0x0CA6, 0x0CA7, 0x0CA8, 0x0CA9, 0x0CAA, 0x0CAB, 0x0CAC, 0x0CAD, 0x0CAE, 0x0CAF, 0x0CB0, 0x0CB1,
+            0x0CB2, 0x0CB3, 0x0CB4, 0x0CB5, 0x0CB6, 0x0CB7, 0x0CB8, 0x0CB9, 0x0CBA, 0x0CBB, 0x0CBC, 0x0CBD, 0x0CBE, 0x0CBF, 0x0CC0, 0x0CC1,
+        },
+        {
+            0x0CC2, 0x0CC3, 0x0CC4, 0x0CC5, 0x0CC6, 0x0CC7, 0x0CC8, 0x0CC9, 0x0CCA, 0x0CCB, 0x0CCC, 0x0CCD, 0x0CCE, 0x0CCF, 0x0CD0, 0x0CD1,
+            0x0CD2, 0x0CD3, 0x0CD4, 0x0CD5, 0x0CD6, 0x0CD7, 0x0CD8, 0x0CD9, 0x0CDA, 0x0CDB, 0x0CDC, 0x0CDD, 0x0CDE, 0x0CDF, 0x0CE0, 0x0CE1,
+            0x0CE2, 0x0CE3, 0x0CE4, 0x0CE5, 0x0CE6, 0x0CE7, 0x0CE8, 0x0CE9, 0x0CEA, 0x0CEB, 0x0CEC, 0x0CED, 0x0CEE, 0x0CEF, 0x0CF0, 0x0CF1,
+            0x0CF2, 0x0CF3, 0x0CF4, 0x0CF5, 0x0CF6, 0x0CF7, 0x0CF8, 0x0CF9, 0x0CFA, 0x0CFB, 0x0CFC, 0x0CFD, 0x0CFE, 0x0CFF, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0D00, 0x0D01, 0x0D02, 0x0D03, 0x0D04, 0x0D05, 0x0D06, 0x0D07, 0x0D08, 0x0D09, 0x0D0A, 0x0D0B, 0x0D0C, 0x0D0D, 0x0D0E, 0x0D0F,
+            0x0D10, 0x0D11, 0x0D12, 0x0D13, 0x0D14, 0x0D15, 0x0D16, 0x0D17, 0x0D18, 0x0D19, 0x0D1A, 0x0D1B, 0x0D1C, 0x0D1D, 0x0D1E, 0x0D1F,
+            0x0D20, 0x0D21, 0x0D22, 0x0D23, 0x0D24, 0x0D25, 0x0D26, 0x0D27, 0x0D28, 0x0D29, 0x0D2A, 0x0D2B, 0x0D2C, 0x0D2D, 0x0D2E, 0x0D2F,
+        },
+        {
+            0x0D30, 0x0D31, 0x0D32, 0x0D33, 0x0D34, 0x0D35, 0x0D36, 0x0D37, 0x0D38, 0x0D39, 0x0D3A, 0x0D3B, 0x0D3C, 0x0D3D, 0x0D3E, 0x0D3F,
+            0x0000, 0x0000, 0x0D40, 0x0D41, 0x0D42, 0x0D43, 0x0D44, 0x0D45, 0x0D46, 0x0D47, 0x0D48, 0x0D49, 0x0D4A, 0x0D4B, 0x0D4C, 0x0D4D,
+            0x0D4E, 0x0D4F, 0x0D50, 0x0D51, 0x0D52, 0x0D53, 0x0D54, 0x0D55, 0x0D56, 0x0D57, 0x0D58, 0x0D59, 0x0D5A, 0x0D5B, 0x0D5C, 0x0D5D,
+            0x0D5E, 0x0D5F, 0x0D60, 0x0D61, 0x0D62, 0x0D63, 0x0D64, 0x0D65, 0x0D66, 0x0D67, 0x0D68, 0x0D69, 0x0D6A, 0x0D6B, 0x0D6C, 0x0D6D,
+            0x0D6E, 0x0D6F, 0x0D70, 0x0D71, 0x0D72, 0x0D73, 0x0D74, 0x0D75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0D76, 0x0D77, 0x0D78, 0x0D79, 0x0D7A, 0x0D7B, 0x0D7C, 0x0D7D, 0x0D7E, 0x0D7F, 0x0D80, 0x0D81, 0x0D82, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0D83, 0x0D84, 0x0D85, 0x0D86, 0x0D87, 0x0D88, 0x0D89, 0x0D8A, 0x0D8B, 0x0D8C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0D8D, 0x0D8E, 0x0D8F, 0x0D90, 0x0D91, 0x0D92, 0x0D93, 0x0D94, 0x0D95, 0x0D96, 0x0D97, 0x0D98, 0x0D99, 0x0D9A, 0x0D9B, 0x0D9C,
+            0x0D9D, 0x0D9E, 0x0D9F, 0x0DA0, 0x0DA1, 0x0000, 0x0000, 0x0DA2, 0x0DA3, 0x0DA4, 0x0DA5, 0x0DA6, 0x0DA7, 0x0DA8, 0x0DA9, 0x0DAA,
+            0x0DAB, 0x0DAC, 0x0DAD, 0x0000, 0x0DAE, 0x0DAF, 0x0DB0, 0x0DB1, 0x0DB2, 0x0DB3, 0x0DB4, 0x0DB5, 0x0DB6, 0x0DB7, 0x0DB8, 0x0DB9,
+            0x0DBA, 0x0DBB, 0x0DBC, 0x0DBD, 0x0DBE, 0x0DBF, 0x0DC0, 0x0000, 0x0DC1, 0x0DC2, 0x0DC3, 0x0DC4, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0DC5, 0x0DC6, 0x0DC7, 0x0000, 0x0DC8, 0x0000, 0x0DC9, 0x0DCA, 0x0DCB, 0x0DCC, 0x0DCD, 0x0DCE, 0x0DCF, 0x0DD0, 0x0DD1, 0x0DD2,
+        },
+        {
+            0x0DD3, 0x0DD4, 0x0DD5, 0x0DD6, 0x0DD7, 0x0DD8, 0x0DD9, 0x0DDA, 0x0DDB, 0x0DDC, 0x0DDD, 0x0DDE, 0x0DDF, 0x0DE0, 0x0DE1, 0x0DE2,
+            0x0DE3, 0x0DE4, 0x0DE5, 0x0DE6, 0x0DE7, 0x0DE8, 0x0DE9, 0x0DEA, 0x0DEB, 0x0DEC, 0x0DED, 0x0DEE, 0x0DEF, 0x0DF0, 0x0DF1, 0x0DF2,
+            0x0DF3, 0x0DF4, 0x0DF5, 0x0DF6, 0x0DF7, 0x0DF8, 0x0DF9, 0x0DFA, 0x0DFB, 0x0DFC, 0x0DFD, 0x0DFE, 0x0DFF, 0x0E00, 0x0E01, 0x0E02,
+            0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, 0x0E10, 0x0E11, 0x0E12,
+            0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21, 0x0E22,
+            0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F, 0x0E30, 0x0E31, 0x0E32,
+            0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0x0E3B, 0x0E3C, 0x0E3D, 0x0E3E, 0x0E3F, 0x0E40, 0x0E41, 0x0E42,
+            0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0x0E5C, 0x0E5D, 0x0E5E,
+            0x0E5F, 0x0E60, 0x0E61, 0x0E62, 0x0E63, 0x0E64, 0x0E65, 0x0E66, 0x0E67, 0x0E68, 0x0E69, 0x0E6A, 0x0E6B, 0x0E6C, 0x0E6D, 0x0E6E,
+            0x0E6F, 0x0E70, 0x0E71, 0x0E72, 0x0E73, 0x0E74, 0x0E75, 0x0E76, 0x0E77, 0x0E78, 0x0E79, 0x0E7A, 0x0E7B, 0x0E7C, 0x0E7D, 0x0E7E,
+            0x0E7F, 0x0E80, 0x0E81, 0x0E82, 0x0E83, 0x0E84, 0x0E85, 0x0E86, 0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8B, 0x0E8C, 0x0E8D, 0x0E8E,
+            0x0E8F, 0x0E90, 0x0E91, 0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96, 0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B, 0x0E9C, 0x0E9D, 0x0E9E,
+            0x0E9F, 0x0EA0, 0x0EA1, 0x0EA2, 0x0EA3, 0x0EA4, 0x0EA5, 0x0EA6, 0x0EA7, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAD, 0x0EAE,
+            0x0EAF, 0x0EB0, 0x0EB1, 0x0EB2, 0x0EB3, 0x0EB4, 0x0EB5, 0x0EB6, 0x0EB7, 0x0EB8, 0x0EB9, 0x0EBA, 0x0EBB, 0x0EBC, 0x0EBD, 0x0EBE,
+            0x0EBF, 0x0EC0, 0x0EC1, 0x0EC2, 0x0EC3, 0x0EC4, 0x0EC5, 0x0EC6, 0x0EC7, 0x0EC8, 0x0EC9, 0x0ECA, 0x0ECB, 0x0ECC, 0x0ECD, 0x0ECE,
+        },
+        {
+            0x0ECF, 0x0ED0, 0x0ED1, 0x0ED2, 0x0ED3, 0x0ED4, 0x0ED5, 0x0ED6, 0x0ED7, 0x0ED8, 0x0ED9, 0x0EDA, 0x0EDB, 0x0EDC, 0x0EDD, 0x0EDE,
+            0x0EDF, 0x0EE0, 0x0EE1, 0x0EE2, 0x0EE3, 0x0EE4, 0x0EE5, 0x0EE6, 0x0EE7, 0x0EE8, 0x0EE9, 0x0EEA, 0x0EEB, 0x0EEC, 0x0EED, 0x0EEE,
+            0x0EEF, 0x0EF0, 0x0EF1, 0x0EF2, 0x0EF3, 0x0EF4, 0x0EF5, 0x0EF6, 0x0EF7, 0x0EF8, 0x0EF9, 0x0EFA, 0x0EFB, 0x0EFC, 0x0EFD, 0x0EFE,
+            0x0EFF, 0x0F00, 0x0F01, 0x0F02, 0x0F03, 0x0F04, 0x0F05, 0x0F06, 0x0F07, 0x0F08, 0x0F09, 0x0F0A, 0x0F0B, 0x0F0C, 0x0F0D, 0x0000,
+            0x0000, 0x0000, 0x0F0E, 0x0F0F, 0x0F10, 0x0F11, 0x0F12, 0x0F13, 0x0000, 0x0000, 0x0F14, 0x0F15, 0x0F16, 0x0F17, 0x0F18, 0x0F19,
+            0x0000, 0x0000, 0x0F1A, 0x0F1B, 0x0F1C, 0x0F1D, 0x0F1E, 0x0F1F, 0x0000, 0x0000, 0x0F20, 0x0F21, 0x0F22, 0x0000, 0x0000, 0x0000,
+            0x0F23, 0x0F24, 0x0F25, 0x0F26, 0x0F27, 0x0F28, 0x0F29, 0x0000, 0x0F2A, 0x0F2B, 0x0F2C, 0x0F2D, 0x0F2E, 0x0F2F, 0x0F30, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0F31, 0x0F32, 0x0F33, 0x0F34, 0x0F35, 0x0000, 0x0F36, 0x0F37, 0x0F38, 0x0F39, 0x0F3A, 0x0F3B, 0x0F3C, 0x0F3D, 0x0F3E,
+            0x0F3F, 0x0F40, 0x0F41, 0x0F42, 0x0F43, 0x0F44, 0x0F45, 0x0F46, 0x0F47, 0x0F48, 0x0F49, 0x0F4A, 0x0F4B, 0x0F4C, 0x0F4D, 0x0F4E,
+            0x0F4F, 0x0F50, 0x0F51, 0x0F52, 0x0F53, 0x0F54, 0x0F55, 0x0F56, 0x0F57, 0x0F58, 0x0F59, 0x0F5A, 0x0F5B, 0x0F5C, 0x0F5D, 0x0F5E,
+            0x0F5F, 0x0000, 0x0F60, 0x0F61, 0x0F62, 0x0F63, 0x0F64, 0x0F65, 0x0F66, 0x0F67, 0x0F68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F69, 0x0000, 0x0F6A, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F6B, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F6C, 0x0F6D,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F6E, 0x0F6F, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F70, 0x0F71, 0x0000, 0x0F72, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F73, 0x0F74, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F76, 0x0F77,
+            0x0F78, 0x0F79, 0x0F7A, 0x0F7B, 0x0F7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F7D, 0x0F7E, 0x0F7F, 0x0F80, 0x0F81,
+            0x0F82, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0F83, 0x0F84, 0x0F85, 0x0F86, 0x0F87, 0x0F88, 0x0F89, 0x0F8A, 0x0F8B, 0x0F8C, 0x0F8D, 0x0F8E, 0x0F8F, 0x0F90, 0x0F91, 0x0F92,
+            0x0F93, 0x0F94, 0x0F95, 0x0F96, 0x0F97, 0x0F98, 0x0F99, 0x0F9A, 0x0F9B, 0x0F9C, 0x0F9D, 0x0F9E, 0x0F9F, 0x0FA0, 0x0FA1, 0x0FA2,
+            0x0FA3, 0x0FA4, 0x0FA5, 0x0FA6, 0x0FA7, 0x0FA8, 0x0FA9, 0x0FAA, 0x0FAB, 0x0FAC, 0x0FAD, 0x0FAE, 0x0FAF, 0x0FB0, 0x0FB1, 0x0FB2,
+            0x0FB3, 0x0FB4, 0x0FB5, 0x0FB6, 0x0FB7, 0x0FB8, 0x0FB9, 0x0FBA, 0x0FBB, 0x0FBC, 0x0FBD, 0x0FBE, 0x0FBF, 0x0FC0, 0x0FC1, 0x0FC2,
+            0x0FC3, 0x0FC4, 0x0FC5, 0x0FC6, 0x0FC7, 0x0FC8, 0x0FC9, 0x0FCA, 0x0FCB, 0x0FCC, 0x0FCD, 0x0FCE, 0x0FCF, 0x0FD0, 0x0FD1, 0x0FD2,
+            0x0FD3, 0x0FD4, 0x0FD5, 0x0FD6, 0x0FD7, 0x0000, 0x0FD8, 0x0FD9, 0x0FDA, 0x0FDB, 0x0FDC, 0x0FDD, 0x0FDE, 0x0FDF, 0x0FE0, 0x0FE1,
+            0x0FE2, 0x0FE3, 0x0FE4, 0x0FE5, 0x0FE6, 0x0FE7, 0x0FE8, 0x0FE9, 0x0FEA, 0x0FEB, 0x0FEC, 0x0FED, 0x0FEE, 0x0FEF, 0x0FF0, 0x0FF1,
+            0x0FF2, 0x0FF3, 0x0FF4, 0x0FF5, 0x0FF6, 0x0FF7, 0x0FF8, 0x0FF9, 0x0FFA, 0x0FFB, 0x0FFC, 0x0FFD, 0x0FFE, 0x0FFF, 0x1000, 0x1001,
+        },
+        {
+            0x1002, 0x1003, 0x1004, 0x1005, 0x1006, 0x1007, 0x1008, 0x1009, 0x100A, 0x100B, 0x100C, 0x100D, 0x100E, 0x100F, 0x1010, 0x1011,
+            0x1012, 0x1013, 0x1014, 0x1015, 0x1016, 0x1017, 0x1018, 0x1019, 0x101A, 0x101B, 0x101C, 0x101D, 0x101E, 0x0000, 0x101F, 0x1020,
+            0x0000, 0x0000, 0x1021, 0x0000, 0x0000, 0x1022, 0x1023, 0x0000, 0x0000, 0x1024, 0x1025, 0x1026, 0x1027, 0x0000, 0x1028, 0x1029,
+            0x102A, 0x102B, 0x102C, 0x102D, 0x102E, 0x102F, 0x1030, 0x1031, 0x1032, 0x1033, 0x0000, 0x1034, 0x0000, 0x1035, 0x1036, 0x1037,
+            0x1038, 0x1039, 0x103A, 0x103B, 0x0000, 0x103C, 0x103D, 0x103E, 0x103F, 0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045, 0x1046,
+            0x1047, 0x1048, 0x1049, 0x104A, 0x104B, 0x104C, 0x104D, 0x104E, 0x104F, 0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055, 0x1056,
+            0x1057, 0x1058, 0x1059, 0x105A, 0x105B, 0x105C, 0x105D, 0x105E, 0x105F, 0x1060, 0x1061, 0x1062, 0x1063, 0x1064, 0x1065, 0x1066,
+            0x1067, 0x1068, 0x1069, 0x106A, 0x106B, 0x106C, 0x106D, 0x106E, 0x106F, 0x1070, 0x1071, 0x1072, 0x1073, 0x1074, 0x1075, 0x1076,
+        },
+        {
+            0x1077, 0x1078, 0x1079, 0x107A, 0x107B, 0x107C, 0x0000, 0x107D, 0x107E, 0x107F, 0x1080, 0x0000, 0x0000, 0x1081, 0x1082, 0x1083,
+            0x1084, 0x1085, 0x1086, 0x1087, 0x1088, 0x0000, 0x1089, 0x108A, 0x108B, 0x108C, 0x108D, 0x108E, 0x108F, 0x0000, 0x1090, 0x1091,
+            0x1092, 0x1093, 0x1094, 0x1095, 0x1096, 0x1097, 0x1098, 0x1099, 0x109A, 0x109B, 0x109C, 0x109D, 0x109E, 0x109F, 0x10A0, 0x10A1,
+            0x10A2, 0x10A3, 0x10A4, 0x10A5, 0x10A6, 0x10A7, 0x10A8, 0x10A9, 0x10AA, 0x10AB, 0x0000, 0x10AC, 0x10AD, 0x10AE, 0x10AF, 0x0000,
+            0x10B0, 0x10B1, 0x10B2, 0x10B3, 0x10B4, 0x0000, 0x10B5, 0x0000, 0x0000, 0x0000, 0x10B6, 0x10B7, 0x10B8, 0x10B9, 0x10BA, 0x10BB,
+            0x10BC, 0x0000, 0x10BD, 0x10BE, 0x10BF, 0x10C0, 0x10C1, 0x10C2, 0x10C3, 0x10C4, 0x10C5, 0x10C6, 0x10C7, 0x10C8, 0x10C9, 0x10CA,
+            0x10CB, 0x10CC, 0x10CD, 0x10CE, 0x10CF, 0x10D0, 0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8, 0x10D9, 0x10DA,
+            0x10DB, 0x10DC, 0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1, 0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8, 0x10E9, 0x10EA,
+        },
+        {
+            0x10EB, 0x10EC, 0x10ED, 0x10EE, 0x10EF, 0x10F0, 0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F7, 0x10F8, 0x10F9, 0x10FA,
+            0x10FB, 0x10FC, 0x10FD, 0x10FE, 0x10FF, 0x1100, 0x1101, 0x1102, 0x1103, 0x1104, 0x1105, 0x1106, 0x1107, 0x1108, 0x1109, 0x110A,
+            0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1113, 0x1114, 0x1115, 0x1116, 0x1117, 0x1118, 0x1119, 0x111A,
+            0x111B, 0x111C, 0x111D, 0x111E, 0x111F, 0x1120, 0x1121, 0x1122, 0x1123, 0x1124, 0x1125, 0x1126, 0x1127, 0x1128, 0x1129, 0x112A,
+            0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1130, 0x1131, 0x1132, 0x1133, 0x1134, 0x1135, 0x1136, 0x1137, 0x1138, 0x1139, 0x113A,
+            0x113B, 0x113C, 0x113D, 0x113E, 0x113F, 0x1140, 0x1141, 0x1142, 0x1143, 0x1144, 0x1145, 0x1146, 0x1147, 0x1148, 0x1149, 0x114A,
+            0x114B, 0x114C, 0x114D, 0x114E, 0x114F, 0x1150, 0x1151, 0x1152, 0x1153, 0x1154, 0x1155, 0x1156, 0x1157, 0x1158, 0x1159, 0x115A,
+            0x115B, 0x115C, 0x115D, 0x115E, 0x115F, 0x1160, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A,
+        },
+        {
+            0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1176, 0x1177, 0x1178, 0x1179, 0x117A,
+            0x117B, 0x117C, 0x117D, 0x117E, 0x117F, 0x1180, 0x1181, 0x1182, 0x1183, 0x1184, 0x1185, 0x1186, 0x1187, 0x1188, 0x1189, 0x118A,
+            0x118B, 0x118C, 0x118D, 0x118E, 0x118F, 0x1190, 0x1191, 0x1192, 0x1193, 0x1194, 0x1195, 0x1196, 0x1197, 0x1198, 0x1199, 0x119A,
+            0x119B, 0x119C, 0x119D, 0x119E, 0x119F, 0x11A0, 0x11A1, 0x11A2, 0x11A3, 0x11A4, 0x11A5, 0x11A6, 0x11A7, 0x11A8, 0x11A9, 0x11AA,
+            0x11AB, 0x11AC, 0x11AD, 0x11AE, 0x11AF, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x11B6, 0x11B7, 0x11B8, 0x11B9, 0x11BA,
+            0x11BB, 0x11BC, 0x11BD, 0x11BE, 0x11BF, 0x11C0, 0x11C1, 0x11C2, 0x11C3, 0x11C4, 0x11C5, 0x11C6, 0x11C7, 0x11C8, 0x11C9, 0x11CA,
+            0x11CB, 0x11CC, 0x11CD, 0x11CE, 0x11CF, 0x11D0, 0x11D1, 0x11D2, 0x11D3, 0x11D4, 0x11D5, 0x11D6, 0x11D7, 0x11D8, 0x11D9, 0x11DA,
+            0x11DB, 0x11DC, 0x11DD, 0x11DE, 0x11DF, 0x11E0, 0x11E1, 0x11E2, 0x11E3, 0x11E4, 0x11E5, 0x11E6, 0x11E7, 0x11E8, 0x11E9, 0x11EA,
+        },
+        {
+            0x11EB, 0x11EC, 0x11ED, 0x11EE, 0x11EF, 0x11F0, 0x11F1, 0x11F2, 0x11F3, 0x11F4, 0x11F5, 0x11F6, 0x11F7, 0x11F8, 0x11F9, 0x11FA,
+            0x11FB, 0x11FC, 0x11FD, 0x11FE, 0x11FF, 0x1200, 0x1201, 0x1202, 0x1203, 0x1204, 0x1205, 0x1206, 0x1207, 0x1208, 0x1209, 0x120A,
+            0x120B, 0x120C, 0x120D, 0x120E, 0x120F, 0x1210, 0x0000, 0x0000, 0x1211, 0x1212, 0x1213, 0x1214, 0x1215, 0x1216, 0x1217, 0x1218,
+            0x1219, 0x121A, 0x121B, 0x121C, 0x121D, 0x121E, 0x121F, 0x1220, 0x1221, 0x1222, 0x1223, 0x1224, 0x1225, 0x1226, 0x1227, 0x1228,
+            0x1229, 0x122A, 0x122B, 0x122C, 0x122D, 0x122E, 0x122F, 0x1230, 0x1231, 0x1232, 0x1233, 0x1234, 0x1235, 0x1236, 0x1237, 0x1238,
+            0x1239, 0x123A, 0x123B, 0x123C, 0x123D, 0x123E, 0x123F, 0x1240, 0x1241, 0x1242, 0x1243, 0x1244, 0x1245, 0x1246, 0x1247, 0x1248,
+            0x1249, 0x124A, 0x124B, 0x124C, 0x124D, 0x124E, 0x124F, 0x1250, 0x1251, 0x1252, 0x1253, 0x1254, 0x1255, 0x1256, 0x1257, 0x1258,
+            0x1259, 0x125A, 0x125B, 0x125C, 0x125D, 0x125E, 0x125F, 0x1260, 0x1261, 0x1262, 0x1263, 0x1264, 0x1265, 0x1266, 0x1267, 0x1268,
+        },
+        {
+            0x1269, 0x126A, 0x126B, 0x126C, 0x126D, 0x126E, 0x126F, 0x1270, 0x1271, 0x1272, 0x1273, 0x1274, 0x1275, 0x1276, 0x1277, 0x1278,
+            0x1279, 0x127A, 0x127B, 0x127C, 0x127D, 0x127E, 0x127F, 0x1280, 0x1281, 0x1282, 0x1283, 0x1284, 0x1285, 0x1286, 0x1287, 0x1288,
+            0x1289, 0x128A, 0x128B, 0x128C, 0x128D, 0x128E, 0x128F, 0x1290, 0x1291, 0x1292, 0x1293, 0x1294, 0x1295, 0x1296, 0x1297, 0x1298,
+            0x1299, 0x129A, 0x129B, 0x129C, 0x129D, 0x129E, 0x129F, 0x12A0, 0x12A1, 0x12A2, 0x12A3, 0x12A4, 0x12A5, 0x12A6, 0x12A7, 0x12A8,
+            0x12A9, 0x12AA, 0x12AB, 0x12AC, 0x12AD, 0x12AE, 0x12AF, 0x12B0, 0x12B1, 0x12B2, 0x12B3, 0x12B4, 0x12B5, 0x12B6, 0x12B7, 0x12B8,
+            0x12B9, 0x12BA, 0x12BB, 0x12BC, 0x12BD, 0x12BE, 0x12BF, 0x12C0, 0x12C1, 0x12C2, 0x12C3, 0x12C4, 0x12C5, 0x12C6, 0x12C7, 0x12C8,
+            0x12C9, 0x12CA, 0x12CB, 0x12CC, 0x12CD, 0x12CE, 0x12CF, 0x12D0, 0x12D1, 0x12D2, 0x12D3, 0x12D4, 0x12D5, 0x12D6, 0x12D7, 0x12D8,
+            0x12D9, 0x12DA, 0x12DB, 0x12DC, 0x12DD, 0x12DE, 0x12DF, 0x12E0, 0x12E1, 0x12E2, 0x12E3, 0x12E4, 0x12E5, 0x12E6, 0x12E7, 0x12E8,
+        },
+        {
+            0x12E9, 0x12EA, 0x12EB, 0x12EC, 0x12ED, 0x12EE, 0x12EF, 0x12F0, 0x12F1, 0x12F2, 0x12F3, 0x12F4, 0x12F5, 0x12F6, 0x12F7, 0x12F8,
+            0x12F9, 0x12FA, 0x12FB, 0x12FC, 0x12FD, 0x12FE, 0x12FF, 0x1300, 0x1301, 0x1302, 0x1303, 0x1304, 0x1305, 0x1306, 0x1307, 0x1308,
+            0x1309, 0x130A, 0x130B, 0x130C, 0x130D, 0x130E, 0x130F, 0x1310, 0x1311, 0x1312, 0x1313, 0x1314, 0x1315, 0x1316, 0x1317, 0x1318,
+            0x1319, 0x131A, 0x131B, 0x131C, 0x131D, 0x131E, 0x131F, 0x1320, 0x1321, 0x1322, 0x1323, 0x1324, 0x1325, 0x1326, 0x1327, 0x1328,
+            0x1329, 0x132A, 0x132B, 0x132C, 0x132D, 0x132E, 0x132F, 0x1330, 0x1331, 0x1332, 0x1333, 0x1334, 0x0000, 0x0000, 0x1335, 0x1336,
+            0x1337, 0x1338, 0x1339, 0x133A, 0x133B, 0x133C, 0x133D, 0x133E, 0x133F, 0x1340, 0x1341, 0x1342, 0x1343, 0x1344, 0x1345, 0x1346,
+            0x1347, 0x1348, 0x1349, 0x134A, 0x134B, 0x134C, 0x134D, 0x134E, 0x134F, 0x1350, 0x1351, 0x1352, 0x1353, 0x1354, 0x1355, 0x1356,
+            0x1357, 0x1358, 0x1359, 0x135A, 0x135B, 0x135C, 0x135D, 0x135E, 0x135F, 0x1360, 0x1361, 0x1362, 0x1363, 0x1364, 0x1365, 0x1366,
+        },
+        {
+            0x1367, 0x1368, 0x1369, 0x136A, 0x0000, 0x136B, 0x136C, 0x136D, 0x136E, 0x136F, 0x1370, 0x1371, 0x1372, 0x1373, 0x1374, 0x1375,
+            0x1376, 0x1377, 0x1378, 0x1379, 0x137A, 0x137B, 0x137C, 0x137D, 0x137E, 0x137F, 0x1380, 0x1381, 0x1382, 0x1383, 0x1384, 0x1385,
+            0x0000, 0x1386, 0x1387, 0x0000, 0x1388, 0x0000, 0x0000, 0x1389, 0x0000, 0x138A, 0x138B, 0x138C, 0x138D, 0x138E, 0x138F, 0x1390,
+            0x1391, 0x1392, 0x1393, 0x0000, 0x1394, 0x1395, 0x1396, 0x1397, 0x0000, 0x1398, 0x0000, 0x1399, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x139A, 0x0000, 0x0000, 0x0000, 0x0000, 0x139B, 0x0000, 0x139C, 0x0000, 0x139D, 0x0000, 0x139E, 0x139F, 0x13A0,
+            0x0000, 0x13A1, 0x13A2, 0x0000, 0x13A3, 0x0000, 0x0000, 0x13A4, 0x0000, 0x13A5, 0x0000, 0x13A6, 0x0000, 0x13A7, 0x0000, 0x13A8,
+            0x0000, 0x13A9, 0x13AA, 0x0000, 0x13AB, 0x0000, 0x0000, 0x13AC, 0x13AD, 0x13AE, 0x13AF, 0x0000, 0x13B0, 0x13B1, 0x13B2, 0x13B3,
+            0x13B4, 0x13B5, 0x13B6, 0x0000, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x0000, 0x13BB, 0x13BC, 0x13BD, 0x13BE, 0x0000, 0x13BF, 0x0000,
+        },
+        {
+            0x13C0, 0x13C1, 0x13C2, 0x13C3, 0x13C4, 0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x0000, 0x13CA, 0x13CB, 0x13CC, 0x13CD, 0x13CE,
+            0x13CF, 0x13D0, 0x13D1, 0x13D2, 0x13D3, 0x13D4, 0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x13DB, 0x13DC, 0x13DD, 0x0000, 0x13DE, 0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x0000, 0x13E3, 0x13E4, 0x13E5, 0x13E6, 0x13E7,
+            0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC, 0x13ED, 0x13EE, 0x13EF, 0x13F0, 0x13F1, 0x13F2, 0x13F3, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x13F4, 0x13F5, 0x13F6, 0x13F7, 0x13F8, 0x13F9, 0x13FA, 0x13FB, 0x13FC, 0x13FD, 0x13FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x13FF, 0x1400, 0x1401, 0x1402, 0x1403, 0x1404, 0x1405, 0x1406, 0x1407, 0x1408, 0x1409, 0x140A, 0x140B, 0x140C, 0x140D, 0x140E,
+            0x140F, 0x1410, 0x1411, 0x1412, 0x1413, 0x1414, 0x1415, 0x1416, 0x1417, 0x1418, 0x1419, 0x141A, 0x141B, 0x141C, 0x141D, 0x0000,
+            0x141E, 0x141F, 0x1420, 0x1421, 0x1422, 0x1423, 0x1424, 0x1425, 0x1426, 0x1427, 0x1428, 0x1429, 0x142A, 0x142B, 0x142C, 0x142D,
+            0x142E, 0x142F, 0x1430, 0x1431, 0x1432, 0x1433, 0x1434, 0x1435, 0x1436, 0x1437, 0x1438, 0x1439, 0x143A, 0x143B, 0x143C, 0x143D,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x143E, 0x143F, 0x1440, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x1441, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x1442, 0x1443, 0x1444, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x1445, 0x1446, 0x1447, 0x1448, 0x1449, 0x144A, 0x144B, 0x144C, 0x144D, 0x144E, 0x144F, 0x1450, 0x1451, 0x1452, 0x1453, 0x1454,
+            0x1455, 0x1456, 0x1457, 0x1458, 0x1459, 0x145A, 0x145B, 0x145C, 0x145D, 0x145E, 0x145F, 0x1460, 0x1461, 0x1462, 0x1463, 0x1464,
+            0x1465, 0x1466, 0x1467, 0x1468, 0x1469, 0x146A, 0x146B, 0x146C, 0x146D, 0x146E, 0x146F, 0x1470, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x1471, 0x1472, 0x1473, 0x1474, 0x1475, 0x1476, 0x1477, 0x1478, 0x1479, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x147A, 0x147B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x147C, 0x147D, 0x147E, 0x147F, 0x1480, 0x1481, 0x1482, 0x1483, 0x1484, 0x1485, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+        {
+            0x1486, 0x1487, 0x1488, 0x1489, 0x148A, 0x148B, 0x148C, 0x148D, 0x148E, 0x148F, 0x1490, 0x1491, 0x1492, 0x1493, 0x1494, 0x1495,
+            0x1496, 0x1497, 0x1498, 0x1499, 0x149A, 0x149B, 0x149C, 0x149D, 0x149E, 0x149F, 0x14A0, 0x14A1, 0x14A2, 0x14A3, 0x14A4, 0x14A5,
+            0x14A6, 0x14A7, 0x14A8, 0x14A9, 0x14AA, 0x14AB, 0x14AC, 0x14AD, 0x14AE, 0x14AF, 0x14B0, 0x14B1, 0x14B2, 0x14B3, 0x14B4, 0x14B5,
+            0x14B6, 0x14B7, 0x14B8, 0x14B9, 0x14BA, 0x14BB, 0x14BC, 0x14BD, 0x14BE, 0x14BF, 0x14C0, 0x14C1, 0x14C2, 0x14C3, 0x14C4, 0x14C5,
+            0x14C6, 0x14C7, 0x14C8, 0x14C9, 0x14CA, 0x14CB, 0x14CC, 0x14CD, 0x14CE, 0x14CF, 0x14D0, 0x14D1, 0x14D2, 0x14D3, 0x14D4, 0x14D5,
+            0x14D6, 0x14D7, 0x14D8, 0x14D9, 0x14DA, 0x14DB, 0x14DC, 0x14DD, 0x14DE, 0x14DF, 0x14E0, 0x14E1, 0x14E2, 0x14E3, 0x14E4, 0x14E5,
+            0x14E6, 0x14E7, 0x14E8, 0x14E9, 0x14EA, 0x14EB, 0x14EC, 0x14ED, 0x14EE, 0x14EF, 0x14F0, 0x14F1, 0x14F2, 0x14F3, 0x14F4, 0x14F5,
+            0x14F6, 0x14F7, 0x14F8, 0x14F9, 0x14FA, 0x14FB, 0x14FC, 0x14FD, 0x14FE, 0x14FF, 0x1500, 0x1501, 0x1502, 0x1503, 0x1504, 0x1505,
+        },
+        {
+            0x1506, 0x1507, 0x1508, 0x1509, 0x150A, 0x150B, 0x150C, 0x150D, 0x150E, 0x150F, 0x1510, 0x1511, 0x1512, 0x1513, 0x1514, 0x1515,
+            0x1516, 0x1517, 0x1518, 0x1519, 0x151A, 0x151B, 0x151C, 0x151D, 0x151E, 0x151F, 0x1520, 0x1521, 0x1522, 0x1523, 0x1524, 0x1525,
+            0x1526, 0x1527, 0x1528, 0x1529, 0x152A, 0x152B, 0x152C, 0x152D, 0x152E, 0x152F, 0x1530, 0x1531, 0x1532, 0x1533, 0x1534, 0x1535,
+            0x1536, 0x1537, 0x1538, 0x1539, 0x153A, 0x153B, 0x153C, 0x153D, 0x153E, 0x153F, 0x1540, 0x1541, 0x1542, 0x1543, 0x1544, 0x1545,
+            0x1546, 0x1547, 0x1548, 0x1549, 0x154A, 0x154B, 0x154C, 0x154D, 0x154E, 0x154F, 0x1550, 0x1551, 0x1552, 0x1553, 0x1554, 0x1555,
+            0x1556, 0x1557, 0x1558, 0x1559, 0x155A, 0x155B, 0x155C, 0x155D, 0x155E, 0x155F, 0x1560, 0x1561, 0x1562, 0x1563, 0x1564, 0x1565,
+            0x1566, 0x1567, 0x1568, 0x1569, 0x156A, 0x156B, 0x156C, 0x156D, 0x156E, 0x156F, 0x1570, 0x1571, 0x1572, 0x1573, 0x1574, 0x1575,
+            0x1576, 0x1577, 0x1578, 0x1579, 0x157A, 0x157B, 0x157C, 0x157D, 0x157E, 0x157F, 0x1580, 0x1581, 0x1582, 0x1583, 0x1584, 0x1585,
+        },
+        {
+            0x1586, 0x1587, 0x1588, 0x1589, 0x158A, 0x158B, 0x158C, 0x158D, 0x158E, 0x158F, 0x1590, 0x1591, 0x1592, 0x1593, 0x1594, 0x1595,
+            0x1596, 0x1597, 0x1598, 0x1599, 0x159A, 0x159B, 0x159C, 0x159D, 0x159E, 0x159F, 0x15A0, 0x15A1, 0x15A2, 0x15A3, 0x15A4, 0x15A5,
+            0x15A6, 0x15A7, 0x15A8, 0x15A9, 0x15AA, 0x15AB, 0x15AC, 0x15AD, 0x15AE, 0x15AF, 0x15B0, 0x15B1, 0x15B2, 0x15B3, 0x15B4, 0x15B5,
+            0x15B6, 0x15B7, 0x15B8, 0x15B9, 0x15BA, 0x15BB, 0x15BC, 0x15BD, 0x15BE, 0x15BF, 0x15C0, 0x15C1, 0x15C2, 0x15C3, 0x15C4, 0x15C5,
+            0x15C6, 0x15C7, 0x15C8, 0x15C9, 0x15CA, 0x15CB, 0x15CC, 0x15CD, 0x15CE, 0x15CF, 0x15D0, 0x15D1, 0x15D2, 0x15D3, 0x15D4, 0x15D5,
+            0x15D6, 0x15D7, 0x15D8, 0x15D9, 0x15DA, 0x15DB, 0x15DC, 0x15DD, 0x15DE, 0x15DF, 0x15E0, 0x15E1, 0x15E2, 0x15E3, 0x15E4, 0x15E5,
+            0x15E6, 0x15E7, 0x15E8, 0x15E9, 0x15EA, 0x15EB, 0x15EC, 0x15ED, 0x15EE, 0x15EF, 0x15F0, 0x15F1, 0x15F2, 0x15F3, 0x15F4, 0x15F5,
+            0x15F6, 0x15F7, 0x15F8, 0x15F9, 0x15FA, 0x15FB, 0x15FC, 0x15FD, 0x15FE, 0x15FF, 0x1600, 0x1601, 0x1602, 0x1603, 0x1604, 0x1605,
+        },
+        {
+            0x1606, 0x1607, 0x1608, 0x1609, 0x160A, 0x160B, 0x160C, 0x160D, 0x160E, 0x160F, 0x1610, 0x1611, 0x1612, 0x1613, 0x1614, 0x1615,
+            0x1616, 0x1617, 0x1618, 0x1619, 0x161A, 0x161B, 0x161C, 0x161D, 0x161E, 0x161F, 0x1620, 0x1621, 0x1622, 0x1623, 0x1624, 0x1625,
+            0x1626, 0x1627, 0x1628, 0x1629, 0x162A, 0x162B, 0x162C, 0x162D, 0x162E, 0x162F, 0x1630, 0x1631, 0x1632, 0x1633, 0x1634, 0x1635,
+            0x1636, 0x1637, 0x1638, 0x1639, 0x163A, 0x163B, 0x163C, 0x163D, 0x163E, 0x163F, 0x1640, 0x1641, 0x1642, 0x1643, 0x1644, 0x1645,
+            0x1646, 0x1647, 0x1648, 0x1649, 0x164A, 0x164B, 0x164C, 0x164D, 0x164E, 0x164F, 0x1650, 0x1651, 0x1652, 0x1653, 0x1654, 0x1655,
+            0x1656, 0x1657, 0x1658, 0x1659, 0x165A, 0x165B, 0x165C, 0x165D, 0x165E, 0x165F, 0x1660, 0x1661, 0x1662, 0x1663, 0x1664, 0x1665,
+            0x1666, 0x1667, 0x1668, 0x1669, 0x166A, 0x166B, 0x166C, 0x166D, 0x166E, 0x166F, 0x1670, 0x1671, 0x1672, 0x1673, 0x1674, 0x1675,
+            0x1676, 0x1677, 0x1678, 0x1679, 0x167A, 0x167B, 0x167C, 0x167D, 0x167E, 0x167F, 0x1680, 0x1681, 0x1682, 0x1683, 0x1684, 0x1685,
+        },
+        {
+            0x1686, 0x1687, 0x1688, 0x1689, 0x168A, 0x168B, 0x168C, 0x168D, 0x168E, 0x168F, 0x1690, 0x1691, 0x1692, 0x1693, 0x1694, 0x1695,
+            0x1696, 0x1697, 0x1698, 0x1699, 0x169A, 0x169B, 0x169C, 0x169D, 0x169E, 0x169F, 0x16A0, 0x16A1, 0x16A2, 0x16A3, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        },
+    };
+
+    // The full canonical decomposition, if any, followed by the full compatibility
+    // decomposition, in `decomposition_bytes`.
+    struct Decomposition{ uint16_t offset; Byte n_canonical_bytes; Byte n_compatibility_bytes; };
+
+    inline constexpr Decomposition decompositions[5796] =
+    {
+        { 0x0000, 0, 0 },
+        { 0x0000, 0, 1 },
+        { 0x0001, 0, 3 },
+        { 0x0004, 0, 1 },
+        { 0x0005, 0, 3 },
+        { 0x0008, 0, 1 },
+        { 0x0009, 0, 1 },
+        { 0x000A, 0, 3 },
+        { 0x000D, 0, 2 },
+        { 0x000F, 0, 3 },
+        { 0x0012, 0, 1 },
+        { 0x0013, 0, 1 },
+        { 0x0014, 0, 5 },
+        { 0x0019, 0, 5 },
+        { 0x001E, 0, 5 },
+        { 0x0023, 3, 3 },
+        { 0x0029, 3, 3 },
+        { 0x002F, 3, 3 },
+        { 0x0035, 3, 3 },
+        { 0x003B, 3, 3 },
+        { 0x0041, 3, 3 },
+        { 0x0047, 3, 3 },
+        { 0x004D, 3, 3 },
+        { 0x0053, 3, 3 },
+        { 0x0059, 3, 3 },
+        { 0x005F, 3, 3 },
+        { 0x0065, 3, 3 },
+        { 0x006B, 3, 3 },
+        { 0x0071, 3, 3 },
+        { 0x0077, 3, 3 },
+        { 0x007D, 3, 3 },
+        { 0x0083, 3, 3 },
+        { 0x0089, 3, 3 },
+        { 0x008F, 3, 3 },
+        { 0x0095, 3, 3 },
+        { 0x009B, 3, 3 },
+        { 0x00A1, 3, 3 },
+        { 0x00A7, 3, 3 },
+        { 0x00AD, 3, 3 },
+        { 0x00B3, 3, 3 },
+        { 0x00B9, 3, 3 },
+        { 0x00BF, 3, 3 },
+        { 0x00C5, 3, 3 },
+        { 0x00CB, 3, 3 },
+        { 0x00D1, 3, 3 },
+        { 0x00D7, 3, 3 },
+        { 0x00DD, 3, 3 },
+        { 0x00E3, 3, 3 },
+        { 0x00E9, 3, 3 },
+        { 0x00EF, 3, 3 },
+        { 0x00F5, 3, 3 },
+        { 0x00FB, 3, 3 },
+        { 0x0101, 3, 3 },
+        { 0x0107, 3, 3 },
+        { 0x010D, 3, 3 },
+        { 0x0113, 3, 3 },
+        { 0x0119, 3, 3 },
+        { 0x011F, 3, 3 },
+        { 0x0125, 3, 3 },
+        { 0x012B, 3, 3 },
+        { 0x0131, 3, 3 },
+        { 0x0137, 3, 3 },
+        { 0x013D, 3, 3 },
+        { 0x0143, 3, 3 },
+        { 0x0149, 3, 3 },
+        { 0x014F, 3, 3 },
+        { 0x0155, 3, 3 },
+        { 0x015B, 3, 3 },
+        { 0x0161, 3, 3 },
+        { 0x0167, 3, 3 },
+        { 0x016D, 3, 3 },
+        { 0x0173, 3, 3 },
+        { 0x0179, 3, 3 },
+        { 0x017F, 3, 3 },
+        { 0x0185, 3, 3 },
+        { 0x018B, 3, 3 },
+        { 0x0191, 3, 3 },
+        { 0x0197, 3, 3 },
+        { 0x019D, 3, 3 },
+        { 0x01A3, 3, 3 },
+        { 0x01A9, 3, 3 },
+        { 0x01AF, 3, 3 },
+        { 0x01B5, 3, 3 },
+        { 0x01BB, 3, 3 },
+        { 0x01C1, 3, 3 },
+        { 0x01C7, 3, 3 },
+        { 0x01CD, 3, 3 },
+        { 0x01D3, 3, 3 },
+        { 0x01D9, 3, 3 },
+        { 0x01DF, 3, 3 },
+        { 0x01E5, 3, 3 },
+        { 0x01EB, 3, 3 },
+        { 0x01F1, 3, 3 },
+        { 0x01F7, 3, 3 },
+        { 0x01FD, 3, 3 },
+        { 0x0203, 3, 3 },
+        { 0x0209, 3, 3 },
+        { 0x020F, 3, 3 },
+        { 0x0215, 3, 3 },
+        { 0x021B, 3, 3 },
+        { 0x0221, 3, 3 },
+        { 0x0227, 3, 3 },
+        { 0x022D, 3, 3 },
+        { 0x0233, 3, 3 },
+        { 0x0239, 3, 3 },
+        { 0x023F, 3, 3 },
+        { 0x0245, 3, 3 },
+        { 0x024B, 3, 3 },
+        { 0x0251, 3, 3 },
+        { 0x0257, 3, 3 },
+        { 0x025D, 3, 3 },
+        { 0x0263, 3, 3 },
+        { 0x0269, 3, 3 },
+        { 0x026F, 0, 2 },
+        { 0x0271, 0, 2 },
+        { 0x0273, 3, 3 },
+        { 0x0279, 3, 3 },
+        { 0x027F, 3, 3 },
+        { 0x0285, 3, 3 },
+        { 0x028B, 3, 3 },
+        { 0x0291, 3, 3 },
+        { 0x0297, 3, 3 },
+        { 0x029D, 3, 3 },
+        { 0x02A3, 3, 3 },
+        { 0x02A9, 3, 3 },
+        { 0x02AF, 0, 3 },
+        { 0x02B2, 0, 3 },
+        { 0x02B5, 3, 3 },
+        { 0x02BB, 3, 3 },
+        { 0x02C1, 3, 3 },
+        { 0x02C7, 3, 3 },
+        { 0x02CD, 3, 3 },
+        { 0x02D3, 3, 3 },
+        { 0x02D9, 0, 3 },
+        { 0x02DC, 3, 3 },
+        { 0x02E2, 3, 3 },
+        { 0x02E8, 3, 3 },
+        { 0x02EE, 3, 3 },
+        { 0x02F4, 3, 3 },
+        { 0x02FA, 3, 3 },
+        { 0x0300, 3, 3 },
+        { 0x0306, 3, 3 },
+        { 0x030C, 3, 3 },
+        { 0x0312, 3, 3 },
+        { 0x0318, 3, 3 },
+        { 0x031E, 3, 3 },
+        { 0x0324, 3, 3 },
+        { 0x032A, 3, 3 },
+        { 0x0330, 3, 3 },
+        { 0x0336, 3, 3 },
+        { 0x033C, 3, 3 },
+        { 0x0342, 3, 3 },
+        { 0x0348, 3, 3 },
+        { 0x034E, 3, 3 },
+        { 0x0354, 3, 3 },
+        { 0x035A, 3, 3 },
+        { 0x0360, 3, 3 },
+        { 0x0366, 3, 3 },
+        { 0x036C, 3, 3 },
+        { 0x0372, 3, 3 },
+        { 0x0378, 3, 3 },
+        { 0x037E, 3, 3 },
+        { 0x0384, 3, 3 },
+        { 0x038A, 3, 3 },
+        { 0x0390, 3, 3 },
+        { 0x0396, 3, 3 },
+        { 0x039C, 3, 3 },
+        { 0x03A2, 3, 3 },
+        { 0x03A8, 3, 3 },
+        { 0x03AE, 3, 3 },
+        { 0x03B4, 3, 3 },
+        { 0x03BA, 3, 3 },
+        { 0x03C0, 3, 3 },
+        { 0x03C6, 3, 3 },
+        { 0x03CC, 3, 3 },
+        { 0x03D2, 3, 3 },
+        { 0x03D8, 3, 3 },
+        { 0x03DE, 3, 3 },
+        { 0x03E4, 3, 3 },
+        { 0x03EA, 3, 3 },
+        { 0x03F0, 3, 3 },
+        { 0x03F6, 0, 1 },
+        { 0x03F7, 3, 3 },
+        { 0x03FD, 3, 3 },
+        { 0x0403, 3, 3 },
+        { 0x0409, 3, 3 },
+        { 0x040F, 0, 4 },
+        { 0x0413, 0, 4 },
+        { 0x0417, 0, 4 },
+        { 0x041B, 0, 2 },
+        { 0x041D, 0, 2 },
+        { 0x041F, 0, 2 },
+        { 0x0421, 0, 2 },
+        { 0x0423, 0, 2 },
+        { 0x0425, 0, 2 },
+        { 0x0427, 3, 3 },
+        { 0x042D, 3, 3 },
+        { 0x0433, 3, 3 },
+        { 0x0439, 3, 3 },
+        { 0x043F, 3, 3 },
+        { 0x0445, 3, 3 },
+        { 0x044B, 3, 3 },
+        { 0x0451, 3, 3 },
+        { 0x0457, 5, 5 },
+        { 0x0461, 5, 5 },
+        { 0x046B, 5, 5 },
+        { 0x0475, 5, 5 },
+        { 0x047F, 5, 5 },
+        { 0x0489, 5, 5 },
+        { 0x0493, 5, 5 },
+        { 0x049D, 5, 5 },
+        { 0x04A7, 5, 5 },
+        { 0x04B1, 5, 5 },
+        { 0x04BB, 5, 5 },
+        { 0x04C5, 5, 5 },
+        { 0x04CF, 4, 4 },
+        { 0x04D7, 4, 4 },
+        { 0x04DF, 3, 3 },
+        { 0x04E5, 3, 3 },
+        { 0x04EB, 3, 3 },
+        { 0x04F1, 3, 3 },
+        { 0x04F7, 3, 3 },
+        { 0x04FD, 3, 3 },
+        { 0x0503, 5, 5 },
+        { 0x050D, 5, 5 },
+        { 0x0517, 4, 4 },
+        { 0x051F, 4, 4 },
+        { 0x0527, 3, 3 },
+        { 0x052D, 0, 2 },
+        { 0x052F, 0, 2 },
+        { 0x0531, 0, 2 },
+        { 0x0533, 3, 3 },
+        { 0x0539, 3, 3 },
+        { 0x053F, 3, 3 },
+        { 0x0545, 3, 3 },
+        { 0x054B, 5, 5 },
+        { 0x0555, 5, 5 },
+        { 0x055F, 4, 4 },
+        { 0x0567, 4, 4 },
+        { 0x056F, 4, 4 },
+        { 0x0577, 4, 4 },
+        { 0x057F, 3, 3 },
+        { 0x0585, 3, 3 },
+        { 0x058B, 3, 3 },
+        { 0x0591, 3, 3 },
+        { 0x0597, 3, 3 },
+        { 0x059D, 3, 3 },
+        { 0x05A3, 3, 3 },
+        { 0x05A9, 3, 3 },
+        { 0x05AF, 3, 3 },
+        { 0x05B5, 3, 3 },
+        { 0x05BB, 3, 3 },
+        { 0x05C1, 3, 3 },
+        { 0x05C7, 3, 3 },
+        { 0x05CD, 3, 3 },
+        { 0x05D3, 3, 3 },
+        { 0x05D9, 3, 3 },
+        { 0x05DF, 3, 3 },
+        { 0x05E5, 3, 3 },
+        { 0x05EB, 3, 3 },
+        { 0x05F1, 3, 3 },
+        { 0x05F7, 3, 3 },
+        { 0x05FD, 3, 3 },
+        { 0x0603, 3, 3 },
+        { 0x0609, 3, 3 },
+        { 0x060F, 3, 3 },
+        { 0x0615, 3, 3 },
+        { 0x061B, 3, 3 },
+        { 0x0621, 3, 3 },
+        { 0x0627, 3, 3 },
+        { 0x062D, 3, 3 },
+        { 0x0633, 3, 3 },
+        { 0x0639, 3, 3 },
+        { 0x063F, 3, 3 },
+        { 0x0645, 3, 3 },
+        { 0x064B, 5, 5 },
+        { 0x0655, 5, 5 },
+        { 0x065F, 5, 5 },
+        { 0x0669, 5, 5 },
+        { 0x0673, 3, 3 },
+        { 0x0679, 3, 3 },
+        { 0x067F, 5, 5 },
+        { 0x0689, 5, 5 },
+        { 0x0693, 3, 3 },
+        { 0x0699, 3, 3 },
+        { 0x069F, 0, 1 },
+        { 0x06A0, 0, 2 },
+        { 0x06A2, 0, 1 },
+        { 0x06A3, 0, 1 },
+        { 0x06A4, 0, 2 },
+        { 0x06A6, 0, 2 },
+        { 0x06A8, 0, 2 },
+        { 0x06AA, 0, 1 },
+        { 0x06AB, 0, 1 },
+        { 0x06AC, 0, 3 },
+        { 0x06AF, 0, 3 },
+        { 0x06B2, 0, 3 },
+        { 0x06B5, 0, 3 },
+        { 0x06B8, 0, 3 },
+        { 0x06BB, 0, 3 },
+        { 0x06BE, 0, 2 },
+        { 0x06C0, 0, 1 },
+        { 0x06C1, 0, 1 },
+        { 0x06C2, 0, 1 },
+        { 0x06C3, 0, 2 },
+        { 0x06C5, 2, 2 },
+        { 0x06C9, 2, 2 },
+        { 0x06CD, 2, 2 },
+        { 0x06D1, 4, 4 },
+        { 0x06D9, 2, 2 },
+        { 0x06DD, 0, 3 },
+        { 0x06E0, 1, 1 },
+        { 0x06E2, 0, 3 },
+        { 0x06E5, 4, 5 },
+        { 0x06EE, 4, 4 },
+        { 0x06F6, 2, 2 },
+        { 0x06FA, 4, 4 },
+        { 0x0702, 4, 4 },
+        { 0x070A, 4, 4 },
+        { 0x0712, 4, 4 },
+        { 0x071A, 4, 4 },
+        { 0x0722, 4, 4 },
+        { 0x072A, 6, 6 },
+        { 0x0736, 4, 4 },
+        { 0x073E, 4, 4 },
+        { 0x0746, 4, 4 },
+        { 0x074E, 4, 4 },
+        { 0x0756, 4, 4 },
+        { 0x075E, 4, 4 },
+        { 0x0766, 6, 6 },
+        { 0x0772, 4, 4 },
+        { 0x077A, 4, 4 },
+        { 0x0782, 4, 4 },
+        { 0x078A, 4, 4 },
+        { 0x0792, 4, 4 },
+        { 0x079A, 0, 2 },
+        { 0x079C, 0, 2 },
+        { 0x079E, 0, 2 },
+        { 0x07A0, 4, 4 },
+        { 0x07A8, 4, 4 },
+        { 0x07B0, 0, 2 },
+        { 0x07B2, 0, 2 },
+        { 0x07B4, 0, 2 },
+        { 0x07B6, 0, 2 },
+        { 0x07B8, 0, 2 },
+        { 0x07BA, 0, 2 },
+        { 0x07BC, 0, 2 },
+        { 0x07BE, 0, 2 },
+        { 0x07C0, 4, 4 },
+        { 0x07C8, 4, 4 },
+        { 0x07D0, 4, 4 },
+        { 0x07D8, 4, 4 },
+        { 0x07E0, 4, 4 },
+        { 0x07E8, 4, 4 },
+        { 0x07F0, 4, 4 },
+        { 0x07F8, 4, 4 },
+        { 0x0800, 4, 4 },
+        { 0x0808, 4, 4 },
+        { 0x0810, 4, 4 },
+        { 0x0818, 4, 4 },
+        { 0x0820, 4, 4 },
+        { 0x0828, 4, 4 },
+        { 0x0830, 4, 4 },
+        { 0x0838, 4, 4 },
+        { 0x0840, 4, 4 },
+        { 0x0848, 4, 4 },
+        { 0x0850, 4, 4 },
+        { 0x0858, 4, 4 },
+        { 0x0860, 4, 4 },
+        { 0x0868, 4, 4 },
+        { 0x0870, 4, 4 },
+        { 0x0878, 4, 4 },
+        { 0x0880, 4, 4 },
+        { 0x0888, 4, 4 },
+        { 0x0890, 4, 4 },
+        { 0x0898, 4, 4 },
+        { 0x08A0, 4, 4 },
+        { 0x08A8, 4, 4 },
+        { 0x08B0, 4, 4 },
+        { 0x08B8, 4, 4 },
+        { 0x08C0, 4, 4 },
+        { 0x08C8, 4, 4 },
+        { 0x08D0, 4, 4 },
+        { 0x08D8, 4, 4 },
+        { 0x08E0, 4, 4 },
+        { 0x08E8, 4, 4 },
+        { 0x08F0, 4, 4 },
+        { 0x08F8, 4, 4 },
+        { 0x0900, 4, 4 },
+        { 0x0908, 4, 4 },
+        { 0x0910, 4, 4 },
+        { 0x0918, 4, 4 },
+        { 0x0920, 4, 4 },
+        { 0x0928, 4, 4 },
+        { 0x0930, 4, 4 },
+        { 0x0938, 4, 4 },
+        { 0x0940, 4, 4 },
+        { 0x0948, 4, 4 },
+        { 0x0950, 4, 4 },
+        { 0x0958, 4, 4 },
+        { 0x0960, 0, 4 },
+        { 0x0964, 4, 4 },
+        { 0x096C, 4, 4 },
+        { 0x0974, 4, 4 },
+        { 0x097C, 4, 4 },
+        { 0x0984, 4, 4 },
+        { 0x098C, 0, 4 },
+        { 0x0990, 0, 4 },
+        { 0x0994, 0, 4 },
+        { 0x0998, 0, 4 },
+        { 0x099C, 4, 4 },
+        { 0x09A4, 4, 4 },
+        { 0x09AC, 4, 4 },
+        { 0x09B4, 6, 6 },
+        { 0x09C0, 6, 6 },
+        { 0x09CC, 6, 6 },
+        { 0x09D8, 6, 6 },
+        { 0x09E4, 6, 6 },
+        { 0x09F0, 6, 6 },
+        { 0x09FC, 6, 6 },
+        { 0x0A08, 6, 6 },
+        { 0x0A14, 6, 6 },
+        { 0x0A20, 6, 6 },
+        { 0x0A2C, 6, 6 },
+        { 0x0A38, 6, 6 },
+        { 0x0A44, 6, 6 },
+        { 0x0A50, 6, 6 },
+        { 0x0A5C, 6, 6 },
+        { 0x0A68, 6, 6 },
+        { 0x0A74, 6, 6 },
+        { 0x0A80, 6, 6 },
+        { 0x0A8C, 6, 6 },
+        { 0x0A98, 6, 6 },
+        { 0x0AA4, 6, 6 },
+        { 0x0AB0, 6, 6 },
+        { 0x0ABC, 6, 6 },
+        { 0x0AC8, 6, 6 },
+        { 0x0AD4, 6, 6 },
+        { 0x0AE0, 6, 6 },
+        { 0x0AEC, 6, 6 },
+        { 0x0AF8, 6, 6 },
+        { 0x0B04, 6, 6 },
+        { 0x0B10, 6, 6 },
+        { 0x0B1C, 6, 6 },
+        { 0x0B28, 6, 6 },
+        { 0x0B34, 6, 6 },
+        { 0x0B40, 6, 6 },
+        { 0x0B4C, 6, 6 },
+        { 0x0B58, 6, 6 },
+        { 0x0B64, 9, 9 },
+        { 0x0B76, 6, 6 },
+        { 0x0B82, 6, 6 },
+        { 0x0B8E, 6, 6 },
+        { 0x0B9A, 6, 6 },
+        { 0x0BA6, 6, 6 },
+        { 0x0BB2, 9, 9 },
+        { 0x0BC4, 6, 6 },
+        { 0x0BD0, 0, 6 },
+        { 0x0BD6, 0, 6 },
+        { 0x0BDC, 0, 6 },
+        { 0x0BE2, 0, 6 },
+        { 0x0BE8, 0, 3 },
+        { 0x0BEB, 6, 6 },
+        { 0x0BF7, 6, 6 },
+        { 0x0C03, 6, 6 },
+        { 0x0C0F, 6, 6 },
+        { 0x0C1B, 6, 6 },
+        { 0x0C27, 6, 6 },
+        { 0x0C33, 6, 6 },
+        { 0x0C3F, 6, 6 },
+        { 0x0C4B, 6, 6 },
+        { 0x0C57, 0, 9 },
+        { 0x0C60, 6, 6 },
+        { 0x0C6C, 0, 9 },
+        { 0x0C75, 6, 6 },
+        { 0x0C81, 6, 6 },
+        { 0x0C8D, 6, 6 },
+        { 0x0C99, 6, 6 },
+        { 0x0CA5, 6, 6 },
+        { 0x0CB1, 6, 6 },
+        { 0x0CBD, 6, 6 },
+        { 0x0CC9, 6, 6 },
+        { 0x0CD5, 0, 3 },
+        { 0x0CD8, 6, 6 },
+        { 0x0CE4, 6, 6 },
+        { 0x0CF0, 6, 6 },
+        { 0x0CFC, 6, 6 },
+        { 0x0D08, 6, 6 },
+        { 0x0D14, 6, 6 },
+        { 0x0D20, 6, 6 },
+        { 0x0D2C, 6, 6 },
+        { 0x0D38, 6, 6 },
+        { 0x0D44, 6, 6 },
+        { 0x0D50, 6, 6 },
+        { 0x0D5C, 0, 1 },
+        { 0x0D5D, 0, 2 },
+        { 0x0D5F, 0, 1 },
+        { 0x0D60, 0, 1 },
+        { 0x0D61, 0, 1 },
+        { 0x0D62, 0, 2 },
+        { 0x0D64, 0, 1 },
+        { 0x0D65, 0, 1 },
+        { 0x0D66, 0, 1 },
+        { 0x0D67, 0, 1 },
+        { 0x0D68, 0, 1 },
+        { 0x0D69, 0, 1 },
+        { 0x0D6A, 0, 1 },
+        { 0x0D6B, 0, 1 },
+        { 0x0D6C, 0, 1 },
+        { 0x0D6D, 0, 2 },
+        { 0x0D6F, 0, 1 },
+        { 0x0D70, 0, 1 },
+        { 0x0D71, 0, 1 },
+        { 0x0D72, 0, 1 },
+        { 0x0D73, 0, 1 },
+        { 0x0D74, 0, 1 },
+        { 0x0D75, 0, 2 },
+        { 0x0D77, 0, 2 },
+        { 0x0D79, 0, 3 },
+        { 0x0D7C, 0, 1 },
+        { 0x0D7D, 0, 1 },
+        { 0x0D7E, 0, 1 },
+        { 0x0D7F, 0, 2 },
+        { 0x0D81, 0, 2 },
+        { 0x0D83, 0, 2 },
+        { 0x0D85, 0, 1 },
+        { 0x0D86, 0, 1 },
+        { 0x0D87, 0, 1 },
+        { 0x0D88, 0, 2 },
+        { 0x0D8A, 0, 1 },
+        { 0x0D8B, 0, 2 },
+        { 0x0D8D, 0, 3 },
+        { 0x0D90, 0, 3 },
+        { 0x0D93, 0, 1 },
+        { 0x0D94, 0, 1 },
+        { 0x0D95, 0, 1 },
+        { 0x0D96, 0, 3 },
+        { 0x0D99, 0, 2 },
+        { 0x0D9B, 0, 1 },
+        { 0x0D9C, 0, 3 },
+        { 0x0D9F, 0, 2 },
+        { 0x0DA1, 0, 2 },
+        { 0x0DA3, 0, 2 },
+        { 0x0DA5, 0, 2 },
+        { 0x0DA7, 0, 2 },
+        { 0x0DA9, 0, 1 },
+        { 0x0DAA, 0, 1 },
+        { 0x0DAB, 0, 1 },
+        { 0x0DAC, 0, 1 },
+        { 0x0DAD, 0, 2 },
+        { 0x0DAF, 0, 2 },
+        { 0x0DB1, 0, 2 },
+        { 0x0DB3, 0, 2 },
+        { 0x0DB5, 0, 2 },
+        { 0x0DB7, 0, 2 },
+        { 0x0DB9, 0, 2 },
+        { 0x0DBB, 0, 1 },
+        { 0x0DBC, 0, 2 },
+        { 0x0DBE, 0, 2 },
+        { 0x0DC0, 0, 2 },
+        { 0x0DC2, 0, 1 },
+        { 0x0DC3, 0, 2 },
+        { 0x0DC5, 0, 2 },
+        { 0x0DC7, 0, 2 },
+        { 0x0DC9, 0, 2 },
+        { 0x0DCB, 0, 2 },
+        { 0x0DCD, 0, 2 },
+        { 0x0DCF, 0, 3 },
+        { 0x0DD2, 0, 2 },
+        { 0x0DD4, 0, 2 },
+        { 0x0DD6, 0, 3 },
+        { 0x0DD9, 0, 2 },
+        { 0x0DDB, 0, 2 },
+        { 0x0DDD, 0, 2 },
+        { 0x0DDF, 0, 2 },
+        { 0x0DE1, 0, 2 },
+        { 0x0DE3, 0, 2 },
+        { 0x0DE5, 0, 2 },
+        { 0x0DE7, 0, 2 },
+        { 0x0DE9, 0, 2 },
+        { 0x0DEB, 0, 2 },
+        { 0x0DED, 0, 2 },
+        { 0x0DEF, 0, 2 },
+        { 0x0DF1, 0, 2 },
+        { 0x0DF3, 0, 3 },
+        { 0x0DF6, 0, 2 },
+        { 0x0DF8, 0, 2 },
+        { 0x0DFA, 0, 1 },
+        { 0x0DFB, 0, 2 },
+        { 0x0DFD, 0, 2 },
+        { 0x0DFF, 0, 2 },
+        { 0x0E01, 0, 2 },
+        { 0x0E03, 3, 3 },
+        { 0x0E09, 3, 3 },
+        { 0x0E0F, 3, 3 },
+        { 0x0E15, 3, 3 },
+        { 0x0E1B, 3, 3 },
+        { 0x0E21, 3, 3 },
+        { 0x0E27, 3, 3 },
+        { 0x0E2D, 3, 3 },
+        { 0x0E33, 5, 5 },
+        { 0x0E3D, 5, 5 },
+        { 0x0E47, 3, 3 },
+        { 0x0E4D, 3, 3 },
+        { 0x0E53, 3, 3 },
+        { 0x0E59, 3, 3 },
+        { 0x0E5F, 3, 3 },
+        { 0x0E65, 3, 3 },
+        { 0x0E6B, 3, 3 },
+        { 0x0E71, 3, 3 },
+        { 0x0E77, 3, 3 },
+        { 0x0E7D, 3, 3 },
+        { 0x0E83, 5, 5 },
+        { 0x0E8D, 5, 5 },
+        { 0x0E97, 5, 5 },
+        { 0x0EA1, 5, 5 },
+        { 0x0EAB, 3, 3 },
+        { 0x0EB1, 3, 3 },
+        { 0x0EB7, 3, 3 },
+        { 0x0EBD, 3, 3 },
+        { 0x0EC3, 5, 5 },
+        { 0x0ECD, 5, 5 },
+        { 0x0ED7, 3, 3 },
+        { 0x0EDD, 3, 3 },
+        { 0x0EE3, 3, 3 },
+        { 0x0EE9, 3, 3 },
+        { 0x0EEF, 3, 3 },
+        { 0x0EF5, 3, 3 },
+        { 0x0EFB, 3, 3 },
+        { 0x0F01, 3, 3 },
+        { 0x0F07, 3, 3 },
+        { 0x0F0D, 3, 3 },
+        { 0x0F13, 3, 3 },
+        { 0x0F19, 3, 3 },
+        { 0x0F1F, 3, 3 },
+        { 0x0F25, 3, 3 },
+        { 0x0F2B, 3, 3 },
+        { 0x0F31, 3, 3 },
+        { 0x0F37, 5, 5 },
+        { 0x0F41, 5, 5 },
+        { 0x0F4B, 3, 3 },
+        { 0x0F51, 3, 3 },
+        { 0x0F57, 3, 3 },
+        { 0x0F5D, 3, 3 },
+        { 0x0F63, 3, 3 },
+        { 0x0F69, 3, 3 },
+        { 0x0F6F, 3, 3 },
+        { 0x0F75, 3, 3 },
+        { 0x0F7B, 5, 5 },
+        { 0x0F85, 5, 5 },
+        { 0x0F8F, 3, 3 },
+        { 0x0F95, 3, 3 },
+        { 0x0F9B, 3, 3 },
+        { 0x0FA1, 3, 3 },
+        { 0x0FA7, 3, 3 },
+        { 0x0FAD, 3, 3 },
+        { 0x0FB3, 3, 3 },
+        { 0x0FB9, 3, 3 },
+        { 0x0FBF, 3, 3 },
+        { 0x0FC5, 3, 3 },
+        { 0x0FCB, 3, 3 },
+        { 0x0FD1, 3, 3 },
+        { 0x0FD7, 3, 3 },
+        { 0x0FDD, 3, 3 },
+        { 0x0FE3, 3, 3 },
+        { 0x0FE9, 3, 3 },
+        { 0x0FEF, 3, 3 },
+        { 0x0FF5, 3, 3 },
+        { 0x0FFB, 5, 5 },
+        { 0x1005, 5, 5 },
+        { 0x100F, 5, 5 },
+        { 0x1019, 5, 5 },
+        { 0x1023, 5, 5 },
+        { 0x102D, 5, 5 },
+        { 0x1037, 5, 5 },
+        { 0x1041, 5, 5 },
+        { 0x104B, 3, 3 },
+        { 0x1051, 3, 3 },
+        { 0x1057, 3, 3 },
+        { 0x105D, 3, 3 },
+        { 0x1063, 3, 3 },
+        { 0x1069, 3, 3 },
+        { 0x106F, 3, 3 },
+        { 0x1075, 3, 3 },
+        { 0x107B, 5, 5 },
+        { 0x1085, 5, 5 },
+        { 0x108F, 3, 3 },
+        { 0x1095, 3, 3 },
+        { 0x109B, 3, 3 },
+        { 0x10A1, 3, 3 },
+        { 0x10A7, 3, 3 },
+        { 0x10AD, 3, 3 },
+        { 0x10B3, 5, 5 },
+        { 0x10BD, 5, 5 },
+        { 0x10C7, 5, 5 },
+        { 0x10D1, 5, 5 },
+        { 0x10DB, 5, 5 },
+        { 0x10E5, 5, 5 },
+        { 0x10EF, 3, 3 },
+        { 0x10F5, 3, 3 },
+        { 0x10FB, 3, 3 },
+        { 0x1101, 3, 3 },
+        { 0x1107, 3, 3 },
+        { 0x110D, 3, 3 },
+        { 0x1113, 3, 3 },
+        { 0x1119, 3, 3 },
+        { 0x111F, 3, 3 },
+        { 0x1125, 3, 3 },
+        { 0x112B, 3, 3 },
+        { 0x1131, 3, 3 },
+        { 0x1137, 3, 3 },
+        { 0x113D, 3, 3 },
+        { 0x1143, 5, 5 },
+        { 0x114D, 5, 5 },
+        { 0x1157, 5, 5 },
+        { 0x1161, 5, 5 },
+        { 0x116B, 3, 3 },
+        { 0x1171, 3, 3 },
+        { 0x1177, 3, 3 },
+        { 0x117D, 3, 3 },
+        { 0x1183, 3, 3 },
+        { 0x1189, 3, 3 },
+        { 0x118F, 3, 3 },
+        { 0x1195, 3, 3 },
+        { 0x119B, 3, 3 },
+        { 0x11A1, 3, 3 },
+        { 0x11A7, 3, 3 },
+        { 0x11AD, 3, 3 },
+        { 0x11B3, 3, 3 },
+        { 0x11B9, 3, 3 },
+        { 0x11BF, 3, 3 },
+        { 0x11C5, 3, 3 },
+        { 0x11CB, 3, 3 },
+        { 0x11D1, 3, 3 },
+        { 0x11D7, 3, 3 },
+        { 0x11DD, 3, 3 },
+        { 0x11E3, 3, 3 },
+        { 0x11E9, 3, 3 },
+        { 0x11EF, 3, 3 },
+        { 0x11F5, 3, 3 },
+        { 0x11FB, 3, 3 },
+        { 0x1201, 3, 3 },
+        { 0x1207, 3, 3 },
+        { 0x120D, 3, 3 },
+        { 0x1213, 3, 3 },
+        { 0x1219, 3, 3 },
+        { 0x121F, 0, 3 },
+        { 0x1222, 4, 3 },
+        { 0x1229, 3, 3 },
+        { 0x122F, 3, 3 },
+        { 0x1235, 3, 3 },
+        { 0x123B, 3, 3 },
+        { 0x1241, 5, 5 },
+        { 0x124B, 5, 5 },
+        { 0x1255, 5, 5 },
+        { 0x125F, 5, 5 },
+        { 0x1269, 5, 5 },
+        { 0x1273, 5, 5 },
+        { 0x127D, 5, 5 },
+        { 0x1287, 5, 5 },
+        { 0x1291, 5, 5 },
+        { 0x129B, 5, 5 },
+        { 0x12A5, 5, 5 },
+        { 0x12AF, 5, 5 },
+        { 0x12B9, 5, 5 },
+        { 0x12C3, 5, 5 },
+        { 0x12CD, 5, 5 },
+        { 0x12D7, 5, 5 },
+        { 0x12E1, 5, 5 },
+        { 0x12EB, 5, 5 },
+        { 0x12F5, 5, 5 },
+        { 0x12FF, 5, 5 },
+        { 0x1309, 3, 3 },
+        { 0x130F, 3, 3 },
+        { 0x1315, 3, 3 },
+        { 0x131B, 3, 3 },
+        { 0x1321, 3, 3 },
+        { 0x1327, 3, 3 },
+        { 0x132D, 5, 5 },
+        { 0x1337, 5, 5 },
+        { 0x1341, 5, 5 },
+        { 0x134B, 5, 5 },
+        { 0x1355, 5, 5 },
+        { 0x135F, 5, 5 },
+        { 0x1369, 5, 5 },
+        { 0x1373, 5, 5 },
+        { 0x137D, 5, 5 },
+        { 0x1387, 5, 5 },
+        { 0x1391, 3, 3 },
+        { 0x1397, 3, 3 },
+        { 0x139D, 3, 3 },
+        { 0x13A3, 3, 3 },
+        { 0x13A9, 3, 3 },
+        { 0x13AF, 3, 3 },
+        { 0x13B5, 3, 3 },
+        { 0x13BB, 3, 3 },
+        { 0x13C1, 5, 5 },
+        { 0x13CB, 5, 5 },
+        { 0x13D5, 5, 5 },
+        { 0x13DF, 5, 5 },
+        { 0x13E9, 5, 5 },
+        { 0x13F3, 5, 5 },
+        { 0x13FD, 5, 5 },
+        { 0x1407, 5, 5 },
+        { 0x1411, 5, 5 },
+        { 0x141B, 5, 5 },
+        { 0x1425, 5, 5 },
+        { 0x142F, 5, 5 },
+        { 0x1439, 5, 5 },
+        { 0x1443, 5, 5 },
+        { 0x144D, 5, 5 },
+        { 0x1457, 5, 5 },
+        { 0x1461, 5, 5 },
+        { 0x146B, 5, 5 },
+        { 0x1475, 5, 5 },
+        { 0x147F, 5, 5 },
+        { 0x1489, 3, 3 },
+        { 0x148F, 3, 3 },
+        { 0x1495, 3, 3 },
+        { 0x149B, 3, 3 },
+        { 0x14A1, 5, 5 },
+        { 0x14AB, 5, 5 },
+        { 0x14B5, 5, 5 },
+        { 0x14BF, 5, 5 },
+        { 0x14C9, 5, 5 },
+        { 0x14D3, 5, 5 },
+        { 0x14DD, 5, 5 },
+        { 0x14E7, 5, 5 },
+        { 0x14F1, 5, 5 },
+        { 0x14FB, 5, 5 },
+        { 0x1505, 3, 3 },
+        { 0x150B, 3, 3 },
+        { 0x1511, 3, 3 },
+        { 0x1517, 3, 3 },
+        { 0x151D, 3, 3 },
+        { 0x1523, 3, 3 },
+        { 0x1529, 3, 3 },
+        { 0x152F, 3, 3 },
+        { 0x1535, 4, 4 },
+        { 0x153D, 4, 4 },
+        { 0x1545, 6, 6 },
+        { 0x1551, 6, 6 },
+        { 0x155D, 6, 6 },
+        { 0x1569, 6, 6 },
+        { 0x1575, 6, 6 },
+        { 0x1581, 6, 6 },
+        { 0x158D, 4, 4 },
+        { 0x1595, 4, 4 },
+        { 0x159D, 6, 6 },
+        { 0x15A9, 6, 6 },
+        { 0x15B5, 6, 6 },
+        { 0x15C1, 6, 6 },
+        { 0x15CD, 6, 6 },
+        { 0x15D9, 6, 6 },
+        { 0x15E5, 4, 4 },
+        { 0x15ED, 4, 4 },
+        { 0x15F5, 6, 6 },
+        { 0x1601, 6, 6 },
+        { 0x160D, 6, 6 },
+        { 0x1619, 6, 6 },
+        { 0x1625, 4, 4 },
+        { 0x162D, 4, 4 },
+        { 0x1635, 6, 6 },
+        { 0x1641, 6, 6 },
+        { 0x164D, 6, 6 },
+        { 0x1659, 6, 6 },
+        { 0x1665, 4, 4 },
+        { 0x166D, 4, 4 },
+        { 0x1675, 6, 6 },
+        { 0x1681, 6, 6 },
+        { 0x168D, 6, 6 },
+        { 0x1699, 6, 6 },
+        { 0x16A5, 6, 6 },
+        { 0x16B1, 6, 6 },
+        { 0x16BD, 4, 4 },
+        { 0x16C5, 4, 4 },
+        { 0x16CD, 6, 6 },
+        { 0x16D9, 6, 6 },
+        { 0x16E5, 6, 6 },
+        { 0x16F1, 6, 6 },
+        { 0x16FD, 6, 6 },
+        { 0x1709, 6, 6 },
+        { 0x1715, 4, 4 },
+        { 0x171D, 4, 4 },
+        { 0x1725, 6, 6 },
+        { 0x1731, 6, 6 },
+        { 0x173D, 6, 6 },
+        { 0x1749, 6, 6 },
+        { 0x1755, 6, 6 },
+        { 0x1761, 6, 6 },
+        { 0x176D, 4, 4 },
+        { 0x1775, 4, 4 },
+        { 0x177D, 6, 6 },
+        { 0x1789, 6, 6 },
+        { 0x1795, 6, 6 },
+        { 0x17A1, 6, 6 },
+        { 0x17AD, 6, 6 },
+        { 0x17B9, 6, 6 },
+        { 0x17C5, 4, 4 },
+        { 0x17CD, 4, 4 },
+        { 0x17D5, 6, 6 },
+        { 0x17E1, 6, 6 },
+        { 0x17ED, 6, 6 },
+        { 0x17F9, 6, 6 },
+        { 0x1805, 4, 4 },
+        { 0x180D, 4, 4 },
+        { 0x1815, 6, 6 },
+        { 0x1821, 6, 6 },
+        { 0x182D, 6, 6 },
+        { 0x1839, 6, 6 },
+        { 0x1845, 4, 4 },
+        { 0x184D, 4, 4 },
+        { 0x1855, 6, 6 },
+        { 0x1861, 6, 6 },
+        { 0x186D, 6, 6 },
+        { 0x1879, 6, 6 },
+        { 0x1885, 6, 6 },
+        { 0x1891, 6, 6 },
+        { 0x189D, 4, 4 },
+        { 0x18A5, 6, 6 },
+        { 0x18B1, 6, 6 },
+        { 0x18BD, 6, 6 },
+        { 0x18C9, 4, 4 },
+        { 0x18D1, 4, 4 },
+        { 0x18D9, 6, 6 },
+        { 0x18E5, 6, 6 },
+        { 0x18F1, 6, 6 },
+        { 0x18FD, 6, 6 },
+        { 0x1909, 6, 6 },
+        { 0x1915, 6, 6 },
+        { 0x1921, 4, 4 },
+        { 0x1929, 4, 4 },
+        { 0x1931, 6, 6 },
+        { 0x193D, 6, 6 },
+        { 0x1949, 6, 6 },
+        { 0x1955, 6, 6 },
+        { 0x1961, 6, 6 },
+        { 0x196D, 6, 6 },
+        { 0x1979, 4, 4 },
+        { 0x1981, 4, 4 },
+        { 0x1989, 4, 4 },
+        { 0x1991, 4, 4 },
+        { 0x1999, 4, 4 },
+        { 0x19A1, 4, 4 },
+        { 0x19A9, 4, 4 },
+        { 0x19B1, 4, 4 },
+        { 0x19B9, 4, 4 },
+        { 0x19C1, 4, 4 },
+        { 0x19C9, 4, 4 },
+        { 0x19D1, 4, 4 },
+        { 0x19D9, 4, 4 },
+        { 0x19E1, 4, 4 },
+        { 0x19E9, 6, 6 },
+        { 0x19F5, 6, 6 },
+        { 0x1A01, 8, 8 },
+        { 0x1A11, 8, 8 },
+        { 0x1A21, 8, 8 },
+        { 0x1A31, 8, 8 },
+        { 0x1A41, 8, 8 },
+        { 0x1A51, 8, 8 },
+        { 0x1A61, 6, 6 },
+        { 0x1A6D, 6, 6 },
+        { 0x1A79, 8, 8 },
+        { 0x1A89, 8, 8 },
+        { 0x1A99, 8, 8 },
+        { 0x1AA9, 8, 8 },
+        { 0x1AB9, 8, 8 },
+        { 0x1AC9, 8, 8 },
+        { 0x1AD9, 6, 6 },
+        { 0x1AE5, 6, 6 },
+        { 0x1AF1, 8, 8 },
+        { 0x1B01, 8, 8 },
+        { 0x1B11, 8, 8 },
+        { 0x1B21, 8, 8 },
+        { 0x1B31, 8, 8 },
+        { 0x1B41, 8, 8 },
+        { 0x1B51, 6, 6 },
+        { 0x1B5D, 6, 6 },
+        { 0x1B69, 8, 8 },
+        { 0x1B79, 8, 8 },
+        { 0x1B89, 8, 8 },
+        { 0x1B99, 8, 8 },
+        { 0x1BA9, 8, 8 },
+        { 0x1BB9, 8, 8 },
+        { 0x1BC9, 6, 6 },
+        { 0x1BD5, 6, 6 },
+        { 0x1BE1, 8, 8 },
+        { 0x1BF1, 8, 8 },
+        { 0x1C01, 8, 8 },
+        { 0x1C11, 8, 8 },
+        { 0x1C21, 8, 8 },
+        { 0x1C31, 8, 8 },
+        { 0x1C41, 6, 6 },
+        { 0x1C4D, 6, 6 },
+        { 0x1C59, 8, 8 },
+        { 0x1C69, 8, 8 },
+        { 0x1C79, 8, 8 },
+        { 0x1C89, 8, 8 },
+        { 0x1C99, 8, 8 },
+        { 0x1CA9, 8, 8 },
+        { 0x1CB9, 4, 4 },
+        { 0x1CC1, 4, 4 },
+        { 0x1CC9, 6, 6 },
+        { 0x1CD5, 4, 4 },
+        { 0x1CDD, 6, 6 },
+        { 0x1CE9, 4, 4 },
+        { 0x1CF1, 6, 6 },
+        { 0x1CFD, 4, 4 },
+        { 0x1D05, 4, 4 },
+        { 0x1D0D, 4, 4 },
+        { 0x1D15, 4, 4 },
+        { 0x1D1D, 4, 4 },
+        { 0x1D25, 0, 3 },
+        { 0x1D28, 2, 2 },
+        { 0x1D2C, 0, 3 },
+        { 0x1D2F, 0, 3 },
+        { 0x1D32, 4, 5 },
+        { 0x1D3B, 6, 6 },
+        { 0x1D47, 4, 4 },
+        { 0x1D4F, 6, 6 },
+        { 0x1D5B, 4, 4 },
+        { 0x1D63, 6, 6 },
+        { 0x1D6F, 4, 4 },
+        { 0x1D77, 4, 4 },
+        { 0x1D7F, 4, 4 },
+        { 0x1D87, 4, 4 },
+        { 0x1D8F, 4, 4 },
+        { 0x1D97, 5, 5 },
+        { 0x1DA1, 5, 5 },
+        { 0x1DAB, 5, 5 },
+        { 0x1DB5, 4, 4 },
+        { 0x1DBD, 4, 4 },
+        { 0x1DC5, 6, 6 },
+        { 0x1DD1, 6, 6 },
+        { 0x1DDD, 4, 4 },
+        { 0x1DE5, 6, 6 },
+        { 0x1DF1, 4, 4 },
+        { 0x1DF9, 4, 4 },
+        { 0x1E01, 4, 4 },
+        { 0x1E09, 4, 4 },
+        { 0x1E11, 5, 5 },
+        { 0x1E1B, 5, 5 },
+        { 0x1E25, 5, 5 },
+        { 0x1E2F, 4, 4 },
+        { 0x1E37, 4, 4 },
+        { 0x1E3F, 6, 6 },
+        { 0x1E4B, 6, 6 },
+        { 0x1E57, 4, 4 },
+        { 0x1E5F, 4, 4 },
+        { 0x1E67, 4, 4 },
+        { 0x1E6F, 6, 6 },
+        { 0x1E7B, 4, 4 },
+        { 0x1E83, 4, 4 },
+        { 0x1E8B, 4, 4 },
+        { 0x1E93, 4, 4 },
+        { 0x1E9B, 4, 4 },
+        { 0x1EA3, 4, 5 },
+        { 0x1EAC, 4, 5 },
+        { 0x1EB5, 1, 1 },
+        { 0x1EB7, 6, 6 },
+        { 0x1EC3, 4, 4 },
+        { 0x1ECB, 6, 6 },
+        { 0x1ED7, 4, 4 },
+        { 0x1EDF, 6, 6 },
+        { 0x1EEB, 4, 4 },
+        { 0x1EF3, 4, 4 },
+        { 0x1EFB, 4, 4 },
+        { 0x1F03, 4, 4 },
+        { 0x1F0B, 4, 4 },
+        { 0x1F13, 2, 3 },
+        { 0x1F18, 0, 3 },
+        { 0x1F1B, 3, 1 },
+        { 0x1F1F, 3, 1 },
+        { 0x1F23, 0, 1 },
+        { 0x1F24, 0, 1 },
+        { 0x1F25, 0, 1 },
+        { 0x1F26, 0, 1 },
+        { 0x1F27, 0, 1 },
+        { 0x1F28, 0, 1 },
+        { 0x1F29, 0, 1 },
+        { 0x1F2A, 0, 1 },
+        { 0x1F2B, 0, 1 },
+        { 0x1F2C, 0, 3 },
+        { 0x1F2F, 0, 3 },
+        { 0x1F32, 0, 1 },
+        { 0x1F33, 0, 2 },
+        { 0x1F35, 0, 3 },
+        { 0x1F38, 0, 1 },
+        { 0x1F39, 0, 6 },
+        { 0x1F3F, 0, 9 },
+        { 0x1F48, 0, 6 },
+        { 0x1F4E, 0, 9 },
+        { 0x1F57, 0, 2 },
+        { 0x1F59, 0, 3 },
+        { 0x1F5C, 0, 2 },
+        { 0x1F5E, 0, 2 },
+        { 0x1F60, 0, 2 },
+        { 0x1F62, 0, 12 },
+        { 0x1F6E, 0, 1 },
+        { 0x1F6F, 0, 1 },
+        { 0x1F70, 0, 1 },
+        { 0x1F71, 0, 1 },
+        { 0x1F72, 0, 1 },
+        { 0x1F73, 0, 1 },
+        { 0x1F74, 0, 1 },
+        { 0x1F75, 0, 1 },
+        { 0x1F76, 0, 1 },
+        { 0x1F77, 0, 1 },
+        { 0x1F78, 0, 3 },
+        { 0x1F7B, 0, 1 },
+        { 0x1F7C, 0, 1 },
+        { 0x1F7D, 0, 1 },
+        { 0x1F7E, 0, 1 },
+        { 0x1F7F, 0, 1 },
+        { 0x1F80, 0, 1 },
+        { 0x1F81, 0, 1 },
+        { 0x1F82, 0, 1 },
+        { 0x1F83, 0, 1 },
+        { 0x1F84, 0, 1 },
+        { 0x1F85, 0, 1 },
+        { 0x1F86, 0, 1 },
+        { 0x1F87, 0, 1 },
+        { 0x1F88, 0, 1 },
+        { 0x1F89, 0, 1 },
+        { 0x1F8A, 0, 3 },
+        { 0x1F8D, 0, 1 },
+        { 0x1F8E, 0, 1 },
+        { 0x1F8F, 0, 1 },
+        { 0x1F90, 0, 1 },
+        { 0x1F91, 0, 1 },
+        { 0x1F92, 0, 1 },
+        { 0x1F93, 0, 1 },
+        { 0x1F94, 0, 2 },
+        { 0x1F96, 0, 1 },
+        { 0x1F97, 0, 1 },
+        { 0x1F98, 0, 1 },
+        { 0x1F99, 0, 1 },
+        { 0x1F9A, 0, 1 },
+        { 0x1F9B, 0, 1 },
+        { 0x1F9C, 0, 1 },
+        { 0x1F9D, 0, 1 },
+        { 0x1F9E, 0, 2 },
+        { 0x1FA0, 0, 3 },
+        { 0x1FA3, 0, 3 },
+        { 0x1FA6, 0, 1 },
+        { 0x1FA7, 0, 3 },
+        { 0x1FAA, 0, 3 },
+        { 0x1FAD, 0, 3 },
+        { 0x1FB0, 0, 2 },
+        { 0x1FB2, 0, 3 },
+        { 0x1FB5, 0, 1 },
+        { 0x1FB6, 0, 1 },
+        { 0x1FB7, 0, 1 },
+        { 0x1FB8, 0, 1 },
+        { 0x1FB9, 0, 1 },
+        { 0x1FBA, 0, 2 },
+        { 0x1FBC, 0, 1 },
+        { 0x1FBD, 0, 1 },
+        { 0x1FBE, 0, 1 },
+        { 0x1FBF, 0, 1 },
+        { 0x1FC0, 0, 1 },
+        { 0x1FC1, 0, 2 },
+        { 0x1FC3, 0, 1 },
+        { 0x1FC4, 0, 1 },
+        { 0x1FC5, 0, 1 },
+        { 0x1FC6, 0, 1 },
+        { 0x1FC7, 0, 1 },
+        { 0x1FC8, 0, 2 },
+        { 0x1FCA, 0, 3 },
+        { 0x1FCD, 0, 2 },
+        { 0x1FCF, 0, 1 },
+        { 0x1FD0, 2, 2 },
+        { 0x1FD4, 0, 1 },
+        { 0x1FD5, 1, 1 },
+        { 0x1FD7, 3, 3 },
+        { 0x1FDD, 0, 1 },
+        { 0x1FDE, 0, 1 },
+        { 0x1FDF, 0, 1 },
+        { 0x1FE0, 0, 1 },
+        { 0x1FE1, 0, 1 },
+        { 0x1FE2, 0, 1 },
+        { 0x1FE3, 0, 1 },
+        { 0x1FE4, 0, 2 },
+        { 0x1FE6, 0, 2 },
+        { 0x1FE8, 0, 2 },
+        { 0x1FEA, 0, 2 },
+        { 0x1FEC, 0, 1 },
+        { 0x1FED, 0, 3 },
+        { 0x1FF0, 0, 2 },
+        { 0x1FF2, 0, 2 },
+        { 0x1FF4, 0, 2 },
+        { 0x1FF6, 0, 2 },
+        { 0x1FF8, 0, 3 },
+        { 0x1FFB, 0, 1 },
+        { 0x1FFC, 0, 1 },
+        { 0x1FFD, 0, 1 },
+        { 0x1FFE, 0, 1 },
+        { 0x1FFF, 0, 1 },
+        { 0x2000, 0, 5 },
+        { 0x2005, 0, 5 },
+        { 0x200A, 0, 6 },
+        { 0x2010, 0, 5 },
+        { 0x2015, 0, 5 },
+        { 0x201A, 0, 5 },
+        { 0x201F, 0, 5 },
+        { 0x2024, 0, 5 },
+        { 0x2029, 0, 5 },
+        { 0x202E, 0, 5 },
+        { 0x2033, 0, 5 },
+        { 0x2038, 0, 5 },
+        { 0x203D, 0, 5 },
+        { 0x2042, 0, 5 },
+        { 0x2047, 0, 5 },
+        { 0x204C, 0, 4 },
+        { 0x2050, 0, 1 },
+        { 0x2051, 0, 2 },
+        { 0x2053, 0, 3 },
+        { 0x2056, 0, 2 },
+        { 0x2058, 0, 1 },
+        { 0x2059, 0, 2 },
+        { 0x205B, 0, 3 },
+        { 0x205E, 0, 4 },
+        { 0x2062, 0, 2 },
+        { 0x2064, 0, 1 },
+        { 0x2065, 0, 2 },
+        { 0x2067, 0, 3 },
+        { 0x206A, 0, 1 },
+        { 0x206B, 0, 1 },
+        { 0x206C, 0, 1 },
+        { 0x206D, 0, 1 },
+        { 0x206E, 0, 1 },
+        { 0x206F, 0, 2 },
+        { 0x2071, 0, 3 },
+        { 0x2074, 0, 2 },
+        { 0x2076, 0, 1 },
+        { 0x2077, 0, 2 },
+        { 0x2079, 0, 3 },
+        { 0x207C, 0, 4 },
+        { 0x2080, 0, 2 },
+        { 0x2082, 0, 1 },
+        { 0x2083, 0, 2 },
+        { 0x2085, 0, 3 },
+        { 0x2088, 0, 1 },
+        { 0x2089, 0, 1 },
+        { 0x208A, 0, 1 },
+        { 0x208B, 0, 1 },
+        { 0x208C, 0, 5 },
+        { 0x2091, 5, 5 },
+        { 0x209B, 5, 5 },
+        { 0x20A5, 5, 5 },
+        { 0x20AF, 5, 5 },
+        { 0x20B9, 5, 5 },
+        { 0x20C3, 5, 5 },
+        { 0x20CD, 5, 5 },
+        { 0x20D7, 5, 5 },
+        { 0x20E1, 5, 5 },
+        { 0x20EB, 5, 5 },
+        { 0x20F5, 5, 5 },
+        { 0x20FF, 0, 6 },
+        { 0x2105, 0, 9 },
+        { 0x210E, 0, 6 },
+        { 0x2114, 0, 9 },
+        { 0x211D, 5, 5 },
+        { 0x2127, 5, 5 },
+        { 0x2131, 5, 5 },
+        { 0x213B, 5, 5 },
+        { 0x2145, 3, 3 },
+        { 0x214B, 5, 5 },
+        { 0x2155, 5, 5 },
+        { 0x215F, 3, 3 },
+        { 0x2165, 3, 3 },
+        { 0x216B, 5, 5 },
+        { 0x2175, 5, 5 },
+        { 0x217F, 5, 5 },
+        { 0x2189, 5, 5 },
+        { 0x2193, 5, 5 },
+        { 0x219D, 5, 5 },
+        { 0x21A7, 5, 5 },
+        { 0x21B1, 5, 5 },
+        { 0x21BB, 5, 5 },
+        { 0x21C5, 5, 5 },
+        { 0x21CF, 5, 5 },
+        { 0x21D9, 5, 5 },
+        { 0x21E3, 5, 5 },
+        { 0x21ED, 5, 5 },
+        { 0x21F7, 5, 5 },
+        { 0x2201, 5, 5 },
+        { 0x220B, 5, 5 },
+        { 0x2215, 5, 5 },
+        { 0x221F, 5, 5 },
+        { 0x2229, 5, 5 },
+        { 0x2233, 5, 5 },
+        { 0x223D, 5, 5 },
+        { 0x2247, 5, 5 },
+        { 0x2251, 5, 5 },
+        { 0x225B, 3, 3 },
+        { 0x2261, 3, 3 },
+        { 0x2267, 0, 1 },
+        { 0x2268, 0, 1 },
+        { 0x2269, 0, 1 },
+        { 0x226A, 0, 1 },
+        { 0x226B, 0, 1 },
+        { 0x226C, 0, 1 },
+        { 0x226D, 0, 1 },
+        { 0x226E, 0, 1 },
+        { 0x226F, 0, 1 },
+        { 0x2270, 0, 2 },
+        { 0x2272, 0, 2 },
+        { 0x2274, 0, 2 },
+        { 0x2276, 0, 2 },
+        { 0x2278, 0, 2 },
+        { 0x227A, 0, 2 },
+        { 0x227C, 0, 2 },
+        { 0x227E, 0, 2 },
+        { 0x2280, 0, 2 },
+        { 0x2282, 0, 2 },
+        { 0x2284, 0, 2 },
+        { 0x2286, 0, 3 },
+        { 0x2289, 0, 3 },
+        { 0x228C, 0, 3 },
+        { 0x228F, 0, 3 },
+        { 0x2292, 0, 3 },
+        { 0x2295, 0, 3 },
+        { 0x2298, 0, 3 },
+        { 0x229B, 0, 3 },
+        { 0x229E, 0, 3 },
+        { 0x22A1, 0, 4 },
+        { 0x22A5, 0, 4 },
+        { 0x22A9, 0, 4 },
+        { 0x22AD, 0, 4 },
+        { 0x22B1, 0, 4 },
+        { 0x22B5, 0, 4 },
+        { 0x22B9, 0, 4 },
+        { 0x22BD, 0, 4 },
+        { 0x22C1, 0, 4 },
+        { 0x22C5, 0, 4 },
+        { 0x22C9, 0, 4 },
+        { 0x22CD, 0, 2 },
+        { 0x22CF, 0, 2 },
+        { 0x22D1, 0, 2 },
+        { 0x22D3, 0, 2 },
+        { 0x22D5, 0, 2 },
+        { 0x22D7, 0, 2 },
+        { 0x22D9, 0, 2 },
+        { 0x22DB, 0, 2 },
+        { 0x22DD, 0, 2 },
+        { 0x22DF, 0, 3 },
+        { 0x22E2, 0, 3 },
+        { 0x22E5, 0, 3 },
+        { 0x22E8, 0, 3 },
+        { 0x22EB, 0, 3 },
+        { 0x22EE, 0, 3 },
+        { 0x22F1, 0, 3 },
+        { 0x22F4, 0, 3 },
+        { 0x22F7, 0, 3 },
+        { 0x22FA, 0, 3 },
+        { 0x22FD, 0, 3 },
+        { 0x2300, 0, 3 },
+        { 0x2303, 0, 3 },
+        { 0x2306, 0, 3 },
+        { 0x2309, 0, 3 },
+        { 0x230C, 0, 3 },
+        { 0x230F, 0, 3 },
+        { 0x2312, 0, 3 },
+        { 0x2315, 0, 3 },
+        { 0x2318, 0, 3 },
+        { 0x231B, 0, 3 },
+        { 0x231E, 0, 3 },
+        { 0x2321, 0, 3 },
+        { 0x2324, 0, 3 },
+        { 0x2327, 0, 3 },
+        { 0x232A, 0, 3 },
+        { 0x232D, 0, 3 },
+        { 0x2330, 0, 3 },
+        { 0x2333, 0, 3 },
+        { 0x2336, 0, 3 },
+        { 0x2339, 0, 3 },
+        { 0x233C, 0, 3 },
+        { 0x233F, 0, 3 },
+        { 0x2342, 0, 3 },
+        { 0x2345, 0, 3 },
+        { 0x2348, 0, 3 },
+        { 0x234B, 0, 3 },
+        { 0x234E, 0, 1 },
+        { 0x234F, 0, 1 },
+        { 0x2350, 0, 1 },
+        { 0x2351, 0, 1 },
+        { 0x2352, 0, 1 },
+        { 0x2353, 0, 1 },
+        { 0x2354, 0, 1 },
+        { 0x2355, 0, 1 },
+        { 0x2356, 0, 1 },
+        { 0x2357, 0, 1 },
+        { 0x2358, 0, 1 },
+        { 0x2359, 0, 1 },
+        { 0x235A, 0, 1 },
+        { 0x235B, 0, 1 },
+        { 0x235C, 0, 1 },
+        { 0x235D, 0, 1 },
+        { 0x235E, 0, 1 },
+        { 0x235F, 0, 1 },
+        { 0x2360, 0, 1 },
+        { 0x2361, 0, 1 },
+        { 0x2362, 0, 1 },
+        { 0x2363, 0, 1 },
+        { 0x2364, 0, 1 },
+        { 0x2365, 0, 1 },
+        { 0x2366, 0, 1 },
+        { 0x2367, 0, 1 },
+        { 0x2368, 0, 1 },
+        { 0x2369, 0, 1 },
+        { 0x236A, 0, 1 },
+        { 0x236B, 0, 1 },
+        { 0x236C, 0, 1 },
+        { 0x236D, 0, 1 },
+        { 0x236E, 0, 1 },
+        { 0x236F, 0, 1 },
+        { 0x2370, 0, 1 },
+        { 0x2371, 0, 1 },
+        { 0x2372, 0, 1 },
+        { 0x2373, 0, 1 },
+        { 0x2374, 0, 1 },
+        { 0x2375, 0, 1 },
+        { 0x2376, 0, 1 },
+        { 0x2377, 0, 1 },
+        { 0x2378, 0, 1 },
+        { 0x2379, 0, 1 },
+        { 0x237A, 0, 1 },
+        { 0x237B, 0, 1 },
+        { 0x237C, 0, 1 },
+        { 0x237D, 0, 1 },
+        { 0x237E, 0, 1 },
+        { 0x237F, 0, 1 },
+        { 0x2380, 0, 1 },
+        { 0x2381, 0, 1 },
+        { 0x2382, 0, 1 },
+        { 0x2383, 0, 12 },
+        { 0x238F, 0, 3 },
+        { 0x2392, 0, 2 },
+        { 0x2394, 0, 3 },
+        { 0x2397, 5, 5 },
+        { 0x23A1, 0, 1 },
+        { 0x23A2, 0, 1 },
+        { 0x23A3, 0, 3 },
+        { 0x23A6, 0, 3 },
+        { 0x23A9, 0, 3 },
+        { 0x23AC, 0, 3 },
+        { 0x23AF, 0, 3 },
+        { 0x23B2, 0, 3 },
+        { 0x23B5, 0, 3 },
+        { 0x23B8, 0, 3 },
+        { 0x23BB, 0, 3 },
+        { 0x23BE, 0, 3 },
+        { 0x23C1, 0, 3 },
+        { 0x23C4, 0, 3 },
+        { 0x23C7, 0, 3 },
+        { 0x23CA, 0, 3 },
+        { 0x23CD, 0, 3 },
+        { 0x23D0, 0, 3 },
+        { 0x23D3, 0, 3 },
+        { 0x23D6, 0, 3 },
+        { 0x23D9, 0, 3 },
+        { 0x23DC, 0, 3 },
+        { 0x23DF, 0, 3 },
+        { 0x23E2, 0, 3 },
+        { 0x23E5, 0, 3 },
+        { 0x23E8, 0, 3 },
+        { 0x23EB, 0, 3 },
+        { 0x23EE, 0, 3 },
+        { 0x23F1, 0, 3 },
+        { 0x23F4, 0, 3 },
+        { 0x23F7, 0, 3 },
+        { 0x23FA, 0, 3 },
+        { 0x23FD, 0, 3 },
+        { 0x2400, 0, 3 },
+        { 0x2403, 0, 3 },
+        { 0x2406, 0, 3 },
+        { 0x2409, 0, 3 },
+        { 0x240C, 0, 3 },
+        { 0x240F, 0, 3 },
+        { 0x2412, 0, 3 },
+        { 0x2415, 0, 3 },
+        { 0x2418, 0, 3 },
+        { 0x241B, 0, 3 },
+        { 0x241E, 0, 3 },
+        { 0x2421, 0, 3 },
+        { 0x2424, 0, 3 },
+        { 0x2427, 0, 3 },
+        { 0x242A, 0, 3 },
+        { 0x242D, 0, 3 },
+        { 0x2430, 0, 3 },
+        { 0x2433, 0, 3 },
+        { 0x2436, 0, 3 },
+        { 0x2439, 0, 3 },
+        { 0x243C, 0, 3 },
+        { 0x243F, 0, 3 },
+        { 0x2442, 0, 3 },
+        { 0x2445, 0, 3 },
+        { 0x2448, 0, 3 },
+        { 0x244B, 0, 3 },
+        { 0x244E, 0, 3 },
+        { 0x2451, 0, 3 },
+        { 0x2454, 0, 3 },
+        { 0x2457, 0, 3 },
+        { 0x245A, 0, 3 },
+        { 0x245D, 0, 3 },
+        { 0x2460, 0, 3 },
+        { 0x2463, 0, 3 },
+        { 0x2466, 0, 3 },
+        { 0x2469, 0, 3 },
+        { 0x246C, 0, 3 },
+        { 0x246F, 0, 3 },
+        { 0x2472, 0, 3 },
+        { 0x2475, 0, 3 },
+        { 0x2478, 0, 3 },
+        { 0x247B, 0, 3 },
+        { 0x247E, 0, 3 },
+        { 0x2481, 0, 3 },
+        { 0x2484, 0, 3 },
+        { 0x2487, 0, 3 },
+        { 0x248A, 0, 3 },
+        { 0x248D, 0, 3 },
+        { 0x2490, 0, 3 },
+        { 0x2493, 0, 3 },
+        { 0x2496, 0, 3 },
+        { 0x2499, 0, 3 },
+        { 0x249C, 0, 3 },
+        { 0x249F, 0, 3 },
+        { 0x24A2, 0, 3 },
+        { 0x24A5, 0, 3 },
+        { 0x24A8, 0, 3 },
+        { 0x24AB, 0, 3 },
+        { 0x24AE, 0, 3 },
+        { 0x24B1, 0, 3 },
+        { 0x24B4, 0, 3 },
+        { 0x24B7, 0, 3 },
+        { 0x24BA, 0, 3 },
+        { 0x24BD, 0, 3 },
+        { 0x24C0, 0, 3 },
+        { 0x24C3, 0, 3 },
+        { 0x24C6, 0, 3 },
+        { 0x24C9, 0, 3 },
+        { 0x24CC, 0, 3 },
+        { 0x24CF, 0, 3 },
+        { 0x24D2, 0, 3 },
+        { 0x24D5, 0, 3 },
+        { 0x24D8, 0, 3 },
+        { 0x24DB, 0, 3 },
+        { 0x24DE, 0, 3 },
+        { 0x24E1, 0, 3 },
+        { 0x24E4, 0, 3 },
+        { 0x24E7, 0, 3 },
+        { 0x24EA, 0, 3 },
+        { 0x24ED, 0, 3 },
+        { 0x24F0, 0, 3 },
+        { 0x24F3, 0, 3 },
+        { 0x24F6, 0, 3 },
+        { 0x24F9, 0, 3 },
+        { 0x24FC, 0, 3 },
+        { 0x24FF, 0, 3 },
+        { 0x2502, 0, 3 },
+        { 0x2505, 0, 3 },
+        { 0x2508, 0, 3 },
+        { 0x250B, 0, 3 },
+        { 0x250E, 0, 3 },
+        { 0x2511, 0, 3 },
+        { 0x2514, 0, 3 },
+        { 0x2517, 0, 3 },
+        { 0x251A, 0, 3 },
+        { 0x251D, 0, 3 },
+        { 0x2520, 0, 3 },
+        { 0x2523, 0, 3 },
+        { 0x2526, 0, 3 },
+        { 0x2529, 0, 3 },
+        { 0x252C, 0, 3 },
+        { 0x252F, 0, 3 },
+        { 0x2532, 0, 3 },
+        { 0x2535, 0, 3 },
+        { 0x2538, 0, 3 },
+        { 0x253B, 0, 3 },
+        { 0x253E, 0, 3 },
+        { 0x2541, 0, 3 },
+        { 0x2544, 0, 3 },
+        { 0x2547, 0, 3 },
+        { 0x254A, 0, 3 },
+        { 0x254D, 0, 3 },
+        { 0x2550, 0, 3 },
+        { 0x2553, 0, 3 },
+        { 0x2556, 0, 3 },
+        { 0x2559, 0, 3 },
+        { 0x255C, 0, 3 },
+        { 0x255F, 0, 3 },
+        { 0x2562, 0, 3 },
+        { 0x2565, 0, 3 },
+        { 0x2568, 0, 3 },
+        { 0x256B, 0, 3 },
+        { 0x256E, 0, 3 },
+        { 0x2571, 0, 3 },
+        { 0x2574, 0, 3 },
+        { 0x2577, 0, 3 },
+        { 0x257A, 0, 3 },
+        { 0x257D, 0, 3 },
+        { 0x2580, 0, 3 },
+        { 0x2583, 0, 3 },
+        { 0x2586, 0, 3 },
+        { 0x2589, 0, 3 },
+        { 0x258C, 0, 3 },
+        { 0x258F, 0, 3 },
+        { 0x2592, 0, 3 },
+        { 0x2595, 0, 3 },
+        { 0x2598, 0, 3 },
+        { 0x259B, 0, 3 },
+        { 0x259E, 0, 3 },
+        { 0x25A1, 0, 3 },
+        { 0x25A4, 0, 3 },
+        { 0x25A7, 0, 3 },
+        { 0x25AA, 0, 3 },
+        { 0x25AD, 0, 3 },
+        { 0x25B0, 0, 3 },
+        { 0x25B3, 0, 3 },
+        { 0x25B6, 0, 3 },
+        { 0x25B9, 0, 3 },
+        { 0x25BC, 0, 3 },
+        { 0x25BF, 0, 3 },
+        { 0x25C2, 0, 3 },
+        { 0x25C5, 0, 3 },
+        { 0x25C8, 0, 3 },
+        { 0x25CB, 0, 3 },
+        { 0x25CE, 0, 3 },
+        { 0x25D1, 0, 3 },
+        { 0x25D4, 0, 3 },
+        { 0x25D7, 0, 3 },
+        { 0x25DA, 0, 3 },
+        { 0x25DD, 0, 3 },
+        { 0x25E0, 0, 3 },
+        { 0x25E3, 0, 3 },
+        { 0x25E6, 0, 3 },
+        { 0x25E9, 0, 3 },
+        { 0x25EC, 0, 3 },
+        { 0x25EF, 0, 3 },
+        { 0x25F2, 0, 3 },
+        { 0x25F5, 0, 3 },
+        { 0x25F8, 0, 3 },
+        { 0x25FB, 0, 3 },
+        { 0x25FE, 0, 3 },
+        { 0x2601, 0, 3 },
+        { 0x2604, 0, 3 },
+        { 0x2607, 0, 3 },
+        { 0x260A, 0, 3 },
+        { 0x260D, 0, 3 },
+        { 0x2610, 0, 3 },
+        { 0x2613, 0, 3 },
+        { 0x2616, 0, 3 },
+        { 0x2619, 0, 3 },
+        { 0x261C, 0, 3 },
+        { 0x261F, 0, 3 },
+        { 0x2622, 0, 3 },
+        { 0x2625, 0, 3 },
+        { 0x2628, 0, 3 },
+        { 0x262B, 0, 3 },
+        { 0x262E, 0, 1 },
+        { 0x262F, 0, 3 },
+        { 0x2632, 0, 3 },
+        { 0x2635, 0, 3 },
+        { 0x2638, 0, 3 },
+        { 0x263B, 6, 6 },
+        { 0x2647, 6, 6 },
+        { 0x2653, 6, 6 },
+        { 0x265F, 6, 6 },
+        { 0x266B, 6, 6 },
+        { 0x2677, 6, 6 },
+        { 0x2683, 6, 6 },
+        { 0x268F, 6, 6 },
+        { 0x269B, 6, 6 },
+        { 0x26A7, 6, 6 },
+        { 0x26B3, 6, 6 },
+        { 0x26BF, 6, 6 },
+        { 0x26CB, 6, 6 },
+        { 0x26D7, 6, 6 },
+        { 0x26E3, 6, 6 },
+        { 0x26EF, 6, 6 },
+        { 0x26FB, 6, 6 },
+        { 0x2707, 6, 6 },
+        { 0x2713, 6, 6 },
+        { 0x271F, 6, 6 },
+        { 0x272B, 6, 6 },
+        { 0x2737, 6, 6 },
+        { 0x2743, 6, 6 },
+        { 0x274F, 6, 6 },
+        { 0x275B, 6, 6 },
+        { 0x2767, 6, 6 },
+        { 0x2773, 0, 4 },
+        { 0x2777, 0, 4 },
+        { 0x277B, 6, 6 },
+        { 0x2787, 0, 6 },
+        { 0x278D, 6, 6 },
+        { 0x2799, 6, 6 },
+        { 0x27A5, 6, 6 },
+        { 0x27B1, 6, 6 },
+        { 0x27BD, 6, 6 },
+        { 0x27C9, 6, 6 },
+        { 0x27D5, 6, 6 },
+        { 0x27E1, 6, 6 },
+        { 0x27ED, 6, 6 },
+        { 0x27F9, 6, 6 },
+        { 0x2805, 6, 6 },
+        { 0x2811, 6, 6 },
+        { 0x281D, 6, 6 },
+        { 0x2829, 6, 6 },
+        { 0x2835, 6, 6 },
+        { 0x2841, 6, 6 },
+        { 0x284D, 6, 6 },
+        { 0x2859, 6, 6 },
+        { 0x2865, 6, 6 },
+        { 0x2871, 6, 6 },
+        { 0x287D, 6, 6 },
+        { 0x2889, 6, 6 },
+        { 0x2895, 6, 6 },
+        { 0x28A1, 6, 6 },
+        { 0x28AD, 6, 6 },
+        { 0x28B9, 6, 6 },
+        { 0x28C5, 6, 6 },
+        { 0x28D1, 6, 6 },
+        { 0x28DD, 6, 6 },
+        { 0x28E9, 6, 6 },
+        { 0x28F5, 6, 6 },
+        { 0x2901, 0, 6 },
+        { 0x2907, 0, 3 },
+        { 0x290A, 0, 3 },
+        { 0x290D, 0, 3 },
+        { 0x2910, 0, 3 },
+        { 0x2913, 0, 3 },
+        { 0x2916, 0, 3 },
+        { 0x2919, 0, 3 },
+        { 0x291C, 0, 3 },
+        { 0x291F, 0, 3 },
+        { 0x2922, 0, 3 },
+        { 0x2925, 0, 3 },
+        { 0x2928, 0, 3 },
+        { 0x292B, 0, 3 },
+        { 0x292E, 0, 3 },
+        { 0x2931, 0, 3 },
+        { 0x2934, 0, 3 },
+        { 0x2937, 0, 3 },
+        { 0x293A, 0, 3 },
+        { 0x293D, 0, 3 },
+        { 0x2940, 0, 3 },
+        { 0x2943, 0, 3 },
+        { 0x2946, 0, 3 },
+        { 0x2949, 0, 3 },
+        { 0x294C, 0, 3 },
+        { 0x294F, 0, 3 },
+        { 0x2952, 0, 3 },
+        { 0x2955, 0, 3 },
+        { 0x2958, 0, 3 },
+        { 0x295B, 0, 3 },
+        { 0x295E, 0, 3 },
+        { 0x2961, 0, 3 },
+        { 0x2964, 0, 3 },
+        { 0x2967, 0, 3 },
+        { 0x296A, 0, 3 },
+        { 0x296D, 0, 3 },
+        { 0x2970, 0, 3 },
+        { 0x2973, 0, 3 },
+        { 0x2976, 0, 3 },
+        { 0x2979, 0, 3 },
+        { 0x297C, 0, 3 },
+        { 0x297F, 0, 3 },
+        { 0x2982, 0, 3 },
+        { 0x2985, 0, 3 },
+        { 0x2988, 0, 3 },
+        { 0x298B, 0, 3 },
+        { 0x298E, 0, 3 },
+        { 0x2991, 0, 3 },
+        { 0x2994, 0, 3 },
+        { 0x2997, 0, 3 },
+        { 0x299A, 0, 3 },
+        { 0x299D, 0, 3 },
+        { 0x29A0, 0, 3 },
+        { 0x29A3, 0, 3 },
+        { 0x29A6, 0, 3 },
+        { 0x29A9, 0, 3 },
+        { 0x29AC, 0, 3 },
+        { 0x29AF, 0, 3 },
+        { 0x29B2, 0, 3 },
+        { 0x29B5, 0, 3 },
+        { 0x29B8, 0, 3 },
+        { 0x29BB, 0, 3 },
+        { 0x29BE, 0, 3 },
+        { 0x29C1, 0, 3 },
+        { 0x29C4, 0, 3 },
+        { 0x29C7, 0, 3 },
+        { 0x29CA, 0, 3 },
+        { 0x29CD, 0, 3 },
+        { 0x29D0, 0, 3 },
+        { 0x29D3, 0, 3 },
+        { 0x29D6, 0, 3 },
+        { 0x29D9, 0, 3 },
+        { 0x29DC, 0, 3 },
+        { 0x29DF, 0, 3 },
+        { 0x29E2, 0, 3 },
+        { 0x29E5, 0, 3 },
+        { 0x29E8, 0, 3 },
+        { 0x29EB, 0, 3 },
+        { 0x29EE, 0, 3 },
+        { 0x29F1, 0, 3 },
+        { 0x29F4, 0, 3 },
+        { 0x29F7, 0, 3 },
+        { 0x29FA, 0, 3 },
+        { 0x29FD, 0, 3 },
+        { 0x2A00, 0, 3 },
+        { 0x2A03, 0, 3 },
+        { 0x2A06, 0, 3 },
+        { 0x2A09, 0, 3 },
+        { 0x2A0C, 0, 3 },
+        { 0x2A0F, 0, 3 },
+        { 0x2A12, 0, 3 },
+        { 0x2A15, 0, 3 },
+        { 0x2A18, 0, 3 },
+        { 0x2A1B, 0, 3 },
+        { 0x2A1E, 0, 3 },
+        { 0x2A21, 0, 3 },
+        { 0x2A24, 0, 3 },
+        { 0x2A27, 0, 3 },
+        { 0x2A2A, 0, 3 },
+        { 0x2A2D, 0, 3 },
+        { 0x2A30, 0, 3 },
+        { 0x2A33, 0, 3 },
+        { 0x2A36, 0, 3 },
+        { 0x2A39, 0, 3 },
+        { 0x2A3C, 0, 3 },
+        { 0x2A3F, 0, 3 },
+        { 0x2A42, 0, 3 },
+        { 0x2A45, 0, 3 },
+        { 0x2A48, 0, 3 },
+        { 0x2A4B, 0, 5 },
+        { 0x2A50, 0, 5 },
+        { 0x2A55, 0, 5 },
+        { 0x2A5A, 0, 5 },
+        { 0x2A5F, 0, 5 },
+        { 0x2A64, 0, 5 },
+        { 0x2A69, 0, 5 },
+        { 0x2A6E, 0, 5 },
+        { 0x2A73, 0, 5 },
+        { 0x2A78, 0, 5 },
+        { 0x2A7D, 0, 5 },
+        { 0x2A82, 0, 5 },
+        { 0x2A87, 0, 5 },
+        { 0x2A8C, 0, 5 },
+        { 0x2A91, 0, 8 },
+        { 0x2A99, 0, 8 },
+        { 0x2AA1, 0, 8 },
+        { 0x2AA9, 0, 8 },
+        { 0x2AB1, 0, 8 },
+        { 0x2AB9, 0, 8 },
+        { 0x2AC1, 0, 8 },
+        { 0x2AC9, 0, 8 },
+        { 0x2AD1, 0, 8 },
+        { 0x2AD9, 0, 8 },
+        { 0x2AE1, 0, 8 },
+        { 0x2AE9, 0, 8 },
+        { 0x2AF1, 0, 8 },
+        { 0x2AF9, 0, 8 },
+        { 0x2B01, 0, 8 },
+        { 0x2B09, 0, 17 },
+        { 0x2B1A, 0, 14 },
+        { 0x2B28, 0, 5 },
+        { 0x2B2D, 0, 5 },
+        { 0x2B32, 0, 5 },
+        { 0x2B37, 0, 5 },
+        { 0x2B3C, 0, 5 },
+        { 0x2B41, 0, 5 },
+        { 0x2B46, 0, 5 },
+        { 0x2B4B, 0, 5 },
+        { 0x2B50, 0, 5 },
+        { 0x2B55, 0, 5 },
+        { 0x2B5A, 0, 5 },
+        { 0x2B5F, 0, 5 },
+        { 0x2B64, 0, 5 },
+        { 0x2B69, 0, 5 },
+        { 0x2B6E, 0, 5 },
+        { 0x2B73, 0, 5 },
+        { 0x2B78, 0, 5 },
+        { 0x2B7D, 0, 5 },
+        { 0x2B82, 0, 5 },
+        { 0x2B87, 0, 5 },
+        { 0x2B8C, 0, 5 },
+        { 0x2B91, 0, 5 },
+        { 0x2B96, 0, 5 },
+        { 0x2B9B, 0, 5 },
+        { 0x2BA0, 0, 5 },
+        { 0x2BA5, 0, 5 },
+        { 0x2BAA, 0, 5 },
+        { 0x2BAF, 0, 5 },
+        { 0x2BB4, 0, 5 },
+        { 0x2BB9, 0, 5 },
+        { 0x2BBE, 0, 5 },
+        { 0x2BC3, 0, 5 },
+        { 0x2BC8, 0, 5 },
+        { 0x2BCD, 0, 5 },
+        { 0x2BD2, 0, 5 },
+        { 0x2BD7, 0, 5 },
+        { 0x2BDC, 0, 3 },
+        { 0x2BDF, 0, 3 },
+        { 0x2BE2, 0, 3 },
+        { 0x2BE5, 0, 3 },
+        { 0x2BE8, 0, 3 },
+        { 0x2BEB, 0, 2 },
+        { 0x2BED, 0, 2 },
+        { 0x2BEF, 0, 2 },
+        { 0x2BF1, 0, 2 },
+        { 0x2BF3, 0, 2 },
+        { 0x2BF5, 0, 2 },
+        { 0x2BF7, 0, 2 },
+        { 0x2BF9, 0, 2 },
+        { 0x2BFB, 0, 2 },
+        { 0x2BFD, 0, 2 },
+        { 0x2BFF, 0, 2 },
+        { 0x2C01, 0, 2 },
+        { 0x2C03, 0, 2 },
+        { 0x2C05, 0, 2 },
+        { 0x2C07, 0, 2 },
+        { 0x2C09, 0, 3 },
+        { 0x2C0C, 0, 3 },
+        { 0x2C0F, 0, 3 },
+        { 0x2C12, 0, 3 },
+        { 0x2C15, 0, 3 },
+        { 0x2C18, 0, 3 },
+        { 0x2C1B, 0, 3 },
+        { 0x2C1E, 0, 3 },
+        { 0x2C21, 0, 3 },
+        { 0x2C24, 0, 3 },
+        { 0x2C27, 0, 3 },
+        { 0x2C2A, 0, 3 },
+        { 0x2C2D, 0, 3 },
+        { 0x2C30, 0, 3 },
+        { 0x2C33, 0, 6 },
+        { 0x2C39, 0, 6 },
+        { 0x2C3F, 0, 6 },
+        { 0x2C45, 0, 6 },
+        { 0x2C4B, 0, 6 },
+        { 0x2C51, 0, 6 },
+        { 0x2C57, 0, 6 },
+        { 0x2C5D, 0, 6 },
+        { 0x2C63, 0, 6 },
+        { 0x2C69, 0, 6 },
+        { 0x2C6F, 0, 6 },
+        { 0x2C75, 0, 6 },
+        { 0x2C7B, 0, 6 },
+        { 0x2C81, 0, 6 },
+        { 0x2C87, 0, 15 },
+        { 0x2C96, 0, 12 },
+        { 0x2CA2, 0, 6 },
+        { 0x2CA8, 0, 3 },
+        { 0x2CAB, 0, 3 },
+        { 0x2CAE, 0, 3 },
+        { 0x2CB1, 0, 3 },
+        { 0x2CB4, 0, 3 },
+        { 0x2CB7, 0, 3 },
+        { 0x2CBA, 0, 3 },
+        { 0x2CBD, 0, 3 },
+        { 0x2CC0, 0, 3 },
+        { 0x2CC3, 0, 3 },
+        { 0x2CC6, 0, 3 },
+        { 0x2CC9, 0, 3 },
+        { 0x2CCC, 0, 3 },
+        { 0x2CCF, 0, 3 },
+        { 0x2CD2, 0, 3 },
+        { 0x2CD5, 0, 3 },
+        { 0x2CD8, 0, 3 },
+        { 0x2CDB, 0, 3 },
+        { 0x2CDE, 0, 3 },
+        { 0x2CE1, 0, 3 },
+        { 0x2CE4, 0, 3 },
+        { 0x2CE7, 0, 3 },
+        { 0x2CEA, 0, 3 },
+        { 0x2CED, 0, 3 },
+        { 0x2CF0, 0, 3 },
+        { 0x2CF3, 0, 3 },
+        { 0x2CF6, 0, 3 },
+        { 0x2CF9, 0, 3 },
+        { 0x2CFC, 0, 3 },
+        { 0x2CFF, 0, 3 },
+        { 0x2D02, 0, 3 },
+        { 0x2D05, 0, 3 },
+        { 0x2D08, 0, 3 },
+        { 0x2D0B, 0, 3 },
+        { 0x2D0E, 0, 3 },
+        { 0x2D11, 0, 3 },
+        { 0x2D14, 0, 3 },
+        { 0x2D17, 0, 3 },
+        { 0x2D1A, 0, 3 },
+        { 0x2D1D, 0, 3 },
+        { 0x2D20, 0, 3 },
+        { 0x2D23, 0, 3 },
+        { 0x2D26, 0, 3 },
+        { 0x2D29, 0, 3 },
+        { 0x2D2C, 0, 3 },
+        { 0x2D2F, 0, 3 },
+        { 0x2D32, 0, 3 },
+        { 0x2D35, 0, 3 },
+        { 0x2D38, 0, 3 },
+        { 0x2D3B, 0, 2 },
+        { 0x2D3D, 0, 2 },
+        { 0x2D3F, 0, 2 },
+        { 0x2D41, 0, 2 },
+        { 0x2D43, 0, 2 },
+        { 0x2D45, 0, 2 },
+        { 0x2D47, 0, 2 },
+        { 0x2D49, 0, 2 },
+        { 0x2D4B, 0, 2 },
+        { 0x2D4D, 0, 2 },
+        { 0x2D4F, 0, 2 },
+        { 0x2D51, 0, 2 },
+        { 0x2D53, 0, 2 },
+        { 0x2D55, 0, 2 },
+        { 0x2D57, 0, 2 },
+        { 0x2D59, 0, 4 },
+        { 0x2D5D, 0, 4 },
+        { 0x2D61, 0, 4 },
+        { 0x2D65, 0, 4 },
+        { 0x2D69, 0, 4 },
+        { 0x2D6D, 0, 4 },
+        { 0x2D71, 0, 4 },
+        { 0x2D75, 0, 4 },
+        { 0x2D79, 0, 4 },
+        { 0x2D7D, 0, 5 },
+        { 0x2D82, 0, 5 },
+        { 0x2D87, 0, 5 },
+        { 0x2D8C, 0, 2 },
+        { 0x2D8E, 0, 3 },
+        { 0x2D91, 0, 2 },
+        { 0x2D93, 0, 3 },
+        { 0x2D96, 0, 3 },
+        { 0x2D99, 0, 3 },
+        { 0x2D9C, 0, 3 },
+        { 0x2D9F, 0, 3 },
+        { 0x2DA2, 0, 3 },
+        { 0x2DA5, 0, 3 },
+        { 0x2DA8, 0, 3 },
+        { 0x2DAB, 0, 3 },
+        { 0x2DAE, 0, 3 },
+        { 0x2DB1, 0, 3 },
+        { 0x2DB4, 0, 3 },
+        { 0x2DB7, 0, 3 },
+        { 0x2DBA, 0, 3 },
+        { 0x2DBD, 0, 3 },
+        { 0x2DC0, 0, 3 },
+        { 0x2DC3, 0, 3 },
+        { 0x2DC6, 0, 3 },
+        { 0x2DC9, 0, 3 },
+        { 0x2DCC, 0, 3 },
+        { 0x2DCF, 0, 3 },
+        { 0x2DD2, 0, 3 },
+        { 0x2DD5, 0, 3 },
+        { 0x2DD8, 0, 3 },
+        { 0x2DDB, 0, 3 },
+        { 0x2DDE, 0, 3 },
+        { 0x2DE1, 0, 3 },
+        { 0x2DE4, 0, 3 },
+        { 0x2DE7, 0, 3 },
+        { 0x2DEA, 0, 3 },
+        { 0x2DED, 0, 3 },
+        { 0x2DF0, 0, 3 },
+        { 0x2DF3, 0, 3 },
+        { 0x2DF6, 0, 3 },
+        { 0x2DF9, 0, 3 },
+        { 0x2DFC, 0, 3 },
+        { 0x2DFF, 0, 3 },
+        { 0x2E02, 0, 3 },
+        { 0x2E05, 0, 3 },
+        { 0x2E08, 0, 3 },
+        { 0x2E0B, 0, 3 },
+        { 0x2E0E, 0, 3 },
+        { 0x2E11, 0, 3 },
+        { 0x2E14, 0, 3 },
+        { 0x2E17, 0, 3 },
+        { 0x2E1A, 0, 3 },
+        { 0x2E1D, 0, 3 },
+        { 0x2E20, 0, 3 },
+        { 0x2E23, 0, 6 },
+        { 0x2E29, 0, 15 },
+        { 0x2E38, 0, 12 },
+        { 0x2E44, 0, 15 },
+        { 0x2E53, 0, 9 },
+        { 0x2E5C, 0, 15 },
+        { 0x2E6B, 0, 9 },
+        { 0x2E74, 0, 9 },
+        { 0x2E7D, 0, 18 },
+        { 0x2E8F, 0, 12 },
+        { 0x2E9B, 0, 9 },
+        { 0x2EA4, 0, 9 },
+        { 0x2EAD, 0, 9 },
+        { 0x2EB6, 0, 12 },
+        { 0x2EC2, 0, 12 },
+        { 0x2ECE, 0, 12 },
+        { 0x2EDA, 0, 12 },
+        { 0x2EE6, 0, 12 },
+        { 0x2EF2, 0, 12 },
+        { 0x2EFE, 0, 12 },
+        { 0x2F0A, 0, 18 },
+        { 0x2F1C, 0, 6 },
+        { 0x2F22, 0, 18 },
+        { 0x2F34, 0, 18 },
+        { 0x2F46, 0, 15 },
+        { 0x2F55, 0, 12 },
+        { 0x2F61, 0, 18 },
+        { 0x2F73, 0, 18 },
+        { 0x2F85, 0, 12 },
+        { 0x2F91, 0, 9 },
+        { 0x2F9A, 0, 9 },
+        { 0x2FA3, 0, 12 },
+        { 0x2FAF, 0, 12 },
+        { 0x2FBB, 0, 15 },
+        { 0x2FCA, 0, 15 },
+        { 0x2FD9, 0, 9 },
+        { 0x2FE2, 0, 9 },
+        { 0x2FEB, 0, 12 },
+        { 0x2FF7, 0, 9 },
+        { 0x3000, 0, 9 },
+        { 0x3009, 0, 6 },
+        { 0x300F, 0, 6 },
+        { 0x3015, 0, 9 },
+        { 0x301E, 0, 9 },
+        { 0x3027, 0, 18 },
+        { 0x3039, 0, 12 },
+        { 0x3045, 0, 15 },
+        { 0x3054, 0, 18 },
+        { 0x3066, 0, 12 },
+        { 0x3072, 0, 9 },
+        { 0x307B, 0, 9 },
+        { 0x3084, 0, 18 },
+        { 0x3096, 0, 12 },
+        { 0x30A2, 0, 18 },
+        { 0x30B4, 0, 9 },
+        { 0x30BD, 0, 15 },
+        { 0x30CC, 0, 9 },
+        { 0x30D5, 0, 12 },
+        { 0x30E1, 0, 9 },
+        { 0x30EA, 0, 12 },
+        { 0x30F6, 0, 15 },
+        { 0x3105, 0, 12 },
+        { 0x3111, 0, 15 },
+        { 0x3120, 0, 12 },
+        { 0x312C, 0, 6 },
+        { 0x3132, 0, 15 },
+        { 0x3141, 0, 9 },
+        { 0x314A, 0, 9 },
+        { 0x3153, 0, 12 },
+        { 0x315F, 0, 9 },
+        { 0x3168, 0, 9 },
+        { 0x3171, 0, 9 },
+        { 0x317A, 0, 15 },
+        { 0x3189, 0, 12 },
+        { 0x3195, 0, 6 },
+        { 0x319B, 0, 18 },
+        { 0x31AD, 0, 9 },
+        { 0x31B6, 0, 15 },
+        { 0x31C5, 0, 12 },
+        { 0x31D1, 0, 12 },
+        { 0x31DD, 0, 9 },
+        { 0x31E6, 0, 9 },
+        { 0x31EF, 0, 12 },
+        { 0x31FB, 0, 6 },
+        { 0x3201, 0, 12 },
+        { 0x320D, 0, 15 },
+        { 0x321C, 0, 6 },
+        { 0x3222, 0, 18 },
+        { 0x3234, 0, 9 },
+        { 0x323D, 0, 4 },
+        { 0x3241, 0, 4 },
+        { 0x3245, 0, 4 },
+        { 0x3249, 0, 4 },
+        { 0x324D, 0, 4 },
+        { 0x3251, 0, 4 },
+        { 0x3255, 0, 4 },
+        { 0x3259, 0, 4 },
+        { 0x325D, 0, 4 },
+        { 0x3261, 0, 4 },
+        { 0x3265, 0, 5 },
+        { 0x326A, 0, 5 },
+        { 0x326F, 0, 5 },
+        { 0x3274, 0, 5 },
+        { 0x3279, 0, 5 },
+        { 0x327E, 0, 5 },
+        { 0x3283, 0, 5 },
+        { 0x3288, 0, 5 },
+        { 0x328D, 0, 5 },
+        { 0x3292, 0, 5 },
+        { 0x3297, 0, 5 },
+        { 0x329C, 0, 5 },
+        { 0x32A1, 0, 5 },
+        { 0x32A6, 0, 5 },
+        { 0x32AB, 0, 5 },
+        { 0x32B0, 0, 3 },
+        { 0x32B3, 0, 2 },
+        { 0x32B5, 0, 2 },
+        { 0x32B7, 0, 3 },
+        { 0x32BA, 0, 2 },
+        { 0x32BC, 0, 2 },
+        { 0x32BE, 0, 2 },
+        { 0x32C0, 0, 3 },
+        { 0x32C3, 0, 3 },
+        { 0x32C6, 0, 2 },
+        { 0x32C8, 0, 6 },
+        { 0x32CE, 0, 6 },
+        { 0x32D4, 0, 6 },
+        { 0x32DA, 0, 6 },
+        { 0x32E0, 0, 12 },
+        { 0x32EC, 0, 2 },
+        { 0x32EE, 0, 2 },
+        { 0x32F0, 0, 3 },
+        { 0x32F3, 0, 2 },
+        { 0x32F5, 0, 2 },
+        { 0x32F7, 0, 2 },
+        { 0x32F9, 0, 2 },
+        { 0x32FB, 0, 2 },
+        { 0x32FD, 0, 3 },
+        { 0x3300, 0, 4 },
+        { 0x3304, 0, 2 },
+        { 0x3306, 0, 2 },
+        { 0x3308, 0, 3 },
+        { 0x330B, 0, 3 },
+        { 0x330E, 0, 2 },
+        { 0x3310, 0, 2 },
+        { 0x3312, 0, 2 },
+        { 0x3314, 0, 3 },
+        { 0x3317, 0, 3 },
+        { 0x331A, 0, 3 },
+        { 0x331D, 0, 3 },
+        { 0x3320, 0, 3 },
+        { 0x3323, 0, 2 },
+        { 0x3325, 0, 2 },
+        { 0x3327, 0, 2 },
+        { 0x3329, 0, 2 },
+        { 0x332B, 0, 2 },
+        { 0x332D, 0, 3 },
+        { 0x3330, 0, 2 },
+        { 0x3332, 0, 2 },
+        { 0x3334, 0, 2 },
+        { 0x3336, 0, 3 },
+        { 0x3339, 0, 3 },
+        { 0x333C, 0, 2 },
+        { 0x333E, 0, 3 },
+        { 0x3341, 0, 3 },
+        { 0x3344, 0, 3 },
+        { 0x3347, 0, 2 },
+        { 0x3349, 0, 3 },
+        { 0x334C, 0, 5 },
+        { 0x3351, 0, 6 },
+        { 0x3357, 0, 2 },
+        { 0x3359, 0, 3 },
+        { 0x335C, 0, 3 },
+        { 0x335F, 0, 3 },
+        { 0x3362, 0, 3 },
+        { 0x3365, 0, 7 },
+        { 0x336C, 0, 8 },
+        { 0x3374, 0, 2 },
+        { 0x3376, 0, 2 },
+        { 0x3378, 0, 3 },
+        { 0x337B, 0, 2 },
+        { 0x337D, 0, 2 },
+        { 0x337F, 0, 2 },
+        { 0x3381, 0, 3 },
+        { 0x3384, 0, 2 },
+        { 0x3386, 0, 2 },
+        { 0x3388, 0, 2 },
+        { 0x338A, 0, 2 },
+        { 0x338C, 0, 2 },
+        { 0x338E, 0, 3 },
+        { 0x3391, 0, 2 },
+        { 0x3393, 0, 2 },
+        { 0x3395, 0, 2 },
+        { 0x3397, 0, 3 },
+        { 0x339A, 0, 3 },
+        { 0x339D, 0, 4 },
+        { 0x33A1, 0, 2 },
+        { 0x33A3, 0, 2 },
+        { 0x33A5, 0, 2 },
+        { 0x33A7, 0, 6 },
+        { 0x33AD, 0, 3 },
+        { 0x33B0, 0, 2 },
+        { 0x33B2, 0, 2 },
+        { 0x33B4, 0, 2 },
+        { 0x33B6, 0, 2 },
+        { 0x33B8, 0, 2 },
+        { 0x33BA, 0, 2 },
+        { 0x33BC, 0, 2 },
+        { 0x33BE, 0, 2 },
+        { 0x33C0, 0, 2 },
+        { 0x33C2, 0, 2 },
+        { 0x33C4, 0, 3 },
+        { 0x33C7, 0, 2 },
+        { 0x33C9, 0, 2 },
+        { 0x33CB, 0, 3 },
+        { 0x33CE, 0, 3 },
+        { 0x33D1, 0, 2 },
+        { 0x33D3, 0, 4 },
+        { 0x33D7, 0, 3 },
+        { 0x33DA, 0, 2 },
+        { 0x33DC, 0, 2 },
+        { 0x33DE, 0, 2 },
+        { 0x33E0, 0, 2 },
+        { 0x33E2, 0, 5 },
+        { 0x33E7, 0, 5 },
+        { 0x33EC, 0, 4 },
+        { 0x33F0, 0, 4 },
+        { 0x33F4, 0, 4 },
+        { 0x33F8, 0, 4 },
+        { 0x33FC, 0, 4 },
+        { 0x3400, 0, 4 },
+        { 0x3404, 0, 4 },
+        { 0x3408, 0, 4 },
+        { 0x340C, 0, 4 },
+        { 0x3410, 0, 5 },
+        { 0x3415, 0, 5 },
+        { 0x341A, 0, 5 },
+        { 0x341F, 0, 5 },
+        { 0x3424, 0, 5 },
+        { 0x3429, 0, 5 },
+        { 0x342E, 0, 5 },
+        { 0x3433, 0, 5 },
+        { 0x3438, 0, 5 },
+        { 0x343D, 0, 5 },
+        { 0x3442, 0, 5 },
+        { 0x3447, 0, 5 },
+        { 0x344C, 0, 5 },
+        { 0x3451, 0, 5 },
+        { 0x3456, 0, 5 },
+        { 0x345B, 0, 5 },
+        { 0x3460, 0, 5 },
+        { 0x3465, 0, 5 },
+        { 0x346A, 0, 5 },
+        { 0x346F, 0, 5 },
+        { 0x3474, 0, 5 },
+        { 0x3479, 0, 5 },
+        { 0x347E, 0, 3 },
+        { 0x3481, 0, 2 },
+        { 0x3483, 0, 2 },
+        { 0x3485, 0, 3 },
+        { 0x3488, 0, 1 },
+        { 0x3489, 0, 1 },
+        { 0x348A, 0, 1 },
+        { 0x348B, 0, 2 },
+        { 0x348D, 0, 2 },
+        { 0x348F, 0, 3 },
+        { 0x3492, 0, 3 },
+        { 0x3495, 0, 2 },
+        { 0x3497, 0, 3 },
+        { 0x349A, 0, 2 },
+        { 0x349C, 3, 3 },
+        { 0x34A2, 3, 3 },
+        { 0x34A8, 3, 3 },
+        { 0x34AE, 3, 3 },
+        { 0x34B4, 3, 3 },
+        { 0x34BA, 3, 3 },
+        { 0x34C0, 3, 3 },
+        { 0x34C6, 3, 3 },
+        { 0x34CC, 3, 3 },
+        { 0x34D2, 3, 3 },
+        { 0x34D8, 3, 3 },
+        { 0x34DE, 3, 3 },
+        { 0x34E4, 3, 3 },
+        { 0x34EA, 3, 3 },
+        { 0x34F0, 3, 3 },
+        { 0x34F6, 3, 3 },
+        { 0x34FC, 3, 3 },
+        { 0x3502, 3, 3 },
+        { 0x3508, 3, 3 },
+        { 0x350E, 3, 3 },
+        { 0x3514, 3, 3 },
+        { 0x351A, 3, 3 },
+        { 0x3520, 3, 3 },
+        { 0x3526, 3, 3 },
+        { 0x352C, 3, 3 },
+        { 0x3532, 3, 3 },
+        { 0x3538, 3, 3 },
+        { 0x353E, 3, 3 },
+        { 0x3544, 3, 3 },
+        { 0x354A, 3, 3 },
+        { 0x3550, 3, 3 },
+        { 0x3556, 3, 3 },
+        { 0x355C, 3, 3 },
+        { 0x3562, 3, 3 },
+        { 0x3568, 3, 3 },
+        { 0x356E, 3, 3 },
+        { 0x3574, 3, 3 },
+        { 0x357A, 3, 3 },
+        { 0x3580, 3, 3 },
+        { 0x3586, 3, 3 },
+        { 0x358C, 3, 3 },
+        { 0x3592, 3, 3 },
+        { 0x3598, 3, 3 },
+        { 0x359E, 3, 3 },
+        { 0x35A4, 3, 3 },
+        { 0x35AA, 3, 3 },
+        { 0x35B0, 3, 3 },
+        { 0x35B6, 3, 3 },
+        { 0x35BC, 3, 3 },
+        { 0x35C2, 3, 3 },
+        { 0x35C8, 3, 3 },
+        { 0x35CE, 3, 3 },
+        { 0x35D4, 3, 3 },
+        { 0x35DA, 3, 3 },
+        { 0x35E0, 3, 3 },
+        { 0x35E6, 3, 3 },
+        { 0x35EC, 3, 3 },
+        { 0x35F2, 3, 3 },
+        { 0x35F8, 3, 3 },
+        { 0x35FE, 3, 3 },
+        { 0x3604, 3, 3 },
+        { 0x360A, 3, 3 },
+        { 0x3610, 3, 3 },
+        { 0x3616, 3, 3 },
+        { 0x361C, 3, 3 },
+        { 0x3622, 3, 3 },
+        { 0x3628, 3, 3 },
+        { 0x362E, 3, 3 },
+        { 0x3634, 3, 3 },
+        { 0x363A, 3, 3 },
+        { 0x3640, 3, 3 },
+        { 0x3646, 3, 3 },
+        { 0x364C, 3, 3 },
+        { 0x3652, 3, 3 },
+        { 0x3658, 3, 3 },
+        { 0x365E, 3, 3 },
+        { 0x3664, 3, 3 },
+        { 0x366A, 3, 3 },
+        { 0x3670, 3, 3 },
+        { 0x3676, 3, 3 },
+        { 0x367C, 3, 3 },
+        { 0x3682, 3, 3 },
+        { 0x3688, 3, 3 },
+        { 0x368E, 3, 3 },
+        { 0x3694, 3, 3 },
+        { 0x369A, 3, 3 },
+        { 0x36A0, 3, 3 },
+        { 0x36A6, 3, 3 },
+        { 0x36AC, 3, 3 },
+        { 0x36B2, 3, 3 },
+        { 0x36B8, 3, 3 },
+        { 0x36BE, 3, 3 },
+        { 0x36C4, 3, 3 },
+        { 0x36CA, 3, 3 },
+        { 0x36D0, 3, 3 },
+        { 0x36D6, 3, 3 },
+        { 0x36DC, 3, 3 },
+        { 0x36E2, 3, 3 },
+        { 0x36E8, 3, 3 },
+        { 0x36EE, 3, 3 },
+        { 0x36F4, 3, 3 },
+        { 0x36FA, 3, 3 },
+        { 0x3700, 3, 3 },
+        { 0x3706, 3, 3 },
+        { 0x370C, 3, 3 },
+        { 0x3712, 3, 3 },
+        { 0x3718, 3, 3 },
+        { 0x371E, 3, 3 },
+        { 0x3724, 3, 3 },
+        { 0x372A, 3, 3 },
+        { 0x3730, 3, 3 },
+        { 0x3736, 3, 3 },
+        { 0x373C, 3, 3 },
+        { 0x3742, 3, 3 },
+        { 0x3748, 3, 3 },
+        { 0x374E, 3, 3 },
+        { 0x3754, 3, 3 },
+        { 0x375A, 3, 3 },
+        { 0x3760, 3, 3 },
+        { 0x3766, 3, 3 },
+        { 0x376C, 3, 3 },
+        { 0x3772, 3, 3 },
+        { 0x3778, 3, 3 },
+        { 0x377E, 3, 3 },
+        { 0x3784, 3, 3 },
+        { 0x378A, 3, 3 },
+        { 0x3790, 3, 3 },
+        { 0x3796, 3, 3 },
+        { 0x379C, 3, 3 },
+        { 0x37A2, 3, 3 },
+        { 0x37A8, 3, 3 },
+        { 0x37AE, 3, 3 },
+        { 0x37B4, 3, 3 },
+        { 0x37BA, 3, 3 },
+        { 0x37C0, 3, 3 },
+        { 0x37C6, 3, 3 },
+        { 0x37CC, 3, 3 },
+        { 0x37D2, 3, 3 },
+        { 0x37D8, 3, 3 },
+        { 0x37DE, 3, 3 },
+        { 0x37E4, 3, 3 },
+        { 0x37EA, 3, 3 },
+        { 0x37F0, 3, 3 },
+        { 0x37F6, 3, 3 },
+        { 0x37FC, 3, 3 },
+        { 0x3802, 3, 3 },
+        { 0x3808, 3, 3 },
+        { 0x380E, 3, 3 },
+        { 0x3814, 3, 3 },
+        { 0x381A, 3, 3 },
+        { 0x3820, 3, 3 },
+        { 0x3826, 3, 3 },
+        { 0x382C, 3, 3 },
+        { 0x3832, 3, 3 },
+        { 0x3838, 3, 3 },
+        { 0x383E, 3, 3 },
+        { 0x3844, 3, 3 },
+        { 0x384A, 3, 3 },
+        { 0x3850, 3, 3 },
+        { 0x3856, 3, 3 },
+        { 0x385C, 3, 3 },
+        { 0x3862, 3, 3 },
+        { 0x3868, 3, 3 },
+        { 0x386E, 3, 3 },
+        { 0x3874, 3, 3 },
+        { 0x387A, 3, 3 },
+        { 0x3880, 3, 3 },
+        { 0x3886, 3, 3 },
+        { 0x388C, 3, 3 },
+        { 0x3892, 3, 3 },
+        { 0x3898, 3, 3 },
+        { 0x389E, 3, 3 },
+        { 0x38A4, 3, 3 },
+        { 0x38AA, 3, 3 },
+        { 0x38B0, 3, 3 },
+        { 0x38B6, 3, 3 },
+        { 0x38BC, 3, 3 },
+        { 0x38C2, 3, 3 },
+        { 0x38C8, 3, 3 },
+        { 0x38CE, 3, 3 },
+        { 0x38D4, 3, 3 },
+        { 0x38DA, 3, 3 },
+        { 0x38E0, 3, 3 },
+        { 0x38E6, 3, 3 },
+        { 0x38EC, 3, 3 },
+        { 0x38F2, 3, 3 },
+        { 0x38F8, 3, 3 },
+        { 0x38FE, 3, 3 },
+        { 0x3904, 3, 3 },
+        { 0x390A, 3, 3 },
+        { 0x3910, 3, 3 },
+        { 0x3916, 3, 3 },
+        { 0x391C, 3, 3 },
+        { 0x3922, 3, 3 },
+        { 0x3928, 3, 3 },
+        { 0x392E, 3, 3 },
+        { 0x3934, 3, 3 },
+        { 0x393A, 3, 3 },
+        { 0x3940, 3, 3 },
+        { 0x3946, 3, 3 },
+        { 0x394C, 3, 3 },
+        { 0x3952, 3, 3 },
+        { 0x3958, 3, 3 },
+        { 0x395E, 3, 3 },
+        { 0x3964, 3, 3 },
+        { 0x396A, 3, 3 },
+        { 0x3970, 3, 3 },
+        { 0x3976, 3, 3 },
+        { 0x397C, 3, 3 },
+        { 0x3982, 3, 3 },
+        { 0x3988, 3, 3 },
+        { 0x398E, 3, 3 },
+        { 0x3994, 3, 3 },
+        { 0x399A, 3, 3 },
+        { 0x39A0, 3, 3 },
+        { 0x39A6, 3, 3 },
+        { 0x39AC, 3, 3 },
+        { 0x39B2, 3, 3 },
+        { 0x39B8, 3, 3 },
+        { 0x39BE, 3, 3 },
+        { 0x39C4, 3, 3 },
+        { 0x39CA, 3, 3 },
+        { 0x39D0, 3, 3 },
+        { 0x39D6, 3, 3 },
+        { 0x39DC, 3, 3 },
+        { 0x39E2, 3, 3 },
+        { 0x39E8, 3, 3 },
+        { 0x39EE, 3, 3 },
+        { 0x39F4, 3, 3 },
+        { 0x39FA, 3, 3 },
+        { 0x3A00, 3, 3 },
+        { 0x3A06, 3, 3 },
+        { 0x3A0C, 3, 3 },
+        { 0x3A12, 3, 3 },
+        { 0x3A18, 3, 3 },
+        { 0x3A1E, 3, 3 },
+        { 0x3A24, 3, 3 },
+        { 0x3A2A, 3, 3 },
+        { 0x3A30, 3, 3 },
+        { 0x3A36, 3, 3 },
+        { 0x3A3C, 3, 3 },
+        { 0x3A42, 3, 3 },
+        { 0x3A48, 3, 3 },
+        { 0x3A4E, 3, 3 },
+        { 0x3A54, 3, 3 },
+        { 0x3A5A, 3, 3 },
+        { 0x3A60, 3, 3 },
+        { 0x3A66, 3, 3 },
+        { 0x3A6C, 3, 3 },
+        { 0x3A72, 3, 3 },
+        { 0x3A78, 3, 3 },
+        { 0x3A7E, 3, 3 },
+        { 0x3A84, 3, 3 },
+        { 0x3A8A, 3, 3 },
+        { 0x3A90, 3, 3 },
+        { 0x3A96, 3, 3 },
+        { 0x3A9C, 3, 3 },
+        { 0x3AA2, 3, 3 },
+        { 0x3AA8, 3, 3 },
+        { 0x3AAE, 3, 3 },
+        { 0x3AB4, 3, 3 },
+        { 0x3ABA, 3, 3 },
+        { 0x3AC0, 3, 3 },
+        { 0x3AC6, 3, 3 },
+        { 0x3ACC, 3, 3 },
+        { 0x3AD2, 3, 3 },
+        { 0x3AD8, 3, 3 },
+        { 0x3ADE, 3, 3 },
+        { 0x3AE4, 3, 3 },
+        { 0x3AEA, 3, 3 },
+        { 0x3AF0, 3, 3 },
+        { 0x3AF6, 3, 3 },
+        { 0x3AFC, 3, 3 },
+        { 0x3B02, 3, 3 },
+        { 0x3B08, 3, 3 },
+        { 0x3B0E, 3, 3 },
+        { 0x3B14, 3, 3 },
+        { 0x3B1A, 3, 3 },
+        { 0x3B20, 3, 3 },
+        { 0x3B26, 3, 3 },
+        { 0x3B2C, 3, 3 },
+        { 0x3B32, 3, 3 },
+        { 0x3B38, 3, 3 },
+        { 0x3B3E, 3, 3 },
+        { 0x3B44, 3, 3 },
+        { 0x3B4A, 3, 3 },
+        { 0x3B50, 3, 3 },
+        { 0x3B56, 3, 3 },
+        { 0x3B5C, 3, 3 },
+        { 0x3B62, 3, 3 },
+        { 0x3B68, 3, 3 },
+        { 0x3B6E, 3, 3 },
+        { 0x3B74, 3, 3 },
+        { 0x3B7A, 3, 3 },
+        { 0x3B80, 3, 3 },
+        { 0x3B86, 3, 3 },
+        { 0x3B8C, 3, 3 },
+        { 0x3B92, 3, 3 },
+        { 0x3B98, 3, 3 },
+        { 0x3B9E, 3, 3 },
+        { 0x3BA4, 3, 3 },
+        { 0x3BAA, 3, 3 },
+        { 0x3BB0, 3, 3 },
+        { 0x3BB6, 3, 3 },
+        { 0x3BBC, 3, 3 },
+        { 0x3BC2, 3, 3 },
+        { 0x3BC8, 3, 3 },
+        { 0x3BCE, 3, 3 },
+        { 0x3BD4, 3, 3 },
+        { 0x3BDA, 3, 3 },
+        { 0x3BE0, 3, 3 },
+        { 0x3BE6, 3, 3 },
+        { 0x3BEC, 3, 3 },
+        { 0x3BF2, 3, 3 },
+        { 0x3BF8, 3, 3 },
+        { 0x3BFE, 3, 3 },
+        { 0x3C04, 3, 3 },
+        { 0x3C0A, 3, 3 },
+        { 0x3C10, 3, 3 },
+        { 0x3C16, 3, 3 },
+        { 0x3C1C, 3, 3 },
+        { 0x3C22, 3, 3 },
+        { 0x3C28, 3, 3 },
+        { 0x3C2E, 3, 3 },
+        { 0x3C34, 3, 3 },
+        { 0x3C3A, 3, 3 },
+        { 0x3C40, 3, 3 },
+        { 0x3C46, 3, 3 },
+        { 0x3C4C, 3, 3 },
+        { 0x3C52, 3, 3 },
+        { 0x3C58, 3, 3 },
+        { 0x3C5E, 3, 3 },
+        { 0x3C64, 3, 3 },
+        { 0x3C6A, 3, 3 },
+        { 0x3C70, 3, 3 },
+        { 0x3C76, 3, 3 },
+        { 0x3C7C, 3, 3 },
+        { 0x3C82, 3, 3 },
+        { 0x3C88, 3, 3 },
+        { 0x3C8E, 3, 3 },
+        { 0x3C94, 3, 3 },
+        { 0x3C9A, 3, 3 },
+        { 0x3CA0, 3, 3 },
+        { 0x3CA6, 3, 3 },
+        { 0x3CAC, 3, 3 },
+        { 0x3CB2, 3, 3 },
+        { 0x3CB8, 3, 3 },
+        { 0x3CBE, 3, 3 },
+        { 0x3CC4, 3, 3 },
+        { 0x3CCA, 3, 3 },
+        { 0x3CD0, 3, 3 },
+        { 0x3CD6, 3, 3 },
+        { 0x3CDC, 4, 4 },
+        { 0x3CE4, 3, 3 },
+        { 0x3CEA, 3, 3 },
+        { 0x3CF0, 3, 3 },
+        { 0x3CF6, 3, 3 },
+        { 0x3CFC, 3, 3 },
+        { 0x3D02, 3, 3 },
+        { 0x3D08, 3, 3 },
+        { 0x3D0E, 3, 3 },
+        { 0x3D14, 3, 3 },
+        { 0x3D1A, 3, 3 },
+        { 0x3D20, 3, 3 },
+        { 0x3D26, 3, 3 },
+        { 0x3D2C, 3, 3 },
+        { 0x3D32, 3, 3 },
+        { 0x3D38, 3, 3 },
+        { 0x3D3E, 3, 3 },
+        { 0x3D44, 3, 3 },
+        { 0x3D4A, 3, 3 },
+        { 0x3D50, 3, 3 },
+        { 0x3D56, 3, 3 },
+        { 0x3D5C, 3, 3 },
+        { 0x3D62, 3, 3 },
+        { 0x3D68, 3, 3 },
+        { 0x3D6E, 3, 3 },
+        { 0x3D74, 3, 3 },
+        { 0x3D7A, 3, 3 },
+        { 0x3D80, 3, 3 },
+        { 0x3D86, 3, 3 },
+        { 0x3D8C, 3, 3 },
+        { 0x3D92, 3, 3 },
+        { 0x3D98, 3, 3 },
+        { 0x3D9E, 3, 3 },
+        { 0x3DA4, 3, 3 },
+        { 0x3DAA, 3, 3 },
+        { 0x3DB0, 3, 3 },
+        { 0x3DB6, 3, 3 },
+        { 0x3DBC, 3, 3 },
+        { 0x3DC2, 3, 3 },
+        { 0x3DC8, 3, 3 },
+        { 0x3DCE, 3, 3 },
+        { 0x3DD4, 3, 3 },
+        { 0x3DDA, 3, 3 },
+        { 0x3DE0, 3, 3 },
+        { 0x3DE6, 3, 3 },
+        { 0x3DEC, 3, 3 },
+        { 0x3DF2, 3, 3 },
+        { 0x3DF8, 3, 3 },
+        { 0x3DFE, 3, 3 },
+        { 0x3E04, 3, 3 },
+        { 0x3E0A, 3, 3 },
+        { 0x3E10, 3, 3 },
+        { 0x3E16, 3, 3 },
+        { 0x3E1C, 3, 3 },
+        { 0x3E22, 3, 3 },
+        { 0x3E28, 3, 3 },
+        { 0x3E2E, 3, 3 },
+        { 0x3E34, 3, 3 },
+        { 0x3E3A, 3, 3 },
+        { 0x3E40, 3, 3 },
+        { 0x3E46, 3, 3 },
+        { 0x3E4C, 3, 3 },
+        { 0x3E52, 3, 3 },
+        { 0x3E58, 3, 3 },
+        { 0x3E5E, 3, 3 },
+        { 0x3E64, 3, 3 },
+        { 0x3E6A, 3, 3 },
+        { 0x3E70, 3, 3 },
+        { 0x3E76, 3, 3 },
+        { 0x3E7C, 3, 3 },
+        { 0x3E82, 3, 3 },
+        { 0x3E88, 3, 3 },
+        { 0x3E8E, 3, 3 },
+        { 0x3E94, 3, 3 },
+        { 0x3E9A, 3, 3 },
+        { 0x3EA0, 3, 3 },
+        { 0x3EA6, 3, 3 },
+        { 0x3EAC, 3, 3 },
+        { 0x3EB2, 3, 3 },
+        { 0x3EB8, 3, 3 },
+        { 0x3EBE, 3, 3 },
+        { 0x3EC4, 3, 3 },
+        { 0x3ECA, 3, 3 },
+        { 0x3ED0, 3, 3 },
+        { 0x3ED6, 3, 3 },
+        { 0x3EDC, 3, 3 },
+        { 0x3EE2, 3, 3 },
+        { 0x3EE8, 3, 3 },
+        { 0x3EEE, 3, 3 },
+        { 0x3EF4, 3, 3 },
+        { 0x3EFA, 3, 3 },
+        { 0x3F00, 3, 3 },
+        { 0x3F06, 3, 3 },
+        { 0x3F0C, 3, 3 },
+        { 0x3F12, 3, 3 },
+        { 0x3F18, 3, 3 },
+        { 0x3F1E, 3, 3 },
+        { 0x3F24, 4, 4 },
+        { 0x3F2C, 4, 4 },
+        { 0x3F34, 4, 4 },
+        { 0x3F3C, 3, 3 },
+        { 0x3F42, 3, 3 },
+        { 0x3F48, 3, 3 },
+        { 0x3F4E, 4, 4 },
+        { 0x3F56, 4, 4 },
+        { 0x3F5E, 4, 4 },
+        { 0x3F66, 3, 3 },
+        { 0x3F6C, 3, 3 },
+        { 0x3F72, 0, 2 },
+        { 0x3F74, 0, 2 },
+        { 0x3F76, 0, 2 },
+        { 0x3F78, 0, 3 },
+        { 0x3F7B, 0, 3 },
+        { 0x3F7E, 0, 2 },
+        { 0x3F80, 0, 2 },
+        { 0x3F82, 0, 4 },
+        { 0x3F86, 0, 4 },
+        { 0x3F8A, 0, 4 },
+        { 0x3F8E, 0, 4 },
+        { 0x3F92, 0, 4 },
+        { 0x3F96, 4, 4 },
+        { 0x3F9E, 4, 4 },
+        { 0x3FA6, 0, 2 },
+        { 0x3FA8, 0, 2 },
+        { 0x3FAA, 0, 2 },
+        { 0x3FAC, 0, 2 },
+        { 0x3FAE, 0, 2 },
+        { 0x3FB0, 0, 2 },
+        { 0x3FB2, 0, 2 },
+        { 0x3FB4, 0, 2 },
+        { 0x3FB6, 0, 2 },
+        { 0x3FB8, 0, 1 },
+        { 0x3FB9, 4, 4 },
+        { 0x3FC1, 4, 4 },
+        { 0x3FC9, 6, 6 },
+        { 0x3FD5, 6, 6 },
+        { 0x3FE1, 4, 4 },
+        { 0x3FE9, 4, 4 },
+        { 0x3FF1, 4, 4 },
+        { 0x3FF9, 4, 4 },
+        { 0x4001, 4, 4 },
+        { 0x4009, 4, 4 },
+        { 0x4011, 4, 4 },
+        { 0x4019, 4, 4 },
+        { 0x4021, 4, 4 },
+        { 0x4029, 4, 4 },
+        { 0x4031, 4, 4 },
+        { 0x4039, 4, 4 },
+        { 0x4041, 4, 4 },
+        { 0x4049, 4, 4 },
+        { 0x4051, 4, 4 },
+        { 0x4059, 4, 4 },
+        { 0x4061, 4, 4 },
+        { 0x4069, 4, 4 },
+        { 0x4071, 4, 4 },
+        { 0x4079, 4, 4 },
+        { 0x4081, 4, 4 },
+        { 0x4089, 4, 4 },
+        { 0x4091, 4, 4 },
+        { 0x4099, 4, 4 },
+        { 0x40A1, 4, 4 },
+        { 0x40A9, 4, 4 },
+        { 0x40B1, 4, 4 },
+        { 0x40B9, 4, 4 },
+        { 0x40C1, 0, 4 },
+        { 0x40C5, 0, 2 },
+        { 0x40C7, 0, 2 },
+        { 0x40C9, 0, 2 },
+        { 0x40CB, 0, 2 },
+        { 0x40CD, 0, 2 },
+        { 0x40CF, 0, 2 },
+        { 0x40D1, 0, 2 },
+        { 0x40D3, 0, 2 },
+        { 0x40D5, 0, 2 },
+        { 0x40D7, 0, 2 },
+        { 0x40D9, 0, 2 },
+        { 0x40DB, 0, 2 },
+        { 0x40DD, 0, 2 },
+        { 0x40DF, 0, 2 },
+        { 0x40E1, 0, 2 },
+        { 0x40E3, 0, 2 },
+        { 0x40E5, 0, 2 },
+        { 0x40E7, 0, 2 },
+        { 0x40E9, 0, 2 },
+        { 0x40EB, 0, 2 },
+        { 0x40ED, 0, 2 },
+        { 0x40EF, 0, 2 },
+        { 0x40F1, 0, 2 },
+        { 0x40F3, 0, 2 },
+        { 0x40F5, 0, 2 },
+        { 0x40F7, 0, 2 },
+        { 0x40F9, 0, 2 },
+        { 0x40FB, 0, 2 },
+        { 0x40FD, 0, 2 },
+        { 0x40FF, 0, 2 },
+        { 0x4101, 0, 2 },
+        { 0x4103, 0, 2 },
+        { 0x4105, 0, 2 },
+        { 0x4107, 0, 2 },
+        { 0x4109, 0, 2 },
+        { 0x410B, 0, 2 },
+        { 0x410D, 0, 2 },
+        { 0x410F, 0, 2 },
+        { 0x4111, 0, 2 },
+        { 0x4113, 0, 2 },
+        { 0x4115, 0, 2 },
+        { 0x4117, 0, 2 },
+        { 0x4119, 0, 2 },
+        { 0x411B, 0, 2 },
+        { 0x411D, 0, 2 },
+        { 0x411F, 0, 2 },
+        { 0x4121, 0, 2 },
+        { 0x4123, 0, 2 },
+        { 0x4125, 0, 2 },
+        { 0x4127, 0, 2 },
+        { 0x4129, 0, 2 },
+        { 0x412B, 0, 2 },
+        { 0x412D, 0, 2 },
+        { 0x412F, 0, 2 },
+        { 0x4131, 0, 2 },
+        { 0x4133, 0, 2 },
+        { 0x4135, 0, 2 },
+        { 0x4137, 0, 2 },
+        { 0x4139, 0, 2 },
+        { 0x413B, 0, 2 },
+        { 0x413D, 0, 2 },
+        { 0x413F, 0, 2 },
+        { 0x4141, 0, 2 },
+        { 0x4143, 0, 2 },
+        { 0x4145, 0, 2 },
+        { 0x4147, 0, 2 },
+        { 0x4149, 0, 2 },
+        { 0x414B, 0, 2 },
+        { 0x414D, 0, 2 },
+        { 0x414F, 0, 2 },
+        { 0x4151, 0, 2 },
+        { 0x4153, 0, 2 },
+        { 0x4155, 0, 2 },
+        { 0x4157, 0, 2 },
+        { 0x4159, 0, 2 },
+        { 0x415B, 0, 2 },
+        { 0x415D, 0, 2 },
+        { 0x415F, 0, 2 },
+        { 0x4161, 0, 2 },
+        { 0x4163, 0, 2 },
+        { 0x4165, 0, 2 },
+        { 0x4167, 0, 2 },
+        { 0x4169, 0, 2 },
+        { 0x416B, 0, 2 },
+        { 0x416D, 0, 4 },
+        { 0x4171, 0, 4 },
+        { 0x4175, 0, 2 },
+        { 0x4177, 0, 2 },
+        { 0x4179, 0, 2 },
+        { 0x417B, 0, 2 },
+        { 0x417D, 0, 2 },
+        { 0x417F, 0, 2 },
+        { 0x4181, 0, 2 },
+        { 0x4183, 0, 2 },
+        { 0x4185, 0, 2 },
+        { 0x4187, 0, 2 },
+        { 0x4189, 0, 4 },
+        { 0x418D, 0, 4 },
+        { 0x4191, 0, 2 },
+        { 0x4193, 0, 2 },
+        { 0x4195, 0, 2 },
+        { 0x4197, 0, 2 },
+        { 0x4199, 0, 2 },
+        { 0x419B, 0, 2 },
+        { 0x419D, 0, 2 },
+        { 0x419F, 0, 2 },
+        { 0x41A1, 0, 2 },
+        { 0x41A3, 0, 2 },
+        { 0x41A5, 0, 4 },
+        { 0x41A9, 0, 2 },
+        { 0x41AB, 0, 2 },
+        { 0x41AD, 0, 2 },
+        { 0x41AF, 0, 2 },
+        { 0x41B1, 0, 2 },
+        { 0x41B3, 0, 2 },
+        { 0x41B5, 0, 2 },
+        { 0x41B7, 0, 2 },
+        { 0x41B9, 0, 2 },
+        { 0x41BB, 0, 2 },
+        { 0x41BD, 0, 2 },
+        { 0x41BF, 0, 2 },
+        { 0x41C1, 0, 6 },
+        { 0x41C7, 0, 6 },
+        { 0x41CD, 0, 6 },
+        { 0x41D3, 0, 6 },
+        { 0x41D9, 0, 6 },
+        { 0x41DF, 0, 6 },
+        { 0x41E5, 0, 6 },
+        { 0x41EB, 0, 6 },
+        { 0x41F1, 0, 6 },
+        { 0x41F7, 0, 6 },
+        { 0x41FD, 0, 6 },
+        { 0x4203, 0, 6 },
+        { 0x4209, 0, 6 },
+        { 0x420F, 0, 6 },
+        { 0x4215, 0, 6 },
+        { 0x421B, 0, 6 },
+        { 0x4221, 0, 6 },
+        { 0x4227, 0, 6 },
+        { 0x422D, 0, 2 },
+        { 0x422F, 0, 2 },
+        { 0x4231, 0, 2 },
+        { 0x4233, 0, 2 },
+        { 0x4235, 0, 6 },
+        { 0x423B, 0, 6 },
+        { 0x4241, 0, 6 },
+        { 0x4247, 0, 6 },
+        { 0x424D, 0, 6 },
+        { 0x4253, 0, 4 },
+        { 0x4257, 0, 4 },
+        { 0x425B, 0, 4 },
+        { 0x425F, 0, 4 },
+        { 0x4263, 0, 4 },
+        { 0x4267, 0, 4 },
+        { 0x426B, 0, 4 },
+        { 0x426F, 0, 4 },
+        { 0x4273, 0, 4 },
+        { 0x4277, 0, 4 },
+        { 0x427B, 0, 4 },
+        { 0x427F, 0, 4 },
+        { 0x4283, 0, 4 },
+        { 0x4287, 0, 4 },
+        { 0x428B, 0, 4 },
+        { 0x428F, 0, 4 },
+        { 0x4293, 0, 4 },
+        { 0x4297, 0, 4 },
+        { 0x429B, 0, 4 },
+        { 0x429F, 0, 4 },
+        { 0x42A3, 0, 4 },
+        { 0x42A7, 0, 4 },
+        { 0x42AB, 0, 4 },
+        { 0x42AF, 0, 4 },
+        { 0x42B3, 0, 4 },
+        { 0x42B7, 0, 4 },
+        { 0x42BB, 0, 4 },
+        { 0x42BF, 0, 4 },
+        { 0x42C3, 0, 4 },
+        { 0x42C7, 0, 4 },
+        { 0x42CB, 0, 4 },
+        { 0x42CF, 0, 4 },
+        { 0x42D3, 0, 4 },
+        { 0x42D7, 0, 4 },
+        { 0x42DB, 0, 4 },
+        { 0x42DF, 0, 4 },
+        { 0x42E3, 0, 4 },
+        { 0x42E7, 0, 4 },
+        { 0x42EB, 0, 4 },
+        { 0x42EF, 0, 4 },
+        { 0x42F3, 0, 4 },
+        { 0x42F7, 0, 4 },
+        { 0x42FB, 0, 4 },
+        { 0x42FF, 0, 4 },
+        { 0x4303, 0, 4 },
+        { 0x4307, 0, 4 },
+        { 0x430B, 0, 4 },
+        { 0x430F, 0, 4 },
+        { 0x4313, 0, 4 },
+        { 0x4317, 0, 4 },
+        { 0x431B, 0, 4 },
+        { 0x431F, 0, 4 },
+        { 0x4323, 0, 4 },
+        { 0x4327, 0, 4 },
+        { 0x432B, 0, 4 },
+        { 0x432F, 0, 4 },
+        { 0x4333, 0, 4 },
+        { 0x4337, 0, 4 },
+        { 0x433B, 0, 4 },
+        { 0x433F, 0, 4 },
+        { 0x4343, 0, 4 },
+        { 0x4347, 0, 4 },
+        { 0x434B, 0, 4 },
+        { 0x434F, 0, 4 },
+        { 0x4353, 0, 4 },
+        { 0x4357, 0, 4 },
+        { 0x435B, 0, 4 },
+        { 0x435F, 0, 4 },
+        { 0x4363, 0, 4 },
+        { 0x4367, 0, 4 },
+        { 0x436B, 0, 4 },
+        { 0x436F, 0, 4 },
+        { 0x4373, 0, 4 },
+        { 0x4377, 0, 4 },
+        { 0x437B, 0, 4 },
+        { 0x437F, 0, 4 },
+        { 0x4383, 0, 4 },
+        { 0x4387, 0, 4 },
+        { 0x438B, 0, 4 },
+        { 0x438F, 0, 4 },
+        { 0x4393, 0, 4 },
+        { 0x4397, 0, 4 },
+        { 0x439B, 0, 4 },
+        { 0x439F, 0, 4 },
+        { 0x43A3, 0, 4 },
+        { 0x43A7, 0, 4 },
+        { 0x43AB, 0, 4 },
+        { 0x43AF, 0, 4 },
+        { 0x43B3, 0, 4 },
+        { 0x43B7, 0, 5 },
+        { 0x43BC, 0, 5 },
+        { 0x43C1, 0, 5 },
+        { 0x43C6, 0, 5 },
+        { 0x43CB, 0, 5 },
+        { 0x43D0, 0, 5 },
+        { 0x43D5, 0, 6 },
+        { 0x43DB, 0, 6 },
+        { 0x43E1, 0, 6 },
+        { 0x43E7, 0, 6 },
+        { 0x43ED, 0, 6 },
+        { 0x43F3, 0, 6 },
+        { 0x43F9, 0, 4 },
+        { 0x43FD, 0, 4 },
+        { 0x4401, 0, 4 },
+        { 0x4405, 0, 4 },
+        { 0x4409, 0, 4 },
+        { 0x440D, 0, 4 },
+        { 0x4411, 0, 4 },
+        { 0x4415, 0, 4 },
+        { 0x4419, 0, 4 },
+        { 0x441D, 0, 4 },
+        { 0x4421, 0, 4 },
+        { 0x4425, 0, 4 },
+        { 0x4429, 0, 4 },
+        { 0x442D, 0, 4 },
+        { 0x4431, 0, 4 },
+        { 0x4435, 0, 4 },
+        { 0x4439, 0, 4 },
+        { 0x443D, 0, 4 },
+        { 0x4441, 0, 4 },
+        { 0x4445, 0, 4 },
+        { 0x4449, 0, 4 },
+        { 0x444D, 0, 4 },
+        { 0x4451, 0, 4 },
+        { 0x4455, 0, 4 },
+        { 0x4459, 0, 4 },
+        { 0x445D, 0, 4 },
+        { 0x4461, 0, 4 },
+        { 0x4465, 0, 4 },
+        { 0x4469, 0, 4 },
+        { 0x446D, 0, 4 },
+        { 0x4471, 0, 4 },
+        { 0x4475, 0, 4 },
+        { 0x4479, 0, 4 },
+        { 0x447D, 0, 4 },
+        { 0x4481, 0, 4 },
+        { 0x4485, 0, 4 },
+        { 0x4489, 0, 4 },
+        { 0x448D, 0, 4 },
+        { 0x4491, 0, 4 },
+        { 0x4495, 0, 4 },
+        { 0x4499, 0, 4 },
+        { 0x449D, 0, 4 },
+        { 0x44A1, 0, 4 },
+        { 0x44A5, 0, 4 },
+        { 0x44A9, 0, 4 },
+        { 0x44AD, 0, 6 },
+        { 0x44B3, 0, 6 },
+        { 0x44B9, 0, 6 },
+        { 0x44BF, 0, 6 },
+        { 0x44C5, 0, 6 },
+        { 0x44CB, 0, 4 },
+        { 0x44CF, 0, 4 },
+        { 0x44D3, 0, 4 },
+        { 0x44D7, 0, 4 },
+        { 0x44DB, 0, 4 },
+        { 0x44DF, 0, 4 },
+        { 0x44E3, 0, 4 },
+        { 0x44E7, 0, 4 },
+        { 0x44EB, 0, 4 },
+        { 0x44EF, 0, 4 },
+        { 0x44F3, 0, 4 },
+        { 0x44F7, 0, 4 },
+        { 0x44FB, 0, 4 },
+        { 0x44FF, 0, 4 },
+        { 0x4503, 0, 4 },
+        { 0x4507, 0, 4 },
+        { 0x450B, 0, 4 },
+        { 0x450F, 0, 4 },
+        { 0x4513, 0, 4 },
+        { 0x4517, 0, 4 },
+        { 0x451B, 0, 4 },
+        { 0x451F, 0, 4 },
+        { 0x4523, 0, 4 },
+        { 0x4527, 0, 4 },
+        { 0x452B, 0, 4 },
+        { 0x452F, 0, 4 },
+        { 0x4533, 0, 4 },
+        { 0x4537, 0, 4 },
+        { 0x453B, 0, 4 },
+        { 0x453F, 0, 4 },
+        { 0x4543, 0, 4 },
+        { 0x4547, 0, 4 },
+        { 0x454B, 0, 4 },
+        { 0x454F, 0, 4 },
+        { 0x4553, 0, 4 },
+        { 0x4557, 0, 4 },
+        { 0x455B, 0, 4 },
+        { 0x455F, 0, 4 },
+        { 0x4563, 0, 4 },
+        { 0x4567, 0, 4 },
+        { 0x456B, 0, 4 },
+        { 0x456F, 0, 4 },
+        { 0x4573, 0, 4 },
+        { 0x4577, 0, 4 },
+        { 0x457B, 0, 4 },
+        { 0x457F, 0, 4 },
+        { 0x4583, 0, 4 },
+        { 0x4587, 0, 4 },
+        { 0x458B, 0, 4 },
+        { 0x458F, 0, 4 },
+        { 0x4593, 0, 4 },
+        { 0x4597, 0, 4 },
+        { 0x459B, 0, 4 },
+        { 0x459F, 0, 4 },
+        { 0x45A3, 0, 4 },
+        { 0x45A7, 0, 4 },
+        { 0x45AB, 0, 4 },
+        { 0x45AF, 0, 4 },
+        { 0x45B3, 0, 4 },
+        { 0x45B7, 0, 4 },
+        { 0x45BB, 0, 4 },
+        { 0x45BF, 0, 4 },
+        { 0x45C3, 0, 4 },
+        { 0x45C7, 0, 4 },
+        { 0x45CB, 0, 4 },
+        { 0x45CF, 0, 4 },
+        { 0x45D3, 0, 4 },
+        { 0x45D7, 0, 6 },
+        { 0x45DD, 0, 6 },
+        { 0x45E3, 0, 4 },
+        { 0x45E7, 0, 4 },
+        { 0x45EB, 0, 4 },
+        { 0x45EF, 0, 4 },
+        { 0x45F3, 0, 4 },
+        { 0x45F7, 0, 4 },
+        { 0x45FB, 0, 4 },
+        { 0x45FF, 0, 4 },
+        { 0x4603, 0, 4 },
+        { 0x4607, 0, 4 },
+        { 0x460B, 0, 4 },
+        { 0x460F, 0, 4 },
+        { 0x4613, 0, 4 },
+        { 0x4617, 0, 4 },
+        { 0x461B, 0, 4 },
+        { 0x461F, 0, 4 },
+        { 0x4623, 0, 4 },
+        { 0x4627, 0, 6 },
+        { 0x462D, 0, 6 },
+        { 0x4633, 0, 6 },
+        { 0x4639, 0, 4 },
+        { 0x463D, 0, 4 },
+        { 0x4641, 0, 4 },
+        { 0x4645, 0, 4 },
+        { 0x4649, 0, 4 },
+        { 0x464D, 0, 4 },
+        { 0x4651, 0, 4 },
+        { 0x4655, 0, 4 },
+        { 0x4659, 0, 4 },
+        { 0x465D, 0, 4 },
+        { 0x4661, 0, 4 },
+        { 0x4665, 0, 4 },
+        { 0x4669, 0, 4 },
+        { 0x466D, 0, 4 },
+        { 0x4671, 0, 4 },
+        { 0x4675, 0, 4 },
+        { 0x4679, 0, 4 },
+        { 0x467D, 0, 4 },
+        { 0x4681, 0, 4 },
+        { 0x4685, 0, 4 },
+        { 0x4689, 0, 4 },
+        { 0x468D, 0, 4 },
+        { 0x4691, 0, 4 },
+        { 0x4695, 0, 4 },
+        { 0x4699, 0, 4 },
+        { 0x469D, 0, 4 },
+        { 0x46A1, 0, 4 },
+        { 0x46A5, 0, 4 },
+        { 0x46A9, 0, 4 },
+        { 0x46AD, 0, 4 },
+        { 0x46B1, 0, 4 },
+        { 0x46B5, 0, 4 },
+        { 0x46B9, 0, 4 },
+        { 0x46BD, 0, 4 },
+        { 0x46C1, 0, 4 },
+        { 0x46C5, 0, 4 },
+        { 0x46C9, 0, 4 },
+        { 0x46CD, 0, 4 },
+        { 0x46D1, 0, 4 },
+        { 0x46D5, 0, 4 },
+        { 0x46D9, 0, 4 },
+        { 0x46DD, 0, 4 },
+        { 0x46E1, 0, 4 },
+        { 0x46E5, 0, 4 },
+        { 0x46E9, 0, 4 },
+        { 0x46ED, 0, 4 },
+        { 0x46F1, 0, 4 },
+        { 0x46F5, 0, 4 },
+        { 0x46F9, 0, 4 },
+        { 0x46FD, 0, 4 },
+        { 0x4701, 0, 4 },
+        { 0x4705, 0, 4 },
+        { 0x4709, 0, 4 },
+        { 0x470D, 0, 4 },
+        { 0x4711, 0, 4 },
+        { 0x4715, 0, 4 },
+        { 0x4719, 0, 4 },
+        { 0x471D, 0, 4 },
+        { 0x4721, 0, 4 },
+        { 0x4725, 0, 4 },
+        { 0x4729, 0, 4 },
+        { 0x472D, 0, 4 },
+        { 0x4731, 0, 4 },
+        { 0x4735, 0, 4 },
+        { 0x4739, 0, 4 },
+        { 0x473D, 0, 4 },
+        { 0x4741, 0, 4 },
+        { 0x4745, 0, 4 },
+        { 0x4749, 0, 4 },
+        { 0x474D, 0, 4 },
+        { 0x4751, 0, 4 },
+        { 0x4755, 0, 4 },
+        { 0x4759, 0, 4 },
+        { 0x475D, 0, 6 },
+        { 0x4763, 0, 6 },
+        { 0x4769, 0, 6 },
+        { 0x476F, 0, 6 },
+        { 0x4775, 0, 6 },
+        { 0x477B, 0, 6 },
+        { 0x4781, 0, 6 },
+        { 0x4787, 0, 6 },
+        { 0x478D, 0, 6 },
+        { 0x4793, 0, 6 },
+        { 0x4799, 0, 6 },
+        { 0x479F, 0, 6 },
+        { 0x47A5, 0, 6 },
+        { 0x47AB, 0, 6 },
+        { 0x47B1, 0, 6 },
+        { 0x47B7, 0, 6 },
+        { 0x47BD, 0, 6 },
+        { 0x47C3, 0, 6 },
+        { 0x47C9, 0, 6 },
+        { 0x47CF, 0, 6 },
+        { 0x47D5, 0, 6 },
+        { 0x47DB, 0, 6 },
+        { 0x47E1, 0, 6 },
+        { 0x47E7, 0, 6 },
+        { 0x47ED, 0, 6 },
+        { 0x47F3, 0, 6 },
+        { 0x47F9, 0, 6 },
+        { 0x47FF, 0, 6 },
+        { 0x4805, 0, 6 },
+        { 0x480B, 0, 6 },
+        { 0x4811, 0, 6 },
+        { 0x4817, 0, 6 },
+        { 0x481D, 0, 6 },
+        { 0x4823, 0, 6 },
+        { 0x4829, 0, 6 },
+        { 0x482F, 0, 6 },
+        { 0x4835, 0, 6 },
+        { 0x483B, 0, 6 },
+        { 0x4841, 0, 6 },
+        { 0x4847, 0, 6 },
+        { 0x484D, 0, 6 },
+        { 0x4853, 0, 6 },
+        { 0x4859, 0, 6 },
+        { 0x485F, 0, 6 },
+        { 0x4865, 0, 6 },
+        { 0x486B, 0, 6 },
+        { 0x4871, 0, 6 },
+        { 0x4877, 0, 6 },
+        { 0x487D, 0, 6 },
+        { 0x4883, 0, 6 },
+        { 0x4889, 0, 6 },
+        { 0x488F, 0, 6 },
+        { 0x4895, 0, 6 },
+        { 0x489B, 0, 6 },
+        { 0x48A1, 0, 6 },
+        { 0x48A7, 0, 6 },
+        { 0x48AD, 0, 6 },
+        { 0x48B3, 0, 6 },
+        { 0x48B9, 0, 6 },
+        { 0x48BF, 0, 6 },
+        { 0x48C5, 0, 6 },
+        { 0x48CB, 0, 6 },
+        { 0x48D1, 0, 6 },
+        { 0x48D7, 0, 6 },
+        { 0x48DD, 0, 6 },
+        { 0x48E3, 0, 6 },
+        { 0x48E9, 0, 6 },
+        { 0x48EF, 0, 6 },
+        { 0x48F5, 0, 6 },
+        { 0x48FB, 0, 6 },
+        { 0x4901, 0, 6 },
+        { 0x4907, 0, 6 },
+        { 0x490D, 0, 6 },
+        { 0x4913, 0, 6 },
+        { 0x4919, 0, 6 },
+        { 0x491F, 0, 6 },
+        { 0x4925, 0, 6 },
+        { 0x492B, 0, 6 },
+        { 0x4931, 0, 6 },
+        { 0x4937, 0, 6 },
+        { 0x493D, 0, 6 },
+        { 0x4943, 0, 6 },
+        { 0x4949, 0, 6 },
+        { 0x494F, 0, 6 },
+        { 0x4955, 0, 6 },
+        { 0x495B, 0, 6 },
+        { 0x4961, 0, 6 },
+        { 0x4967, 0, 6 },
+        { 0x496D, 0, 6 },
+        { 0x4973, 0, 6 },
+        { 0x4979, 0, 6 },
+        { 0x497F, 0, 6 },
+        { 0x4985, 0, 6 },
+        { 0x498B, 0, 6 },
+        { 0x4991, 0, 6 },
+        { 0x4997, 0, 6 },
+        { 0x499D, 0, 6 },
+        { 0x49A3, 0, 6 },
+        { 0x49A9, 0, 6 },
+        { 0x49AF, 0, 6 },
+        { 0x49B5, 0, 6 },
+        { 0x49BB, 0, 6 },
+        { 0x49C1, 0, 6 },
+        { 0x49C7, 0, 6 },
+        { 0x49CD, 0, 6 },
+        { 0x49D3, 0, 6 },
+        { 0x49D9, 0, 6 },
+        { 0x49DF, 0, 6 },
+        { 0x49E5, 0, 6 },
+        { 0x49EB, 0, 6 },
+        { 0x49F1, 0, 6 },
+        { 0x49F7, 0, 6 },
+        { 0x49FD, 0, 6 },
+        { 0x4A03, 0, 6 },
+        { 0x4A09, 0, 6 },
+        { 0x4A0F, 0, 6 },
+        { 0x4A15, 0, 6 },
+        { 0x4A1B, 0, 6 },
+        { 0x4A21, 0, 6 },
+        { 0x4A27, 0, 6 },
+        { 0x4A2D, 0, 8 },
+        { 0x4A35, 0, 8 },
+        { 0x4A3D, 0, 8 },
+        { 0x4A45, 0, 8 },
+        { 0x4A4D, 0, 8 },
+        { 0x4A55, 0, 8 },
+        { 0x4A5D, 0, 8 },
+        { 0x4A65, 0, 6 },
+        { 0x4A6B, 0, 33 },
+        { 0x4A8C, 0, 15 },
+        { 0x4A9B, 0, 8 },
+        { 0x4AA3, 0, 1 },
+        { 0x4AA4, 0, 3 },
+        { 0x4AA7, 0, 3 },
+        { 0x4AAA, 0, 1 },
+        { 0x4AAB, 0, 1 },
+        { 0x4AAC, 0, 1 },
+        { 0x4AAD, 0, 1 },
+        { 0x4AAE, 0, 3 },
+        { 0x4AB1, 0, 3 },
+        { 0x4AB4, 0, 3 },
+        { 0x4AB7, 0, 2 },
+        { 0x4AB9, 0, 3 },
+        { 0x4ABC, 0, 3 },
+        { 0x4ABF, 0, 1 },
+        { 0x4AC0, 0, 1 },
+        { 0x4AC1, 0, 1 },
+        { 0x4AC2, 0, 1 },
+        { 0x4AC3, 0, 1 },
+        { 0x4AC4, 0, 1 },
+        { 0x4AC5, 0, 3 },
+        { 0x4AC8, 0, 3 },
+        { 0x4ACB, 0, 3 },
+        { 0x4ACE, 0, 3 },
+        { 0x4AD1, 0, 3 },
+        { 0x4AD4, 0, 3 },
+        { 0x4AD7, 0, 3 },
+        { 0x4ADA, 0, 3 },
+        { 0x4ADD, 0, 3 },
+        { 0x4AE0, 0, 3 },
+        { 0x4AE3, 0, 3 },
+        { 0x4AE6, 0, 3 },
+        { 0x4AE9, 0, 1 },
+        { 0x4AEA, 0, 1 },
+        { 0x4AEB, 0, 3 },
+        { 0x4AEE, 0, 3 },
+        { 0x4AF1, 0, 3 },
+        { 0x4AF4, 0, 3 },
+        { 0x4AF7, 0, 1 },
+        { 0x4AF8, 0, 1 },
+        { 0x4AF9, 0, 1 },
+        { 0x4AFA, 0, 1 },
+        { 0x4AFB, 0, 3 },
+        { 0x4AFE, 0, 1 },
+        { 0x4AFF, 0, 1 },
+        { 0x4B00, 0, 1 },
+        { 0x4B01, 0, 1 },
+        { 0x4B02, 0, 1 },
+        { 0x4B03, 0, 3 },
+        { 0x4B06, 0, 1 },
+        { 0x4B07, 0, 1 },
+        { 0x4B08, 0, 1 },
+        { 0x4B09, 0, 1 },
+        { 0x4B0A, 0, 3 },
+        { 0x4B0D, 0, 3 },
+        { 0x4B10, 0, 1 },
+        { 0x4B11, 0, 1 },
+        { 0x4B12, 0, 1 },
+        { 0x4B13, 0, 1 },
+        { 0x4B14, 0, 1 },
+        { 0x4B15, 0, 1 },
+        { 0x4B16, 0, 1 },
+        { 0x4B17, 0, 1 },
+        { 0x4B18, 0, 1 },
+        { 0x4B19, 0, 1 },
+        { 0x4B1A, 0, 1 },
+        { 0x4B1B, 0, 1 },
+        { 0x4B1C, 0, 3 },
+        { 0x4B1F, 0, 4 },
+        { 0x4B23, 0, 3 },
+        { 0x4B26, 0, 3 },
+        { 0x4B29, 0, 3 },
+        { 0x4B2C, 0, 4 },
+        { 0x4B30, 0, 3 },
+        { 0x4B33, 0, 4 },
+        { 0x4B37, 0, 3 },
+        { 0x4B3A, 0, 4 },
+        { 0x4B3E, 0, 3 },
+        { 0x4B41, 0, 4 },
+        { 0x4B45, 0, 3 },
+        { 0x4B48, 0, 4 },
+        { 0x4B4C, 0, 2 },
+        { 0x4B4E, 0, 4 },
+        { 0x4B52, 0, 4 },
+        { 0x4B56, 0, 4 },
+        { 0x4B5A, 0, 4 },
+        { 0x4B5E, 0, 4 },
+        { 0x4B62, 0, 4 },
+        { 0x4B66, 0, 4 },
+        { 0x4B6A, 0, 4 },
+        { 0x4B6E, 0, 4 },
+        { 0x4B72, 0, 4 },
+        { 0x4B76, 0, 4 },
+        { 0x4B7A, 0, 4 },
+        { 0x4B7E, 0, 2 },
+        { 0x4B80, 0, 2 },
+        { 0x4B82, 0, 2 },
+        { 0x4B84, 0, 2 },
+        { 0x4B86, 0, 2 },
+        { 0x4B88, 0, 2 },
+        { 0x4B8A, 0, 2 },
+        { 0x4B8C, 0, 2 },
+        { 0x4B8E, 0, 2 },
+        { 0x4B90, 0, 2 },
+        { 0x4B92, 0, 2 },
+        { 0x4B94, 0, 2 },
+        { 0x4B96, 0, 2 },
+        { 0x4B98, 0, 2 },
+        { 0x4B9A, 0, 2 },
+        { 0x4B9C, 0, 2 },
+        { 0x4B9E, 0, 2 },
+        { 0x4BA0, 0, 2 },
+        { 0x4BA2, 0, 2 },
+        { 0x4BA4, 0, 2 },
+        { 0x4BA6, 0, 2 },
+        { 0x4BA8, 0, 2 },
+        { 0x4BAA, 0, 2 },
+        { 0x4BAC, 0, 2 },
+        { 0x4BAE, 0, 2 },
+        { 0x4BB0, 0, 2 },
+        { 0x4BB2, 0, 2 },
+        { 0x4BB4, 0, 2 },
+        { 0x4BB6, 0, 2 },
+        { 0x4BB8, 0, 2 },
+        { 0x4BBA, 0, 2 },
+        { 0x4BBC, 0, 2 },
+        { 0x4BBE, 0, 2 },
+        { 0x4BC0, 0, 2 },
+        { 0x4BC2, 0, 2 },
+        { 0x4BC4, 0, 2 },
+        { 0x4BC6, 0, 2 },
+        { 0x4BC8, 0, 2 },
+        { 0x4BCA, 0, 2 },
+        { 0x4BCC, 0, 2 },
+        { 0x4BCE, 0, 2 },
+        { 0x4BD0, 0, 2 },
+        { 0x4BD2, 0, 2 },
+        { 0x4BD4, 0, 2 },
+        { 0x4BD6, 0, 2 },
+        { 0x4BD8, 0, 2 },
+        { 0x4BDA, 0, 2 },
+        { 0x4BDC, 0, 2 },
+        { 0x4BDE, 0, 2 },
+        { 0x4BE0, 0, 2 },
+        { 0x4BE2, 0, 2 },
+        { 0x4BE4, 0, 2 },
+        { 0x4BE6, 0, 2 },
+        { 0x4BE8, 0, 2 },
+        { 0x4BEA, 0, 2 },
+        { 0x4BEC, 0, 2 },
+        { 0x4BEE, 0, 2 },
+        { 0x4BF0, 0, 2 },
+        { 0x4BF2, 0, 2 },
+        { 0x4BF4, 0, 2 },
+        { 0x4BF6, 0, 2 },
+        { 0x4BF8, 0, 2 },
+        { 0x4BFA, 0, 2 },
+        { 0x4BFC, 0, 2 },
+        { 0x4BFE, 0, 2 },
+        { 0x4C00, 0, 2 },
+        { 0x4C02, 0, 2 },
+        { 0x4C04, 0, 2 },
+        { 0x4C06, 0, 2 },
+        { 0x4C08, 0, 2 },
+        { 0x4C0A, 0, 2 },
+        { 0x4C0C, 0, 2 },
+        { 0x4C0E, 0, 2 },
+        { 0x4C10, 0, 2 },
+        { 0x4C12, 0, 2 },
+        { 0x4C14, 0, 2 },
+        { 0x4C16, 0, 2 },
+        { 0x4C18, 0, 2 },
+        { 0x4C1A, 0, 2 },
+        { 0x4C1C, 0, 2 },
+        { 0x4C1E, 0, 2 },
+        { 0x4C20, 0, 2 },
+        { 0x4C22, 0, 2 },
+        { 0x4C24, 0, 2 },
+        { 0x4C26, 0, 2 },
+        { 0x4C28, 0, 2 },
+        { 0x4C2A, 0, 2 },
+        { 0x4C2C, 0, 2 },
+        { 0x4C2E, 0, 2 },
+        { 0x4C30, 0, 2 },
+        { 0x4C32, 0, 2 },
+        { 0x4C34, 0, 2 },
+        { 0x4C36, 0, 2 },
+        { 0x4C38, 0, 2 },
+        { 0x4C3A, 0, 2 },
+        { 0x4C3C, 0, 2 },
+        { 0x4C3E, 0, 2 },
+        { 0x4C40, 0, 2 },
+        { 0x4C42, 0, 2 },
+        { 0x4C44, 0, 2 },
+        { 0x4C46, 0, 2 },
+        { 0x4C48, 0, 2 },
+        { 0x4C4A, 0, 2 },
+        { 0x4C4C, 0, 2 },
+        { 0x4C4E, 0, 6 },
+        { 0x4C54, 0, 6 },
+        { 0x4C5A, 0, 6 },
+        { 0x4C60, 0, 6 },
+        { 0x4C66, 0, 6 },
+        { 0x4C6C, 0, 6 },
+        { 0x4C72, 0, 4 },
+        { 0x4C76, 0, 4 },
+        { 0x4C7A, 0, 1 },
+        { 0x4C7B, 0, 1 },
+        { 0x4C7C, 0, 1 },
+        { 0x4C7D, 0, 1 },
+        { 0x4C7E, 0, 1 },
+        { 0x4C7F, 0, 1 },
+        { 0x4C80, 0, 1 },
+        { 0x4C81, 0, 1 },
+        { 0x4C82, 0, 1 },
+        { 0x4C83, 0, 1 },
+        { 0x4C84, 0, 1 },
+        { 0x4C85, 0, 1 },
+        { 0x4C86, 0, 1 },
+        { 0x4C87, 0, 1 },
+        { 0x4C88, 0, 1 },
+        { 0x4C89, 0, 1 },
+        { 0x4C8A, 0, 1 },
+        { 0x4C8B, 0, 1 },
+        { 0x4C8C, 0, 1 },
+        { 0x4C8D, 0, 1 },
+        { 0x4C8E, 0, 1 },
+        { 0x4C8F, 0, 1 },
+        { 0x4C90, 0, 1 },
+        { 0x4C91, 0, 1 },
+        { 0x4C92, 0, 1 },
+        { 0x4C93, 0, 1 },
+        { 0x4C94, 0, 1 },
+        { 0x4C95, 0, 1 },
+        { 0x4C96, 0, 1 },
+        { 0x4C97, 0, 1 },
+        { 0x4C98, 0, 1 },
+        { 0x4C99, 0, 1 },
+        { 0x4C9A, 0, 1 },
+        { 0x4C9B, 0, 1 },
+        { 0x4C9C, 0, 1 },
+        { 0x4C9D, 0, 1 },
+        { 0x4C9E, 0, 1 },
+        { 0x4C9F, 0, 1 },
+        { 0x4CA0, 0, 1 },
+        { 0x4CA1, 0, 1 },
+        { 0x4CA2, 0, 1 },
+        { 0x4CA3, 0, 1 },
+        { 0x4CA4, 0, 1 },
+        { 0x4CA5, 0, 1 },
+        { 0x4CA6, 0, 1 },
+        { 0x4CA7, 0, 1 },
+        { 0x4CA8, 0, 1 },
+        { 0x4CA9, 0, 1 },
+        { 0x4CAA, 0, 1 },
+        { 0x4CAB, 0, 1 },
+        { 0x4CAC, 0, 1 },
+        { 0x4CAD, 0, 1 },
+        { 0x4CAE, 0, 1 },
+        { 0x4CAF, 0, 1 },
+        { 0x4CB0, 0, 1 },
+        { 0x4CB1, 0, 1 },
+        { 0x4CB2, 0, 1 },
+        { 0x4CB3, 0, 1 },
+        { 0x4CB4, 0, 1 },
+        { 0x4CB5, 0, 1 },
+        { 0x4CB6, 0, 1 },
+        { 0x4CB7, 0, 1 },
+        { 0x4CB8, 0, 1 },
+        { 0x4CB9, 0, 1 },
+        { 0x4CBA, 0, 1 },
+        { 0x4CBB, 0, 1 },
+        { 0x4CBC, 0, 1 },
+        { 0x4CBD, 0, 1 },
+        { 0x4CBE, 0, 1 },
+        { 0x4CBF, 0, 1 },
+        { 0x4CC0, 0, 1 },
+        { 0x4CC1, 0, 1 },
+        { 0x4CC2, 0, 1 },
+        { 0x4CC3, 0, 1 },
+        { 0x4CC4, 0, 1 },
+        { 0x4CC5, 0, 1 },
+        { 0x4CC6, 0, 1 },
+        { 0x4CC7, 0, 1 },
+        { 0x4CC8, 0, 1 },
+        { 0x4CC9, 0, 1 },
+        { 0x4CCA, 0, 1 },
+        { 0x4CCB, 0, 1 },
+        { 0x4CCC, 0, 1 },
+        { 0x4CCD, 0, 1 },
+        { 0x4CCE, 0, 1 },
+        { 0x4CCF, 0, 1 },
+        { 0x4CD0, 0, 1 },
+        { 0x4CD1, 0, 1 },
+        { 0x4CD2, 0, 1 },
+        { 0x4CD3, 0, 1 },
+        { 0x4CD4, 0, 1 },
+        { 0x4CD5, 0, 1 },
+        { 0x4CD6, 0, 1 },
+        { 0x4CD7, 0, 1 },
+        { 0x4CD8, 0, 3 },
+        { 0x4CDB, 0, 3 },
+        { 0x4CDE, 0, 3 },
+        { 0x4CE1, 0, 3 },
+        { 0x4CE4, 0, 3 },
+        { 0x4CE7, 0, 3 },
+        { 0x4CEA, 0, 3 },
+        { 0x4CED, 0, 3 },
+        { 0x4CF0, 0, 3 },
+        { 0x4CF3, 0, 3 },
+        { 0x4CF6, 0, 3 },
+        { 0x4CF9, 0, 3 },
+        { 0x4CFC, 0, 3 },
+        { 0x4CFF, 0, 3 },
+        { 0x4D02, 0, 3 },
+        { 0x4D05, 0, 3 },
+        { 0x4D08, 0, 3 },
+        { 0x4D0B, 0, 3 },
+        { 0x4D0E, 0, 3 },
+        { 0x4D11, 0, 3 },
+        { 0x4D14, 0, 3 },
+        { 0x4D17, 0, 3 },
+        { 0x4D1A, 0, 3 },
+        { 0x4D1D, 0, 3 },
+        { 0x4D20, 0, 3 },
+        { 0x4D23, 0, 3 },
+        { 0x4D26, 0, 3 },
+        { 0x4D29, 0, 3 },
+        { 0x4D2C, 0, 3 },
+        { 0x4D2F, 0, 3 },
+        { 0x4D32, 0, 3 },
+        { 0x4D35, 0, 3 },
+        { 0x4D38, 0, 3 },
+        { 0x4D3B, 0, 3 },
+        { 0x4D3E, 0, 3 },
+        { 0x4D41, 0, 3 },
+        { 0x4D44, 0, 3 },
+        { 0x4D47, 0, 3 },
+        { 0x4D4A, 0, 3 },
+        { 0x4D4D, 0, 3 },
+        { 0x4D50, 0, 3 },
+        { 0x4D53, 0, 3 },
+        { 0x4D56, 0, 3 },
+        { 0x4D59, 0, 3 },
+        { 0x4D5C, 0, 3 },
+        { 0x4D5F, 0, 3 },
+        { 0x4D62, 0, 3 },
+        { 0x4D65, 0, 3 },
+        { 0x4D68, 0, 3 },
+        { 0x4D6B, 0, 3 },
+        { 0x4D6E, 0, 3 },
+        { 0x4D71, 0, 3 },
+        { 0x4D74, 0, 3 },
+        { 0x4D77, 0, 3 },
+        { 0x4D7A, 0, 3 },
+        { 0x4D7D, 0, 3 },
+        { 0x4D80, 0, 3 },
+        { 0x4D83, 0, 3 },
+        { 0x4D86, 0, 3 },
+        { 0x4D89, 0, 3 },
+        { 0x4D8C, 0, 3 },
+        { 0x4D8F, 0, 3 },
+        { 0x4D92, 0, 3 },
+        { 0x4D95, 0, 3 },
+        { 0x4D98, 0, 3 },
+        { 0x4D9B, 0, 3 },
+        { 0x4D9E, 0, 3 },
+        { 0x4DA1, 0, 3 },
+        { 0x4DA4, 0, 3 },
+        { 0x4DA7, 0, 3 },
+        { 0x4DAA, 0, 3 },
+        { 0x4DAD, 0, 3 },
+        { 0x4DB0, 0, 3 },
+        { 0x4DB3, 0, 3 },
+        { 0x4DB6, 0, 3 },
+        { 0x4DB9, 0, 3 },
+        { 0x4DBC, 0, 3 },
+        { 0x4DBF, 0, 3 },
+        { 0x4DC2, 0, 3 },
+        { 0x4DC5, 0, 3 },
+        { 0x4DC8, 0, 3 },
+        { 0x4DCB, 0, 3 },
+        { 0x4DCE, 0, 3 },
+        { 0x4DD1, 0, 3 },
+        { 0x4DD4, 0, 3 },
+        { 0x4DD7, 0, 3 },
+        { 0x4DDA, 0, 3 },
+        { 0x4DDD, 0, 3 },
+        { 0x4DE0, 0, 3 },
+        { 0x4DE3, 0, 3 },
+        { 0x4DE6, 0, 3 },
+        { 0x4DE9, 0, 3 },
+        { 0x4DEC, 0, 3 },
+        { 0x4DEF, 0, 3 },
+        { 0x4DF2, 0, 3 },
+        { 0x4DF5, 0, 3 },
+        { 0x4DF8, 0, 3 },
+        { 0x4DFB, 0, 3 },
+        { 0x4DFE, 0, 3 },
+        { 0x4E01, 0, 3 },
+        { 0x4E04, 0, 3 },
+        { 0x4E07, 0, 3 },
+        { 0x4E0A, 0, 3 },
+        { 0x4E0D, 0, 3 },
+        { 0x4E10, 0, 3 },
+        { 0x4E13, 0, 3 },
+        { 0x4E16, 0, 3 },
+        { 0x4E19, 0, 3 },
+        { 0x4E1C, 0, 3 },
+        { 0x4E1F, 0, 3 },
+        { 0x4E22, 0, 3 },
+        { 0x4E25, 0, 3 },
+        { 0x4E28, 0, 3 },
+        { 0x4E2B, 0, 3 },
+        { 0x4E2E, 0, 3 },
+        { 0x4E31, 0, 3 },
+        { 0x4E34, 0, 3 },
+        { 0x4E37, 0, 2 },
+        { 0x4E39, 0, 2 },
+        { 0x4E3B, 0, 2 },
+        { 0x4E3D, 0, 3 },
+        { 0x4E40, 0, 2 },
+        { 0x4E42, 0, 2 },
+        { 0x4E44, 0, 3 },
+        { 0x4E47, 0, 3 },
+        { 0x4E4A, 0, 3 },
+        { 0x4E4D, 0, 3 },
+        { 0x4E50, 0, 3 },
+        { 0x4E53, 0, 3 },
+        { 0x4E56, 0, 3 },
+        { 0x4E59, 0, 3 },
+        { 0x4E5C, 0, 2 },
+        { 0x4E5E, 0, 2 },
+        { 0x4E60, 0, 2 },
+        { 0x4E62, 0, 2 },
+        { 0x4E64, 0, 2 },
+        { 0x4E66, 0, 2 },
+        { 0x4E68, 0, 3 },
+        { 0x4E6B, 0, 2 },
+        { 0x4E6D, 0, 2 },
+        { 0x4E6F, 0, 2 },
+        { 0x4E71, 0, 2 },
+        { 0x4E73, 0, 3 },
+        { 0x4E76, 0, 2 },
+        { 0x4E78, 0, 2 },
+        { 0x4E7A, 0, 2 },
+        { 0x4E7C, 0, 2 },
+        { 0x4E7E, 0, 2 },
+        { 0x4E80, 0, 2 },
+        { 0x4E82, 0, 2 },
+        { 0x4E84, 0, 2 },
+        { 0x4E86, 0, 2 },
+        { 0x4E88, 0, 2 },
+        { 0x4E8A, 0, 2 },
+        { 0x4E8C, 0, 2 },
+        { 0x4E8E, 0, 2 },
+        { 0x4E90, 0, 2 },
+        { 0x4E92, 0, 4 },
+        { 0x4E96, 0, 3 },
+        { 0x4E99, 0, 2 },
+        { 0x4E9B, 0, 4 },
+        { 0x4E9F, 0, 2 },
+        { 0x4EA1, 0, 4 },
+        { 0x4EA5, 0, 2 },
+        { 0x4EA7, 0, 2 },
+        { 0x4EA9, 0, 2 },
+        { 0x4EAB, 0, 1 },
+        { 0x4EAC, 0, 2 },
+        { 0x4EAE, 0, 4 },
+        { 0x4EB2, 0, 2 },
+        { 0x4EB4, 0, 2 },
+        { 0x4EB6, 0, 2 },
+        { 0x4EB8, 0, 2 },
+        { 0x4EBA, 0, 2 },
+        { 0x4EBC, 0, 3 },
+        { 0x4EBF, 0, 2 },
+        { 0x4EC1, 0, 2 },
+        { 0x4EC3, 0, 3 },
+        { 0x4EC6, 0, 2 },
+        { 0x4EC8, 0, 2 },
+        { 0x4ECA, 0, 2 },
+        { 0x4ECC, 0, 2 },
+        { 0x4ECE, 0, 2 },
+        { 0x4ED0, 0, 2 },
+        { 0x4ED2, 0, 2 },
+        { 0x4ED4, 0, 4 },
+        { 0x4ED8, 0, 4 },
+        { 0x4EDC, 8, 8 },
+        { 0x4EEC, 8, 8 },
+        { 0x4EFC, 8, 8 },
+        { 0x4F0C, 8, 8 },
+        { 0x4F1C, 8, 8 },
+        { 0x4F2C, 8, 8 },
+        { 0x4F3C, 8, 8 },
+        { 0x4F4C, 8, 8 },
+        { 0x4F5C, 8, 8 },
+        { 0x4F6C, 8, 8 },
+        { 0x4F7C, 8, 8 },
+        { 0x4F8C, 8, 8 },
+        { 0x4F9C, 8, 8 },
+        { 0x4FAC, 8, 8 },
+        { 0x4FBC, 8, 8 },
+        { 0x4FCC, 12, 12 },
+        { 0x4FE4, 12, 12 },
+        { 0x4FFC, 12, 12 },
+        { 0x5014, 12, 12 },
+        { 0x502C, 12, 12 },
+        { 0x5044, 8, 8 },
+        { 0x5054, 8, 8 },
+        { 0x5064, 12, 12 },
+        { 0x507C, 12, 12 },
+        { 0x5094, 12, 12 },
+        { 0x50AC, 12, 12 },
+        { 0x50C4, 0, 1 },
+        { 0x50C5, 0, 1 },
+        { 0x50C6, 0, 1 },
+        { 0x50C7, 0, 1 },
+        { 0x50C8, 0, 1 },
+        { 0x50C9, 0, 1 },
+        { 0x50CA, 0, 1 },
+        { 0x50CB, 0, 1 },
+        { 0x50CC, 0, 1 },
+        { 0x50CD, 0, 1 },
+        { 0x50CE, 0, 1 },
+        { 0x50CF, 0, 1 },
+        { 0x50D0, 0, 1 },
+        { 0x50D1, 0, 1 },
+        { 0x50D2, 0, 1 },
+        { 0x50D3, 0, 1 },
+        { 0x50D4, 0, 1 },
+        { 0x50D5, 0, 1 },
+        { 0x50D6, 0, 1 },
+        { 0x50D7, 0, 1 },
+        { 0x50D8, 0, 1 },
+        { 0x50D9, 0, 1 },
+        { 0x50DA, 0, 1 },
+        { 0x50DB, 0, 1 },
+        { 0x50DC, 0, 1 },
+        { 0x50DD, 0, 1 },
+        { 0x50DE, 0, 1 },
+        { 0x50DF, 0, 1 },
+        { 0x50E0, 0, 1 },
+        { 0x50E1, 0, 1 },
+        { 0x50E2, 0, 1 },
+        { 0x50E3, 0, 1 },
+        { 0x50E4, 0, 1 },
+        { 0x50E5, 0, 1 },
+        { 0x50E6, 0, 1 },
+        { 0x50E7, 0, 1 },
+        { 0x50E8, 0, 1 },
+        { 0x50E9, 0, 1 },
+        { 0x50EA, 0, 1 },
+        { 0x50EB, 0, 1 },
+        { 0x50EC, 0, 1 },
+        { 0x50ED, 0, 1 },
+        { 0x50EE, 0, 1 },
+        { 0x50EF, 0, 1 },
+        { 0x50F0, 0, 1 },
+        { 0x50F1, 0, 1 },
+        { 0x50F2, 0, 1 },
+        { 0x50F3, 0, 1 },
+        { 0x50F4, 0, 1 },
+        { 0x50F5, 0, 1 },
+        { 0x50F6, 0, 1 },
+        { 0x50F7, 0, 1 },
+        { 0x50F8, 0, 1 },
+        { 0x50F9, 0, 1 },
+        { 0x50FA, 0, 1 },
+        { 0x50FB, 0, 1 },
+        { 0x50FC, 0, 1 },
+        { 0x50FD, 0, 1 },
+        { 0x50FE, 0, 1 },
+        { 0x50FF, 0, 1 },
+        { 0x5100, 0, 1 },
+        { 0x5101, 0, 1 },
+        { 0x5102, 0, 1 },
+        { 0x5103, 0, 1 },
+        { 0x5104, 0, 1 },
+        { 0x5105, 0, 1 },
+        { 0x5106, 0, 1 },
+        { 0x5107, 0, 1 },
+        { 0x5108, 0, 1 },
+        { 0x5109, 0, 1 },
+        { 0x510A, 0, 1 },
+        { 0x510B, 0, 1 },
+        { 0x510C, 0, 1 },
+        { 0x510D, 0, 1 },
+        { 0x510E, 0, 1 },
+        { 0x510F, 0, 1 },
+        { 0x5110, 0, 1 },
+        { 0x5111, 0, 1 },
+        { 0x5112, 0, 1 },
+        { 0x5113, 0, 1 },
+        { 0x5114, 0, 1 },
+        { 0x5115, 0, 1 },
+        { 0x5116, 0, 1 },
+        { 0x5117, 0, 1 },
+        { 0x5118, 0, 1 },
+        { 0x5119, 0, 1 },
+        { 0x511A, 0, 1 },
+        { 0x511B, 0, 1 },
+        { 0x511C, 0, 1 },
+        { 0x511D, 0, 1 },
+        { 0x511E, 0, 1 },
+        { 0x511F, 0, 1 },
+        { 0x5120, 0, 1 },
+        { 0x5121, 0, 1 },
+        { 0x5122, 0, 1 },
+        { 0x5123, 0, 1 },
+        { 0x5124, 0, 1 },
+        { 0x5125, 0, 1 },
+        { 0x5126, 0, 1 },
+        { 0x5127, 0, 1 },
+        { 0x5128, 0, 1 },
+        { 0x5129, 0, 1 },
+        { 0x512A, 0, 1 },
+        { 0x512B, 0, 1 },
+        { 0x512C, 0, 1 },
+        { 0x512D, 0, 1 },
+        { 0x512E, 0, 1 },
+        { 0x512F, 0, 1 },
+        { 0x5130, 0, 1 },
+        { 0x5131, 0, 1 },
+        { 0x5132, 0, 1 },
+        { 0x5133, 0, 1 },
+        { 0x5134, 0, 1 },
+        { 0x5135, 0, 1 },
+        { 0x5136, 0, 1 },
+        { 0x5137, 0, 1 },
+        { 0x5138, 0, 1 },
+        { 0x5139, 0, 1 },
+        { 0x513A, 0, 1 },
+        { 0x513B, 0, 1 },
+        { 0x513C, 0, 1 },
+        { 0x513D, 0, 1 },
+        { 0x513E, 0, 1 },
+        { 0x513F, 0, 1 },
+        { 0x5140, 0, 1 },
+        { 0x5141, 0, 1 },
+        { 0x5142, 0, 1 },
+        { 0x5143, 0, 1 },
+        { 0x5144, 0, 1 },
+        { 0x5145, 0, 1 },
+        { 0x5146, 0, 1 },
+        { 0x5147, 0, 1 },
+        { 0x5148, 0, 1 },
+        { 0x5149, 0, 1 },
+        { 0x514A, 0, 1 },
+        { 0x514B, 0, 1 },
+        { 0x514C, 0, 1 },
+        { 0x514D, 0, 1 },
+        { 0x514E, 0, 1 },
+        { 0x514F, 0, 1 },
+        { 0x5150, 0, 1 },
+        { 0x5151, 0, 1 },
+        { 0x5152, 0, 1 },
+        { 0x5153, 0, 1 },
+        { 0x5154, 0, 1 },
+        { 0x5155, 0, 1 },
+        { 0x5156, 0, 1 },
+        { 0x5157, 0, 1 },
+        { 0x5158, 0, 1 },
+        { 0x5159, 0, 1 },
+        { 0x515A, 0, 1 },
+        { 0x515B, 0, 1 },
+        { 0x515C, 0, 1 },
+        { 0x515D, 0, 1 },
+        { 0x515E, 0, 1 },
+        { 0x515F, 0, 1 },
+        { 0x5160, 0, 1 },
+        { 0x5161, 0, 1 },
+        { 0x5162, 0, 1 },
+        { 0x5163, 0, 1 },
+        { 0x5164, 0, 1 },
+        { 0x5165, 0, 1 },
+        { 0x5166, 0, 1 },
+        { 0x5167, 0, 1 },
+        { 0x5168, 0, 1 },
+        { 0x5169, 0, 1 },
+        { 0x516A, 0, 1 },
+        { 0x516B, 0, 1 },
+        { 0x516C, 0, 1 },
+        { 0x516D, 0, 1 },
+        { 0x516E, 0, 1 },
+        { 0x516F, 0, 1 },
+        { 0x5170, 0, 1 },
+        { 0x5171, 0, 1 },
+        { 0x5172, 0, 1 },
+        { 0x5173, 0, 1 },
+        { 0x5174, 0, 1 },
+        { 0x5175, 0, 1 },
+        { 0x5176, 0, 1 },
+        { 0x5177, 0, 1 },
+        { 0x5178, 0, 1 },
+        { 0x5179, 0, 1 },
+        { 0x517A, 0, 1 },
+        { 0x517B, 0, 1 },
+        { 0x517C, 0, 1 },
+        { 0x517D, 0, 1 },
+        { 0x517E, 0, 1 },
+        { 0x517F, 0, 1 },
+        { 0x5180, 0, 1 },
+        { 0x5181, 0, 1 },
+        { 0x5182, 0, 1 },
+        { 0x5183, 0, 1 },
+        { 0x5184, 0, 1 },
+        { 0x5185, 0, 1 },
+        { 0x5186, 0, 1 },
+        { 0x5187, 0, 1 },
+        { 0x5188, 0, 1 },
+        { 0x5189, 0, 1 },
+        { 0x518A, 0, 1 },
+        { 0x518B, 0, 1 },
+        { 0x518C, 0, 1 },
+        { 0x518D, 0, 1 },
+        { 0x518E, 0, 1 },
+        { 0x518F, 0, 1 },
+        { 0x5190, 0, 1 },
+        { 0x5191, 0, 1 },
+        { 0x5192, 0, 1 },
+        { 0x5193, 0, 1 },
+        { 0x5194, 0, 1 },
+        { 0x5195, 0, 1 },
+        { 0x5196, 0, 1 },
+        { 0x5197, 0, 1 },
+        { 0x5198, 0, 1 },
+        { 0x5199, 0, 1 },
+        { 0x519A, 0, 1 },
+        { 0x519B, 0, 1 },
+        { 0x519C, 0, 1 },
+        { 0x519D, 0, 1 },
+        { 0x519E, 0, 1 },
+        { 0x519F, 0, 1 },
+        { 0x51A0, 0, 1 },
+        { 0x51A1, 0, 1 },
+        { 0x51A2, 0, 1 },
+        { 0x51A3, 0, 1 },
+        { 0x51A4, 0, 1 },
+        { 0x51A5, 0, 1 },
+        { 0x51A6, 0, 1 },
+        { 0x51A7, 0, 1 },
+        { 0x51A8, 0, 1 },
+        { 0x51A9, 0, 1 },
+        { 0x51AA, 0, 1 },
+        { 0x51AB, 0, 1 },
+        { 0x51AC, 0, 1 },
+        { 0x51AD, 0, 1 },
+        { 0x51AE, 0, 1 },
+        { 0x51AF, 0, 1 },
+        { 0x51B0, 0, 1 },
+        { 0x51B1, 0, 1 },
+        { 0x51B2, 0, 1 },
+        { 0x51B3, 0, 1 },
+        { 0x51B4, 0, 1 },
+        { 0x51B5, 0, 1 },
+        { 0x51B6, 0, 1 },
+        { 0x51B7, 0, 1 },
+        { 0x51B8, 0, 1 },
+        { 0x51B9, 0, 1 },
+        { 0x51BA, 0, 1 },
+        { 0x51BB, 0, 1 },
+        { 0x51BC, 0, 1 },
+        { 0x51BD, 0, 1 },
+        { 0x51BE, 0, 1 },
+        { 0x51BF, 0, 1 },
+        { 0x51C0, 0, 1 },
+        { 0x51C1, 0, 1 },
+        { 0x51C2, 0, 1 },
+        { 0x51C3, 0, 1 },
+        { 0x51C4, 0, 1 },
+        { 0x51C5, 0, 1 },
+        { 0x51C6, 0, 1 },
+        { 0x51C7, 0, 1 },
+        { 0x51C8, 0, 1 },
+        { 0x51C9, 0, 1 },
+        { 0x51CA, 0, 1 },
+        { 0x51CB, 0, 1 },
+        { 0x51CC, 0, 1 },
+        { 0x51CD, 0, 1 },
+        { 0x51CE, 0, 1 },
+        { 0x51CF, 0, 1 },
+        { 0x51D0, 0, 1 },
+        { 0x51D1, 0, 1 },
+        { 0x51D2, 0, 1 },
+        { 0x51D3, 0, 1 },
+        { 0x51D4, 0, 1 },
+        { 0x51D5, 0, 1 },
+        { 0x51D6, 0, 1 },
+        { 0x51D7, 0, 1 },
+        { 0x51D8, 0, 1 },
+        { 0x51D9, 0, 1 },
+        { 0x51DA, 0, 1 },
+        { 0x51DB, 0, 1 },
+        { 0x51DC, 0, 1 },
+        { 0x51DD, 0, 1 },
+        { 0x51DE, 0, 1 },
+        { 0x51DF, 0, 1 },
+        { 0x51E0, 0, 1 },
+        { 0x51E1, 0, 1 },
+        { 0x51E2, 0, 1 },
+        { 0x51E3, 0, 1 },
+        { 0x51E4, 0, 1 },
+        { 0x51E5, 0, 1 },
+        { 0x51E6, 0, 1 },
+        { 0x51E7, 0, 1 },
+        { 0x51E8, 0, 1 },
+        { 0x51E9, 0, 1 },
+        { 0x51EA, 0, 1 },
+        { 0x51EB, 0, 1 },
+        { 0x51EC, 0, 1 },
+        { 0x51ED, 0, 1 },
+        { 0x51EE, 0, 1 },
+        { 0x51EF, 0, 1 },
+        { 0x51F0, 0, 1 },
+        { 0x51F1, 0, 1 },
+        { 0x51F2, 0, 1 },
+        { 0x51F3, 0, 1 },
+        { 0x51F4, 0, 1 },
+        { 0x51F5, 0, 1 },
+        { 0x51F6, 0, 1 },
+        { 0x51F7, 0, 1 },
+        { 0x51F8, 0, 1 },
+        { 0x51F9, 0, 1 },
+        { 0x51FA, 0, 1 },
+        { 0x51FB, 0, 1 },
+        { 0x51FC, 0, 1 },
+        { 0x51FD, 0, 1 },
+        { 0x51FE, 0, 1 },
+        { 0x51FF, 0, 1 },
+        { 0x5200, 0, 1 },
+        { 0x5201, 0, 1 },
+        { 0x5202, 0, 1 },
+        { 0x5203, 0, 1 },
+        { 0x5204, 0, 1 },
+        { 0x5205, 0, 1 },
+        { 0x5206, 0, 1 },
+        { 0x5207, 0, 1 },
+        { 0x5208, 0, 1 },
+        { 0x5209, 0, 1 },
+        { 0x520A, 0, 1 },
+        { 0x520B, 0, 1 },
+        { 0x520C, 0, 1 },
+        { 0x520D, 0, 1 },
+        { 0x520E, 0, 1 },
+        { 0x520F, 0, 1 },
+        { 0x5210, 0, 1 },
+        { 0x5211, 0, 1 },
+        { 0x5212, 0, 1 },
+        { 0x5213, 0, 1 },
+        { 0x5214, 0, 1 },
+        { 0x5215, 0, 1 },
+        { 0x5216, 0, 1 },
+        { 0x5217, 0, 1 },
+        { 0x5218, 0, 1 },
+        { 0x5219, 0, 1 },
+        { 0x521A, 0, 1 },
+        { 0x521B, 0, 1 },
+        { 0x521C, 0, 1 },
+        { 0x521D, 0, 1 },
+        { 0x521E, 0, 1 },
+        { 0x521F, 0, 1 },
+        { 0x5220, 0, 1 },
+        { 0x5221, 0, 1 },
+        { 0x5222, 0, 1 },
+        { 0x5223, 0, 1 },
+        { 0x5224, 0, 1 },
+        { 0x5225, 0, 1 },
+        { 0x5226, 0, 1 },
+        { 0x5227, 0, 1 },
+        { 0x5228, 0, 1 },
+        { 0x5229, 0, 1 },
+        { 0x522A, 0, 1 },
+        { 0x522B, 0, 1 },
+        { 0x522C, 0, 1 },
+        { 0x522D, 0, 1 },
+        { 0x522E, 0, 1 },
+        { 0x522F, 0, 1 },
+        { 0x5230, 0, 1 },
+        { 0x5231, 0, 1 },
+        { 0x5232, 0, 1 },
+        { 0x5233, 0, 1 },
+        { 0x5234, 0, 1 },
+        { 0x5235, 0, 1 },
+        { 0x5236, 0, 1 },
+        { 0x5237, 0, 1 },
+        { 0x5238, 0, 1 },
+        { 0x5239, 0, 1 },
+        { 0x523A, 0, 1 },
+        { 0x523B, 0, 1 },
+        { 0x523C, 0, 1 },
+        { 0x523D, 0, 1 },
+        { 0x523E, 0, 1 },
+        { 0x523F, 0, 1 },
+        { 0x5240, 0, 1 },
+        { 0x5241, 0, 1 },
+        { 0x5242, 0, 1 },
+        { 0x5243, 0, 1 },
+        { 0x5244, 0, 1 },
+        { 0x5245, 0, 1 },
+        { 0x5246, 0, 1 },
+        { 0x5247, 0, 1 },
+        { 0x5248, 0, 1 },
+        { 0x5249, 0, 1 },
+        { 0x524A, 0, 1 },
+        { 0x524B, 0, 1 },
+        { 0x524C, 0, 1 },
+        { 0x524D, 0, 1 },
+        { 0x524E, 0, 1 },
+        { 0x524F, 0, 1 },
+        { 0x5250, 0, 1 },
+        { 0x5251, 0, 1 },
+        { 0x5252, 0, 1 },
+        { 0x5253, 0, 1 },
+        { 0x5254, 0, 1 },
+        { 0x5255, 0, 1 },
+        { 0x5256, 0, 1 },
+        { 0x5257, 0, 1 },
+        { 0x5258, 0, 1 },
+        { 0x5259, 0, 1 },
+        { 0x525A, 0, 1 },
+        { 0x525B, 0, 1 },
+        { 0x525C, 0, 1 },
+        { 0x525D, 0, 1 },
+        { 0x525E, 0, 1 },
+        { 0x525F, 0, 1 },
+        { 0x5260, 0, 1 },
+        { 0x5261, 0, 1 },
+        { 0x5262, 0, 1 },
+        { 0x5263, 0, 1 },
+        { 0x5264, 0, 1 },
+        { 0x5265, 0, 1 },
+        { 0x5266, 0, 1 },
+        { 0x5267, 0, 1 },
+        { 0x5268, 0, 1 },
+        { 0x5269, 0, 1 },
+        { 0x526A, 0, 1 },
+        { 0x526B, 0, 1 },
+        { 0x526C, 0, 1 },
+        { 0x526D, 0, 1 },
+        { 0x526E, 0, 1 },
+        { 0x526F, 0, 1 },
+        { 0x5270, 0, 1 },
+        { 0x5271, 0, 1 },
+        { 0x5272, 0, 1 },
+        { 0x5273, 0, 1 },
+        { 0x5274, 0, 1 },
+        { 0x5275, 0, 1 },
+        { 0x5276, 0, 1 },
+        { 0x5277, 0, 1 },
+        { 0x5278, 0, 1 },
+        { 0x5279, 0, 1 },
+        { 0x527A, 0, 1 },
+        { 0x527B, 0, 1 },
+        { 0x527C, 0, 1 },
+        { 0x527D, 0, 1 },
+        { 0x527E, 0, 1 },
+        { 0x527F, 0, 1 },
+        { 0x5280, 0, 1 },
+        { 0x5281, 0, 1 },
+        { 0x5282, 0, 1 },
+        { 0x5283, 0, 1 },
+        { 0x5284, 0, 1 },
+        { 0x5285, 0, 1 },
+        { 0x5286, 0, 1 },
+        { 0x5287, 0, 1 },
+        { 0x5288, 0, 1 },
+        { 0x5289, 0, 1 },
+        { 0x528A, 0, 1 },
+        { 0x528B, 0, 1 },
+        { 0x528C, 0, 1 },
+        { 0x528D, 0, 1 },
+        { 0x528E, 0, 1 },
+        { 0x528F, 0, 1 },
+        { 0x5290, 0, 1 },
+        { 0x5291, 0, 1 },
+        { 0x5292, 0, 1 },
+        { 0x5293, 0, 1 },
+        { 0x5294, 0, 1 },
+        { 0x5295, 0, 1 },
+        { 0x5296, 0, 1 },
+        { 0x5297, 0, 1 },
+        { 0x5298, 0, 1 },
+        { 0x5299, 0, 1 },
+        { 0x529A, 0, 1 },
+        { 0x529B, 0, 1 },
+        { 0x529C, 0, 1 },
+        { 0x529D, 0, 1 },
+        { 0x529E, 0, 1 },
+        { 0x529F, 0, 1 },
+        { 0x52A0, 0, 1 },
+        { 0x52A1, 0, 1 },
+        { 0x52A2, 0, 1 },
+        { 0x52A3, 0, 1 },
+        { 0x52A4, 0, 1 },
+        { 0x52A5, 0, 1 },
+        { 0x52A6, 0, 1 },
+        { 0x52A7, 0, 1 },
+        { 0x52A8, 0, 1 },
+        { 0x52A9, 0, 1 },
+        { 0x52AA, 0, 1 },
+        { 0x52AB, 0, 1 },
+        { 0x52AC, 0, 1 },
+        { 0x52AD, 0, 1 },
+        { 0x52AE, 0, 1 },
+        { 0x52AF, 0, 1 },
+        { 0x52B0, 0, 1 },
+        { 0x52B1, 0, 1 },
+        { 0x52B2, 0, 1 },
+        { 0x52B3, 0, 1 },
+        { 0x52B4, 0, 1 },
+        { 0x52B5, 0, 1 },
+        { 0x52B6, 0, 1 },
+        { 0x52B7, 0, 1 },
+        { 0x52B8, 0, 1 },
+        { 0x52B9, 0, 1 },
+        { 0x52BA, 0, 1 },
+        { 0x52BB, 0, 1 },
+        { 0x52BC, 0, 1 },
+        { 0x52BD, 0, 1 },
+        { 0x52BE, 0, 1 },
+        { 0x52BF, 0, 1 },
+        { 0x52C0, 0, 1 },
+        { 0x52C1, 0, 1 },
+        { 0x52C2, 0, 1 },
+        { 0x52C3, 0, 1 },
+        { 0x52C4, 0, 1 },
+        { 0x52C5, 0, 1 },
+        { 0x52C6, 0, 1 },
+        { 0x52C7, 0, 1 },
+        { 0x52C8, 0, 1 },
+        { 0x52C9, 0, 1 },
+        { 0x52CA, 0, 1 },
+        { 0x52CB, 0, 1 },
+        { 0x52CC, 0, 1 },
+        { 0x52CD, 0, 1 },
+        { 0x52CE, 0, 1 },
+        { 0x52CF, 0, 1 },
+        { 0x52D0, 0, 1 },
+        { 0x52D1, 0, 1 },
+        { 0x52D2, 0, 1 },
+        { 0x52D3, 0, 1 },
+        { 0x52D4, 0, 1 },
+        { 0x52D5, 0, 1 },
+        { 0x52D6, 0, 1 },
+        { 0x52D7, 0, 1 },
+        { 0x52D8, 0, 1 },
+        { 0x52D9, 0, 1 },
+        { 0x52DA, 0, 1 },
+        { 0x52DB, 0, 1 },
+        { 0x52DC, 0, 1 },
+        { 0x52DD, 0, 1 },
+        { 0x52DE, 0, 1 },
+        { 0x52DF, 0, 1 },
+        { 0x52E0, 0, 1 },
+        { 0x52E1, 0, 1 },
+        { 0x52E2, 0, 1 },
+        { 0x52E3, 0, 1 },
+        { 0x52E4, 0, 1 },
+        { 0x52E5, 0, 1 },
+        { 0x52E6, 0, 1 },
+        { 0x52E7, 0, 1 },
+        { 0x52E8, 0, 1 },
+        { 0x52E9, 0, 1 },
+        { 0x52EA, 0, 1 },
+        { 0x52EB, 0, 1 },
+        { 0x52EC, 0, 1 },
+        { 0x52ED, 0, 1 },
+        { 0x52EE, 0, 1 },
+        { 0x52EF, 0, 1 },
+        { 0x52F0, 0, 1 },
+        { 0x52F1, 0, 1 },
+        { 0x52F2, 0, 1 },
+        { 0x52F3, 0, 1 },
+        { 0x52F4, 0, 1 },
+        { 0x52F5, 0, 1 },
+        { 0x52F6, 0, 1 },
+        { 0x52F7, 0, 1 },
+        { 0x52F8, 0, 1 },
+        { 0x52F9, 0, 1 },
+        { 0x52FA, 0, 1 },
+        { 0x52FB, 0, 1 },
+        { 0x52FC, 0, 1 },
+        { 0x52FD, 0, 1 },
+        { 0x52FE, 0, 1 },
+        { 0x52FF, 0, 1 },
+        { 0x5300, 0, 1 },
+        { 0x5301, 0, 1 },
+        { 0x5302, 0, 1 },
+        { 0x5303, 0, 1 },
+        { 0x5304, 0, 1 },
+        { 0x5305, 0, 1 },
+        { 0x5306, 0, 1 },
+        { 0x5307, 0, 1 },
+        { 0x5308, 0, 1 },
+        { 0x5309, 0, 1 },
+        { 0x530A, 0, 1 },
+        { 0x530B, 0, 1 },
+        { 0x530C, 0, 1 },
+        { 0x530D, 0, 1 },
+        { 0x530E, 0, 1 },
+        { 0x530F, 0, 1 },
+        { 0x5310, 0, 1 },
+        { 0x5311, 0, 1 },
+        { 0x5312, 0, 1 },
+        { 0x5313, 0, 1 },
+        { 0x5314, 0, 1 },
+        { 0x5315, 0, 1 },
+        { 0x5316, 0, 1 },
+        { 0x5317, 0, 1 },
+        { 0x5318, 0, 1 },
+        { 0x5319, 0, 1 },
+        { 0x531A, 0, 1 },
+        { 0x531B, 0, 1 },
+        { 0x531C, 0, 1 },
+        { 0x531D, 0, 1 },
+        { 0x531E, 0, 1 },
+        { 0x531F, 0, 1 },
+        { 0x5320, 0, 1 },
+        { 0x5321, 0, 1 },
+        { 0x5322, 0, 1 },
+        { 0x5323, 0, 1 },
+        { 0x5324, 0, 1 },
+        { 0x5325, 0, 1 },
+        { 0x5326, 0, 1 },
+        { 0x5327, 0, 1 },
+        { 0x5328, 0, 1 },
+        { 0x5329, 0, 1 },
+        { 0x532A, 0, 1 },
+        { 0x532B, 0, 1 },
+        { 0x532C, 0, 1 },
+        { 0x532D, 0, 1 },
+        { 0x532E, 0, 1 },
+        { 0x532F, 0, 1 },
+        { 0x5330, 0, 1 },
+        { 0x5331, 0, 1 },
+        { 0x5332, 0, 1 },
+        { 0x5333, 0, 1 },
+        { 0x5334, 0, 1 },
+        { 0x5335, 0, 1 },
+        { 0x5336, 0, 1 },
+        { 0x5337, 0, 1 },
+        { 0x5338, 0, 1 },
+        { 0x5339, 0, 1 },
+        { 0x533A, 0, 1 },
+        { 0x533B, 0, 1 },
+        { 0x533C, 0, 1 },
+        { 0x533D, 0, 1 },
+        { 0x533E, 0, 1 },
+        { 0x533F, 0, 1 },
+        { 0x5340, 0, 1 },
+        { 0x5341, 0, 1 },
+        { 0x5342, 0, 1 },
+        { 0x5343, 0, 1 },
+        { 0x5344, 0, 1 },
+        { 0x5345, 0, 1 },
+        { 0x5346, 0, 1 },
+        { 0x5347, 0, 1 },
+        { 0x5348, 0, 1 },
+        { 0x5349, 0, 1 },
+        { 0x534A, 0, 1 },
+        { 0x534B, 0, 1 },
+        { 0x534C, 0, 1 },
+        { 0x534D, 0, 1 },
+        { 0x534E, 0, 1 },
+        { 0x534F, 0, 1 },
+        { 0x5350, 0, 2 },
+        { 0x5352, 0, 2 },
+        { 0x5354, 0, 2 },
+        { 0x5356, 0, 2 },
+        { 0x5358, 0, 2 },
+        { 0x535A, 0, 2 },
+        { 0x535C, 0, 2 },
+        { 0x535E, 0, 2 },
+        { 0x5360, 0, 2 },
+        { 0x5362, 0, 2 },
+        { 0x5364, 0, 2 },
+        { 0x5366, 0, 2 },
+        { 0x5368, 0, 2 },
+        { 0x536A, 0, 2 },
+        { 0x536C, 0, 2 },
+        { 0x536E, 0, 2 },
+        { 0x5370, 0, 2 },
+        { 0x5372, 0, 2 },
+        { 0x5374, 0, 2 },
+        { 0x5376, 0, 2 },
+        { 0x5378, 0, 2 },
+        { 0x537A, 0, 2 },
+        { 0x537C, 0, 2 },
+        { 0x537E, 0, 2 },
+        { 0x5380, 0, 2 },
+        { 0x5382, 0, 2 },
+        { 0x5384, 0, 2 },
+        { 0x5386, 0, 3 },
+        { 0x5389, 0, 2 },
+        { 0x538B, 0, 2 },
+        { 0x538D, 0, 2 },
+        { 0x538F, 0, 2 },
+        { 0x5391, 0, 2 },
+        { 0x5393, 0, 2 },
+        { 0x5395, 0, 2 },
+        { 0x5397, 0, 2 },
+        { 0x5399, 0, 2 },
+        { 0x539B, 0, 2 },
+        { 0x539D, 0, 2 },
+        { 0x539F, 0, 2 },
+        { 0x53A1, 0, 2 },
+        { 0x53A3, 0, 2 },
+        { 0x53A5, 0, 2 },
+        { 0x53A7, 0, 2 },
+        { 0x53A9, 0, 2 },
+        { 0x53AB, 0, 2 },
+        { 0x53AD, 0, 2 },
+        { 0x53AF, 0, 2 },
+        { 0x53B1, 0, 2 },
+        { 0x53B3, 0, 2 },
+        { 0x53B5, 0, 2 },
+        { 0x53B7, 0, 2 },
+        { 0x53B9, 0, 2 },
+        { 0x53BB, 0, 3 },
+        { 0x53BE, 0, 2 },
+        { 0x53C0, 0, 2 },
+        { 0x53C2, 0, 2 },
+        { 0x53C4, 0, 2 },
+        { 0x53C6, 0, 2 },
+        { 0x53C8, 0, 2 },
+        { 0x53CA, 0, 2 },
+        { 0x53CC, 0, 2 },
+        { 0x53CE, 0, 2 },
+        { 0x53D0, 0, 2 },
+        { 0x53D2, 0, 2 },
+        { 0x53D4, 0, 2 },
+        { 0x53D6, 0, 2 },
+        { 0x53D8, 0, 2 },
+        { 0x53DA, 0, 2 },
+        { 0x53DC, 0, 2 },
+        { 0x53DE, 0, 2 },
+        { 0x53E0, 0, 2 },
+        { 0x53E2, 0, 2 },
+        { 0x53E4, 0, 2 },
+        { 0x53E6, 0, 2 },
+        { 0x53E8, 0, 2 },
+        { 0x53EA, 0, 2 },
+        { 0x53EC, 0, 2 },
+        { 0x53EE, 0, 2 },
+        { 0x53F0, 0, 2 },
+        { 0x53F2, 0, 2 },
+        { 0x53F4, 0, 2 },
+        { 0x53F6, 0, 2 },
+        { 0x53F8, 0, 2 },
+        { 0x53FA, 0, 2 },
+        { 0x53FC, 0, 3 },
+        { 0x53FF, 0, 2 },
+        { 0x5401, 0, 2 },
+        { 0x5403, 0, 2 },
+        { 0x5405, 0, 2 },
+        { 0x5407, 0, 2 },
+        { 0x5409, 0, 2 },
+        { 0x540B, 0, 2 },
+        { 0x540D, 0, 2 },
+        { 0x540F, 0, 2 },
+        { 0x5411, 0, 2 },
+        { 0x5413, 0, 2 },
+        { 0x5415, 0, 2 },
+        { 0x5417, 0, 2 },
+        { 0x5419, 0, 2 },
+        { 0x541B, 0, 2 },
+        { 0x541D, 0, 2 },
+        { 0x541F, 0, 2 },
+        { 0x5421, 0, 2 },
+        { 0x5423, 0, 2 },
+        { 0x5425, 0, 2 },
+        { 0x5427, 0, 2 },
+        { 0x5429, 0, 2 },
+        { 0x542B, 0, 2 },
+        { 0x542D, 0, 2 },
+        { 0x542F, 0, 2 },
+        { 0x5431, 0, 3 },
+        { 0x5434, 0, 2 },
+        { 0x5436, 0, 2 },
+        { 0x5438, 0, 2 },
+        { 0x543A, 0, 2 },
+        { 0x543C, 0, 2 },
+        { 0x543E, 0, 2 },
+        { 0x5440, 0, 2 },
+        { 0x5442, 0, 2 },
+        { 0x5444, 0, 2 },
+        { 0x5446, 0, 2 },
+        { 0x5448, 0, 2 },
+        { 0x544A, 0, 2 },
+        { 0x544C, 0, 2 },
+        { 0x544E, 0, 2 },
+        { 0x5450, 0, 2 },
+        { 0x5452, 0, 2 },
+        { 0x5454, 0, 2 },
+        { 0x5456, 0, 2 },
+        { 0x5458, 0, 2 },
+        { 0x545A, 0, 2 },
+        { 0x545C, 0, 2 },
+        { 0x545E, 0, 2 },
+        { 0x5460, 0, 2 },
+        { 0x5462, 0, 2 },
+        { 0x5464, 0, 2 },
+        { 0x5466, 0, 2 },
+        { 0x5468, 0, 2 },
+        { 0x546A, 0, 2 },
+        { 0x546C, 0, 2 },
+        { 0x546E, 0, 2 },
+        { 0x5470, 0, 2 },
+        { 0x5472, 0, 3 },
+        { 0x5475, 0, 2 },
+        { 0x5477, 0, 2 },
+        { 0x5479, 0, 2 },
+        { 0x547B, 0, 2 },
+        { 0x547D, 0, 2 },
+        { 0x547F, 0, 2 },
+        { 0x5481, 0, 2 },
+        { 0x5483, 0, 2 },
+        { 0x5485, 0, 2 },
+        { 0x5487, 0, 2 },
+        { 0x5489, 0, 2 },
+        { 0x548B, 0, 2 },
+        { 0x548D, 0, 2 },
+        { 0x548F, 0, 2 },
+        { 0x5491, 0, 2 },
+        { 0x5493, 0, 2 },
+        { 0x5495, 0, 2 },
+        { 0x5497, 0, 2 },
+        { 0x5499, 0, 2 },
+        { 0x549B, 0, 2 },
+        { 0x549D, 0, 2 },
+        { 0x549F, 0, 2 },
+        { 0x54A1, 0, 2 },
+        { 0x54A3, 0, 2 },
+        { 0x54A5, 0, 2 },
+        { 0x54A7, 0, 3 },
+        { 0x54AA, 0, 2 },
+        { 0x54AC, 0, 2 },
+        { 0x54AE, 0, 2 },
+        { 0x54B0, 0, 2 },
+        { 0x54B2, 0, 2 },
+        { 0x54B4, 0, 2 },
+        { 0x54B6, 0, 2 },
+        { 0x54B8, 0, 2 },
+        { 0x54BA, 0, 2 },
+        { 0x54BC, 0, 2 },
+        { 0x54BE, 0, 2 },
+        { 0x54C0, 0, 2 },
+        { 0x54C2, 0, 2 },
+        { 0x54C4, 0, 2 },
+        { 0x54C6, 0, 2 },
+        { 0x54C8, 0, 2 },
+        { 0x54CA, 0, 2 },
+        { 0x54CC, 0, 2 },
+        { 0x54CE, 0, 2 },
+        { 0x54D0, 0, 2 },
+        { 0x54D2, 0, 2 },
+        { 0x54D4, 0, 2 },
+        { 0x54D6, 0, 2 },
+        { 0x54D8, 0, 2 },
+        { 0x54DA, 0, 2 },
+        { 0x54DC, 0, 2 },
+        { 0x54DE, 0, 2 },
+        { 0x54E0, 0, 2 },
+        { 0x54E2, 0, 2 },
+        { 0x54E4, 0, 2 },
+        { 0x54E6, 0, 2 },
+        { 0x54E8, 0, 3 },
+        { 0x54EB, 0, 2 },
+        { 0x54ED, 0, 2 },
+        { 0x54EF, 0, 2 },
+        { 0x54F1, 0, 2 },
+        { 0x54F3, 0, 2 },
+        { 0x54F5, 0, 2 },
+        { 0x54F7, 0, 2 },
+        { 0x54F9, 0, 2 },
+        { 0x54FB, 0, 2 },
+        { 0x54FD, 0, 2 },
+        { 0x54FF, 0, 2 },
+        { 0x5501, 0, 2 },
+        { 0x5503, 0, 2 },
+        { 0x5505, 0, 2 },
+        { 0x5507, 0, 2 },
+        { 0x5509, 0, 2 },
+        { 0x550B, 0, 2 },
+        { 0x550D, 0, 2 },
+        { 0x550F, 0, 2 },
+        { 0x5511, 0, 2 },
+        { 0x5513, 0, 2 },
+        { 0x5515, 0, 2 },
+        { 0x5517, 0, 2 },
+        { 0x5519, 0, 2 },
+        { 0x551B, 0, 2 },
+        { 0x551D, 0, 3 },
+        { 0x5520, 0, 2 },
+        { 0x5522, 0, 2 },
+        { 0x5524, 0, 2 },
+        { 0x5526, 0, 2 },
+        { 0x5528, 0, 2 },
+        { 0x552A, 0, 2 },
+        { 0x552C, 0, 2 },
+        { 0x552E, 0, 2 },
+        { 0x5530, 0, 2 },
+        { 0x5532, 0, 2 },
+        { 0x5534, 0, 2 },
+        { 0x5536, 0, 2 },
+        { 0x5538, 0, 2 },
+        { 0x553A, 0, 2 },
+        { 0x553C, 0, 2 },
+        { 0x553E, 0, 2 },
+        { 0x5540, 0, 2 },
+        { 0x5542, 0, 2 },
+        { 0x5544, 0, 2 },
+        { 0x5546, 0, 2 },
+        { 0x5548, 0, 2 },
+        { 0x554A, 0, 2 },
+        { 0x554C, 0, 2 },
+        { 0x554E, 0, 2 },
+        { 0x5550, 0, 2 },
+        { 0x5552, 0, 2 },
+        { 0x5554, 0, 2 },
+        { 0x5556, 0, 2 },
+        { 0x5558, 0, 2 },
+        { 0x555A, 0, 2 },
+        { 0x555C, 0, 2 },
+        { 0x555E, 0, 3 },
+        { 0x5561, 0, 2 },
+        { 0x5563, 0, 2 },
+        { 0x5565, 0, 2 },
+        { 0x5567, 0, 2 },
+        { 0x5569, 0, 2 },
+        { 0x556B, 0, 2 },
+        { 0x556D, 0, 2 },
+        { 0x556F, 0, 2 },
+        { 0x5571, 0, 2 },
+        { 0x5573, 0, 2 },
+        { 0x5575, 0, 2 },
+        { 0x5577, 0, 2 },
+        { 0x5579, 0, 2 },
+        { 0x557B, 0, 2 },
+        { 0x557D, 0, 2 },
+        { 0x557F, 0, 2 },
+        { 0x5581, 0, 2 },
+        { 0x5583, 0, 2 },
+        { 0x5585, 0, 2 },
+        { 0x5587, 0, 2 },
+        { 0x5589, 0, 2 },
+        { 0x558B, 0, 2 },
+        { 0x558D, 0, 2 },
+        { 0x558F, 0, 2 },
+        { 0x5591, 0, 2 },
+        { 0x5593, 0, 3 },
+        { 0x5596, 0, 2 },
+        { 0x5598, 0, 2 },
+        { 0x559A, 0, 2 },
+        { 0x559C, 0, 2 },
+        { 0x559E, 0, 2 },
+        { 0x55A0, 0, 2 },
+        { 0x55A2, 0, 2 },
+        { 0x55A4, 0, 2 },
+        { 0x55A6, 0, 1 },
+        { 0x55A7, 0, 1 },
+        { 0x55A8, 0, 1 },
+        { 0x55A9, 0, 1 },
+        { 0x55AA, 0, 1 },
+        { 0x55AB, 0, 1 },
+        { 0x55AC, 0, 1 },
+        { 0x55AD, 0, 1 },
+        { 0x55AE, 0, 1 },
+        { 0x55AF, 0, 1 },
+        { 0x55B0, 0, 1 },
+        { 0x55B1, 0, 1 },
+        { 0x55B2, 0, 1 },
+        { 0x55B3, 0, 1 },
+        { 0x55B4, 0, 1 },
+        { 0x55B5, 0, 1 },
+        { 0x55B6, 0, 1 },
+        { 0x55B7, 0, 1 },
+        { 0x55B8, 0, 1 },
+        { 0x55B9, 0, 1 },
+        { 0x55BA, 0, 1 },
+        { 0x55BB, 0, 1 },
+        { 0x55BC, 0, 1 },
+        { 0x55BD, 0, 1 },
+        { 0x55BE, 0, 1 },
+        { 0x55BF, 0, 1 },
+        { 0x55C0, 0, 1 },
+        { 0x55C1, 0, 1 },
+        { 0x55C2, 0, 1 },
+        { 0x55C3, 0, 1 },
+        { 0x55C4, 0, 1 },
+        { 0x55C5, 0, 1 },
+        { 0x55C6, 0, 1 },
+        { 0x55C7, 0, 1 },
+        { 0x55C8, 0, 1 },
+        { 0x55C9, 0, 1 },
+        { 0x55CA, 0, 1 },
+        { 0x55CB, 0, 1 },
+        { 0x55CC, 0, 1 },
+        { 0x55CD, 0, 1 },
+        { 0x55CE, 0, 1 },
+        { 0x55CF, 0, 1 },
+        { 0x55D0, 0, 1 },
+        { 0x55D1, 0, 1 },
+        { 0x55D2, 0, 1 },
+        { 0x55D3, 0, 1 },
+        { 0x55D4, 0, 1 },
+        { 0x55D5, 0, 1 },
+        { 0x55D6, 0, 1 },
+        { 0x55D7, 0, 1 },
+        { 0x55D8, 0, 2 },
+        { 0x55DA, 0, 2 },
+        { 0x55DC, 0, 2 },
+        { 0x55DE, 0, 2 },
+        { 0x55E0, 0, 2 },
+        { 0x55E2, 0, 2 },
+        { 0x55E4, 0, 2 },
+        { 0x55E6, 0, 2 },
+        { 0x55E8, 0, 2 },
+        { 0x55EA, 0, 2 },
+        { 0x55EC, 0, 2 },
+        { 0x55EE, 0, 2 },
+        { 0x55F0, 0, 2 },
+        { 0x55F2, 0, 2 },
+        { 0x55F4, 0, 2 },
+        { 0x55F6, 0, 2 },
+        { 0x55F8, 0, 2 },
+        { 0x55FA, 0, 2 },
+        { 0x55FC, 0, 2 },
+        { 0x55FE, 0, 2 },
+        { 0x5600, 0, 2 },
+        { 0x5602, 0, 2 },
+        { 0x5604, 0, 2 },
+        { 0x5606, 0, 2 },
+        { 0x5608, 0, 2 },
+        { 0x560A, 0, 2 },
+        { 0x560C, 0, 2 },
+        { 0x560E, 0, 2 },
+        { 0x5610, 0, 2 },
+        { 0x5612, 0, 2 },
+        { 0x5614, 0, 2 },
+        { 0x5616, 0, 2 },
+        { 0x5618, 0, 2 },
+        { 0x561A, 0, 2 },
+        { 0x561C, 0, 2 },
+        { 0x561E, 0, 2 },
+        { 0x5620, 0, 2 },
+        { 0x5622, 0, 2 },
+        { 0x5624, 0, 2 },
+        { 0x5626, 0, 2 },
+        { 0x5628, 0, 2 },
+        { 0x562A, 0, 2 },
+        { 0x562C, 0, 2 },
+        { 0x562E, 0, 2 },
+        { 0x5630, 0, 2 },
+        { 0x5632, 0, 2 },
+        { 0x5634, 0, 2 },
+        { 0x5636, 0, 2 },
+        { 0x5638, 0, 2 },
+        { 0x563A, 0, 2 },
+        { 0x563C, 0, 2 },
+        { 0x563E, 0, 2 },
+        { 0x5640, 0, 2 },
+        { 0x5642, 0, 2 },
+        { 0x5644, 0, 2 },
+        { 0x5646, 0, 2 },
+        { 0x5648, 0, 2 },
+        { 0x564A, 0, 2 },
+        { 0x564C, 0, 2 },
+        { 0x564E, 0, 2 },
+        { 0x5650, 0, 2 },
+        { 0x5652, 0, 2 },
+        { 0x5654, 0, 2 },
+        { 0x5656, 0, 2 },
+        { 0x5658, 0, 2 },
+        { 0x565A, 0, 2 },
+        { 0x565C, 0, 2 },
+        { 0x565E, 0, 2 },
+        { 0x5660, 0, 2 },
+        { 0x5662, 0, 2 },
+        { 0x5664, 0, 2 },
+        { 0x5666, 0, 2 },
+        { 0x5668, 0, 2 },
+        { 0x566A, 0, 2 },
+        { 0x566C, 0, 2 },
+        { 0x566E, 0, 2 },
+        { 0x5670, 0, 2 },
+        { 0x5672, 0, 2 },
+        { 0x5674, 0, 2 },
+        { 0x5676, 0, 2 },
+        { 0x5678, 0, 2 },
+        { 0x567A, 0, 2 },
+        { 0x567C, 0, 2 },
+        { 0x567E, 0, 2 },
+        { 0x5680, 0, 2 },
+        { 0x5682, 0, 2 },
+        { 0x5684, 0, 2 },
+        { 0x5686, 0, 2 },
+        { 0x5688, 0, 2 },
+        { 0x568A, 0, 2 },
+        { 0x568C, 0, 2 },
+        { 0x568E, 0, 2 },
+        { 0x5690, 0, 2 },
+        { 0x5692, 0, 2 },
+        { 0x5694, 0, 2 },
+        { 0x5696, 0, 2 },
+        { 0x5698, 0, 2 },
+        { 0x569A, 0, 2 },
+        { 0x569C, 0, 2 },
+        { 0x569E, 0, 2 },
+        { 0x56A0, 0, 2 },
+        { 0x56A2, 0, 2 },
+        { 0x56A4, 0, 2 },
+        { 0x56A6, 0, 2 },
+        { 0x56A8, 0, 2 },
+        { 0x56AA, 0, 2 },
+        { 0x56AC, 0, 2 },
+        { 0x56AE, 0, 2 },
+        { 0x56B0, 0, 2 },
+        { 0x56B2, 0, 2 },
+        { 0x56B4, 0, 2 },
+        { 0x56B6, 0, 2 },
+        { 0x56B8, 0, 2 },
+        { 0x56BA, 0, 2 },
+        { 0x56BC, 0, 2 },
+        { 0x56BE, 0, 2 },
+        { 0x56C0, 0, 2 },
+        { 0x56C2, 0, 2 },
+        { 0x56C4, 0, 2 },
+        { 0x56C6, 0, 2 },
+        { 0x56C8, 0, 2 },
+        { 0x56CA, 0, 2 },
+        { 0x56CC, 0, 2 },
+        { 0x56CE, 0, 2 },
+        { 0x56D0, 0, 2 },
+        { 0x56D2, 0, 2 },
+        { 0x56D4, 0, 2 },
+        { 0x56D6, 0, 2 },
+        { 0x56D8, 0, 2 },
+        { 0x56DA, 0, 2 },
+        { 0x56DC, 0, 2 },
+        { 0x56DE, 0, 2 },
+        { 0x56E0, 0, 2 },
+        { 0x56E2, 0, 2 },
+        { 0x56E4, 0, 2 },
+        { 0x56E6, 0, 2 },
+        { 0x56E8, 0, 2 },
+        { 0x56EA, 0, 2 },
+        { 0x56EC, 0, 2 },
+        { 0x56EE, 0, 2 },
+        { 0x56F0, 0, 2 },
+        { 0x56F2, 0, 2 },
+        { 0x56F4, 0, 2 },
+        { 0x56F6, 0, 2 },
+        { 0x56F8, 0, 2 },
+        { 0x56FA, 0, 2 },
+        { 0x56FC, 0, 2 },
+        { 0x56FE, 0, 2 },
+        { 0x5700, 0, 2 },
+        { 0x5702, 0, 2 },
+        { 0x5704, 0, 2 },
+        { 0x5706, 0, 2 },
+        { 0x5708, 0, 3 },
+        { 0x570B, 0, 3 },
+        { 0x570E, 0, 3 },
+        { 0x5711, 0, 3 },
+        { 0x5714, 0, 3 },
+        { 0x5717, 0, 3 },
+        { 0x571A, 0, 3 },
+        { 0x571D, 0, 3 },
+        { 0x5720, 0, 3 },
+        { 0x5723, 0, 3 },
+        { 0x5726, 0, 3 },
+        { 0x5729, 0, 3 },
+        { 0x572C, 0, 3 },
+        { 0x572F, 0, 3 },
+        { 0x5732, 0, 3 },
+        { 0x5735, 0, 3 },
+        { 0x5738, 0, 3 },
+        { 0x573B, 0, 3 },
+        { 0x573E, 0, 3 },
+        { 0x5741, 0, 3 },
+        { 0x5744, 0, 3 },
+        { 0x5747, 0, 3 },
+        { 0x574A, 0, 3 },
+        { 0x574D, 0, 3 },
+        { 0x5750, 0, 3 },
+        { 0x5753, 0, 3 },
+        { 0x5756, 0, 7 },
+        { 0x575D, 0, 1 },
+        { 0x575E, 0, 1 },
+        { 0x575F, 0, 2 },
+        { 0x5761, 0, 2 },
+        { 0x5763, 0, 1 },
+        { 0x5764, 0, 1 },
+        { 0x5765, 0, 1 },
+        { 0x5766, 0, 1 },
+        { 0x5767, 0, 1 },
+        { 0x5768, 0, 1 },
+        { 0x5769, 0, 1 },
+        { 0x576A, 0, 1 },
+        { 0x576B, 0, 1 },
+        { 0x576C, 0, 1 },
+        { 0x576D, 0, 1 },
+        { 0x576E, 0, 1 },
+        { 0x576F, 0, 1 },
+        { 0x5770, 0, 1 },
+        { 0x5771, 0, 1 },
+        { 0x5772, 0, 1 },
+        { 0x5773, 0, 1 },
+        { 0x5774, 0, 1 },
+        { 0x5775, 0, 1 },
+        { 0x5776, 0, 1 },
+        { 0x5777, 0, 1 },
+        { 0x5778, 0, 1 },
+        { 0x5779, 0, 1 },
+        { 0x577A, 0, 1 },
+        { 0x577B, 0, 1 },
+        { 0x577C, 0, 1 },
+        { 0x577D, 0, 2 },
+        { 0x577F, 0, 2 },
+        { 0x5781, 0, 2 },
+        { 0x5783, 0, 2 },
+        { 0x5785, 0, 3 },
+        { 0x5788, 0, 2 },
+        { 0x578A, 0, 2 },
+        { 0x578C, 0, 2 },
+        { 0x578E, 0, 2 },
+        { 0x5790, 0, 2 },
+        { 0x5792, 0, 6 },
+        { 0x5798, 0, 6 },
+        { 0x579E, 0, 3 },
+        { 0x57A1, 0, 3 },
+        { 0x57A4, 0, 3 },
+        { 0x57A7, 0, 3 },
+        { 0x57AA, 0, 6 },
+        { 0x57B0, 0, 3 },
+        { 0x57B3, 0, 3 },
+        { 0x57B6, 0, 3 },
+        { 0x57B9, 0, 3 },
+        { 0x57BC, 0, 3 },
+        { 0x57BF, 0, 3 },
+        { 0x57C2, 0, 3 },
+        { 0x57C5, 0, 3 },
+        { 0x57C8, 0, 3 },
+        { 0x57CB, 0, 3 },
+        { 0x57CE, 0, 3 },
+        { 0x57D1, 0, 3 },
+        { 0x57D4, 0, 3 },
+        { 0x57D7, 0, 3 },
+        { 0x57DA, 0, 3 },
+        { 0x57DD, 0, 3 },
+        { 0x57E0, 0, 3 },
+        { 0x57E3, 0, 3 },
+        { 0x57E6, 0, 3 },
+        { 0x57E9, 0, 3 },
+        { 0x57EC, 0, 3 },
+        { 0x57EF, 0, 3 },
+        { 0x57F2, 0, 3 },
+        { 0x57F5, 0, 3 },
+        { 0x57F8, 0, 3 },
+        { 0x57FB, 0, 3 },
+        { 0x57FE, 0, 3 },
+        { 0x5801, 0, 3 },
+        { 0x5804, 0, 3 },
+        { 0x5807, 0, 3 },
+        { 0x580A, 0, 3 },
+        { 0x580D, 0, 3 },
+        { 0x5810, 0, 3 },
+        { 0x5813, 0, 3 },
+        { 0x5816, 0, 3 },
+        { 0x5819, 0, 3 },
+        { 0x581C, 0, 3 },
+        { 0x581F, 0, 3 },
+        { 0x5822, 0, 3 },
+        { 0x5825, 0, 3 },
+        { 0x5828, 0, 9 },
+        { 0x5831, 0, 9 },
+        { 0x583A, 0, 9 },
+        { 0x5843, 0, 9 },
+        { 0x584C, 0, 9 },
+        { 0x5855, 0, 9 },
+        { 0x585E, 0, 9 },
+        { 0x5867, 0, 9 },
+        { 0x5870, 0, 9 },
+        { 0x5879, 0, 3 },
+        { 0x587C, 0, 3 },
+        { 0x587F, 0, 1 },
+        { 0x5880, 0, 1 },
+        { 0x5881, 0, 1 },
+        { 0x5882, 0, 1 },
+        { 0x5883, 0, 1 },
+        { 0x5884, 0, 1 },
+        { 0x5885, 0, 1 },
+        { 0x5886, 0, 1 },
+        { 0x5887, 0, 1 },
+        { 0x5888, 0, 1 },
+        { 0x5889, 3, 3 },
+        { 0x588F, 3, 3 },
+        { 0x5895, 3, 3 },
+        { 0x589B, 4, 4 },
+        { 0x58A3, 3, 3 },
+        { 0x58A9, 3, 3 },
+        { 0x58AF, 3, 3 },
+        { 0x58B5, 3, 3 },
+        { 0x58BB, 3, 3 },
+        { 0x58C1, 3, 3 },
+        { 0x58C7, 3, 3 },
+        { 0x58CD, 3, 3 },
+        { 0x58D3, 3, 3 },
+        { 0x58D9, 4, 4 },
+        { 0x58E1, 3, 3 },
+        { 0x58E7, 3, 3 },
+        { 0x58ED, 3, 3 },
+        { 0x58F3, 3, 3 },
+        { 0x58F9, 4, 4 },
+        { 0x5901, 3, 3 },
+        { 0x5907, 3, 3 },
+        { 0x590D, 3, 3 },
+        { 0x5913, 4, 4 },
+        { 0x591B, 3, 3 },
+        { 0x5921, 3, 3 },
+        { 0x5927, 3, 3 },
+        { 0x592D, 3, 3 },
+        { 0x5933, 3, 3 },
+        { 0x5939, 4, 4 },
+        { 0x5941, 3, 3 },
+        { 0x5947, 3, 3 },
+        { 0x594D, 3, 3 },
+        { 0x5953, 3, 3 },
+        { 0x5959, 3, 3 },
+        { 0x595F, 3, 3 },
+        { 0x5965, 3, 3 },
+        { 0x596B, 3, 3 },
+        { 0x5971, 3, 3 },
+        { 0x5977, 3, 3 },
+        { 0x597D, 3, 3 },
+        { 0x5983, 3, 3 },
+        { 0x5989, 3, 3 },
+        { 0x598F, 3, 3 },
+        { 0x5995, 3, 3 },
+        { 0x599B, 3, 3 },
+        { 0x59A1, 3, 3 },
+        { 0x59A7, 3, 3 },
+        { 0x59AD, 3, 3 },
+        { 0x59B3, 3, 3 },
+        { 0x59B9, 3, 3 },
+        { 0x59BF, 3, 3 },
+        { 0x59C5, 3, 3 },
+        { 0x59CB, 4, 4 },
+        { 0x59D3, 3, 3 },
+        { 0x59D9, 3, 3 },
+        { 0x59DF, 3, 3 },
+        { 0x59E5, 4, 4 },
+        { 0x59ED, 3, 3 },
+        { 0x59F3, 3, 3 },
+        { 0x59F9, 3, 3 },
+        { 0x59FF, 3, 3 },
+        { 0x5A05, 3, 3 },
+        { 0x5A0B, 3, 3 },
+        { 0x5A11, 3, 3 },
+        { 0x5A17, 3, 3 },
+        { 0x5A1D, 3, 3 },
+        { 0x5A23, 3, 3 },
+        { 0x5A29, 3, 3 },
+        { 0x5A2F, 3, 3 },
+        { 0x5A35, 3, 3 },
+        { 0x5A3B, 3, 3 },
+        { 0x5A41, 3, 3 },
+        { 0x5A47, 3, 3 },
+        { 0x5A4D, 3, 3 },
+        { 0x5A53, 3, 3 },
+        { 0x5A59, 3, 3 },
+        { 0x5A5F, 3, 3 },
+        { 0x5A65, 3, 3 },
+        { 0x5A6B, 3, 3 },
+        { 0x5A71, 3, 3 },
+        { 0x5A77, 3, 3 },
+        { 0x5A7D, 3, 3 },
+        { 0x5A83, 3, 3 },
+        { 0x5A89, 3, 3 },
+        { 0x5A8F, 3, 3 },
+        { 0x5A95, 3, 3 },
+        { 0x5A9B, 3, 3 },
+        { 0x5AA1, 3, 3 },
+        { 0x5AA7, 3, 3 },
+        { 0x5AAD, 4, 4 },
+        { 0x5AB5, 3, 3 },
+        { 0x5ABB, 3, 3 },
+        { 0x5AC1, 3, 3 },
+        { 0x5AC7, 3, 3 },
+        { 0x5ACD, 3, 3 },
+        { 0x5AD3, 3, 3 },
+        { 0x5AD9, 4, 4 },
+        { 0x5AE1, 4, 4 },
+        { 0x5AE9, 3, 3 },
+        { 0x5AEF, 3, 3 },
+        { 0x5AF5, 3, 3 },
+        { 0x5AFB, 3, 3 },
+        { 0x5B01, 3, 3 },
+        { 0x5B07, 3, 3 },
+        { 0x5B0D, 3, 3 },
+        { 0x5B13, 3, 3 },
+        { 0x5B19, 3, 3 },
+        { 0x5B1F, 3, 3 },
+        { 0x5B25, 4, 4 },
+        { 0x5B2D, 3, 3 },
+        { 0x5B33, 3, 3 },
+        { 0x5B39, 3, 3 },
+        { 0x5B3F, 3, 3 },
+        { 0x5B45, 4, 4 },
+        { 0x5B4D, 3, 3 },
+        { 0x5B53, 3, 3 },
+        { 0x5B59, 3, 3 },
+        { 0x5B5F, 3, 3 },
+        { 0x5B65, 3, 3 },
+        { 0x5B6B, 3, 3 },
+        { 0x5B71, 3, 3 },
+        { 0x5B77, 3, 3 },
+        { 0x5B7D, 3, 3 },
+        { 0x5B83, 4, 4 },
+        { 0x5B8B, 3, 3 },
+        { 0x5B91, 4, 4 },
+        { 0x5B99, 3, 3 },
+        { 0x5B9F, 3, 3 },
+        { 0x5BA5, 3, 3 },
+        { 0x5BAB, 3, 3 },
+        { 0x5BB1, 3, 3 },
+        { 0x5BB7, 3, 3 },
+        { 0x5BBD, 3, 3 },
+        { 0x5BC3, 3, 3 },
+        { 0x5BC9, 3, 3 },
+        { 0x5BCF, 3, 3 },
+        { 0x5BD5, 3, 3 },
+        { 0x5BDB, 4, 4 },
+        { 0x5BE3, 3, 3 },
+        { 0x5BE9, 3, 3 },
+        { 0x5BEF, 3, 3 },
+        { 0x5BF5, 3, 3 },
+        { 0x5BFB, 3, 3 },
+        { 0x5C01, 4, 4 },
+        { 0x5C09, 3, 3 },
+        { 0x5C0F, 4, 4 },
+        { 0x5C17, 4, 4 },
+        { 0x5C1F, 3, 3 },
+        { 0x5C25, 3, 3 },
+        { 0x5C2B, 3, 3 },
+        { 0x5C31, 3, 3 },
+        { 0x5C37, 4, 4 },
+        { 0x5C3F, 4, 4 },
+        { 0x5C47, 3, 3 },
+        { 0x5C4D, 3, 3 },
+        { 0x5C53, 3, 3 },
+        { 0x5C59, 3, 3 },
+        { 0x5C5F, 3, 3 },
+        { 0x5C65, 3, 3 },
+        { 0x5C6B, 3, 3 },
+        { 0x5C71, 3, 3 },
+        { 0x5C77, 3, 3 },
+        { 0x5C7D, 3, 3 },
+        { 0x5C83, 3, 3 },
+        { 0x5C89, 4, 4 },
+        { 0x5C91, 3, 3 },
+        { 0x5C97, 3, 3 },
+        { 0x5C9D, 3, 3 },
+        { 0x5CA3, 3, 3 },
+        { 0x5CA9, 3, 3 },
+        { 0x5CAF, 3, 3 },
+        { 0x5CB5, 3, 3 },
+        { 0x5CBB, 3, 3 },
+        { 0x5CC1, 3, 3 },
+        { 0x5CC7, 3, 3 },
+        { 0x5CCD, 3, 3 },
+        { 0x5CD3, 3, 3 },
+        { 0x5CD9, 3, 3 },
+        { 0x5CDF, 3, 3 },
+        { 0x5CE5, 3, 3 },
+        { 0x5CEB, 3, 3 },
+        { 0x5CF1, 3, 3 },
+        { 0x5CF7, 3, 3 },
+        { 0x5CFD, 3, 3 },
+        { 0x5D03, 4, 4 },
+        { 0x5D0B, 3, 3 },
+        { 0x5D11, 3, 3 },
+        { 0x5D17, 3, 3 },
+        { 0x5D1D, 3, 3 },
+        { 0x5D23, 3, 3 },
+        { 0x5D29, 4, 4 },
+        { 0x5D31, 3, 3 },
+        { 0x5D37, 3, 3 },
+        { 0x5D3D, 3, 3 },
+        { 0x5D43, 3, 3 },
+        { 0x5D49, 3, 3 },
+        { 0x5D4F, 3, 3 },
+        { 0x5D55, 3, 3 },
+        { 0x5D5B, 3, 3 },
+        { 0x5D61, 3, 3 },
+        { 0x5D67, 3, 3 },
+        { 0x5D6D, 3, 3 },
+        { 0x5D73, 4, 4 },
+        { 0x5D7B, 3, 3 },
+        { 0x5D81, 3, 3 },
+        { 0x5D87, 3, 3 },
+        { 0x5D8D, 3, 3 },
+        { 0x5D93, 3, 3 },
+        { 0x5D99, 3, 3 },
+        { 0x5D9F, 3, 3 },
+        { 0x5DA5, 3, 3 },
+        { 0x5DAB, 3, 3 },
+        { 0x5DB1, 3, 3 },
+        { 0x5DB7, 3, 3 },
+        { 0x5DBD, 3, 3 },
+        { 0x5DC3, 3, 3 },
+        { 0x5DC9, 3, 3 },
+        { 0x5DCF, 3, 3 },
+        { 0x5DD5, 3, 3 },
+        { 0x5DDB, 3, 3 },
+        { 0x5DE1, 3, 3 },
+        { 0x5DE7, 4, 4 },
+        { 0x5DEF, 3, 3 },
+        { 0x5DF5, 3, 3 },
+        { 0x5DFB, 3, 3 },
+        { 0x5E01, 3, 3 },
+        { 0x5E07, 3, 3 },
+        { 0x5E0D, 4, 4 },
+        { 0x5E15, 3, 3 },
+        { 0x5E1B, 3, 3 },
+        { 0x5E21, 3, 3 },
+        { 0x5E27, 3, 3 },
+        { 0x5E2D, 3, 3 },
+        { 0x5E33, 3, 3 },
+        { 0x5E39, 3, 3 },
+        { 0x5E3F, 3, 3 },
+        { 0x5E45, 4, 4 },
+        { 0x5E4D, 3, 3 },
+        { 0x5E53, 3, 3 },
+        { 0x5E59, 3, 3 },
+        { 0x5E5F, 4, 4 },
+        { 0x5E67, 3, 3 },
+        { 0x5E6D, 3, 3 },
+        { 0x5E73, 3, 3 },
+        { 0x5E79, 3, 3 },
+        { 0x5E7F, 3, 3 },
+        { 0x5E85, 3, 3 },
+        { 0x5E8B, 4, 4 },
+        { 0x5E93, 4, 4 },
+        { 0x5E9B, 4, 4 },
+        { 0x5EA3, 3, 3 },
+        { 0x5EA9, 4, 4 },
+        { 0x5EB1, 3, 3 },
+        { 0x5EB7, 3, 3 },
+        { 0x5EBD, 3, 3 },
+        { 0x5EC3, 3, 3 },
+        { 0x5EC9, 3, 3 },
+        { 0x5ECF, 3, 3 },
+        { 0x5ED5, 3, 3 },
+        { 0x5EDB, 3, 3 },
+        { 0x5EE1, 3, 3 },
+        { 0x5EE7, 3, 3 },
+        { 0x5EED, 4, 4 },
+        { 0x5EF5, 3, 3 },
+        { 0x5EFB, 3, 3 },
+        { 0x5F01, 3, 3 },
+        { 0x5F07, 3, 3 },
+        { 0x5F0D, 3, 3 },
+        { 0x5F13, 3, 3 },
+        { 0x5F19, 4, 4 },
+        { 0x5F21, 3, 3 },
+        { 0x5F27, 3, 3 },
+        { 0x5F2D, 4, 4 },
+        { 0x5F35, 4, 4 },
+        { 0x5F3D, 3, 3 },
+        { 0x5F43, 3, 3 },
+        { 0x5F49, 3, 3 },
+        { 0x5F4F, 3, 3 },
+        { 0x5F55, 3, 3 },
+        { 0x5F5B, 3, 3 },
+        { 0x5F61, 3, 3 },
+        { 0x5F67, 3, 3 },
+        { 0x5F6D, 3, 3 },
+        { 0x5F73, 4, 4 },
+        { 0x5F7B, 3, 3 },
+        { 0x5F81, 4, 4 },
+        { 0x5F89, 3, 3 },
+        { 0x5F8F, 4, 4 },
+        { 0x5F97, 3, 3 },
+        { 0x5F9D, 3, 3 },
+        { 0x5FA3, 3, 3 },
+        { 0x5FA9, 4, 4 },
+        { 0x5FB1, 3, 3 },
+        { 0x5FB7, 3, 3 },
+        { 0x5FBD, 4, 4 },
+        { 0x5FC5, 4, 4 },
+        { 0x5FCD, 3, 3 },
+        { 0x5FD3, 3, 3 },
+        { 0x5FD9, 3, 3 },
+        { 0x5FDF, 3, 3 },
+        { 0x5FE5, 3, 3 },
+        { 0x5FEB, 3, 3 },
+        { 0x5FF1, 3, 3 },
+        { 0x5FF7, 3, 3 },
+        { 0x5FFD, 3, 3 },
+        { 0x6003, 3, 3 },
+        { 0x6009, 3, 3 },
+        { 0x600F, 3, 3 },
+        { 0x6015, 3, 3 },
+        { 0x601B, 4, 4 },
+        { 0x6023, 3, 3 },
+        { 0x6029, 4, 4 },
+        { 0x6031, 3, 3 },
+        { 0x6037, 4, 4 },
+        { 0x603F, 3, 3 },
+        { 0x6045, 4, 4 },
+        { 0x604D, 4, 4 },
+        { 0x6055, 4, 4 },
+        { 0x605D, 3, 3 },
+        { 0x6063, 3, 3 },
+        { 0x6069, 3, 3 },
+        { 0x606F, 4, 4 },
+        { 0x6077, 4, 4 },
+        { 0x607F, 4, 4 },
+        { 0x6087, 4, 4 },
+        { 0x608F, 3, 3 },
+        { 0x6095, 3, 3 },
+        { 0x609B, 3, 3 },
+        { 0x60A1, 3, 3 },
+        { 0x60A7, 3, 3 },
+        { 0x60AD, 3, 3 },
+        { 0x60B3, 3, 3 },
+        { 0x60B9, 3, 3 },
+        { 0x60BF, 4, 4 },
+        { 0x60C7, 3, 3 },
+        { 0x60CD, 3, 3 },
+        { 0x60D3, 3, 3 },
+        { 0x60D9, 3, 3 },
+        { 0x60DF, 4, 4 },
+        { 0x60E7, 3, 3 },
+        { 0x60ED, 4, 4 },
+        { 0x60F5, 4, 4 },
+        { 0x60FD, 3, 3 },
+        { 0x6103, 3, 3 },
+        { 0x6109, 3, 3 },
+        { 0x610F, 3, 3 },
+        { 0x6115, 3, 3 },
+        { 0x611B, 3, 3 },
+        { 0x6121, 4, 4 },
+        { 0x6129, 4, 4 },
+        { 0x6131, 4, 4 },
+        { 0x6139, 3, 3 },
+        { 0x613F, 3, 3 },
+        { 0x6145, 4, 4 },
+        { 0x614D, 3, 3 },
+        { 0x6153, 3, 3 },
+        { 0x6159, 3, 3 },
+        { 0x615F, 4, 4 },
+        { 0x6167, 3, 3 },
+        { 0x616D, 3, 3 },
+        { 0x6173, 3, 3 },
+        { 0x6179, 3, 3 },
+        { 0x617F, 3, 3 },
+        { 0x6185, 4, 4 },
+        { 0x618D, 3, 3 },
+        { 0x6193, 3, 3 },
+        { 0x6199, 3, 3 },
+        { 0x619F, 3, 3 },
+        { 0x61A5, 3, 3 },
+        { 0x61AB, 3, 3 },
+        { 0x61B1, 4, 4 },
+        { 0x61B9, 4, 4 },
+        { 0x61C1, 3, 3 },
+        { 0x61C7, 4, 4 },
+        { 0x61CF, 3, 3 },
+        { 0x61D5, 4, 4 },
+        { 0x61DD, 3, 3 },
+        { 0x61E3, 3, 3 },
+        { 0x61E9, 3, 3 },
+        { 0x61EF, 4, 4 },
+        { 0x61F7, 4, 4 },
+        { 0x61FF, 3, 3 },
+        { 0x6205, 4, 4 },
+        { 0x620D, 3, 3 },
+        { 0x6213, 4, 4 },
+        { 0x621B, 3, 3 },
+        { 0x6221, 3, 3 },
+        { 0x6227, 3, 3 },
+        { 0x622D, 3, 3 },
+        { 0x6233, 3, 3 },
+        { 0x6239, 3, 3 },
+        { 0x623F, 4, 4 },
+        { 0x6247, 4, 4 },
+        { 0x624F, 4, 4 },
+        { 0x6257, 4, 4 },
+        { 0x625F, 3, 3 },
+        { 0x6265, 3, 3 },
+        { 0x626B, 3, 3 },
+        { 0x6271, 3, 3 },
+        { 0x6277, 3, 3 },
+        { 0x627D, 3, 3 },
+        { 0x6283, 3, 3 },
+        { 0x6289, 3, 3 },
+        { 0x628F, 3, 3 },
+        { 0x6295, 3, 3 },
+        { 0x629B, 3, 3 },
+        { 0x62A1, 3, 3 },
+        { 0x62A7, 4, 4 },
+        { 0x62AF, 3, 3 },
+        { 0x62B5, 3, 3 },
+        { 0x62BB, 3, 3 },
+        { 0x62C1, 3, 3 },
+        { 0x62C7, 3, 3 },
+        { 0x62CD, 3, 3 },
+        { 0x62D3, 3, 3 },
+        { 0x62D9, 3, 3 },
+        { 0x62DF, 3, 3 },
+        { 0x62E5, 3, 3 },
+        { 0x62EB, 3, 3 },
+        { 0x62F1, 3, 3 },
+        { 0x62F7, 4, 4 },
+        { 0x62FF, 4, 4 },
+        { 0x6307, 4, 4 },
+        { 0x630F, 3, 3 },
+        { 0x6315, 3, 3 },
+        { 0x631B, 3, 3 },
+        { 0x6321, 3, 3 },
+        { 0x6327, 4, 4 },
+        { 0x632F, 3, 3 },
+        { 0x6335, 4, 4 },
+        { 0x633D, 3, 3 },
+        { 0x6343, 3, 3 },
+        { 0x6349, 4, 4 },
+        { 0x6351, 4, 4 },
+        { 0x6359, 3, 3 },
+        { 0x635F, 3, 3 },
+        { 0x6365, 3, 3 },
+        { 0x636B, 3, 3 },
+        { 0x6371, 3, 3 },
+        { 0x6377, 3, 3 },
+        { 0x637D, 3, 3 },
+        { 0x6383, 3, 3 },
+        { 0x6389, 3, 3 },
+        { 0x638F, 3, 3 },
+        { 0x6395, 3, 3 },
+        { 0x639B, 3, 3 },
+        { 0x63A1, 3, 3 },
+        { 0x63A7, 3, 3 },
+        { 0x63AD, 3, 3 },
+        { 0x63B3, 3, 3 },
+        { 0x63B9, 3, 3 },
+        { 0x63BF, 3, 3 },
+        { 0x63C5, 3, 3 },
+        { 0x63CB, 4, 4 },
+        { 0x63D3, 3, 3 },
+        { 0x63D9, 3, 3 },
+        { 0x63DF, 3, 3 },
+        { 0x63E5, 3, 3 },
+        { 0x63EB, 3, 3 },
+        { 0x63F1, 4, 4 },
+        { 0x63F9, 4, 4 },
+        { 0x6401, 3, 3 },
+        { 0x6407, 3, 3 },
+        { 0x640D, 3, 3 },
+        { 0x6413, 3, 3 },
+        { 0x6419, 3, 3 },
+        { 0x641F, 3, 3 },
+        { 0x6425, 4, 4 },
+        { 0x642D, 3, 3 },
+        { 0x6433, 3, 3 },
+        { 0x6439, 3, 3 },
+        { 0x643F, 3, 3 },
+        { 0x6445, 4, 4 },
+        { 0x644D, 4, 4 },
+        { 0x6455, 3, 3 },
+        { 0x645B, 3, 3 },
+        { 0x6461, 3, 3 },
+        { 0x6467, 4, 4 },
+        { 0x646F, 3, 3 },
+        { 0x6475, 3, 3 },
+        { 0x647B, 4, 4 },
+        { 0x6483, 4, 4 },
+        { 0x648B, 3, 3 },
+        { 0x6491, 3, 3 },
+        { 0x6497, 3, 3 },
+        { 0x649D, 4, 4 },
+        { 0x64A5, 3, 3 },
+        { 0x64AB, 3, 3 },
+        { 0x64B1, 3, 3 },
+        { 0x64B7, 3, 3 },
+        { 0x64BD, 3, 3 },
+        { 0x64C3, 3, 3 },
+        { 0x64C9, 3, 3 },
+        { 0x64CF, 4, 4 },
+        { 0x64D7, 3, 3 },
+        { 0x64DD, 3, 3 },
+        { 0x64E3, 3, 3 },
+        { 0x64E9, 4, 4 },
+        { 0x64F1, 3, 3 },
+        { 0x64F7, 3, 3 },
+        { 0x64FD, 3, 3 },
+        { 0x6503, 3, 3 },
+        { 0x6509, 4, 4 },
+        { 0x6511, 4, 4 },
+        { 0x6519, 3, 3 },
+        { 0x651F, 3, 3 },
+        { 0x6525, 3, 3 },
+        { 0x652B, 4, 4 },
+        { 0x6533, 3, 3 },
+        { 0x6539, 4, 4 },
+        { 0x6541, 3, 3 },
+        { 0x6547, 3, 3 },
+        { 0x654D, 3, 3 },
+        { 0x6553, 4, 4 },
+        { 0x655B, 3, 3 },
+        { 0x6561, 3, 3 },
+        { 0x6567, 3, 3 },
+        { 0x656D, 3, 3 },
+        { 0x6573, 3, 3 },
+        { 0x6579, 3, 3 },
+        { 0x657F, 3, 3 },
+        { 0x6585, 4, 4 },
+        { 0x658D, 3, 3 },
+        { 0x6593, 3, 3 },
+        { 0x6599, 3, 3 },
+        { 0x659F, 3, 3 },
+        { 0x65A5, 3, 3 },
+        { 0x65AB, 3, 3 },
+        { 0x65B1, 4, 4 },
+        { 0x65B9, 3, 3 },
+        { 0x65BF, 4, 4 },
+        { 0x65C7, 4, 4 },
+        { 0x65CF, 4, 4 },
+        { 0x65D7, 3, 3 },
+        { 0x65DD, 3, 3 },
+        { 0x65E3, 3, 3 },
+        { 0x65E9, 3, 3 },
+        { 0x65EF, 3, 3 },
+        { 0x65F5, 3, 3 },
+        { 0x65FB, 3, 3 },
+        { 0x6601, 3, 3 },
+        { 0x6607, 4, 4 },
+    };
+
+    // UTF-8.
+    inline constexpr Byte decomposition_bytes[26127] =
+    {
+        0x20, 0x20, 0xCC, 0x88, 0x61, 0x20, 0xCC, 0x84, 0x32, 0x33, 0x20, 0xCC, 0x81, 0xCE, 0xBC, 0x20,
+        0xCC, 0xA7, 0x31, 0x6F, 0x31, 0xE2, 0x81, 0x84, 0x34, 0x31, 0xE2, 0x81, 0x84, 0x32, 0x33, 0xE2,
+        0x81, 0x84, 0x34, 0x41, 0xCC, 0x80, 0x41, 0xCC, 0x80, 0x41, 0xCC, 0x81, 0x41, 0xCC, 0x81, 0x41,
+        0xCC, 0x82, 0x41, 0xCC, 0x82, 0x41, 0xCC, 0x83, 0x41, 0xCC, 0x83, 0x41, 0xCC, 0x88, 0x41, 0xCC,
+        0x88, 0x41, 0xCC, 0x8A, 0x41, 0xCC, 0x8A, 0x43, 0xCC, 0xA7, 0x43, 0xCC, 0xA7, 0x45, 0xCC, 0x80,
+        0x45, 0xCC, 0x80, 0x45, 0xCC, 0x81, 0x45, 0xCC, 0x81, 0x45, 0xCC, 0x82, 0x45, 0xCC, 0x82, 0x45,
+        0xCC, 0x88, 0x45, 0xCC, 0x88, 0x49, 0xCC, 0x80, 0x49, 0xCC, 0x80, 0x49, 0xCC, 0x81, 0x49, 0xCC,
+        0x81, 0x49, 0xCC, 0x82, 0x49, 0xCC, 0x82, 0x49, 0xCC, 0x88, 0x49, 0xCC, 0x88, 0x4E, 0xCC, 0x83,
+        0x4E, 0xCC, 0x83, 0x4F, 0xCC, 0x80, 0x4F, 0xCC, 0x80, 0x4F, 0xCC, 0x81, 0x4F, 0xCC, 0x81, 0x4F,
+        0xCC, 0x82, 0x4F, 0xCC, 0x82, 0x4F, 0xCC, 0x83, 0x4F, 0xCC, 0x83, 0x4F, 0xCC, 0x88, 0x4F, 0xCC,
+        0x88, 0x55, 0xCC, 0x80, 0x55, 0xCC, 0x80, 0x55, 0xCC, 0x81, 0x55, 0xCC, 0x81, 0x55, 0xCC, 0x82,
+        0x55, 0xCC, 0x82, 0x55, 0xCC, 0x88, 0x55, 0xCC, 0x88, 0x59, 0xCC, 0x81, 0x59, 0xCC, 0x81, 0x61,
+        0xCC, 0x80, 0x61, 0xCC, 0x80, 0x61, 0xCC, 0x81, 0x61, 0xCC, 0x81, 0x61, 0xCC, 0x82, 0x61, 0xCC,
+        0x82, 0x61, 0xCC, 0x83, 0x61, 0xCC, 0x83, 0x61, 0xCC, 0x88, 0x61, 0xCC, 0x88, 0x61, 0xCC, 0x8A,
+        0x61, 0xCC, 0x8A, 0x63, 0xCC, 0xA7, 0x63, 0xCC, 0xA7, 0x65, 0xCC, 0x80, 0x65, 0xCC, 0x80, 0x65,
+        0xCC, 0x81, 0x65, 0xCC, 0x81, 0x65, 0xCC, 0x82, 0x65, 0xCC, 0x82, 0x65, 0xCC, 0x88, 0x65, 0xCC,
+        0x88, 0x69, 0xCC, 0x80, 0x69, 0xCC, 0x80, 0x69, 0xCC, 0x81, 0x69, 0xCC, 0x81, 0x69, 0xCC, 0x82,
+        0x69, 0xCC, 0x82, 0x69, 0xCC, 0x88, 0x69, 0xCC, 0x88, 0x6E, 0xCC, 0x83, 0x6E, 0xCC, 0x83, 0x6F,
+        0xCC, 0x80, 0x6F, 0xCC, 0x80, 0x6F, 0xCC, 0x81, 0x6F, 0xCC, 0x81, 0x6F, 0xCC, 0x82, 0x6F, 0xCC,
+        0x82, 0x6F, 0xCC, 0x83, 0x6F, 0xCC, 0x83, 0x6F, 0xCC, 0x88, 0x6F, 0xCC, 0x88, 0x75, 0xCC, 0x80,
+        0x75, 0xCC, 0x80, 0x75, 0xCC, 0x81, 0x75, 0xCC, 0x81, 0x75, 0xCC, 0x82, 0x75, 0xCC, 0x82, 0x75,
+        0xCC, 0x88, 0x75, 0xCC, 0x88, 0x79, 0xCC, 0x81, 0x79, 0xCC, 0x81, 0x79, 0xCC, 0x88, 0x79, 0xCC,
+        0x88, 0x41, 0xCC, 0x84, 0x41, 0xCC, 0x84, 0x61, 0xCC, 0x84, 0x61, 0xCC, 0x84, 0x41, 0xCC, 0x86,
+        0x41, 0xCC, 0x86, 0x61, 0xCC, 0x86, 0x61, 0xCC, 0x86, 0x41, 0xCC, 0xA8, 0x41, 0xCC, 0xA8, 0x61,
+        0xCC, 0xA8, 0x61, 0xCC, 0xA8, 0x43, 0xCC, 0x81, 0x43, 0xCC, 0x81, 0x63, 0xCC, 0x81, 0x63, 0xCC,
+        0x81, 0x43, 0xCC, 0x82, 0x43, 0xCC, 0x82, 0x63, 0xCC, 0x82, 0x63, 0xCC, 0x82, 0x43, 0xCC, 0x87,
+        0x43, 0xCC, 0x87, 0x63, 0xCC, 0x87, 0x63, 0xCC, 0x87, 0x43, 0xCC, 0x8C, 0x43, 0xCC, 0x8C, 0x63,
+        0xCC, 0x8C, 0x63, 0xCC, 0x8C, 0x44, 0xCC, 0x8C, 0x44, 0xCC, 0x8C, 0x64, 0xCC, 0x8C, 0x64, 0xCC,
+        0x8C, 0x45, 0xCC, 0x84, 0x45, 0xCC, 0x84, 0x65, 0xCC, 0x84, 0x65, 0xCC, 0x84, 0x45, 0xCC, 0x86,
+        0x45, 0xCC, 0x86, 0x65, 0xCC, 0x86, 0x65, 0xCC, 0x86, 0x45, 0xCC, 0x87, 0x45, 0xCC, 0x87, 0x65,
+        0xCC, 0x87, 0x65, 0xCC, 0x87, 0x45, 0xCC, 0xA8, 0x45, 0xCC, 0xA8, 0x65, 0xCC, 0xA8, 0x65, 0xCC,
+        0xA8, 0x45, 0xCC, 0x8C, 0x45, 0xCC, 0x8C, 0x65, 0xCC, 0x8C, 0x65, 0xCC, 0x8C, 0x47, 0xCC, 0x82,
+        0x47, 0xCC, 0x82, 0x67, 0xCC, 0x82, 0x67, 0xCC, 0x82, 0x47, 0xCC, 0x86, 0x47, 0xCC, 0x86, 0x67,
+        0xCC, 0x86, 0x67, 0xCC, 0x86, 0x47, 0xCC, 0x87, 0x47, 0xCC, 0x87, 0x67, 0xCC, 0x87, 0x67, 0xCC,
+        0x87, 0x47, 0xCC, 0xA7, 0x47, 0xCC, 0xA7, 0x67, 0xCC, 0xA7, 0x67, 0xCC, 0xA7, 0x48, 0xCC, 0x82,
+        0x48, 0xCC, 0x82, 0x68, 0xCC, 0x82, 0x68, 0xCC, 0x82, 0x49, 0xCC, 0x83, 0x49, 0xCC, 0x83, 0x69,
+        0xCC, 0x83, 0x69, 0xCC, 0x83, 0x49, 0xCC, 0x84, 0x49, 0xCC, 0x84, 0x69, 0xCC, 0x84, 0x69, 0xCC,
+        0x84, 0x49, 0xCC, 0x86, 0x49, 0xCC, 0x86, 0x69, 0xCC, 0x86, 0x69, 0xCC, 0x86, 0x49, 0xCC, 0xA8,
+        0x49, 0xCC, 0xA8, 0x69, 0xCC, 0xA8, 0x69, 0xCC, 0xA8, 0x49, 0xCC, 0x87, 0x49, 0xCC, 0x87, 0x49,
+        0x4A, 0x69, 0x6A, 0x4A, 0xCC, 0x82, 0x4A, 0xCC, 0x82, 0x6A, 0xCC, 0x82, 0x6A, 0xCC, 0x82, 0x4B,
+        0xCC, 0xA7, 0x4B, 0xCC, 0xA7, 0x6B, 0xCC, 0xA7, 0x6B, 0xCC, 0xA7, 0x4C, 0xCC, 0x81, 0x4C, 0xCC,
+        0x81, 0x6C, 0xCC, 0x81, 0x6C, 0xCC, 0x81, 0x4C, 0xCC, 0xA7, 0x4C, 0xCC, 0xA7, 0x6C, 0xCC, 0xA7,
+        0x6C, 0xCC, 0xA7, 0x4C, 0xCC, 0x8C, 0x4C, 0xCC, 0x8C, 0x6C, 0xCC, 0x8C, 0x6C, 0xCC, 0x8C, 0x4C,
+        0xC2, 0xB7, 0x6C, 0xC2, 0xB7, 0x4E, 0xCC, 0x81, 0x4E, 0xCC, 0x81, 0x6E, 0xCC, 0x81, 0x6E, 0xCC,
+        0x81, 0x4E, 0xCC, 0xA7, 0x4E, 0xCC, 0xA7, 0x6E, 0xCC, 0xA7, 0x6E, 0xCC, 0xA7, 0x4E, 0xCC, 0x8C,
+        0x4E, 0xCC, 0x8C, 0x6E, 0xCC, 0x8C, 0x6E, 0xCC, 0x8C, 0xCA, 0xBC, 0x6E, 0x4F, 0xCC, 0x84, 0x4F,
+        0xCC, 0x84, 0x6F, 0xCC, 0x84, 0x6F, 0xCC, 0x84, 0x4F, 0xCC, 0x86, 0x4F, 0xCC, 0x86, 0x6F, 0xCC,
+        0x86, 0x6F, 0xCC, 0x86, 0x4F, 0xCC, 0x8B, 0x4F, 0xCC, 0x8B, 0x6F, 0xCC, 0x8B, 0x6F, 0xCC, 0x8B,
+        0x52, 0xCC, 0x81, 0x52, 0xCC, 0x81, 0x72, 0xCC, 0x81, 0x72, 0xCC, 0x81, 0x52, 0xCC, 0xA7, 0x52,
+        0xCC, 0xA7, 0x72, 0xCC, 0xA7, 0x72, 0xCC, 0xA7, 0x52, 0xCC, 0x8C, 0x52, 0xCC, 0x8C, 0x72, 0xCC,
+        0x8C, 0x72, 0xCC, 0x8C, 0x53, 0xCC, 0x81, 0x53, 0xCC, 0x81, 0x73, 0xCC, 0x81, 0x73, 0xCC, 0x81,
+        0x53, 0xCC, 0x82, 0x53, 0xCC, 0x82, 0x73, 0xCC, 0x82, 0x73, 0xCC, 0x82, 0x53, 0xCC, 0xA7, 0x53,
+        0xCC, 0xA7, 0x73, 0xCC, 0xA7, 0x73, 0xCC, 0xA7, 0x53, 0xCC, 0x8C, 0x53, 0xCC, 0x8C, 0x73, 0xCC,
+        0x8C, 0x73, 0xCC, 0x8C, 0x54, 0xCC, 0xA7, 0x54, 0xCC, 0xA7, 0x74, 0xCC, 0xA7, 0x74, 0xCC, 0xA7,
+        0x54, 0xCC, 0x8C, 0x54, 0xCC, 0x8C, 0x74, 0xCC, 0x8C, 0x74, 0xCC, 0x8C, 0x55, 0xCC, 0x83, 0x55,
+        0xCC, 0x83, 0x75, 0xCC, 0x83, 0x75, 0xCC, 0x83, 0x55, 0xCC, 0x84, 0x55, 0xCC, 0x84, 0x75, 0xCC,
+        0x84, 0x75, 0xCC, 0x84, 0x55, 0xCC, 0x86, 0x55, 0xCC, 0x86, 0x75, 0xCC, 0x86, 0x75, 0xCC, 0x86,
+        0x55, 0xCC, 0x8A, 0x55, 0xCC, 0x8A, 0x75, 0xCC, 0x8A, 0x75, 0xCC, 0x8A, 0x55, 0xCC, 0x8B, 0x55,
+        0xCC, 0x8B, 0x75, 0xCC, 0x8B, 0x75, 0xCC, 0x8B, 0x55, 0xCC, 0xA8, 0x55, 0xCC, 0xA8, 0x75, 0xCC,
+        0xA8, 0x75, 0xCC, 0xA8, 0x57, 0xCC, 0x82, 0x57, 0xCC, 0x82, 0x77, 0xCC, 0x82, 0x77, 0xCC, 0x82,
+        0x59, 0xCC, 0x82, 0x59, 0xCC, 0x82, 0x79, 0xCC, 0x82, 0x79, 0xCC, 0x82, 0x59, 0xCC, 0x88, 0x59,
+        0xCC, 0x88, 0x5A, 0xCC, 0x81, 0x5A, 0xCC, 0x81, 0x7A, 0xCC, 0x81, 0x7A, 0xCC, 0x81, 0x5A, 0xCC,
+        0x87, 0x5A, 0xCC, 0x87, 0x7A, 0xCC, 0x87, 0x7A, 0xCC, 0x87, 0x5A, 0xCC, 0x8C, 0x5A, 0xCC, 0x8C,
+        0x7A, 0xCC, 0x8C, 0x7A, 0xCC, 0x8C, 0x73, 0x4F, 0xCC, 0x9B, 0x4F, 0xCC, 0x9B, 0x6F, 0xCC, 0x9B,
+        0x6F, 0xCC, 0x9B, 0x55, 0xCC, 0x9B, 0x55, 0xCC, 0x9B, 0x75, 0xCC, 0x9B, 0x75, 0xCC, 0x9B, 0x44,
+        0x5A, 0xCC, 0x8C, 0x44, 0x7A, 0xCC, 0x8C, 0x64, 0x7A, 0xCC, 0x8C, 0x4C, 0x4A, 0x4C, 0x6A, 0x6C,
+        0x6A, 0x4E, 0x4A, 0x4E, 0x6A, 0x6E, 0x6A, 0x41, 0xCC, 0x8C, 0x41, 0xCC, 0x8C, 0x61, 0xCC, 0x8C,
+        0x61, 0xCC, 0x8C, 0x49, 0xCC, 0x8C, 0x49, 0xCC, 0x8C, 0x69, 0xCC, 0x8C, 0x69, 0xCC, 0x8C, 0x4F,
+        0xCC, 0x8C, 0x4F, 0xCC, 0x8C, 0x6F, 0xCC, 0x8C, 0x6F, 0xCC, 0x8C, 0x55, 0xCC, 0x8C, 0x55, 0xCC,
+        0x8C, 0x75, 0xCC, 0x8C, 0x75, 0xCC, 0x8C, 0x55, 0xCC, 0x88, 0xCC, 0x84, 0x55, 0xCC, 0x88, 0xCC,
+        0x84, 0x75, 0xCC, 0x88, 0xCC, 0x84, 0x75, 0xCC, 0x88, 0xCC, 0x84, 0x55, 0xCC, 0x88, 0xCC, 0x81,
+        0x55, 0xCC, 0x88, 0xCC, 0x81, 0x75, 0xCC, 0x88, 0xCC, 0x81, 0x75, 0xCC, 0x88, 0xCC, 0x81, 0x55,
+        0xCC, 0x88, 0xCC, 0x8C, 0x55, 0xCC, 0x88, 0xCC, 0x8C, 0x75, 0xCC, 0x88, 0xCC, 0x8C, 0x75, 0xCC,
+        0x88, 0xCC, 0x8C, 0x55, 0xCC, 0x88, 0xCC, 0x80, 0x55, 0xCC, 0x88, 0xCC, 0x80, 0x75, 0xCC, 0x88,
+        0xCC, 0x80, 0x75, 0xCC, 0x88, 0xCC, 0x80, 0x41, 0xCC, 0x88, 0xCC, 0x84, 0x41, 0xCC, 0x88, 0xCC,
+        0x84, 0x61, 0xCC, 0x88, 0xCC, 0x84, 0x61, 0xCC, 0x88, 0xCC, 0x84, 0x41, 0xCC, 0x87, 0xCC, 0x84,
+        0x41, 0xCC, 0x87, 0xCC, 0x84, 0x61, 0xCC, 0x87, 0xCC, 0x84, 0x61, 0xCC, 0x87, 0xCC, 0x84, 0xC3,
+        0x86, 0xCC, 0x84, 0xC3, 0x86, 0xCC, 0x84, 0xC3, 0xA6, 0xCC, 0x84, 0xC3, 0xA6, 0xCC, 0x84, 0x47,
+        0xCC, 0x8C, 0x47, 0xCC, 0x8C, 0x67, 0xCC, 0x8C, 0x67, 0xCC, 0x8C, 0x4B, 0xCC, 0x8C, 0x4B, 0xCC,
+        0x8C, 0x6B, 0xCC, 0x8C, 0x6B, 0xCC, 0x8C, 0x4F, 0xCC, 0xA8, 0x4F, 0xCC, 0xA8, 0x6F, 0xCC, 0xA8,
+        0x6F, 0xCC, 0xA8, 0x4F, 0xCC, 0xA8, 0xCC, 0x84, 0x4F, 0xCC, 0xA8, 0xCC, 0x84, 0x6F, 0xCC, 0xA8,
+        0xCC, 0x84, 0x6F, 0xCC, 0xA8, 0xCC, 0x84, 0xC6, 0xB7, 0xCC, 0x8C, 0xC6, 0xB7, 0xCC, 0x8C, 0xCA,
+        0x92, 0xCC, 0x8C, 0xCA, 0x92, 0xCC, 0x8C, 0x6A, 0xCC, 0x8C, 0x6A, 0xCC, 0x8C, 0x44, 0x5A, 0x44,
+        0x7A, 0x64, 0x7A, 0x47, 0xCC, 0x81, 0x47, 0xCC, 0x81, 0x67, 0xCC, 0x81, 0x67, 0xCC, 0x81, 0x4E,
+        0xCC, 0x80, 0x4E, 0xCC, 0x80, 0x6E, 0xCC, 0x80, 0x6E, 0xCC, 0x80, 0x41, 0xCC, 0x8A, 0xCC, 0x81,
+        0x41, 0xCC, 0x8A, 0xCC, 0x81, 0x61, 0xCC, 0x8A, 0xCC, 0x81, 0x61, 0xCC, 0x8A, 0xCC, 0x81, 0xC3,
+        0x86, 0xCC, 0x81, 0xC3, 0x86, 0xCC, 0x81, 0xC3, 0xA6, 0xCC, 0x81, 0xC3, 0xA6, 0xCC, 0x81, 0xC3,
+        0x98, 0xCC, 0x81, 0xC3, 0x98, 0xCC, 0x81, 0xC3, 0xB8, 0xCC, 0x81, 0xC3, 0xB8, 0xCC, 0x81, 0x41,
+        0xCC, 0x8F, 0x41, 0xCC, 0x8F, 0x61, 0xCC, 0x8F, 0x61, 0xCC, 0x8F, 0x41, 0xCC, 0x91, 0x41, 0xCC,
+        0x91, 0x61, 0xCC, 0x91, 0x61, 0xCC, 0x91, 0x45, 0xCC, 0x8F, 0x45, 0xCC, 0x8F, 0x65, 0xCC, 0x8F,
+        0x65, 0xCC, 0x8F, 0x45, 0xCC, 0x91, 0x45, 0xCC, 0x91, 0x65, 0xCC, 0x91, 0x65, 0xCC, 0x91, 0x49,
+        0xCC, 0x8F, 0x49, 0xCC, 0x8F, 0x69, 0xCC, 0x8F, 0x69, 0xCC, 0x8F, 0x49, 0xCC, 0x91, 0x49, 0xCC,
+        0x91, 0x69, 0xCC, 0x91, 0x69, 0xCC, 0x91, 0x4F, 0xCC, 0x8F, 0x4F, 0xCC, 0x8F, 0x6F, 0xCC, 0x8F,
+        0x6F, 0xCC, 0x8F, 0x4F, 0xCC, 0x91, 0x4F, 0xCC, 0x91, 0x6F, 0xCC, 0x91, 0x6F, 0xCC, 0x91, 0x52,
+        0xCC, 0x8F, 0x52, 0xCC, 0x8F, 0x72, 0xCC, 0x8F, 0x72, 0xCC, 0x8F, 0x52, 0xCC, 0x91, 0x52, 0xCC,
+        0x91, 0x72, 0xCC, 0x91, 0x72, 0xCC, 0x91, 0x55, 0xCC, 0x8F, 0x55, 0xCC, 0x8F, 0x75, 0xCC, 0x8F,
+        0x75, 0xCC, 0x8F, 0x55, 0xCC, 0x91, 0x55, 0xCC, 0x91, 0x75, 0xCC, 0x91, 0x75, 0xCC, 0x91, 0x53,
+        0xCC, 0xA6, 0x53, 0xCC, 0xA6, 0x73, 0xCC, 0xA6, 0x73, 0xCC, 0xA6, 0x54, 0xCC, 0xA6, 0x54, 0xCC,
+        0xA6, 0x74, 0xCC, 0xA6, 0x74, 0xCC, 0xA6, 0x48, 0xCC, 0x8C, 0x48, 0xCC, 0x8C, 0x68, 0xCC, 0x8C,
+        0x68, 0xCC, 0x8C, 0x41, 0xCC, 0x87, 0x41, 0xCC, 0x87, 0x61, 0xCC, 0x87, 0x61, 0xCC, 0x87, 0x45,
+        0xCC, 0xA7, 0x45, 0xCC, 0xA7, 0x65, 0xCC, 0xA7, 0x65, 0xCC, 0xA7, 0x4F, 0xCC, 0x88, 0xCC, 0x84,
+        0x4F, 0xCC, 0x88, 0xCC, 0x84, 0x6F, 0xCC, 0x88, 0xCC, 0x84, 0x6F, 0xCC, 0x88, 0xCC, 0x84, 0x4F,
+        0xCC, 0x83, 0xCC, 0x84, 0x4F, 0xCC, 0x83, 0xCC, 0x84, 0x6F, 0xCC, 0x83, 0xCC, 0x84, 0x6F, 0xCC,
+        0x83, 0xCC, 0x84, 0x4F, 0xCC, 0x87, 0x4F, 0xCC, 0x87, 0x6F, 0xCC, 0x87, 0x6F, 0xCC, 0x87, 0x4F,
+        0xCC, 0x87, 0xCC, 0x84, 0x4F, 0xCC, 0x87, 0xCC, 0x84, 0x6F, 0xCC, 0x87, 0xCC, 0x84, 0x6F, 0xCC,
+        0x87, 0xCC, 0x84, 0x59, 0xCC, 0x84, 0x59, 0xCC, 0x84, 0x79, 0xCC, 0x84, 0x79, 0xCC, 0x84, 0x68,
+        0xC9, 0xA6, 0x6A, 0x72, 0xC9, 0xB9, 0xC9, 0xBB, 0xCA, 0x81, 0x77, 0x79, 0x20, 0xCC, 0x86, 0x20,
+        0xCC, 0x87, 0x20, 0xCC, 0x8A, 0x20, 0xCC, 0xA8, 0x20, 0xCC, 0x83, 0x20, 0xCC, 0x8B, 0xC9, 0xA3,
+        0x6C, 0x73, 0x78, 0xCA, 0x95, 0xCC, 0x80, 0xCC, 0x80, 0xCC, 0x81, 0xCC, 0x81, 0xCC, 0x93, 0xCC,
+        0x93, 0xCC, 0x88, 0xCC, 0x81, 0xCC, 0x88, 0xCC, 0x81, 0xCA, 0xB9, 0xCA, 0xB9, 0x20, 0xCD, 0x85,
+        0x3B, 0x3B, 0x20, 0xCC, 0x81, 0xC2, 0xA8, 0xCC, 0x81, 0x20, 0xCC, 0x88, 0xCC, 0x81, 0xCE, 0x91,
+        0xCC, 0x81, 0xCE, 0x91, 0xCC, 0x81, 0xC2, 0xB7, 0xC2, 0xB7, 0xCE, 0x95, 0xCC, 0x81, 0xCE, 0x95,
+        0xCC, 0x81, 0xCE, 0x97, 0xCC, 0x81, 0xCE, 0x97, 0xCC, 0x81, 0xCE, 0x99, 0xCC, 0x81, 0xCE, 0x99,
+        0xCC, 0x81, 0xCE, 0x9F, 0xCC, 0x81, 0xCE, 0x9F, 0xCC, 0x81, 0xCE, 0xA5, 0xCC, 0x81, 0xCE, 0xA5,
+        0xCC, 0x81, 0xCE, 0xA9, 0xCC, 0x81, 0xCE, 0xA9, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x88, 0xCC, 0x81,
+        0xCE, 0xB9, 0xCC, 0x88, 0xCC, 0x81, 0xCE, 0x99, 0xCC, 0x88, 0xCE, 0x99, 0xCC, 0x88, 0xCE, 0xA5,
+        0xCC, 0x88, 0xCE, 0xA5, 0xCC, 0x88, 0xCE, 0xB1, 0xCC, 0x81, 0xCE, 0xB1, 0xCC, 0x81, 0xCE, 0xB5,
+        0xCC, 0x81, 0xCE, 0xB5, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x81, 0xCE, 0xB9,
+        0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x88, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x88,
+        0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x88, 0xCE, 0xB9, 0xCC, 0x88, 0xCF, 0x85, 0xCC, 0x88, 0xCF, 0x85,
+        0xCC, 0x88, 0xCE, 0xBF, 0xCC, 0x81, 0xCE, 0xBF, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x81, 0xCF, 0x85,
+        0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x81, 0xCE, 0xB2, 0xCE, 0xB8, 0xCE, 0xA5,
+        0xCF, 0x92, 0xCC, 0x81, 0xCE, 0xA5, 0xCC, 0x81, 0xCF, 0x92, 0xCC, 0x88, 0xCE, 0xA5, 0xCC, 0x88,
+        0xCF, 0x86, 0xCF, 0x80, 0xCE, 0xBA, 0xCF, 0x81, 0xCF, 0x82, 0xCE, 0x98, 0xCE, 0xB5, 0xCE, 0xA3,
+        0xD0, 0x95, 0xCC, 0x80, 0xD0, 0x95, 0xCC, 0x80, 0xD0, 0x95, 0xCC, 0x88, 0xD0, 0x95, 0xCC, 0x88,
+        0xD0, 0x93, 0xCC, 0x81, 0xD0, 0x93, 0xCC, 0x81, 0xD0, 0x86, 0xCC, 0x88, 0xD0, 0x86, 0xCC, 0x88,
+        0xD0, 0x9A, 0xCC, 0x81, 0xD0, 0x9A, 0xCC, 0x81, 0xD0, 0x98, 0xCC, 0x80, 0xD0, 0x98, 0xCC, 0x80,
+        0xD0, 0xA3, 0xCC, 0x86, 0xD0, 0xA3, 0xCC, 0x86, 0xD0, 0x98, 0xCC, 0x86, 0xD0, 0x98, 0xCC, 0x86,
+        0xD0, 0xB8, 0xCC, 0x86, 0xD0, 0xB8, 0xCC, 0x86, 0xD0, 0xB5, 0xCC, 0x80, 0xD0, 0xB5, 0xCC, 0x80,
+        0xD0, 0xB5, 0xCC, 0x88, 0xD0, 0xB5, 0xCC, 0x88, 0xD0, 0xB3, 0xCC, 0x81, 0xD0, 0xB3, 0xCC, 0x81,
+        0xD1, 0x96, 0xCC, 0x88, 0xD1, 0x96, 0xCC, 0x88, 0xD0, 0xBA, 0xCC, 0x81, 0xD0, 0xBA, 0xCC, 0x81,
+        0xD0, 0xB8, 0xCC, 0x80, 0xD0, 0xB8, 0xCC, 0x80, 0xD1, 0x83, 0xCC, 0x86, 0xD1, 0x83, 0xCC, 0x86,
+        0xD1, 0xB4, 0xCC, 0x8F, 0xD1, 0xB4, 0xCC, 0x8F, 0xD1, 0xB5, 0xCC, 0x8F, 0xD1, 0xB5, 0xCC, 0x8F,
+        0xD0, 0x96, 0xCC, 0x86, 0xD0, 0x96, 0xCC, 0x86, 0xD0, 0xB6, 0xCC, 0x86, 0xD0, 0xB6, 0xCC, 0x86,
+        0xD0, 0x90, 0xCC, 0x86, 0xD0, 0x90, 0xCC, 0x86, 0xD0, 0xB0, 0xCC, 0x86, 0xD0, 0xB0, 0xCC, 0x86,
+        0xD0, 0x90, 0xCC, 0x88, 0xD0, 0x90, 0xCC, 0x88, 0xD0, 0xB0, 0xCC, 0x88, 0xD0, 0xB0, 0xCC, 0x88,
+        0xD0, 0x95, 0xCC, 0x86, 0xD0, 0x95, 0xCC, 0x86, 0xD0, 0xB5, 0xCC, 0x86, 0xD0, 0xB5, 0xCC, 0x86,
+        0xD3, 0x98, 0xCC, 0x88, 0xD3, 0x98, 0xCC, 0x88, 0xD3, 0x99, 0xCC, 0x88, 0xD3, 0x99, 0xCC, 0x88,
+        0xD0, 0x96, 0xCC, 0x88, 0xD0, 0x96, 0xCC, 0x88, 0xD0, 0xB6, 0xCC, 0x88, 0xD0, 0xB6, 0xCC, 0x88,
+        0xD0, 0x97, 0xCC, 0x88, 0xD0, 0x97, 0xCC, 0x88, 0xD0, 0xB7, 0xCC, 0x88, 0xD0, 0xB7, 0xCC, 0x88,
+        0xD0, 0x98, 0xCC, 0x84, 0xD0, 0x98, 0xCC, 0x84, 0xD0, 0xB8, 0xCC, 0x84, 0xD0, 0xB8, 0xCC, 0x84,
+        0xD0, 0x98, 0xCC, 0x88, 0xD0, 0x98, 0xCC, 0x88, 0xD0, 0xB8, 0xCC, 0x88, 0xD0, 0xB8, 0xCC, 0x88,
+        0xD0, 0x9E, 0xCC, 0x88, 0xD0, 0x9E, 0xCC, 0x88, 0xD0, 0xBE, 0xCC, 0x88, 0xD0, 0xBE, 0xCC, 0x88,
+        0xD3, 0xA8, 0xCC, 0x88, 0xD3, 0xA8, 0xCC, 0x88, 0xD3, 0xA9, 0xCC, 0x88, 0xD3, 0xA9, 0xCC, 0x88,
+        0xD0, 0xAD, 0xCC, 0x88, 0xD0, 0xAD, 0xCC, 0x88, 0xD1, 0x8D, 0xCC, 0x88, 0xD1, 0x8D, 0xCC, 0x88,
+        0xD0, 0xA3, 0xCC, 0x84, 0xD0, 0xA3, 0xCC, 0x84, 0xD1, 0x83, 0xCC, 0x84, 0xD1, 0x83, 0xCC, 0x84,
+        0xD0, 0xA3, 0xCC, 0x88, 0xD0, 0xA3, 0xCC, 0x88, 0xD1, 0x83, 0xCC, 0x88, 0xD1, 0x83, 0xCC, 0x88,
+        0xD0, 0xA3, 0xCC, 0x8B, 0xD0, 0xA3, 0xCC, 0x8B, 0xD1, 0x83, 0xCC, 0x8B, 0xD1, 0x83, 0xCC, 0x8B,
+        0xD0, 0xA7, 0xCC, 0x88, 0xD0, 0xA7, 0xCC, 0x88, 0xD1, 0x87, 0xCC, 0x88, 0xD1, 0x87, 0xCC, 0x88,
+        0xD0, 0xAB, 0xCC, 0x88, 0xD0, 0xAB, 0xCC, 0x88, 0xD1, 0x8B, 0xCC, 0x88, 0xD1, 0x8B, 0xCC, 0x88,
+        0xD5, 0xA5, 0xD6, 0x82, 0xD8, 0xA7, 0xD9, 0x93, 0xD8, 0xA7, 0xD9, 0x93, 0xD8, 0xA7, 0xD9, 0x94,
+        0xD8, 0xA7, 0xD9, 0x94, 0xD9, 0x88, 0xD9, 0x94, 0xD9, 0x88, 0xD9, 0x94, 0xD8, 0xA7, 0xD9, 0x95,
+        0xD8, 0xA7, 0xD9, 0x95, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xA7, 0xD9, 0xB4,
+        0xD9, 0x88, 0xD9, 0xB4, 0xDB, 0x87, 0xD9, 0xB4, 0xD9, 0x8A, 0xD9, 0xB4, 0xDB, 0x95, 0xD9, 0x94,
+        0xDB, 0x95, 0xD9, 0x94, 0xDB, 0x81, 0xD9, 0x94, 0xDB, 0x81, 0xD9, 0x94, 0xDB, 0x92, 0xD9, 0x94,
+        0xDB, 0x92, 0xD9, 0x94, 0xE0, 0xA4, 0xA8, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xA8, 0xE0, 0xA4, 0xBC,
+        0xE0, 0xA4, 0xB0, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xB0, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xB3, 0xE0,
+        0xA4, 0xBC, 0xE0, 0xA4, 0xB3, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0x95, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4,
+        0x95, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0x96, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0x96, 0xE0, 0xA4, 0xBC,
+        0xE0, 0xA4, 0x97, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0x97, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0x9C, 0xE0,
+        0xA4, 0xBC, 0xE0, 0xA4, 0x9C, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xA1, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4,
+        0xA1, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xA2, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xA2, 0xE0, 0xA4, 0xBC,
+        0xE0, 0xA4, 0xAB, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xAB, 0xE0, 0xA4, 0xBC, 0xE0, 0xA4, 0xAF, 0xE0,
+        0xA4, 0xBC, 0xE0, 0xA4, 0xAF, 0xE0, 0xA4, 0xBC, 0xE0, 0xA7, 0x87, 0xE0, 0xA6, 0xBE, 0xE0, 0xA7,
+        0x87, 0xE0, 0xA6, 0xBE, 0xE0, 0xA7, 0x87, 0xE0, 0xA7, 0x97, 0xE0, 0xA7, 0x87, 0xE0, 0xA7, 0x97,
+        0xE0, 0xA6, 0xA1, 0xE0, 0xA6, 0xBC, 0xE0, 0xA6, 0xA1, 0xE0, 0xA6, 0xBC, 0xE0, 0xA6, 0xA2, 0xE0,
+        0xA6, 0xBC, 0xE0, 0xA6, 0xA2, 0xE0, 0xA6, 0xBC, 0xE0, 0xA6, 0xAF, 0xE0, 0xA6, 0xBC, 0xE0, 0xA6,
+        0xAF, 0xE0, 0xA6, 0xBC, 0xE0, 0xA8, 0xB2, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0xB2, 0xE0, 0xA8, 0xBC,
+        0xE0, 0xA8, 0xB8, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0xB8, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0x96, 0xE0,
+        0xA8, 0xBC, 0xE0, 0xA8, 0x96, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0x97, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8,
+        0x97, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0x9C, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0x9C, 0xE0, 0xA8, 0xBC,
+        0xE0, 0xA8, 0xAB, 0xE0, 0xA8, 0xBC, 0xE0, 0xA8, 0xAB, 0xE0, 0xA8, 0xBC, 0xE0, 0xAD, 0x87, 0xE0,
+        0xAD, 0x96, 0xE0, 0xAD, 0x87, 0xE0, 0xAD, 0x96, 0xE0, 0xAD, 0x87, 0xE0, 0xAC, 0xBE, 0xE0, 0xAD,
+        0x87, 0xE0, 0xAC, 0xBE, 0xE0, 0xAD, 0x87, 0xE0, 0xAD, 0x97, 0xE0, 0xAD, 0x87, 0xE0, 0xAD, 0x97,
+        0xE0, 0xAC, 0xA1, 0xE0, 0xAC, 0xBC, 0xE0, 0xAC, 0xA1, 0xE0, 0xAC, 0xBC, 0xE0, 0xAC, 0xA2, 0xE0,
+        0xAC, 0xBC, 0xE0, 0xAC, 0xA2, 0xE0, 0xAC, 0xBC, 0xE0, 0xAE, 0x92, 0xE0, 0xAF, 0x97, 0xE0, 0xAE,
+        0x92, 0xE0, 0xAF, 0x97, 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xBE, 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xBE,
+        0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xBE, 0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xBE, 0xE0, 0xAF, 0x86, 0xE0,
+        0xAF, 0x97, 0xE0, 0xAF, 0x86, 0xE0, 0xAF, 0x97, 0xE0, 0xB1, 0x86, 0xE0, 0xB1, 0x96, 0xE0, 0xB1,
+        0x86, 0xE0, 0xB1, 0x96, 0xE0, 0xB2, 0xBF, 0xE0, 0xB3, 0x95, 0xE0, 0xB2, 0xBF, 0xE0, 0xB3, 0x95,
+        0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x95, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x95, 0xE0, 0xB3, 0x86, 0xE0,
+        0xB3, 0x96, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x96, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x82, 0xE0, 0xB3,
+        0x86, 0xE0, 0xB3, 0x82, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x82, 0xE0, 0xB3, 0x95, 0xE0, 0xB3, 0x86,
+        0xE0, 0xB3, 0x82, 0xE0, 0xB3, 0x95, 0xE0, 0xB5, 0x86, 0xE0, 0xB4, 0xBE, 0xE0, 0xB5, 0x86, 0xE0,
+        0xB4, 0xBE, 0xE0, 0xB5, 0x87, 0xE0, 0xB4, 0xBE, 0xE0, 0xB5, 0x87, 0xE0, 0xB4, 0xBE, 0xE0, 0xB5,
+        0x86, 0xE0, 0xB5, 0x97, 0xE0, 0xB5, 0x86, 0xE0, 0xB5, 0x97, 0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x8A,
+        0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x8A, 0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x8F, 0xE0, 0xB7, 0x99, 0xE0,
+        0xB7, 0x8F, 0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x8F, 0xE0, 0xB7, 0x8A, 0xE0, 0xB7, 0x99, 0xE0, 0xB7,
+        0x8F, 0xE0, 0xB7, 0x8A, 0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x9F, 0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x9F,
+        0xE0, 0xB9, 0x8D, 0xE0, 0xB8, 0xB2, 0xE0, 0xBB, 0x8D, 0xE0, 0xBA, 0xB2, 0xE0, 0xBA, 0xAB, 0xE0,
+        0xBA, 0x99, 0xE0, 0xBA, 0xAB, 0xE0, 0xBA, 0xA1, 0xE0, 0xBC, 0x8B, 0xE0, 0xBD, 0x82, 0xE0, 0xBE,
+        0xB7, 0xE0, 0xBD, 0x82, 0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x8C, 0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x8C,
+        0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x91, 0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x91, 0xE0, 0xBE, 0xB7, 0xE0,
+        0xBD, 0x96, 0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x96, 0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x9B, 0xE0, 0xBE,
+        0xB7, 0xE0, 0xBD, 0x9B, 0xE0, 0xBE, 0xB7, 0xE0, 0xBD, 0x80, 0xE0, 0xBE, 0xB5, 0xE0, 0xBD, 0x80,
+        0xE0, 0xBE, 0xB5, 0xE0, 0xBD, 0xB1, 0xE0, 0xBD, 0xB2, 0xE0, 0xBD, 0xB1, 0xE0, 0xBD, 0xB2, 0xE0,
+        0xBD, 0xB1, 0xE0, 0xBD, 0xB4, 0xE0, 0xBD, 0xB1, 0xE0, 0xBD, 0xB4, 0xE0, 0xBE, 0xB2, 0xE0, 0xBE,
+        0x80, 0xE0, 0xBE, 0xB2, 0xE0, 0xBE, 0x80, 0xE0, 0xBE, 0xB2, 0xE0, 0xBD, 0xB1, 0xE0, 0xBE, 0x80,
+        0xE0, 0xBE, 0xB3, 0xE0, 0xBE, 0x80, 0xE0, 0xBE, 0xB3, 0xE0, 0xBE, 0x80, 0xE0, 0xBE, 0xB3, 0xE0,
+        0xBD, 0xB1, 0xE0, 0xBE, 0x80, 0xE0, 0xBD, 0xB1, 0xE0, 0xBE, 0x80, 0xE0, 0xBD, 0xB1, 0xE0, 0xBE,
+        0x80, 0xE0, 0xBE, 0x92, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0x92, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0x9C,
+        0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0x9C, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0xA1, 0xE0, 0xBE, 0xB7, 0xE0,
+        0xBE, 0xA1, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0xA6, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0xA6, 0xE0, 0xBE,
+        0xB7, 0xE0, 0xBE, 0xAB, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0xAB, 0xE0, 0xBE, 0xB7, 0xE0, 0xBE, 0x90,
+        0xE0, 0xBE, 0xB5, 0xE0, 0xBE, 0x90, 0xE0, 0xBE, 0xB5, 0xE1, 0x80, 0xA5, 0xE1, 0x80, 0xAE, 0xE1,
+        0x80, 0xA5, 0xE1, 0x80, 0xAE, 0xE1, 0x83, 0x9C, 0xE1, 0xAC, 0x85, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC,
+        0x85, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x87, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x87, 0xE1, 0xAC, 0xB5,
+        0xE1, 0xAC, 0x89, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x89, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x8B, 0xE1,
+        0xAC, 0xB5, 0xE1, 0xAC, 0x8B, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x8D, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC,
+        0x8D, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x91, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0x91, 0xE1, 0xAC, 0xB5,
+        0xE1, 0xAC, 0xBA, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0xBA, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0xBC, 0xE1,
+        0xAC, 0xB5, 0xE1, 0xAC, 0xBC, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0xBE, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC,
+        0xBE, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0xBF, 0xE1, 0xAC, 0xB5, 0xE1, 0xAC, 0xBF, 0xE1, 0xAC, 0xB5,
+        0xE1, 0xAD, 0x82, 0xE1, 0xAC, 0xB5, 0xE1, 0xAD, 0x82, 0xE1, 0xAC, 0xB5, 0x41, 0xC3, 0x86, 0x42,
+        0x44, 0x45, 0xC6, 0x8E, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0xC8, 0xA2, 0x50,
+        0x52, 0x54, 0x55, 0x57, 0x61, 0xC9, 0x90, 0xC9, 0x91, 0xE1, 0xB4, 0x82, 0x62, 0x64, 0x65, 0xC9,
+        0x99, 0xC9, 0x9B, 0xC9, 0x9C, 0x67, 0x6B, 0x6D, 0xC5, 0x8B, 0x6F, 0xC9, 0x94, 0xE1, 0xB4, 0x96,
+        0xE1, 0xB4, 0x97, 0x70, 0x74, 0x75, 0xE1, 0xB4, 0x9D, 0xC9, 0xAF, 0x76, 0xE1, 0xB4, 0xA5, 0xCE,
+        0xB2, 0xCE, 0xB3, 0xCE, 0xB4, 0xCF, 0x86, 0xCF, 0x87, 0x69, 0x72, 0x75, 0x76, 0xCE, 0xB2, 0xCE,
+        0xB3, 0xCF, 0x81, 0xCF, 0x86, 0xCF, 0x87, 0xD0, 0xBD, 0xC9, 0x92, 0x63, 0xC9, 0x95, 0xC3, 0xB0,
+        0xC9, 0x9C, 0x66, 0xC9, 0x9F, 0xC9, 0xA1, 0xC9, 0xA5, 0xC9, 0xA8, 0xC9, 0xA9, 0xC9, 0xAA, 0xE1,
+        0xB5, 0xBB, 0xCA, 0x9D, 0xC9, 0xAD, 0xE1, 0xB6, 0x85, 0xCA, 0x9F, 0xC9, 0xB1, 0xC9, 0xB0, 0xC9,
+        0xB2, 0xC9, 0xB3, 0xC9, 0xB4, 0xC9, 0xB5, 0xC9, 0xB8, 0xCA, 0x82, 0xCA, 0x83, 0xC6, 0xAB, 0xCA,
+        0x89, 0xCA, 0x8A, 0xE1, 0xB4, 0x9C, 0xCA, 0x8B, 0xCA, 0x8C, 0x7A, 0xCA, 0x90, 0xCA, 0x91, 0xCA,
+        0x92, 0xCE, 0xB8, 0x41, 0xCC, 0xA5, 0x41, 0xCC, 0xA5, 0x61, 0xCC, 0xA5, 0x61, 0xCC, 0xA5, 0x42,
+        0xCC, 0x87, 0x42, 0xCC, 0x87, 0x62, 0xCC, 0x87, 0x62, 0xCC, 0x87, 0x42, 0xCC, 0xA3, 0x42, 0xCC,
+        0xA3, 0x62, 0xCC, 0xA3, 0x62, 0xCC, 0xA3, 0x42, 0xCC, 0xB1, 0x42, 0xCC, 0xB1, 0x62, 0xCC, 0xB1,
+        0x62, 0xCC, 0xB1, 0x43, 0xCC, 0xA7, 0xCC, 0x81, 0x43, 0xCC, 0xA7, 0xCC, 0x81, 0x63, 0xCC, 0xA7,
+        0xCC, 0x81, 0x63, 0xCC, 0xA7, 0xCC, 0x81, 0x44, 0xCC, 0x87, 0x44, 0xCC, 0x87, 0x64, 0xCC, 0x87,
+        0x64, 0xCC, 0x87, 0x44, 0xCC, 0xA3, 0x44, 0xCC, 0xA3, 0x64, 0xCC, 0xA3, 0x64, 0xCC, 0xA3, 0x44,
+        0xCC, 0xB1, 0x44, 0xCC, 0xB1, 0x64, 0xCC, 0xB1, 0x64, 0xCC, 0xB1, 0x44, 0xCC, 0xA7, 0x44, 0xCC,
+        0xA7, 0x64, 0xCC, 0xA7, 0x64, 0xCC, 0xA7, 0x44, 0xCC, 0xAD, 0x44, 0xCC, 0xAD, 0x64, 0xCC, 0xAD,
+        0x64, 0xCC, 0xAD, 0x45, 0xCC, 0x84, 0xCC, 0x80, 0x45, 0xCC, 0x84, 0xCC, 0x80, 0x65, 0xCC, 0x84,
+        0xCC, 0x80, 0x65, 0xCC, 0x84, 0xCC, 0x80, 0x45, 0xCC, 0x84, 0xCC, 0x81, 0x45, 0xCC, 0x84, 0xCC,
+        0x81, 0x65, 0xCC, 0x84, 0xCC, 0x81, 0x65, 0xCC, 0x84, 0xCC, 0x81, 0x45, 0xCC, 0xAD, 0x45, 0xCC,
+        0xAD, 0x65, 0xCC, 0xAD, 0x65, 0xCC, 0xAD, 0x45, 0xCC, 0xB0, 0x45, 0xCC, 0xB0, 0x65, 0xCC, 0xB0,
+        0x65, 0xCC, 0xB0, 0x45, 0xCC, 0xA7, 0xCC, 0x86, 0x45, 0xCC, 0xA7, 0xCC, 0x86, 0x65, 0xCC, 0xA7,
+        0xCC, 0x86, 0x65, 0xCC, 0xA7, 0xCC, 0x86, 0x46, 0xCC, 0x87, 0x46, 0xCC, 0x87, 0x66, 0xCC, 0x87,
+        0x66, 0xCC, 0x87, 0x47, 0xCC, 0x84, 0x47, 0xCC, 0x84, 0x67, 0xCC, 0x84, 0x67, 0xCC, 0x84, 0x48,
+        0xCC, 0x87, 0x48, 0xCC, 0x87, 0x68, 0xCC, 0x87, 0x68, 0xCC, 0x87, 0x48, 0xCC, 0xA3, 0x48, 0xCC,
+        0xA3, 0x68, 0xCC, 0xA3, 0x68, 0xCC, 0xA3, 0x48, 0xCC, 0x88, 0x48, 0xCC, 0x88, 0x68, 0xCC, 0x88,
+        0x68, 0xCC, 0x88, 0x48, 0xCC, 0xA7, 0x48, 0xCC, 0xA7, 0x68, 0xCC, 0xA7, 0x68, 0xCC, 0xA7, 0x48,
+        0xCC, 0xAE, 0x48, 0xCC, 0xAE, 0x68, 0xCC, 0xAE, 0x68, 0xCC, 0xAE, 0x49, 0xCC, 0xB0, 0x49, 0xCC,
+        0xB0, 0x69, 0xCC, 0xB0, 0x69, 0xCC, 0xB0, 0x49, 0xCC, 0x88, 0xCC, 0x81, 0x49, 0xCC, 0x88, 0xCC,
+        0x81, 0x69, 0xCC, 0x88, 0xCC, 0x81, 0x69, 0xCC, 0x88, 0xCC, 0x81, 0x4B, 0xCC, 0x81, 0x4B, 0xCC,
+        0x81, 0x6B, 0xCC, 0x81, 0x6B, 0xCC, 0x81, 0x4B, 0xCC, 0xA3, 0x4B, 0xCC, 0xA3, 0x6B, 0xCC, 0xA3,
+        0x6B, 0xCC, 0xA3, 0x4B, 0xCC, 0xB1, 0x4B, 0xCC, 0xB1, 0x6B, 0xCC, 0xB1, 0x6B, 0xCC, 0xB1, 0x4C,
+        0xCC, 0xA3, 0x4C, 0xCC, 0xA3, 0x6C, 0xCC, 0xA3, 0x6C, 0xCC, 0xA3, 0x4C, 0xCC, 0xA3, 0xCC, 0x84,
+        0x4C, 0xCC, 0xA3, 0xCC, 0x84, 0x6C, 0xCC, 0xA3, 0xCC, 0x84, 0x6C, 0xCC, 0xA3, 0xCC, 0x84, 0x4C,
+        0xCC, 0xB1, 0x4C, 0xCC, 0xB1, 0x6C, 0xCC, 0xB1, 0x6C, 0xCC, 0xB1, 0x4C, 0xCC, 0xAD, 0x4C, 0xCC,
+        0xAD, 0x6C, 0xCC, 0xAD, 0x6C, 0xCC, 0xAD, 0x4D, 0xCC, 0x81, 0x4D, 0xCC, 0x81, 0x6D, 0xCC, 0x81,
+        0x6D, 0xCC, 0x81, 0x4D, 0xCC, 0x87, 0x4D, 0xCC, 0x87, 0x6D, 0xCC, 0x87, 0x6D, 0xCC, 0x87, 0x4D,
+        0xCC, 0xA3, 0x4D, 0xCC, 0xA3, 0x6D, 0xCC, 0xA3, 0x6D, 0xCC, 0xA3, 0x4E, 0xCC, 0x87, 0x4E, 0xCC,
+        0x87, 0x6E, 0xCC, 0x87, 0x6E, 0xCC, 0x87, 0x4E, 0xCC, 0xA3, 0x4E, 0xCC, 0xA3, 0x6E, 0xCC, 0xA3,
+        0x6E, 0xCC, 0xA3, 0x4E, 0xCC, 0xB1, 0x4E, 0xCC, 0xB1, 0x6E, 0xCC, 0xB1, 0x6E, 0xCC, 0xB1, 0x4E,
+        0xCC, 0xAD, 0x4E, 0xCC, 0xAD, 0x6E, 0xCC, 0xAD, 0x6E, 0xCC, 0xAD, 0x4F, 0xCC, 0x83, 0xCC, 0x81,
+        0x4F, 0xCC, 0x83, 0xCC, 0x81, 0x6F, 0xCC, 0x83, 0xCC, 0x81, 0x6F, 0xCC, 0x83, 0xCC, 0x81, 0x4F,
+        0xCC, 0x83, 0xCC, 0x88, 0x4F, 0xCC, 0x83, 0xCC, 0x88, 0x6F, 0xCC, 0x83, 0xCC, 0x88, 0x6F, 0xCC,
+        0x83, 0xCC, 0x88, 0x4F, 0xCC, 0x84, 0xCC, 0x80, 0x4F, 0xCC, 0x84, 0xCC, 0x80, 0x6F, 0xCC, 0x84,
+        0xCC, 0x80, 0x6F, 0xCC, 0x84, 0xCC, 0x80, 0x4F, 0xCC, 0x84, 0xCC, 0x81, 0x4F, 0xCC, 0x84, 0xCC,
+        0x81, 0x6F, 0xCC, 0x84, 0xCC, 0x81, 0x6F, 0xCC, 0x84, 0xCC, 0x81, 0x50, 0xCC, 0x81, 0x50, 0xCC,
+        0x81, 0x70, 0xCC, 0x81, 0x70, 0xCC, 0x81, 0x50, 0xCC, 0x87, 0x50, 0xCC, 0x87, 0x70, 0xCC, 0x87,
+        0x70, 0xCC, 0x87, 0x52, 0xCC, 0x87, 0x52, 0xCC, 0x87, 0x72, 0xCC, 0x87, 0x72, 0xCC, 0x87, 0x52,
+        0xCC, 0xA3, 0x52, 0xCC, 0xA3, 0x72, 0xCC, 0xA3, 0x72, 0xCC, 0xA3, 0x52, 0xCC, 0xA3, 0xCC, 0x84,
+        0x52, 0xCC, 0xA3, 0xCC, 0x84, 0x72, 0xCC, 0xA3, 0xCC, 0x84, 0x72, 0xCC, 0xA3, 0xCC, 0x84, 0x52,
+        0xCC, 0xB1, 0x52, 0xCC, 0xB1, 0x72, 0xCC, 0xB1, 0x72, 0xCC, 0xB1, 0x53, 0xCC, 0x87, 0x53, 0xCC,
+        0x87, 0x73, 0xCC, 0x87, 0x73, 0xCC, 0x87, 0x53, 0xCC, 0xA3, 0x53, 0xCC, 0xA3, 0x73, 0xCC, 0xA3,
+        0x73, 0xCC, 0xA3, 0x53, 0xCC, 0x81, 0xCC, 0x87, 0x53, 0xCC, 0x81, 0xCC, 0x87, 0x73, 0xCC, 0x81,
+        0xCC, 0x87, 0x73, 0xCC, 0x81, 0xCC, 0x87, 0x53, 0xCC, 0x8C, 0xCC, 0x87, 0x53, 0xCC, 0x8C, 0xCC,
+        0x87, 0x73, 0xCC, 0x8C, 0xCC, 0x87, 0x73, 0xCC, 0x8C, 0xCC, 0x87, 0x53, 0xCC, 0xA3, 0xCC, 0x87,
+        0x53, 0xCC, 0xA3, 0xCC, 0x87, 0x73, 0xCC, 0xA3, 0xCC, 0x87, 0x73, 0xCC, 0xA3, 0xCC, 0x87, 0x54,
+        0xCC, 0x87, 0x54, 0xCC, 0x87, 0x74, 0xCC, 0x87, 0x74, 0xCC, 0x87, 0x54, 0xCC, 0xA3, 0x54, 0xCC,
+        0xA3, 0x74, 0xCC, 0xA3, 0x74, 0xCC, 0xA3, 0x54, 0xCC, 0xB1, 0x54, 0xCC, 0xB1, 0x74, 0xCC, 0xB1,
+        0x74, 0xCC, 0xB1, 0x54, 0xCC, 0xAD, 0x54, 0xCC, 0xAD, 0x74, 0xCC, 0xAD, 0x74, 0xCC, 0xAD, 0x55,
+        0xCC, 0xA4, 0x55, 0xCC, 0xA4, 0x75, 0xCC, 0xA4, 0x75, 0xCC, 0xA4, 0x55, 0xCC, 0xB0, 0x55, 0xCC,
+        0xB0, 0x75, 0xCC, 0xB0, 0x75, 0xCC, 0xB0, 0x55, 0xCC, 0xAD, 0x55, 0xCC, 0xAD, 0x75, 0xCC, 0xAD,
+        0x75, 0xCC, 0xAD, 0x55, 0xCC, 0x83, 0xCC, 0x81, 0x55, 0xCC, 0x83, 0xCC, 0x81, 0x75, 0xCC, 0x83,
+        0xCC, 0x81, 0x75, 0xCC, 0x83, 0xCC, 0x81, 0x55, 0xCC, 0x84, 0xCC, 0x88, 0x55, 0xCC, 0x84, 0xCC,
+        0x88, 0x75, 0xCC, 0x84, 0xCC, 0x88, 0x75, 0xCC, 0x84, 0xCC, 0x88, 0x56, 0xCC, 0x83, 0x56, 0xCC,
+        0x83, 0x76, 0xCC, 0x83, 0x76, 0xCC, 0x83, 0x56, 0xCC, 0xA3, 0x56, 0xCC, 0xA3, 0x76, 0xCC, 0xA3,
+        0x76, 0xCC, 0xA3, 0x57, 0xCC, 0x80, 0x57, 0xCC, 0x80, 0x77, 0xCC, 0x80, 0x77, 0xCC, 0x80, 0x57,
+        0xCC, 0x81, 0x57, 0xCC, 0x81, 0x77, 0xCC, 0x81, 0x77, 0xCC, 0x81, 0x57, 0xCC, 0x88, 0x57, 0xCC,
+        0x88, 0x77, 0xCC, 0x88, 0x77, 0xCC, 0x88, 0x57, 0xCC, 0x87, 0x57, 0xCC, 0x87, 0x77, 0xCC, 0x87,
+        0x77, 0xCC, 0x87, 0x57, 0xCC, 0xA3, 0x57, 0xCC, 0xA3, 0x77, 0xCC, 0xA3, 0x77, 0xCC, 0xA3, 0x58,
+        0xCC, 0x87, 0x58, 0xCC, 0x87, 0x78, 0xCC, 0x87, 0x78, 0xCC, 0x87, 0x58, 0xCC, 0x88, 0x58, 0xCC,
+        0x88, 0x78, 0xCC, 0x88, 0x78, 0xCC, 0x88, 0x59, 0xCC, 0x87, 0x59, 0xCC, 0x87, 0x79, 0xCC, 0x87,
+        0x79, 0xCC, 0x87, 0x5A, 0xCC, 0x82, 0x5A, 0xCC, 0x82, 0x7A, 0xCC, 0x82, 0x7A, 0xCC, 0x82, 0x5A,
+        0xCC, 0xA3, 0x5A, 0xCC, 0xA3, 0x7A, 0xCC, 0xA3, 0x7A, 0xCC, 0xA3, 0x5A, 0xCC, 0xB1, 0x5A, 0xCC,
+        0xB1, 0x7A, 0xCC, 0xB1, 0x7A, 0xCC, 0xB1, 0x68, 0xCC, 0xB1, 0x68, 0xCC, 0xB1, 0x74, 0xCC, 0x88,
+        0x74, 0xCC, 0x88, 0x77, 0xCC, 0x8A, 0x77, 0xCC, 0x8A, 0x79, 0xCC, 0x8A, 0x79, 0xCC, 0x8A, 0x61,
+        0xCA, 0xBE, 0xC5, 0xBF, 0xCC, 0x87, 0x73, 0xCC, 0x87, 0x41, 0xCC, 0xA3, 0x41, 0xCC, 0xA3, 0x61,
+        0xCC, 0xA3, 0x61, 0xCC, 0xA3, 0x41, 0xCC, 0x89, 0x41, 0xCC, 0x89, 0x61, 0xCC, 0x89, 0x61, 0xCC,
+        0x89, 0x41, 0xCC, 0x82, 0xCC, 0x81, 0x41, 0xCC, 0x82, 0xCC, 0x81, 0x61, 0xCC, 0x82, 0xCC, 0x81,
+        0x61, 0xCC, 0x82, 0xCC, 0x81, 0x41, 0xCC, 0x82, 0xCC, 0x80, 0x41, 0xCC, 0x82, 0xCC, 0x80, 0x61,
+        0xCC, 0x82, 0xCC, 0x80, 0x61, 0xCC, 0x82, 0xCC, 0x80, 0x41, 0xCC, 0x82, 0xCC, 0x89, 0x41, 0xCC,
+        0x82, 0xCC, 0x89, 0x61, 0xCC, 0x82, 0xCC, 0x89, 0x61, 0xCC, 0x82, 0xCC, 0x89, 0x41, 0xCC, 0x82,
+        0xCC, 0x83, 0x41, 0xCC, 0x82, 0xCC, 0x83, 0x61, 0xCC, 0x82, 0xCC, 0x83, 0x61, 0xCC, 0x82, 0xCC,
+        0x83, 0x41, 0xCC, 0xA3, 0xCC, 0x82, 0x41, 0xCC, 0xA3, 0xCC, 0x82, 0x61, 0xCC, 0xA3, 0xCC, 0x82,
+        0x61, 0xCC, 0xA3, 0xCC, 0x82, 0x41, 0xCC, 0x86, 0xCC, 0x81, 0x41, 0xCC, 0x86, 0xCC, 0x81, 0x61,
+        0xCC, 0x86, 0xCC, 0x81, 0x61, 0xCC, 0x86, 0xCC, 0x81, 0x41, 0xCC, 0x86, 0xCC, 0x80, 0x41, 0xCC,
+        0x86, 0xCC, 0x80, 0x61, 0xCC, 0x86, 0xCC, 0x80, 0x61, 0xCC, 0x86, 0xCC, 0x80, 0x41, 0xCC, 0x86,
+        0xCC, 0x89, 0x41, 0xCC, 0x86, 0xCC, 0x89, 0x61, 0xCC, 0x86, 0xCC, 0x89, 0x61, 0xCC, 0x86, 0xCC,
+        0x89, 0x41, 0xCC, 0x86, 0xCC, 0x83, 0x41, 0xCC, 0x86, 0xCC, 0x83, 0x61, 0xCC, 0x86, 0xCC, 0x83,
+        0x61, 0xCC, 0x86, 0xCC, 0x83, 0x41, 0xCC, 0xA3, 0xCC, 0x86, 0x41, 0xCC, 0xA3, 0xCC, 0x86, 0x61,
+        0xCC, 0xA3, 0xCC, 0x86, 0x61, 0xCC, 0xA3, 0xCC, 0x86, 0x45, 0xCC, 0xA3, 0x45, 0xCC, 0xA3, 0x65,
+        0xCC, 0xA3, 0x65, 0xCC, 0xA3, 0x45, 0xCC, 0x89, 0x45, 0xCC, 0x89, 0x65, 0xCC, 0x89, 0x65, 0xCC,
+        0x89, 0x45, 0xCC, 0x83, 0x45, 0xCC, 0x83, 0x65, 0xCC, 0x83, 0x65, 0xCC, 0x83, 0x45, 0xCC, 0x82,
+        0xCC, 0x81, 0x45, 0xCC, 0x82, 0xCC, 0x81, 0x65, 0xCC, 0x82, 0xCC, 0x81, 0x65, 0xCC, 0x82, 0xCC,
+        0x81, 0x45, 0xCC, 0x82, 0xCC, 0x80, 0x45, 0xCC, 0x82, 0xCC, 0x80, 0x65, 0xCC, 0x82, 0xCC, 0x80,
+        0x65, 0xCC, 0x82, 0xCC, 0x80, 0x45, 0xCC, 0x82, 0xCC, 0x89, 0x45, 0xCC, 0x82, 0xCC, 0x89, 0x65,
+        0xCC, 0x82, 0xCC, 0x89, 0x65, 0xCC, 0x82, 0xCC, 0x89, 0x45, 0xCC, 0x82, 0xCC, 0x83, 0x45, 0xCC,
+        0x82, 0xCC, 0x83, 0x65, 0xCC, 0x82, 0xCC, 0x83, 0x65, 0xCC, 0x82, 0xCC, 0x83, 0x45, 0xCC, 0xA3,
+        0xCC, 0x82, 0x45, 0xCC, 0xA3, 0xCC, 0x82, 0x65, 0xCC, 0xA3, 0xCC, 0x82, 0x65, 0xCC, 0xA3, 0xCC,
+        0x82, 0x49, 0xCC, 0x89, 0x49, 0xCC, 0x89, 0x69, 0xCC, 0x89, 0x69, 0xCC, 0x89, 0x49, 0xCC, 0xA3,
+        0x49, 0xCC, 0xA3, 0x69, 0xCC, 0xA3, 0x69, 0xCC, 0xA3, 0x4F, 0xCC, 0xA3, 0x4F, 0xCC, 0xA3, 0x6F,
+        0xCC, 0xA3, 0x6F, 0xCC, 0xA3, 0x4F, 0xCC, 0x89, 0x4F, 0xCC, 0x89, 0x6F, 0xCC, 0x89, 0x6F, 0xCC,
+        0x89, 0x4F, 0xCC, 0x82, 0xCC, 0x81, 0x4F, 0xCC, 0x82, 0xCC, 0x81, 0x6F, 0xCC, 0x82, 0xCC, 0x81,
+        0x6F, 0xCC, 0x82, 0xCC, 0x81, 0x4F, 0xCC, 0x82, 0xCC, 0x80, 0x4F, 0xCC, 0x82, 0xCC, 0x80, 0x6F,
+        0xCC, 0x82, 0xCC, 0x80, 0x6F, 0xCC, 0x82, 0xCC, 0x80, 0x4F, 0xCC, 0x82, 0xCC, 0x89, 0x4F, 0xCC,
+        0x82, 0xCC, 0x89, 0x6F, 0xCC, 0x82, 0xCC, 0x89, 0x6F, 0xCC, 0x82, 0xCC, 0x89, 0x4F, 0xCC, 0x82,
+        0xCC, 0x83, 0x4F, 0xCC, 0x82, 0xCC, 0x83, 0x6F, 0xCC, 0x82, 0xCC, 0x83, 0x6F, 0xCC, 0x82, 0xCC,
+        0x83, 0x4F, 0xCC, 0xA3, 0xCC, 0x82, 0x4F, 0xCC, 0xA3, 0xCC, 0x82, 0x6F, 0xCC, 0xA3, 0xCC, 0x82,
+        0x6F, 0xCC, 0xA3, 0xCC, 0x82, 0x4F, 0xCC, 0x9B, 0xCC, 0x81, 0x4F, 0xCC, 0x9B, 0xCC, 0x81, 0x6F,
+        0xCC, 0x9B, 0xCC, 0x81, 0x6F, 0xCC, 0x9B, 0xCC, 0x81, 0x4F, 0xCC, 0x9B, 0xCC, 0x80, 0x4F, 0xCC,
+        0x9B, 0xCC, 0x80, 0x6F, 0xCC, 0x9B, 0xCC, 0x80, 0x6F, 0xCC, 0x9B, 0xCC, 0x80, 0x4F, 0xCC, 0x9B,
+        0xCC, 0x89, 0x4F, 0xCC, 0x9B, 0xCC, 0x89, 0x6F, 0xCC, 0x9B, 0xCC, 0x89, 0x6F, 0xCC, 0x9B, 0xCC,
+        0x89, 0x4F, 0xCC, 0x9B, 0xCC, 0x83, 0x4F, 0xCC, 0x9B, 0xCC, 0x83, 0x6F, 0xCC, 0x9B, 0xCC, 0x83,
+        0x6F, 0xCC, 0x9B, 0xCC, 0x83, 0x4F, 0xCC, 0x9B, 0xCC, 0xA3, 0x4F, 0xCC, 0x9B, 0xCC, 0xA3, 0x6F,
+        0xCC, 0x9B, 0xCC, 0xA3, 0x6F, 0xCC, 0x9B, 0xCC, 0xA3, 0x55, 0xCC, 0xA3, 0x55, 0xCC, 0xA3, 0x75,
+        0xCC, 0xA3, 0x75, 0xCC, 0xA3, 0x55, 0xCC, 0x89, 0x55, 0xCC, 0x89, 0x75, 0xCC, 0x89, 0x75, 0xCC,
+        0x89, 0x55, 0xCC, 0x9B, 0xCC, 0x81, 0x55, 0xCC, 0x9B, 0xCC, 0x81, 0x75, 0xCC, 0x9B, 0xCC, 0x81,
+        0x75, 0xCC, 0x9B, 0xCC, 0x81, 0x55, 0xCC, 0x9B, 0xCC, 0x80, 0x55, 0xCC, 0x9B, 0xCC, 0x80, 0x75,
+        0xCC, 0x9B, 0xCC, 0x80, 0x75, 0xCC, 0x9B, 0xCC, 0x80, 0x55, 0xCC, 0x9B, 0xCC, 0x89, 0x55, 0xCC,
+        0x9B, 0xCC, 0x89, 0x75, 0xCC, 0x9B, 0xCC, 0x89, 0x75, 0xCC, 0x9B, 0xCC, 0x89, 0x55, 0xCC, 0x9B,
+        0xCC, 0x83, 0x55, 0xCC, 0x9B, 0xCC, 0x83, 0x75, 0xCC, 0x9B, 0xCC, 0x83, 0x75, 0xCC, 0x9B, 0xCC,
+        0x83, 0x55, 0xCC, 0x9B, 0xCC, 0xA3, 0x55, 0xCC, 0x9B, 0xCC, 0xA3, 0x75, 0xCC, 0x9B, 0xCC, 0xA3,
+        0x75, 0xCC, 0x9B, 0xCC, 0xA3, 0x59, 0xCC, 0x80, 0x59, 0xCC, 0x80, 0x79, 0xCC, 0x80, 0x79, 0xCC,
+        0x80, 0x59, 0xCC, 0xA3, 0x59, 0xCC, 0xA3, 0x79, 0xCC, 0xA3, 0x79, 0xCC, 0xA3, 0x59, 0xCC, 0x89,
+        0x59, 0xCC, 0x89, 0x79, 0xCC, 0x89, 0x79, 0xCC, 0x89, 0x59, 0xCC, 0x83, 0x59, 0xCC, 0x83, 0x79,
+        0xCC, 0x83, 0x79, 0xCC, 0x83, 0xCE, 0xB1, 0xCC, 0x93, 0xCE, 0xB1, 0xCC, 0x93, 0xCE, 0xB1, 0xCC,
+        0x94, 0xCE, 0xB1, 0xCC, 0x94, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xB1, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB1, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0xB1, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xB1, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0xB1, 0xCC, 0x93, 0xCD,
+        0x82, 0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0x91, 0xCC,
+        0x93, 0xCE, 0x91, 0xCC, 0x93, 0xCE, 0x91, 0xCC, 0x94, 0xCE, 0x91, 0xCC, 0x94, 0xCE, 0x91, 0xCC,
+        0x93, 0xCC, 0x80, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x80, 0xCE,
+        0x91, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0x91, 0xCC, 0x93, 0xCC,
+        0x81, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x91, 0xCC,
+        0x93, 0xCD, 0x82, 0xCE, 0x91, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0x91, 0xCC, 0x94, 0xCD, 0x82, 0xCE,
+        0x91, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xB5, 0xCC, 0x93, 0xCE, 0xB5, 0xCC, 0x93, 0xCE, 0xB5, 0xCC,
+        0x94, 0xCE, 0xB5, 0xCC, 0x94, 0xCE, 0xB5, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xB5, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0xB5, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB5, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB5, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0xB5, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0xB5, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0xB5, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x95, 0xCC, 0x93, 0xCE, 0x95, 0xCC, 0x93, 0xCE, 0x95, 0xCC,
+        0x94, 0xCE, 0x95, 0xCC, 0x94, 0xCE, 0x95, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0x95, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0x95, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x95, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x95, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0x95, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0x95, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0x95, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x93, 0xCE, 0xB7, 0xCC, 0x93, 0xCE, 0xB7, 0xCC,
+        0x94, 0xCE, 0xB7, 0xCC, 0x94, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xB7, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB7, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0xB7, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0xB7, 0xCC, 0x93, 0xCD,
+        0x82, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0x97, 0xCC,
+        0x93, 0xCE, 0x97, 0xCC, 0x93, 0xCE, 0x97, 0xCC, 0x94, 0xCE, 0x97, 0xCC, 0x94, 0xCE, 0x97, 0xCC,
+        0x93, 0xCC, 0x80, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x80, 0xCE,
+        0x97, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0x97, 0xCC, 0x93, 0xCC,
+        0x81, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x97, 0xCC,
+        0x93, 0xCD, 0x82, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0x97, 0xCC, 0x94, 0xCD, 0x82, 0xCE,
+        0x97, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xB9, 0xCC, 0x93, 0xCE, 0xB9, 0xCC, 0x93, 0xCE, 0xB9, 0xCC,
+        0x94, 0xCE, 0xB9, 0xCC, 0x94, 0xCE, 0xB9, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xB9, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0xB9, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB9, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xB9, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0xB9, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0xB9, 0xCC, 0x93, 0xCD,
+        0x82, 0xCE, 0xB9, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xB9, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0x99, 0xCC,
+        0x93, 0xCE, 0x99, 0xCC, 0x93, 0xCE, 0x99, 0xCC, 0x94, 0xCE, 0x99, 0xCC, 0x94, 0xCE, 0x99, 0xCC,
+        0x93, 0xCC, 0x80, 0xCE, 0x99, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0x99, 0xCC, 0x94, 0xCC, 0x80, 0xCE,
+        0x99, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x99, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0x99, 0xCC, 0x93, 0xCC,
+        0x81, 0xCE, 0x99, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x99, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x99, 0xCC,
+        0x93, 0xCD, 0x82, 0xCE, 0x99, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0x99, 0xCC, 0x94, 0xCD, 0x82, 0xCE,
+        0x99, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xBF, 0xCC, 0x93, 0xCE, 0xBF, 0xCC, 0x93, 0xCE, 0xBF, 0xCC,
+        0x94, 0xCE, 0xBF, 0xCC, 0x94, 0xCE, 0xBF, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xBF, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0xBF, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xBF, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xBF, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0xBF, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0xBF, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0xBF, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0x9F, 0xCC, 0x93, 0xCE, 0x9F, 0xCC, 0x93, 0xCE, 0x9F, 0xCC,
+        0x94, 0xCE, 0x9F, 0xCC, 0x94, 0xCE, 0x9F, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0x9F, 0xCC, 0x93, 0xCC,
+        0x80, 0xCE, 0x9F, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x9F, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0x9F, 0xCC,
+        0x93, 0xCC, 0x81, 0xCE, 0x9F, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0x9F, 0xCC, 0x94, 0xCC, 0x81, 0xCE,
+        0x9F, 0xCC, 0x94, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x93, 0xCF, 0x85, 0xCC, 0x93, 0xCF, 0x85, 0xCC,
+        0x94, 0xCF, 0x85, 0xCC, 0x94, 0xCF, 0x85, 0xCC, 0x93, 0xCC, 0x80, 0xCF, 0x85, 0xCC, 0x93, 0xCC,
+        0x80, 0xCF, 0x85, 0xCC, 0x94, 0xCC, 0x80, 0xCF, 0x85, 0xCC, 0x94, 0xCC, 0x80, 0xCF, 0x85, 0xCC,
+        0x93, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x93, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x94, 0xCC, 0x81, 0xCF,
+        0x85, 0xCC, 0x94, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x93, 0xCD, 0x82, 0xCF, 0x85, 0xCC, 0x93, 0xCD,
+        0x82, 0xCF, 0x85, 0xCC, 0x94, 0xCD, 0x82, 0xCF, 0x85, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xA5, 0xCC,
+        0x94, 0xCE, 0xA5, 0xCC, 0x94, 0xCE, 0xA5, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xA5, 0xCC, 0x94, 0xCC,
+        0x80, 0xCE, 0xA5, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xA5, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xA5, 0xCC,
+        0x94, 0xCD, 0x82, 0xCE, 0xA5, 0xCC, 0x94, 0xCD, 0x82, 0xCF, 0x89, 0xCC, 0x93, 0xCF, 0x89, 0xCC,
+        0x93, 0xCF, 0x89, 0xCC, 0x94, 0xCF, 0x89, 0xCC, 0x94, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x80, 0xCF,
+        0x89, 0xCC, 0x93, 0xCC, 0x80, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x80, 0xCF, 0x89, 0xCC, 0x94, 0xCC,
+        0x80, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x81, 0xCF, 0x89, 0xCC,
+        0x94, 0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x93, 0xCD, 0x82, 0xCF,
+        0x89, 0xCC, 0x93, 0xCD, 0x82, 0xCF, 0x89, 0xCC, 0x94, 0xCD, 0x82, 0xCF, 0x89, 0xCC, 0x94, 0xCD,
+        0x82, 0xCE, 0xA9, 0xCC, 0x93, 0xCE, 0xA9, 0xCC, 0x93, 0xCE, 0xA9, 0xCC, 0x94, 0xCE, 0xA9, 0xCC,
+        0x94, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x80, 0xCE, 0xA9, 0xCC,
+        0x94, 0xCC, 0x80, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x80, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x81, 0xCE,
+        0xA9, 0xCC, 0x93, 0xCC, 0x81, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x81, 0xCE, 0xA9, 0xCC, 0x94, 0xCC,
+        0x81, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0xA9, 0xCC,
+        0x94, 0xCD, 0x82, 0xCE, 0xA9, 0xCC, 0x94, 0xCD, 0x82, 0xCE, 0xB1, 0xCC, 0x80, 0xCE, 0xB1, 0xCC,
+        0x80, 0xCE, 0xB1, 0xCC, 0x81, 0xCE, 0xB1, 0xCC, 0x81, 0xCE, 0xB5, 0xCC, 0x80, 0xCE, 0xB5, 0xCC,
+        0x80, 0xCE, 0xB5, 0xCC, 0x81, 0xCE, 0xB5, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x80, 0xCE, 0xB7, 0xCC,
+        0x80, 0xCE, 0xB7, 0xCC, 0x81, 0xCE, 0xB7, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x80, 0xCE, 0xB9, 0xCC,
+        0x80, 0xCE, 0xB9, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x81, 0xCE, 0xBF, 0xCC, 0x80, 0xCE, 0xBF, 0xCC,
+        0x80, 0xCE, 0xBF, 0xCC, 0x81, 0xCE, 0xBF, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x80, 0xCF, 0x85, 0xCC,
+        0x80, 0xCF, 0x85, 0xCC, 0x81, 0xCF, 0x85, 0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x80, 0xCF, 0x89, 0xCC,
+        0x80, 0xCF, 0x89, 0xCC, 0x81, 0xCF, 0x89, 0xCC, 0x81, 0xCE, 0xB1, 0xCC, 0x93, 0xCD, 0x85, 0xCE,
+        0xB1, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCD,
+        0x85, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0xB1, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x93, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0x91, 0xCC,
+        0x94, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0x91, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCD, 0x85, 0xCE,
+        0xB7, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x93, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0x97, 0xCC,
+        0x94, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0x97, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCD, 0x85, 0xCF,
+        0x89, 0xCC, 0x93, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x80, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x80, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x81, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x93, 0xCD, 0x82, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x94, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x85, 0xCE, 0xA9, 0xCC,
+        0x94, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x81, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCD, 0x82, 0xCD,
+        0x85, 0xCE, 0xA9, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x86, 0xCE, 0xB1, 0xCC,
+        0x86, 0xCE, 0xB1, 0xCC, 0x84, 0xCE, 0xB1, 0xCC, 0x84, 0xCE, 0xB1, 0xCC, 0x80, 0xCD, 0x85, 0xCE,
+        0xB1, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xB1, 0xCD, 0x85, 0xCE, 0xB1, 0xCD, 0x85, 0xCE, 0xB1, 0xCC,
+        0x81, 0xCD, 0x85, 0xCE, 0xB1, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB1, 0xCD, 0x82, 0xCE, 0xB1, 0xCD,
+        0x82, 0xCE, 0xB1, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB1, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0x91, 0xCC,
+        0x86, 0xCE, 0x91, 0xCC, 0x86, 0xCE, 0x91, 0xCC, 0x84, 0xCE, 0x91, 0xCC, 0x84, 0xCE, 0x91, 0xCC,
+        0x80, 0xCE, 0x91, 0xCC, 0x80, 0xCE, 0x91, 0xCC, 0x81, 0xCE, 0x91, 0xCC, 0x81, 0xCE, 0x91, 0xCD,
+        0x85, 0xCE, 0x91, 0xCD, 0x85, 0x20, 0xCC, 0x93, 0xCE, 0xB9, 0xCE, 0xB9, 0x20, 0xCC, 0x93, 0x20,
+        0xCD, 0x82, 0xC2, 0xA8, 0xCD, 0x82, 0x20, 0xCC, 0x88, 0xCD, 0x82, 0xCE, 0xB7, 0xCC, 0x80, 0xCD,
+        0x85, 0xCE, 0xB7, 0xCC, 0x80, 0xCD, 0x85, 0xCE, 0xB7, 0xCD, 0x85, 0xCE, 0xB7, 0xCD, 0x85, 0xCE,
+        0xB7, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB7, 0xCC, 0x81, 0xCD, 0x85, 0xCE, 0xB7, 0xCD, 0x82, 0xCE,
+        0xB7, 0xCD, 0x82, 0xCE, 0xB7, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0xB7, 0xCD, 0x82, 0xCD, 0x85, 0xCE,
+        0x95, 0xCC, 0x80, 0xCE, 0x95, 0xCC, 0x80, 0xCE, 0x95, 0xCC, 0x81, 0xCE, 0x95, 0xCC, 0x81, 0xCE,
+        0x97, 0xCC, 0x80, 0xCE, 0x97, 0xCC, 0x80, 0xCE, 0x97, 0xCC, 0x81, 0xCE, 0x97, 0xCC, 0x81, 0xCE,
+        0x97, 0xCD, 0x85, 0xCE, 0x97, 0xCD, 0x85, 0xE1, 0xBE, 0xBF, 0xCC, 0x80, 0x20, 0xCC, 0x93, 0xCC,
+        0x80, 0xE1, 0xBE, 0xBF, 0xCC, 0x81, 0x20, 0xCC, 0x93, 0xCC, 0x81, 0xE1, 0xBE, 0xBF, 0xCD, 0x82,
+        0x20, 0xCC, 0x93, 0xCD, 0x82, 0xCE, 0xB9, 0xCC, 0x86, 0xCE, 0xB9, 0xCC, 0x86, 0xCE, 0xB9, 0xCC,
+        0x84, 0xCE, 0xB9, 0xCC, 0x84, 0xCE, 0xB9, 0xCC, 0x88, 0xCC, 0x80, 0xCE, 0xB9, 0xCC, 0x88, 0xCC,
+        0x80, 0xCE, 0xB9, 0xCC, 0x88, 0xCC, 0x81, 0xCE, 0xB9, 0xCC, 0x88, 0xCC, 0x81, 0xCE, 0xB9, 0xCD,
+        0x82, 0xCE, 0xB9, 0xCD, 0x82, 0xCE, 0xB9, 0xCC, 0x88, 0xCD, 0x82, 0xCE, 0xB9, 0xCC, 0x88, 0xCD,
+        0x82, 0xCE, 0x99, 0xCC, 0x86, 0xCE, 0x99, 0xCC, 0x86, 0xCE, 0x99, 0xCC, 0x84, 0xCE, 0x99, 0xCC,
+        0x84, 0xCE, 0x99, 0xCC, 0x80, 0xCE, 0x99, 0xCC, 0x80, 0xCE, 0x99, 0xCC, 0x81, 0xCE, 0x99, 0xCC,
+        0x81, 0xE1, 0xBF, 0xBE, 0xCC, 0x80, 0x20, 0xCC, 0x94, 0xCC, 0x80, 0xE1, 0xBF, 0xBE, 0xCC, 0x81,
+        0x20, 0xCC, 0x94, 0xCC, 0x81, 0xE1, 0xBF, 0xBE, 0xCD, 0x82, 0x20, 0xCC, 0x94, 0xCD, 0x82, 0xCF,
+        0x85, 0xCC, 0x86, 0xCF, 0x85, 0xCC, 0x86, 0xCF, 0x85, 0xCC, 0x84, 0xCF, 0x85, 0xCC, 0x84, 0xCF,
+        0x85, 0xCC, 0x88, 0xCC, 0x80, 0xCF, 0x85, 0xCC, 0x88, 0xCC, 0x80, 0xCF, 0x85, 0xCC, 0x88, 0xCC,
+        0x81, 0xCF, 0x85, 0xCC, 0x88, 0xCC, 0x81, 0xCF, 0x81, 0xCC, 0x93, 0xCF, 0x81, 0xCC, 0x93, 0xCF,
+        0x81, 0xCC, 0x94, 0xCF, 0x81, 0xCC, 0x94, 0xCF, 0x85, 0xCD, 0x82, 0xCF, 0x85, 0xCD, 0x82, 0xCF,
+        0x85, 0xCC, 0x88, 0xCD, 0x82, 0xCF, 0x85, 0xCC, 0x88, 0xCD, 0x82, 0xCE, 0xA5, 0xCC, 0x86, 0xCE,
+        0xA5, 0xCC, 0x86, 0xCE, 0xA5, 0xCC, 0x84, 0xCE, 0xA5, 0xCC, 0x84, 0xCE, 0xA5, 0xCC, 0x80, 0xCE,
+        0xA5, 0xCC, 0x80, 0xCE, 0xA5, 0xCC, 0x81, 0xCE, 0xA5, 0xCC, 0x81, 0xCE, 0xA1, 0xCC, 0x94, 0xCE,
+        0xA1, 0xCC, 0x94, 0xC2, 0xA8, 0xCC, 0x80, 0x20, 0xCC, 0x88, 0xCC, 0x80, 0xC2, 0xA8, 0xCC, 0x81,
+        0x20, 0xCC, 0x88, 0xCC, 0x81, 0x60, 0x60, 0xCF, 0x89, 0xCC, 0x80, 0xCD, 0x85, 0xCF, 0x89, 0xCC,
+        0x80, 0xCD, 0x85, 0xCF, 0x89, 0xCD, 0x85, 0xCF, 0x89, 0xCD, 0x85, 0xCF, 0x89, 0xCC, 0x81, 0xCD,
+        0x85, 0xCF, 0x89, 0xCC, 0x81, 0xCD, 0x85, 0xCF, 0x89, 0xCD, 0x82, 0xCF, 0x89, 0xCD, 0x82, 0xCF,
+        0x89, 0xCD, 0x82, 0xCD, 0x85, 0xCF, 0x89, 0xCD, 0x82, 0xCD, 0x85, 0xCE, 0x9F, 0xCC, 0x80, 0xCE,
+        0x9F, 0xCC, 0x80, 0xCE, 0x9F, 0xCC, 0x81, 0xCE, 0x9F, 0xCC, 0x81, 0xCE, 0xA9, 0xCC, 0x80, 0xCE,
+        0xA9, 0xCC, 0x80, 0xCE, 0xA9, 0xCC, 0x81, 0xCE, 0xA9, 0xCC, 0x81, 0xCE, 0xA9, 0xCD, 0x85, 0xCE,
+        0xA9, 0xCD, 0x85, 0xC2, 0xB4, 0x20, 0xCC, 0x81, 0x20, 0xCC, 0x94, 0xE2, 0x80, 0x82, 0x20, 0xE2,
+        0x80, 0x83, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xE2, 0x80, 0x90, 0x20,
+        0xCC, 0xB3, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x20, 0xE2, 0x80, 0xB2, 0xE2, 0x80, 0xB2, 0xE2,
+        0x80, 0xB2, 0xE2, 0x80, 0xB2, 0xE2, 0x80, 0xB2, 0xE2, 0x80, 0xB5, 0xE2, 0x80, 0xB5, 0xE2, 0x80,
+        0xB5, 0xE2, 0x80, 0xB5, 0xE2, 0x80, 0xB5, 0x21, 0x21, 0x20, 0xCC, 0x85, 0x3F, 0x3F, 0x3F, 0x21,
+        0x21, 0x3F, 0xE2, 0x80, 0xB2, 0xE2, 0x80, 0xB2, 0xE2, 0x80, 0xB2, 0xE2, 0x80, 0xB2, 0x20, 0x30,
+        0x69, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2B, 0xE2, 0x88, 0x92, 0x3D, 0x28, 0x29, 0x6E, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2B, 0xE2, 0x88, 0x92, 0x3D, 0x28, 0x29,
+        0x61, 0x65, 0x6F, 0x78, 0xC9, 0x99, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x52, 0x73,
+        0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73, 0x43, 0xC2, 0xB0, 0x43, 0x63, 0x2F, 0x6F, 0x63, 0x2F, 0x75,
+        0xC6, 0x90, 0xC2, 0xB0, 0x46, 0x67, 0x48, 0x48, 0x48, 0x68, 0xC4, 0xA7, 0x49, 0x49, 0x4C, 0x6C,
+        0x4E, 0x4E, 0x6F, 0x50, 0x51, 0x52, 0x52, 0x52, 0x53, 0x4D, 0x54, 0x45, 0x4C, 0x54, 0x4D, 0x5A,
+        0xCE, 0xA9, 0xCE, 0xA9, 0x5A, 0x4B, 0x4B, 0x41, 0xCC, 0x8A, 0x41, 0xCC, 0x8A, 0x42, 0x43, 0x65,
+        0x45, 0x46, 0x4D, 0x6F, 0xD7, 0x90, 0xD7, 0x91, 0xD7, 0x92, 0xD7, 0x93, 0x69, 0x46, 0x41, 0x58,
+        0xCF, 0x80, 0xCE, 0xB3, 0xCE, 0x93, 0xCE, 0xA0, 0xE2, 0x88, 0x91, 0x44, 0x64, 0x65, 0x69, 0x6A,
+        0x31, 0xE2, 0x81, 0x84, 0x37, 0x31, 0xE2, 0x81, 0x84, 0x39, 0x31, 0xE2, 0x81, 0x84, 0x31, 0x30,
+        0x31, 0xE2, 0x81, 0x84, 0x33, 0x32, 0xE2, 0x81, 0x84, 0x33, 0x31, 0xE2, 0x81, 0x84, 0x35, 0x32,
+        0xE2, 0x81, 0x84, 0x35, 0x33, 0xE2, 0x81, 0x84, 0x35, 0x34, 0xE2, 0x81, 0x84, 0x35, 0x31, 0xE2,
+        0x81, 0x84, 0x36, 0x35, 0xE2, 0x81, 0x84, 0x36, 0x31, 0xE2, 0x81, 0x84, 0x38, 0x33, 0xE2, 0x81,
+        0x84, 0x38, 0x35, 0xE2, 0x81, 0x84, 0x38, 0x37, 0xE2, 0x81, 0x84, 0x38, 0x31, 0xE2, 0x81, 0x84,
+        0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x56, 0x56, 0x56, 0x49, 0x56, 0x49, 0x49, 0x56, 0x49,
+        0x49, 0x49, 0x49, 0x58, 0x58, 0x58, 0x49, 0x58, 0x49, 0x49, 0x4C, 0x43, 0x44, 0x4D, 0x69, 0x69,
+        0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x69, 0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69,
+        0x69, 0x78, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x6C, 0x63, 0x64, 0x6D, 0x30, 0xE2, 0x81, 0x84,
+        0x33, 0xE2, 0x86, 0x90, 0xCC, 0xB8, 0xE2, 0x86, 0x90, 0xCC, 0xB8, 0xE2, 0x86, 0x92, 0xCC, 0xB8,
+        0xE2, 0x86, 0x92, 0xCC, 0xB8, 0xE2, 0x86, 0x94, 0xCC, 0xB8, 0xE2, 0x86, 0x94, 0xCC, 0xB8, 0xE2,
+        0x87, 0x90, 0xCC, 0xB8, 0xE2, 0x87, 0x90, 0xCC, 0xB8, 0xE2, 0x87, 0x94, 0xCC, 0xB8, 0xE2, 0x87,
+        0x94, 0xCC, 0xB8, 0xE2, 0x87, 0x92, 0xCC, 0xB8, 0xE2, 0x87, 0x92, 0xCC, 0xB8, 0xE2, 0x88, 0x83,
+        0xCC, 0xB8, 0xE2, 0x88, 0x83, 0xCC, 0xB8, 0xE2, 0x88, 0x88, 0xCC, 0xB8, 0xE2, 0x88, 0x88, 0xCC,
+        0xB8, 0xE2, 0x88, 0x8B, 0xCC, 0xB8, 0xE2, 0x88, 0x8B, 0xCC, 0xB8, 0xE2, 0x88, 0xA3, 0xCC, 0xB8,
+        0xE2, 0x88, 0xA3, 0xCC, 0xB8, 0xE2, 0x88, 0xA5, 0xCC, 0xB8, 0xE2, 0x88, 0xA5, 0xCC, 0xB8, 0xE2,
+        0x88, 0xAB, 0xE2, 0x88, 0xAB, 0xE2, 0x88, 0xAB, 0xE2, 0x88, 0xAB, 0xE2, 0x88, 0xAB, 0xE2, 0x88,
+        0xAE, 0xE2, 0x88, 0xAE, 0xE2, 0x88, 0xAE, 0xE2, 0x88, 0xAE, 0xE2, 0x88, 0xAE, 0xE2, 0x88, 0xBC,
+        0xCC, 0xB8, 0xE2, 0x88, 0xBC, 0xCC, 0xB8, 0xE2, 0x89, 0x83, 0xCC, 0xB8, 0xE2, 0x89, 0x83, 0xCC,
+        0xB8, 0xE2, 0x89, 0x85, 0xCC, 0xB8, 0xE2, 0x89, 0x85, 0xCC, 0xB8, 0xE2, 0x89, 0x88, 0xCC, 0xB8,
+        0xE2, 0x89, 0x88, 0xCC, 0xB8, 0x3D, 0xCC, 0xB8, 0x3D, 0xCC, 0xB8, 0xE2, 0x89, 0xA1, 0xCC, 0xB8,
+        0xE2, 0x89, 0xA1, 0xCC, 0xB8, 0xE2, 0x89, 0x8D, 0xCC, 0xB8, 0xE2, 0x89, 0x8D, 0xCC, 0xB8, 0x3C,
+        0xCC, 0xB8, 0x3C, 0xCC, 0xB8, 0x3E, 0xCC, 0xB8, 0x3E, 0xCC, 0xB8, 0xE2, 0x89, 0xA4, 0xCC, 0xB8,
+        0xE2, 0x89, 0xA4, 0xCC, 0xB8, 0xE2, 0x89, 0xA5, 0xCC, 0xB8, 0xE2, 0x89, 0xA5, 0xCC, 0xB8, 0xE2,
+        0x89, 0xB2, 0xCC, 0xB8, 0xE2, 0x89, 0xB2, 0xCC, 0xB8, 0xE2, 0x89, 0xB3, 0xCC, 0xB8, 0xE2, 0x89,
+        0xB3, 0xCC, 0xB8, 0xE2, 0x89, 0xB6, 0xCC, 0xB8, 0xE2, 0x89, 0xB6, 0xCC, 0xB8, 0xE2, 0x89, 0xB7,
+        0xCC, 0xB8, 0xE2, 0x89, 0xB7, 0xCC, 0xB8, 0xE2, 0x89, 0xBA, 0xCC, 0xB8, 0xE2, 0x89, 0xBA, 0xCC,
+        0xB8, 0xE2, 0x89, 0xBB, 0xCC, 0xB8, 0xE2, 0x89, 0xBB, 0xCC, 0xB8, 0xE2, 0x8A, 0x82, 0xCC, 0xB8,
+        0xE2, 0x8A, 0x82, 0xCC, 0xB8, 0xE2, 0x8A, 0x83, 0xCC, 0xB8, 0xE2, 0x8A, 0x83, 0xCC, 0xB8, 0xE2,
+        0x8A, 0x86, 0xCC, 0xB8, 0xE2, 0x8A, 0x86, 0xCC, 0xB8, 0xE2, 0x8A, 0x87, 0xCC, 0xB8, 0xE2, 0x8A,
+        0x87, 0xCC, 0xB8, 0xE2, 0x8A, 0xA2, 0xCC, 0xB8, 0xE2, 0x8A, 0xA2, 0xCC, 0xB8, 0xE2, 0x8A, 0xA8,
+        0xCC, 0xB8, 0xE2, 0x8A, 0xA8, 0xCC, 0xB8, 0xE2, 0x8A, 0xA9, 0xCC, 0xB8, 0xE2, 0x8A, 0xA9, 0xCC,
+        0xB8, 0xE2, 0x8A, 0xAB, 0xCC, 0xB8, 0xE2, 0x8A, 0xAB, 0xCC, 0xB8, 0xE2, 0x89, 0xBC, 0xCC, 0xB8,
+        0xE2, 0x89, 0xBC, 0xCC, 0xB8, 0xE2, 0x89, 0xBD, 0xCC, 0xB8, 0xE2, 0x89, 0xBD, 0xCC, 0xB8, 0xE2,
+        0x8A, 0x91, 0xCC, 0xB8, 0xE2, 0x8A, 0x91, 0xCC, 0xB8, 0xE2, 0x8A, 0x92, 0xCC, 0xB8, 0xE2, 0x8A,
+        0x92, 0xCC, 0xB8, 0xE2, 0x8A, 0xB2, 0xCC, 0xB8, 0xE2, 0x8A, 0xB2, 0xCC, 0xB8, 0xE2, 0x8A, 0xB3,
+        0xCC, 0xB8, 0xE2, 0x8A, 0xB3, 0xCC, 0xB8, 0xE2, 0x8A, 0xB4, 0xCC, 0xB8, 0xE2, 0x8A, 0xB4, 0xCC,
+        0xB8, 0xE2, 0x8A, 0xB5, 0xCC, 0xB8, 0xE2, 0x8A, 0xB5, 0xCC, 0xB8, 0xE3, 0x80, 0x88, 0xE3, 0x80,
+        0x88, 0xE3, 0x80, 0x89, 0xE3, 0x80, 0x89, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31, 0x33, 0x31, 0x34, 0x31, 0x35, 0x31, 0x36, 0x31, 0x37,
+        0x31, 0x38, 0x31, 0x39, 0x32, 0x30, 0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28,
+        0x34, 0x29, 0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29, 0x28, 0x39,
+        0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28, 0x31, 0x32, 0x29, 0x28, 0x31, 0x33,
+        0x29, 0x28, 0x31, 0x34, 0x29, 0x28, 0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37,
+        0x29, 0x28, 0x31, 0x38, 0x29, 0x28, 0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x31, 0x2E, 0x32,
+        0x2E, 0x33, 0x2E, 0x34, 0x2E, 0x35, 0x2E, 0x36, 0x2E, 0x37, 0x2E, 0x38, 0x2E, 0x39, 0x2E, 0x31,
+        0x30, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x32, 0x2E, 0x31, 0x33, 0x2E, 0x31, 0x34, 0x2E, 0x31, 0x35,
+        0x2E, 0x31, 0x36, 0x2E, 0x31, 0x37, 0x2E, 0x31, 0x38, 0x2E, 0x31, 0x39, 0x2E, 0x32, 0x30, 0x2E,
+        0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65, 0x29, 0x28,
+        0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B,
+        0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29,
+        0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28,
+        0x76, 0x29, 0x28, 0x77, 0x29, 0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x41, 0x42,
+        0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+        0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+        0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+        0x79, 0x7A, 0x30, 0xE2, 0x88, 0xAB, 0xE2, 0x88, 0xAB, 0xE2, 0x88, 0xAB, 0xE2, 0x88, 0xAB, 0x3A,
+        0x3A, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0xE2, 0xAB, 0x9D, 0xCC, 0xB8, 0xE2, 0xAB, 0x9D, 0xCC,
+        0xB8, 0x6A, 0x56, 0xE2, 0xB5, 0xA1, 0xE6, 0xAF, 0x8D, 0xE9, 0xBE, 0x9F, 0xE4, 0xB8, 0x80, 0xE4,
+        0xB8, 0xA8, 0xE4, 0xB8, 0xB6, 0xE4, 0xB8, 0xBF, 0xE4, 0xB9, 0x99, 0xE4, 0xBA, 0x85, 0xE4, 0xBA,
+        0x8C, 0xE4, 0xBA, 0xA0, 0xE4, 0xBA, 0xBA, 0xE5, 0x84, 0xBF, 0xE5, 0x85, 0xA5, 0xE5, 0x85, 0xAB,
+        0xE5, 0x86, 0x82, 0xE5, 0x86, 0x96, 0xE5, 0x86, 0xAB, 0xE5, 0x87, 0xA0, 0xE5, 0x87, 0xB5, 0xE5,
+        0x88, 0x80, 0xE5, 0x8A, 0x9B, 0xE5, 0x8B, 0xB9, 0xE5, 0x8C, 0x95, 0xE5, 0x8C, 0x9A, 0xE5, 0x8C,
+        0xB8, 0xE5, 0x8D, 0x81, 0xE5, 0x8D, 0x9C, 0xE5, 0x8D, 0xA9, 0xE5, 0x8E, 0x82, 0xE5, 0x8E, 0xB6,
+        0xE5, 0x8F, 0x88, 0xE5, 0x8F, 0xA3, 0xE5, 0x9B, 0x97, 0xE5, 0x9C, 0x9F, 0xE5, 0xA3, 0xAB, 0xE5,
+        0xA4, 0x82, 0xE5, 0xA4, 0x8A, 0xE5, 0xA4, 0x95, 0xE5, 0xA4, 0xA7, 0xE5, 0xA5, 0xB3, 0xE5, 0xAD,
+        0x90, 0xE5, 0xAE, 0x80, 0xE5, 0xAF, 0xB8, 0xE5, 0xB0, 0x8F, 0xE5, 0xB0, 0xA2, 0xE5, 0xB0, 0xB8,
+        0xE5, 0xB1, 0xAE, 0xE5, 0xB1, 0xB1, 0xE5, 0xB7, 0x9B, 0xE5, 0xB7, 0xA5, 0xE5, 0xB7, 0xB1, 0xE5,
+        0xB7, 0xBE, 0xE5, 0xB9, 0xB2, 0xE5, 0xB9, 0xBA, 0xE5, 0xB9, 0xBF, 0xE5, 0xBB, 0xB4, 0xE5, 0xBB,
+        0xBE, 0xE5, 0xBC, 0x8B, 0xE5, 0xBC, 0x93, 0xE5, 0xBD, 0x90, 0xE5, 0xBD, 0xA1, 0xE5, 0xBD, 0xB3,
+        0xE5, 0xBF, 0x83, 0xE6, 0x88, 0x88, 0xE6, 0x88, 0xB6, 0xE6, 0x89, 0x8B, 0xE6, 0x94, 0xAF, 0xE6,
+        0x94, 0xB4, 0xE6, 0x96, 0x87, 0xE6, 0x96, 0x97, 0xE6, 0x96, 0xA4, 0xE6, 0x96, 0xB9, 0xE6, 0x97,
+        0xA0, 0xE6, 0x97, 0xA5, 0xE6, 0x9B, 0xB0, 0xE6, 0x9C, 0x88, 0xE6, 0x9C, 0xA8, 0xE6, 0xAC, 0xA0,
+        0xE6, 0xAD, 0xA2, 0xE6, 0xAD, 0xB9, 0xE6, 0xAE, 0xB3, 0xE6, 0xAF, 0x8B, 0xE6, 0xAF, 0x94, 0xE6,
+        0xAF, 0x9B, 0xE6, 0xB0, 0x8F, 0xE6, 0xB0, 0x94, 0xE6, 0xB0, 0xB4, 0xE7, 0x81, 0xAB, 0xE7, 0x88,
+        0xAA, 0xE7, 0x88, 0xB6, 0xE7, 0x88, 0xBB, 0xE7, 0x88, 0xBF, 0xE7, 0x89, 0x87, 0xE7, 0x89, 0x99,
+        0xE7, 0x89, 0x9B, 0xE7, 0x8A, 0xAC, 0xE7, 0x8E, 0x84, 0xE7, 0x8E, 0x89, 0xE7, 0x93, 0x9C, 0xE7,
+        0x93, 0xA6, 0xE7, 0x94, 0x98, 0xE7, 0x94, 0x9F, 0xE7, 0x94, 0xA8, 0xE7, 0x94, 0xB0, 0xE7, 0x96,
+        0x8B, 0xE7, 0x96, 0x92, 0xE7, 0x99, 0xB6, 0xE7, 0x99, 0xBD, 0xE7, 0x9A, 0xAE, 0xE7, 0x9A, 0xBF,
+        0xE7, 0x9B, 0xAE, 0xE7, 0x9F, 0x9B, 0xE7, 0x9F, 0xA2, 0xE7, 0x9F, 0xB3, 0xE7, 0xA4, 0xBA, 0xE7,
+        0xA6, 0xB8, 0xE7, 0xA6, 0xBE, 0xE7, 0xA9, 0xB4, 0xE7, 0xAB, 0x8B, 0xE7, 0xAB, 0xB9, 0xE7, 0xB1,
+        0xB3, 0xE7, 0xB3, 0xB8, 0xE7, 0xBC, 0xB6, 0xE7, 0xBD, 0x91, 0xE7, 0xBE, 0x8A, 0xE7, 0xBE, 0xBD,
+        0xE8, 0x80, 0x81, 0xE8, 0x80, 0x8C, 0xE8, 0x80, 0x92, 0xE8, 0x80, 0xB3, 0xE8, 0x81, 0xBF, 0xE8,
+        0x82, 0x89, 0xE8, 0x87, 0xA3, 0xE8, 0x87, 0xAA, 0xE8, 0x87, 0xB3, 0xE8, 0x87, 0xBC, 0xE8, 0x88,
+        0x8C, 0xE8, 0x88, 0x9B, 0xE8, 0x88, 0x9F, 0xE8, 0x89, 0xAE, 0xE8, 0x89, 0xB2, 0xE8, 0x89, 0xB8,
+        0xE8, 0x99, 0x8D, 0xE8, 0x99, 0xAB, 0xE8, 0xA1, 0x80, 0xE8, 0xA1, 0x8C, 0xE8, 0xA1, 0xA3, 0xE8,
+        0xA5, 0xBE, 0xE8, 0xA6, 0x8B, 0xE8, 0xA7, 0x92, 0xE8, 0xA8, 0x80, 0xE8, 0xB0, 0xB7, 0xE8, 0xB1,
+        0x86, 0xE8, 0xB1, 0x95, 0xE8, 0xB1, 0xB8, 0xE8, 0xB2, 0x9D, 0xE8, 0xB5, 0xA4, 0xE8, 0xB5, 0xB0,
+        0xE8, 0xB6, 0xB3, 0xE8, 0xBA, 0xAB, 0xE8, 0xBB, 0x8A, 0xE8, 0xBE, 0x9B, 0xE8, 0xBE, 0xB0, 0xE8,
+        0xBE, 0xB5, 0xE9, 0x82, 0x91, 0xE9, 0x85, 0x89, 0xE9, 0x87, 0x86, 0xE9, 0x87, 0x8C, 0xE9, 0x87,
+        0x91, 0xE9, 0x95, 0xB7, 0xE9, 0x96, 0x80, 0xE9, 0x98, 0x9C, 0xE9, 0x9A, 0xB6, 0xE9, 0x9A, 0xB9,
+        0xE9, 0x9B, 0xA8, 0xE9, 0x9D, 0x91, 0xE9, 0x9D, 0x9E, 0xE9, 0x9D, 0xA2, 0xE9, 0x9D, 0xA9, 0xE9,
+        0x9F, 0x8B, 0xE9, 0x9F, 0xAD, 0xE9, 0x9F, 0xB3, 0xE9, 0xA0, 0x81, 0xE9, 0xA2, 0xA8, 0xE9, 0xA3,
+        0x9B, 0xE9, 0xA3, 0x9F, 0xE9, 0xA6, 0x96, 0xE9, 0xA6, 0x99, 0xE9, 0xA6, 0xAC, 0xE9, 0xAA, 0xA8,
+        0xE9, 0xAB, 0x98, 0xE9, 0xAB, 0x9F, 0xE9, 0xAC, 0xA5, 0xE9, 0xAC, 0xAF, 0xE9, 0xAC, 0xB2, 0xE9,
+        0xAC, 0xBC, 0xE9, 0xAD, 0x9A, 0xE9, 0xB3, 0xA5, 0xE9, 0xB9, 0xB5, 0xE9, 0xB9, 0xBF, 0xE9, 0xBA,
+        0xA5, 0xE9, 0xBA, 0xBB, 0xE9, 0xBB, 0x83, 0xE9, 0xBB, 0x8D, 0xE9, 0xBB, 0x91, 0xE9, 0xBB, 0xB9,
+        0xE9, 0xBB, 0xBD, 0xE9, 0xBC, 0x8E, 0xE9, 0xBC, 0x93, 0xE9, 0xBC, 0xA0, 0xE9, 0xBC, 0xBB, 0xE9,
+        0xBD, 0x8A, 0xE9, 0xBD, 0x92, 0xE9, 0xBE, 0x8D, 0xE9, 0xBE, 0x9C, 0xE9, 0xBE, 0xA0, 0x20, 0xE3,
+        0x80, 0x92, 0xE5, 0x8D, 0x81, 0xE5, 0x8D, 0x84, 0xE5, 0x8D, 0x85, 0xE3, 0x81, 0x8B, 0xE3, 0x82,
+        0x99, 0xE3, 0x81, 0x8B, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x8D, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x8D,
+        0xE3, 0x82, 0x99, 0xE3, 0x81, 0x8F, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x8F, 0xE3, 0x82, 0x99, 0xE3,
+        0x81, 0x91, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x91, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x93, 0xE3, 0x82,
+        0x99, 0xE3, 0x81, 0x93, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x95, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x95,
+        0xE3, 0x82, 0x99, 0xE3, 0x81, 0x97, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x97, 0xE3, 0x82, 0x99, 0xE3,
+        0x81, 0x99, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x99, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x9B, 0xE3, 0x82,
+        0x99, 0xE3, 0x81, 0x9B, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x9D, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x9D,
+        0xE3, 0x82, 0x99, 0xE3, 0x81, 0x9F, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x9F, 0xE3, 0x82, 0x99, 0xE3,
+        0x81, 0xA1, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xA1, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xA4, 0xE3, 0x82,
+        0x99, 0xE3, 0x81, 0xA4, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xA6, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xA6,
+        0xE3, 0x82, 0x99, 0xE3, 0x81, 0xA8, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xA8, 0xE3, 0x82, 0x99, 0xE3,
+        0x81, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xAF, 0xE3, 0x82,
+        0x9A, 0xE3, 0x81, 0xAF, 0xE3, 0x82, 0x9A, 0xE3, 0x81, 0xB2, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xB2,
+        0xE3, 0x82, 0x99, 0xE3, 0x81, 0xB2, 0xE3, 0x82, 0x9A, 0xE3, 0x81, 0xB2, 0xE3, 0x82, 0x9A, 0xE3,
+        0x81, 0xB5, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xB5, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xB5, 0xE3, 0x82,
+        0x9A, 0xE3, 0x81, 0xB5, 0xE3, 0x82, 0x9A, 0xE3, 0x81, 0xB8, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xB8,
+        0xE3, 0x82, 0x99, 0xE3, 0x81, 0xB8, 0xE3, 0x82, 0x9A, 0xE3, 0x81, 0xB8, 0xE3, 0x82, 0x9A, 0xE3,
+        0x81, 0xBB, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xBB, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0xBB, 0xE3, 0x82,
+        0x9A, 0xE3, 0x81, 0xBB, 0xE3, 0x82, 0x9A, 0xE3, 0x81, 0x86, 0xE3, 0x82, 0x99, 0xE3, 0x81, 0x86,
+        0xE3, 0x82, 0x99, 0x20, 0xE3, 0x82, 0x99, 0x20, 0xE3, 0x82, 0x9A, 0xE3, 0x82, 0x9D, 0xE3, 0x82,
+        0x99, 0xE3, 0x82, 0x9D, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0x88, 0xE3, 0x82, 0x8A, 0xE3, 0x82, 0xAB,
+        0xE3, 0x82, 0x99, 0xE3, 0x82, 0xAB, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xAD, 0xE3, 0x82, 0x99, 0xE3,
+        0x82, 0xAD, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xAF, 0xE3, 0x82,
+        0x99, 0xE3, 0x82, 0xB1, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB1, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB3,
+        0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB3, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB5, 0xE3, 0x82, 0x99, 0xE3,
+        0x82, 0xB5, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB7, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB7, 0xE3, 0x82,
+        0x99, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xBB,
+        0xE3, 0x82, 0x99, 0xE3, 0x82, 0xBB, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xBD, 0xE3, 0x82, 0x99, 0xE3,
+        0x82, 0xBD, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xBF, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xBF, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0x81, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x81, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x84,
+        0xE3, 0x82, 0x99, 0xE3, 0x83, 0x84, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x86, 0xE3, 0x82, 0x99, 0xE3,
+        0x83, 0x86, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x88, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x8F,
+        0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x99, 0xE3,
+        0x83, 0x92, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x92, 0xE3, 0x82,
+        0x9A, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x95,
+        0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x99, 0xE3,
+        0x83, 0x98, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x98, 0xE3, 0x82,
+        0x9A, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x9B,
+        0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x9A, 0xE3, 0x82, 0xA6, 0xE3, 0x82, 0x99, 0xE3,
+        0x82, 0xA6, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xAF, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0xB0, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xB0, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xB1,
+        0xE3, 0x82, 0x99, 0xE3, 0x83, 0xB1, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xB2, 0xE3, 0x82, 0x99, 0xE3,
+        0x83, 0xB2, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xBD, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xBD, 0xE3, 0x82,
+        0x99, 0xE3, 0x82, 0xB3, 0xE3, 0x83, 0x88, 0xE1, 0x84, 0x80, 0xE1, 0x84, 0x81, 0xE1, 0x86, 0xAA,
+        0xE1, 0x84, 0x82, 0xE1, 0x86, 0xAC, 0xE1, 0x86, 0xAD, 0xE1, 0x84, 0x83, 0xE1, 0x84, 0x84, 0xE1,
+        0x84, 0x85, 0xE1, 0x86, 0xB0, 0xE1, 0x86, 0xB1, 0xE1, 0x86, 0xB2, 0xE1, 0x86, 0xB3, 0xE1, 0x86,
+        0xB4, 0xE1, 0x86, 0xB5, 0xE1, 0x84, 0x9A, 0xE1, 0x84, 0x86, 0xE1, 0x84, 0x87, 0xE1, 0x84, 0x88,
+        0xE1, 0x84, 0xA1, 0xE1, 0x84, 0x89, 0xE1, 0x84, 0x8A, 0xE1, 0x84, 0x8B, 0xE1, 0x84, 0x8C, 0xE1,
+        0x84, 0x8D, 0xE1, 0x84, 0x8E, 0xE1, 0x84, 0x8F, 0xE1, 0x84, 0x90, 0xE1, 0x84, 0x91, 0xE1, 0x84,
+        0x92, 0xE1, 0x85, 0xA1, 0xE1, 0x85, 0xA2, 0xE1, 0x85, 0xA3, 0xE1, 0x85, 0xA4, 0xE1, 0x85, 0xA5,
+        0xE1, 0x85, 0xA6, 0xE1, 0x85, 0xA7, 0xE1, 0x85, 0xA8, 0xE1, 0x85, 0xA9, 0xE1, 0x85, 0xAA, 0xE1,
+        0x85, 0xAB, 0xE1, 0x85, 0xAC, 0xE1, 0x85, 0xAD, 0xE1, 0x85, 0xAE, 0xE1, 0x85, 0xAF, 0xE1, 0x85,
+        0xB0, 0xE1, 0x85, 0xB1, 0xE1, 0x85, 0xB2, 0xE1, 0x85, 0xB3, 0xE1, 0x85, 0xB4, 0xE1, 0x85, 0xB5,
+        0xE1, 0x85, 0xA0, 0xE1, 0x84, 0x94, 0xE1, 0x84, 0x95, 0xE1, 0x87, 0x87, 0xE1, 0x87, 0x88, 0xE1,
+        0x87, 0x8C, 0xE1, 0x87, 0x8E, 0xE1, 0x87, 0x93, 0xE1, 0x87, 0x97, 0xE1, 0x87, 0x99, 0xE1, 0x84,
+        0x9C, 0xE1, 0x87, 0x9D, 0xE1, 0x87, 0x9F, 0xE1, 0x84, 0x9D, 0xE1, 0x84, 0x9E, 0xE1, 0x84, 0xA0,
+        0xE1, 0x84, 0xA2, 0xE1, 0x84, 0xA3, 0xE1, 0x84, 0xA7, 0xE1, 0x84, 0xA9, 0xE1, 0x84, 0xAB, 0xE1,
+        0x84, 0xAC, 0xE1, 0x84, 0xAD, 0xE1, 0x84, 0xAE, 0xE1, 0x84, 0xAF, 0xE1, 0x84, 0xB2, 0xE1, 0x84,
+        0xB6, 0xE1, 0x85, 0x80, 0xE1, 0x85, 0x87, 0xE1, 0x85, 0x8C, 0xE1, 0x87, 0xB1, 0xE1, 0x87, 0xB2,
+        0xE1, 0x85, 0x97, 0xE1, 0x85, 0x98, 0xE1, 0x85, 0x99, 0xE1, 0x86, 0x84, 0xE1, 0x86, 0x85, 0xE1,
+        0x86, 0x88, 0xE1, 0x86, 0x91, 0xE1, 0x86, 0x92, 0xE1, 0x86, 0x94, 0xE1, 0x86, 0x9E, 0xE1, 0x86,
+        0xA1, 0xE4, 0xB8, 0x80, 0xE4, 0xBA, 0x8C, 0xE4, 0xB8, 0x89, 0xE5, 0x9B, 0x9B, 0xE4, 0xB8, 0x8A,
+        0xE4, 0xB8, 0xAD, 0xE4, 0xB8, 0x8B, 0xE7, 0x94, 0xB2, 0xE4, 0xB9, 0x99, 0xE4, 0xB8, 0x99, 0xE4,
+        0xB8, 0x81, 0xE5, 0xA4, 0xA9, 0xE5, 0x9C, 0xB0, 0xE4, 0xBA, 0xBA, 0x28, 0xE1, 0x84, 0x80, 0x29,
+        0x28, 0xE1, 0x84, 0x82, 0x29, 0x28, 0xE1, 0x84, 0x83, 0x29, 0x28, 0xE1, 0x84, 0x85, 0x29, 0x28,
+        0xE1, 0x84, 0x86, 0x29, 0x28, 0xE1, 0x84, 0x87, 0x29, 0x28, 0xE1, 0x84, 0x89, 0x29, 0x28, 0xE1,
+        0x84, 0x8B, 0x29, 0x28, 0xE1, 0x84, 0x8C, 0x29, 0x28, 0xE1, 0x84, 0x8E, 0x29, 0x28, 0xE1, 0x84,
+        0x8F, 0x29, 0x28, 0xE1, 0x84, 0x90, 0x29, 0x28, 0xE1, 0x84, 0x91, 0x29, 0x28, 0xE1, 0x84, 0x92,
+        0x29, 0x28, 0xE1, 0x84, 0x80, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x82, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x83, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x85, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x86, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x87, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x89, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x8B, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x8C, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x8E, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x8F, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x90, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x91, 0xE1, 0x85, 0xA1, 0x29, 0x28, 0xE1, 0x84, 0x92, 0xE1, 0x85, 0xA1,
+        0x29, 0x28, 0xE1, 0x84, 0x8C, 0xE1, 0x85, 0xAE, 0x29, 0x28, 0xE1, 0x84, 0x8B, 0xE1, 0x85, 0xA9,
+        0xE1, 0x84, 0x8C, 0xE1, 0x85, 0xA5, 0xE1, 0x86, 0xAB, 0x29, 0x28, 0xE1, 0x84, 0x8B, 0xE1, 0x85,
+        0xA9, 0xE1, 0x84, 0x92, 0xE1, 0x85, 0xAE, 0x29, 0x28, 0xE4, 0xB8, 0x80, 0x29, 0x28, 0xE4, 0xBA,
+        0x8C, 0x29, 0x28, 0xE4, 0xB8, 0x89, 0x29, 0x28, 0xE5, 0x9B, 0x9B, 0x29, 0x28, 0xE4, 0xBA, 0x94,
+        0x29, 0x28, 0xE5, 0x85, 0xAD, 0x29, 0x28, 0xE4, 0xB8, 0x83, 0x29, 0x28, 0xE5, 0x85, 0xAB, 0x29,
+        0x28, 0xE4, 0xB9, 0x9D, 0x29, 0x28, 0xE5, 0x8D, 0x81, 0x29, 0x28, 0xE6, 0x9C, 0x88, 0x29, 0x28,
+        0xE7, 0x81, 0xAB, 0x29, 0x28, 0xE6, 0xB0, 0xB4, 0x29, 0x28, 0xE6, 0x9C, 0xA8, 0x29, 0x28, 0xE9,
+        0x87, 0x91, 0x29, 0x28, 0xE5, 0x9C, 0x9F, 0x29, 0x28, 0xE6, 0x97, 0xA5, 0x29, 0x28, 0xE6, 0xA0,
+        0xAA, 0x29, 0x28, 0xE6, 0x9C, 0x89, 0x29, 0x28, 0xE7, 0xA4, 0xBE, 0x29, 0x28, 0xE5, 0x90, 0x8D,
+        0x29, 0x28, 0xE7, 0x89, 0xB9, 0x29, 0x28, 0xE8, 0xB2, 0xA1, 0x29, 0x28, 0xE7, 0xA5, 0x9D, 0x29,
+        0x28, 0xE5, 0x8A, 0xB4, 0x29, 0x28, 0xE4, 0xBB, 0xA3, 0x29, 0x28, 0xE5, 0x91, 0xBC, 0x29, 0x28,
+        0xE5, 0xAD, 0xA6, 0x29, 0x28, 0xE7, 0x9B, 0xA3, 0x29, 0x28, 0xE4, 0xBC, 0x81, 0x29, 0x28, 0xE8,
+        0xB3, 0x87, 0x29, 0x28, 0xE5, 0x8D, 0x94, 0x29, 0x28, 0xE7, 0xA5, 0xAD, 0x29, 0x28, 0xE4, 0xBC,
+        0x91, 0x29, 0x28, 0xE8, 0x87, 0xAA, 0x29, 0x28, 0xE8, 0x87, 0xB3, 0x29, 0xE5, 0x95, 0x8F, 0xE5,
+        0xB9, 0xBC, 0xE6, 0x96, 0x87, 0xE7, 0xAE, 0x8F, 0x50, 0x54, 0x45, 0x32, 0x31, 0x32, 0x32, 0x32,
+        0x33, 0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33,
+        0x31, 0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33, 0x35, 0xE1, 0x84, 0x80, 0xE1, 0x84, 0x82, 0xE1,
+        0x84, 0x83, 0xE1, 0x84, 0x85, 0xE1, 0x84, 0x86, 0xE1, 0x84, 0x87, 0xE1, 0x84, 0x89, 0xE1, 0x84,
+        0x8B, 0xE1, 0x84, 0x8C, 0xE1, 0x84, 0x8E, 0xE1, 0x84, 0x8F, 0xE1, 0x84, 0x90, 0xE1, 0x84, 0x91,
+        0xE1, 0x84, 0x92, 0xE1, 0x84, 0x80, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x82, 0xE1, 0x85, 0xA1, 0xE1,
+        0x84, 0x83, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x85, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x86, 0xE1, 0x85,
+        0xA1, 0xE1, 0x84, 0x87, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x89, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x8B,
+        0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x8C, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x8E, 0xE1, 0x85, 0xA1, 0xE1,
+        0x84, 0x8F, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x90, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x91, 0xE1, 0x85,
+        0xA1, 0xE1, 0x84, 0x92, 0xE1, 0x85, 0xA1, 0xE1, 0x84, 0x8E, 0xE1, 0x85, 0xA1, 0xE1, 0x86, 0xB7,
+        0xE1, 0x84, 0x80, 0xE1, 0x85, 0xA9, 0xE1, 0x84, 0x8C, 0xE1, 0x85, 0xAE, 0xE1, 0x84, 0x8B, 0xE1,
+        0x85, 0xB4, 0xE1, 0x84, 0x8B, 0xE1, 0x85, 0xAE, 0xE4, 0xB8, 0x80, 0xE4, 0xBA, 0x8C, 0xE4, 0xB8,
+        0x89, 0xE5, 0x9B, 0x9B, 0xE4, 0xBA, 0x94, 0xE5, 0x85, 0xAD, 0xE4, 0xB8, 0x83, 0xE5, 0x85, 0xAB,
+        0xE4, 0xB9, 0x9D, 0xE5, 0x8D, 0x81, 0xE6, 0x9C, 0x88, 0xE7, 0x81, 0xAB, 0xE6, 0xB0, 0xB4, 0xE6,
+        0x9C, 0xA8, 0xE9, 0x87, 0x91, 0xE5, 0x9C, 0x9F, 0xE6, 0x97, 0xA5, 0xE6, 0xA0, 0xAA, 0xE6, 0x9C,
+        0x89, 0xE7, 0xA4, 0xBE, 0xE5, 0x90, 0x8D, 0xE7, 0x89, 0xB9, 0xE8, 0xB2, 0xA1, 0xE7, 0xA5, 0x9D,
+        0xE5, 0x8A, 0xB4, 0xE7, 0xA7, 0x98, 0xE7, 0x94, 0xB7, 0xE5, 0xA5, 0xB3, 0xE9, 0x81, 0xA9, 0xE5,
+        0x84, 0xAA, 0xE5, 0x8D, 0xB0, 0xE6, 0xB3, 0xA8, 0xE9, 0xA0, 0x85, 0xE4, 0xBC, 0x91, 0xE5, 0x86,
+        0x99, 0xE6, 0xAD, 0xA3, 0xE4, 0xB8, 0x8A, 0xE4, 0xB8, 0xAD, 0xE4, 0xB8, 0x8B, 0xE5, 0xB7, 0xA6,
+        0xE5, 0x8F, 0xB3, 0xE5, 0x8C, 0xBB, 0xE5, 0xAE, 0x97, 0xE5, 0xAD, 0xA6, 0xE7, 0x9B, 0xA3, 0xE4,
+        0xBC, 0x81, 0xE8, 0xB3, 0x87, 0xE5, 0x8D, 0x94, 0xE5, 0xA4, 0x9C, 0x33, 0x36, 0x33, 0x37, 0x33,
+        0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34,
+        0x36, 0x34, 0x37, 0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0xE6, 0x9C, 0x88, 0x32, 0xE6, 0x9C,
+        0x88, 0x33, 0xE6, 0x9C, 0x88, 0x34, 0xE6, 0x9C, 0x88, 0x35, 0xE6, 0x9C, 0x88, 0x36, 0xE6, 0x9C,
+        0x88, 0x37, 0xE6, 0x9C, 0x88, 0x38, 0xE6, 0x9C, 0x88, 0x39, 0xE6, 0x9C, 0x88, 0x31, 0x30, 0xE6,
+        0x9C, 0x88, 0x31, 0x31, 0xE6, 0x9C, 0x88, 0x31, 0x32, 0xE6, 0x9C, 0x88, 0x48, 0x67, 0x65, 0x72,
+        0x67, 0x65, 0x56, 0x4C, 0x54, 0x44, 0xE3, 0x82, 0xA2, 0xE3, 0x82, 0xA4, 0xE3, 0x82, 0xA6, 0xE3,
+        0x82, 0xA8, 0xE3, 0x82, 0xAA, 0xE3, 0x82, 0xAB, 0xE3, 0x82, 0xAD, 0xE3, 0x82, 0xAF, 0xE3, 0x82,
+        0xB1, 0xE3, 0x82, 0xB3, 0xE3, 0x82, 0xB5, 0xE3, 0x82, 0xB7, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0xBB,
+        0xE3, 0x82, 0xBD, 0xE3, 0x82, 0xBF, 0xE3, 0x83, 0x81, 0xE3, 0x83, 0x84, 0xE3, 0x83, 0x86, 0xE3,
+        0x83, 0x88, 0xE3, 0x83, 0x8A, 0xE3, 0x83, 0x8B, 0xE3, 0x83, 0x8C, 0xE3, 0x83, 0x8D, 0xE3, 0x83,
+        0x8E, 0xE3, 0x83, 0x8F, 0xE3, 0x83, 0x92, 0xE3, 0x83, 0x95, 0xE3, 0x83, 0x98, 0xE3, 0x83, 0x9B,
+        0xE3, 0x83, 0x9E, 0xE3, 0x83, 0x9F, 0xE3, 0x83, 0xA0, 0xE3, 0x83, 0xA1, 0xE3, 0x83, 0xA2, 0xE3,
+        0x83, 0xA4, 0xE3, 0x83, 0xA6, 0xE3, 0x83, 0xA8, 0xE3, 0x83, 0xA9, 0xE3, 0x83, 0xAA, 0xE3, 0x83,
+        0xAB, 0xE3, 0x83, 0xAC, 0xE3, 0x83, 0xAD, 0xE3, 0x83, 0xAF, 0xE3, 0x83, 0xB0, 0xE3, 0x83, 0xB1,
+        0xE3, 0x83, 0xB2, 0xE4, 0xBB, 0xA4, 0xE5, 0x92, 0x8C, 0xE3, 0x82, 0xA2, 0xE3, 0x83, 0x8F, 0xE3,
+        0x82, 0x9A, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0xA2, 0xE3, 0x83, 0xAB, 0xE3, 0x83,
+        0x95, 0xE3, 0x82, 0xA1, 0xE3, 0x82, 0xA2, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x9A,
+        0xE3, 0x82, 0xA2, 0xE3, 0x82, 0xA2, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xAB, 0xE3, 0x82, 0xA4, 0xE3,
+        0x83, 0x8B, 0xE3, 0x83, 0xB3, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xA4, 0xE3, 0x83,
+        0xB3, 0xE3, 0x83, 0x81, 0xE3, 0x82, 0xA6, 0xE3, 0x82, 0xA9, 0xE3, 0x83, 0xB3, 0xE3, 0x82, 0xA8,
+        0xE3, 0x82, 0xB9, 0xE3, 0x82, 0xAF, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0x99, 0xE3,
+        0x82, 0xA8, 0xE3, 0x83, 0xBC, 0xE3, 0x82, 0xAB, 0xE3, 0x83, 0xBC, 0xE3, 0x82, 0xAA, 0xE3, 0x83,
+        0xB3, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0xAA, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xA0, 0xE3, 0x82, 0xAB,
+        0xE3, 0x82, 0xA4, 0xE3, 0x83, 0xAA, 0xE3, 0x82, 0xAB, 0xE3, 0x83, 0xA9, 0xE3, 0x83, 0x83, 0xE3,
+        0x83, 0x88, 0xE3, 0x82, 0xAB, 0xE3, 0x83, 0xAD, 0xE3, 0x83, 0xAA, 0xE3, 0x83, 0xBC, 0xE3, 0x82,
+        0xAB, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xAD, 0xE3, 0x83, 0xB3, 0xE3, 0x82, 0xAB, 0xE3, 0x82, 0x99,
+        0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x9E, 0xE3, 0x82, 0xAD, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xAB, 0xE3,
+        0x82, 0x99, 0xE3, 0x82, 0xAD, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x8B, 0xE3, 0x83, 0xBC, 0xE3, 0x82,
+        0xAD, 0xE3, 0x83, 0xA5, 0xE3, 0x83, 0xAA, 0xE3, 0x83, 0xBC, 0xE3, 0x82, 0xAD, 0xE3, 0x82, 0x99,
+        0xE3, 0x83, 0xAB, 0xE3, 0x82, 0xBF, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xBC, 0xE3, 0x82, 0xAD, 0xE3,
+        0x83, 0xAD, 0xE3, 0x82, 0xAD, 0xE3, 0x83, 0xAD, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x83,
+        0xA9, 0xE3, 0x83, 0xA0, 0xE3, 0x82, 0xAD, 0xE3, 0x83, 0xAD, 0xE3, 0x83, 0xA1, 0xE3, 0x83, 0xBC,
+        0xE3, 0x83, 0x88, 0xE3, 0x83, 0xAB, 0xE3, 0x82, 0xAD, 0xE3, 0x83, 0xAD, 0xE3, 0x83, 0xAF, 0xE3,
+        0x83, 0x83, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xA9, 0xE3, 0x83,
+        0xA0, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xA9, 0xE3, 0x83, 0xA0, 0xE3, 0x83, 0x88,
+        0xE3, 0x83, 0xB3, 0xE3, 0x82, 0xAF, 0xE3, 0x83, 0xAB, 0xE3, 0x82, 0xBB, 0xE3, 0x82, 0x99, 0xE3,
+        0x82, 0xA4, 0xE3, 0x83, 0xAD, 0xE3, 0x82, 0xAF, 0xE3, 0x83, 0xAD, 0xE3, 0x83, 0xBC, 0xE3, 0x83,
+        0x8D, 0xE3, 0x82, 0xB1, 0xE3, 0x83, 0xBC, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0xB3, 0xE3, 0x83, 0xAB,
+        0xE3, 0x83, 0x8A, 0xE3, 0x82, 0xB3, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x9A, 0xE3,
+        0x82, 0xB5, 0xE3, 0x82, 0xA4, 0xE3, 0x82, 0xAF, 0xE3, 0x83, 0xAB, 0xE3, 0x82, 0xB5, 0xE3, 0x83,
+        0xB3, 0xE3, 0x83, 0x81, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xA0, 0xE3, 0x82, 0xB7, 0xE3, 0x83, 0xAA,
+        0xE3, 0x83, 0xB3, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xBB, 0xE3, 0x83, 0xB3, 0xE3,
+        0x83, 0x81, 0xE3, 0x82, 0xBB, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0xBF, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0xBC, 0xE3, 0x82, 0xB9, 0xE3, 0x83, 0x86, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0xB7,
+        0xE3, 0x83, 0x88, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x88, 0xE3, 0x83, 0xB3, 0xE3,
+        0x83, 0x8A, 0xE3, 0x83, 0x8E, 0xE3, 0x83, 0x8E, 0xE3, 0x83, 0x83, 0xE3, 0x83, 0x88, 0xE3, 0x83,
+        0x8F, 0xE3, 0x82, 0xA4, 0xE3, 0x83, 0x84, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0xBC,
+        0xE3, 0x82, 0xBB, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x88, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x9A, 0xE3,
+        0x83, 0xBC, 0xE3, 0x83, 0x84, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xBC, 0xE3, 0x83,
+        0xAC, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x9A, 0xE3, 0x82, 0xA2, 0xE3, 0x82, 0xB9,
+        0xE3, 0x83, 0x88, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x9A, 0xE3, 0x82, 0xAF, 0xE3,
+        0x83, 0xAB, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x9A, 0xE3, 0x82, 0xB3, 0xE3, 0x83, 0x92, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0xA1, 0xE3, 0x83, 0xA9, 0xE3, 0x83, 0x83,
+        0xE3, 0x83, 0x88, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0xA3, 0xE3, 0x83, 0xBC, 0xE3,
+        0x83, 0x88, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x83, 0xE3, 0x82, 0xB7, 0xE3, 0x82,
+        0xA7, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x95, 0xE3, 0x83, 0xA9, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x98,
+        0xE3, 0x82, 0xAF, 0xE3, 0x82, 0xBF, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x98, 0xE3,
+        0x82, 0x9A, 0xE3, 0x82, 0xBD, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0x8B, 0xE3, 0x83,
+        0x92, 0xE3, 0x83, 0x98, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x84, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x9A,
+        0xE3, 0x83, 0xB3, 0xE3, 0x82, 0xB9, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0xBC, 0xE3,
+        0x82, 0xB7, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xBC, 0xE3, 0x82,
+        0xBF, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x9A, 0xE3, 0x82, 0xA4, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x88,
+        0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x88, 0xE3, 0x83, 0x9B, 0xE3,
+        0x83, 0xB3, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x88, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0x9B, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x9B, 0xE3, 0x83, 0xBC,
+        0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x9E, 0xE3, 0x82, 0xA4, 0xE3, 0x82, 0xAF, 0xE3, 0x83, 0xAD, 0xE3,
+        0x83, 0x9E, 0xE3, 0x82, 0xA4, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x9E, 0xE3, 0x83, 0x83, 0xE3, 0x83,
+        0x8F, 0xE3, 0x83, 0x9E, 0xE3, 0x83, 0xAB, 0xE3, 0x82, 0xAF, 0xE3, 0x83, 0x9E, 0xE3, 0x83, 0xB3,
+        0xE3, 0x82, 0xB7, 0xE3, 0x83, 0xA7, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x9F, 0xE3, 0x82, 0xAF, 0xE3,
+        0x83, 0xAD, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x9F, 0xE3, 0x83, 0xAA, 0xE3, 0x83, 0x9F, 0xE3, 0x83,
+        0xAA, 0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0xA1,
+        0xE3, 0x82, 0xAB, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xA1, 0xE3, 0x82, 0xAB, 0xE3, 0x82, 0x99, 0xE3,
+        0x83, 0x88, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0xA1, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0x88, 0xE3, 0x83,
+        0xAB, 0xE3, 0x83, 0xA4, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xA4,
+        0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0xA6, 0xE3, 0x82, 0xA2, 0xE3, 0x83, 0xB3, 0xE3,
+        0x83, 0xAA, 0xE3, 0x83, 0x83, 0xE3, 0x83, 0x88, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0xAA, 0xE3, 0x83,
+        0xA9, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x9A, 0xE3, 0x83, 0xBC, 0xE3, 0x83, 0xAB,
+        0xE3, 0x83, 0xBC, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0x99, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0xAC, 0xE3,
+        0x83, 0xA0, 0xE3, 0x83, 0xAC, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0xB1, 0xE3, 0x82,
+        0x99, 0xE3, 0x83, 0xB3, 0xE3, 0x83, 0xAF, 0xE3, 0x83, 0x83, 0xE3, 0x83, 0x88, 0x30, 0xE7, 0x82,
+        0xB9, 0x31, 0xE7, 0x82, 0xB9, 0x32, 0xE7, 0x82, 0xB9, 0x33, 0xE7, 0x82, 0xB9, 0x34, 0xE7, 0x82,
+        0xB9, 0x35, 0xE7, 0x82, 0xB9, 0x36, 0xE7, 0x82, 0xB9, 0x37, 0xE7, 0x82, 0xB9, 0x38, 0xE7, 0x82,
+        0xB9, 0x39, 0xE7, 0x82, 0xB9, 0x31, 0x30, 0xE7, 0x82, 0xB9, 0x31, 0x31, 0xE7, 0x82, 0xB9, 0x31,
+        0x32, 0xE7, 0x82, 0xB9, 0x31, 0x33, 0xE7, 0x82, 0xB9, 0x31, 0x34, 0xE7, 0x82, 0xB9, 0x31, 0x35,
+        0xE7, 0x82, 0xB9, 0x31, 0x36, 0xE7, 0x82, 0xB9, 0x31, 0x37, 0xE7, 0x82, 0xB9, 0x31, 0x38, 0xE7,
+        0x82, 0xB9, 0x31, 0x39, 0xE7, 0x82, 0xB9, 0x32, 0x30, 0xE7, 0x82, 0xB9, 0x32, 0x31, 0xE7, 0x82,
+        0xB9, 0x32, 0x32, 0xE7, 0x82, 0xB9, 0x32, 0x33, 0xE7, 0x82, 0xB9, 0x32, 0x34, 0xE7, 0x82, 0xB9,
+        0x68, 0x50, 0x61, 0x64, 0x61, 0x41, 0x55, 0x62, 0x61, 0x72, 0x6F, 0x56, 0x70, 0x63, 0x64, 0x6D,
+        0x64, 0x6D, 0x32, 0x64, 0x6D, 0x33, 0x49, 0x55, 0xE5, 0xB9, 0xB3, 0xE6, 0x88, 0x90, 0xE6, 0x98,
+        0xAD, 0xE5, 0x92, 0x8C, 0xE5, 0xA4, 0xA7, 0xE6, 0xAD, 0xA3, 0xE6, 0x98, 0x8E, 0xE6, 0xB2, 0xBB,
+        0xE6, 0xA0, 0xAA, 0xE5, 0xBC, 0x8F, 0xE4, 0xBC, 0x9A, 0xE7, 0xA4, 0xBE, 0x70, 0x41, 0x6E, 0x41,
+        0xCE, 0xBC, 0x41, 0x6D, 0x41, 0x6B, 0x41, 0x4B, 0x42, 0x4D, 0x42, 0x47, 0x42, 0x63, 0x61, 0x6C,
+        0x6B, 0x63, 0x61, 0x6C, 0x70, 0x46, 0x6E, 0x46, 0xCE, 0xBC, 0x46, 0xCE, 0xBC, 0x67, 0x6D, 0x67,
+        0x6B, 0x67, 0x48, 0x7A, 0x6B, 0x48, 0x7A, 0x4D, 0x48, 0x7A, 0x47, 0x48, 0x7A, 0x54, 0x48, 0x7A,
+        0xCE, 0xBC, 0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C, 0x66, 0x6D, 0x6E, 0x6D, 0xCE, 0xBC, 0x6D,
+        0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D, 0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x6D, 0x32, 0x6B, 0x6D,
+        0x32, 0x6D, 0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6D, 0xE2, 0x88, 0x95,
+        0x73, 0x6D, 0xE2, 0x88, 0x95, 0x73, 0x32, 0x50, 0x61, 0x6B, 0x50, 0x61, 0x4D, 0x50, 0x61, 0x47,
+        0x50, 0x61, 0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0xE2, 0x88, 0x95, 0x73, 0x72, 0x61, 0x64, 0xE2,
+        0x88, 0x95, 0x73, 0x32, 0x70, 0x73, 0x6E, 0x73, 0xCE, 0xBC, 0x73, 0x6D, 0x73, 0x70, 0x56, 0x6E,
+        0x56, 0xCE, 0xBC, 0x56, 0x6D, 0x56, 0x6B, 0x56, 0x4D, 0x56, 0x70, 0x57, 0x6E, 0x57, 0xCE, 0xBC,
+        0x57, 0x6D, 0x57, 0x6B, 0x57, 0x4D, 0x57, 0x6B, 0xCE, 0xA9, 0x4D, 0xCE, 0xA9, 0x61, 0x2E, 0x6D,
+        0x2E, 0x42, 0x71, 0x63, 0x63, 0x63, 0x64, 0x43, 0xE2, 0x88, 0x95, 0x6B, 0x67, 0x43, 0x6F, 0x2E,
+        0x64, 0x42, 0x47, 0x79, 0x68, 0x61, 0x48, 0x50, 0x69, 0x6E, 0x4B, 0x4B, 0x4B, 0x4D, 0x6B, 0x74,
+        0x6C, 0x6D, 0x6C, 0x6E, 0x6C, 0x6F, 0x67, 0x6C, 0x78, 0x6D, 0x62, 0x6D, 0x69, 0x6C, 0x6D, 0x6F,
+        0x6C, 0x50, 0x48, 0x70, 0x2E, 0x6D, 0x2E, 0x50, 0x50, 0x4D, 0x50, 0x52, 0x73, 0x72, 0x53, 0x76,
+        0x57, 0x62, 0x56, 0xE2, 0x88, 0x95, 0x6D, 0x41, 0xE2, 0x88, 0x95, 0x6D, 0x31, 0xE6, 0x97, 0xA5,
+        0x32, 0xE6, 0x97, 0xA5, 0x33, 0xE6, 0x97, 0xA5, 0x34, 0xE6, 0x97, 0xA5, 0x35, 0xE6, 0x97, 0xA5,
+        0x36, 0xE6, 0x97, 0xA5, 0x37, 0xE6, 0x97, 0xA5, 0x38, 0xE6, 0x97, 0xA5, 0x39, 0xE6, 0x97, 0xA5,
+        0x31, 0x30, 0xE6, 0x97, 0xA5, 0x31, 0x31, 0xE6, 0x97, 0xA5, 0x31, 0x32, 0xE6, 0x97, 0xA5, 0x31,
+        0x33, 0xE6, 0x97, 0xA5, 0x31, 0x34, 0xE6, 0x97, 0xA5, 0x31, 0x35, 0xE6, 0x97, 0xA5, 0x31, 0x36,
+        0xE6, 0x97, 0xA5, 0x31, 0x37, 0xE6, 0x97, 0xA5, 0x31, 0x38, 0xE6, 0x97, 0xA5, 0x31, 0x39, 0xE6,
+        0x97, 0xA5, 0x32, 0x30, 0xE6, 0x97, 0xA5, 0x32, 0x31, 0xE6, 0x97, 0xA5, 0x32, 0x32, 0xE6, 0x97,
+        0xA5, 0x32, 0x33, 0xE6, 0x97, 0xA5, 0x32, 0x34, 0xE6, 0x97, 0xA5, 0x32, 0x35, 0xE6, 0x97, 0xA5,
+        0x32, 0x36, 0xE6, 0x97, 0xA5, 0x32, 0x37, 0xE6, 0x97, 0xA5, 0x32, 0x38, 0xE6, 0x97, 0xA5, 0x32,
+        0x39, 0xE6, 0x97, 0xA5, 0x33, 0x30, 0xE6, 0x97, 0xA5, 0x33, 0x31, 0xE6, 0x97, 0xA5, 0x67, 0x61,
+        0x6C, 0xD1, 0x8A, 0xD1, 0x8C, 0xEA, 0x9D, 0xAF, 0x43, 0x46, 0x51, 0xC4, 0xA6, 0xC5, 0x93, 0xEA,
+        0x9C, 0xA7, 0xEA, 0xAC, 0xB7, 0xC9, 0xAB, 0xEA, 0xAD, 0x92, 0xCA, 0x8D, 0xE8, 0xB1, 0x88, 0xE8,
+        0xB1, 0x88, 0xE6, 0x9B, 0xB4, 0xE6, 0x9B, 0xB4, 0xE8, 0xBB, 0x8A, 0xE8, 0xBB, 0x8A, 0xE8, 0xB3,
+        0x88, 0xE8, 0xB3, 0x88, 0xE6, 0xBB, 0x91, 0xE6, 0xBB, 0x91, 0xE4, 0xB8, 0xB2, 0xE4, 0xB8, 0xB2,
+        0xE5, 0x8F, 0xA5, 0xE5, 0x8F, 0xA5, 0xE9, 0xBE, 0x9C, 0xE9, 0xBE, 0x9C, 0xE9, 0xBE, 0x9C, 0xE9,
+        0xBE, 0x9C, 0xE5, 0xA5, 0x91, 0xE5, 0xA5, 0x91, 0xE9, 0x87, 0x91, 0xE9, 0x87, 0x91, 0xE5, 0x96,
+        0x87, 0xE5, 0x96, 0x87, 0xE5, 0xA5, 0x88, 0xE5, 0xA5, 0x88, 0xE6, 0x87, 0xB6, 0xE6, 0x87, 0xB6,
+        0xE7, 0x99, 0xA9, 0xE7, 0x99, 0xA9, 0xE7, 0xBE, 0x85, 0xE7, 0xBE, 0x85, 0xE8, 0x98, 0xBF, 0xE8,
+        0x98, 0xBF, 0xE8, 0x9E, 0xBA, 0xE8, 0x9E, 0xBA, 0xE8, 0xA3, 0xB8, 0xE8, 0xA3, 0xB8, 0xE9, 0x82,
+        0x8F, 0xE9, 0x82, 0x8F, 0xE6, 0xA8, 0x82, 0xE6, 0xA8, 0x82, 0xE6, 0xB4, 0x9B, 0xE6, 0xB4, 0x9B,
+        0xE7, 0x83, 0x99, 0xE7, 0x83, 0x99, 0xE7, 0x8F, 0x9E, 0xE7, 0x8F, 0x9E, 0xE8, 0x90, 0xBD, 0xE8,
+        0x90, 0xBD, 0xE9, 0x85, 0xAA, 0xE9, 0x85, 0xAA, 0xE9, 0xA7, 0xB1, 0xE9, 0xA7, 0xB1, 0xE4, 0xBA,
+        0x82, 0xE4, 0xBA, 0x82, 0xE5, 0x8D, 0xB5, 0xE5, 0x8D, 0xB5, 0xE6, 0xAC, 0x84, 0xE6, 0xAC, 0x84,
+        0xE7, 0x88, 0x9B, 0xE7, 0x88, 0x9B, 0xE8, 0x98, 0xAD, 0xE8, 0x98, 0xAD, 0xE9, 0xB8, 0x9E, 0xE9,
+        0xB8, 0x9E, 0xE5, 0xB5, 0x90, 0xE5, 0xB5, 0x90, 0xE6, 0xBF, 0xAB, 0xE6, 0xBF, 0xAB, 0xE8, 0x97,
+        0x8D, 0xE8, 0x97, 0x8D, 0xE8, 0xA5, 0xA4, 0xE8, 0xA5, 0xA4, 0xE6, 0x8B, 0x89, 0xE6, 0x8B, 0x89,
+        0xE8, 0x87, 0x98, 0xE8, 0x87, 0x98, 0xE8, 0xA0, 0x9F, 0xE8, 0xA0, 0x9F, 0xE5, 0xBB, 0x8A, 0xE5,
+        0xBB, 0x8A, 0xE6, 0x9C, 0x97, 0xE6, 0x9C, 0x97, 0xE6, 0xB5, 0xAA, 0xE6, 0xB5, 0xAA, 0xE7, 0x8B,
+        0xBC, 0xE7, 0x8B, 0xBC, 0xE9, 0x83, 0x8E, 0xE9, 0x83, 0x8E, 0xE4, 0xBE, 0x86, 0xE4, 0xBE, 0x86,
+        0xE5, 0x86, 0xB7, 0xE5, 0x86, 0xB7, 0xE5, 0x8B, 0x9E, 0xE5, 0x8B, 0x9E, 0xE6, 0x93, 0x84, 0xE6,
+        0x93, 0x84, 0xE6, 0xAB, 0x93, 0xE6, 0xAB, 0x93, 0xE7, 0x88, 0x90, 0xE7, 0x88, 0x90, 0xE7, 0x9B,
+        0xA7, 0xE7, 0x9B, 0xA7, 0xE8, 0x80, 0x81, 0xE8, 0x80, 0x81, 0xE8, 0x98, 0x86, 0xE8, 0x98, 0x86,
+        0xE8, 0x99, 0x9C, 0xE8, 0x99, 0x9C, 0xE8, 0xB7, 0xAF, 0xE8, 0xB7, 0xAF, 0xE9, 0x9C, 0xB2, 0xE9,
+        0x9C, 0xB2, 0xE9, 0xAD, 0xAF, 0xE9, 0xAD, 0xAF, 0xE9, 0xB7, 0xBA, 0xE9, 0xB7, 0xBA, 0xE7, 0xA2,
+        0x8C, 0xE7, 0xA2, 0x8C, 0xE7, 0xA5, 0xBF, 0xE7, 0xA5, 0xBF, 0xE7, 0xB6, 0xA0, 0xE7, 0xB6, 0xA0,
+        0xE8, 0x8F, 0x89, 0xE8, 0x8F, 0x89, 0xE9, 0x8C, 0x84, 0xE9, 0x8C, 0x84, 0xE9, 0xB9, 0xBF, 0xE9,
+        0xB9, 0xBF, 0xE8, 0xAB, 0x96, 0xE8, 0xAB, 0x96, 0xE5, 0xA3, 0x9F, 0xE5, 0xA3, 0x9F, 0xE5, 0xBC,
+        0x84, 0xE5, 0xBC, 0x84, 0xE7, 0xB1, 0xA0, 0xE7, 0xB1, 0xA0, 0xE8, 0x81, 0xBE, 0xE8, 0x81, 0xBE,
+        0xE7, 0x89, 0xA2, 0xE7, 0x89, 0xA2, 0xE7, 0xA3, 0x8A, 0xE7, 0xA3, 0x8A, 0xE8, 0xB3, 0x82, 0xE8,
+        0xB3, 0x82, 0xE9, 0x9B, 0xB7, 0xE9, 0x9B, 0xB7, 0xE5, 0xA3, 0x98, 0xE5, 0xA3, 0x98, 0xE5, 0xB1,
+        0xA2, 0xE5, 0xB1, 0xA2, 0xE6, 0xA8, 0x93, 0xE6, 0xA8, 0x93, 0xE6, 0xB7, 0x9A, 0xE6, 0xB7, 0x9A,
+        0xE6, 0xBC, 0x8F, 0xE6, 0xBC, 0x8F, 0xE7, 0xB4, 0xAF, 0xE7, 0xB4, 0xAF, 0xE7, 0xB8, 0xB7, 0xE7,
+        0xB8, 0xB7, 0xE9, 0x99, 0x8B, 0xE9, 0x99, 0x8B, 0xE5, 0x8B, 0x92, 0xE5, 0x8B, 0x92, 0xE8, 0x82,
+        0x8B, 0xE8, 0x82, 0x8B, 0xE5, 0x87, 0x9C, 0xE5, 0x87, 0x9C, 0xE5, 0x87, 0x8C, 0xE5, 0x87, 0x8C,
+        0xE7, 0xA8, 0x9C, 0xE7, 0xA8, 0x9C, 0xE7, 0xB6, 0xBE, 0xE7, 0xB6, 0xBE, 0xE8, 0x8F, 0xB1, 0xE8,
+        0x8F, 0xB1, 0xE9, 0x99, 0xB5, 0xE9, 0x99, 0xB5, 0xE8, 0xAE, 0x80, 0xE8, 0xAE, 0x80, 0xE6, 0x8B,
+        0x8F, 0xE6, 0x8B, 0x8F, 0xE6, 0xA8, 0x82, 0xE6, 0xA8, 0x82, 0xE8, 0xAB, 0xBE, 0xE8, 0xAB, 0xBE,
+        0xE4, 0xB8, 0xB9, 0xE4, 0xB8, 0xB9, 0xE5, 0xAF, 0xA7, 0xE5, 0xAF, 0xA7, 0xE6, 0x80, 0x92, 0xE6,
+        0x80, 0x92, 0xE7, 0x8E, 0x87, 0xE7, 0x8E, 0x87, 0xE7, 0x95, 0xB0, 0xE7, 0x95, 0xB0, 0xE5, 0x8C,
+        0x97, 0xE5, 0x8C, 0x97, 0xE7, 0xA3, 0xBB, 0xE7, 0xA3, 0xBB, 0xE4, 0xBE, 0xBF, 0xE4, 0xBE, 0xBF,
+        0xE5, 0xBE, 0xA9, 0xE5, 0xBE, 0xA9, 0xE4, 0xB8, 0x8D, 0xE4, 0xB8, 0x8D, 0xE6, 0xB3, 0x8C, 0xE6,
+        0xB3, 0x8C, 0xE6, 0x95, 0xB8, 0xE6, 0x95, 0xB8, 0xE7, 0xB4, 0xA2, 0xE7, 0xB4, 0xA2, 0xE5, 0x8F,
+        0x83, 0xE5, 0x8F, 0x83, 0xE5, 0xA1, 0x9E, 0xE5, 0xA1, 0x9E, 0xE7, 0x9C, 0x81, 0xE7, 0x9C, 0x81,
+        0xE8, 0x91, 0x89, 0xE8, 0x91, 0x89, 0xE8, 0xAA, 0xAA, 0xE8, 0xAA, 0xAA, 0xE6, 0xAE, 0xBA, 0xE6,
+        0xAE, 0xBA, 0xE8, 0xBE, 0xB0, 0xE8, 0xBE, 0xB0, 0xE6, 0xB2, 0x88, 0xE6, 0xB2, 0x88, 0xE6, 0x8B,
+        0xBE, 0xE6, 0x8B, 0xBE, 0xE8, 0x8B, 0xA5, 0xE8, 0x8B, 0xA5, 0xE6, 0x8E, 0xA0, 0xE6, 0x8E, 0xA0,
+        0xE7, 0x95, 0xA5, 0xE7, 0x95, 0xA5, 0xE4, 0xBA, 0xAE, 0xE4, 0xBA, 0xAE, 0xE5, 0x85, 0xA9, 0xE5,
+        0x85, 0xA9, 0xE5, 0x87, 0x89, 0xE5, 0x87, 0x89, 0xE6, 0xA2, 0x81, 0xE6, 0xA2, 0x81, 0xE7, 0xB3,
+        0xA7, 0xE7, 0xB3, 0xA7, 0xE8, 0x89, 0xAF, 0xE8, 0x89, 0xAF, 0xE8, 0xAB, 0x92, 0xE8, 0xAB, 0x92,
+        0xE9, 0x87, 0x8F, 0xE9, 0x87, 0x8F, 0xE5, 0x8B, 0xB5, 0xE5, 0x8B, 0xB5, 0xE5, 0x91, 0x82, 0xE5,
+        0x91, 0x82, 0xE5, 0xA5, 0xB3, 0xE5, 0xA5, 0xB3, 0xE5, 0xBB, 0xAC, 0xE5, 0xBB, 0xAC, 0xE6, 0x97,
+        0x85, 0xE6, 0x97, 0x85, 0xE6, 0xBF, 0xBE, 0xE6, 0xBF, 0xBE, 0xE7, 0xA4, 0xAA, 0xE7, 0xA4, 0xAA,
+        0xE9, 0x96, 0xAD, 0xE9, 0x96, 0xAD, 0xE9, 0xA9, 0xAA, 0xE9, 0xA9, 0xAA, 0xE9, 0xBA, 0x97, 0xE9,
+        0xBA, 0x97, 0xE9, 0xBB, 0x8E, 0xE9, 0xBB, 0x8E, 0xE5, 0x8A, 0x9B, 0xE5, 0x8A, 0x9B, 0xE6, 0x9B,
+        0x86, 0xE6, 0x9B, 0x86, 0xE6, 0xAD, 0xB7, 0xE6, 0xAD, 0xB7, 0xE8, 0xBD, 0xA2, 0xE8, 0xBD, 0xA2,
+        0xE5, 0xB9, 0xB4, 0xE5, 0xB9, 0xB4, 0xE6, 0x86, 0x90, 0xE6, 0x86, 0x90, 0xE6, 0x88, 0x80, 0xE6,
+        0x88, 0x80, 0xE6, 0x92, 0x9A, 0xE6, 0x92, 0x9A, 0xE6, 0xBC, 0xA3, 0xE6, 0xBC, 0xA3, 0xE7, 0x85,
+        0x89, 0xE7, 0x85, 0x89, 0xE7, 0x92, 0x89, 0xE7, 0x92, 0x89, 0xE7, 0xA7, 0x8A, 0xE7, 0xA7, 0x8A,
+        0xE7, 0xB7, 0xB4, 0xE7, 0xB7, 0xB4, 0xE8, 0x81, 0xAF, 0xE8, 0x81, 0xAF, 0xE8, 0xBC, 0xA6, 0xE8,
+        0xBC, 0xA6, 0xE8, 0x93, 0xAE, 0xE8, 0x93, 0xAE, 0xE9, 0x80, 0xA3, 0xE9, 0x80, 0xA3, 0xE9, 0x8D,
+        0x8A, 0xE9, 0x8D, 0x8A, 0xE5, 0x88, 0x97, 0xE5, 0x88, 0x97, 0xE5, 0x8A, 0xA3, 0xE5, 0x8A, 0xA3,
+        0xE5, 0x92, 0xBD, 0xE5, 0x92, 0xBD, 0xE7, 0x83, 0x88, 0xE7, 0x83, 0x88, 0xE8, 0xA3, 0x82, 0xE8,
+        0xA3, 0x82, 0xE8, 0xAA, 0xAA, 0xE8, 0xAA, 0xAA, 0xE5, 0xBB, 0x89, 0xE5, 0xBB, 0x89, 0xE5, 0xBF,
+        0xB5, 0xE5, 0xBF, 0xB5, 0xE6, 0x8D, 0xBB, 0xE6, 0x8D, 0xBB, 0xE6, 0xAE, 0xAE, 0xE6, 0xAE, 0xAE,
+        0xE7, 0xB0, 0xBE, 0xE7, 0xB0, 0xBE, 0xE7, 0x8D, 0xB5, 0xE7, 0x8D, 0xB5, 0xE4, 0xBB, 0xA4, 0xE4,
+        0xBB, 0xA4, 0xE5, 0x9B, 0xB9, 0xE5, 0x9B, 0xB9, 0xE5, 0xAF, 0xA7, 0xE5, 0xAF, 0xA7, 0xE5, 0xB6,
+        0xBA, 0xE5, 0xB6, 0xBA, 0xE6, 0x80, 0x9C, 0xE6, 0x80, 0x9C, 0xE7, 0x8E, 0xB2, 0xE7, 0x8E, 0xB2,
+        0xE7, 0x91, 0xA9, 0xE7, 0x91, 0xA9, 0xE7, 0xBE, 0x9A, 0xE7, 0xBE, 0x9A, 0xE8, 0x81, 0x86, 0xE8,
+        0x81, 0x86, 0xE9, 0x88, 0xB4, 0xE9, 0x88, 0xB4, 0xE9, 0x9B, 0xB6, 0xE9, 0x9B, 0xB6, 0xE9, 0x9D,
+        0x88, 0xE9, 0x9D, 0x88, 0xE9, 0xA0, 0x98, 0xE9, 0xA0, 0x98, 0xE4, 0xBE, 0x8B, 0xE4, 0xBE, 0x8B,
+        0xE7, 0xA6, 0xAE, 0xE7, 0xA6, 0xAE, 0xE9, 0x86, 0xB4, 0xE9, 0x86, 0xB4, 0xE9, 0x9A, 0xB8, 0xE9,
+        0x9A, 0xB8, 0xE6, 0x83, 0xA1, 0xE6, 0x83, 0xA1, 0xE4, 0xBA, 0x86, 0xE4, 0xBA, 0x86, 0xE5, 0x83,
+        0x9A, 0xE5, 0x83, 0x9A, 0xE5, 0xAF, 0xAE, 0xE5, 0xAF, 0xAE, 0xE5, 0xB0, 0xBF, 0xE5, 0xB0, 0xBF,
+        0xE6, 0x96, 0x99, 0xE6, 0x96, 0x99, 0xE6, 0xA8, 0x82, 0xE6, 0xA8, 0x82, 0xE7, 0x87, 0x8E, 0xE7,
+        0x87, 0x8E, 0xE7, 0x99, 0x82, 0xE7, 0x99, 0x82, 0xE8, 0x93, 0xBC, 0xE8, 0x93, 0xBC, 0xE9, 0x81,
+        0xBC, 0xE9, 0x81, 0xBC, 0xE9, 0xBE, 0x8D, 0xE9, 0xBE, 0x8D, 0xE6, 0x9A, 0x88, 0xE6, 0x9A, 0x88,
+        0xE9, 0x98, 0xAE, 0xE9, 0x98, 0xAE, 0xE5, 0x8A, 0x89, 0xE5, 0x8A, 0x89, 0xE6, 0x9D, 0xBB, 0xE6,
+        0x9D, 0xBB, 0xE6, 0x9F, 0xB3, 0xE6, 0x9F, 0xB3, 0xE6, 0xB5, 0x81, 0xE6, 0xB5, 0x81, 0xE6, 0xBA,
+        0x9C, 0xE6, 0xBA, 0x9C, 0xE7, 0x90, 0x89, 0xE7, 0x90, 0x89, 0xE7, 0x95, 0x99, 0xE7, 0x95, 0x99,
+        0xE7, 0xA1, 0xAB, 0xE7, 0xA1, 0xAB, 0xE7, 0xB4, 0x90, 0xE7, 0xB4, 0x90, 0xE9, 0xA1, 0x9E, 0xE9,
+        0xA1, 0x9E, 0xE5, 0x85, 0xAD, 0xE5, 0x85, 0xAD, 0xE6, 0x88, 0xAE, 0xE6, 0x88, 0xAE, 0xE9, 0x99,
+        0xB8, 0xE9, 0x99, 0xB8, 0xE5, 0x80, 0xAB, 0xE5, 0x80, 0xAB, 0xE5, 0xB4, 0x99, 0xE5, 0xB4, 0x99,
+        0xE6, 0xB7, 0xAA, 0xE6, 0xB7, 0xAA, 0xE8, 0xBC, 0xAA, 0xE8, 0xBC, 0xAA, 0xE5, 0xBE, 0x8B, 0xE5,
+        0xBE, 0x8B, 0xE6, 0x85, 0x84, 0xE6, 0x85, 0x84, 0xE6, 0xA0, 0x97, 0xE6, 0xA0, 0x97, 0xE7, 0x8E,
+        0x87, 0xE7, 0x8E, 0x87, 0xE9, 0x9A, 0x86, 0xE9, 0x9A, 0x86, 0xE5, 0x88, 0xA9, 0xE5, 0x88, 0xA9,
+        0xE5, 0x90, 0x8F, 0xE5, 0x90, 0x8F, 0xE5, 0xB1, 0xA5, 0xE5, 0xB1, 0xA5, 0xE6, 0x98, 0x93, 0xE6,
+        0x98, 0x93, 0xE6, 0x9D, 0x8E, 0xE6, 0x9D, 0x8E, 0xE6, 0xA2, 0xA8, 0xE6, 0xA2, 0xA8, 0xE6, 0xB3,
+        0xA5, 0xE6, 0xB3, 0xA5, 0xE7, 0x90, 0x86, 0xE7, 0x90, 0x86, 0xE7, 0x97, 0xA2, 0xE7, 0x97, 0xA2,
+        0xE7, 0xBD, 0xB9, 0xE7, 0xBD, 0xB9, 0xE8, 0xA3, 0x8F, 0xE8, 0xA3, 0x8F, 0xE8, 0xA3, 0xA1, 0xE8,
+        0xA3, 0xA1, 0xE9, 0x87, 0x8C, 0xE9, 0x87, 0x8C, 0xE9, 0x9B, 0xA2, 0xE9, 0x9B, 0xA2, 0xE5, 0x8C,
+        0xBF, 0xE5, 0x8C, 0xBF, 0xE6, 0xBA, 0xBA, 0xE6, 0xBA, 0xBA, 0xE5, 0x90, 0x9D, 0xE5, 0x90, 0x9D,
+        0xE7, 0x87, 0x90, 0xE7, 0x87, 0x90, 0xE7, 0x92, 0x98, 0xE7, 0x92, 0x98, 0xE8, 0x97, 0xBA, 0xE8,
+        0x97, 0xBA, 0xE9, 0x9A, 0xA3, 0xE9, 0x9A, 0xA3, 0xE9, 0xB1, 0x97, 0xE9, 0xB1, 0x97, 0xE9, 0xBA,
+        0x9F, 0xE9, 0xBA, 0x9F, 0xE6, 0x9E, 0x97, 0xE6, 0x9E, 0x97, 0xE6, 0xB7, 0x8B, 0xE6, 0xB7, 0x8B,
+        0xE8, 0x87, 0xA8, 0xE8, 0x87, 0xA8, 0xE7, 0xAB, 0x8B, 0xE7, 0xAB, 0x8B, 0xE7, 0xAC, 0xA0, 0xE7,
+        0xAC, 0xA0, 0xE7, 0xB2, 0x92, 0xE7, 0xB2, 0x92, 0xE7, 0x8B, 0x80, 0xE7, 0x8B, 0x80, 0xE7, 0x82,
+        0x99, 0xE7, 0x82, 0x99, 0xE8, 0xAD, 0x98, 0xE8, 0xAD, 0x98, 0xE4, 0xBB, 0x80, 0xE4, 0xBB, 0x80,
+        0xE8, 0x8C, 0xB6, 0xE8, 0x8C, 0xB6, 0xE5, 0x88, 0xBA, 0xE5, 0x88, 0xBA, 0xE5, 0x88, 0x87, 0xE5,
+        0x88, 0x87, 0xE5, 0xBA, 0xA6, 0xE5, 0xBA, 0xA6, 0xE6, 0x8B, 0x93, 0xE6, 0x8B, 0x93, 0xE7, 0xB3,
+        0x96, 0xE7, 0xB3, 0x96, 0xE5, 0xAE, 0x85, 0xE5, 0xAE, 0x85, 0xE6, 0xB4, 0x9E, 0xE6, 0xB4, 0x9E,
+        0xE6, 0x9A, 0xB4, 0xE6, 0x9A, 0xB4, 0xE8, 0xBC, 0xBB, 0xE8, 0xBC, 0xBB, 0xE8, 0xA1, 0x8C, 0xE8,
+        0xA1, 0x8C, 0xE9, 0x99, 0x8D, 0xE9, 0x99, 0x8D, 0xE8, 0xA6, 0x8B, 0xE8, 0xA6, 0x8B, 0xE5, 0xBB,
+        0x93, 0xE5, 0xBB, 0x93, 0xE5, 0x85, 0x80, 0xE5, 0x85, 0x80, 0xE5, 0x97, 0x80, 0xE5, 0x97, 0x80,
+        0xE5, 0xA1, 0x9A, 0xE5, 0xA1, 0x9A, 0xE6, 0x99, 0xB4, 0xE6, 0x99, 0xB4, 0xE5, 0x87, 0x9E, 0xE5,
+        0x87, 0x9E, 0xE7, 0x8C, 0xAA, 0xE7, 0x8C, 0xAA, 0xE7, 0x9B, 0x8A, 0xE7, 0x9B, 0x8A, 0xE7, 0xA4,
+        0xBC, 0xE7, 0xA4, 0xBC, 0xE7, 0xA5, 0x9E, 0xE7, 0xA5, 0x9E, 0xE7, 0xA5, 0xA5, 0xE7, 0xA5, 0xA5,
+        0xE7, 0xA6, 0x8F, 0xE7, 0xA6, 0x8F, 0xE9, 0x9D, 0x96, 0xE9, 0x9D, 0x96, 0xE7, 0xB2, 0xBE, 0xE7,
+        0xB2, 0xBE, 0xE7, 0xBE, 0xBD, 0xE7, 0xBE, 0xBD, 0xE8, 0x98, 0x92, 0xE8, 0x98, 0x92, 0xE8, 0xAB,
+        0xB8, 0xE8, 0xAB, 0xB8, 0xE9, 0x80, 0xB8, 0xE9, 0x80, 0xB8, 0xE9, 0x83, 0xBD, 0xE9, 0x83, 0xBD,
+        0xE9, 0xA3, 0xAF, 0xE9, 0xA3, 0xAF, 0xE9, 0xA3, 0xBC, 0xE9, 0xA3, 0xBC, 0xE9, 0xA4, 0xA8, 0xE9,
+        0xA4, 0xA8, 0xE9, 0xB6, 0xB4, 0xE9, 0xB6, 0xB4, 0xE9, 0x83, 0x9E, 0xE9, 0x83, 0x9E, 0xE9, 0x9A,
+        0xB7, 0xE9, 0x9A, 0xB7, 0xE4, 0xBE, 0xAE, 0xE4, 0xBE, 0xAE, 0xE5, 0x83, 0xA7, 0xE5, 0x83, 0xA7,
+        0xE5, 0x85, 0x8D, 0xE5, 0x85, 0x8D, 0xE5, 0x8B, 0x89, 0xE5, 0x8B, 0x89, 0xE5, 0x8B, 0xA4, 0xE5,
+        0x8B, 0xA4, 0xE5, 0x8D, 0x91, 0xE5, 0x8D, 0x91, 0xE5, 0x96, 0x9D, 0xE5, 0x96, 0x9D, 0xE5, 0x98,
+        0x86, 0xE5, 0x98, 0x86, 0xE5, 0x99, 0xA8, 0xE5, 0x99, 0xA8, 0xE5, 0xA1, 0x80, 0xE5, 0xA1, 0x80,
+        0xE5, 0xA2, 0xA8, 0xE5, 0xA2, 0xA8, 0xE5, 0xB1, 0xA4, 0xE5, 0xB1, 0xA4, 0xE5, 0xB1, 0xAE, 0xE5,
+        0xB1, 0xAE, 0xE6, 0x82, 0x94, 0xE6, 0x82, 0x94, 0xE6, 0x85, 0xA8, 0xE6, 0x85, 0xA8, 0xE6, 0x86,
+        0x8E, 0xE6, 0x86, 0x8E, 0xE6, 0x87, 0xB2, 0xE6, 0x87, 0xB2, 0xE6, 0x95, 0x8F, 0xE6, 0x95, 0x8F,
+        0xE6, 0x97, 0xA2, 0xE6, 0x97, 0xA2, 0xE6, 0x9A, 0x91, 0xE6, 0x9A, 0x91, 0xE6, 0xA2, 0x85, 0xE6,
+        0xA2, 0x85, 0xE6, 0xB5, 0xB7, 0xE6, 0xB5, 0xB7, 0xE6, 0xB8, 0x9A, 0xE6, 0xB8, 0x9A, 0xE6, 0xBC,
+        0xA2, 0xE6, 0xBC, 0xA2, 0xE7, 0x85, 0xAE, 0xE7, 0x85, 0xAE, 0xE7, 0x88, 0xAB, 0xE7, 0x88, 0xAB,
+        0xE7, 0x90, 0xA2, 0xE7, 0x90, 0xA2, 0xE7, 0xA2, 0x91, 0xE7, 0xA2, 0x91, 0xE7, 0xA4, 0xBE, 0xE7,
+        0xA4, 0xBE, 0xE7, 0xA5, 0x89, 0xE7, 0xA5, 0x89, 0xE7, 0xA5, 0x88, 0xE7, 0xA5, 0x88, 0xE7, 0xA5,
+        0x90, 0xE7, 0xA5, 0x90, 0xE7, 0xA5, 0x96, 0xE7, 0xA5, 0x96, 0xE7, 0xA5, 0x9D, 0xE7, 0xA5, 0x9D,
+        0xE7, 0xA6, 0x8D, 0xE7, 0xA6, 0x8D, 0xE7, 0xA6, 0x8E, 0xE7, 0xA6, 0x8E, 0xE7, 0xA9, 0x80, 0xE7,
+        0xA9, 0x80, 0xE7, 0xAA, 0x81, 0xE7, 0xAA, 0x81, 0xE7, 0xAF, 0x80, 0xE7, 0xAF, 0x80, 0xE7, 0xB7,
+        0xB4, 0xE7, 0xB7, 0xB4, 0xE7, 0xB8, 0x89, 0xE7, 0xB8, 0x89, 0xE7, 0xB9, 0x81, 0xE7, 0xB9, 0x81,
+        0xE7, 0xBD, 0xB2, 0xE7, 0xBD, 0xB2, 0xE8, 0x80, 0x85, 0xE8, 0x80, 0x85, 0xE8, 0x87, 0xAD, 0xE8,
+        0x87, 0xAD, 0xE8, 0x89, 0xB9, 0xE8, 0x89, 0xB9, 0xE8, 0x89, 0xB9, 0xE8, 0x89, 0xB9, 0xE8, 0x91,
+        0x97, 0xE8, 0x91, 0x97, 0xE8, 0xA4, 0x90, 0xE8, 0xA4, 0x90, 0xE8, 0xA6, 0x96, 0xE8, 0xA6, 0x96,
+        0xE8, 0xAC, 0x81, 0xE8, 0xAC, 0x81, 0xE8, 0xAC, 0xB9, 0xE8, 0xAC, 0xB9, 0xE8, 0xB3, 0x93, 0xE8,
+        0xB3, 0x93, 0xE8, 0xB4, 0x88, 0xE8, 0xB4, 0x88, 0xE8, 0xBE, 0xB6, 0xE8, 0xBE, 0xB6, 0xE9, 0x80,
+        0xB8, 0xE9, 0x80, 0xB8, 0xE9, 0x9B, 0xA3, 0xE9, 0x9B, 0xA3, 0xE9, 0x9F, 0xBF, 0xE9, 0x9F, 0xBF,
+        0xE9, 0xA0, 0xBB, 0xE9, 0xA0, 0xBB, 0xE6, 0x81, 0xB5, 0xE6, 0x81, 0xB5, 0xF0, 0xA4, 0x8B, 0xAE,
+        0xF0, 0xA4, 0x8B, 0xAE, 0xE8, 0x88, 0x98, 0xE8, 0x88, 0x98, 0xE4, 0xB8, 0xA6, 0xE4, 0xB8, 0xA6,
+        0xE5, 0x86, 0xB5, 0xE5, 0x86, 0xB5, 0xE5, 0x85, 0xA8, 0xE5, 0x85, 0xA8, 0xE4, 0xBE, 0x80, 0xE4,
+        0xBE, 0x80, 0xE5, 0x85, 0x85, 0xE5, 0x85, 0x85, 0xE5, 0x86, 0x80, 0xE5, 0x86, 0x80, 0xE5, 0x8B,
+        0x87, 0xE5, 0x8B, 0x87, 0xE5, 0x8B, 0xBA, 0xE5, 0x8B, 0xBA, 0xE5, 0x96, 0x9D, 0xE5, 0x96, 0x9D,
+        0xE5, 0x95, 0x95, 0xE5, 0x95, 0x95, 0xE5, 0x96, 0x99, 0xE5, 0x96, 0x99, 0xE5, 0x97, 0xA2, 0xE5,
+        0x97, 0xA2, 0xE5, 0xA1, 0x9A, 0xE5, 0xA1, 0x9A, 0xE5, 0xA2, 0xB3, 0xE5, 0xA2, 0xB3, 0xE5, 0xA5,
+        0x84, 0xE5, 0xA5, 0x84, 0xE5, 0xA5, 0x94, 0xE5, 0xA5, 0x94, 0xE5, 0xA9, 0xA2, 0xE5, 0xA9, 0xA2,
+        0xE5, 0xAC, 0xA8, 0xE5, 0xAC, 0xA8, 0xE5, 0xBB, 0x92, 0xE5, 0xBB, 0x92, 0xE5, 0xBB, 0x99, 0xE5,
+        0xBB, 0x99, 0xE5, 0xBD, 0xA9, 0xE5, 0xBD, 0xA9, 0xE5, 0xBE, 0xAD, 0xE5, 0xBE, 0xAD, 0xE6, 0x83,
+        0x98, 0xE6, 0x83, 0x98, 0xE6, 0x85, 0x8E, 0xE6, 0x85, 0x8E, 0xE6, 0x84, 0x88, 0xE6, 0x84, 0x88,
+        0xE6, 0x86, 0x8E, 0xE6, 0x86, 0x8E, 0xE6, 0x85, 0xA0, 0xE6, 0x85, 0xA0, 0xE6, 0x87, 0xB2, 0xE6,
+        0x87, 0xB2, 0xE6, 0x88, 0xB4, 0xE6, 0x88, 0xB4, 0xE6, 0x8F, 0x84, 0xE6, 0x8F, 0x84, 0xE6, 0x90,
+        0x9C, 0xE6, 0x90, 0x9C, 0xE6, 0x91, 0x92, 0xE6, 0x91, 0x92, 0xE6, 0x95, 0x96, 0xE6, 0x95, 0x96,
+        0xE6, 0x99, 0xB4, 0xE6, 0x99, 0xB4, 0xE6, 0x9C, 0x97, 0xE6, 0x9C, 0x97, 0xE6, 0x9C, 0x9B, 0xE6,
+        0x9C, 0x9B, 0xE6, 0x9D, 0x96, 0xE6, 0x9D, 0x96, 0xE6, 0xAD, 0xB9, 0xE6, 0xAD, 0xB9, 0xE6, 0xAE,
+        0xBA, 0xE6, 0xAE, 0xBA, 0xE6, 0xB5, 0x81, 0xE6, 0xB5, 0x81, 0xE6, 0xBB, 0x9B, 0xE6, 0xBB, 0x9B,
+        0xE6, 0xBB, 0x8B, 0xE6, 0xBB, 0x8B, 0xE6, 0xBC, 0xA2, 0xE6, 0xBC, 0xA2, 0xE7, 0x80, 0x9E, 0xE7,
+        0x80, 0x9E, 0xE7, 0x85, 0xAE, 0xE7, 0x85, 0xAE, 0xE7, 0x9E, 0xA7, 0xE7, 0x9E, 0xA7, 0xE7, 0x88,
+        0xB5, 0xE7, 0x88, 0xB5, 0xE7, 0x8A, 0xAF, 0xE7, 0x8A, 0xAF, 0xE7, 0x8C, 0xAA, 0xE7, 0x8C, 0xAA,
+        0xE7, 0x91, 0xB1, 0xE7, 0x91, 0xB1, 0xE7, 0x94, 0x86, 0xE7, 0x94, 0x86, 0xE7, 0x94, 0xBB, 0xE7,
+        0x94, 0xBB, 0xE7, 0x98, 0x9D, 0xE7, 0x98, 0x9D, 0xE7, 0x98, 0x9F, 0xE7, 0x98, 0x9F, 0xE7, 0x9B,
+        0x8A, 0xE7, 0x9B, 0x8A, 0xE7, 0x9B, 0x9B, 0xE7, 0x9B, 0x9B, 0xE7, 0x9B, 0xB4, 0xE7, 0x9B, 0xB4,
+        0xE7, 0x9D, 0x8A, 0xE7, 0x9D, 0x8A, 0xE7, 0x9D, 0x80, 0xE7, 0x9D, 0x80, 0xE7, 0xA3, 0x8C, 0xE7,
+        0xA3, 0x8C, 0xE7, 0xAA, 0xB1, 0xE7, 0xAA, 0xB1, 0xE7, 0xAF, 0x80, 0xE7, 0xAF, 0x80, 0xE7, 0xB1,
+        0xBB, 0xE7, 0xB1, 0xBB, 0xE7, 0xB5, 0x9B, 0xE7, 0xB5, 0x9B, 0xE7, 0xB7, 0xB4, 0xE7, 0xB7, 0xB4,
+        0xE7, 0xBC, 0xBE, 0xE7, 0xBC, 0xBE, 0xE8, 0x80, 0x85, 0xE8, 0x80, 0x85, 0xE8, 0x8D, 0x92, 0xE8,
+        0x8D, 0x92, 0xE8, 0x8F, 0xAF, 0xE8, 0x8F, 0xAF, 0xE8, 0x9D, 0xB9, 0xE8, 0x9D, 0xB9, 0xE8, 0xA5,
+        0x81, 0xE8, 0xA5, 0x81, 0xE8, 0xA6, 0x86, 0xE8, 0xA6, 0x86, 0xE8, 0xA6, 0x96, 0xE8, 0xA6, 0x96,
+        0xE8, 0xAA, 0xBF, 0xE8, 0xAA, 0xBF, 0xE8, 0xAB, 0xB8, 0xE8, 0xAB, 0xB8, 0xE8, 0xAB, 0x8B, 0xE8,
+        0xAB, 0x8B, 0xE8, 0xAC, 0x81, 0xE8, 0xAC, 0x81, 0xE8, 0xAB, 0xBE, 0xE8, 0xAB, 0xBE, 0xE8, 0xAB,
+        0xAD, 0xE8, 0xAB, 0xAD, 0xE8, 0xAC, 0xB9, 0xE8, 0xAC, 0xB9, 0xE8, 0xAE, 0x8A, 0xE8, 0xAE, 0x8A,
+        0xE8, 0xB4, 0x88, 0xE8, 0xB4, 0x88, 0xE8, 0xBC, 0xB8, 0xE8, 0xBC, 0xB8, 0xE9, 0x81, 0xB2, 0xE9,
+        0x81, 0xB2, 0xE9, 0x86, 0x99, 0xE9, 0x86, 0x99, 0xE9, 0x89, 0xB6, 0xE9, 0x89, 0xB6, 0xE9, 0x99,
+        0xBC, 0xE9, 0x99, 0xBC, 0xE9, 0x9B, 0xA3, 0xE9, 0x9B, 0xA3, 0xE9, 0x9D, 0x96, 0xE9, 0x9D, 0x96,
+        0xE9, 0x9F, 0x9B, 0xE9, 0x9F, 0x9B, 0xE9, 0x9F, 0xBF, 0xE9, 0x9F, 0xBF, 0xE9, 0xA0, 0x8B, 0xE9,
+        0xA0, 0x8B, 0xE9, 0xA0, 0xBB, 0xE9, 0xA0, 0xBB, 0xE9, 0xAC, 0x92, 0xE9, 0xAC, 0x92, 0xE9, 0xBE,
+        0x9C, 0xE9, 0xBE, 0x9C, 0xF0, 0xA2, 0xA1, 0x8A, 0xF0, 0xA2, 0xA1, 0x8A, 0xF0, 0xA2, 0xA1, 0x84,
+        0xF0, 0xA2, 0xA1, 0x84, 0xF0, 0xA3, 0x8F, 0x95, 0xF0, 0xA3, 0x8F, 0x95, 0xE3, 0xAE, 0x9D, 0xE3,
+        0xAE, 0x9D, 0xE4, 0x80, 0x98, 0xE4, 0x80, 0x98, 0xE4, 0x80, 0xB9, 0xE4, 0x80, 0xB9, 0xF0, 0xA5,
+        0x89, 0x89, 0xF0, 0xA5, 0x89, 0x89, 0xF0, 0xA5, 0xB3, 0x90, 0xF0, 0xA5, 0xB3, 0x90, 0xF0, 0xA7,
+        0xBB, 0x93, 0xF0, 0xA7, 0xBB, 0x93, 0xE9, 0xBD, 0x83, 0xE9, 0xBD, 0x83, 0xE9, 0xBE, 0x8E, 0xE9,
+        0xBE, 0x8E, 0x66, 0x66, 0x66, 0x69, 0x66, 0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x73, 0x74,
+        0x73, 0x74, 0xD5, 0xB4, 0xD5, 0xB6, 0xD5, 0xB4, 0xD5, 0xA5, 0xD5, 0xB4, 0xD5, 0xAB, 0xD5, 0xBE,
+        0xD5, 0xB6, 0xD5, 0xB4, 0xD5, 0xAD, 0xD7, 0x99, 0xD6, 0xB4, 0xD7, 0x99, 0xD6, 0xB4, 0xD7, 0xB2,
+        0xD6, 0xB7, 0xD7, 0xB2, 0xD6, 0xB7, 0xD7, 0xA2, 0xD7, 0x90, 0xD7, 0x93, 0xD7, 0x94, 0xD7, 0x9B,
+        0xD7, 0x9C, 0xD7, 0x9D, 0xD7, 0xA8, 0xD7, 0xAA, 0x2B, 0xD7, 0xA9, 0xD7, 0x81, 0xD7, 0xA9, 0xD7,
+        0x81, 0xD7, 0xA9, 0xD7, 0x82, 0xD7, 0xA9, 0xD7, 0x82, 0xD7, 0xA9, 0xD6, 0xBC, 0xD7, 0x81, 0xD7,
+        0xA9, 0xD6, 0xBC, 0xD7, 0x81, 0xD7, 0xA9, 0xD6, 0xBC, 0xD7, 0x82, 0xD7, 0xA9, 0xD6, 0xBC, 0xD7,
+        0x82, 0xD7, 0x90, 0xD6, 0xB7, 0xD7, 0x90, 0xD6, 0xB7, 0xD7, 0x90, 0xD6, 0xB8, 0xD7, 0x90, 0xD6,
+        0xB8, 0xD7, 0x90, 0xD6, 0xBC, 0xD7, 0x90, 0xD6, 0xBC, 0xD7, 0x91, 0xD6, 0xBC, 0xD7, 0x91, 0xD6,
+        0xBC, 0xD7, 0x92, 0xD6, 0xBC, 0xD7, 0x92, 0xD6, 0xBC, 0xD7, 0x93, 0xD6, 0xBC, 0xD7, 0x93, 0xD6,
+        0xBC, 0xD7, 0x94, 0xD6, 0xBC, 0xD7, 0x94, 0xD6, 0xBC, 0xD7, 0x95, 0xD6, 0xBC, 0xD7, 0x95, 0xD6,
+        0xBC, 0xD7, 0x96, 0xD6, 0xBC, 0xD7, 0x96, 0xD6, 0xBC, 0xD7, 0x98, 0xD6, 0xBC, 0xD7, 0x98, 0xD6,
+        0xBC, 0xD7, 0x99, 0xD6, 0xBC, 0xD7, 0x99, 0xD6, 0xBC, 0xD7, 0x9A, 0xD6, 0xBC, 0xD7, 0x9A, 0xD6,
+        0xBC, 0xD7, 0x9B, 0xD6, 0xBC, 0xD7, 0x9B, 0xD6, 0xBC, 0xD7, 0x9C, 0xD6, 0xBC, 0xD7, 0x9C, 0xD6,
+        0xBC, 0xD7, 0x9E, 0xD6, 0xBC, 0xD7, 0x9E, 0xD6, 0xBC, 0xD7, 0xA0, 0xD6, 0xBC, 0xD7, 0xA0, 0xD6,
+        0xBC, 0xD7, 0xA1, 0xD6, 0xBC, 0xD7, 0xA1, 0xD6, 0xBC, 0xD7, 0xA3, 0xD6, 0xBC, 0xD7, 0xA3, 0xD6,
+        0xBC, 0xD7, 0xA4, 0xD6, 0xBC, 0xD7, 0xA4, 0xD6, 0xBC, 0xD7, 0xA6, 0xD6, 0xBC, 0xD7, 0xA6, 0xD6,
+        0xBC, 0xD7, 0xA7, 0xD6, 0xBC, 0xD7, 0xA7, 0xD6, 0xBC, 0xD7, 0xA8, 0xD6, 0xBC, 0xD7, 0xA8, 0xD6,
+        0xBC, 0xD7, 0xA9, 0xD6, 0xBC, 0xD7, 0xA9, 0xD6, 0xBC, 0xD7, 0xAA, 0xD6, 0xBC, 0xD7, 0xAA, 0xD6,
+        0xBC, 0xD7, 0x95, 0xD6, 0xB9, 0xD7, 0x95, 0xD6, 0xB9, 0xD7, 0x91, 0xD6, 0xBF, 0xD7, 0x91, 0xD6,
+        0xBF, 0xD7, 0x9B, 0xD6, 0xBF, 0xD7, 0x9B, 0xD6, 0xBF, 0xD7, 0xA4, 0xD6, 0xBF, 0xD7, 0xA4, 0xD6,
+        0xBF, 0xD7, 0x90, 0xD7, 0x9C, 0xD9, 0xB1, 0xD9, 0xB1, 0xD9, 0xBB, 0xD9, 0xBB, 0xD9, 0xBB, 0xD9,
+        0xBB, 0xD9, 0xBE, 0xD9, 0xBE, 0xD9, 0xBE, 0xD9, 0xBE, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA,
+        0x80, 0xD9, 0xBA, 0xD9, 0xBA, 0xD9, 0xBA, 0xD9, 0xBA, 0xD9, 0xBF, 0xD9, 0xBF, 0xD9, 0xBF, 0xD9,
+        0xBF, 0xD9, 0xB9, 0xD9, 0xB9, 0xD9, 0xB9, 0xD9, 0xB9, 0xDA, 0xA4, 0xDA, 0xA4, 0xDA, 0xA4, 0xDA,
+        0xA4, 0xDA, 0xA6, 0xDA, 0xA6, 0xDA, 0xA6, 0xDA, 0xA6, 0xDA, 0x84, 0xDA, 0x84, 0xDA, 0x84, 0xDA,
+        0x84, 0xDA, 0x83, 0xDA, 0x83, 0xDA, 0x83, 0xDA, 0x83, 0xDA, 0x86, 0xDA, 0x86, 0xDA, 0x86, 0xDA,
+        0x86, 0xDA, 0x87, 0xDA, 0x87, 0xDA, 0x87, 0xDA, 0x87, 0xDA, 0x8D, 0xDA, 0x8D, 0xDA, 0x8C, 0xDA,
+        0x8C, 0xDA, 0x8E, 0xDA, 0x8E, 0xDA, 0x88, 0xDA, 0x88, 0xDA, 0x98, 0xDA, 0x98, 0xDA, 0x91, 0xDA,
+        0x91, 0xDA, 0xA9, 0xDA, 0xA9, 0xDA, 0xA9, 0xDA, 0xA9, 0xDA, 0xAF, 0xDA, 0xAF, 0xDA, 0xAF, 0xDA,
+        0xAF, 0xDA, 0xB3, 0xDA, 0xB3, 0xDA, 0xB3, 0xDA, 0xB3, 0xDA, 0xB1, 0xDA, 0xB1, 0xDA, 0xB1, 0xDA,
+        0xB1, 0xDA, 0xBA, 0xDA, 0xBA, 0xDA, 0xBB, 0xDA, 0xBB, 0xDA, 0xBB, 0xDA, 0xBB, 0xDB, 0x95, 0xD9,
+        0x94, 0xDB, 0x95, 0xD9, 0x94, 0xDB, 0x81, 0xDB, 0x81, 0xDB, 0x81, 0xDB, 0x81, 0xDA, 0xBE, 0xDA,
+        0xBE, 0xDA, 0xBE, 0xDA, 0xBE, 0xDB, 0x92, 0xDB, 0x92, 0xDB, 0x92, 0xD9, 0x94, 0xDB, 0x92, 0xD9,
+        0x94, 0xDA, 0xAD, 0xDA, 0xAD, 0xDA, 0xAD, 0xDA, 0xAD, 0xDB, 0x87, 0xDB, 0x87, 0xDB, 0x86, 0xDB,
+        0x86, 0xDB, 0x88, 0xDB, 0x88, 0xDB, 0x87, 0xD9, 0xB4, 0xDB, 0x8B, 0xDB, 0x8B, 0xDB, 0x85, 0xDB,
+        0x85, 0xDB, 0x89, 0xDB, 0x89, 0xDB, 0x90, 0xDB, 0x90, 0xDB, 0x90, 0xDB, 0x90, 0xD9, 0x89, 0xD9,
+        0x89, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xA7, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xA7, 0xD9, 0x8A, 0xD9,
+        0x94, 0xDB, 0x95, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x95, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x88, 0xD9,
+        0x8A, 0xD9, 0x94, 0xD9, 0x88, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x87, 0xD9, 0x8A, 0xD9, 0x94, 0xDB,
+        0x87, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x86, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x86, 0xD9, 0x8A, 0xD9,
+        0x94, 0xDB, 0x88, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x88, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x90, 0xD9,
+        0x8A, 0xD9, 0x94, 0xDB, 0x90, 0xD9, 0x8A, 0xD9, 0x94, 0xDB, 0x90, 0xD9, 0x8A, 0xD9, 0x94, 0xD9,
+        0x89, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x89, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x89, 0xDB, 0x8C, 0xDB,
+        0x8C, 0xDB, 0x8C, 0xDB, 0x8C, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xAC, 0xD9, 0x8A, 0xD9, 0x94, 0xD8,
+        0xAD, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x89, 0xD9, 0x8A, 0xD9,
+        0x94, 0xD9, 0x8A, 0xD8, 0xA8, 0xD8, 0xAC, 0xD8, 0xA8, 0xD8, 0xAD, 0xD8, 0xA8, 0xD8, 0xAE, 0xD8,
+        0xA8, 0xD9, 0x85, 0xD8, 0xA8, 0xD9, 0x89, 0xD8, 0xA8, 0xD9, 0x8A, 0xD8, 0xAA, 0xD8, 0xAC, 0xD8,
+        0xAA, 0xD8, 0xAD, 0xD8, 0xAA, 0xD8, 0xAE, 0xD8, 0xAA, 0xD9, 0x85, 0xD8, 0xAA, 0xD9, 0x89, 0xD8,
+        0xAA, 0xD9, 0x8A, 0xD8, 0xAB, 0xD8, 0xAC, 0xD8, 0xAB, 0xD9, 0x85, 0xD8, 0xAB, 0xD9, 0x89, 0xD8,
+        0xAB, 0xD9, 0x8A, 0xD8, 0xAC, 0xD8, 0xAD, 0xD8, 0xAC, 0xD9, 0x85, 0xD8, 0xAD, 0xD8, 0xAC, 0xD8,
+        0xAD, 0xD9, 0x85, 0xD8, 0xAE, 0xD8, 0xAC, 0xD8, 0xAE, 0xD8, 0xAD, 0xD8, 0xAE, 0xD9, 0x85, 0xD8,
+        0xB3, 0xD8, 0xAC, 0xD8, 0xB3, 0xD8, 0xAD, 0xD8, 0xB3, 0xD8, 0xAE, 0xD8, 0xB3, 0xD9, 0x85, 0xD8,
+        0xB5, 0xD8, 0xAD, 0xD8, 0xB5, 0xD9, 0x85, 0xD8, 0xB6, 0xD8, 0xAC, 0xD8, 0xB6, 0xD8, 0xAD, 0xD8,
+        0xB6, 0xD8, 0xAE, 0xD8, 0xB6, 0xD9, 0x85, 0xD8, 0xB7, 0xD8, 0xAD, 0xD8, 0xB7, 0xD9, 0x85, 0xD8,
+        0xB8, 0xD9, 0x85, 0xD8, 0xB9, 0xD8, 0xAC, 0xD8, 0xB9, 0xD9, 0x85, 0xD8, 0xBA, 0xD8, 0xAC, 0xD8,
+        0xBA, 0xD9, 0x85, 0xD9, 0x81, 0xD8, 0xAC, 0xD9, 0x81, 0xD8, 0xAD, 0xD9, 0x81, 0xD8, 0xAE, 0xD9,
+        0x81, 0xD9, 0x85, 0xD9, 0x81, 0xD9, 0x89, 0xD9, 0x81, 0xD9, 0x8A, 0xD9, 0x82, 0xD8, 0xAD, 0xD9,
+        0x82, 0xD9, 0x85, 0xD9, 0x82, 0xD9, 0x89, 0xD9, 0x82, 0xD9, 0x8A, 0xD9, 0x83, 0xD8, 0xA7, 0xD9,
+        0x83, 0xD8, 0xAC, 0xD9, 0x83, 0xD8, 0xAD, 0xD9, 0x83, 0xD8, 0xAE, 0xD9, 0x83, 0xD9, 0x84, 0xD9,
+        0x83, 0xD9, 0x85, 0xD9, 0x83, 0xD9, 0x89, 0xD9, 0x83, 0xD9, 0x8A, 0xD9, 0x84, 0xD8, 0xAC, 0xD9,
+        0x84, 0xD8, 0xAD, 0xD9, 0x84, 0xD8, 0xAE, 0xD9, 0x84, 0xD9, 0x85, 0xD9, 0x84, 0xD9, 0x89, 0xD9,
+        0x84, 0xD9, 0x8A, 0xD9, 0x85, 0xD8, 0xAC, 0xD9, 0x85, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAE, 0xD9,
+        0x85, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x89, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x86, 0xD8, 0xAC, 0xD9,
+        0x86, 0xD8, 0xAD, 0xD9, 0x86, 0xD8, 0xAE, 0xD9, 0x86, 0xD9, 0x85, 0xD9, 0x86, 0xD9, 0x89, 0xD9,
+        0x86, 0xD9, 0x8A, 0xD9, 0x87, 0xD8, 0xAC, 0xD9, 0x87, 0xD9, 0x85, 0xD9, 0x87, 0xD9, 0x89, 0xD9,
+        0x87, 0xD9, 0x8A, 0xD9, 0x8A, 0xD8, 0xAC, 0xD9, 0x8A, 0xD8, 0xAD, 0xD9, 0x8A, 0xD8, 0xAE, 0xD9,
+        0x8A, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x89, 0xD9, 0x8A, 0xD9, 0x8A, 0xD8, 0xB0, 0xD9, 0xB0, 0xD8,
+        0xB1, 0xD9, 0xB0, 0xD9, 0x89, 0xD9, 0xB0, 0x20, 0xD9, 0x8C, 0xD9, 0x91, 0x20, 0xD9, 0x8D, 0xD9,
+        0x91, 0x20, 0xD9, 0x8E, 0xD9, 0x91, 0x20, 0xD9, 0x8F, 0xD9, 0x91, 0x20, 0xD9, 0x90, 0xD9, 0x91,
+        0x20, 0xD9, 0x91, 0xD9, 0xB0, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xB1, 0xD9, 0x8A, 0xD9, 0x94, 0xD8,
+        0xB2, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x86, 0xD9, 0x8A, 0xD9,
+        0x94, 0xD9, 0x89, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x8A, 0xD8, 0xA8, 0xD8, 0xB1, 0xD8, 0xA8, 0xD8,
+        0xB2, 0xD8, 0xA8, 0xD9, 0x85, 0xD8, 0xA8, 0xD9, 0x86, 0xD8, 0xA8, 0xD9, 0x89, 0xD8, 0xA8, 0xD9,
+        0x8A, 0xD8, 0xAA, 0xD8, 0xB1, 0xD8, 0xAA, 0xD8, 0xB2, 0xD8, 0xAA, 0xD9, 0x85, 0xD8, 0xAA, 0xD9,
+        0x86, 0xD8, 0xAA, 0xD9, 0x89, 0xD8, 0xAA, 0xD9, 0x8A, 0xD8, 0xAB, 0xD8, 0xB1, 0xD8, 0xAB, 0xD8,
+        0xB2, 0xD8, 0xAB, 0xD9, 0x85, 0xD8, 0xAB, 0xD9, 0x86, 0xD8, 0xAB, 0xD9, 0x89, 0xD8, 0xAB, 0xD9,
+        0x8A, 0xD9, 0x81, 0xD9, 0x89, 0xD9, 0x81, 0xD9, 0x8A, 0xD9, 0x82, 0xD9, 0x89, 0xD9, 0x82, 0xD9,
+        0x8A, 0xD9, 0x83, 0xD8, 0xA7, 0xD9, 0x83, 0xD9, 0x84, 0xD9, 0x83, 0xD9, 0x85, 0xD9, 0x83, 0xD9,
+        0x89, 0xD9, 0x83, 0xD9, 0x8A, 0xD9, 0x84, 0xD9, 0x85, 0xD9, 0x84, 0xD9, 0x89, 0xD9, 0x84, 0xD9,
+        0x8A, 0xD9, 0x85, 0xD8, 0xA7, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xB1, 0xD9, 0x86, 0xD8,
+        0xB2, 0xD9, 0x86, 0xD9, 0x85, 0xD9, 0x86, 0xD9, 0x86, 0xD9, 0x86, 0xD9, 0x89, 0xD9, 0x86, 0xD9,
+        0x8A, 0xD9, 0x89, 0xD9, 0xB0, 0xD9, 0x8A, 0xD8, 0xB1, 0xD9, 0x8A, 0xD8, 0xB2, 0xD9, 0x8A, 0xD9,
+        0x85, 0xD9, 0x8A, 0xD9, 0x86, 0xD9, 0x8A, 0xD9, 0x89, 0xD9, 0x8A, 0xD9, 0x8A, 0xD9, 0x8A, 0xD9,
+        0x94, 0xD8, 0xAC, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xAE, 0xD9,
+        0x8A, 0xD9, 0x94, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x87, 0xD8, 0xA8, 0xD8, 0xAC, 0xD8,
+        0xA8, 0xD8, 0xAD, 0xD8, 0xA8, 0xD8, 0xAE, 0xD8, 0xA8, 0xD9, 0x85, 0xD8, 0xA8, 0xD9, 0x87, 0xD8,
+        0xAA, 0xD8, 0xAC, 0xD8, 0xAA, 0xD8, 0xAD, 0xD8, 0xAA, 0xD8, 0xAE, 0xD8, 0xAA, 0xD9, 0x85, 0xD8,
+        0xAA, 0xD9, 0x87, 0xD8, 0xAB, 0xD9, 0x85, 0xD8, 0xAC, 0xD8, 0xAD, 0xD8, 0xAC, 0xD9, 0x85, 0xD8,
+        0xAD, 0xD8, 0xAC, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAE, 0xD8, 0xAC, 0xD8, 0xAE, 0xD9, 0x85, 0xD8,
+        0xB3, 0xD8, 0xAC, 0xD8, 0xB3, 0xD8, 0xAD, 0xD8, 0xB3, 0xD8, 0xAE, 0xD8, 0xB3, 0xD9, 0x85, 0xD8,
+        0xB5, 0xD8, 0xAD, 0xD8, 0xB5, 0xD8, 0xAE, 0xD8, 0xB5, 0xD9, 0x85, 0xD8, 0xB6, 0xD8, 0xAC, 0xD8,
+        0xB6, 0xD8, 0xAD, 0xD8, 0xB6, 0xD8, 0xAE, 0xD8, 0xB6, 0xD9, 0x85, 0xD8, 0xB7, 0xD8, 0xAD, 0xD8,
+        0xB8, 0xD9, 0x85, 0xD8, 0xB9, 0xD8, 0xAC, 0xD8, 0xB9, 0xD9, 0x85, 0xD8, 0xBA, 0xD8, 0xAC, 0xD8,
+        0xBA, 0xD9, 0x85, 0xD9, 0x81, 0xD8, 0xAC, 0xD9, 0x81, 0xD8, 0xAD, 0xD9, 0x81, 0xD8, 0xAE, 0xD9,
+        0x81, 0xD9, 0x85, 0xD9, 0x82, 0xD8, 0xAD, 0xD9, 0x82, 0xD9, 0x85, 0xD9, 0x83, 0xD8, 0xAC, 0xD9,
+        0x83, 0xD8, 0xAD, 0xD9, 0x83, 0xD8, 0xAE, 0xD9, 0x83, 0xD9, 0x84, 0xD9, 0x83, 0xD9, 0x85, 0xD9,
+        0x84, 0xD8, 0xAC, 0xD9, 0x84, 0xD8, 0xAD, 0xD9, 0x84, 0xD8, 0xAE, 0xD9, 0x84, 0xD9, 0x85, 0xD9,
+        0x84, 0xD9, 0x87, 0xD9, 0x85, 0xD8, 0xAC, 0xD9, 0x85, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAE, 0xD9,
+        0x85, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xAC, 0xD9, 0x86, 0xD8, 0xAD, 0xD9, 0x86, 0xD8, 0xAE, 0xD9,
+        0x86, 0xD9, 0x85, 0xD9, 0x86, 0xD9, 0x87, 0xD9, 0x87, 0xD8, 0xAC, 0xD9, 0x87, 0xD9, 0x85, 0xD9,
+        0x87, 0xD9, 0xB0, 0xD9, 0x8A, 0xD8, 0xAC, 0xD9, 0x8A, 0xD8, 0xAD, 0xD9, 0x8A, 0xD8, 0xAE, 0xD9,
+        0x8A, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x87, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x85, 0xD9, 0x8A, 0xD9,
+        0x94, 0xD9, 0x87, 0xD8, 0xA8, 0xD9, 0x85, 0xD8, 0xA8, 0xD9, 0x87, 0xD8, 0xAA, 0xD9, 0x85, 0xD8,
+        0xAA, 0xD9, 0x87, 0xD8, 0xAB, 0xD9, 0x85, 0xD8, 0xAB, 0xD9, 0x87, 0xD8, 0xB3, 0xD9, 0x85, 0xD8,
+        0xB3, 0xD9, 0x87, 0xD8, 0xB4, 0xD9, 0x85, 0xD8, 0xB4, 0xD9, 0x87, 0xD9, 0x83, 0xD9, 0x84, 0xD9,
+        0x83, 0xD9, 0x85, 0xD9, 0x84, 0xD9, 0x85, 0xD9, 0x86, 0xD9, 0x85, 0xD9, 0x86, 0xD9, 0x87, 0xD9,
+        0x8A, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x87, 0xD9, 0x80, 0xD9, 0x8E, 0xD9, 0x91, 0xD9, 0x80, 0xD9,
+        0x8F, 0xD9, 0x91, 0xD9, 0x80, 0xD9, 0x90, 0xD9, 0x91, 0xD8, 0xB7, 0xD9, 0x89, 0xD8, 0xB7, 0xD9,
+        0x8A, 0xD8, 0xB9, 0xD9, 0x89, 0xD8, 0xB9, 0xD9, 0x8A, 0xD8, 0xBA, 0xD9, 0x89, 0xD8, 0xBA, 0xD9,
+        0x8A, 0xD8, 0xB3, 0xD9, 0x89, 0xD8, 0xB3, 0xD9, 0x8A, 0xD8, 0xB4, 0xD9, 0x89, 0xD8, 0xB4, 0xD9,
+        0x8A, 0xD8, 0xAD, 0xD9, 0x89, 0xD8, 0xAD, 0xD9, 0x8A, 0xD8, 0xAC, 0xD9, 0x89, 0xD8, 0xAC, 0xD9,
+        0x8A, 0xD8, 0xAE, 0xD9, 0x89, 0xD8, 0xAE, 0xD9, 0x8A, 0xD8, 0xB5, 0xD9, 0x89, 0xD8, 0xB5, 0xD9,
+        0x8A, 0xD8, 0xB6, 0xD9, 0x89, 0xD8, 0xB6, 0xD9, 0x8A, 0xD8, 0xB4, 0xD8, 0xAC, 0xD8, 0xB4, 0xD8,
+        0xAD, 0xD8, 0xB4, 0xD8, 0xAE, 0xD8, 0xB4, 0xD9, 0x85, 0xD8, 0xB4, 0xD8, 0xB1, 0xD8, 0xB3, 0xD8,
+        0xB1, 0xD8, 0xB5, 0xD8, 0xB1, 0xD8, 0xB6, 0xD8, 0xB1, 0xD8, 0xB7, 0xD9, 0x89, 0xD8, 0xB7, 0xD9,
+        0x8A, 0xD8, 0xB9, 0xD9, 0x89, 0xD8, 0xB9, 0xD9, 0x8A, 0xD8, 0xBA, 0xD9, 0x89, 0xD8, 0xBA, 0xD9,
+        0x8A, 0xD8, 0xB3, 0xD9, 0x89, 0xD8, 0xB3, 0xD9, 0x8A, 0xD8, 0xB4, 0xD9, 0x89, 0xD8, 0xB4, 0xD9,
+        0x8A, 0xD8, 0xAD, 0xD9, 0x89, 0xD8, 0xAD, 0xD9, 0x8A, 0xD8, 0xAC, 0xD9, 0x89, 0xD8, 0xAC, 0xD9,
+        0x8A, 0xD8, 0xAE, 0xD9, 0x89, 0xD8, 0xAE, 0xD9, 0x8A, 0xD8, 0xB5, 0xD9, 0x89, 0xD8, 0xB5, 0xD9,
+        0x8A, 0xD8, 0xB6, 0xD9, 0x89, 0xD8, 0xB6, 0xD9, 0x8A, 0xD8, 0xB4, 0xD8, 0xAC, 0xD8, 0xB4, 0xD8,
+        0xAD, 0xD8, 0xB4, 0xD8, 0xAE, 0xD8, 0xB4, 0xD9, 0x85, 0xD8, 0xB4, 0xD8, 0xB1, 0xD8, 0xB3, 0xD8,
+        0xB1, 0xD8, 0xB5, 0xD8, 0xB1, 0xD8, 0xB6, 0xD8, 0xB1, 0xD8, 0xB4, 0xD8, 0xAC, 0xD8, 0xB4, 0xD8,
+        0xAD, 0xD8, 0xB4, 0xD8, 0xAE, 0xD8, 0xB4, 0xD9, 0x85, 0xD8, 0xB3, 0xD9, 0x87, 0xD8, 0xB4, 0xD9,
+        0x87, 0xD8, 0xB7, 0xD9, 0x85, 0xD8, 0xB3, 0xD8, 0xAC, 0xD8, 0xB3, 0xD8, 0xAD, 0xD8, 0xB3, 0xD8,
+        0xAE, 0xD8, 0xB4, 0xD8, 0xAC, 0xD8, 0xB4, 0xD8, 0xAD, 0xD8, 0xB4, 0xD8, 0xAE, 0xD8, 0xB7, 0xD9,
+        0x85, 0xD8, 0xB8, 0xD9, 0x85, 0xD8, 0xA7, 0xD9, 0x8B, 0xD8, 0xA7, 0xD9, 0x8B, 0xD8, 0xAA, 0xD8,
+        0xAC, 0xD9, 0x85, 0xD8, 0xAA, 0xD8, 0xAD, 0xD8, 0xAC, 0xD8, 0xAA, 0xD8, 0xAD, 0xD8, 0xAC, 0xD8,
+        0xAA, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAA, 0xD8, 0xAE, 0xD9, 0x85, 0xD8, 0xAA, 0xD9, 0x85, 0xD8,
+        0xAC, 0xD8, 0xAA, 0xD9, 0x85, 0xD8, 0xAD, 0xD8, 0xAA, 0xD9, 0x85, 0xD8, 0xAE, 0xD8, 0xAC, 0xD9,
+        0x85, 0xD8, 0xAD, 0xD8, 0xAC, 0xD9, 0x85, 0xD8, 0xAD, 0xD8, 0xAD, 0xD9, 0x85, 0xD9, 0x8A, 0xD8,
+        0xAD, 0xD9, 0x85, 0xD9, 0x89, 0xD8, 0xB3, 0xD8, 0xAD, 0xD8, 0xAC, 0xD8, 0xB3, 0xD8, 0xAC, 0xD8,
+        0xAD, 0xD8, 0xB3, 0xD8, 0xAC, 0xD9, 0x89, 0xD8, 0xB3, 0xD9, 0x85, 0xD8, 0xAD, 0xD8, 0xB3, 0xD9,
+        0x85, 0xD8, 0xAD, 0xD8, 0xB3, 0xD9, 0x85, 0xD8, 0xAC, 0xD8, 0xB3, 0xD9, 0x85, 0xD9, 0x85, 0xD8,
+        0xB3, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB5, 0xD8, 0xAD, 0xD8, 0xAD, 0xD8, 0xB5, 0xD8, 0xAD, 0xD8,
+        0xAD, 0xD8, 0xB5, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB4, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xB4, 0xD8,
+        0xAD, 0xD9, 0x85, 0xD8, 0xB4, 0xD8, 0xAC, 0xD9, 0x8A, 0xD8, 0xB4, 0xD9, 0x85, 0xD8, 0xAE, 0xD8,
+        0xB4, 0xD9, 0x85, 0xD8, 0xAE, 0xD8, 0xB4, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB4, 0xD9, 0x85, 0xD9,
+        0x85, 0xD8, 0xB6, 0xD8, 0xAD, 0xD9, 0x89, 0xD8, 0xB6, 0xD8, 0xAE, 0xD9, 0x85, 0xD8, 0xB6, 0xD8,
+        0xAE, 0xD9, 0x85, 0xD8, 0xB7, 0xD9, 0x85, 0xD8, 0xAD, 0xD8, 0xB7, 0xD9, 0x85, 0xD8, 0xAD, 0xD8,
+        0xB7, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB7, 0xD9, 0x85, 0xD9, 0x8A, 0xD8, 0xB9, 0xD8, 0xAC, 0xD9,
+        0x85, 0xD8, 0xB9, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB9, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB9, 0xD9,
+        0x85, 0xD9, 0x89, 0xD8, 0xBA, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xBA, 0xD9, 0x85, 0xD9, 0x8A, 0xD8,
+        0xBA, 0xD9, 0x85, 0xD9, 0x89, 0xD9, 0x81, 0xD8, 0xAE, 0xD9, 0x85, 0xD9, 0x81, 0xD8, 0xAE, 0xD9,
+        0x85, 0xD9, 0x82, 0xD9, 0x85, 0xD8, 0xAD, 0xD9, 0x82, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x84, 0xD8,
+        0xAD, 0xD9, 0x85, 0xD9, 0x84, 0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x84, 0xD8, 0xAD, 0xD9, 0x89, 0xD9,
+        0x84, 0xD8, 0xAC, 0xD8, 0xAC, 0xD9, 0x84, 0xD8, 0xAC, 0xD8, 0xAC, 0xD9, 0x84, 0xD8, 0xAE, 0xD9,
+        0x85, 0xD9, 0x84, 0xD8, 0xAE, 0xD9, 0x85, 0xD9, 0x84, 0xD9, 0x85, 0xD8, 0xAD, 0xD9, 0x84, 0xD9,
+        0x85, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAD, 0xD8, 0xAC, 0xD9, 0x85, 0xD8, 0xAD, 0xD9, 0x85, 0xD9,
+        0x85, 0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x85, 0xD8, 0xAC, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAC, 0xD9,
+        0x85, 0xD9, 0x85, 0xD8, 0xAE, 0xD8, 0xAC, 0xD9, 0x85, 0xD8, 0xAE, 0xD9, 0x85, 0xD9, 0x85, 0xD8,
+        0xAC, 0xD8, 0xAE, 0xD9, 0x87, 0xD9, 0x85, 0xD8, 0xAC, 0xD9, 0x87, 0xD9, 0x85, 0xD9, 0x85, 0xD9,
+        0x86, 0xD8, 0xAD, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xAD, 0xD9, 0x89, 0xD9, 0x86, 0xD8, 0xAC, 0xD9,
+        0x85, 0xD9, 0x86, 0xD8, 0xAC, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xAC, 0xD9, 0x89, 0xD9, 0x86, 0xD9,
+        0x85, 0xD9, 0x8A, 0xD9, 0x86, 0xD9, 0x85, 0xD9, 0x89, 0xD9, 0x8A, 0xD9, 0x85, 0xD9, 0x85, 0xD9,
+        0x8A, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xA8, 0xD8, 0xAE, 0xD9, 0x8A, 0xD8, 0xAA, 0xD8, 0xAC, 0xD9,
+        0x8A, 0xD8, 0xAA, 0xD8, 0xAC, 0xD9, 0x89, 0xD8, 0xAA, 0xD8, 0xAE, 0xD9, 0x8A, 0xD8, 0xAA, 0xD8,
+        0xAE, 0xD9, 0x89, 0xD8, 0xAA, 0xD9, 0x85, 0xD9, 0x8A, 0xD8, 0xAA, 0xD9, 0x85, 0xD9, 0x89, 0xD8,
+        0xAC, 0xD9, 0x85, 0xD9, 0x8A, 0xD8, 0xAC, 0xD8, 0xAD, 0xD9, 0x89, 0xD8, 0xAC, 0xD9, 0x85, 0xD9,
+        0x89, 0xD8, 0xB3, 0xD8, 0xAE, 0xD9, 0x89, 0xD8, 0xB5, 0xD8, 0xAD, 0xD9, 0x8A, 0xD8, 0xB4, 0xD8,
+        0xAD, 0xD9, 0x8A, 0xD8, 0xB6, 0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x84, 0xD8, 0xAC, 0xD9, 0x8A, 0xD9,
+        0x84, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x8A, 0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x8A, 0xD8, 0xAC, 0xD9,
+        0x8A, 0xD9, 0x8A, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x82, 0xD9,
+        0x85, 0xD9, 0x8A, 0xD9, 0x86, 0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x82, 0xD9, 0x85, 0xD8, 0xAD, 0xD9,
+        0x84, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xB9, 0xD9, 0x85, 0xD9, 0x8A, 0xD9, 0x83, 0xD9, 0x85, 0xD9,
+        0x8A, 0xD9, 0x86, 0xD8, 0xAC, 0xD8, 0xAD, 0xD9, 0x85, 0xD8, 0xAE, 0xD9, 0x8A, 0xD9, 0x84, 0xD8,
+        0xAC, 0xD9, 0x85, 0xD9, 0x83, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x84, 0xD8, 0xAC, 0xD9, 0x85, 0xD9,
+        0x86, 0xD8, 0xAC, 0xD8, 0xAD, 0xD8, 0xAC, 0xD8, 0xAD, 0xD9, 0x8A, 0xD8, 0xAD, 0xD8, 0xAC, 0xD9,
+        0x8A, 0xD9, 0x85, 0xD8, 0xAC, 0xD9, 0x8A, 0xD9, 0x81, 0xD9, 0x85, 0xD9, 0x8A, 0xD8, 0xA8, 0xD8,
+        0xAD, 0xD9, 0x8A, 0xD9, 0x83, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB9, 0xD8, 0xAC, 0xD9, 0x85, 0xD8,
+        0xB5, 0xD9, 0x85, 0xD9, 0x85, 0xD8, 0xB3, 0xD8, 0xAE, 0xD9, 0x8A, 0xD9, 0x86, 0xD8, 0xAC, 0xD9,
+        0x8A, 0xD8, 0xB5, 0xD9, 0x84, 0xDB, 0x92, 0xD9, 0x82, 0xD9, 0x84, 0xDB, 0x92, 0xD8, 0xA7, 0xD9,
+        0x84, 0xD9, 0x84, 0xD9, 0x87, 0xD8, 0xA7, 0xD9, 0x83, 0xD8, 0xA8, 0xD8, 0xB1, 0xD9, 0x85, 0xD8,
+        0xAD, 0xD9, 0x85, 0xD8, 0xAF, 0xD8, 0xB5, 0xD9, 0x84, 0xD8, 0xB9, 0xD9, 0x85, 0xD8, 0xB1, 0xD8,
+        0xB3, 0xD9, 0x88, 0xD9, 0x84, 0xD8, 0xB9, 0xD9, 0x84, 0xD9, 0x8A, 0xD9, 0x87, 0xD9, 0x88, 0xD8,
+        0xB3, 0xD9, 0x84, 0xD9, 0x85, 0xD8, 0xB5, 0xD9, 0x84, 0xD9, 0x89, 0xD8, 0xB5, 0xD9, 0x84, 0xD9,
+        0x89, 0x20, 0xD8, 0xA7, 0xD9, 0x84, 0xD9, 0x84, 0xD9, 0x87, 0x20, 0xD8, 0xB9, 0xD9, 0x84, 0xD9,
+        0x8A, 0xD9, 0x87, 0x20, 0xD9, 0x88, 0xD8, 0xB3, 0xD9, 0x84, 0xD9, 0x85, 0xD8, 0xAC, 0xD9, 0x84,
+        0x20, 0xD8, 0xAC, 0xD9, 0x84, 0xD8, 0xA7, 0xD9, 0x84, 0xD9, 0x87, 0xD8, 0xB1, 0xDB, 0x8C, 0xD8,
+        0xA7, 0xD9, 0x84, 0x2C, 0xE3, 0x80, 0x81, 0xE3, 0x80, 0x82, 0x3A, 0x3B, 0x21, 0x3F, 0xE3, 0x80,
+        0x96, 0xE3, 0x80, 0x97, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0xE2, 0x80, 0x94, 0xE2, 0x80, 0x93, 0x5F,
+        0x5F, 0x28, 0x29, 0x7B, 0x7D, 0xE3, 0x80, 0x94, 0xE3, 0x80, 0x95, 0xE3, 0x80, 0x90, 0xE3, 0x80,
+        0x91, 0xE3, 0x80, 0x8A, 0xE3, 0x80, 0x8B, 0xE3, 0x80, 0x88, 0xE3, 0x80, 0x89, 0xE3, 0x80, 0x8C,
+        0xE3, 0x80, 0x8D, 0xE3, 0x80, 0x8E, 0xE3, 0x80, 0x8F, 0x5B, 0x5D, 0x20, 0xCC, 0x85, 0x20, 0xCC,
+        0x85, 0x20, 0xCC, 0x85, 0x20, 0xCC, 0x85, 0x5F, 0x5F, 0x5F, 0x2C, 0xE3, 0x80, 0x81, 0x2E, 0x3B,
+        0x3A, 0x3F, 0x21, 0xE2, 0x80, 0x94, 0x28, 0x29, 0x7B, 0x7D, 0xE3, 0x80, 0x94, 0xE3, 0x80, 0x95,
+        0x23, 0x26, 0x2A, 0x2B, 0x2D, 0x3C, 0x3E, 0x3D, 0x5C, 0x24, 0x25, 0x40, 0x20, 0xD9, 0x8B, 0xD9,
+        0x80, 0xD9, 0x8B, 0x20, 0xD9, 0x8C, 0x20, 0xD9, 0x8D, 0x20, 0xD9, 0x8E, 0xD9, 0x80, 0xD9, 0x8E,
+        0x20, 0xD9, 0x8F, 0xD9, 0x80, 0xD9, 0x8F, 0x20, 0xD9, 0x90, 0xD9, 0x80, 0xD9, 0x90, 0x20, 0xD9,
+        0x91, 0xD9, 0x80, 0xD9, 0x91, 0x20, 0xD9, 0x92, 0xD9, 0x80, 0xD9, 0x92, 0xD8, 0xA1, 0xD8, 0xA7,
+        0xD9, 0x93, 0xD8, 0xA7, 0xD9, 0x93, 0xD8, 0xA7, 0xD9, 0x94, 0xD8, 0xA7, 0xD9, 0x94, 0xD9, 0x88,
+        0xD9, 0x94, 0xD9, 0x88, 0xD9, 0x94, 0xD8, 0xA7, 0xD9, 0x95, 0xD8, 0xA7, 0xD9, 0x95, 0xD9, 0x8A,
+        0xD9, 0x94, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x8A, 0xD9, 0x94, 0xD9, 0x8A, 0xD9, 0x94, 0xD8, 0xA7,
+        0xD8, 0xA7, 0xD8, 0xA8, 0xD8, 0xA8, 0xD8, 0xA8, 0xD8, 0xA8, 0xD8, 0xA9, 0xD8, 0xA9, 0xD8, 0xAA,
+        0xD8, 0xAA, 0xD8, 0xAA, 0xD8, 0xAA, 0xD8, 0xAB, 0xD8, 0xAB, 0xD8, 0xAB, 0xD8, 0xAB, 0xD8, 0xAC,
+        0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAD, 0xD8, 0xAD, 0xD8, 0xAD, 0xD8, 0xAD, 0xD8, 0xAE,
+        0xD8, 0xAE, 0xD8, 0xAE, 0xD8, 0xAE, 0xD8, 0xAF, 0xD8, 0xAF, 0xD8, 0xB0, 0xD8, 0xB0, 0xD8, 0xB1,
+        0xD8, 0xB1, 0xD8, 0xB2, 0xD8, 0xB2, 0xD8, 0xB3, 0xD8, 0xB3, 0xD8, 0xB3, 0xD8, 0xB3, 0xD8, 0xB4,
+        0xD8, 0xB4, 0xD8, 0xB4, 0xD8, 0xB4, 0xD8, 0xB5, 0xD8, 0xB5, 0xD8, 0xB5, 0xD8, 0xB5, 0xD8, 0xB6,
+        0xD8, 0xB6, 0xD8, 0xB6, 0xD8, 0xB6, 0xD8, 0xB7, 0xD8, 0xB7, 0xD8, 0xB7, 0xD8, 0xB7, 0xD8, 0xB8,
+        0xD8, 0xB8, 0xD8, 0xB8, 0xD8, 0xB8, 0xD8, 0xB9, 0xD8, 0xB9, 0xD8, 0xB9, 0xD8, 0xB9, 0xD8, 0xBA,
+        0xD8, 0xBA, 0xD8, 0xBA, 0xD8, 0xBA, 0xD9, 0x81, 0xD9, 0x81, 0xD9, 0x81, 0xD9, 0x81, 0xD9, 0x82,
+        0xD9, 0x82, 0xD9, 0x82, 0xD9, 0x82, 0xD9, 0x83, 0xD9, 0x83, 0xD9, 0x83, 0xD9, 0x83, 0xD9, 0x84,
+        0xD9, 0x84, 0xD9, 0x84, 0xD9, 0x84, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x85, 0xD9, 0x86,
+        0xD9, 0x86, 0xD9, 0x86, 0xD9, 0x86, 0xD9, 0x87, 0xD9, 0x87, 0xD9, 0x87, 0xD9, 0x87, 0xD9, 0x88,
+        0xD9, 0x88, 0xD9, 0x89, 0xD9, 0x89, 0xD9, 0x8A, 0xD9, 0x8A, 0xD9, 0x8A, 0xD9, 0x8A, 0xD9, 0x84,
+        0xD8, 0xA7, 0xD9, 0x93, 0xD9, 0x84, 0xD8, 0xA7, 0xD9, 0x93, 0xD9, 0x84, 0xD8, 0xA7, 0xD9, 0x94,
+        0xD9, 0x84, 0xD8, 0xA7, 0xD9, 0x94, 0xD9, 0x84, 0xD8, 0xA7, 0xD9, 0x95, 0xD9, 0x84, 0xD8, 0xA7,
+        0xD9, 0x95, 0xD9, 0x84, 0xD8, 0xA7, 0xD9, 0x84, 0xD8, 0xA7, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+        0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+        0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+        0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+        0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0xE2, 0xA6, 0x85, 0xE2, 0xA6, 0x86, 0xE3, 0x80,
+        0x82, 0xE3, 0x80, 0x8C, 0xE3, 0x80, 0x8D, 0xE3, 0x80, 0x81, 0xE3, 0x83, 0xBB, 0xE3, 0x83, 0xB2,
+        0xE3, 0x82, 0xA1, 0xE3, 0x82, 0xA3, 0xE3, 0x82, 0xA5, 0xE3, 0x82, 0xA7, 0xE3, 0x82, 0xA9, 0xE3,
+        0x83, 0xA3, 0xE3, 0x83, 0xA5, 0xE3, 0x83, 0xA7, 0xE3, 0x83, 0x83, 0xE3, 0x83, 0xBC, 0xE3, 0x82,
+        0xA2, 0xE3, 0x82, 0xA4, 0xE3, 0x82, 0xA6, 0xE3, 0x82, 0xA8, 0xE3, 0x82, 0xAA, 0xE3, 0x82, 0xAB,
+        0xE3, 0x82, 0xAD, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0xB1, 0xE3, 0x82, 0xB3, 0xE3, 0x82, 0xB5, 0xE3,
+        0x82, 0xB7, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0xBB, 0xE3, 0x82, 0xBD, 0xE3, 0x82, 0xBF, 0xE3, 0x83,
+        0x81, 0xE3, 0x83, 0x84, 0xE3, 0x83, 0x86, 0xE3, 0x83, 0x88, 0xE3, 0x83, 0x8A, 0xE3, 0x83, 0x8B,
+        0xE3, 0x83, 0x8C, 0xE3, 0x83, 0x8D, 0xE3, 0x83, 0x8E, 0xE3, 0x83, 0x8F, 0xE3, 0x83, 0x92, 0xE3,
+        0x83, 0x95, 0xE3, 0x83, 0x98, 0xE3, 0x83, 0x9B, 0xE3, 0x83, 0x9E, 0xE3, 0x83, 0x9F, 0xE3, 0x83,
+        0xA0, 0xE3, 0x83, 0xA1, 0xE3, 0x83, 0xA2, 0xE3, 0x83, 0xA4, 0xE3, 0x83, 0xA6, 0xE3, 0x83, 0xA8,
+        0xE3, 0x83, 0xA9, 0xE3, 0x83, 0xAA, 0xE3, 0x83, 0xAB, 0xE3, 0x83, 0xAC, 0xE3, 0x83, 0xAD, 0xE3,
+        0x83, 0xAF, 0xE3, 0x83, 0xB3, 0xE3, 0x82, 0x99, 0xE3, 0x82, 0x9A, 0xE1, 0x85, 0xA0, 0xE1, 0x84,
+        0x80, 0xE1, 0x84, 0x81, 0xE1, 0x86, 0xAA, 0xE1, 0x84, 0x82, 0xE1, 0x86, 0xAC, 0xE1, 0x86, 0xAD,
+        0xE1, 0x84, 0x83, 0xE1, 0x84, 0x84, 0xE1, 0x84, 0x85, 0xE1, 0x86, 0xB0, 0xE1, 0x86, 0xB1, 0xE1,
+        0x86, 0xB2, 0xE1, 0x86, 0xB3, 0xE1, 0x86, 0xB4, 0xE1, 0x86, 0xB5, 0xE1, 0x84, 0x9A, 0xE1, 0x84,
+        0x86, 0xE1, 0x84, 0x87, 0xE1, 0x84, 0x88, 0xE1, 0x84, 0xA1, 0xE1, 0x84, 0x89, 0xE1, 0x84, 0x8A,
+        0xE1, 0x84, 0x8B, 0xE1, 0x84, 0x8C, 0xE1, 0x84, 0x8D, 0xE1, 0x84, 0x8E, 0xE1, 0x84, 0x8F, 0xE1,
+        0x84, 0x90, 0xE1, 0x84, 0x91, 0xE1, 0x84, 0x92, 0xE1, 0x85, 0xA1, 0xE1, 0x85, 0xA2, 0xE1, 0x85,
+        0xA3, 0xE1, 0x85, 0xA4, 0xE1, 0x85, 0xA5, 0xE1, 0x85, 0xA6, 0xE1, 0x85, 0xA7, 0xE1, 0x85, 0xA8,
+        0xE1, 0x85, 0xA9, 0xE1, 0x85, 0xAA, 0xE1, 0x85, 0xAB, 0xE1, 0x85, 0xAC, 0xE1, 0x85, 0xAD, 0xE1,
+        0x85, 0xAE, 0xE1, 0x85, 0xAF, 0xE1, 0x85, 0xB0, 0xE1, 0x85, 0xB1, 0xE1, 0x85, 0xB2, 0xE1, 0x85,
+        0xB3, 0xE1, 0x85, 0xB4, 0xE1, 0x85, 0xB5, 0xC2, 0xA2, 0xC2, 0xA3, 0xC2, 0xAC, 0x20, 0xCC, 0x84,
+        0xC2, 0xA6, 0xC2, 0xA5, 0xE2, 0x82, 0xA9, 0xE2, 0x94, 0x82, 0xE2, 0x86, 0x90, 0xE2, 0x86, 0x91,
+        0xE2, 0x86, 0x92, 0xE2, 0x86, 0x93, 0xE2, 0x96, 0xA0, 0xE2, 0x97, 0x8B, 0xCB, 0x90, 0xCB, 0x91,
+        0xC3, 0xA6, 0xCA, 0x99, 0xC9, 0x93, 0xCA, 0xA3, 0xEA, 0xAD, 0xA6, 0xCA, 0xA5, 0xCA, 0xA4, 0xC9,
+        0x96, 0xC9, 0x97, 0xE1, 0xB6, 0x91, 0xC9, 0x98, 0xC9, 0x9E, 0xCA, 0xA9, 0xC9, 0xA4, 0xC9, 0xA2,
+        0xC9, 0xA0, 0xCA, 0x9B, 0xC4, 0xA7, 0xCA, 0x9C, 0xC9, 0xA7, 0xCA, 0x84, 0xCA, 0xAA, 0xCA, 0xAB,
+        0xC9, 0xAC, 0xF0, 0x9D, 0xBC, 0x84, 0xEA, 0x9E, 0x8E, 0xC9, 0xAE, 0xF0, 0x9D, 0xBC, 0x85, 0xCA,
+        0x8E, 0xF0, 0x9D, 0xBC, 0x86, 0xC3, 0xB8, 0xC9, 0xB6, 0xC9, 0xB7, 0x71, 0xC9, 0xBA, 0xF0, 0x9D,
+        0xBC, 0x88, 0xC9, 0xBD, 0xC9, 0xBE, 0xCA, 0x80, 0xCA, 0xA8, 0xCA, 0xA6, 0xEA, 0xAD, 0xA7, 0xCA,
+        0xA7, 0xCA, 0x88, 0xE2, 0xB1, 0xB1, 0xCA, 0x8F, 0xCA, 0xA1, 0xCA, 0xA2, 0xCA, 0x98, 0xC7, 0x80,
+        0xC7, 0x81, 0xC7, 0x82, 0xF0, 0x9D, 0xBC, 0x8A, 0xF0, 0x9D, 0xBC, 0x9E, 0xF0, 0x91, 0x82, 0x99,
+        0xF0, 0x91, 0x82, 0xBA, 0xF0, 0x91, 0x82, 0x99, 0xF0, 0x91, 0x82, 0xBA, 0xF0, 0x91, 0x82, 0x9B,
+        0xF0, 0x91, 0x82, 0xBA, 0xF0, 0x91, 0x82, 0x9B, 0xF0, 0x91, 0x82, 0xBA, 0xF0, 0x91, 0x82, 0xA5,
+        0xF0, 0x91, 0x82, 0xBA, 0xF0, 0x91, 0x82, 0xA5, 0xF0, 0x91, 0x82, 0xBA, 0xF0, 0x91, 0x84, 0xB1,
+        0xF0, 0x91, 0x84, 0xA7, 0xF0, 0x91, 0x84, 0xB1, 0xF0, 0x91, 0x84, 0xA7, 0xF0, 0x91, 0x84, 0xB2,
+        0xF0, 0x91, 0x84, 0xA7, 0xF0, 0x91, 0x84, 0xB2, 0xF0, 0x91, 0x84, 0xA7, 0xF0, 0x91, 0x8D, 0x87,
+        0xF0, 0x91, 0x8C, 0xBE, 0xF0, 0x91, 0x8D, 0x87, 0xF0, 0x91, 0x8C, 0xBE, 0xF0, 0x91, 0x8D, 0x87,
+        0xF0, 0x91, 0x8D, 0x97, 0xF0, 0x91, 0x8D, 0x87, 0xF0, 0x91, 0x8D, 0x97, 0xF0, 0x91, 0x92, 0xB9,
+        0xF0, 0x91, 0x92, 0xBA, 0xF0, 0x91, 0x92, 0xB9, 0xF0, 0x91, 0x92, 0xBA, 0xF0, 0x91, 0x92, 0xB9,
+        0xF0, 0x91, 0x92, 0xB0, 0xF0, 0x91, 0x92, 0xB9, 0xF0, 0x91, 0x92, 0xB0, 0xF0, 0x91, 0x92, 0xB9,
+        0xF0, 0x91, 0x92, 0xBD, 0xF0, 0x91, 0x92, 0xB9, 0xF0, 0x91, 0x92, 0xBD, 0xF0, 0x91, 0x96, 0xB8,
+        0xF0, 0x91, 0x96, 0xAF, 0xF0, 0x91, 0x96, 0xB8, 0xF0, 0x91, 0x96, 0xAF, 0xF0, 0x91, 0x96, 0xB9,
+        0xF0, 0x91, 0x96, 0xAF, 0xF0, 0x91, 0x96, 0xB9, 0xF0, 0x91, 0x96, 0xAF, 0xF0, 0x91, 0xA4, 0xB5,
+        0xF0, 0x91, 0xA4, 0xB0, 0xF0, 0x91, 0xA4, 0xB5, 0xF0, 0x91, 0xA4, 0xB0, 0xF0, 0x9D, 0x85, 0x97,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0x97, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0x98,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0x98,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5,
+        0xF0, 0x9D, 0x85, 0xAE, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAF,
+        0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAF, 0xF0, 0x9D, 0x85, 0x98,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xB0, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5,
+        0xF0, 0x9D, 0x85, 0xB0, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xB1,
+        0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xB1, 0xF0, 0x9D, 0x85, 0x98,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xB2, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5,
+        0xF0, 0x9D, 0x85, 0xB2, 0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x86, 0xB9,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x86, 0xBA, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x86, 0xBA,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE,
+        0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE, 0xF0, 0x9D, 0x86, 0xBA,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE, 0xF0, 0x9D, 0x86, 0xBA, 0xF0, 0x9D, 0x85, 0xA5,
+        0xF0, 0x9D, 0x85, 0xAE, 0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAF,
+        0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAF, 0xF0, 0x9D, 0x86, 0xBA,
+        0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAF, 0xF0, 0x9D, 0x86, 0xBA, 0xF0, 0x9D, 0x85, 0xA5,
+        0xF0, 0x9D, 0x85, 0xAF, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+        0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62,
+        0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+        0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+        0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45,
+        0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+        0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B,
+        0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41,
+        0x43, 0x44, 0x47, 0x4A, 0x4B, 0x4E, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+        0x5A, 0x61, 0x62, 0x63, 0x64, 0x66, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
+        0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+        0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+        0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x44, 0x45,
+        0x46, 0x47, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x44, 0x45, 0x46,
+        0x47, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4F, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x61, 0x62,
+        0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+        0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+        0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+        0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44,
+        0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54,
+        0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+        0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+        0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50,
+        0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+        0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+        0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+        0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62,
+        0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+        0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+        0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+        0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44,
+        0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54,
+        0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+        0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+        0xC4, 0xB1, 0xC8, 0xB7, 0xCE, 0x91, 0xCE, 0x92, 0xCE, 0x93, 0xCE, 0x94, 0xCE, 0x95, 0xCE, 0x96,
+        0xCE, 0x97, 0xCE, 0x98, 0xCE, 0x99, 0xCE, 0x9A, 0xCE, 0x9B, 0xCE, 0x9C, 0xCE, 0x9D, 0xCE, 0x9E,
+        0xCE, 0x9F, 0xCE, 0xA0, 0xCE, 0xA1, 0xCE, 0x98, 0xCE, 0xA3, 0xCE, 0xA4, 0xCE, 0xA5, 0xCE, 0xA6,
+        0xCE, 0xA7, 0xCE, 0xA8, 0xCE, 0xA9, 0xE2, 0x88, 0x87, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB3, 0xCE,
+        0xB4, 0xCE, 0xB5, 0xCE, 0xB6, 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE,
+        0xBC, 0xCE, 0xBD, 0xCE, 0xBE, 0xCE, 0xBF, 0xCF, 0x80, 0xCF, 0x81, 0xCF, 0x82, 0xCF, 0x83, 0xCF,
+        0x84, 0xCF, 0x85, 0xCF, 0x86, 0xCF, 0x87, 0xCF, 0x88, 0xCF, 0x89, 0xE2, 0x88, 0x82, 0xCE, 0xB5,
+        0xCE, 0xB8, 0xCE, 0xBA, 0xCF, 0x86, 0xCF, 0x81, 0xCF, 0x80, 0xCE, 0x91, 0xCE, 0x92, 0xCE, 0x93,
+        0xCE, 0x94, 0xCE, 0x95, 0xCE, 0x96, 0xCE, 0x97, 0xCE, 0x98, 0xCE, 0x99, 0xCE, 0x9A, 0xCE, 0x9B,
+        0xCE, 0x9C, 0xCE, 0x9D, 0xCE, 0x9E, 0xCE, 0x9F, 0xCE, 0xA0, 0xCE, 0xA1, 0xCE, 0x98, 0xCE, 0xA3,
+        0xCE, 0xA4, 0xCE, 0xA5, 0xCE, 0xA6, 0xCE, 0xA7, 0xCE, 0xA8, 0xCE, 0xA9, 0xE2, 0x88, 0x87, 0xCE,
+        0xB1, 0xCE, 0xB2, 0xCE, 0xB3, 0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xB6, 0xCE, 0xB7, 0xCE, 0xB8, 0xCE,
+        0xB9, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xBC, 0xCE, 0xBD, 0xCE, 0xBE, 0xCE, 0xBF, 0xCF, 0x80, 0xCF,
+        0x81, 0xCF, 0x82, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x85, 0xCF, 0x86, 0xCF, 0x87, 0xCF, 0x88, 0xCF,
+        0x89, 0xE2, 0x88, 0x82, 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBA, 0xCF, 0x86, 0xCF, 0x81, 0xCF, 0x80,
+        0xCE, 0x91, 0xCE, 0x92, 0xCE, 0x93, 0xCE, 0x94, 0xCE, 0x95, 0xCE, 0x96, 0xCE, 0x97, 0xCE, 0x98,
+        0xCE, 0x99, 0xCE, 0x9A, 0xCE, 0x9B, 0xCE, 0x9C, 0xCE, 0x9D, 0xCE, 0x9E, 0xCE, 0x9F, 0xCE, 0xA0,
+        0xCE, 0xA1, 0xCE, 0x98, 0xCE, 0xA3, 0xCE, 0xA4, 0xCE, 0xA5, 0xCE, 0xA6, 0xCE, 0xA7, 0xCE, 0xA8,
+        0xCE, 0xA9, 0xE2, 0x88, 0x87, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB3, 0xCE, 0xB4, 0xCE, 0xB5, 0xCE,
+        0xB6, 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xBC, 0xCE, 0xBD, 0xCE,
+        0xBE, 0xCE, 0xBF, 0xCF, 0x80, 0xCF, 0x81, 0xCF, 0x82, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x85, 0xCF,
+        0x86, 0xCF, 0x87, 0xCF, 0x88, 0xCF, 0x89, 0xE2, 0x88, 0x82, 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBA,
+        0xCF, 0x86, 0xCF, 0x81, 0xCF, 0x80, 0xCE, 0x91, 0xCE, 0x92, 0xCE, 0x93, 0xCE, 0x94, 0xCE, 0x95,
+        0xCE, 0x96, 0xCE, 0x97, 0xCE, 0x98, 0xCE, 0x99, 0xCE, 0x9A, 0xCE, 0x9B, 0xCE, 0x9C, 0xCE, 0x9D,
+        0xCE, 0x9E, 0xCE, 0x9F, 0xCE, 0xA0, 0xCE, 0xA1, 0xCE, 0x98, 0xCE, 0xA3, 0xCE, 0xA4, 0xCE, 0xA5,
+        0xCE, 0xA6, 0xCE, 0xA7, 0xCE, 0xA8, 0xCE, 0xA9, 0xE2, 0x88, 0x87, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE,
+        0xB3, 0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xB6, 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE,
+        0xBB, 0xCE, 0xBC, 0xCE, 0xBD, 0xCE, 0xBE, 0xCE, 0xBF, 0xCF, 0x80, 0xCF, 0x81, 0xCF, 0x82, 0xCF,
+        0x83, 0xCF, 0x84, 0xCF, 0x85, 0xCF, 0x86, 0xCF, 0x87, 0xCF, 0x88, 0xCF, 0x89, 0xE2, 0x88, 0x82,
+        0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBA, 0xCF, 0x86, 0xCF, 0x81, 0xCF, 0x80, 0xCE, 0x91, 0xCE, 0x92,
+        0xCE, 0x93, 0xCE, 0x94, 0xCE, 0x95, 0xCE, 0x96, 0xCE, 0x97, 0xCE, 0x98, 0xCE, 0x99, 0xCE, 0x9A,
+        0xCE, 0x9B, 0xCE, 0x9C, 0xCE, 0x9D, 0xCE, 0x9E, 0xCE, 0x9F, 0xCE, 0xA0, 0xCE, 0xA1, 0xCE, 0x98,
+        0xCE, 0xA3, 0xCE, 0xA4, 0xCE, 0xA5, 0xCE, 0xA6, 0xCE, 0xA7, 0xCE, 0xA8, 0xCE, 0xA9, 0xE2, 0x88,
+        0x87, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB3, 0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xB6, 0xCE, 0xB7, 0xCE,
+        0xB8, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xBC, 0xCE, 0xBD, 0xCE, 0xBE, 0xCE, 0xBF, 0xCF,
+        0x80, 0xCF, 0x81, 0xCF, 0x82, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x85, 0xCF, 0x86, 0xCF, 0x87, 0xCF,
+        0x88, 0xCF, 0x89, 0xE2, 0x88, 0x82, 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBA, 0xCF, 0x86, 0xCF, 0x81,
+        0xCF, 0x80, 0xCF, 0x9C, 0xCF, 0x9D, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xD8, 0xA7, 0xD8, 0xA8, 0xD8, 0xAC, 0xD8, 0xAF,
+        0xD9, 0x88, 0xD8, 0xB2, 0xD8, 0xAD, 0xD8, 0xB7, 0xD9, 0x8A, 0xD9, 0x83, 0xD9, 0x84, 0xD9, 0x85,
+        0xD9, 0x86, 0xD8, 0xB3, 0xD8, 0xB9, 0xD9, 0x81, 0xD8, 0xB5, 0xD9, 0x82, 0xD8, 0xB1, 0xD8, 0xB4,
+        0xD8, 0xAA, 0xD8, 0xAB, 0xD8, 0xAE, 0xD8, 0xB0, 0xD8, 0xB6, 0xD8, 0xB8, 0xD8, 0xBA, 0xD9, 0xAE,
+        0xDA, 0xBA, 0xDA, 0xA1, 0xD9, 0xAF, 0xD8, 0xA8, 0xD8, 0xAC, 0xD9, 0x87, 0xD8, 0xAD, 0xD9, 0x8A,
+        0xD9, 0x83, 0xD9, 0x84, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xB3, 0xD8, 0xB9, 0xD9, 0x81, 0xD8, 0xB5,
+        0xD9, 0x82, 0xD8, 0xB4, 0xD8, 0xAA, 0xD8, 0xAB, 0xD8, 0xAE, 0xD8, 0xB6, 0xD8, 0xBA, 0xD8, 0xAC,
+        0xD8, 0xAD, 0xD9, 0x8A, 0xD9, 0x84, 0xD9, 0x86, 0xD8, 0xB3, 0xD8, 0xB9, 0xD8, 0xB5, 0xD9, 0x82,
+        0xD8, 0xB4, 0xD8, 0xAE, 0xD8, 0xB6, 0xD8, 0xBA, 0xDA, 0xBA, 0xD9, 0xAF, 0xD8, 0xA8, 0xD8, 0xAC,
+        0xD9, 0x87, 0xD8, 0xAD, 0xD8, 0xB7, 0xD9, 0x8A, 0xD9, 0x83, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xB3,
+        0xD8, 0xB9, 0xD9, 0x81, 0xD8, 0xB5, 0xD9, 0x82, 0xD8, 0xB4, 0xD8, 0xAA, 0xD8, 0xAB, 0xD8, 0xAE,
+        0xD8, 0xB6, 0xD8, 0xB8, 0xD8, 0xBA, 0xD9, 0xAE, 0xDA, 0xA1, 0xD8, 0xA7, 0xD8, 0xA8, 0xD8, 0xAC,
+        0xD8, 0xAF, 0xD9, 0x87, 0xD9, 0x88, 0xD8, 0xB2, 0xD8, 0xAD, 0xD8, 0xB7, 0xD9, 0x8A, 0xD9, 0x84,
+        0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xB3, 0xD8, 0xB9, 0xD9, 0x81, 0xD8, 0xB5, 0xD9, 0x82, 0xD8, 0xB1,
+        0xD8, 0xB4, 0xD8, 0xAA, 0xD8, 0xAB, 0xD8, 0xAE, 0xD8, 0xB0, 0xD8, 0xB6, 0xD8, 0xB8, 0xD8, 0xBA,
+        0xD8, 0xA8, 0xD8, 0xAC, 0xD8, 0xAF, 0xD9, 0x88, 0xD8, 0xB2, 0xD8, 0xAD, 0xD8, 0xB7, 0xD9, 0x8A,
+        0xD9, 0x84, 0xD9, 0x85, 0xD9, 0x86, 0xD8, 0xB3, 0xD8, 0xB9, 0xD9, 0x81, 0xD8, 0xB5, 0xD9, 0x82,
+        0xD8, 0xB1, 0xD8, 0xB4, 0xD8, 0xAA, 0xD8, 0xAB, 0xD8, 0xAE, 0xD8, 0xB0, 0xD8, 0xB6, 0xD8, 0xB8,
+        0xD8, 0xBA, 0x30, 0x2E, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C, 0x35, 0x2C,
+        0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x28, 0x41, 0x29, 0x28, 0x42, 0x29, 0x28, 0x43,
+        0x29, 0x28, 0x44, 0x29, 0x28, 0x45, 0x29, 0x28, 0x46, 0x29, 0x28, 0x47, 0x29, 0x28, 0x48, 0x29,
+        0x28, 0x49, 0x29, 0x28, 0x4A, 0x29, 0x28, 0x4B, 0x29, 0x28, 0x4C, 0x29, 0x28, 0x4D, 0x29, 0x28,
+        0x4E, 0x29, 0x28, 0x4F, 0x29, 0x28, 0x50, 0x29, 0x28, 0x51, 0x29, 0x28, 0x52, 0x29, 0x28, 0x53,
+        0x29, 0x28, 0x54, 0x29, 0x28, 0x55, 0x29, 0x28, 0x56, 0x29, 0x28, 0x57, 0x29, 0x28, 0x58, 0x29,
+        0x28, 0x59, 0x29, 0x28, 0x5A, 0x29, 0xE3, 0x80, 0x94, 0x53, 0xE3, 0x80, 0x95, 0x43, 0x52, 0x43,
+        0x44, 0x57, 0x5A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D,
+        0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x48, 0x56, 0x4D,
+        0x56, 0x53, 0x44, 0x53, 0x53, 0x50, 0x50, 0x56, 0x57, 0x43, 0x4D, 0x43, 0x4D, 0x44, 0x4D, 0x52,
+        0x44, 0x4A, 0xE3, 0x81, 0xBB, 0xE3, 0x81, 0x8B, 0xE3, 0x82, 0xB3, 0xE3, 0x82, 0xB3, 0xE3, 0x82,
+        0xB5, 0xE6, 0x89, 0x8B, 0xE5, 0xAD, 0x97, 0xE5, 0x8F, 0x8C, 0xE3, 0x83, 0x86, 0xE3, 0x82, 0x99,
+        0xE4, 0xBA, 0x8C, 0xE5, 0xA4, 0x9A, 0xE8, 0xA7, 0xA3, 0xE5, 0xA4, 0xA9, 0xE4, 0xBA, 0xA4, 0xE6,
+        0x98, 0xA0, 0xE7, 0x84, 0xA1, 0xE6, 0x96, 0x99, 0xE5, 0x89, 0x8D, 0xE5, 0xBE, 0x8C, 0xE5, 0x86,
+        0x8D, 0xE6, 0x96, 0xB0, 0xE5, 0x88, 0x9D, 0xE7, 0xB5, 0x82, 0xE7, 0x94, 0x9F, 0xE8, 0xB2, 0xA9,
+        0xE5, 0xA3, 0xB0, 0xE5, 0x90, 0xB9, 0xE6, 0xBC, 0x94, 0xE6, 0x8A, 0x95, 0xE6, 0x8D, 0x95, 0xE4,
+        0xB8, 0x80, 0xE4, 0xB8, 0x89, 0xE9, 0x81, 0x8A, 0xE5, 0xB7, 0xA6, 0xE4, 0xB8, 0xAD, 0xE5, 0x8F,
+        0xB3, 0xE6, 0x8C, 0x87, 0xE8, 0xB5, 0xB0, 0xE6, 0x89, 0x93, 0xE7, 0xA6, 0x81, 0xE7, 0xA9, 0xBA,
+        0xE5, 0x90, 0x88, 0xE6, 0xBA, 0x80, 0xE6, 0x9C, 0x89, 0xE6, 0x9C, 0x88, 0xE7, 0x94, 0xB3, 0xE5,
+        0x89, 0xB2, 0xE5, 0x96, 0xB6, 0xE9, 0x85, 0x8D, 0xE3, 0x80, 0x94, 0xE6, 0x9C, 0xAC, 0xE3, 0x80,
+        0x95, 0xE3, 0x80, 0x94, 0xE4, 0xB8, 0x89, 0xE3, 0x80, 0x95, 0xE3, 0x80, 0x94, 0xE4, 0xBA, 0x8C,
+        0xE3, 0x80, 0x95, 0xE3, 0x80, 0x94, 0xE5, 0xAE, 0x89, 0xE3, 0x80, 0x95, 0xE3, 0x80, 0x94, 0xE7,
+        0x82, 0xB9, 0xE3, 0x80, 0x95, 0xE3, 0x80, 0x94, 0xE6, 0x89, 0x93, 0xE3, 0x80, 0x95, 0xE3, 0x80,
+        0x94, 0xE7, 0x9B, 0x97, 0xE3, 0x80, 0x95, 0xE3, 0x80, 0x94, 0xE5, 0x8B, 0x9D, 0xE3, 0x80, 0x95,
+        0xE3, 0x80, 0x94, 0xE6, 0x95, 0x97, 0xE3, 0x80, 0x95, 0xE5, 0xBE, 0x97, 0xE5, 0x8F, 0xAF, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xE4, 0xB8, 0xBD, 0xE4, 0xB8, 0xBD, 0xE4,
+        0xB8, 0xB8, 0xE4, 0xB8, 0xB8, 0xE4, 0xB9, 0x81, 0xE4, 0xB9, 0x81, 0xF0, 0xA0, 0x84, 0xA2, 0xF0,
+        0xA0, 0x84, 0xA2, 0xE4, 0xBD, 0xA0, 0xE4, 0xBD, 0xA0, 0xE4, 0xBE, 0xAE, 0xE4, 0xBE, 0xAE, 0xE4,
+        0xBE, 0xBB, 0xE4, 0xBE, 0xBB, 0xE5, 0x80, 0x82, 0xE5, 0x80, 0x82, 0xE5, 0x81, 0xBA, 0xE5, 0x81,
+        0xBA, 0xE5, 0x82, 0x99, 0xE5, 0x82, 0x99, 0xE5, 0x83, 0xA7, 0xE5, 0x83, 0xA7, 0xE5, 0x83, 0x8F,
+        0xE5, 0x83, 0x8F, 0xE3, 0x92, 0x9E, 0xE3, 0x92, 0x9E, 0xF0, 0xA0, 0x98, 0xBA, 0xF0, 0xA0, 0x98,
+        0xBA, 0xE5, 0x85, 0x8D, 0xE5, 0x85, 0x8D, 0xE5, 0x85, 0x94, 0xE5, 0x85, 0x94, 0xE5, 0x85, 0xA4,
+        0xE5, 0x85, 0xA4, 0xE5, 0x85, 0xB7, 0xE5, 0x85, 0xB7, 0xF0, 0xA0, 0x94, 0x9C, 0xF0, 0xA0, 0x94,
+        0x9C, 0xE3, 0x92, 0xB9, 0xE3, 0x92, 0xB9, 0xE5, 0x85, 0xA7, 0xE5, 0x85, 0xA7, 0xE5, 0x86, 0x8D,
+        0xE5, 0x86, 0x8D, 0xF0, 0xA0, 0x95, 0x8B, 0xF0, 0xA0, 0x95, 0x8B, 0xE5, 0x86, 0x97, 0xE5, 0x86,
+        0x97, 0xE5, 0x86, 0xA4, 0xE5, 0x86, 0xA4, 0xE4, 0xBB, 0x8C, 0xE4, 0xBB, 0x8C, 0xE5, 0x86, 0xAC,
+        0xE5, 0x86, 0xAC, 0xE5, 0x86, 0xB5, 0xE5, 0x86, 0xB5, 0xF0, 0xA9, 0x87, 0x9F, 0xF0, 0xA9, 0x87,
+        0x9F, 0xE5, 0x87, 0xB5, 0xE5, 0x87, 0xB5, 0xE5, 0x88, 0x83, 0xE5, 0x88, 0x83, 0xE3, 0x93, 0x9F,
+        0xE3, 0x93, 0x9F, 0xE5, 0x88, 0xBB, 0xE5, 0x88, 0xBB, 0xE5, 0x89, 0x86, 0xE5, 0x89, 0x86, 0xE5,
+        0x89, 0xB2, 0xE5, 0x89, 0xB2, 0xE5, 0x89, 0xB7, 0xE5, 0x89, 0xB7, 0xE3, 0x94, 0x95, 0xE3, 0x94,
+        0x95, 0xE5, 0x8B, 0x87, 0xE5, 0x8B, 0x87, 0xE5, 0x8B, 0x89, 0xE5, 0x8B, 0x89, 0xE5, 0x8B, 0xA4,
+        0xE5, 0x8B, 0xA4, 0xE5, 0x8B, 0xBA, 0xE5, 0x8B, 0xBA, 0xE5, 0x8C, 0x85, 0xE5, 0x8C, 0x85, 0xE5,
+        0x8C, 0x86, 0xE5, 0x8C, 0x86, 0xE5, 0x8C, 0x97, 0xE5, 0x8C, 0x97, 0xE5, 0x8D, 0x89, 0xE5, 0x8D,
+        0x89, 0xE5, 0x8D, 0x91, 0xE5, 0x8D, 0x91, 0xE5, 0x8D, 0x9A, 0xE5, 0x8D, 0x9A, 0xE5, 0x8D, 0xB3,
+        0xE5, 0x8D, 0xB3, 0xE5, 0x8D, 0xBD, 0xE5, 0x8D, 0xBD, 0xE5, 0x8D, 0xBF, 0xE5, 0x8D, 0xBF, 0xE5,
+        0x8D, 0xBF, 0xE5, 0x8D, 0xBF, 0xE5, 0x8D, 0xBF, 0xE5, 0x8D, 0xBF, 0xF0, 0xA0, 0xA8, 0xAC, 0xF0,
+        0xA0, 0xA8, 0xAC, 0xE7, 0x81, 0xB0, 0xE7, 0x81, 0xB0, 0xE5, 0x8F, 0x8A, 0xE5, 0x8F, 0x8A, 0xE5,
+        0x8F, 0x9F, 0xE5, 0x8F, 0x9F, 0xF0, 0xA0, 0xAD, 0xA3, 0xF0, 0xA0, 0xAD, 0xA3, 0xE5, 0x8F, 0xAB,
+        0xE5, 0x8F, 0xAB, 0xE5, 0x8F, 0xB1, 0xE5, 0x8F, 0xB1, 0xE5, 0x90, 0x86, 0xE5, 0x90, 0x86, 0xE5,
+        0x92, 0x9E, 0xE5, 0x92, 0x9E, 0xE5, 0x90, 0xB8, 0xE5, 0x90, 0xB8, 0xE5, 0x91, 0x88, 0xE5, 0x91,
+        0x88, 0xE5, 0x91, 0xA8, 0xE5, 0x91, 0xA8, 0xE5, 0x92, 0xA2, 0xE5, 0x92, 0xA2, 0xE5, 0x93, 0xB6,
+        0xE5, 0x93, 0xB6, 0xE5, 0x94, 0x90, 0xE5, 0x94, 0x90, 0xE5, 0x95, 0x93, 0xE5, 0x95, 0x93, 0xE5,
+        0x95, 0xA3, 0xE5, 0x95, 0xA3, 0xE5, 0x96, 0x84, 0xE5, 0x96, 0x84, 0xE5, 0x96, 0x84, 0xE5, 0x96,
+        0x84, 0xE5, 0x96, 0x99, 0xE5, 0x96, 0x99, 0xE5, 0x96, 0xAB, 0xE5, 0x96, 0xAB, 0xE5, 0x96, 0xB3,
+        0xE5, 0x96, 0xB3, 0xE5, 0x97, 0x82, 0xE5, 0x97, 0x82, 0xE5, 0x9C, 0x96, 0xE5, 0x9C, 0x96, 0xE5,
+        0x98, 0x86, 0xE5, 0x98, 0x86, 0xE5, 0x9C, 0x97, 0xE5, 0x9C, 0x97, 0xE5, 0x99, 0x91, 0xE5, 0x99,
+        0x91, 0xE5, 0x99, 0xB4, 0xE5, 0x99, 0xB4, 0xE5, 0x88, 0x87, 0xE5, 0x88, 0x87, 0xE5, 0xA3, 0xAE,
+        0xE5, 0xA3, 0xAE, 0xE5, 0x9F, 0x8E, 0xE5, 0x9F, 0x8E, 0xE5, 0x9F, 0xB4, 0xE5, 0x9F, 0xB4, 0xE5,
+        0xA0, 0x8D, 0xE5, 0xA0, 0x8D, 0xE5, 0x9E, 0x8B, 0xE5, 0x9E, 0x8B, 0xE5, 0xA0, 0xB2, 0xE5, 0xA0,
+        0xB2, 0xE5, 0xA0, 0xB1, 0xE5, 0xA0, 0xB1, 0xE5, 0xA2, 0xAC, 0xE5, 0xA2, 0xAC, 0xF0, 0xA1, 0x93,
+        0xA4, 0xF0, 0xA1, 0x93, 0xA4, 0xE5, 0xA3, 0xB2, 0xE5, 0xA3, 0xB2, 0xE5, 0xA3, 0xB7, 0xE5, 0xA3,
+        0xB7, 0xE5, 0xA4, 0x86, 0xE5, 0xA4, 0x86, 0xE5, 0xA4, 0x9A, 0xE5, 0xA4, 0x9A, 0xE5, 0xA4, 0xA2,
+        0xE5, 0xA4, 0xA2, 0xE5, 0xA5, 0xA2, 0xE5, 0xA5, 0xA2, 0xF0, 0xA1, 0x9A, 0xA8, 0xF0, 0xA1, 0x9A,
+        0xA8, 0xF0, 0xA1, 0x9B, 0xAA, 0xF0, 0xA1, 0x9B, 0xAA, 0xE5, 0xA7, 0xAC, 0xE5, 0xA7, 0xAC, 0xE5,
+        0xA8, 0x9B, 0xE5, 0xA8, 0x9B, 0xE5, 0xA8, 0xA7, 0xE5, 0xA8, 0xA7, 0xE5, 0xA7, 0x98, 0xE5, 0xA7,
+        0x98, 0xE5, 0xA9, 0xA6, 0xE5, 0xA9, 0xA6, 0xE3, 0x9B, 0xAE, 0xE3, 0x9B, 0xAE, 0xE3, 0x9B, 0xBC,
+        0xE3, 0x9B, 0xBC, 0xE5, 0xAC, 0x88, 0xE5, 0xAC, 0x88, 0xE5, 0xAC, 0xBE, 0xE5, 0xAC, 0xBE, 0xE5,
+        0xAC, 0xBE, 0xE5, 0xAC, 0xBE, 0xF0, 0xA1, 0xA7, 0x88, 0xF0, 0xA1, 0xA7, 0x88, 0xE5, 0xAF, 0x83,
+        0xE5, 0xAF, 0x83, 0xE5, 0xAF, 0x98, 0xE5, 0xAF, 0x98, 0xE5, 0xAF, 0xA7, 0xE5, 0xAF, 0xA7, 0xE5,
+        0xAF, 0xB3, 0xE5, 0xAF, 0xB3, 0xF0, 0xA1, 0xAC, 0x98, 0xF0, 0xA1, 0xAC, 0x98, 0xE5, 0xAF, 0xBF,
+        0xE5, 0xAF, 0xBF, 0xE5, 0xB0, 0x86, 0xE5, 0xB0, 0x86, 0xE5, 0xBD, 0x93, 0xE5, 0xBD, 0x93, 0xE5,
+        0xB0, 0xA2, 0xE5, 0xB0, 0xA2, 0xE3, 0x9E, 0x81, 0xE3, 0x9E, 0x81, 0xE5, 0xB1, 0xA0, 0xE5, 0xB1,
+        0xA0, 0xE5, 0xB1, 0xAE, 0xE5, 0xB1, 0xAE, 0xE5, 0xB3, 0x80, 0xE5, 0xB3, 0x80, 0xE5, 0xB2, 0x8D,
+        0xE5, 0xB2, 0x8D, 0xF0, 0xA1, 0xB7, 0xA4, 0xF0, 0xA1, 0xB7, 0xA4, 0xE5, 0xB5, 0x83, 0xE5, 0xB5,
+        0x83, 0xF0, 0xA1, 0xB7, 0xA6, 0xF0, 0xA1, 0xB7, 0xA6, 0xE5, 0xB5, 0xAE, 0xE5, 0xB5, 0xAE, 0xE5,
+        0xB5, 0xAB, 0xE5, 0xB5, 0xAB, 0xE5, 0xB5, 0xBC, 0xE5, 0xB5, 0xBC, 0xE5, 0xB7, 0xA1, 0xE5, 0xB7,
+        0xA1, 0xE5, 0xB7, 0xA2, 0xE5, 0xB7, 0xA2, 0xE3, 0xA0, 0xAF, 0xE3, 0xA0, 0xAF, 0xE5, 0xB7, 0xBD,
+        0xE5, 0xB7, 0xBD, 0xE5, 0xB8, 0xA8, 0xE5, 0xB8, 0xA8, 0xE5, 0xB8, 0xBD, 0xE5, 0xB8, 0xBD, 0xE5,
+        0xB9, 0xA9, 0xE5, 0xB9, 0xA9, 0xE3, 0xA1, 0xA2, 0xE3, 0xA1, 0xA2, 0xF0, 0xA2, 0x86, 0x83, 0xF0,
+        0xA2, 0x86, 0x83, 0xE3, 0xA1, 0xBC, 0xE3, 0xA1, 0xBC, 0xE5, 0xBA, 0xB0, 0xE5, 0xBA, 0xB0, 0xE5,
+        0xBA, 0xB3, 0xE5, 0xBA, 0xB3, 0xE5, 0xBA, 0xB6, 0xE5, 0xBA, 0xB6, 0xE5, 0xBB, 0x8A, 0xE5, 0xBB,
+        0x8A, 0xF0, 0xAA, 0x8E, 0x92, 0xF0, 0xAA, 0x8E, 0x92, 0xE5, 0xBB, 0xBE, 0xE5, 0xBB, 0xBE, 0xF0,
+        0xA2, 0x8C, 0xB1, 0xF0, 0xA2, 0x8C, 0xB1, 0xF0, 0xA2, 0x8C, 0xB1, 0xF0, 0xA2, 0x8C, 0xB1, 0xE8,
+        0x88, 0x81, 0xE8, 0x88, 0x81, 0xE5, 0xBC, 0xA2, 0xE5, 0xBC, 0xA2, 0xE5, 0xBC, 0xA2, 0xE5, 0xBC,
+        0xA2, 0xE3, 0xA3, 0x87, 0xE3, 0xA3, 0x87, 0xF0, 0xA3, 0x8A, 0xB8, 0xF0, 0xA3, 0x8A, 0xB8, 0xF0,
+        0xA6, 0x87, 0x9A, 0xF0, 0xA6, 0x87, 0x9A, 0xE5, 0xBD, 0xA2, 0xE5, 0xBD, 0xA2, 0xE5, 0xBD, 0xAB,
+        0xE5, 0xBD, 0xAB, 0xE3, 0xA3, 0xA3, 0xE3, 0xA3, 0xA3, 0xE5, 0xBE, 0x9A, 0xE5, 0xBE, 0x9A, 0xE5,
+        0xBF, 0x8D, 0xE5, 0xBF, 0x8D, 0xE5, 0xBF, 0x97, 0xE5, 0xBF, 0x97, 0xE5, 0xBF, 0xB9, 0xE5, 0xBF,
+        0xB9, 0xE6, 0x82, 0x81, 0xE6, 0x82, 0x81, 0xE3, 0xA4, 0xBA, 0xE3, 0xA4, 0xBA, 0xE3, 0xA4, 0x9C,
+        0xE3, 0xA4, 0x9C, 0xE6, 0x82, 0x94, 0xE6, 0x82, 0x94, 0xF0, 0xA2, 0x9B, 0x94, 0xF0, 0xA2, 0x9B,
+        0x94, 0xE6, 0x83, 0x87, 0xE6, 0x83, 0x87, 0xE6, 0x85, 0x88, 0xE6, 0x85, 0x88, 0xE6, 0x85, 0x8C,
+        0xE6, 0x85, 0x8C, 0xE6, 0x85, 0x8E, 0xE6, 0x85, 0x8E, 0xE6, 0x85, 0x8C, 0xE6, 0x85, 0x8C, 0xE6,
+        0x85, 0xBA, 0xE6, 0x85, 0xBA, 0xE6, 0x86, 0x8E, 0xE6, 0x86, 0x8E, 0xE6, 0x86, 0xB2, 0xE6, 0x86,
+        0xB2, 0xE6, 0x86, 0xA4, 0xE6, 0x86, 0xA4, 0xE6, 0x86, 0xAF, 0xE6, 0x86, 0xAF, 0xE6, 0x87, 0x9E,
+        0xE6, 0x87, 0x9E, 0xE6, 0x87, 0xB2, 0xE6, 0x87, 0xB2, 0xE6, 0x87, 0xB6, 0xE6, 0x87, 0xB6, 0xE6,
+        0x88, 0x90, 0xE6, 0x88, 0x90, 0xE6, 0x88, 0x9B, 0xE6, 0x88, 0x9B, 0xE6, 0x89, 0x9D, 0xE6, 0x89,
+        0x9D, 0xE6, 0x8A, 0xB1, 0xE6, 0x8A, 0xB1, 0xE6, 0x8B, 0x94, 0xE6, 0x8B, 0x94, 0xE6, 0x8D, 0x90,
+        0xE6, 0x8D, 0x90, 0xF0, 0xA2, 0xAC, 0x8C, 0xF0, 0xA2, 0xAC, 0x8C, 0xE6, 0x8C, 0xBD, 0xE6, 0x8C,
+        0xBD, 0xE6, 0x8B, 0xBC, 0xE6, 0x8B, 0xBC, 0xE6, 0x8D, 0xA8, 0xE6, 0x8D, 0xA8, 0xE6, 0x8E, 0x83,
+        0xE6, 0x8E, 0x83, 0xE6, 0x8F, 0xA4, 0xE6, 0x8F, 0xA4, 0xF0, 0xA2, 0xAF, 0xB1, 0xF0, 0xA2, 0xAF,
+        0xB1, 0xE6, 0x90, 0xA2, 0xE6, 0x90, 0xA2, 0xE6, 0x8F, 0x85, 0xE6, 0x8F, 0x85, 0xE6, 0x8E, 0xA9,
+        0xE6, 0x8E, 0xA9, 0xE3, 0xA8, 0xAE, 0xE3, 0xA8, 0xAE, 0xE6, 0x91, 0xA9, 0xE6, 0x91, 0xA9, 0xE6,
+        0x91, 0xBE, 0xE6, 0x91, 0xBE, 0xE6, 0x92, 0x9D, 0xE6, 0x92, 0x9D, 0xE6, 0x91, 0xB7, 0xE6, 0x91,
+        0xB7, 0xE3, 0xA9, 0xAC, 0xE3, 0xA9, 0xAC, 0xE6, 0x95, 0x8F, 0xE6, 0x95, 0x8F, 0xE6, 0x95, 0xAC,
+        0xE6, 0x95, 0xAC, 0xF0, 0xA3, 0x80, 0x8A, 0xF0, 0xA3, 0x80, 0x8A, 0xE6, 0x97, 0xA3, 0xE6, 0x97,
+        0xA3, 0xE6, 0x9B, 0xB8, 0xE6, 0x9B, 0xB8, 0xE6, 0x99, 0x89, 0xE6, 0x99, 0x89, 0xE3, 0xAC, 0x99,
+        0xE3, 0xAC, 0x99, 0xE6, 0x9A, 0x91, 0xE6, 0x9A, 0x91, 0xE3, 0xAC, 0x88, 0xE3, 0xAC, 0x88, 0xE3,
+        0xAB, 0xA4, 0xE3, 0xAB, 0xA4, 0xE5, 0x86, 0x92, 0xE5, 0x86, 0x92, 0xE5, 0x86, 0x95, 0xE5, 0x86,
+        0x95, 0xE6, 0x9C, 0x80, 0xE6, 0x9C, 0x80, 0xE6, 0x9A, 0x9C, 0xE6, 0x9A, 0x9C, 0xE8, 0x82, 0xAD,
+        0xE8, 0x82, 0xAD, 0xE4, 0x8F, 0x99, 0xE4, 0x8F, 0x99, 0xE6, 0x9C, 0x97, 0xE6, 0x9C, 0x97, 0xE6,
+        0x9C, 0x9B, 0xE6, 0x9C, 0x9B, 0xE6, 0x9C, 0xA1, 0xE6, 0x9C, 0xA1, 0xE6, 0x9D, 0x9E, 0xE6, 0x9D,
+        0x9E, 0xE6, 0x9D, 0x93, 0xE6, 0x9D, 0x93, 0xF0, 0xA3, 0x8F, 0x83, 0xF0, 0xA3, 0x8F, 0x83, 0xE3,
+        0xAD, 0x89, 0xE3, 0xAD, 0x89, 0xE6, 0x9F, 0xBA, 0xE6, 0x9F, 0xBA, 0xE6, 0x9E, 0x85, 0xE6, 0x9E,
+        0x85, 0xE6, 0xA1, 0x92, 0xE6, 0xA1, 0x92, 0xE6, 0xA2, 0x85, 0xE6, 0xA2, 0x85, 0xF0, 0xA3, 0x91,
+        0xAD, 0xF0, 0xA3, 0x91, 0xAD, 0xE6, 0xA2, 0x8E, 0xE6, 0xA2, 0x8E, 0xE6, 0xA0, 0x9F, 0xE6, 0xA0,
+        0x9F, 0xE6, 0xA4, 0x94, 0xE6, 0xA4, 0x94, 0xE3, 0xAE, 0x9D, 0xE3, 0xAE, 0x9D, 0xE6, 0xA5, 0x82,
+        0xE6, 0xA5, 0x82, 0xE6, 0xA6, 0xA3, 0xE6, 0xA6, 0xA3, 0xE6, 0xA7, 0xAA, 0xE6, 0xA7, 0xAA, 0xE6,
+        0xAA, 0xA8, 0xE6, 0xAA, 0xA8, 0xF0, 0xA3, 0x9A, 0xA3, 0xF0, 0xA3, 0x9A, 0xA3, 0xE6, 0xAB, 0x9B,
+        0xE6, 0xAB, 0x9B, 0xE3, 0xB0, 0x98, 0xE3, 0xB0, 0x98, 0xE6, 0xAC, 0xA1, 0xE6, 0xAC, 0xA1, 0xF0,
+        0xA3, 0xA2, 0xA7, 0xF0, 0xA3, 0xA2, 0xA7, 0xE6, 0xAD, 0x94, 0xE6, 0xAD, 0x94, 0xE3, 0xB1, 0x8E,
+        0xE3, 0xB1, 0x8E, 0xE6, 0xAD, 0xB2, 0xE6, 0xAD, 0xB2, 0xE6, 0xAE, 0x9F, 0xE6, 0xAE, 0x9F, 0xE6,
+        0xAE, 0xBA, 0xE6, 0xAE, 0xBA, 0xE6, 0xAE, 0xBB, 0xE6, 0xAE, 0xBB, 0xF0, 0xA3, 0xAA, 0x8D, 0xF0,
+        0xA3, 0xAA, 0x8D, 0xF0, 0xA1, 0xB4, 0x8B, 0xF0, 0xA1, 0xB4, 0x8B, 0xF0, 0xA3, 0xAB, 0xBA, 0xF0,
+        0xA3, 0xAB, 0xBA, 0xE6, 0xB1, 0x8E, 0xE6, 0xB1, 0x8E, 0xF0, 0xA3, 0xB2, 0xBC, 0xF0, 0xA3, 0xB2,
+        0xBC, 0xE6, 0xB2, 0xBF, 0xE6, 0xB2, 0xBF, 0xE6, 0xB3, 0x8D, 0xE6, 0xB3, 0x8D, 0xE6, 0xB1, 0xA7,
+        0xE6, 0xB1, 0xA7, 0xE6, 0xB4, 0x96, 0xE6, 0xB4, 0x96, 0xE6, 0xB4, 0xBE, 0xE6, 0xB4, 0xBE, 0xE6,
+        0xB5, 0xB7, 0xE6, 0xB5, 0xB7, 0xE6, 0xB5, 0x81, 0xE6, 0xB5, 0x81, 0xE6, 0xB5, 0xA9, 0xE6, 0xB5,
+        0xA9, 0xE6, 0xB5, 0xB8, 0xE6, 0xB5, 0xB8, 0xE6, 0xB6, 0x85, 0xE6, 0xB6, 0x85, 0xF0, 0xA3, 0xB4,
+        0x9E, 0xF0, 0xA3, 0xB4, 0x9E, 0xE6, 0xB4, 0xB4, 0xE6, 0xB4, 0xB4, 0xE6, 0xB8, 0xAF, 0xE6, 0xB8,
+        0xAF, 0xE6, 0xB9, 0xAE, 0xE6, 0xB9, 0xAE, 0xE3, 0xB4, 0xB3, 0xE3, 0xB4, 0xB3, 0xE6, 0xBB, 0x8B,
+        0xE6, 0xBB, 0x8B, 0xE6, 0xBB, 0x87, 0xE6, 0xBB, 0x87, 0xF0, 0xA3, 0xBB, 0x91, 0xF0, 0xA3, 0xBB,
+        0x91, 0xE6, 0xB7, 0xB9, 0xE6, 0xB7, 0xB9, 0xE6, 0xBD, 0xAE, 0xE6, 0xBD, 0xAE, 0xF0, 0xA3, 0xBD,
+        0x9E, 0xF0, 0xA3, 0xBD, 0x9E, 0xF0, 0xA3, 0xBE, 0x8E, 0xF0, 0xA3, 0xBE, 0x8E, 0xE6, 0xBF, 0x86,
+        0xE6, 0xBF, 0x86, 0xE7, 0x80, 0xB9, 0xE7, 0x80, 0xB9, 0xE7, 0x80, 0x9E, 0xE7, 0x80, 0x9E, 0xE7,
+        0x80, 0x9B, 0xE7, 0x80, 0x9B, 0xE3, 0xB6, 0x96, 0xE3, 0xB6, 0x96, 0xE7, 0x81, 0x8A, 0xE7, 0x81,
+        0x8A, 0xE7, 0x81, 0xBD, 0xE7, 0x81, 0xBD, 0xE7, 0x81, 0xB7, 0xE7, 0x81, 0xB7, 0xE7, 0x82, 0xAD,
+        0xE7, 0x82, 0xAD, 0xF0, 0xA0, 0x94, 0xA5, 0xF0, 0xA0, 0x94, 0xA5, 0xE7, 0x85, 0x85, 0xE7, 0x85,
+        0x85, 0xF0, 0xA4, 0x89, 0xA3, 0xF0, 0xA4, 0x89, 0xA3, 0xE7, 0x86, 0x9C, 0xE7, 0x86, 0x9C, 0xF0,
+        0xA4, 0x8E, 0xAB, 0xF0, 0xA4, 0x8E, 0xAB, 0xE7, 0x88, 0xA8, 0xE7, 0x88, 0xA8, 0xE7, 0x88, 0xB5,
+        0xE7, 0x88, 0xB5, 0xE7, 0x89, 0x90, 0xE7, 0x89, 0x90, 0xF0, 0xA4, 0x98, 0x88, 0xF0, 0xA4, 0x98,
+        0x88, 0xE7, 0x8A, 0x80, 0xE7, 0x8A, 0x80, 0xE7, 0x8A, 0x95, 0xE7, 0x8A, 0x95, 0xF0, 0xA4, 0x9C,
+        0xB5, 0xF0, 0xA4, 0x9C, 0xB5, 0xF0, 0xA4, 0xA0, 0x94, 0xF0, 0xA4, 0xA0, 0x94, 0xE7, 0x8D, 0xBA,
+        0xE7, 0x8D, 0xBA, 0xE7, 0x8E, 0x8B, 0xE7, 0x8E, 0x8B, 0xE3, 0xBA, 0xAC, 0xE3, 0xBA, 0xAC, 0xE7,
+        0x8E, 0xA5, 0xE7, 0x8E, 0xA5, 0xE3, 0xBA, 0xB8, 0xE3, 0xBA, 0xB8, 0xE3, 0xBA, 0xB8, 0xE3, 0xBA,
+        0xB8, 0xE7, 0x91, 0x87, 0xE7, 0x91, 0x87, 0xE7, 0x91, 0x9C, 0xE7, 0x91, 0x9C, 0xE7, 0x91, 0xB1,
+        0xE7, 0x91, 0xB1, 0xE7, 0x92, 0x85, 0xE7, 0x92, 0x85, 0xE7, 0x93, 0x8A, 0xE7, 0x93, 0x8A, 0xE3,
+        0xBC, 0x9B, 0xE3, 0xBC, 0x9B, 0xE7, 0x94, 0xA4, 0xE7, 0x94, 0xA4, 0xF0, 0xA4, 0xB0, 0xB6, 0xF0,
+        0xA4, 0xB0, 0xB6, 0xE7, 0x94, 0xBE, 0xE7, 0x94, 0xBE, 0xF0, 0xA4, 0xB2, 0x92, 0xF0, 0xA4, 0xB2,
+        0x92, 0xE7, 0x95, 0xB0, 0xE7, 0x95, 0xB0, 0xF0, 0xA2, 0x86, 0x9F, 0xF0, 0xA2, 0x86, 0x9F, 0xE7,
+        0x98, 0x90, 0xE7, 0x98, 0x90, 0xF0, 0xA4, 0xBE, 0xA1, 0xF0, 0xA4, 0xBE, 0xA1, 0xF0, 0xA4, 0xBE,
+        0xB8, 0xF0, 0xA4, 0xBE, 0xB8, 0xF0, 0xA5, 0x81, 0x84, 0xF0, 0xA5, 0x81, 0x84, 0xE3, 0xBF, 0xBC,
+        0xE3, 0xBF, 0xBC, 0xE4, 0x80, 0x88, 0xE4, 0x80, 0x88, 0xE7, 0x9B, 0xB4, 0xE7, 0x9B, 0xB4, 0xF0,
+        0xA5, 0x83, 0xB3, 0xF0, 0xA5, 0x83, 0xB3, 0xF0, 0xA5, 0x83, 0xB2, 0xF0, 0xA5, 0x83, 0xB2, 0xF0,
+        0xA5, 0x84, 0x99, 0xF0, 0xA5, 0x84, 0x99, 0xF0, 0xA5, 0x84, 0xB3, 0xF0, 0xA5, 0x84, 0xB3, 0xE7,
+        0x9C, 0x9E, 0xE7, 0x9C, 0x9E, 0xE7, 0x9C, 0x9F, 0xE7, 0x9C, 0x9F, 0xE7, 0x9C, 0x9F, 0xE7, 0x9C,
+        0x9F, 0xE7, 0x9D, 0x8A, 0xE7, 0x9D, 0x8A, 0xE4, 0x80, 0xB9, 0xE4, 0x80, 0xB9, 0xE7, 0x9E, 0x8B,
+        0xE7, 0x9E, 0x8B, 0xE4, 0x81, 0x86, 0xE4, 0x81, 0x86, 0xE4, 0x82, 0x96, 0xE4, 0x82, 0x96, 0xF0,
+        0xA5, 0x90, 0x9D, 0xF0, 0xA5, 0x90, 0x9D, 0xE7, 0xA1, 0x8E, 0xE7, 0xA1, 0x8E, 0xE7, 0xA2, 0x8C,
+        0xE7, 0xA2, 0x8C, 0xE7, 0xA3, 0x8C, 0xE7, 0xA3, 0x8C, 0xE4, 0x83, 0xA3, 0xE4, 0x83, 0xA3, 0xF0,
+        0xA5, 0x98, 0xA6, 0xF0, 0xA5, 0x98, 0xA6, 0xE7, 0xA5, 0x96, 0xE7, 0xA5, 0x96, 0xF0, 0xA5, 0x9A,
+        0x9A, 0xF0, 0xA5, 0x9A, 0x9A, 0xF0, 0xA5, 0x9B, 0x85, 0xF0, 0xA5, 0x9B, 0x85, 0xE7, 0xA6, 0x8F,
+        0xE7, 0xA6, 0x8F, 0xE7, 0xA7, 0xAB, 0xE7, 0xA7, 0xAB, 0xE4, 0x84, 0xAF, 0xE4, 0x84, 0xAF, 0xE7,
+        0xA9, 0x80, 0xE7, 0xA9, 0x80, 0xE7, 0xA9, 0x8A, 0xE7, 0xA9, 0x8A, 0xE7, 0xA9, 0x8F, 0xE7, 0xA9,
+        0x8F, 0xF0, 0xA5, 0xA5, 0xBC, 0xF0, 0xA5, 0xA5, 0xBC, 0xF0, 0xA5, 0xAA, 0xA7, 0xF0, 0xA5, 0xAA,
+        0xA7, 0xF0, 0xA5, 0xAA, 0xA7, 0xF0, 0xA5, 0xAA, 0xA7, 0xE7, 0xAB, 0xAE, 0xE7, 0xAB, 0xAE, 0xE4,
+        0x88, 0x82, 0xE4, 0x88, 0x82, 0xF0, 0xA5, 0xAE, 0xAB, 0xF0, 0xA5, 0xAE, 0xAB, 0xE7, 0xAF, 0x86,
+        0xE7, 0xAF, 0x86, 0xE7, 0xAF, 0x89, 0xE7, 0xAF, 0x89, 0xE4, 0x88, 0xA7, 0xE4, 0x88, 0xA7, 0xF0,
+        0xA5, 0xB2, 0x80, 0xF0, 0xA5, 0xB2, 0x80, 0xE7, 0xB3, 0x92, 0xE7, 0xB3, 0x92, 0xE4, 0x8A, 0xA0,
+        0xE4, 0x8A, 0xA0, 0xE7, 0xB3, 0xA8, 0xE7, 0xB3, 0xA8, 0xE7, 0xB3, 0xA3, 0xE7, 0xB3, 0xA3, 0xE7,
+        0xB4, 0x80, 0xE7, 0xB4, 0x80, 0xF0, 0xA5, 0xBE, 0x86, 0xF0, 0xA5, 0xBE, 0x86, 0xE7, 0xB5, 0xA3,
+        0xE7, 0xB5, 0xA3, 0xE4, 0x8C, 0x81, 0xE4, 0x8C, 0x81, 0xE7, 0xB7, 0x87, 0xE7, 0xB7, 0x87, 0xE7,
+        0xB8, 0x82, 0xE7, 0xB8, 0x82, 0xE7, 0xB9, 0x85, 0xE7, 0xB9, 0x85, 0xE4, 0x8C, 0xB4, 0xE4, 0x8C,
+        0xB4, 0xF0, 0xA6, 0x88, 0xA8, 0xF0, 0xA6, 0x88, 0xA8, 0xF0, 0xA6, 0x89, 0x87, 0xF0, 0xA6, 0x89,
+        0x87, 0xE4, 0x8D, 0x99, 0xE4, 0x8D, 0x99, 0xF0, 0xA6, 0x8B, 0x99, 0xF0, 0xA6, 0x8B, 0x99, 0xE7,
+        0xBD, 0xBA, 0xE7, 0xBD, 0xBA, 0xF0, 0xA6, 0x8C, 0xBE, 0xF0, 0xA6, 0x8C, 0xBE, 0xE7, 0xBE, 0x95,
+        0xE7, 0xBE, 0x95, 0xE7, 0xBF, 0xBA, 0xE7, 0xBF, 0xBA, 0xE8, 0x80, 0x85, 0xE8, 0x80, 0x85, 0xF0,
+        0xA6, 0x93, 0x9A, 0xF0, 0xA6, 0x93, 0x9A, 0xF0, 0xA6, 0x94, 0xA3, 0xF0, 0xA6, 0x94, 0xA3, 0xE8,
+        0x81, 0xA0, 0xE8, 0x81, 0xA0, 0xF0, 0xA6, 0x96, 0xA8, 0xF0, 0xA6, 0x96, 0xA8, 0xE8, 0x81, 0xB0,
+        0xE8, 0x81, 0xB0, 0xF0, 0xA3, 0x8D, 0x9F, 0xF0, 0xA3, 0x8D, 0x9F, 0xE4, 0x8F, 0x95, 0xE4, 0x8F,
+        0x95, 0xE8, 0x82, 0xB2, 0xE8, 0x82, 0xB2, 0xE8, 0x84, 0x83, 0xE8, 0x84, 0x83, 0xE4, 0x90, 0x8B,
+        0xE4, 0x90, 0x8B, 0xE8, 0x84, 0xBE, 0xE8, 0x84, 0xBE, 0xE5, 0xAA, 0xB5, 0xE5, 0xAA, 0xB5, 0xF0,
+        0xA6, 0x9E, 0xA7, 0xF0, 0xA6, 0x9E, 0xA7, 0xF0, 0xA6, 0x9E, 0xB5, 0xF0, 0xA6, 0x9E, 0xB5, 0xF0,
+        0xA3, 0x8E, 0x93, 0xF0, 0xA3, 0x8E, 0x93, 0xF0, 0xA3, 0x8E, 0x9C, 0xF0, 0xA3, 0x8E, 0x9C, 0xE8,
+        0x88, 0x81, 0xE8, 0x88, 0x81, 0xE8, 0x88, 0x84, 0xE8, 0x88, 0x84, 0xE8, 0xBE, 0x9E, 0xE8, 0xBE,
+        0x9E, 0xE4, 0x91, 0xAB, 0xE4, 0x91, 0xAB, 0xE8, 0x8A, 0x91, 0xE8, 0x8A, 0x91, 0xE8, 0x8A, 0x8B,
+        0xE8, 0x8A, 0x8B, 0xE8, 0x8A, 0x9D, 0xE8, 0x8A, 0x9D, 0xE5, 0x8A, 0xB3, 0xE5, 0x8A, 0xB3, 0xE8,
+        0x8A, 0xB1, 0xE8, 0x8A, 0xB1, 0xE8, 0x8A, 0xB3, 0xE8, 0x8A, 0xB3, 0xE8, 0x8A, 0xBD, 0xE8, 0x8A,
+        0xBD, 0xE8, 0x8B, 0xA6, 0xE8, 0x8B, 0xA6, 0xF0, 0xA6, 0xAC, 0xBC, 0xF0, 0xA6, 0xAC, 0xBC, 0xE8,
+        0x8B, 0xA5, 0xE8, 0x8B, 0xA5, 0xE8, 0x8C, 0x9D, 0xE8, 0x8C, 0x9D, 0xE8, 0x8D, 0xA3, 0xE8, 0x8D,
+        0xA3, 0xE8, 0x8E, 0xAD, 0xE8, 0x8E, 0xAD, 0xE8, 0x8C, 0xA3, 0xE8, 0x8C, 0xA3, 0xE8, 0x8E, 0xBD,
+        0xE8, 0x8E, 0xBD, 0xE8, 0x8F, 0xA7, 0xE8, 0x8F, 0xA7, 0xE8, 0x91, 0x97, 0xE8, 0x91, 0x97, 0xE8,
+        0x8D, 0x93, 0xE8, 0x8D, 0x93, 0xE8, 0x8F, 0x8A, 0xE8, 0x8F, 0x8A, 0xE8, 0x8F, 0x8C, 0xE8, 0x8F,
+        0x8C, 0xE8, 0x8F, 0x9C, 0xE8, 0x8F, 0x9C, 0xF0, 0xA6, 0xB0, 0xB6, 0xF0, 0xA6, 0xB0, 0xB6, 0xF0,
+        0xA6, 0xB5, 0xAB, 0xF0, 0xA6, 0xB5, 0xAB, 0xF0, 0xA6, 0xB3, 0x95, 0xF0, 0xA6, 0xB3, 0x95, 0xE4,
+        0x94, 0xAB, 0xE4, 0x94, 0xAB, 0xE8, 0x93, 0xB1, 0xE8, 0x93, 0xB1, 0xE8, 0x93, 0xB3, 0xE8, 0x93,
+        0xB3, 0xE8, 0x94, 0x96, 0xE8, 0x94, 0x96, 0xF0, 0xA7, 0x8F, 0x8A, 0xF0, 0xA7, 0x8F, 0x8A, 0xE8,
+        0x95, 0xA4, 0xE8, 0x95, 0xA4, 0xF0, 0xA6, 0xBC, 0xAC, 0xF0, 0xA6, 0xBC, 0xAC, 0xE4, 0x95, 0x9D,
+        0xE4, 0x95, 0x9D, 0xE4, 0x95, 0xA1, 0xE4, 0x95, 0xA1, 0xF0, 0xA6, 0xBE, 0xB1, 0xF0, 0xA6, 0xBE,
+        0xB1, 0xF0, 0xA7, 0x83, 0x92, 0xF0, 0xA7, 0x83, 0x92, 0xE4, 0x95, 0xAB, 0xE4, 0x95, 0xAB, 0xE8,
+        0x99, 0x90, 0xE8, 0x99, 0x90, 0xE8, 0x99, 0x9C, 0xE8, 0x99, 0x9C, 0xE8, 0x99, 0xA7, 0xE8, 0x99,
+        0xA7, 0xE8, 0x99, 0xA9, 0xE8, 0x99, 0xA9, 0xE8, 0x9A, 0xA9, 0xE8, 0x9A, 0xA9, 0xE8, 0x9A, 0x88,
+        0xE8, 0x9A, 0x88, 0xE8, 0x9C, 0x8E, 0xE8, 0x9C, 0x8E, 0xE8, 0x9B, 0xA2, 0xE8, 0x9B, 0xA2, 0xE8,
+        0x9D, 0xB9, 0xE8, 0x9D, 0xB9, 0xE8, 0x9C, 0xA8, 0xE8, 0x9C, 0xA8, 0xE8, 0x9D, 0xAB, 0xE8, 0x9D,
+        0xAB, 0xE8, 0x9E, 0x86, 0xE8, 0x9E, 0x86, 0xE4, 0x97, 0x97, 0xE4, 0x97, 0x97, 0xE8, 0x9F, 0xA1,
+        0xE8, 0x9F, 0xA1, 0xE8, 0xA0, 0x81, 0xE8, 0xA0, 0x81, 0xE4, 0x97, 0xB9, 0xE4, 0x97, 0xB9, 0xE8,
+        0xA1, 0xA0, 0xE8, 0xA1, 0xA0, 0xE8, 0xA1, 0xA3, 0xE8, 0xA1, 0xA3, 0xF0, 0xA7, 0x99, 0xA7, 0xF0,
+        0xA7, 0x99, 0xA7, 0xE8, 0xA3, 0x97, 0xE8, 0xA3, 0x97, 0xE8, 0xA3, 0x9E, 0xE8, 0xA3, 0x9E, 0xE4,
+        0x98, 0xB5, 0xE4, 0x98, 0xB5, 0xE8, 0xA3, 0xBA, 0xE8, 0xA3, 0xBA, 0xE3, 0x92, 0xBB, 0xE3, 0x92,
+        0xBB, 0xF0, 0xA7, 0xA2, 0xAE, 0xF0, 0xA7, 0xA2, 0xAE, 0xF0, 0xA7, 0xA5, 0xA6, 0xF0, 0xA7, 0xA5,
+        0xA6, 0xE4, 0x9A, 0xBE, 0xE4, 0x9A, 0xBE, 0xE4, 0x9B, 0x87, 0xE4, 0x9B, 0x87, 0xE8, 0xAA, 0xA0,
+        0xE8, 0xAA, 0xA0, 0xE8, 0xAB, 0xAD, 0xE8, 0xAB, 0xAD, 0xE8, 0xAE, 0x8A, 0xE8, 0xAE, 0x8A, 0xE8,
+        0xB1, 0x95, 0xE8, 0xB1, 0x95, 0xF0, 0xA7, 0xB2, 0xA8, 0xF0, 0xA7, 0xB2, 0xA8, 0xE8, 0xB2, 0xAB,
+        0xE8, 0xB2, 0xAB, 0xE8, 0xB3, 0x81, 0xE8, 0xB3, 0x81, 0xE8, 0xB4, 0x9B, 0xE8, 0xB4, 0x9B, 0xE8,
+        0xB5, 0xB7, 0xE8, 0xB5, 0xB7, 0xF0, 0xA7, 0xBC, 0xAF, 0xF0, 0xA7, 0xBC, 0xAF, 0xF0, 0xA0, 0xA0,
+        0x84, 0xF0, 0xA0, 0xA0, 0x84, 0xE8, 0xB7, 0x8B, 0xE8, 0xB7, 0x8B, 0xE8, 0xB6, 0xBC, 0xE8, 0xB6,
+        0xBC, 0xE8, 0xB7, 0xB0, 0xE8, 0xB7, 0xB0, 0xF0, 0xA0, 0xA3, 0x9E, 0xF0, 0xA0, 0xA3, 0x9E, 0xE8,
+        0xBB, 0x94, 0xE8, 0xBB, 0x94, 0xE8, 0xBC, 0xB8, 0xE8, 0xBC, 0xB8, 0xF0, 0xA8, 0x97, 0x92, 0xF0,
+        0xA8, 0x97, 0x92, 0xF0, 0xA8, 0x97, 0xAD, 0xF0, 0xA8, 0x97, 0xAD, 0xE9, 0x82, 0x94, 0xE9, 0x82,
+        0x94, 0xE9, 0x83, 0xB1, 0xE9, 0x83, 0xB1, 0xE9, 0x84, 0x91, 0xE9, 0x84, 0x91, 0xF0, 0xA8, 0x9C,
+        0xAE, 0xF0, 0xA8, 0x9C, 0xAE, 0xE9, 0x84, 0x9B, 0xE9, 0x84, 0x9B, 0xE9, 0x88, 0xB8, 0xE9, 0x88,
+        0xB8, 0xE9, 0x8B, 0x97, 0xE9, 0x8B, 0x97, 0xE9, 0x8B, 0x98, 0xE9, 0x8B, 0x98, 0xE9, 0x89, 0xBC,
+        0xE9, 0x89, 0xBC, 0xE9, 0x8F, 0xB9, 0xE9, 0x8F, 0xB9, 0xE9, 0x90, 0x95, 0xE9, 0x90, 0x95, 0xF0,
+        0xA8, 0xAF, 0xBA, 0xF0, 0xA8, 0xAF, 0xBA, 0xE9, 0x96, 0x8B, 0xE9, 0x96, 0x8B, 0xE4, 0xA6, 0x95,
+        0xE4, 0xA6, 0x95, 0xE9, 0x96, 0xB7, 0xE9, 0x96, 0xB7, 0xF0, 0xA8, 0xB5, 0xB7, 0xF0, 0xA8, 0xB5,
+        0xB7, 0xE4, 0xA7, 0xA6, 0xE4, 0xA7, 0xA6, 0xE9, 0x9B, 0x83, 0xE9, 0x9B, 0x83, 0xE5, 0xB6, 0xB2,
+        0xE5, 0xB6, 0xB2, 0xE9, 0x9C, 0xA3, 0xE9, 0x9C, 0xA3, 0xF0, 0xA9, 0x85, 0x85, 0xF0, 0xA9, 0x85,
+        0x85, 0xF0, 0xA9, 0x88, 0x9A, 0xF0, 0xA9, 0x88, 0x9A, 0xE4, 0xA9, 0xAE, 0xE4, 0xA9, 0xAE, 0xE4,
+        0xA9, 0xB6, 0xE4, 0xA9, 0xB6, 0xE9, 0x9F, 0xA0, 0xE9, 0x9F, 0xA0, 0xF0, 0xA9, 0x90, 0x8A, 0xF0,
+        0xA9, 0x90, 0x8A, 0xE4, 0xAA, 0xB2, 0xE4, 0xAA, 0xB2, 0xF0, 0xA9, 0x92, 0x96, 0xF0, 0xA9, 0x92,
+        0x96, 0xE9, 0xA0, 0x8B, 0xE9, 0xA0, 0x8B, 0xE9, 0xA0, 0x8B, 0xE9, 0xA0, 0x8B, 0xE9, 0xA0, 0xA9,
+        0xE9, 0xA0, 0xA9, 0xF0, 0xA9, 0x96, 0xB6, 0xF0, 0xA9, 0x96, 0xB6, 0xE9, 0xA3, 0xA2, 0xE9, 0xA3,
+        0xA2, 0xE4, 0xAC, 0xB3, 0xE4, 0xAC, 0xB3, 0xE9, 0xA4, 0xA9, 0xE9, 0xA4, 0xA9, 0xE9, 0xA6, 0xA7,
+        0xE9, 0xA6, 0xA7, 0xE9, 0xA7, 0x82, 0xE9, 0xA7, 0x82, 0xE9, 0xA7, 0xBE, 0xE9, 0xA7, 0xBE, 0xE4,
+        0xAF, 0x8E, 0xE4, 0xAF, 0x8E, 0xF0, 0xA9, 0xAC, 0xB0, 0xF0, 0xA9, 0xAC, 0xB0, 0xE9, 0xAC, 0x92,
+        0xE9, 0xAC, 0x92, 0xE9, 0xB1, 0x80, 0xE9, 0xB1, 0x80, 0xE9, 0xB3, 0xBD, 0xE9, 0xB3, 0xBD, 0xE4,
+        0xB3, 0x8E, 0xE4, 0xB3, 0x8E, 0xE4, 0xB3, 0xAD, 0xE4, 0xB3, 0xAD, 0xE9, 0xB5, 0xA7, 0xE9, 0xB5,
+        0xA7, 0xF0, 0xAA, 0x83, 0x8E, 0xF0, 0xAA, 0x83, 0x8E, 0xE4, 0xB3, 0xB8, 0xE4, 0xB3, 0xB8, 0xF0,
+        0xAA, 0x84, 0x85, 0xF0, 0xAA, 0x84, 0x85, 0xF0, 0xAA, 0x88, 0x8E, 0xF0, 0xAA, 0x88, 0x8E, 0xF0,
+        0xAA, 0x8A, 0x91, 0xF0, 0xAA, 0x8A, 0x91, 0xE9, 0xBA, 0xBB, 0xE9, 0xBA, 0xBB, 0xE4, 0xB5, 0x96,
+        0xE4, 0xB5, 0x96, 0xE9, 0xBB, 0xB9, 0xE9, 0xBB, 0xB9, 0xE9, 0xBB, 0xBE, 0xE9, 0xBB, 0xBE, 0xE9,
+        0xBC, 0x85, 0xE9, 0xBC, 0x85, 0xE9, 0xBC, 0x8F, 0xE9, 0xBC, 0x8F, 0xE9, 0xBC, 0x96, 0xE9, 0xBC,
+        0x96, 0xE9, 0xBC, 0xBB, 0xE9, 0xBC, 0xBB, 0xF0, 0xAA, 0x98, 0x80, 0xF0, 0xAA, 0x98, 0x80,
+    };
+
+    // The primary composites that aren't excluded from composition, sorted on `first` and `second`.
+    struct Composition{ char32_t first; char32_t second; char32_t composite; };
+
+    inline constexpr Composition compositions[941] =
+    {
+        { 0x003C, 0x0338, 0x226E },
+        { 0x003D, 0x0338, 0x2260 },
+        { 0x003E, 0x0338, 0x226F },
+        { 0x0041, 0x0300, 0x00C0 },
+        { 0x0041, 0x0301, 0x00C1 },
+        { 0x0041, 0x0302, 0x00C2 },
+        { 0x0041, 0x0303, 0x00C3 },
+        { 0x0041, 0x0304, 0x0100 },
+        { 0x0041, 0x0306, 0x0102 },
+        { 0x0041, 0x0307, 0x0226 },
+        { 0x0041, 0x0308, 0x00C4 },
+        { 0x0041, 0x0309, 0x1EA2 },
+        { 0x0041, 0x030A, 0x00C5 },
+        { 0x0041, 0x030C, 0x01CD },
+        { 0x0041, 0x030F, 0x0200 },
+        { 0x0041, 0x0311, 0x0202 },
+        { 0x0041, 0x0323, 0x1EA0 },
+        { 0x0041, 0x0325, 0x1E00 },
+        { 0x0041, 0x0328, 0x0104 },
+        { 0x0042, 0x0307, 0x1E02 },
+        { 0x0042, 0x0323, 0x1E04 },
+        { 0x0042, 0x0331, 0x1E06 },
+        { 0x0043, 0x0301, 0x0106 },
+        { 0x0043, 0x0302, 0x0108 },
+        { 0x0043, 0x0307, 0x010A },
+        { 0x0043, 0x030C, 0x010C },
+        { 0x0043, 0x0327, 0x00C7 },
+        { 0x0044, 0x0307, 0x1E0A },
+        { 0x0044, 0x030C, 0x010E },
+        { 0x0044, 0x0323, 0x1E0C },
+        { 0x0044, 0x0327, 0x1E10 },
+        { 0x0044, 0x032D, 0x1E12 },
+        { 0x0044, 0x0331, 0x1E0E },
+        { 0x0045, 0x0300, 0x00C8 },
+        { 0x0045, 0x0301, 0x00C9 },
+        { 0x0045, 0x0302, 0x00CA },
+        { 0x0045, 0x0303, 0x1EBC },
+        { 0x0045, 0x0304, 0x0112 },
+        { 0x0045, 0x0306, 0x0114 },
+        { 0x0045, 0x0307, 0x0116 },
+        { 0x0045, 0x0308, 0x00CB },
+        { 0x0045, 0x0309, 0x1EBA },
+        { 0x0045, 0x030C, 0x011A },
+        { 0x0045, 0x030F, 0x0204 },
+        { 0x0045, 0x0311, 0x0206 },
+        { 0x0045, 0x0323, 0x1EB8 },
+        { 0x0045, 0x0327, 0x0228 },
+        { 0x0045, 0x0328, 0x0118 },
+        { 0x0045, 0x032D, 0x1E18 },
+        { 0x0045, 0x0330, 0x1E1A },
+        { 0x0046, 0x0307, 0x1E1E },
+        { 0x0047, 0x0301, 0x01F4 },
+        { 0x0047, 0x0302, 0x011C },
+        { 0x0047, 0x0304, 0x1E20 },
+        { 0x0047, 0x0306, 0x011E },
+        { 0x0047, 0x0307, 0x0120 },
+        { 0x0047, 0x030C, 0x01E6 },
+        { 0x0047, 0x0327, 0x0122 },
+        { 0x0048, 0x0302, 0x0124 },
+        { 0x0048, 0x0307, 0x1E22 },
+        { 0x0048, 0x0308, 0x1E26 },
+        { 0x0048, 0x030C, 0x021E },
+        { 0x0048, 0x0323, 0x1E24 },
+        { 0x0048, 0x0327, 0x1E28 },
+        { 0x0048, 0x032E, 0x1E2A },
+        { 0x0049, 0x0300, 0x00CC },
+        { 0x0049, 0x0301, 0x00CD },
+        { 0x0049, 0x0302, 0x00CE },
+        { 0x0049, 0x0303, 0x0128 },
+        { 0x0049, 0x0304, 0x012A },
+        { 0x0049, 0x0306, 0x012C },
+        { 0x0049, 0x0307, 0x0130 },
+        { 0x0049, 0x0308, 0x00CF },
+        { 0x0049, 0x0309, 0x1EC8 },
+        { 0x0049, 0x030C, 0x01CF },
+        { 0x0049, 0x030F, 0x0208 },
+        { 0x0049, 0x0311, 0x020A },
+        { 0x0049, 0x0323, 0x1ECA },
+        { 0x0049, 0x0328, 0x012E },
+        { 0x0049, 0x0330, 0x1E2C },
+        { 0x004A, 0x0302, 0x0134 },
+        { 0x004B, 0x0301, 0x1E30 },
+        { 0x004B, 0x030C, 0x01E8 },
+        { 0x004B, 0x0323, 0x1E32 },
+        { 0x004B, 0x0327, 0x0136 },
+        { 0x004B, 0x0331, 0x1E34 },
+        { 0x004C, 0x0301, 0x0139 },
+        { 0x004C, 0x030C, 0x013D },
+        { 0x004C, 0x0323, 0x1E36 },
+        { 0x004C, 0x0327, 0x013B },
+        { 0x004C, 0x032D, 0x1E3C },
+        { 0x004C, 0x0331, 0x1E3A },
+        { 0x004D, 0x0301, 0x1E3E },
+        { 0x004D, 0x0307, 0x1E40 },
+        { 0x004D, 0x0323, 0x1E42 },
+        { 0x004E, 0x0300, 0x01F8 },
+        { 0x004E, 0x0301, 0x0143 },
+        { 0x004E, 0x0303, 0x00D1 },
+        { 0x004E, 0x0307, 0x1E44 },
+        { 0x004E, 0x030C, 0x0147 },
+        { 0x004E, 0x0323, 0x1E46 },
+        { 0x004E, 0x0327, 0x0145 },
+        { 0x004E, 0x032D, 0x1E4A },
+        { 0x004E, 0x0331, 0x1E48 },
+        { 0x004F, 0x0300, 0x00D2 },
+        { 0x004F, 0x0301, 0x00D3 },
+        { 0x004F, 0x0302, 0x00D4 },
+        { 0x004F, 0x0303, 0x00D5 },
+        { 0x004F, 0x0304, 0x014C },
+        { 0x004F, 0x0306, 0x014E },
+        { 0x004F, 0x0307, 0x022E },
+        { 0x004F, 0x0308, 0x00D6 },
+        { 0x004F, 0x0309, 0x1ECE },
+        { 0x004F, 0x030B, 0x0150 },
+        { 0x004F, 0x030C, 0x01D1 },
+        { 0x004F, 0x030F, 0x020C },
+        { 0x004F, 0x0311, 0x020E },
+        { 0x004F, 0x031B, 0x01A0 },
+        { 0x004F, 0x0323, 0x1ECC },
+        { 0x004F, 0x0328, 0x01EA },
+        { 0x0050, 0x0301, 0x1E54 },
+        { 0x0050, 0x0307, 0x1E56 },
+        { 0x0052, 0x0301, 0x0154 },
+        { 0x0052, 0x0307, 0x1E58 },
+        { 0x0052, 0x030C, 0x0158 },
+        { 0x0052, 0x030F, 0x0210 },
+        { 0x0052, 0x0311, 0x0212 },
+        { 0x0052, 0x0323, 0x1E5A },
+        { 0x0052, 0x0327, 0x0156 },
+        { 0x0052, 0x0331, 0x1E5E },
+        { 0x0053, 0x0301, 0x015A },
+        { 0x0053, 0x0302, 0x015C },
+        { 0x0053, 0x0307, 0x1E60 },
+        { 0x0053, 0x030C, 0x0160 },
+        { 0x0053, 0x0323, 0x1E62 },
+        { 0x0053, 0x0326, 0x0218 },
+        { 0x0053, 0x0327, 0x015E },
+        { 0x0054, 0x0307, 0x1E6A },
+        { 0x0054, 0x030C, 0x0164 },
+        { 0x0054, 0x0323, 0x1E6C },
+        { 0x0054, 0x0326, 0x021A },
+        { 0x0054, 0x0327, 0x0162 },
+        { 0x0054, 0x032D, 0x1E70 },
+        { 0x0054, 0x0331, 0x1E6E },
+        { 0x0055, 0x0300, 0x00D9 },
+        { 0x0055, 0x0301, 0x00DA },
+        { 0x0055, 0x0302, 0x00DB },
+        { 0x0055, 0x0303, 0x0168 },
+        { 0x0055, 0x0304, 0x016A },
+        { 0x0055, 0x0306, 0x016C },
+        { 0x0055, 0x0308, 0x00DC },
+        { 0x0055, 0x0309, 0x1EE6 },
+        { 0x0055, 0x030A, 0x016E },
+        { 0x0055, 0x030B, 0x0170 },
+        { 0x0055, 0x030C, 0x01D3 },
+        { 0x0055, 0x030F, 0x0214 },
+        { 0x0055, 0x0311, 0x0216 },
+        { 0x0055, 0x031B, 0x01AF },
+        { 0x0055, 0x0323, 0x1EE4 },
+        { 0x0055, 0x0324, 0x1E72 },
+        { 0x0055, 0x0328, 0x0172 },
+        { 0x0055, 0x032D, 0x1E76 },
+        { 0x0055, 0x0330, 0x1E74 },
+        { 0x0056, 0x0303, 0x1E7C },
+        { 0x0056, 0x0323, 0x1E7E },
+        { 0x0057, 0x0300, 0x1E80 },
+        { 0x0057, 0x0301, 0x1E82 },
+        { 0x0057, 0x0302, 0x0174 },
+        { 0x0057, 0x0307, 0x1E86 },
+        { 0x0057, 0x0308, 0x1E84 },
+        { 0x0057, 0x0323, 0x1E88 },
+        { 0x0058, 0x0307, 0x1E8A },
+        { 0x0058, 0x0308, 0x1E8C },
+        { 0x0059, 0x0300, 0x1EF2 },
+        { 0x0059, 0x0301, 0x00DD },
+        { 0x0059, 0x0302, 0x0176 },
+        { 0x0059, 0x0303, 0x1EF8 },
+        { 0x0059, 0x0304, 0x0232 },
+        { 0x0059, 0x0307, 0x1E8E },
+        { 0x0059, 0x0308, 0x0178 },
+        { 0x0059, 0x0309, 0x1EF6 },
+        { 0x0059, 0x0323, 0x1EF4 },
+        { 0x005A, 0x0301, 0x0179 },
+        { 0x005A, 0x0302, 0x1E90 },
+        { 0x005A, 0x0307, 0x017B },
+        { 0x005A, 0x030C, 0x017D },
+        { 0x005A, 0x0323, 0x1E92 },
+        { 0x005A, 0x0331, 0x1E94 },
+        { 0x0061, 0x0300, 0x00E0 },
+        { 0x0061, 0x0301, 0x00E1 },
+        { 0x0061, 0x0302, 0x00E2 },
+        { 0x0061, 0x0303, 0x00E3 },
+        { 0x0061, 0x0304, 0x0101 },
+        { 0x0061, 0x0306, 0x0103 },
+        { 0x0061, 0x0307, 0x0227 },
+        { 0x0061, 0x0308, 0x00E4 },
+        { 0x0061, 0x0309, 0x1EA3 },
+        { 0x0061, 0x030A, 0x00E5 },
+        { 0x0061, 0x030C, 0x01CE },
+        { 0x0061, 0x030F, 0x0201 },
+        { 0x0061, 0x0311, 0x0203 },
+        { 0x0061, 0x0323, 0x1EA1 },
+        { 0x0061, 0x0325, 0x1E01 },
+        { 0x0061, 0x0328, 0x0105 },
+        { 0x0062, 0x0307, 0x1E03 },
+        { 0x0062, 0x0323, 0x1E05 },
+        { 0x0062, 0x0331, 0x1E07 },
+        { 0x0063, 0x0301, 0x0107 },
+        { 0x0063, 0x0302, 0x0109 },
+        { 0x0063, 0x0307, 0x010B },
+        { 0x0063, 0x030C, 0x010D },
+        { 0x0063, 0x0327, 0x00E7 },
+        { 0x0064, 0x0307, 0x1E0B },
+        { 0x0064, 0x030C, 0x010F },
+        { 0x0064, 0x0323, 0x1E0D },
+        { 0x0064, 0x0327, 0x1E11 },
+        { 0x0064, 0x032D, 0x1E13 },
+        { 0x0064, 0x0331, 0x1E0F },
+        { 0x0065, 0x0300, 0x00E8 },
+        { 0x0065, 0x0301, 0x00E9 },
+        { 0x0065, 0x0302, 0x00EA },
+        { 0x0065, 0x0303, 0x1EBD },
+        { 0x0065, 0x0304, 0x0113 },
+        { 0x0065, 0x0306, 0x0115 },
+        { 0x0065, 0x0307, 0x0117 },
+        { 0x0065, 0x0308, 0x00EB },
+        { 0x0065, 0x0309, 0x1EBB },
+        { 0x0065, 0x030C, 0x011B },
+        { 0x0065, 0x030F, 0x0205 },
+        { 0x0065, 0x0311, 0x0207 },
+        { 0x0065, 0x0323, 0x1EB9 },
+        { 0x0065, 0x0327, 0x0229 },
+        { 0x0065, 0x0328, 0x0119 },
+        { 0x0065, 0x032D, 0x1E19 },
+        { 0x0065, 0x0330, 0x1E1B },
+        { 0x0066, 0x0307, 0x1E1F },
+        { 0x0067, 0x0301, 0x01F5 },
+        { 0x0067, 0x0302, 0x011D },
+        { 0x0067, 0x0304, 0x1E21 },
+        { 0x0067, 0x0306, 0x011F },
+        { 0x0067, 0x0307, 0x0121 },
+        { 0x0067, 0x030C, 0x01E7 },
+        { 0x0067, 0x0327, 0x0123 },
+        { 0x0068, 0x0302, 0x0125 },
+        { 0x0068, 0x0307, 0x1E23 },
+        { 0x0068, 0x0308, 0x1E27 },
+        { 0x0068, 0x030C, 0x021F },
+        { 0x0068, 0x0323, 0x1E25 },
+        { 0x0068, 0x0327, 0x1E29 },
+        { 0x0068, 0x032E, 0x1E2B },
+        { 0x0068, 0x0331, 0x1E96 },
+        { 0x0069, 0x0300, 0x00EC },
+        { 0x0069, 0x0301, 0x00ED },
+        { 0x0069, 0x0302, 0x00EE },
+        { 0x0069, 0x0303, 0x0129 },
+        { 0x0069, 0x0304, 0x012B },
+        { 0x0069, 0x0306, 0x012D },
+        { 0x0069, 0x0308, 0x00EF },
+        { 0x0069, 0x0309, 0x1EC9 },
+        { 0x0069, 0x030C, 0x01D0 },
+        { 0x0069, 0x030F, 0x0209 },
+        { 0x0069, 0x0311, 0x020B },
+        { 0x0069, 0x0323, 0x1ECB },
+        { 0x0069, 0x0328, 0x012F },
+        { 0x0069, 0x0330, 0x1E2D },
+        { 0x006A, 0x0302, 0x0135 },
+        { 0x006A, 0x030C, 0x01F0 },
+        { 0x006B, 0x0301, 0x1E31 },
+        { 0x006B, 0x030C, 0x01E9 },
+        { 0x006B, 0x0323, 0x1E33 },
+        { 0x006B, 0x0327, 0x0137 },
+        { 0x006B, 0x0331, 0x1E35 },
+        { 0x006C, 0x0301, 0x013A },
+        { 0x006C, 0x030C, 0x013E },
+        { 0x006C, 0x0323, 0x1E37 },
+        { 0x006C, 0x0327, 0x013C },
+        { 0x006C, 0x032D, 0x1E3D },
+        { 0x006C, 0x0331, 0x1E3B },
+        { 0x006D, 0x0301, 0x1E3F },
+        { 0x006D, 0x0307, 0x1E41 },
+        { 0x006D, 0x0323, 0x1E43 },
+        { 0x006E, 0x0300, 0x01F9 },
+        { 0x006E, 0x0301, 0x0144 },
+        { 0x006E, 0x0303, 0x00F1 },
+        { 0x006E, 0x0307, 0x1E45 },
+        { 0x006E, 0x030C, 0x0148 },
+        { 0x006E, 0x0323, 0x1E47 },
+        { 0x006E, 0x0327, 0x0146 },
+        { 0x006E, 0x032D, 0x1E4B },
+        { 0x006E, 0x0331, 0x1E49 },
+        { 0x006F, 0x0300, 0x00F2 },
+        { 0x006F, 0x0301, 0x00F3 },
+        { 0x006F, 0x0302, 0x00F4 },
+        { 0x006F, 0x0303, 0x00F5 },
+        { 0x006F, 0x0304, 0x014D },
+        { 0x006F, 0x0306, 0x014F },
+        { 0x006F, 0x0307, 0x022F },
+        { 0x006F, 0x0308, 0x00F6 },
+        { 0x006F, 0x0309, 0x1ECF },
+        { 0x006F, 0x030B, 0x0151 },
+        { 0x006F, 0x030C, 0x01D2 },
+        { 0x006F, 0x030F, 0x020D },
+        { 0x006F, 0x0311, 0x020F },
+        { 0x006F, 0x031B, 0x01A1 },
+        { 0x006F, 0x0323, 0x1ECD },
+        { 0x006F, 0x0328, 0x01EB },
+        { 0x0070, 0x0301, 0x1E55 },
+        { 0x0070, 0x0307, 0x1E57 },
+        { 0x0072, 0x0301, 0x0155 },
+        { 0x0072, 0x0307, 0x1E59 },
+        { 0x0072, 0x030C, 0x0159 },
+        { 0x0072, 0x030F, 0x0211 },
+        { 0x0072, 0x0311, 0x0213 },
+        { 0x0072, 0x0323, 0x1E5B },
+        { 0x0072, 0x0327, 0x0157 },
+        { 0x0072, 0x0331, 0x1E5F },
+        { 0x0073, 0x0301, 0x015B },
+        { 0x0073, 0x0302, 0x015D },
+        { 0x0073, 0x0307, 0x1E61 },
+        { 0x0073, 0x030C, 0x0161 },
+        { 0x0073, 0x0323, 0x1E63 },
+        { 0x0073, 0x0326, 0x0219 },
+        { 0x0073, 0x0327, 0x015F },
+        { 0x0074, 0x0307, 0x1E6B },
+        { 0x0074, 0x0308, 0x1E97 },
+        { 0x0074, 0x030C, 0x0165 },
+        { 0x0074, 0x0323, 0x1E6D },
+        { 0x0074, 0x0326, 0x021B },
+        { 0x0074, 0x0327, 0x0163 },
+        { 0x0074, 0x032D, 0x1E71 },
+        { 0x0074, 0x0331, 0x1E6F },
+        { 0x0075, 0x0300, 0x00F9 },
+        { 0x0075, 0x0301, 0x00FA },
+        { 0x0075, 0x0302, 0x00FB },
+        { 0x0075, 0x0303, 0x0169 },
+        { 0x0075, 0x0304, 0x016B },
+        { 0x0075, 0x0306, 0x016D },
+        { 0x0075, 0x0308, 0x00FC },
+        { 0x0075, 0x0309, 0x1EE7 },
+        { 0x0075, 0x030A, 0x016F },
+        { 0x0075, 0x030B, 0x0171 },
+        { 0x0075, 0x030C, 0x01D4 },
+        { 0x0075, 0x030F, 0x0215 },
+        { 0x0075, 0x0311, 0x0217 },
+        { 0x0075, 0x031B, 0x01B0 },
+        { 0x0075, 0x0323, 0x1EE5 },
+        { 0x0075, 0x0324, 0x1E73 },
+        { 0x0075, 0x0328, 0x0173 },
+        { 0x0075, 0x032D, 0x1E77 },
+        { 0x0075, 0x0330, 0x1E75 },
+        { 0x0076, 0x0303, 0x1E7D },
+        { 0x0076, 0x0323, 0x1E7F },
+        { 0x0077, 0x0300, 0x1E81 },
+        { 0x0077, 0x0301, 0x1E83 },
+        { 0x0077, 0x0302, 0x0175 },
+        { 0x0077, 0x0307, 0x1E87 },
+        { 0x0077, 0x0308, 0x1E85 },
+        { 0x0077, 0x030A, 0x1E98 },
+        { 0x0077, 0x0323, 0x1E89 },
+        { 0x0078, 0x0307, 0x1E8B },
+        { 0x0078, 0x0308, 0x1E8D },
+        { 0x0079, 0x0300, 0x1EF3 },
+        { 0x0079, 0x0301, 0x00FD },
+        { 0x0079, 0x0302, 0x0177 },
+        { 0x0079, 0x0303, 0x1EF9 },
+        { 0x0079, 0x0304, 0x0233 },
+        { 0x0079, 0x0307, 0x1E8F },
+        { 0x0079, 0x0308, 0x00FF },
+        { 0x0079, 0x0309, 0x1EF7 },
+        { 0x0079, 0x030A, 0x1E99 },
+        { 0x0079, 0x0323, 0x1EF5 },
+        { 0x007A, 0x0301, 0x017A },
+        { 0x007A, 0x0302, 0x1E91 },
+        { 0x007A, 0x0307, 0x017C },
+        { 0x007A, 0x030C, 0x017E },
+        { 0x007A, 0x0323, 0x1E93 },
+        { 0x007A, 0x0331, 0x1E95 },
+        { 0x00A8, 0x0300, 0x1FED },
+        { 0x00A8, 0x0301, 0x0385 },
+        { 0x00A8, 0x0342, 0x1FC1 },
+        { 0x00C2, 0x0300, 0x1EA6 },
+        { 0x00C2, 0x0301, 0x1EA4 },
+        { 0x00C2, 0x0303, 0x1EAA },
+        { 0x00C2, 0x0309, 0x1EA8 },
+        { 0x00C4, 0x0304, 0x01DE },
+        { 0x00C5, 0x0301, 0x01FA },
+        { 0x00C6, 0x0301, 0x01FC },
+        { 0x00C6, 0x0304, 0x01E2 },
+        { 0x00C7, 0x0301, 0x1E08 },
+        { 0x00CA, 0x0300, 0x1EC0 },
+        { 0x00CA, 0x0301, 0x1EBE },
+        { 0x00CA, 0x0303, 0x1EC4 },
+        { 0x00CA, 0x0309, 0x1EC2 },
+        { 0x00CF, 0x0301, 0x1E2E },
+        { 0x00D4, 0x0300, 0x1ED2 },
+        { 0x00D4, 0x0301, 0x1ED0 },
+        { 0x00D4, 0x0303, 0x1ED6 },
+        { 0x00D4, 0x0309, 0x1ED4 },
+        { 0x00D5, 0x0301, 0x1E4C },
+        { 0x00D5, 0x0304, 0x022C },
+        { 0x00D5, 0x0308, 0x1E4E },
+        { 0x00D6, 0x0304, 0x022A },
+        { 0x00D8, 0x0301, 0x01FE },
+        { 0x00DC, 0x0300, 0x01DB },
+        { 0x00DC, 0x0301, 0x01D7 },
+        { 0x00DC, 0x0304, 0x01D5 },
+        { 0x00DC, 0x030C, 0x01D9 },
+        { 0x00E2, 0x0300, 0x1EA7 },
+        { 0x00E2, 0x0301, 0x1EA5 },
+        { 0x00E2, 0x0303, 0x1EAB },
+        { 0x00E2, 0x0309, 0x1EA9 },
+        { 0x00E4, 0x0304, 0x01DF },
+        { 0x00E5, 0x0301, 0x01FB },
+        { 0x00E6, 0x0301, 0x01FD },
+        { 0x00E6, 0x0304, 0x01E3 },
+        { 0x00E7, 0x0301, 0x1E09 },
+        { 0x00EA, 0x0300, 0x1EC1 },
+        { 0x00EA, 0x0301, 0x1EBF },
+        { 0x00EA, 0x0303, 0x1EC5 },
+        { 0x00EA, 0x0309, 0x1EC3 },
+        { 0x00EF, 0x0301, 0x1E2F },
+        { 0x00F4, 0x0300, 0x1ED3 },
+        { 0x00F4, 0x0301, 0x1ED1 },
+        { 0x00F4, 0x0303, 0x1ED7 },
+        { 0x00F4, 0x0309, 0x1ED5 },
+        { 0x00F5, 0x0301, 0x1E4D },
+        { 0x00F5, 0x0304, 0x022D },
+        { 0x00F5, 0x0308, 0x1E4F },
+        { 0x00F6, 0x0304, 0x022B },
+        { 0x00F8, 0x0301, 0x01FF },
+        { 0x00FC, 0x0300, 0x01DC },
+        { 0x00FC, 0x0301, 0x01D8 },
+        { 0x00FC, 0x0304, 0x01D6 },
+        { 0x00FC, 0x030C, 0x01DA },
+        { 0x0102, 0x0300, 0x1EB0 },
+        { 0x0102, 0x0301, 0x1EAE },
+        { 0x0102, 0x0303, 0x1EB4 },
+        { 0x0102, 0x0309, 0x1EB2 },
+        { 0x0103, 0x0300, 0x1EB1 },
+        { 0x0103, 0x0301, 0x1EAF },
+        { 0x0103, 0x0303, 0x1EB5 },
+        { 0x0103, 0x0309, 0x1EB3 },
+        { 0x0112, 0x0300, 0x1E14 },
+        { 0x0112, 0x0301, 0x1E16 },
+        { 0x0113, 0x0300, 0x1E15 },
+        { 0x0113, 0x0301, 0x1E17 },
+        { 0x014C, 0x0300, 0x1E50 },
+        { 0x014C, 0x0301, 0x1E52 },
+        { 0x014D, 0x0300, 0x1E51 },
+        { 0x014D, 0x0301, 0x1E53 },
+        { 0x015A, 0x0307, 0x1E64 },
+        { 0x015B, 0x0307, 0x1E65 },
+        { 0x0160, 0x0307, 0x1E66 },
+        { 0x0161, 0x0307, 0x1E67 },
+        { 0x0168, 0x0301, 0x1E78 },
+        { 0x0169, 0x0301, 0x1E79 },
+        { 0x016A, 0x0308, 0x1E7A },
+        { 0x016B, 0x0308, 0x1E7B },
+        { 0x017F, 0x0307, 0x1E9B },
+        { 0x01A0, 0x0300, 0x1EDC },
+        { 0x01A0, 0x0301, 0x1EDA },
+        { 0x01A0, 0x0303, 0x1EE0 },
+        { 0x01A0, 0x0309, 0x1EDE },
+        { 0x01A0, 0x0323, 0x1EE2 },
+        { 0x01A1, 0x0300, 0x1EDD },
+        { 0x01A1, 0x0301, 0x1EDB },
+        { 0x01A1, 0x0303, 0x1EE1 },
+        { 0x01A1, 0x0309, 0x1EDF },
+        { 0x01A1, 0x0323, 0x1EE3 },
+        { 0x01AF, 0x0300, 0x1EEA },
+        { 0x01AF, 0x0301, 0x1EE8 },
+        { 0x01AF, 0x0303, 0x1EEE },
+        { 0x01AF, 0x0309, 0x1EEC },
+        { 0x01AF, 0x0323, 0x1EF0 },
+        { 0x01B0, 0x0300, 0x1EEB },
+        { 0x01B0, 0x0301, 0x1EE9 },
+        { 0x01B0, 0x0303, 0x1EEF },
+        { 0x01B0, 0x0309, 0x1EED },
+        { 0x01B0, 0x0323, 0x1EF1 },
+        { 0x01B7, 0x030C, 0x01EE },
+        { 0x01EA, 0x0304, 0x01EC },
+        { 0x01EB, 0x0304, 0x01ED },
+        { 0x0226, 0x0304, 0x01E0 },
+        { 0x0227, 0x0304, 0x01E1 },
+        { 0x0228, 0x0306, 0x1E1C },
+        { 0x0229, 0x0306, 0x1E1D },
+        { 0x022E, 0x0304, 0x0230 },
+        { 0x022F, 0x0304, 0x0231 },
+        { 0x0292, 0x030C, 0x01EF },
+        { 0x0391, 0x0300, 0x1FBA },
+        { 0x0391, 0x0301, 0x0386 },
+        { 0x0391, 0x0304, 0x1FB9 },
+        { 0x0391, 0x0306, 0x1FB8 },
+        { 0x0391, 0x0313, 0x1F08 },
+        { 0x0391, 0x0314, 0x1F09 },
+        { 0x0391, 0x0345, 0x1FBC },
+        { 0x0395, 0x0300, 0x1FC8 },
+        { 0x0395, 0x0301, 0x0388 },
+        { 0x0395, 0x0313, 0x1F18 },
+        { 0x0395, 0x0314, 0x1F19 },
+        { 0x0397, 0x0300, 0x1FCA },
+        { 0x0397, 0x0301, 0x0389 },
+        { 0x0397, 0x0313, 0x1F28 },
+        { 0x0397, 0x0314, 0x1F29 },
+        { 0x0397, 0x0345, 0x1FCC },
+        { 0x0399, 0x0300, 0x1FDA },
+        { 0x0399, 0x0301, 0x038A },
+        { 0x0399, 0x0304, 0x1FD9 },
+        { 0x0399, 0x0306, 0x1FD8 },
+        { 0x0399, 0x0308, 0x03AA },
+        { 0x0399, 0x0313, 0x1F38 },
+        { 0x0399, 0x0314, 0x1F39 },
+        { 0x039F, 0x0300, 0x1FF8 },
+        { 0x039F, 0x0301, 0x038C },
+        { 0x039F, 0x0313, 0x1F48 },
+        { 0x039F, 0x0314, 0x1F49 },
+        { 0x03A1, 0x0314, 0x1FEC },
+        { 0x03A5, 0x0300, 0x1FEA },
+        { 0x03A5, 0x0301, 0x038E },
+        { 0x03A5, 0x0304, 0x1FE9 },
+        { 0x03A5, 0x0306, 0x1FE8 },
+        { 0x03A5, 0x0308, 0x03AB },
+        { 0x03A5, 0x0314, 0x1F59 },
+        { 0x03A9, 0x0300, 0x1FFA },
+        { 0x03A9, 0x0301, 0x038F },
+        { 0x03A9, 0x0313, 0x1F68 },
+        { 0x03A9, 0x0314, 0x1F69 },
+        { 0x03A9, 0x0345, 0x1FFC },
+        { 0x03AC, 0x0345, 0x1FB4 },
+        { 0x03AE, 0x0345, 0x1FC4 },
+        { 0x03B1, 0x0300, 0x1F70 },
+        { 0x03B1, 0x0301, 0x03AC },
+        { 0x03B1, 0x0304, 0x1FB1 },
+        { 0x03B1, 0x0306, 0x1FB0 },
+        { 0x03B1, 0x0313, 0x1F00 },
+        { 0x03B1, 0x0314, 0x1F01 },
+        { 0x03B1, 0x0342, 0x1FB6 },
+        { 0x03B1, 0x0345, 0x1FB3 },
+        { 0x03B5, 0x0300, 0x1F72 },
+        { 0x03B5, 0x0301, 0x03AD },
+        { 0x03B5, 0x0313, 0x1F10 },
+        { 0x03B5, 0x0314, 0x1F11 },
+        { 0x03B7, 0x0300, 0x1F74 },
+        { 0x03B7, 0x0301, 0x03AE },
+        { 0x03B7, 0x0313, 0x1F20 },
+        { 0x03B7, 0x0314, 0x1F21 },
+        { 0x03B7, 0x0342, 0x1FC6 },
+        { 0x03B7, 0x0345, 0x1FC3 },
+        { 0x03B9, 0x0300, 0x1F76 },
+        { 0x03B9, 0x0301, 0x03AF },
+        { 0x03B9, 0x0304, 0x1FD1 },
+        { 0x03B9, 0x0306, 0x1FD0 },
+        { 0x03B9, 0x0308, 0x03CA },
+        { 0x03B9, 0x0313, 0x1F30 },
+        { 0x03B9, 0x0314, 0x1F31 },
+        { 0x03B9, 0x0342, 0x1FD6 },
+        { 0x03BF, 0x0300, 0x1F78 },
+        { 0x03BF, 0x0301, 0x03CC },
+        { 0x03BF, 0x0313, 0x1F40 },
+        { 0x03BF, 0x0314, 0x1F41 },
+        { 0x03C1, 0x0313, 0x1FE4 },
+        { 0x03C1, 0x0314, 0x1FE5 },
+        { 0x03C5, 0x0300, 0x1F7A },
+        { 0x03C5, 0x0301, 0x03CD },
+        { 0x03C5, 0x0304, 0x1FE1 },
+        { 0x03C5, 0x0306, 0x1FE0 },
+        { 0x03C5, 0x0308, 0x03CB },
+        { 0x03C5, 0x0313, 0x1F50 },
+        { 0x03C5, 0x0314, 0x1F51 },
+        { 0x03C5, 0x0342, 0x1FE6 },
+        { 0x03C9, 0x0300, 0x1F7C },
+        { 0x03C9, 0x0301, 0x03CE },
+        { 0x03C9, 0x0313, 0x1F60 },
+        { 0x03C9, 0x0314, 0x1F61 },
+        { 0x03C9, 0x0342, 0x1FF6 },
+        { 0x03C9, 0x0345, 0x1FF3 },
+        { 0x03CA, 0x0300, 0x1FD2 },
+        { 0x03CA, 0x0301, 0x0390 },
+        { 0x03CA, 0x0342, 0x1FD7 },
+        { 0x03CB, 0x0300, 0x1FE2 },
+        { 0x03CB, 0x0301, 0x03B0 },
+        { 0x03CB, 0x0342, 0x1FE7 },
+        { 0x03CE, 0x0345, 0x1FF4 },
+        { 0x03D2, 0x0301, 0x03D3 },
+        { 0x03D2, 0x0308, 0x03D4 },
+        { 0x0406, 0x0308, 0x0407 },
+        { 0x0410, 0x0306, 0x04D0 },
+        { 0x0410, 0x0308, 0x04D2 },
+        { 0x0413, 0x0301, 0x0403 },
+        { 0x0415, 0x0300, 0x0400 },
+        { 0x0415, 0x0306, 0x04D6 },
+        { 0x0415, 0x0308, 0x0401 },
+        { 0x0416, 0x0306, 0x04C1 },
+        { 0x0416, 0x0308, 0x04DC },
+        { 0x0417, 0x0308, 0x04DE },
+        { 0x0418, 0x0300, 0x040D },
+        { 0x0418, 0x0304, 0x04E2 },
+        { 0x0418, 0x0306, 0x0419 },
+        { 0x0418, 0x0308, 0x04E4 },
+        { 0x041A, 0x0301, 0x040C },
+        { 0x041E, 0x0308, 0x04E6 },
+        { 0x0423, 0x0304, 0x04EE },
+        { 0x0423, 0x0306, 0x040E },
+        { 0x0423, 0x0308, 0x04F0 },
+        { 0x0423, 0x030B, 0x04F2 },
+        { 0x0427, 0x0308, 0x04F4 },
+        { 0x042B, 0x0308, 0x04F8 },
+        { 0x042D, 0x0308, 0x04EC },
+        { 0x0430, 0x0306, 0x04D1 },
+        { 0x0430, 0x0308, 0x04D3 },
+        { 0x0433, 0x0301, 0x0453 },
+        { 0x0435, 0x0300, 0x0450 },
+        { 0x0435, 0x0306, 0x04D7 },
+        { 0x0435, 0x0308, 0x0451 },
+        { 0x0436, 0x0306, 0x04C2 },
+        { 0x0436, 0x0308, 0x04DD },
+        { 0x0437, 0x0308, 0x04DF },
+        { 0x0438, 0x0300, 0x045D },
+        { 0x0438, 0x0304, 0x04E3 },
+        { 0x0438, 0x0306, 0x0439 },
+        { 0x0438, 0x0308, 0x04E5 },
+        { 0x043A, 0x0301, 0x045C },
+        { 0x043E, 0x0308, 0x04E7 },
+        { 0x0443, 0x0304, 0x04EF },
+        { 0x0443, 0x0306, 0x045E },
+        { 0x0443, 0x0308, 0x04F1 },
+        { 0x0443, 0x030B, 0x04F3 },
+        { 0x0447, 0x0308, 0x04F5 },
+        { 0x044B, 0x0308, 0x04F9 },
+        { 0x044D, 0x0308, 0x04ED },
+        { 0x0456, 0x0308, 0x0457 },
+        { 0x0474, 0x030F, 0x0476 },
+        { 0x0475, 0x030F, 0x0477 },
+        { 0x04D8, 0x0308, 0x04DA },
+        { 0x04D9, 0x0308, 0x04DB },
+        { 0x04E8, 0x0308, 0x04EA },
+        { 0x04E9, 0x0308, 0x04EB },
+        { 0x0627, 0x0653, 0x0622 },
+        { 0x0627, 0x0654, 0x0623 },
+        { 0x0627, 0x0655, 0x0625 },
+        { 0x0648, 0x0654, 0x0624 },
+        { 0x064A, 0x0654, 0x0626 },
+        { 0x06C1, 0x0654, 0x06C2 },
+        { 0x06D2, 0x0654, 0x06D3 },
+        { 0x06D5, 0x0654, 0x06C0 },
+        { 0x0928, 0x093C, 0x0929 },
+        { 0x0930, 0x093C, 0x0931 },
+        { 0x0933, 0x093C, 0x0934 },
+        { 0x09C7, 0x09BE, 0x09CB },
+        { 0x09C7, 0x09D7, 0x09CC },
+        { 0x0B47, 0x0B3E, 0x0B4B },
+        { 0x0B47, 0x0B56, 0x0B48 },
+        { 0x0B47, 0x0B57, 0x0B4C },
+        { 0x0B92, 0x0BD7, 0x0B94 },
+        { 0x0BC6, 0x0BBE, 0x0BCA },
+        { 0x0BC6, 0x0BD7, 0x0BCC },
+        { 0x0BC7, 0x0BBE, 0x0BCB },
+        { 0x0C46, 0x0C56, 0x0C48 },
+        { 0x0CBF, 0x0CD5, 0x0CC0 },
+        { 0x0CC6, 0x0CC2, 0x0CCA },
+        { 0x0CC6, 0x0CD5, 0x0CC7 },
+        { 0x0CC6, 0x0CD6, 0x0CC8 },
+        { 0x0CCA, 0x0CD5, 0x0CCB },
+        { 0x0D46, 0x0D3E, 0x0D4A },
+        { 0x0D46, 0x0D57, 0x0D4C },
+        { 0x0D47, 0x0D3E, 0x0D4B },
+        { 0x0DD9, 0x0DCA, 0x0DDA },
+        { 0x0DD9, 0x0DCF, 0x0DDC },
+        { 0x0DD9, 0x0DDF, 0x0DDE },
+        { 0x0DDC, 0x0DCA, 0x0DDD },
+        { 0x1025, 0x102E, 0x1026 },
+        { 0x1B05, 0x1B35, 0x1B06 },
+        { 0x1B07, 0x1B35, 0x1B08 },
+        { 0x1B09, 0x1B35, 0x1B0A },
+        { 0x1B0B, 0x1B35, 0x1B0C },
+        { 0x1B0D, 0x1B35, 0x1B0E },
+        { 0x1B11, 0x1B35, 0x1B12 },
+        { 0x1B3A, 0x1B35, 0x1B3B },
+        { 0x1B3C, 0x1B35, 0x1B3D },
+        { 0x1B3E, 0x1B35, 0x1B40 },
+        { 0x1B3F, 0x1B35, 0x1B41 },
+        { 0x1B42, 0x1B35, 0x1B43 },
+        { 0x1E36, 0x0304, 0x1E38 },
+        { 0x1E37, 0x0304, 0x1E39 },
+        { 0x1E5A, 0x0304, 0x1E5C },
+        { 0x1E5B, 0x0304, 0x1E5D },
+        { 0x1E62, 0x0307, 0x1E68 },
+        { 0x1E63, 0x0307, 0x1E69 },
+        { 0x1EA0, 0x0302, 0x1EAC },
+        { 0x1EA0, 0x0306, 0x1EB6 },
+        { 0x1EA1, 0x0302, 0x1EAD },
+        { 0x1EA1, 0x0306, 0x1EB7 },
+        { 0x1EB8, 0x0302, 0x1EC6 },
+        { 0x1EB9, 0x0302, 0x1EC7 },
+        { 0x1ECC, 0x0302, 0x1ED8 },
+        { 0x1ECD, 0x0302, 0x1ED9 },
+        { 0x1F00, 0x0300, 0x1F02 },
+        { 0x1F00, 0x0301, 0x1F04 },
+        { 0x1F00, 0x0342, 0x1F06 },
+        { 0x1F00, 0x0345, 0x1F80 },
+        { 0x1F01, 0x0300, 0x1F03 },
+        { 0x1F01, 0x0301, 0x1F05 },
+        { 0x1F01, 0x0342, 0x1F07 },
+        { 0x1F01, 0x0345, 0x1F81 },
+        { 0x1F02, 0x0345, 0x1F82 },
+        { 0x1F03, 0x0345, 0x1F83 },
+        { 0x1F04, 0x0345, 0x1F84 },
+        { 0x1F05, 0x0345, 0x1F85 },
+        { 0x1F06, 0x0345, 0x1F86 },
+        { 0x1F07, 0x0345, 0x1F87 },
+        { 0x1F08, 0x0300, 0x1F0A },
+        { 0x1F08, 0x0301, 0x1F0C },
+        { 0x1F08, 0x0342, 0x1F0E },
+        { 0x1F08, 0x0345, 0x1F88 },
+        { 0x1F09, 0x0300, 0x1F0B },
+        { 0x1F09, 0x0301, 0x1F0D },
+        { 0x1F09, 0x0342, 0x1F0F },
+        { 0x1F09, 0x0345, 0x1F89 },
+        { 0x1F0A, 0x0345, 0x1F8A },
+        { 0x1F0B, 0x0345, 0x1F8B },
+        { 0x1F0C, 0x0345, 0x1F8C },
+        { 0x1F0D, 0x0345, 0x1F8D },
+        { 0x1F0E, 0x0345, 0x1F8E },
+        { 0x1F0F, 0x0345, 0x1F8F },
+        { 0x1F10, 0x0300, 0x1F12 },
+        { 0x1F10, 0x0301, 0x1F14 },
+        { 0x1F11, 0x0300, 0x1F13 },
+        { 0x1F11, 0x0301, 0x1F15 },
+        { 0x1F18, 0x0300, 0x1F1A },
+        { 0x1F18, 0x0301, 0x1F1C },
+        { 0x1F19, 0x0300, 0x1F1B },
+        { 0x1F19, 0x0301, 0x1F1D },
+        { 0x1F20, 0x0300, 0x1F22 },
+        { 0x1F20, 0x0301, 0x1F24 },
+        { 0x1F20, 0x0342, 0x1F26 },
+        { 0x1F20, 0x0345, 0x1F90 },
+        { 0x1F21, 0x0300, 0x1F23 },
+        { 0x1F21, 0x0301, 0x1F25 },
+        { 0x1F21, 0x0342, 0x1F27 },
+        { 0x1F21, 0x0345, 0x1F91 },
+        { 0x1F22, 0x0345, 0x1F92 },
+        { 0x1F23, 0x0345, 0x1F93 },
+        { 0x1F24, 0x0345, 0x1F94 },
+        { 0x1F25, 0x0345, 0x1F95 },
+        { 0x1F26, 0x0345, 0x1F96 },
+        { 0x1F27, 0x0345, 0x1F97 },
+        { 0x1F28, 0x0300, 0x1F2A },
+        { 0x1F28, 0x0301, 0x1F2C },
+        { 0x1F28, 0x0342, 0x1F2E },
+        { 0x1F28, 0x0345, 0x1F98 },
+        { 0x1F29, 0x0300, 0x1F2B },
+        { 0x1F29, 0x0301, 0x1F2D },
+        { 0x1F29, 0x0342, 0x1F2F },
+        { 0x1F29, 0x0345, 0x1F99 },
+        { 0x1F2A, 0x0345, 0x1F9A },
+        { 0x1F2B, 0x0345, 0x1F9B },
+        { 0x1F2C, 0x0345, 0x1F9C },
+        { 0x1F2D, 0x0345, 0x1F9D },
+        { 0x1F2E, 0x0345, 0x1F9E },
+        { 0x1F2F, 0x0345, 0x1F9F },
+        { 0x1F30, 0x0300, 0x1F32 },
+        { 0x1F30, 0x0301, 0x1F34 },
+        { 0x1F30, 0x0342, 0x1F36 },
+        { 0x1F31, 0x0300, 0x1F33 },
+        { 0x1F31, 0x0301, 0x1F35 },
+        { 0x1F31, 0x0342, 0x1F37 },
+        { 0x1F38, 0x0300, 0x1F3A },
+        { 0x1F38, 0x0301, 0x1F3C },
+        { 0x1F38, 0x0342, 0x1F3E },
+        { 0x1F39, 0x0300, 0x1F3B },
+        { 0x1F39, 0x0301, 0x1F3D },
+        { 0x1F39, 0x0342, 0x1F3F },
+        { 0x1F40, 0x0300, 0x1F42 },
+        { 0x1F40, 0x0301, 0x1F44 },
+        { 0x1F41, 0x0300, 0x1F43 },
+        { 0x1F41, 0x0301, 0x1F45 },
+        { 0x1F48, 0x0300, 0x1F4A },
+        { 0x1F48, 0x0301, 0x1F4C },
+        { 0x1F49, 0x0300, 0x1F4B },
+        { 0x1F49, 0x0301, 0x1F4D },
+        { 0x1F50, 0x0300, 0x1F52 },
+        { 0x1F50, 0x0301, 0x1F54 },
+        { 0x1F50, 0x0342, 0x1F56 },
+        { 0x1F51, 0x0300, 0x1F53 },
+        { 0x1F51, 0x0301, 0x1F55 },
+        { 0x1F51, 0x0342, 0x1F57 },
+        { 0x1F59, 0x0300, 0x1F5B },
+        { 0x1F59, 0x0301, 0x1F5D },
+        { 0x1F59, 0x0342, 0x1F5F },
+        { 0x1F60, 0x0300, 0x1F62 },
+        { 0x1F60, 0x0301, 0x1F64 },
+        { 0x1F60, 0x0342, 0x1F66 },
+        { 0x1F60, 0x0345, 0x1FA0 },
+        { 0x1F61, 0x0300, 0x1F63 },
+        { 0x1F61, 0x0301, 0x1F65 },
+        { 0x1F61, 0x0342, 0x1F67 },
+        { 0x1F61, 0x0345, 0x1FA1 },
+        { 0x1F62, 0x0345, 0x1FA2 },
+        { 0x1F63, 0x0345, 0x1FA3 },
+        { 0x1F64, 0x0345, 0x1FA4 },
+        { 0x1F65, 0x0345, 0x1FA5 },
+        { 0x1F66, 0x0345, 0x1FA6 },
+        { 0x1F67, 0x0345, 0x1FA7 },
+        { 0x1F68, 0x0300, 0x1F6A },
+        { 0x1F68, 0x0301, 0x1F6C },
+        { 0x1F68, 0x0342, 0x1F6E },
+        { 0x1F68, 0x0345, 0x1FA8 },
+        { 0x1F69, 0x0300, 0x1F6B },
+        { 0x1F69, 0x0301, 0x1F6D },
+        { 0x1F69, 0x0342, 0x1F6F },
+        { 0x1F69, 0x0345, 0x1FA9 },
+        { 0x1F6A, 0x0345, 0x1FAA },
+        { 0x1F6B, 0x0345, 0x1FAB },
+        { 0x1F6C, 0x0345, 0x1FAC },
+        { 0x1F6D, 0x0345, 0x1FAD },
+        { 0x1F6E, 0x0345, 0x1FAE },
+        { 0x1F6F, 0x0345, 0x1FAF },
+        { 0x1F70, 0x0345, 0x1FB2 },
+        { 0x1F74, 0x0345, 0x1FC2 },
+        { 0x1F7C, 0x0345, 0x1FF2 },
+        { 0x1FB6, 0x0345, 0x1FB7 },
+        { 0x1FBF, 0x0300, 0x1FCD },
+        { 0x1FBF, 0x0301, 0x1FCE },
+        { 0x1FBF, 0x0342, 0x1FCF },
+        { 0x1FC6, 0x0345, 0x1FC7 },
+        { 0x1FF6, 0x0345, 0x1FF7 },
+        { 0x1FFE, 0x0300, 0x1FDD },
+        { 0x1FFE, 0x0301, 0x1FDE },
+        { 0x1FFE, 0x0342, 0x1FDF },
+        { 0x2190, 0x0338, 0x219A },
+        { 0x2192, 0x0338, 0x219B },
+        { 0x2194, 0x0338, 0x21AE },
+        { 0x21D0, 0x0338, 0x21CD },
+        { 0x21D2, 0x0338, 0x21CF },
+        { 0x21D4, 0x0338, 0x21CE },
+        { 0x2203, 0x0338, 0x2204 },
+        { 0x2208, 0x0338, 0x2209 },
+        { 0x220B, 0x0338, 0x220C },
+        { 0x2223, 0x0338, 0x2224 },
+        { 0x2225, 0x0338, 0x2226 },
+        { 0x223C, 0x0338, 0x2241 },
+        { 0x2243, 0x0338, 0x2244 },
+        { 0x2245, 0x0338, 0x2247 },
+        { 0x2248, 0x0338, 0x2249 },
+        { 0x224D, 0x0338, 0x226D },
+        { 0x2261, 0x0338, 0x2262 },
+        { 0x2264, 0x0338, 0x2270 },
+        { 0x2265, 0x0338, 0x2271 },
+        { 0x2272, 0x0338, 0x2274 },
+        { 0x2273, 0x0338, 0x2275 },
+        { 0x2276, 0x0338, 0x2278 },
+        { 0x2277, 0x0338, 0x2279 },
+        { 0x227A, 0x0338, 0x2280 },
+        { 0x227B, 0x0338, 0x2281 },
+        { 0x227C, 0x0338, 0x22E0 },
+        { 0x227D, 0x0338, 0x22E1 },
+        { 0x2282, 0x0338, 0x2284 },
+        { 0x2283, 0x0338, 0x2285 },
+        { 0x2286, 0x0338, 0x2288 },
+        { 0x2287, 0x0338, 0x2289 },
+        { 0x2291, 0x0338, 0x22E2 },
+        { 0x2292, 0x0338, 0x22E3 },
+        { 0x22A2, 0x0338, 0x22AC },
+        { 0x22A8, 0x0338, 0x22AD },
+        { 0x22A9, 0x0338, 0x22AE },
+        { 0x22AB, 0x0338, 0x22AF },
+        { 0x22B2, 0x0338, 0x22EA },
+        { 0x22B3, 0x0338, 0x22EB },
+        { 0x22B4, 0x0338, 0x22EC },
+        { 0x22B5, 0x0338, 0x22ED },
+        { 0x3046, 0x3099, 0x3094 },
+        { 0x304B, 0x3099, 0x304C },
+        { 0x304D, 0x3099, 0x304E },
+        { 0x304F, 0x3099, 0x3050 },
+        { 0x3051, 0x3099, 0x3052 },
+        { 0x3053, 0x3099, 0x3054 },
+        { 0x3055, 0x3099, 0x3056 },
+        { 0x3057, 0x3099, 0x3058 },
+        { 0x3059, 0x3099, 0x305A },
+        { 0x305B, 0x3099, 0x305C },
+        { 0x305D, 0x3099, 0x305E },
+        { 0x305F, 0x3099, 0x3060 },
+        { 0x3061, 0x3099, 0x3062 },
+        { 0x3064, 0x3099, 0x3065 },
+        { 0x3066, 0x3099, 0x3067 },
+        { 0x3068, 0x3099, 0x3069 },
+        { 0x306F, 0x3099, 0x3070 },
+        { 0x306F, 0x309A, 0x3071 },
+        { 0x3072, 0x3099, 0x3073 },
+        { 0x3072, 0x309A, 0x3074 },
+        { 0x3075, 0x3099, 0x3076 },
+        { 0x3075, 0x309A, 0x3077 },
+        { 0x3078, 0x3099, 0x3079 },
+        { 0x3078, 0x309A, 0x307A },
+        { 0x307B, 0x3099, 0x307C },
+        { 0x307B, 0x309A, 0x307D },
+        { 0x309D, 0x3099, 0x309E },
+        { 0x30A6, 0x3099, 0x30F4 },
+        { 0x30AB, 0x3099, 0x30AC },
+        { 0x30AD, 0x3099, 0x30AE },
+        { 0x30AF, 0x3099, 0x30B0 },
+        { 0x30B1, 0x3099, 0x30B2 },
+        { 0x30B3, 0x3099, 0x30B4 },
+        { 0x30B5, 0x3099, 0x30B6 },
+        { 0x30B7, 0x3099, 0x30B8 },
+        { 0x30B9, 0x3099, 0x30BA },
+        { 0x30BB, 0x3099, 0x30BC },
+        { 0x30BD, 0x3099, 0x30BE },
+        { 0x30BF, 0x3099, 0x30C0 },
+        { 0x30C1, 0x3099, 0x30C2 },
+        { 0x30C4, 0x3099, 0x30C5 },
+        { 0x30C6, 0x3099, 0x30C7 },
+        { 0x30C8, 0x3099, 0x30C9 },
+        { 0x30CF, 0x3099, 0x30D0 },
+        { 0x30CF, 0x309A, 0x30D1 },
+        { 0x30D2, 0x3099, 0x30D3 },
+        { 0x30D2, 0x309A, 0x30D4 },
+        { 0x30D5, 0x3099, 0x30D6 },
+        { 0x30D5, 0x309A, 0x30D7 },
+        { 0x30D8, 0x3099, 0x30D9 },
+        { 0x30D8, 0x309A, 0x30DA },
+        { 0x30DB, 0x3099, 0x30DC },
+        { 0x30DB, 0x309A, 0x30DD },
+        { 0x30EF, 0x3099, 0x30F7 },
+        { 0x30F0, 0x3099, 0x30F8 },
+        { 0x30F1, 0x3099, 0x30F9 },
+        { 0x30F2, 0x3099, 0x30FA },
+        { 0x30FD, 0x3099, 0x30FE },
+        { 0x11099, 0x110BA, 0x1109A },
+        { 0x1109B, 0x110BA, 0x1109C },
+        { 0x110A5, 0x110BA, 0x110AB },
+        { 0x11131, 0x11127, 0x1112E },
+        { 0x11132, 0x11127, 0x1112F },
+        { 0x11347, 0x1133E, 0x1134B },
+        { 0x11347, 0x11357, 0x1134C },
+        { 0x114B9, 0x114B0, 0x114BC },
+        { 0x114B9, 0x114BA, 0x114BB },
+        { 0x114B9, 0x114BD, 0x114BE },
+        { 0x115B8, 0x115AF, 0x115BA },
+        { 0x115B9, 0x115AF, 0x115BB },
+        { 0x11935, 0x11930, 0x11938 },
+    };
+}  // namespace cppm::utf8::impl::normalization_tables
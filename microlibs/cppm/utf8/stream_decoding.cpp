@@ -0,0 +1,126 @@
+// Implementation include.
+// A chunk is split into a head, the bytes that complete a pending sequence, a body that's passed
+// to the SIMD validation or transcoding, and a tail that's an incomplete but so far valid
+// sequence. An invalid tail is left in the body, so that it's reported at the right offset.
+#include <cppm/utf8/stream_decoding.hpp>
+#include <cppm/utf8/code_points.hpp>            // incomplete_tail_length, valid_sequence_at
+#include <cppm/utf8/transcoding.hpp>
+#include <cppm/utf8/validation.hpp>             // validate
+#include <cppm/basics/Byte.hpp>
+
+#include <string.h>         // memcpy
+
+namespace cppm::utf8::impl {
+    struct Head_completion
+    {
+        int         n_taken;            // Bytes from the chunk.
+        int         length;             // Bytes in the head.
+        bool        is_complete;
+        bool        is_valid;           // When incomplete: so far.
+    };
+
+    // Copies the pending bytes to `head` and adds bytes from the chunk to complete the sequence.
+    inline auto head_completion(
+        const Byte* const       pending,
+        const int               n_pending,
+        const Byte* const       begin,
+        const Byte* const       end,
+        Byte* const             head
+        ) noexcept -> Head_completion
+    {
+        const int length = sequence_length_for_lead( pending[0] );
+        memcpy( head, pending, size_t( n_pending ) );
+        int n = n_pending;
+        const Byte* p = begin;
+        while( n < length and p < end ) { head[n++] = *p++; }
+        const int n_taken = int( p - begin );
+
+        if( n < length ) { return {n_taken, n, false, is_incomplete_sequence( head, n )}; }
+        char32_t code;
+        return {n_taken, n, true, valid_sequence_at( head, head + n, code ) == n};
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    template< class Unit, class Transcode_func >
+    auto stream_decoding::Stream_decoder::transcoded(
+        in_<string_view>        chunk,
+        in_<Span<Unit>>         buffer,
+        Transcode_func&         transcode
+        ) noexcept -> Transcoding_result
+    {
+        const auto begin    = reinterpret_cast<const Byte*>( chunk.data() );
+        const auto end      = begin + chunk.size();
+        const Byte* body_begin = begin;
+        size_t n_written = 0;
+        if( m_n_pending > 0 ) {
+            Byte head[4];
+            const impl::Head_completion completion = impl::head_completion( m_pending, m_n_pending, begin, end, head );
+            if( not completion.is_valid ) { return {Transcoding_status::invalid_input, 0, 0}; }
+            if( not completion.is_complete ) {
+                memcpy( m_pending, head, size_t( completion.length ) );
+                m_n_pending = completion.length;
+                return {Transcoding_status::ok, chunk.size(), 0};
+            }
+            const auto head_text = string_view( reinterpret_cast<const char*>( head ), size_t( completion.length ) );
+            const Transcoding_result result = transcode( head_text, buffer );
+            if( not result ) { return {result.status, 0, 0}; }     // Nothing consumed.
+            n_written = result.n_written;
+            m_n_pending = 0;
+            body_begin += completion.n_taken;
+        }
+
+        const int n_tail = impl::incomplete_tail_length( body_begin, end );
+        const Byte* const body_end = end - n_tail;
+        const auto body = string_view( reinterpret_cast<const char*>( body_begin ), size_t( body_end - body_begin ) );
+        const Transcoding_result result = transcode( body, buffer.subspan( n_written ) );
+        const size_t n_read = size_t( body_begin - begin ) + result.n_read;
+        if( not result ) { return {result.status, n_read, n_written + result.n_written}; }
+
+        memcpy( m_pending, body_end, size_t( n_tail ) );
+        m_n_pending = n_tail;
+        return {Transcoding_status::ok, chunk.size(), n_written + result.n_written};
+    }
+
+    auto stream_decoding::Stream_decoder::validated( in_<string_view> chunk ) noexcept
+        -> Stream_utf8_result
+    {
+        const auto begin    = reinterpret_cast<const Byte*>( chunk.data() );
+        const auto end      = begin + chunk.size();
+        const Byte* body_begin = begin;
+        string_view head;
+        if( m_n_pending > 0 ) {
+            const impl::Head_completion completion = impl::head_completion( m_pending, m_n_pending, begin, end, m_head );
+            if( not completion.is_valid ) { return {Transcoding_status::invalid_input, 0, {}, {}}; }
+            if( not completion.is_complete ) {
+                memcpy( m_pending, m_head, size_t( completion.length ) );
+                m_n_pending = completion.length;
+                return {Transcoding_status::ok, chunk.size(), {}, {}};
+            }
+            head = string_view( reinterpret_cast<const char*>( m_head ), size_t( completion.length ) );
+            m_n_pending = 0;
+            body_begin += completion.n_taken;
+        }
+
+        const int n_tail = impl::incomplete_tail_length( body_begin, end );
+        const Byte* const body_end = end - n_tail;
+        const auto body = string_view( reinterpret_cast<const char*>( body_begin ), size_t( body_end - body_begin ) );
+        const Validation_result validation = validate( body );
+        if( not validation ) {
+            const size_t n_read = size_t( body_begin - begin ) + validation.n_valid_bytes;
+            return {Transcoding_status::invalid_input, n_read, head, body.substr( 0, validation.n_valid_bytes )};
+        }
+
+        memcpy( m_pending, body_end, size_t( n_tail ) );
+        m_n_pending = n_tail;
+        return {Transcoding_status::ok, chunk.size(), head, body};
+    }
+
+    auto stream_decoding::Stream_decoder::to_utf16( in_<string_view> chunk, in_<Span<char16_t>> buffer ) noexcept
+        -> Transcoding_result
+    { return transcoded( chunk, buffer, transcoding::to_utf16 ); }
+
+    auto stream_decoding::Stream_decoder::to_utf32( in_<string_view> chunk, in_<Span<char32_t>> buffer ) noexcept
+        -> Transcoding_result
+    { return transcoded( chunk, buffer, transcoding::to_utf32 ); }
+}  // namespace cppm::utf8
@@ -0,0 +1,60 @@
+#pragma once
+#include <cppm/utf8/transcoding.hpp>            // Transcoding_status, Transcoding_result
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string_view;           // <string_view>
+
+    inline namespace stream_decoding {
+        // The complete UTF-8 of a chunk, as views: `head` is a sequence that was split between the
+        // previous chunk and this one, completed in the decoder, and `body` is a part of the chunk.
+        struct Stream_utf8_result
+        {
+            Transcoding_status::Enum    status;     // `ok` or `invalid_input`.
+            size_t                      n_read;     // On failure: offset in the chunk of the offending input.
+            string_view                 head;
+            string_view                 body;       // On failure: the valid part before the offending input.
+
+            explicit operator bool() const noexcept { return status == Transcoding_status::ok; }
+        };
+
+        // Decodes UTF-8 that arrives in chunks, e.g. blocks read from a file or a socket, where a
+        // sequence can be split between chunks. An incomplete sequence at the end of a chunk, at
+        // most 3 bytes, is kept pending till the next chunk, so that each chunk is validated or
+        // transcoded directly with the SIMD kernels of `validate`, `to_utf16` and `to_utf32`.
+        //
+        // An invalid sequence that starts in an earlier chunk is reported at offset 0. After a
+        // failure other than `buffer_too_small` the decoder must be `reset` before further use.
+        // When the stream ends with pending bytes the input is truncated, i.e. invalid.
+        class Stream_decoder
+        {
+            Byte        m_pending[4];
+            int         m_n_pending;
+            Byte        m_head[4];          // Storage for `Stream_utf8_result::head`.
+
+            template< class Unit, class Transcode_func >
+            auto transcoded( in_<string_view> chunk, in_<Span<Unit>> buffer, Transcode_func& transcode ) noexcept
+                -> Transcoding_result;
+
+        public:
+            Stream_decoder() noexcept: m_pending(), m_n_pending( 0 ), m_head() {}
+
+            auto n_pending_bytes() const noexcept -> int { return m_n_pending; }
+            void reset() noexcept { m_n_pending = 0; }
+
+            // The views are valid until the next call and as long as `chunk`.
+            auto validated( in_<string_view> chunk ) noexcept -> Stream_utf8_result;
+
+            // With a buffer of `max_utf16_length_for_utf8( n_pending_bytes() + chunk.size() )` units,
+            // or correspondingly for UTF-32, the status is never `buffer_too_small`. With a smaller
+            // buffer, that status is with `n_read` bytes consumed and the rest to be passed again.
+            auto to_utf16( in_<string_view> chunk, in_<Span<char16_t>> buffer ) noexcept -> Transcoding_result;
+            auto to_utf32( in_<string_view> chunk, in_<Span<char32_t>> buffer ) noexcept -> Transcoding_result;
+        };
+    }  // inline namespace stream_decoding
+}  // namespace cppm::utf8
@@ -0,0 +1,788 @@
+// Implementation include.
+// Each direction has a kernel that needs no output buffer checks, for a prefix of the input
+// that's guaranteed to fit, and checked scalar code for the rest (if any) of the input.
+#include <cppm/utf8/transcoding.hpp>
+#include <cppm/utf8/code_points.hpp>                    // impl::valid_sequence_at, impl::encode_utf8, impl::piece_end
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/bits.hpp>                         // n_trailing_zeros
+#include <cppm/basics/environment/cpu.hpp>              // simd_level, CPPM_TARGET_...
+#include <cppm/basics/exception_handling/now_and_fail.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace cppm::utf8::impl {
+    using   std::min;                                       // <algorithm>
+    using   std::basic_string;                              // <string>
+    using   std::basic_string_view;                         // <string_view>
+
+    constexpr size_t transcoding_buffer_size = 16*1024;
+
+    struct Decoded{ char32_t code; int length; };      // `length` 0 means invalid or incomplete.
+
+    // Decodes one sequence with the validity rules of Unicode table 3-7. Requires `p < end`.
+    inline auto decode( const Byte* const p, const Byte* const end ) noexcept
+        -> Decoded
+    {
+        char32_t code = 0;
+        const int length = valid_sequence_at( p, end, code );
+        return {code, length};
+    }
+
+    constexpr auto utf16_length_of( const char32_t code ) noexcept -> int { return (code < 0x10000? 1 : 2); }
+
+    inline void put_utf16( const char32_t code, char16_t*& out ) noexcept
+    {
+        if( code < 0x10000 ) {
+            *out++ = char16_t( code );
+        } else {
+            const char32_t v = code - 0x10000;
+            out[0] = char16_t( 0xD800 + (v >> 10) );
+            out[1] = char16_t( 0xDC00 + (v & 0x3FF) );
+            out += 2;
+        }
+    }
+
+    constexpr auto is_high_surrogate( const char32_t u ) noexcept -> bool { return 0xD800 <= u and u < 0xDC00; }
+    constexpr auto is_low_surrogate( const char32_t u ) noexcept -> bool { return 0xDC00 <= u and u < 0xE000; }
+
+    // Decodes one UTF-16 encoded code point. Requires `p < end`.
+    inline auto decode( const char16_t* const p, const char16_t* const end ) noexcept
+        -> Decoded
+    {
+        const char32_t u = p[0];
+        if( u < 0xD800 or u >= 0xE000 ) { return {u, 1}; }
+        if( is_high_surrogate( u ) and end - p >= 2 and is_low_surrogate( p[1] ) ) {
+            return {0x10000 + ((u - 0xD800) << 10) + (p[1] - 0xDC00), 2};
+        }
+        return {};
+    }
+
+    constexpr auto utf8_length_of( const char32_t code ) noexcept
+        -> int
+    { return (code < 0x80? 1 : code < 0x800? 2 : code < 0x10000? 3 : 4); }
+
+    inline void put_utf8( const char32_t code, Byte*& out ) noexcept { out += encode_utf8( code, out ); }
+
+    // A UTF-32 unit is invalid if it's a surrogate or beyond U+10FFFF.
+    inline auto decode( const char32_t* const p, const char32_t* ) noexcept
+        -> Decoded
+    {
+        const char32_t u = p[0];
+        return (u < 0xD800 or (0xE000 <= u and u < 0x110000)? Decoded{u, 1} : Decoded{});
+    }
+
+    inline void put( const char32_t code, Byte*& out ) noexcept { put_utf8( code, out ); }
+    inline void put( const char32_t code, char16_t*& out ) noexcept { put_utf16( code, out ); }
+    inline void put( const char32_t code, char32_t*& out ) noexcept { *out++ = code; }
+
+    template< class Unit >
+    constexpr auto encoded_length_of( const char32_t code ) noexcept
+        -> int
+    { return (0?0 : sizeof( Unit ) == 1? utf8_length_of( code ) : sizeof( Unit ) == 2? utf16_length_of( code ) : 1); }
+
+    // Kernels convert the sequences that start before `limit`, reading at most up to `end`, and
+    // return `false` on invalid input at `in`. The caller guarantees room for the output.
+    template< class In, class Out >
+    using Kernel_ = auto( const In*& in, const In* limit, const In* end, Out*& out ) noexcept -> bool;
+
+    template< class In, class Out >
+    inline auto transcode_one( const In*& in, const In* const end, Out*& out ) noexcept
+        -> bool
+    {
+        const Decoded d = decode( in, end );
+        if( d.length == 0 ) { return false; }
+        put( d.code, out );
+        in += d.length;
+        return true;
+    }
+
+    // A faster special case, mainly for sequences of 2-byte UTF-8 characters.
+    inline auto transcode_one( const char16_t*& in, const char16_t* const end, Byte*& out ) noexcept
+        -> bool
+    {
+        const char32_t u = *in;
+        if( u < 0x800 ) {
+            if( u < 0x80 ) {
+                *out++ = Byte( u );
+            } else {
+                out[0] = Byte( 0xC0 | (u >> 6) );
+                out[1] = Byte( 0x80 | (u & 0x3F) );
+                out += 2;
+            }
+            ++in;
+            return true;
+        }
+        const Decoded d = decode( in, end );
+        if( d.length == 0 ) { return false; }
+        put_utf8( d.code, out );
+        in += d.length;
+        return true;
+    }
+
+    // Converts at least one sequence, and then on up to an ASCII character.
+    template< class In, class Out >
+    inline auto transcode_non_ascii_run( const In*& in, const In* const limit, const In* const end, Out*& out ) noexcept
+        -> bool
+    {
+        do {
+            if( not transcode_one( in, end, out ) ) { return false; }
+        } while( in < limit and *in >= 0x80 );
+        return true;
+    }
+
+    template< class In, class Out >
+    inline auto scalar_transcode( const In*& in_position, const In* const limit, const In* const end, Out*& out_position ) noexcept
+        -> bool
+    {
+        const In* in = in_position;  Out* out = out_position;     // Locals, not aliased by output.
+        while( in < limit ) {
+            if( not transcode_one( in, end, out ) ) { break; }
+        }
+        in_position = in;  out_position = out;
+        return (in >= limit);
+    }
+}  // namespace cppm::utf8::impl
+
+#if CPPM_CPU_IS_X86
+// In each iteration a kernel stores a vector's worth of units converted as if they were ASCII,
+// but advances only past the ASCII ones, and then converts the following non-ASCII run, if any.
+namespace cppm::utf8::impl::transcoding_kernels {
+    // For compacting 8 UTF-16 units' 2-byte UTF-8 forms when some units are ASCII (1 byte).
+    struct Compaction_table{ Byte shuffles[256][16]; Byte lengths[256]; };
+
+    constexpr auto make_compaction_table()
+        -> Compaction_table
+    {
+        Compaction_table table = {};
+        for( int ascii_bits = 0; ascii_bits < 256; ++ascii_bits ) {
+            int n = 0;
+            for( int i = 0; i < 8; ++i ) {
+                table.shuffles[ascii_bits][n++] = Byte( 2*i );
+                if( not (ascii_bits & (1 << i)) ) { table.shuffles[ascii_bits][n++] = Byte( 2*i + 1 ); }
+            }
+            table.lengths[ascii_bits] = Byte( n );
+            while( n < 16 ) { table.shuffles[ascii_bits][n++] = 0x80; }
+        }
+        return table;
+    }
+
+    alignas( 16 ) constexpr Compaction_table compaction_table = make_compaction_table();
+
+    // For compacting 8 16-bit lanes to those that are not for UTF-8 continuation bytes.
+    constexpr auto make_lane_compaction_table()
+        -> Compaction_table
+    {
+        Compaction_table table = {};
+        for( int trail_bits = 0; trail_bits < 256; ++trail_bits ) {
+            int n = 0;
+            for( int i = 0; i < 8; ++i ) {
+                if( not (trail_bits & (1 << i)) ) {
+                    table.shuffles[trail_bits][2*n] = Byte( 2*i );
+                    table.shuffles[trail_bits][2*n + 1] = Byte( 2*i + 1 );
+                    ++n;
+                }
+            }
+            table.lengths[trail_bits] = Byte( n );
+            for( int i = 2*n; i < 16; ++i ) { table.shuffles[trail_bits][i] = 0x80; }
+        }
+        return table;
+    }
+
+    alignas( 16 ) constexpr Compaction_table lane_compaction_table = make_lane_compaction_table();
+
+    namespace sse4_2 {
+        // Stores the UTF-8 form of 8 16-bit units that are all below U+0800, returns the byte count.
+        CPPM_TARGET_SSE4_2
+        inline auto store_up_to_2_byte_block( const __m128i units, Byte* const out ) noexcept
+            -> int
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i is_ascii  = _mm_cmpeq_epi16( _mm_and_si128( units, _mm_set1_epi16( short( 0xFF80 ) ) ), zero );
+            const int ascii_bits    = _mm_movemask_epi8( _mm_packs_epi16( is_ascii, zero ) );
+            const __m128i leads     = _mm_or_si128( _mm_srli_epi16( units, 6 ), _mm_set1_epi16( 0xC0 ) );
+            const __m128i trails    = _mm_or_si128( _mm_and_si128( units, _mm_set1_epi16( 0x3F ) ), _mm_set1_epi16( 0x80 ) );
+            const __m128i pairs     = _mm_or_si128( leads, _mm_slli_epi16( trails, 8 ) );
+            const __m128i words     = _mm_blendv_epi8( pairs, units, is_ascii );
+            const __m128i shuffle   = _mm_load_si128( reinterpret_cast<const __m128i*>( compaction_table.shuffles[ascii_bits] ) );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_shuffle_epi8( words, shuffle ) );
+            return compaction_table.lengths[ascii_bits];
+        }
+
+        // Converts 8 units if they're all below U+0800, i.e. 1 or 2 bytes each in UTF-8.
+        CPPM_TARGET_SSE4_2
+        inline auto convert_up_to_2_byte_block( const char16_t*& in, Byte*& out ) noexcept
+            -> bool
+        {
+            const __m128i units = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+            if( not _mm_testz_si128( units, _mm_set1_epi16( short( 0xF800 ) ) ) ) { return false; }
+            out += store_up_to_2_byte_block( units, out );
+            in += 8;
+            return true;
+        }
+
+        // Decodes 8 16-bit lanes with ASCII and lead bytes, and next bytes, skipping `trail_bits` lanes.
+        CPPM_TARGET_SSE4_2
+        inline auto store_up_to_2_byte_codes(
+            const __m128i units, const __m128i nexts, const unsigned trail_bits, char32_t* const out
+            ) noexcept
+            -> int
+        {
+            const __m128i is_lead   = _mm_cmpgt_epi16( units, _mm_set1_epi16( 0x7F ) );
+            const __m128i pairs     = _mm_or_si128(
+                _mm_slli_epi16( _mm_and_si128( units, _mm_set1_epi16( 0x1F ) ), 6 ),
+                _mm_and_si128( nexts, _mm_set1_epi16( 0x3F ) )
+                );
+            const __m128i codes     = _mm_shuffle_epi8( _mm_blendv_epi8( units, pairs, is_lead ),
+                _mm_load_si128( reinterpret_cast<const __m128i*>( lane_compaction_table.shuffles[trail_bits] ) )
+                );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_cvtepu16_epi32( codes ) );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 4 ), _mm_cvtepu16_epi32( _mm_srli_si128( codes, 8 ) ) );
+            return lane_compaction_table.lengths[trail_bits];
+        }
+
+        // Decodes 16 bytes if they're all parts of 1 and 2 byte sequences, except that a lead byte
+        // at the end is left for the next block.
+        CPPM_TARGET_SSE4_2
+        inline auto convert_up_to_2_byte_block( const Byte*& in, char32_t*& out ) noexcept
+            -> bool
+        {
+            const __m128i bytes         = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+            const unsigned non_ascii    = _mm_movemask_epi8( bytes );
+            const unsigned trails       = _mm_movemask_epi8( _mm_cmpeq_epi8(
+                _mm_and_si128( bytes, _mm_set1_epi8( char( 0xC0 ) ) ), _mm_set1_epi8( char( 0x80 ) )
+                ) );
+            // Lead bytes C0 and C1 would give overlong encodings.
+            const unsigned leads        = _mm_movemask_epi8( _mm_cmpeq_epi8(
+                _mm_and_si128( bytes, _mm_set1_epi8( char( 0xE0 ) ) ), _mm_set1_epi8( char( 0xC0 ) )
+                ) ) & ~unsigned( _mm_movemask_epi8( _mm_cmpeq_epi8(
+                _mm_and_si128( bytes, _mm_set1_epi8( char( 0xFE ) ) ), _mm_set1_epi8( char( 0xC0 ) )
+                ) ) );
+            // Each lead byte must be followed by a continuation byte, and each continuation byte
+            // must follow a lead byte.
+            if( non_ascii != (leads | trails) ) { return false; }
+            if( ((leads << 1) ^ trails) & 0xFFFF ) { return false; }
+
+            const unsigned last_lead    = leads >> 15;
+            const unsigned skipped      = trails | (last_lead << 15);
+            const __m128i zero          = _mm_setzero_si128();
+            const __m128i nexts         = _mm_srli_si128( bytes, 1 );
+            out += store_up_to_2_byte_codes(
+                _mm_unpacklo_epi8( bytes, zero ), _mm_unpacklo_epi8( nexts, zero ), skipped & 0xFF, out
+                );
+            out += store_up_to_2_byte_codes(
+                _mm_unpackhi_epi8( bytes, zero ), _mm_unpackhi_epi8( nexts, zero ), skipped >> 8, out
+                );
+            in += 16 - last_lead;
+            return true;
+        }
+
+        // 32-bit lanes with the up to 3 bytes of a sequence in reverse order, lead byte at bits 16 through 23.
+        CPPM_TARGET_SSE4_2
+        inline auto codes_from_triples( const __m128i triples ) noexcept
+            -> __m128i
+        {
+            return _mm_or_si128( _mm_or_si128(
+                _mm_srli_epi32( _mm_and_si128( triples, _mm_set1_epi32( 0x0F0000 ) ), 4 ),
+                _mm_srli_epi32( _mm_and_si128( triples, _mm_set1_epi32( 0x3F00 ) ), 2 ) ),
+                _mm_and_si128( triples, _mm_set1_epi32( 0x3F ) )
+                );
+        }
+
+        CPPM_TARGET_SSE4_2
+        inline auto are_valid_3_byte_codes( const __m128i triples, const __m128i codes ) noexcept
+            -> __m128i
+        {
+            const __m128i is_triple = _mm_cmpeq_epi32(
+                _mm_and_si128( triples, _mm_set1_epi32( 0xF0C0C0 ) ), _mm_set1_epi32( 0xE08080 )
+                );
+            const __m128i is_surrogate = _mm_cmpeq_epi32(
+                _mm_and_si128( codes, _mm_set1_epi32( 0xF800 ) ), _mm_set1_epi32( 0xD800 )
+                );
+            return _mm_andnot_si128( is_surrogate, _mm_and_si128( is_triple, _mm_cmpgt_epi32( codes, _mm_set1_epi32( 0x7FF ) ) ) );
+        }
+
+        // Decodes the run of up to 4 3-byte sequences at `in`, if any. Reads 16 bytes.
+        CPPM_TARGET_SSE4_2
+        inline auto convert_3_byte_run( const Byte*& in, char32_t*& out ) noexcept
+            -> bool
+        {
+            const __m128i bytes     = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+            const __m128i triples   = _mm_shuffle_epi8( bytes, _mm_setr_epi8(
+                2, 1, 0, -128,  5, 4, 3, -128,  8, 7, 6, -128,  11, 10, 9, -128
+                ) );
+            const __m128i codes     = codes_from_triples( triples );
+            const unsigned invalid  = ~unsigned( _mm_movemask_ps( _mm_castsi128_ps( are_valid_3_byte_codes( triples, codes ) ) ) ) & 0xF;
+            const int n = (invalid == 0? 4 : n_trailing_zeros( invalid ));
+            if( n == 0 ) { return false; }
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), codes );
+            in += 3*n;  out += n;
+            return true;
+        }
+
+        // Converts a block of 1 and 2 byte sequences, an ASCII prefix or a 3-byte sequence run.
+        CPPM_TARGET_SSE4_2
+        inline auto convert_non_ascii_block( const Byte*& in, char32_t*& out, const unsigned non_ascii ) noexcept
+            -> bool
+        {
+            if( convert_up_to_2_byte_block( in, out ) ) { return true; }
+            if( (non_ascii & 1) == 0 ) {
+                const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_cvtepu8_epi32( bytes ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 4 ), _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 4 ) ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 8 ), _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 8 ) ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 12 ), _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 12 ) ) );
+                const int n_ascii = n_trailing_zeros( non_ascii );
+                in += n_ascii;  out += n_ascii;
+                return true;
+            }
+            return ((*in & 0xF0) == 0xE0 and convert_3_byte_run( in, out ));
+        }
+
+        // Encodes the run of up to 4 code points in U+0800 through U+FFFF at `in`, if any. Writes 16 bytes.
+        CPPM_TARGET_SSE4_2
+        inline auto convert_3_byte_run( const char32_t*& in, Byte*& out ) noexcept
+            -> bool
+        {
+            const __m128i codes     = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+            const __m128i is_valid  = _mm_andnot_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi32( _mm_and_si128( codes, _mm_set1_epi32( 0xF800 ) ), _mm_set1_epi32( 0xD800 ) ),
+                    _mm_cmpgt_epi32( codes, _mm_set1_epi32( 0xFFFF ) )
+                    ),
+                _mm_cmpgt_epi32( codes, _mm_set1_epi32( 0x7FF ) )
+                );
+            const unsigned invalid  = ~unsigned( _mm_movemask_ps( _mm_castsi128_ps( is_valid ) ) ) & 0xF;
+            const int n = (invalid == 0? 4 : n_trailing_zeros( invalid ));
+            if( n == 0 ) { return false; }
+            const __m128i leads     = _mm_or_si128( _mm_srli_epi32( codes, 12 ), _mm_set1_epi32( 0xE0 ) );
+            const __m128i middles   = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( codes, 6 ), _mm_set1_epi32( 0x3F ) ), _mm_set1_epi32( 0x80 ) );
+            const __m128i lasts     = _mm_or_si128( _mm_and_si128( codes, _mm_set1_epi32( 0x3F ) ), _mm_set1_epi32( 0x80 ) );
+            const __m128i triples   = _mm_or_si128( _mm_or_si128( leads, _mm_slli_epi32( middles, 8 ) ), _mm_slli_epi32( lasts, 16 ) );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_shuffle_epi8( triples, _mm_setr_epi8(
+                0, 1, 2,  4, 5, 6,  8, 9, 10,  12, 13, 14,  -128, -128, -128, -128
+                ) ) );
+            in += n;  out += 3*n;
+            return true;
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto convert( const Byte*& in_position, const Byte* const limit, const Byte* const end, char16_t*& out_position ) noexcept
+            -> bool
+        {
+            const Byte* in = in_position;  char16_t* out = out_position;     // Locals, not aliased by output.
+            const __m128i zero = _mm_setzero_si128();
+            while( in < limit ) {
+                if( limit - in >= 16 ) {
+                    const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_unpacklo_epi8( bytes, zero ) );
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 8 ), _mm_unpackhi_epi8( bytes, zero ) );
+                    const unsigned non_ascii = _mm_movemask_epi8( bytes );
+                    const int n_ascii = (non_ascii == 0? 16 : n_trailing_zeros( non_ascii ));
+                    in += n_ascii;  out += n_ascii;
+                    if( n_ascii == 16 ) { continue; }
+                }
+                if( not transcode_non_ascii_run( in, limit, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto convert( const char16_t*& in_position, const char16_t* const limit, const char16_t* const end, Byte*& out_position ) noexcept
+            -> bool
+        {
+            const char16_t* in = in_position;  Byte* out = out_position;     // Locals, not aliased by output.
+            const __m128i non_ascii_bits = _mm_set1_epi16( short( 0xFF80 ) );
+            const __m128i zero = _mm_setzero_si128();
+            while( in < limit ) {
+                if( limit - in >= 16 ) {
+                    const __m128i units_0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+                    const __m128i units_1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + 8 ) );
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_packus_epi16( units_0, units_1 ) );
+                    const __m128i is_ascii = _mm_packs_epi16(
+                        _mm_cmpeq_epi16( _mm_and_si128( units_0, non_ascii_bits ), zero ),
+                        _mm_cmpeq_epi16( _mm_and_si128( units_1, non_ascii_bits ), zero )
+                        );
+                    const unsigned non_ascii = ~_mm_movemask_epi8( is_ascii ) & 0xFFFF;
+                    const int n_ascii = (non_ascii == 0? 16 : n_trailing_zeros( non_ascii ));
+                    in += n_ascii;  out += n_ascii;
+                    if( n_ascii == 16 ) { continue; }
+                    if( limit - in >= 8 and convert_up_to_2_byte_block( in, out ) ) { continue; }
+                }
+                if( not transcode_non_ascii_run( in, limit, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto convert( const Byte*& in_position, const Byte* const limit, const Byte* const end, char32_t*& out_position ) noexcept
+            -> bool
+        {
+            const Byte* in = in_position;  char32_t* out = out_position;     // Locals, not aliased by output.
+            while( in < limit ) {
+                if( limit - in >= 16 ) {
+                    const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+                    const unsigned non_ascii = _mm_movemask_epi8( bytes );
+                    if( non_ascii == 0 ) {
+                        _mm_storeu_si128( reinterpret_cast<__m128i*>( out ), _mm_cvtepu8_epi32( bytes ) );
+                        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 4 ), _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 4 ) ) );
+                        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 8 ), _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 8 ) ) );
+                        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 12 ), _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 12 ) ) );
+                        in += 16;  out += 16;
+                        continue;
+                    }
+                    if( convert_non_ascii_block( in, out, non_ascii ) ) { continue; }
+                }
+                if( not transcode_one( in, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto convert( const char32_t*& in_position, const char32_t* const limit, const char32_t* const end, Byte*& out_position ) noexcept
+            -> bool
+        {
+            const char32_t* in = in_position;  Byte* out = out_position;     // Locals, not aliased by output.
+            while( in < limit ) {
+                if( limit - in >= 8 ) {
+                    const __m128i codes_0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+                    const __m128i codes_1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + 4 ) );
+                    const __m128i bits = _mm_or_si128( codes_0, codes_1 );
+                    if( _mm_testz_si128( bits, _mm_set1_epi32( ~0x7F ) ) ) {
+                        const __m128i units = _mm_packus_epi32( codes_0, codes_1 );
+                        _mm_storel_epi64( reinterpret_cast<__m128i*>( out ), _mm_packus_epi16( units, units ) );
+                        in += 8;  out += 8;
+                        continue;
+                    }
+                    if( _mm_testz_si128( bits, _mm_set1_epi32( ~0x7FF ) ) ) {
+                        out += store_up_to_2_byte_block( _mm_packus_epi32( codes_0, codes_1 ), out );
+                        in += 8;
+                        continue;
+                    }
+                    if( convert_3_byte_run( in, out ) ) { continue; }
+                }
+                if( not transcode_one( in, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        CPPM_TARGET_AVX2
+        auto convert( const Byte*& in_position, const Byte* const limit, const Byte* const end, char16_t*& out_position ) noexcept
+            -> bool
+        {
+            const Byte* in = in_position;  char16_t* out = out_position;     // Locals, not aliased by output.
+            while( in < limit ) {
+                if( limit - in >= 32 ) {
+                    const __m256i bytes = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in ) );
+                    const __m256i units_0 = _mm256_cvtepu8_epi16( _mm256_castsi256_si128( bytes ) );
+                    const __m256i units_1 = _mm256_cvtepu8_epi16( _mm256_extracti128_si256( bytes, 1 ) );
+                    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), units_0 );
+                    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 16 ), units_1 );
+                    const unsigned non_ascii = _mm256_movemask_epi8( bytes );
+                    const int n_ascii = (non_ascii == 0? 32 : n_trailing_zeros( non_ascii ));
+                    in += n_ascii;  out += n_ascii;
+                    if( n_ascii == 32 ) { continue; }
+                }
+                if( not transcode_non_ascii_run( in, limit, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+
+        CPPM_TARGET_AVX2
+        auto convert( const char16_t*& in_position, const char16_t* const limit, const char16_t* const end, Byte*& out_position ) noexcept
+            -> bool
+        {
+            const char16_t* in = in_position;  Byte* out = out_position;     // Locals, not aliased by output.
+            const __m256i non_ascii_bits = _mm256_set1_epi16( short( 0xFF80 ) );
+            const __m256i zero = _mm256_setzero_si256();
+            while( in < limit ) {
+                if( limit - in >= 32 ) {
+                    const __m256i units_0 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in ) );
+                    const __m256i units_1 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in + 16 ) );
+                    // `packus` and `packs` work per 128-bit lane, so the 64-bit parts must be reordered.
+                    const __m256i bytes = _mm256_permute4x64_epi64( _mm256_packus_epi16( units_0, units_1 ), 0xD8 );
+                    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), bytes );
+                    const __m256i is_ascii = _mm256_permute4x64_epi64( _mm256_packs_epi16(
+                        _mm256_cmpeq_epi16( _mm256_and_si256( units_0, non_ascii_bits ), zero ),
+                        _mm256_cmpeq_epi16( _mm256_and_si256( units_1, non_ascii_bits ), zero )
+                        ), 0xD8 );
+                    const unsigned non_ascii = ~unsigned( _mm256_movemask_epi8( is_ascii ) );
+                    const int n_ascii = (non_ascii == 0? 32 : n_trailing_zeros( non_ascii ));
+                    in += n_ascii;  out += n_ascii;
+                    if( n_ascii == 32 ) { continue; }
+                    if( limit - in >= 8 and sse4_2::convert_up_to_2_byte_block( in, out ) ) { continue; }
+                }
+                if( not transcode_non_ascii_run( in, limit, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+
+        // Decodes the run of up to 8 3-byte sequences at `in`, if any. Reads 28 bytes.
+        CPPM_TARGET_AVX2
+        inline auto convert_3_byte_run( const Byte*& in, char32_t*& out ) noexcept
+            -> bool
+        {
+            // The shuffle works per 128-bit lane, so the upper lane is loaded from the 5th sequence.
+            const __m256i bytes     = _mm256_inserti128_si256( _mm256_castsi128_si256(
+                _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) ) ),
+                _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + 12 ) ), 1
+                );
+            const __m256i triples   = _mm256_shuffle_epi8( bytes, _mm256_setr_epi8(
+                2, 1, 0, -128,  5, 4, 3, -128,  8, 7, 6, -128,  11, 10, 9, -128,
+                2, 1, 0, -128,  5, 4, 3, -128,  8, 7, 6, -128,  11, 10, 9, -128
+                ) );
+            const __m256i codes     = _mm256_or_si256( _mm256_or_si256(
+                _mm256_srli_epi32( _mm256_and_si256( triples, _mm256_set1_epi32( 0x0F0000 ) ), 4 ),
+                _mm256_srli_epi32( _mm256_and_si256( triples, _mm256_set1_epi32( 0x3F00 ) ), 2 ) ),
+                _mm256_and_si256( triples, _mm256_set1_epi32( 0x3F ) )
+                );
+            const __m256i is_triple = _mm256_cmpeq_epi32(
+                _mm256_and_si256( triples, _mm256_set1_epi32( 0xF0C0C0 ) ), _mm256_set1_epi32( 0xE08080 )
+                );
+            const __m256i is_surrogate = _mm256_cmpeq_epi32(
+                _mm256_and_si256( codes, _mm256_set1_epi32( 0xF800 ) ), _mm256_set1_epi32( 0xD800 )
+                );
+            const __m256i is_valid  = _mm256_andnot_si256( is_surrogate,
+                _mm256_and_si256( is_triple, _mm256_cmpgt_epi32( codes, _mm256_set1_epi32( 0x7FF ) ) )
+                );
+            const unsigned invalid  = ~unsigned( _mm256_movemask_ps( _mm256_castsi256_ps( is_valid ) ) ) & 0xFF;
+            const int n = (invalid == 0? 8 : n_trailing_zeros( invalid ));
+            if( n == 0 ) { return false; }
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), codes );
+            in += 3*n;  out += n;
+            return true;
+        }
+
+        CPPM_TARGET_AVX2
+        auto convert( const Byte*& in_position, const Byte* const limit, const Byte* const end, char32_t*& out_position ) noexcept
+            -> bool
+        {
+            const Byte* in = in_position;  char32_t* out = out_position;     // Locals, not aliased by output.
+            while( in < limit ) {
+                if( limit - in >= 32 ) {
+                    const __m256i bytes = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( in ) );
+                    const unsigned non_ascii = _mm256_movemask_epi8( bytes );
+                    if( non_ascii == 0 ) {
+                        const __m128i low = _mm256_castsi256_si128( bytes );
+                        const __m128i high = _mm256_extracti128_si256( bytes, 1 );
+                        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out ), _mm256_cvtepu8_epi32( low ) );
+                        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 8 ), _mm256_cvtepu8_epi32( _mm_srli_si128( low, 8 ) ) );
+                        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 16 ), _mm256_cvtepu8_epi32( high ) );
+                        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 24 ), _mm256_cvtepu8_epi32( _mm_srli_si128( high, 8 ) ) );
+                        in += 32;  out += 32;
+                        continue;
+                    }
+                    if( (*in & 0xF0) == 0xE0 and convert_3_byte_run( in, out ) ) { continue; }
+                    if( sse4_2::convert_non_ascii_block( in, out, non_ascii & 0xFFFF ) ) { continue; }
+                }
+                if( not transcode_one( in, end, out ) ) { break; }
+            }
+            in_position = in;  out_position = out;
+            return (in >= limit);
+        }
+
+        // There's no AVX2 specific encoder from UTF-32; the SSE 4.2 one is used.
+        CPPM_TARGET_AVX2
+        auto convert( const char32_t*& in_position, const char32_t* const limit, const char32_t* const end, Byte*& out_position ) noexcept
+            -> bool
+        { return sse4_2::convert( in_position, limit, end, out_position ); }
+    }  // namespace avx2
+}  // namespace cppm::utf8::impl::transcoding_kernels
+#endif
+
+namespace cppm::utf8::impl {
+    template< class In, class Out >
+    inline auto kernel_for( const Simd_level::Enum level ) noexcept
+        -> Kernel_<In, Out>*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = transcoding_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    [[fallthrough]];
+                case Simd_level::avx2:      return k::avx2::convert;
+                case Simd_level::sse4_2:    return k::sse4_2::convert;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return scalar_transcode<In, Out>;
+    }
+
+    // `max_expansion` is the max number of output units per input unit, and `max_overshoot` is
+    // how much a sequence starting just before the kernel's limit can exceed that.
+    template< class In, class Out, class Kernel >
+    inline auto transcode(
+        Kernel&             kernel,
+        const In* const     begin,
+        const In* const     end,
+        Out* const          out_begin,
+        Out* const          out_end,
+        const size_t        max_expansion,
+        const size_t        max_overshoot
+        ) noexcept
+        -> Transcoding_result
+    {
+        using S = Transcoding_status;
+        const size_t n_in   = size_t( end - begin );
+        const size_t n_out  = size_t( out_end - out_begin );
+
+        const size_t n_unchecked = (0?0
+            : n_out >= n_in*max_expansion?  n_in
+            : n_out > max_overshoot?        (n_out - max_overshoot)/max_expansion
+            :                               0
+            );
+        const In*   in  = begin;
+        Out*        out = out_begin;
+        if( not kernel( in, begin + n_unchecked, end, out ) ) {
+            return {S::invalid_input, size_t( in - begin ), size_t( out - out_begin )};
+        }
+
+        while( in < end ) {     // Checked scalar code for the part that might not fit.
+            const Decoded d = decode( in, end );
+            if( d.length == 0 ) {
+                return {S::invalid_input, size_t( in - begin ), size_t( out - out_begin )};
+            }
+            if( out_end - out < encoded_length_of<Out>( d.code ) ) {
+                return {S::buffer_too_small, size_t( in - begin ), size_t( out - out_begin )};
+            }
+            put( d.code, out );
+            in += d.length;
+        }
+        return {S::ok, n_in, size_t( out - out_begin )};
+    }
+
+    inline auto to_utf16_with( Kernel_<Byte, char16_t>& kernel, in_<string_view> s, in_<Span<char16_t>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        const auto begin = reinterpret_cast<const Byte*>( s.data() );
+        return transcode( kernel, begin, begin + s.size(), buffer.begin(), buffer.end(), 1, 1 );
+    }
+
+    inline auto to_utf8_with( Kernel_<char16_t, Byte>& kernel, in_<u16string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        const auto out_begin = reinterpret_cast<Byte*>( buffer.data() );
+        return transcode( kernel, s.data(), s.data() + s.size(), out_begin, out_begin + buffer.size(), 3, 1 );
+    }
+
+    inline auto to_utf32_with( Kernel_<Byte, char32_t>& kernel, in_<string_view> s, in_<Span<char32_t>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        const auto begin = reinterpret_cast<const Byte*>( s.data() );
+        return transcode( kernel, begin, begin + s.size(), buffer.begin(), buffer.end(), 1, 0 );
+    }
+
+    inline auto from_utf32_with( Kernel_<char32_t, Byte>& kernel, in_<u32string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        const auto out_begin = reinterpret_cast<Byte*>( buffer.data() );
+        return transcode( kernel, s.data(), s.data() + s.size(), out_begin, out_begin + buffer.size(), 4, 0 );
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8::impl {
+    // Splitting points for the convenience functions, that don't split a sequence. The one for
+    // UTF-8 is in "code_points.hpp".
+    inline auto piece_end( in_<u16string_view> s, const size_t n ) noexcept
+        -> size_t
+    { return (n < s.size() and is_high_surrogate( s[n - 1] )? n - 1 : n); }
+
+    inline auto piece_end( in_<u32string_view>, const size_t n ) noexcept -> size_t { return n; }
+
+    // Converts via a small buffer. A worst case sized result string would be zero-filled, which
+    // for UTF-8 output means writing 3 or 4 times the input size.
+    template< class Out, class In, class Converter >
+    auto converted(
+        const basic_string_view<In>     s,
+        Converter&                      convert,
+        const size_t                    max_expansion,
+        const char* const               error_format
+        ) -> basic_string<Out>
+    {
+        basic_string<Out> result;
+        result.reserve( s.size() );
+        Out buffer[transcoding_buffer_size];
+        for( size_t offset = 0; offset < s.size(); ) {
+            const size_t n = piece_end(
+                s.substr( offset ), min( s.size() - offset, std::size( buffer )/max_expansion )
+                );
+            const Transcoding_result r = convert( s.substr( offset, n ), Span<Out>( buffer ) );
+            now( !!r ) or fail( error_format, offset + r.n_read );
+            result.append( buffer, r.n_written );
+            offset += n;
+        }
+        return result;
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    auto transcoding::to_utf16( in_<string_view> s, in_<Span<char16_t>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        static impl::Kernel_<Byte, char16_t>* const the_kernel = impl::kernel_for<Byte, char16_t>( Simd_level::_ );
+        return impl::to_utf16_with( *the_kernel, s, buffer );
+    }
+
+    auto transcoding::to_utf8( in_<u16string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        static impl::Kernel_<char16_t, Byte>* const the_kernel = impl::kernel_for<char16_t, Byte>( Simd_level::_ );
+        return impl::to_utf8_with( *the_kernel, s, buffer );
+    }
+
+    auto transcoding::to_utf16_using( const Simd_level::Enum level, in_<string_view> s, in_<Span<char16_t>> buffer ) noexcept
+        -> Transcoding_result
+    { return impl::to_utf16_with( *impl::kernel_for<Byte, char16_t>( level ), s, buffer ); }
+
+    auto transcoding::to_utf8_using( const Simd_level::Enum level, in_<u16string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    { return impl::to_utf8_with( *impl::kernel_for<char16_t, Byte>( level ), s, buffer ); }
+
+    auto transcoding::to_utf32( in_<string_view> s, in_<Span<char32_t>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        static impl::Kernel_<Byte, char32_t>* const the_kernel = impl::kernel_for<Byte, char32_t>( Simd_level::_ );
+        return impl::to_utf32_with( *the_kernel, s, buffer );
+    }
+
+    auto transcoding::from_utf32( in_<u32string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    {
+        static impl::Kernel_<char32_t, Byte>* const the_kernel = impl::kernel_for<char32_t, Byte>( Simd_level::_ );
+        return impl::from_utf32_with( *the_kernel, s, buffer );
+    }
+
+    auto transcoding::to_utf32_using( const Simd_level::Enum level, in_<string_view> s, in_<Span<char32_t>> buffer ) noexcept
+        -> Transcoding_result
+    { return impl::to_utf32_with( *impl::kernel_for<Byte, char32_t>( level ), s, buffer ); }
+
+    auto transcoding::from_utf32_using( const Simd_level::Enum level, in_<u32string_view> s, in_<Span<char>> buffer ) noexcept
+        -> Transcoding_result
+    { return impl::from_utf32_with( *impl::kernel_for<char32_t, Byte>( level ), s, buffer ); }
+
+    auto transcoding::utf16_from( in_<string_view> s )
+        -> u16string
+    { return impl::converted<char16_t>( s, to_utf16, 1, "utf16_from: invalid UTF-8 at byte offset {}." ); }
+
+    auto transcoding::utf8_from( in_<u16string_view> s )
+        -> string
+    { return impl::converted<char>( s, to_utf8, 3, "utf8_from: invalid UTF-16 at unit offset {}." ); }
+
+    auto transcoding::utf32_from( in_<string_view> s )
+        -> u32string
+    { return impl::converted<char32_t>( s, to_utf32, 1, "utf32_from: invalid UTF-8 at byte offset {}." ); }
+
+    auto transcoding::utf8_from( in_<u32string_view> s )
+        -> string
+    { return impl::converted<char>( s, from_utf32, 4, "utf8_from: invalid UTF-32 at unit offset {}." ); }
+}  // namespace cppm::utf8
@@ -0,0 +1,56 @@
+#pragma once
+#include <cppm/basics/collection-support/Span.hpp>
+#include <cppm/basics/environment/cpu.hpp>      // Simd_level
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string>
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string, std::u16string, std::u32string,                // <string>
+            std::string_view, std::u16string_view, std::u32string_view; // <string_view>
+
+    inline namespace transcoding {
+        struct Transcoding_status{ enum Enum{ ok, invalid_input, buffer_too_small }; };
+
+        struct Transcoding_result
+        {
+            Transcoding_status::Enum    status;
+            size_t                      n_read;     // On failure: offset of the offending input.
+            size_t                      n_written;  // Always a complete encoding of `n_read` units.
+
+            explicit operator bool() const noexcept { return status == Transcoding_status::ok; }
+        };
+
+        // Buffer sizes sufficient for any valid input, for single pass conversion.
+        constexpr auto max_utf16_length_for_utf8( const size_t n_bytes ) -> size_t { return n_bytes; }
+        constexpr auto max_utf8_length_for_utf16( const size_t n_units ) -> size_t { return 3*n_units; }
+        constexpr auto max_utf32_length_for_utf8( const size_t n_bytes ) -> size_t { return n_bytes; }
+        constexpr auto max_utf8_length_for_utf32( const size_t n_units ) -> size_t { return 4*n_units; }
+
+        // Invalid input is an error, as with `MB_ERR_INVALID_CHARS` and `WC_ERR_INVALID_CHARS` in
+        // Windows: there's no substitution of U+FFFD. Lone surrogates are invalid in UTF-16 input,
+        // and surrogates and values beyond U+10FFFF are invalid in UTF-32 input.
+        extern auto to_utf16( in_<string_view> s, in_<Span<char16_t>> buffer ) noexcept -> Transcoding_result;
+        extern auto to_utf8( in_<u16string_view> s, in_<Span<char>> buffer ) noexcept -> Transcoding_result;
+        extern auto to_utf32( in_<string_view> s, in_<Span<char32_t>> buffer ) noexcept -> Transcoding_result;
+        extern auto from_utf32( in_<u32string_view> s, in_<Span<char>> buffer ) noexcept -> Transcoding_result;
+
+        // Mainly for testing and benchmarking. A `level` above `simd_level()` is reduced to that.
+        extern auto to_utf16_using( Simd_level::Enum level, in_<string_view> s, in_<Span<char16_t>> buffer ) noexcept
+            -> Transcoding_result;
+        extern auto to_utf8_using( Simd_level::Enum level, in_<u16string_view> s, in_<Span<char>> buffer ) noexcept
+            -> Transcoding_result;
+        extern auto to_utf32_using( Simd_level::Enum level, in_<string_view> s, in_<Span<char32_t>> buffer ) noexcept
+            -> Transcoding_result;
+        extern auto from_utf32_using( Simd_level::Enum level, in_<u32string_view> s, in_<Span<char>> buffer ) noexcept
+            -> Transcoding_result;
+
+        // Convenience wrappers that `fail` on invalid input.
+        extern auto utf16_from( in_<string_view> s ) -> u16string;
+        extern auto utf8_from( in_<u16string_view> s ) -> string;
+        extern auto utf32_from( in_<string_view> s ) -> u32string;
+        extern auto utf8_from( in_<u32string_view> s ) -> string;
+    }  // inline namespace transcoding
+}  // namespace cppm::utf8
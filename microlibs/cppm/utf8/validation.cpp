@@ -0,0 +1,411 @@
+// Implementation include.
+// The SIMD kernels use the lookup algorithm of Keiser & Lemire, “Validating UTF-8 In Less Than
+// One Instruction Per Byte”, 2021. They only locate a 64 byte chunk with an error; the exact
+// offset is then found by the scalar code, which also handles the tail of the string.
+#include <cppm/utf8/validation.hpp>
+#include <cppm/utf8/code_points.hpp>         // is_continuation_byte, valid_sequence_at
+#include <cppm/basics/Byte.hpp>
+#include <cppm/basics/bits.hpp>                 // n_trailing_zeros
+
+#include <algorithm>
+#include <string.h>         // memcpy
+
+namespace cppm::utf8::impl {
+    using   std::min;           // <algorithm>
+
+    // Returns a pointer to the start of the first invalid sequence, or `end`.
+    inline auto scalar_first_invalid( const Byte* p, const Byte* const end ) noexcept
+        -> const Byte*
+    {
+        constexpr uint64_t high_bits = 0x8080'8080'8080'8080;
+        while( p < end ) {
+            if( end - p >= 8 ) {
+                uint64_t word;  memcpy( &word, p, 8 );
+                if( (word & high_bits) == 0 ) { p += 8; continue; }
+            }
+
+            char32_t code;
+            const int length = valid_sequence_at( p, end, code );
+            if( length == 0 ) { return p; }
+            p += length;
+        }
+        return end;
+    }
+
+    // Start of the last sequence that begins before `p`, which a SIMD chunk can't have fully checked.
+    inline auto start_of_sequence_before( const Byte* const p, const Byte* const begin ) noexcept
+        -> const Byte*
+    {
+        if( p == begin ) { return p; }
+        const Byte* s = p - 1;
+        for( int i = 0; i < 3 and s > begin and is_continuation_byte( *s ); ++i ) { --s; }
+        return s;
+    }
+
+    inline auto scalar_ascii_prefix_end( const Byte* p, const Byte* const end ) noexcept
+        -> const Byte*
+    {
+        for( ; end - p >= 8; p += 8 ) {
+            uint64_t word;  memcpy( &word, p, 8 );
+            if( const uint64_t high = word & 0x8080'8080'8080'8080 ) {     // Little-endian assumed.
+                return p + n_trailing_zeros( high )/8;
+            }
+        }
+        while( p < end and *p < 0x80 ) { ++p; }
+        return p;
+    }
+}  // namespace cppm::utf8::impl
+
+#if CPPM_CPU_IS_X86
+namespace cppm::utf8::impl::validation_kernels {
+    // Error bits of the lookup tables. The names say what a pair of bytes can be an error of.
+    constexpr Byte  too_short       = 1 << 0;   // 11______ 0_______ or 11______ 11______
+    constexpr Byte  too_long        = 1 << 1;   // 0_______ 10______
+    constexpr Byte  overlong_3      = 1 << 2;   // 11100000 100_____
+    constexpr Byte  too_large       = 1 << 3;   // 11110100 1001____ etc.
+    constexpr Byte  surrogate       = 1 << 4;   // 11101101 101_____
+    constexpr Byte  overlong_2      = 1 << 5;   // 1100000_ 10______
+    constexpr Byte  too_large_1000  = 1 << 6;   // 11110101 1000____ etc.
+    constexpr Byte  overlong_4      = 1 << 6;   // 11110000 1000____
+    constexpr Byte  two_conts       = 1 << 7;   // 10______ 10______
+    constexpr Byte  carry           = too_short | too_long | two_conts;
+
+    // Indexed by the high nibble of the first byte of a pair.
+    alignas( 16 ) constexpr Byte byte_1_high_table[16] =
+    {
+        too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+        two_conts, two_conts, two_conts, two_conts,
+        too_short | overlong_2,
+        too_short,
+        too_short | overlong_3 | surrogate,
+        too_short | too_large | too_large_1000 | overlong_4
+    };
+
+    // Indexed by the low nibble of the first byte of a pair.
+    alignas( 16 ) constexpr Byte byte_1_low_table[16] =
+    {
+        carry | overlong_3 | overlong_2 | overlong_4,
+        carry | overlong_2,
+        carry,
+        carry,
+        carry | too_large,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000
+    };
+
+    // Indexed by the high nibble of the second byte of a pair.
+    alignas( 16 ) constexpr Byte byte_2_high_table[16] =
+    {
+        too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        too_long | overlong_2 | two_conts | surrogate  | too_large,
+        too_long | overlong_2 | two_conts | surrogate  | too_large,
+        too_short, too_short, too_short, too_short
+    };
+
+    // A byte above the limit for its position at the end of a chunk starts an incomplete sequence.
+    alignas( 16 ) constexpr Byte incomplete_limits[16] =
+    {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+    };
+
+    namespace sse4_2 {
+        using V = __m128i;
+
+        CPPM_TARGET_SSE4_2 inline auto load( const void* p ) -> V { return _mm_loadu_si128( static_cast<const V*>( p ) ); }
+        CPPM_TARGET_SSE4_2 inline auto table( const Byte* t ) -> V { return _mm_load_si128( reinterpret_cast<const V*>( t ) ); }
+        CPPM_TARGET_SSE4_2 inline auto high_nibbles( const V v ) -> V { return _mm_and_si128( _mm_srli_epi16( v, 4 ), _mm_set1_epi8( 0x0F ) ); }
+        CPPM_TARGET_SSE4_2 inline auto low_nibbles( const V v ) -> V { return _mm_and_si128( v, _mm_set1_epi8( 0x0F ) ); }
+
+        CPPM_TARGET_SSE4_2
+        inline auto errors_in( const V input, const V prev_input )
+            -> V
+        {
+            const V prev1 = _mm_alignr_epi8( input, prev_input, 16 - 1 );
+            const V special_cases = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_shuffle_epi8( table( byte_1_high_table ), high_nibbles( prev1 ) ),
+                    _mm_shuffle_epi8( table( byte_1_low_table ), low_nibbles( prev1 ) )
+                    ),
+                _mm_shuffle_epi8( table( byte_2_high_table ), high_nibbles( input ) )
+                );
+
+            const V prev2 = _mm_alignr_epi8( input, prev_input, 16 - 2 );
+            const V prev3 = _mm_alignr_epi8( input, prev_input, 16 - 3 );
+            const V is_third_byte   = _mm_subs_epu8( prev2, _mm_set1_epi8( char( 0xE0 - 0x80 ) ) );
+            const V is_fourth_byte  = _mm_subs_epu8( prev3, _mm_set1_epi8( char( 0xF0 - 0x80 ) ) );
+            const V must23_80 = _mm_and_si128(
+                _mm_or_si128( is_third_byte, is_fourth_byte ), _mm_set1_epi8( char( 0x80 ) )
+                );
+            return _mm_xor_si128( must23_80, special_cases );
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto find_suspect_chunk( const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            V prev_input        = _mm_setzero_si128();
+            V prev_incomplete   = _mm_setzero_si128();
+            for( ; end - p >= 64; p += 64 ) {
+                const V in[4] = { load( p ), load( p + 16 ), load( p + 32 ), load( p + 48 ) };
+                const V any_bits = _mm_or_si128( _mm_or_si128( in[0], in[1] ), _mm_or_si128( in[2], in[3] ) );
+                V error;
+                if( _mm_movemask_epi8( any_bits ) == 0 ) {
+                    error = prev_incomplete;
+                    prev_incomplete = _mm_setzero_si128();
+                } else {
+                    error = _mm_or_si128(
+                        _mm_or_si128( errors_in( in[0], prev_input ), errors_in( in[1], in[0] ) ),
+                        _mm_or_si128( errors_in( in[2], in[1] ), errors_in( in[3], in[2] ) )
+                        );
+                    prev_incomplete = _mm_subs_epu8( in[3], table( incomplete_limits ) );
+                }
+                if( not _mm_testz_si128( error, error ) ) { return p; }
+                prev_input = in[3];
+            }
+            return p;
+        }
+
+        CPPM_TARGET_SSE4_2
+        auto ascii_prefix_end( const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            for( ; end - p >= 16; p += 16 ) {
+                if( const int mask = _mm_movemask_epi8( load( p ) ) ) { return p + n_trailing_zeros( mask ); }
+            }
+            return scalar_ascii_prefix_end( p, end );
+        }
+    }  // namespace sse4_2
+
+    namespace avx2 {
+        using V = __m256i;
+
+        CPPM_TARGET_AVX2 inline auto load( const void* p ) -> V { return _mm256_loadu_si256( static_cast<const V*>( p ) ); }
+        CPPM_TARGET_AVX2 inline auto table( const Byte* t ) -> V { return _mm256_broadcastsi128_si256( _mm_load_si128( reinterpret_cast<const __m128i*>( t ) ) ); }
+        CPPM_TARGET_AVX2 inline auto high_nibbles( const V v ) -> V { return _mm256_and_si256( _mm256_srli_epi16( v, 4 ), _mm256_set1_epi8( 0x0F ) ); }
+        CPPM_TARGET_AVX2 inline auto low_nibbles( const V v ) -> V { return _mm256_and_si256( v, _mm256_set1_epi8( 0x0F ) ); }
+
+        template< int n >
+        CPPM_TARGET_AVX2 inline auto prev( const V input, const V prev_input )
+            -> V
+        { return _mm256_alignr_epi8( input, _mm256_permute2x128_si256( prev_input, input, 0x21 ), 16 - n ); }
+
+        CPPM_TARGET_AVX2
+        inline auto errors_in( const V input, const V prev_input )
+            -> V
+        {
+            const V prev1 = prev<1>( input, prev_input );
+            const V special_cases = _mm256_and_si256(
+                _mm256_and_si256(
+                    _mm256_shuffle_epi8( table( byte_1_high_table ), high_nibbles( prev1 ) ),
+                    _mm256_shuffle_epi8( table( byte_1_low_table ), low_nibbles( prev1 ) )
+                    ),
+                _mm256_shuffle_epi8( table( byte_2_high_table ), high_nibbles( input ) )
+                );
+
+            const V is_third_byte   = _mm256_subs_epu8( prev<2>( input, prev_input ), _mm256_set1_epi8( char( 0xE0 - 0x80 ) ) );
+            const V is_fourth_byte  = _mm256_subs_epu8( prev<3>( input, prev_input ), _mm256_set1_epi8( char( 0xF0 - 0x80 ) ) );
+            const V must23_80 = _mm256_and_si256(
+                _mm256_or_si256( is_third_byte, is_fourth_byte ), _mm256_set1_epi8( char( 0x80 ) )
+                );
+            return _mm256_xor_si256( must23_80, special_cases );
+        }
+
+        CPPM_TARGET_AVX2
+        auto find_suspect_chunk( const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            const V limits = _mm256_inserti128_si256(
+                _mm256_set1_epi8( char( 0xFF ) ), _mm_load_si128( reinterpret_cast<const __m128i*>( incomplete_limits ) ), 1
+                );
+            V prev_input        = _mm256_setzero_si256();
+            V prev_incomplete   = _mm256_setzero_si256();
+            for( ; end - p >= 64; p += 64 ) {
+                const V in[2] = { load( p ), load( p + 32 ) };
+                V error;
+                if( _mm256_movemask_epi8( _mm256_or_si256( in[0], in[1] ) ) == 0 ) {
+                    error = prev_incomplete;
+                    prev_incomplete = _mm256_setzero_si256();
+                } else {
+                    error = _mm256_or_si256( errors_in( in[0], prev_input ), errors_in( in[1], in[0] ) );
+                    prev_incomplete = _mm256_subs_epu8( in[1], limits );
+                }
+                if( not _mm256_testz_si256( error, error ) ) { return p; }
+                prev_input = in[1];
+            }
+            return p;
+        }
+
+        CPPM_TARGET_AVX2
+        auto ascii_prefix_end( const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            for( ; end - p >= 32; p += 32 ) {
+                if( const unsigned mask = _mm256_movemask_epi8( load( p ) ) ) { return p + n_trailing_zeros( mask ); }
+            }
+            return sse4_2::ascii_prefix_end( p, end );
+        }
+    }  // namespace avx2
+
+    namespace avx512 {
+        using V = __m512i;
+
+        CPPM_TARGET_AVX512 inline auto load( const void* p ) -> V { return _mm512_loadu_si512( p ); }
+        CPPM_TARGET_AVX512 inline auto table( const Byte* t ) -> V { return _mm512_maskz_broadcast_i32x4( 0xFFFF, _mm_load_si128( reinterpret_cast<const __m128i*>( t ) ) ); }
+        CPPM_TARGET_AVX512 inline auto high_nibbles( const V v ) -> V { return _mm512_and_si512( _mm512_srli_epi16( v, 4 ), _mm512_set1_epi8( 0x0F ) ); }
+        CPPM_TARGET_AVX512 inline auto low_nibbles( const V v ) -> V { return _mm512_and_si512( v, _mm512_set1_epi8( 0x0F ) ); }
+
+        template< int n >
+        CPPM_TARGET_AVX512 inline auto prev( const V input, const V prev_input )
+            -> V
+        {
+            // The 128-bit lanes of `shifted` are: last lane of `prev_input`, then the first 3 of `input`.
+            const V shifted = _mm512_permutex2var_epi64( prev_input, _mm512_set_epi64( 13, 12, 11, 10, 9, 8, 7, 6 ), input );
+            return _mm512_alignr_epi8( input, shifted, 16 - n );
+        }
+
+        CPPM_TARGET_AVX512
+        inline auto errors_in( const V input, const V prev_input )
+            -> V
+        {
+            const V prev1 = prev<1>( input, prev_input );
+            const V special_cases = _mm512_and_si512(
+                _mm512_and_si512(
+                    _mm512_shuffle_epi8( table( byte_1_high_table ), high_nibbles( prev1 ) ),
+                    _mm512_shuffle_epi8( table( byte_1_low_table ), low_nibbles( prev1 ) )
+                    ),
+                _mm512_shuffle_epi8( table( byte_2_high_table ), high_nibbles( input ) )
+                );
+
+            const V is_third_byte   = _mm512_subs_epu8( prev<2>( input, prev_input ), _mm512_set1_epi8( char( 0xE0 - 0x80 ) ) );
+            const V is_fourth_byte  = _mm512_subs_epu8( prev<3>( input, prev_input ), _mm512_set1_epi8( char( 0xF0 - 0x80 ) ) );
+            const V must23_80 = _mm512_and_si512(
+                _mm512_or_si512( is_third_byte, is_fourth_byte ), _mm512_set1_epi8( char( 0x80 ) )
+                );
+            return _mm512_xor_si512( must23_80, special_cases );
+        }
+
+        CPPM_TARGET_AVX512
+        auto find_suspect_chunk( const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            const V limits = _mm512_inserti32x4(
+                _mm512_set1_epi8( char( 0xFF ) ), _mm_load_si128( reinterpret_cast<const __m128i*>( incomplete_limits ) ), 3
+                );
+            V prev_input        = _mm512_setzero_si512();
+            V prev_incomplete   = _mm512_setzero_si512();
+            for( ; end - p >= 64; p += 64 ) {
+                const V input = load( p );
+                V error;
+                if( _mm512_movepi8_mask( input ) == 0 ) {
+                    error = prev_incomplete;
+                    prev_incomplete = _mm512_setzero_si512();
+                } else {
+                    error = errors_in( input, prev_input );
+                    prev_incomplete = _mm512_subs_epu8( input, limits );
+                }
+                if( _mm512_test_epi8_mask( error, error ) != 0 ) { return p; }
+                prev_input = input;
+            }
+            return p;
+        }
+
+        CPPM_TARGET_AVX512
+        auto ascii_prefix_end( const Byte* p, const Byte* const end ) noexcept
+            -> const Byte*
+        {
+            for( ; end - p >= 64; p += 64 ) {
+                if( const uint64_t mask = _mm512_movepi8_mask( load( p ) ) ) { return p + n_trailing_zeros( mask ); }
+            }
+            return avx2::ascii_prefix_end( p, end );
+        }
+    }  // namespace avx512
+}  // namespace cppm::utf8::impl::validation_kernels
+#endif
+
+namespace cppm::utf8::impl {
+    using Chunk_scanner = auto( const Byte*, const Byte* ) noexcept -> const Byte*;
+
+    // A suspect chunk finder returns the start of the first 64 byte chunk with an error, or the
+    // end of the whole chunks. It's always correct to return the start, i.e. just use scalar code.
+    inline auto no_suspect_chunk_finder( const Byte* const begin, const Byte* ) noexcept
+        -> const Byte*
+    { return begin; }
+
+    inline auto suspect_chunk_finder_for( const Simd_level::Enum level ) noexcept
+        -> Chunk_scanner*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = validation_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    return k::avx512::find_suspect_chunk;
+                case Simd_level::avx2:      return k::avx2::find_suspect_chunk;
+                case Simd_level::sse4_2:    return k::sse4_2::find_suspect_chunk;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return no_suspect_chunk_finder;
+    }
+
+    inline auto ascii_prefix_end_finder_for( const Simd_level::Enum level ) noexcept
+        -> Chunk_scanner*
+    {
+        #if CPPM_CPU_IS_X86
+            namespace k = validation_kernels;
+            switch( min( level, simd_level() ) ) {
+                case Simd_level::avx512:    return k::avx512::ascii_prefix_end;
+                case Simd_level::avx2:      return k::avx2::ascii_prefix_end;
+                case Simd_level::sse4_2:    return k::sse4_2::ascii_prefix_end;
+                default:                    break;
+            }
+        #endif
+        (void) level;
+        return scalar_ascii_prefix_end;
+    }
+
+    inline auto validate_with( Chunk_scanner& find_suspect_chunk, in_<string_view> s ) noexcept
+        -> Validation_result
+    {
+        const auto begin    = reinterpret_cast<const Byte*>( s.data() );
+        const auto end      = begin + s.size();
+
+        const Byte* const checked_end = find_suspect_chunk( begin, end );
+        const Byte* const first_invalid = scalar_first_invalid(
+            start_of_sequence_before( checked_end, begin ), end
+            );
+        return { first_invalid == end, size_t( first_invalid - begin ) };
+    }
+}  // namespace cppm::utf8::impl
+
+namespace cppm::utf8 {
+    auto validation::validate( in_<string_view> s ) noexcept
+        -> Validation_result
+    {
+        static impl::Chunk_scanner* const the_finder = impl::suspect_chunk_finder_for( Simd_level::_ );
+        return impl::validate_with( *the_finder, s );
+    }
+
+    auto validation::validate_using( const Simd_level::Enum level, in_<string_view> s ) noexcept
+        -> Validation_result
+    { return impl::validate_with( *impl::suspect_chunk_finder_for( level ), s ); }
+
+    auto validation::ascii_prefix_length( in_<string_view> s ) noexcept
+        -> size_t
+    {
+        static impl::Chunk_scanner* const the_finder = impl::ascii_prefix_end_finder_for( Simd_level::_ );
+        const auto begin = reinterpret_cast<const Byte*>( s.data() );
+        return size_t( the_finder( begin, begin + s.size() ) - begin );
+    }
+}  // namespace cppm::utf8
@@ -0,0 +1,37 @@
+#pragma once
+#include <cppm/basics/environment/cpu.hpp>      // Simd_level
+#include <cppm/basics/type_makers.hpp>          // in_
+
+#include <stddef.h>         // size_t
+#include <string_view>
+
+namespace cppm::utf8 {
+    using   std::string_view;           // <string_view>
+
+    inline namespace validation {
+        struct Validation_result
+        {
+            bool        is_valid;
+            size_t      n_valid_bytes;      // Offset of the first invalid sequence, or the full size.
+
+            explicit operator bool() const noexcept { return is_valid; }
+        };
+
+        // Uses the best SIMD kernel for the CPU, as determined on first call, else scalar code.
+        extern auto validate( in_<string_view> s ) noexcept -> Validation_result;
+
+        // Mainly for testing and benchmarking. A `level` above `simd_level()` is reduced to that.
+        extern auto validate_using( Simd_level::Enum level, in_<string_view> s ) noexcept
+            -> Validation_result;
+
+        extern auto ascii_prefix_length( in_<string_view> s ) noexcept -> size_t;
+
+        inline auto is_valid( in_<string_view> s ) noexcept
+            -> bool
+        { return validate( s ).is_valid; }
+
+        inline auto is_ascii( in_<string_view> s ) noexcept
+            -> bool
+        { return ascii_prefix_length( s ) == s.size(); }
+    }  // inline namespace validation
+}  // namespace cppm::utf8
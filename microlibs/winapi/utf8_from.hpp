@@ -8,7 +8,8 @@ namespace winapi {
     using   cppm::in_, cppm::now, cppm::fail, cppm::intsize_of;
     using   std::string, std::wstring;                  // <string>
  
-    auto utf8_from( in_<wstring> s )
+    // Self-contained, so that it can be used without building "cppm.cpp".
+    inline auto utf8_from( in_<wstring> s )
         -> string
     {
         if( s.empty() ) { return ""; }
@@ -0,0 +1,90 @@
+#!/usr/bin/env perl
+# Generates `microlibs/cppm/utf8/case_folding.tables.hpp` from the Unicode database of the
+# running Perl, e.g. `perl tools/generate-case-folding-tables.pl > microlibs/cppm/utf8/case_folding.tables.hpp`.
+#
+# The folding is the full case folding of CaseFolding.txt, statuses C and F, as by Perl's `fc`.
+# Per code point there's a 16-bit index of its folding, where 0 means that it folds to itself,
+# in a two-stage trie with identical blocks shared. A folding is 1 through 3 code points.
+use strict;
+use warnings;
+use feature qw( fc unicode_strings );
+use Unicode::UCD;
+
+my $block_bits  = 7;
+my $block_size  = 1 << $block_bits;
+my $n_blocks    = 0x110000 >> $block_bits;
+
+my @folding_index = (0) x 0x110000;
+my @foldings = ( [0, 0, 0] );
+{
+    no warnings 'utf8';     # Surrogates and noncharacters.
+    for my $code ( 0 .. 0x10FFFF ) {
+        my $folded = fc( chr( $code ) );
+        next if $folded eq chr( $code );
+        my @codes = map { ord } split //, $folded;
+        die "Too long folding.\n" if @codes > 3;
+        $folding_index[$code] = scalar @foldings;
+        push @foldings, [@codes, (0) x (3 - @codes)];
+    }
+}
+die "Too many foldings for a 16-bit index.\n" if @foldings > 0x10000;
+
+my ( %index_of_block, @blocks, @block_index );
+for my $b ( 0 .. $n_blocks - 1 ) {
+    my @block = @folding_index[$b*$block_size .. ($b + 1)*$block_size - 1];
+    my $key = join( ',', @block );
+    if( not exists $index_of_block{$key} ) {
+        $index_of_block{$key} = scalar @blocks;
+        push @blocks, [@block];
+    }
+    push @block_index, $index_of_block{$key};
+}
+die "Too many distinct blocks for a byte index.\n" if @blocks > 256;
+
+sub rows_of
+{
+    my ( $indent, $n_per_row, $format, @values ) = @_;
+    my @rows;
+    while( @values ) {
+        push @rows, $indent . join( ', ', map { sprintf $format, $_ } splice( @values, 0, $n_per_row ) ) . ',';
+    }
+    return join( "\n", @rows );
+}
+
+my $version     = Unicode::UCD::UnicodeVersion();
+my $n_distinct  = scalar @blocks;
+my $n_foldings  = scalar @foldings;
+my $index_rows  = rows_of( ' ' x 8, 16, '0x%02X', @block_index );
+my $block_rows  = join( "\n", map { "        {\n" . rows_of( ' ' x 12, 16, '0x%04X', @$_ ) . "\n        }," } @blocks );
+my $folding_rows = join( "\n", map { sprintf '        { 0x%04X, 0x%04X, 0x%04X },', @$_ } @foldings );
+
+print <<"END";
+#pragma once
+// Generated by `tools/generate-case-folding-tables.pl` from Unicode $version data. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+#include <stdint.h>         // uint16_t
+
+namespace cppm::utf8::impl::case_folding_tables {
+    constexpr char  unicode_version[]   = "$version";
+    constexpr int   block_bits          = $block_bits;
+
+    // Index of the block of folding indices for each $block_size code points.
+    inline constexpr Byte block_index[$n_blocks] =
+    {
+$index_rows
+    };
+
+    // Indices in `foldings`, where 0 means that the code point folds to itself.
+    inline constexpr uint16_t blocks[$n_distinct][$block_size] =
+    {
+$block_rows
+    };
+
+    // The full case foldings, padded with zeroes.
+    inline constexpr char32_t foldings[$n_foldings][3] =
+    {
+$folding_rows
+    };
+}  // namespace cppm::utf8::impl::case_folding_tables
+END
@@ -0,0 +1,132 @@
+#!/usr/bin/env perl
+# Generates `microlibs/cppm/codepages/registry.tables.hpp` from the Encode module of the running
+# Perl, e.g. `perl tools/generate-codepage-tables.pl > microlibs/cppm/codepages/registry.tables.hpp`.
+#
+# The codepages are single-byte with ASCII as bytes 0x00 through 0x7F. Per codepage there's the
+# UTF-8 sequence of each byte 0x80 through 0xFF, and for the reverse mapping an index per 256 code
+# points of the BMP into pages of bytes shared by all codepages, where page 0 maps nothing.
+use strict;
+use warnings;
+use Encode qw( find_encoding );
+
+# Windows codepage identifier (0 if Windows has none), name, aliases, Perl encoding.
+my @codepages = (
+    [   437,    'IBM437',       'cp437 437',                    'cp437' ],
+    [   850,    'IBM850',       'cp850 850',                    'cp850' ],
+    [  1252,    'windows-1252', 'cp1252 1252',                  'cp1252' ],
+    [ 28591,    'ISO-8859-1',   'latin1 l1 cp28591 28591',      'iso-8859-1' ],
+    [ 28592,    'ISO-8859-2',   'latin2 l2 cp28592 28592',      'iso-8859-2' ],
+    [ 28593,    'ISO-8859-3',   'latin3 l3 cp28593 28593',      'iso-8859-3' ],
+    [ 28594,    'ISO-8859-4',   'latin4 l4 cp28594 28594',      'iso-8859-4' ],
+    [ 28595,    'ISO-8859-5',   'cyrillic cp28595 28595',       'iso-8859-5' ],
+    [ 28596,    'ISO-8859-6',   'arabic cp28596 28596',         'iso-8859-6' ],
+    [ 28597,    'ISO-8859-7',   'greek cp28597 28597',          'iso-8859-7' ],
+    [ 28598,    'ISO-8859-8',   'hebrew cp28598 28598',         'iso-8859-8' ],
+    [ 28599,    'ISO-8859-9',   'latin5 l5 cp28599 28599',      'iso-8859-9' ],
+    [     0,    'ISO-8859-10',  'latin6 l6',                    'iso-8859-10' ],
+    [     0,    'ISO-8859-11',  'thai',                         'iso-8859-11' ],
+    [ 28603,    'ISO-8859-13',  'latin7 l7 cp28603 28603',      'iso-8859-13' ],
+    [     0,    'ISO-8859-14',  'latin8 l8',                    'iso-8859-14' ],
+    [ 28605,    'ISO-8859-15',  'latin9 l9 cp28605 28605',      'iso-8859-15' ],
+    [     0,    'ISO-8859-16',  'latin10 l10',                  'iso-8859-16' ],
+    );
+
+my @pages = ( [(0) x 256] );
+my %index_of_page = ( join( ',', @{$pages[0]} ) => 0 );
+my @entries;
+for my $codepage ( @codepages ) {
+    my ( $number, $name, $aliases, $perl_name ) = @$codepage;
+    my $encoding = find_encoding( $perl_name ) or die "No encoding $perl_name.\n";
+    for my $b ( 0 .. 0x7F ) {
+        die "$name: byte $b isn't ASCII.\n" if $encoding->decode( chr( $b ) ) ne chr( $b );
+    }
+
+    my @sequences;
+    my %bytes_of_page;
+    for my $b ( 0x80 .. 0xFF ) {
+        my $s = $encoding->decode( chr( $b ), Encode::FB_QUIET );
+        if( length $s == 0 ) { push @sequences, 0;  next; }
+        my $code = ord $s;
+        die "$name: byte $b maps to U+$code.\n" if length $s != 1 or $code < 0x80 or $code > 0xFFFF;
+        my $page = ($bytes_of_page{$code >> 8} //= [(0) x 256]);
+        die "$name: U+$code is mapped twice.\n" if $page->[$code & 0xFF];
+        $page->[$code & 0xFF] = $b;
+
+        my $utf8 = $s;
+        utf8::encode( $utf8 );
+        my @bytes = map { ord } split //, $utf8;
+        my $word = scalar( @bytes ) << 24;
+        $word |= $bytes[$_] << (8*$_) for 0 .. $#bytes;
+        push @sequences, $word;
+    }
+
+    my @page_index = (0) x 256;
+    for my $high ( sort { $a <=> $b } keys %bytes_of_page ) {
+        my $key = join( ',', @{$bytes_of_page{$high}} );
+        if( not exists $index_of_page{$key} ) {
+            $index_of_page{$key} = scalar @pages;
+            push @pages, $bytes_of_page{$high};
+        }
+        $page_index[$high] = $index_of_page{$key};
+    }
+    push @entries, [$number, $name, $aliases, \@sequences, \@page_index];
+}
+die "Too many pages for a byte index.\n" if @pages > 256;
+
+sub rows_of
+{
+    my ( $indent, $n_per_row, $format, @values ) = @_;
+    my @rows;
+    while( @values ) {
+        push @rows, $indent . join( ', ', map { sprintf $format, $_ } splice( @values, 0, $n_per_row ) ) . ',';
+    }
+    return join( "\n", @rows );
+}
+
+my $n_pages     = scalar @pages;
+my $page_rows   = join( "\n", map { "        {\n" . rows_of( ' ' x 12, 16, '0x%02X', @$_ ) . "\n        }," } @pages );
+my $n_tables    = scalar @entries;
+my $table_rows  = join( "\n", map {
+    my ( $number, $name, $aliases, $sequences, $page_index ) = @$_;
+    "        {\n"
+    . "            $number, \"$name\", \"$aliases\",\n"
+    . "            {\n" . rows_of( ' ' x 16, 8, '0x%08X', @$sequences ) . "\n            },\n"
+    . "            {\n" . rows_of( ' ' x 16, 16, '0x%02X', @$page_index ) . "\n            },\n"
+    . "        },"
+    } @entries );
+my $perl_encode_version = $Encode::VERSION;
+
+print <<"END";
+#pragma once
+// Generated by `tools/generate-codepage-tables.pl` from Perl Encode $perl_encode_version. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+#include <stdint.h>         // uint32_t
+
+namespace cppm::codepages::impl::codepage_tables {
+    struct Codepage_table
+    {
+        int             number;             // Windows codepage identifier, or 0 if Windows has none.
+        const char*     name;
+        const char*     aliases;            // Separated by spaces.
+
+        // For each byte 0x80 through 0xFF, the UTF-8 sequence in the low 3 bytes, first byte
+        // lowest, and its length in the high byte. 0 means that the byte is unmapped.
+        uint32_t        utf8_sequences[128];
+
+        // For each 256 code points of the BMP, the page in `reverse_pages` with their bytes.
+        Byte            reverse_page_index[256];
+    };
+
+    // The byte that each code point is encoded as, or 0 if it's not in the codepage.
+    inline constexpr Byte reverse_pages[$n_pages][256] =
+    {
+$page_rows
+    };
+
+    inline constexpr Codepage_table tables[$n_tables] =
+    {
+$table_rows
+    };
+}  // namespace cppm::codepages::impl::codepage_tables
+END
@@ -0,0 +1,93 @@
+#!/usr/bin/env perl
+# Generates `microlibs/cppm/utf8/display_width.tables.hpp` from the Unicode database of the
+# running Perl, e.g. `perl tools/generate-display-width-tables.pl > microlibs/cppm/utf8/display_width.tables.hpp`.
+#
+# Widths in terminal columns:
+#   0   Control characters, nonspacing and enclosing marks, format characters except U+00AD
+#       SOFT HYPHEN and the visible prepended concatenation marks, and Hangul medial vowels and
+#       final consonants (conjoining jamo).
+#   2   East Asian Wide and Fullwidth characters, and emoji with default emoji presentation
+#       except regional indicators, which are 1 so that a flag (a pair) gets width 2.
+#   1   Everything else, including East Asian Ambiguous characters.
+#
+# The table has two stages: a block index per 256 code points, and 2-bit widths per block
+# with identical blocks shared.
+use strict;
+use warnings;
+use Unicode::UCD;
+
+my $block_bits  = 8;
+my $block_size  = 1 << $block_bits;
+my $n_blocks    = 0x110000 >> $block_bits;
+
+sub width_of
+{
+    my $c = chr( shift );
+    return 0 if $c =~ /[\p{Cc}\p{Mn}\p{Me}]/;
+    return 0 if $c =~ /\p{Cf}/ and $c ne "\x{00AD}" and $c !~ /\p{Prepended_Concatenation_Mark}/;
+    return 0 if $c =~ /[\p{Hangul_Syllable_Type=V}\p{Hangul_Syllable_Type=T}]/;
+    return 1 if $c =~ /\p{Regional_Indicator}/;
+    return 2 if $c =~ /[\p{East_Asian_Width=W}\p{East_Asian_Width=F}\p{Emoji_Presentation}]/;
+    return 1;
+}
+
+my %index_of_block;
+my @blocks;
+my @block_index;
+for my $b ( 0 .. $n_blocks - 1 ) {
+    my @bytes;
+    for my $i ( 0 .. $block_size/4 - 1 ) {
+        my $byte = 0;
+        for my $k ( 0 .. 3 ) {
+            no warnings 'utf8';     # Surrogates and noncharacters.
+            $byte |= width_of( ($b << $block_bits) + 4*$i + $k ) << (2*$k);
+        }
+        push @bytes, $byte;
+    }
+    my $key = join( ',', @bytes );
+    if( not exists $index_of_block{$key} ) {
+        $index_of_block{$key} = scalar @blocks;
+        push @blocks, [@bytes];
+    }
+    push @block_index, $index_of_block{$key};
+}
+die "Too many distinct blocks for a byte index.\n" if @blocks > 256;
+
+sub rows_of
+{
+    my ( $indent, $n_per_row, @values ) = @_;
+    my @rows;
+    while( @values ) {
+        push @rows, $indent . join( ', ', map { sprintf '0x%02X', $_ } splice( @values, 0, $n_per_row ) ) . ',';
+    }
+    return join( "\n", @rows );
+}
+
+my $version     = Unicode::UCD::UnicodeVersion();
+my $n_distinct  = scalar @blocks;
+my $block_bytes = $block_size/4;
+my $index_rows  = rows_of( ' ' x 8, 16, @block_index );
+my $block_rows  = join( "\n", map { "        {\n" . rows_of( ' ' x 12, 16, @$_ ) . "\n        }," } @blocks );
+
+print <<"END";
+#pragma once
+// Generated by `tools/generate-display-width-tables.pl` from Unicode $version data. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+namespace cppm::utf8::impl::display_width_tables {
+    constexpr char  unicode_version[]   = "$version";
+    constexpr int   block_bits          = $block_bits;
+
+    // Index of the block of widths for each $block_size code points.
+    inline constexpr Byte block_index[$n_blocks] =
+    {
+$index_rows
+    };
+
+    // 2-bit widths, 4 per byte starting with the least significant bits.
+    inline constexpr Byte blocks[$n_distinct][$block_bytes] =
+    {
+$block_rows
+    };
+}  // namespace cppm::utf8::impl::display_width_tables
+END
@@ -0,0 +1,87 @@
+#!/usr/bin/env perl
+# Generates `microlibs/cppm/utf8/grapheme_segmentation.tables.hpp` from the Unicode database of
+# the running Perl, e.g. `perl tools/generate-grapheme-break-tables.pl > microlibs/cppm/utf8/grapheme_segmentation.tables.hpp`.
+#
+# The value per code point is its Grapheme_Cluster_Break property, except that the
+# Extended_Pictographic characters, which all have Grapheme_Cluster_Break=Other, get a value of
+# their own. The table is a two-stage trie: a block index per 256 code points, and 4-bit values
+# per block with identical blocks shared.
+use strict;
+use warnings;
+use Unicode::UCD;
+
+# Must match the order of `cppm::utf8::Grapheme_break::Enum`.
+my @properties = qw( Other CR LF Control Extend ZWJ RI Prepend SpacingMark L V T LV LVT );
+my $extended_pictographic = scalar @properties;
+
+my $block_bits  = 8;
+my $block_size  = 1 << $block_bits;
+my $n_blocks    = 0x110000 >> $block_bits;
+
+my @value_of = (0) x 0x110000;
+{
+    no warnings 'utf8';     # Surrogates and noncharacters.
+    for my $i ( 1 .. $#properties ) {
+        my $property = $properties[$i];
+        for my $code ( 0 .. 0x10FFFF ) {
+            $value_of[$code] = $i if chr( $code ) =~ /\p{Grapheme_Cluster_Break=$property}/;
+        }
+    }
+    for my $code ( 0 .. 0x10FFFF ) {
+        $value_of[$code] = $extended_pictographic if chr( $code ) =~ /\p{Extended_Pictographic}/;
+    }
+}
+
+my %index_of_block;
+my @blocks;
+my @block_index;
+for my $b ( 0 .. $n_blocks - 1 ) {
+    my $first = $b << $block_bits;
+    my @bytes = map { $value_of[$first + 2*$_] | ($value_of[$first + 2*$_ + 1] << 4) } 0 .. $block_size/2 - 1;
+    my $key = join( ',', @bytes );
+    if( not exists $index_of_block{$key} ) {
+        $index_of_block{$key} = scalar @blocks;
+        push @blocks, [@bytes];
+    }
+    push @block_index, $index_of_block{$key};
+}
+die "Too many distinct blocks for a byte index.\n" if @blocks > 256;
+
+sub rows_of
+{
+    my ( $indent, $n_per_row, @values ) = @_;
+    my @rows;
+    while( @values ) {
+        push @rows, $indent . join( ', ', map { sprintf '0x%02X', $_ } splice( @values, 0, $n_per_row ) ) . ',';
+    }
+    return join( "\n", @rows );
+}
+
+my $version     = Unicode::UCD::UnicodeVersion();
+my $n_distinct  = scalar @blocks;
+my $block_bytes = $block_size/2;
+my $index_rows  = rows_of( ' ' x 8, 16, @block_index );
+my $block_rows  = join( "\n", map { "        {\n" . rows_of( ' ' x 12, 16, @$_ ) . "\n        }," } @blocks );
+
+print <<"END";
+#pragma once
+// Generated by `tools/generate-grapheme-break-tables.pl` from Unicode $version data. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+namespace cppm::utf8::impl::grapheme_break_tables {
+    constexpr char  unicode_version[]   = "$version";
+    constexpr int   block_bits          = $block_bits;
+
+    // Index of the block of properties for each $block_size code points.
+    inline constexpr Byte block_index[$n_blocks] =
+    {
+$index_rows
+    };
+
+    // 4-bit property values, 2 per byte starting with the least significant bits.
+    inline constexpr Byte blocks[$n_distinct][$block_bytes] =
+    {
+$block_rows
+    };
+}  // namespace cppm::utf8::impl::grapheme_break_tables
+END
@@ -0,0 +1,219 @@
+#!/usr/bin/env perl
+# Generates `microlibs/cppm/utf8/normalization.tables.hpp` from the Unicode database of the
+# running Perl, e.g. `perl tools/generate-normalization-tables.pl > microlibs/cppm/utf8/normalization.tables.hpp`.
+#
+# Per code point there's a 16-bit property value: the canonical combining class in the low byte,
+# and the quick check values of NFD, NFC, NFKD and NFKC as 2 bits each above it (0 = Yes,
+# 1 = Maybe, 2 = No), and a 16-bit index of the full decompositions, if any. Both are two-stage
+# tries with identical blocks shared. The decompositions are stored as UTF-8. Hangul syllables
+# are decomposed and composed algorithmically, so they're not in the tables.
+use strict;
+use warnings;
+use Unicode::UCD;
+use Unicode::Normalize qw(
+    getCanon getCompat getCombinClass isComp_Ex
+    isNFD_NO isNFC_NO isNFC_MAYBE isNFKD_NO isNFKC_NO isNFKC_MAYBE
+    );
+
+my $block_bits  = 7;
+my $block_size  = 1 << $block_bits;
+my $n_blocks    = 0x110000 >> $block_bits;
+
+sub is_hangul_syllable { my ( $code ) = @_;  return 0xAC00 <= $code && $code <= 0xD7A3; }
+
+sub utf8_bytes_of
+{
+    my ( $s ) = @_;
+    utf8::encode( $s );
+    return map { ord } split //, $s;
+}
+
+my @properties;
+my @quick_check_limits = ( 0x110000 ) x 4;     # Per form: NFD, NFC, NFKD, NFKC.
+my @decomposition_index = (0) x 0x110000;
+my @decompositions = ( [0, 0, 0] );             # Offset, canonical length, compatibility length.
+my @decomposition_bytes;
+{
+    no warnings 'utf8';     # Surrogates and noncharacters.
+    for my $code ( 0 .. 0x10FFFF ) {
+        my @qc = (
+            (isNFD_NO( $code )? 2 : 0),
+            (isNFC_NO( $code )? 2 : isNFC_MAYBE( $code )? 1 : 0),
+            (isNFKD_NO( $code )? 2 : 0),
+            (isNFKC_NO( $code )? 2 : isNFKC_MAYBE( $code )? 1 : 0),
+            );
+        my $ccc = getCombinClass( $code );
+        $properties[$code] = $ccc | ($qc[0] << 8) | ($qc[1] << 10) | ($qc[2] << 12) | ($qc[3] << 14);
+        for my $form ( 0 .. 3 ) {
+            if( ($qc[$form] != 0 or $ccc != 0) and $quick_check_limits[$form] == 0x110000 ) {
+                $quick_check_limits[$form] = $code;
+            }
+        }
+
+        next if is_hangul_syllable( $code );
+        my $canonical       = getCanon( $code );
+        my $compatibility   = getCompat( $code );
+        next if not defined $compatibility;
+        my @canonical_bytes = (defined $canonical? utf8_bytes_of( $canonical ) : ());
+        my @compatibility_bytes = utf8_bytes_of( $compatibility );
+        die "Too long decomposition.\n" if @compatibility_bytes > 255;
+        $decomposition_index[$code] = scalar @decompositions;
+        push @decompositions, [scalar @decomposition_bytes, scalar @canonical_bytes, scalar @compatibility_bytes];
+        push @decomposition_bytes, @canonical_bytes, @compatibility_bytes;
+    }
+}
+# Per form, a bit per 64 code points of the BMP that are all starters with quick check value Yes.
+my @yes_block_words;
+for my $form ( 0 .. 3 ) {
+    my @words = (0) x 16;
+    for my $block ( 0 .. 1023 ) {
+        my $is_yes = 1;
+        for my $code ( 64*$block .. 64*$block + 63 ) {
+            my $p = $properties[$code];
+            if( ($p & 0xFF) != 0 or (($p >> (8 + 2*$form)) & 3) != 0 ) { $is_yes = 0;  last; }
+        }
+        $words[$block >> 6] |= (1 << ($block & 63)) if $is_yes;
+    }
+    push @yes_block_words, \@words;
+}
+
+die "Too many decompositions for a 16-bit index.\n" if @decompositions > 0x10000;
+die "Too many decomposition bytes for a 16-bit offset.\n" if @decomposition_bytes > 0x10000;
+
+my @compositions;
+for my $code ( 0 .. 0x10FFFF ) {
+    next if is_hangul_syllable( $code ) or isComp_Ex( $code );
+    next if not defined getCanon( $code );
+    # A primary composite has a canonical mapping of 2 code points, and isn't excluded from
+    # composition as a singleton, a non-starter decomposition or by CompositionExclusions.txt.
+    my $mapping = Unicode::UCD::charinfo( $code )->{decomposition};
+    next if $mapping eq '' or $mapping =~ /^</;
+    my @pair = map { hex } split / /, $mapping;
+    next if @pair != 2;
+    push @compositions, [@pair, $code];
+}
+@compositions = sort { $a->[0] <=> $b->[0] or $a->[1] <=> $b->[1] } @compositions;
+
+# Two-stage trie of 16-bit values, returns ( block index, blocks ).
+sub trie_of
+{
+    my ( @values ) = @_;
+    my ( %index_of_block, @blocks, @block_index );
+    for my $b ( 0 .. $n_blocks - 1 ) {
+        my @block = @values[$b*$block_size .. ($b + 1)*$block_size - 1];
+        my $key = join( ',', @block );
+        if( not exists $index_of_block{$key} ) {
+            $index_of_block{$key} = scalar @blocks;
+            push @blocks, [@block];
+        }
+        push @block_index, $index_of_block{$key};
+    }
+    die "Too many distinct blocks for a byte index.\n" if @blocks > 256;
+    return ( \@block_index, \@blocks );
+}
+
+sub rows_of
+{
+    my ( $indent, $n_per_row, $format, @values ) = @_;
+    my @rows;
+    while( @values ) {
+        push @rows, $indent . join( ', ', map { sprintf $format, $_ } splice( @values, 0, $n_per_row ) ) . ',';
+    }
+    return join( "\n", @rows );
+}
+
+sub blocks_text_of
+{
+    my ( $blocks ) = @_;
+    return join( "\n", map { "        {\n" . rows_of( ' ' x 12, 16, '0x%04X', @$_ ) . "\n        }," } @$blocks );
+}
+
+my ( $property_index, $property_blocks )            = trie_of( @properties );
+my ( $decomposition_block_index, $decomposition_blocks ) = trie_of( @decomposition_index );
+
+my $version                 = Unicode::UCD::UnicodeVersion();
+my $limits                  = join( ', ', map { sprintf '0x%04X', $_ } @quick_check_limits );
+my $yes_block_rows          = join( "\n", map { "        {\n" . rows_of( ' ' x 12, 4, '0x%016X', @$_ ) . "\n        }," } @yes_block_words );
+my $n_property_blocks       = scalar @$property_blocks;
+my $n_decomposition_blocks  = scalar @$decomposition_blocks;
+my $property_index_rows     = rows_of( ' ' x 8, 16, '0x%02X', @$property_index );
+my $property_block_rows     = blocks_text_of( $property_blocks );
+my $decomposition_index_rows = rows_of( ' ' x 8, 16, '0x%02X', @$decomposition_block_index );
+my $decomposition_block_rows = blocks_text_of( $decomposition_blocks );
+my $n_decompositions        = scalar @decompositions;
+my $decomposition_rows      = join( "\n", map { sprintf '        { 0x%04X, %d, %d },', @$_ } @decompositions );
+my $n_decomposition_bytes   = scalar @decomposition_bytes;
+my $decomposition_byte_rows = rows_of( ' ' x 8, 16, '0x%02X', @decomposition_bytes );
+my $n_compositions          = scalar @compositions;
+my $composition_rows        = join( "\n", map { sprintf '        { 0x%04X, 0x%04X, 0x%04X },', @$_ } @compositions );
+
+print <<"END";
+#pragma once
+// Generated by `tools/generate-normalization-tables.pl` from Unicode $version data. Don't edit.
+#include <cppm/basics/Byte.hpp>
+
+#include <stdint.h>         // uint16_t, uint64_t
+
+namespace cppm::utf8::impl::normalization_tables {
+    constexpr char  unicode_version[]   = "$version";
+    constexpr int   block_bits          = $block_bits;
+
+    // Per form NFD, NFC, NFKD and NFKC, the first code point that isn't normalized by itself.
+    constexpr char32_t quick_check_limits[4] = { $limits };
+
+    // Per form, bit `code >> 6` is set when the 64 code points from `code & ~63` in the BMP all are
+    // starters with quick check value Yes, e.g. for NFC Cyrillic and the CJK ideographs.
+    inline constexpr uint64_t yes_blocks[4][16] =
+    {
+$yes_block_rows
+    };
+
+    // Index of the block of property values for each $block_size code points.
+    inline constexpr Byte property_block_index[$n_blocks] =
+    {
+$property_index_rows
+    };
+
+    // Canonical combining class in bits 0-7, quick check values 0 = Yes, 1 = Maybe, 2 = No
+    // for NFD, NFC, NFKD and NFKC in bits 8-9, 10-11, 12-13 and 14-15.
+    inline constexpr uint16_t property_blocks[$n_property_blocks][$block_size] =
+    {
+$property_block_rows
+    };
+
+    // Index of the block of decomposition indices for each $block_size code points.
+    inline constexpr Byte decomposition_block_index[$n_blocks] =
+    {
+$decomposition_index_rows
+    };
+
+    // Indices in `decompositions`, where 0 means none.
+    inline constexpr uint16_t decomposition_blocks[$n_decomposition_blocks][$block_size] =
+    {
+$decomposition_block_rows
+    };
+
+    // The full canonical decomposition, if any, followed by the full compatibility
+    // decomposition, in `decomposition_bytes`.
+    struct Decomposition{ uint16_t offset; Byte n_canonical_bytes; Byte n_compatibility_bytes; };
+
+    inline constexpr Decomposition decompositions[$n_decompositions] =
+    {
+$decomposition_rows
+    };
+
+    // UTF-8.
+    inline constexpr Byte decomposition_bytes[$n_decomposition_bytes] =
+    {
+$decomposition_byte_rows
+    };
+
+    // The primary composites that aren't excluded from composition, sorted on `first` and `second`.
+    struct Composition{ char32_t first; char32_t second; char32_t composite; };
+
+    inline constexpr Composition compositions[$n_compositions] =
+    {
+$composition_rows
+    };
+}  // namespace cppm::utf8::impl::normalization_tables
+END